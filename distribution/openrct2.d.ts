@@ -281,6 +281,13 @@ declare global {
 
         subscribe(hook: "action.query", callback: (e: GameActionEventArgs) => void): IDisposable;
         subscribe(hook: "action.execute", callback: (e: GameActionEventArgs) => void): IDisposable;
+        /**
+         * Called once per tick with all the actions that were queried or executed successfully since the last tick,
+         * in the order they ran. Cheaper than the per-action hooks when many actions are run, but the results can not
+         * be changed anymore.
+         */
+        subscribe(hook: "action.query.batch", callback: (e: GameActionEventArgs[]) => void): IDisposable;
+        subscribe(hook: "action.execute.batch", callback: (e: GameActionEventArgs[]) => void): IDisposable;
         subscribe(hook: "interval.tick", callback: () => void): IDisposable;
         subscribe(hook: "interval.day", callback: () => void): IDisposable;
         subscribe(hook: "network.chat", callback: (e: NetworkChatEventArgs) => void): IDisposable;
@@ -326,6 +333,19 @@ declare global {
          * @param handle The numerical handle of the registered timeout to remove.
          */
         clearTimeout(handle: number): void;
+
+        /**
+         * Starts a worker that runs the given script on its own thread, in parallel with the game.
+         * The worker has no access to the game or to any of the plugin APIs, it can only exchange
+         * messages with the plugin. Within the worker script, the global function `postMessage`
+         * sends a message to the plugin and the global function `onMessage`, if defined by the
+         * script, receives the messages posted by the plugin.
+         * Messages are copied between the plugin and the worker. Arrays, objects, strings, numbers
+         * and booleans are supported, typed arrays arrive as a Uint8Array of their bytes.
+         * The worker is terminated when the plugin is stopped.
+         * @param source The script to run in the worker.
+         */
+        createWorker(source: string): Worker;
     }
 
     interface Configuration {
@@ -406,7 +426,8 @@ declare global {
         "interval.tick" | "interval.day" |
         "network.chat" | "network.action" | "network.join" | "network.leave" |
         "ride.ratings.calculate" | "action.location" | "vehicle.crash" |
-        "map.change" | "map.changed" | "map.save";
+        "map.change" | "map.changed" | "map.save" |
+        "action.query.batch" | "action.execute.batch";
 
     type ExpenditureType =
         "ride_construction" |
@@ -613,6 +634,17 @@ declare global {
 
         getRide(id: number): Ride;
         getTile(x: number, y: number): Tile;
+        /**
+         * Reads one value for every tile in a rectangle of tiles in a single call, which is a lot faster than
+         * reading the same value through getTile for each tile. The value for tile (x + i, y + j) is at index
+         * j * width + i. Tiles outside of the map read as 0.
+         * @param layer The value to read for each tile.
+         * @param x The x coordinate of the first tile, in tiles.
+         * @param y The y coordinate of the first tile, in tiles.
+         * @param width The number of tiles to read along the x axis.
+         * @param height The number of tiles to read along the y axis.
+         */
+        getTileData(layer: TileDataLayer, x: number, y: number, width: number, height: number): Uint8Array;
         getEntity(id: number): Entity;
         getAllEntities(type: EntityType): Entity[];
         /**
@@ -629,11 +661,95 @@ declare global {
         getAllEntitiesOnTile(type: "car", tilePos: CoordsXY): Car[];
         getAllEntitiesOnTile(type: "litter", tilePos: CoordsXY): Litter[];
         createEntity(type: EntityType, initializer: object): Entity;
+        /**
+         * Gets the entities of the given type that match all conditions of the filter, ordered by id. The filtering is
+         * done natively, so only the matching entities are created as objects.
+         * @param type The type of entities to get.
+         * @param filter The conditions the entities have to match, leave out to get all entities of the type.
+         */
+        queryEntities(type: EntityType, filter?: EntityQueryFilter): Entity[];
+        queryEntities(type: "guest", filter?: EntityQueryFilter): Guest[];
+        queryEntities(type: "staff", filter?: EntityQueryFilter): Staff[];
+        queryEntities(type: "car", filter?: EntityQueryFilter): Car[];
+        queryEntities(type: "litter", filter?: EntityQueryFilter): Litter[];
+        /**
+         * Counts the entities of the given type that match all conditions of the filter, without creating any objects.
+         * @param type The type of entities to count.
+         * @param filter The conditions the entities have to match, leave out to count all entities of the type.
+         */
+        countEntities(type: EntityType, filter?: EntityQueryFilter): number;
+    }
+
+    /**
+     * An inclusive range of values, a missing bound does not limit the range.
+     */
+    interface NumberRange {
+        min?: number;
+        max?: number;
+    }
+
+    /**
+     * Conditions for GameMap.queryEntities and GameMap.countEntities, conditions that are left out match every entity.
+     * Using a condition that does not apply to the entity type throws an error.
+     */
+    interface EntityQueryFilter {
+        /**
+         * Only entities within this range, in coordinates (32 per tile). The range is inclusive and areas are much
+         * faster to query than the whole map.
+         */
+        range?: MapRange;
+        /**
+         * Guests and staff only. Only peeps that are queuing for, entering, on or leaving the ride with this id, or
+         * staff that are heading to, inspecting or fixing it.
+         */
+        ride?: number;
+        /**
+         * Guests and staff only.
+         */
+        energy?: NumberRange;
+        /**
+         * Guests only.
+         */
+        isInPark?: boolean;
+        /**
+         * Guests only.
+         */
+        isLost?: boolean;
+        /**
+         * Guests only.
+         */
+        happiness?: NumberRange;
+        /**
+         * Guests only.
+         */
+        nausea?: NumberRange;
+        /**
+         * Guests only.
+         */
+        hunger?: NumberRange;
+        /**
+         * Guests only.
+         */
+        thirst?: NumberRange;
+        /**
+         * Guests only.
+         */
+        toilet?: NumberRange;
     }
 
     type TileElementType =
         "surface" | "footpath" | "track" | "small_scenery" | "wall" | "entrance" | "large_scenery" | "banner";
 
+    /**
+     * The values GameMap.getTileData can read for each tile:
+     * - surfaceHeight: the base height of the surface element.
+     * - ownership: the ownership flags of the surface element.
+     * - elementTypes: a bit for each type of element on the tile. From the lowest bit these are surface, footpath, track,
+     *   small_scenery, entrance, wall, large_scenery and banner.
+     * - footpath: 1 if there is a footpath element on the tile, otherwise 0.
+     */
+    type TileDataLayer = "surfaceHeight" | "ownership" | "elementTypes" | "footpath";
+
     type Direction = 0 | 1 | 2 | 3;
 
     type TileElement =
@@ -2442,6 +2558,16 @@ declare global {
 
         onHighlight?: (item: number, column: number) => void;
         onClick?: (item: number, column: number) => void;
+
+        /**
+         * Replaces the item at the given index without passing all items again.
+         * Only available on a widget of an open window.
+         */
+        setItem?(index: number, item: string | ListViewItem): void;
+        /** Inserts an item at the given index, items after it move down. */
+        insertItem?(index: number, item: string | ListViewItem): void;
+        /** Removes the item at the given index, items after it move up. */
+        removeItem?(index: number): void;
     }
 
     interface SpinnerWidget extends WidgetBase {
@@ -2608,6 +2734,28 @@ declare global {
         off(event: "data", callback: (data: string) => void): Socket;
     }
 
+    /**
+     * A script running on its own thread, see `context.createWorker`.
+     */
+    interface Worker {
+        /**
+         * Sends a copy of the given value to the worker's `onMessage` function.
+         */
+        postMessage(message: any): void;
+
+        /**
+         * Stops the worker, interrupting any script that is running. Messages that the worker has
+         * posted but that have not been received yet are discarded.
+         */
+        terminate(): void;
+
+        on(event: "message", callback: (message: any) => void): Worker;
+        on(event: "error", callback: (error: string) => void): Worker;
+
+        off(event: "message", callback: (message: any) => void): Worker;
+        off(event: "error", callback: (error: string) => void): Worker;
+    }
+
     interface TitleSequence {
         /**
          * The name of the title sequence.
@@ -2922,10 +3070,22 @@ declare global {
 
     interface Profiler {
         getData(): ProfiledFunction[];
+        /**
+         * Gets the time spent in the hooks of each plugin, one entry for every plugin and hook that has been called.
+         * These are recorded whether or not the profiler is enabled.
+         */
+        getPluginData(): ProfiledHook[];
         start(): void;
         stop(): void;
+        /**
+         * Clears the profiler data and the hook timings of all plugins.
+         */
         reset(): void;
         readonly enabled: boolean;
+        /**
+         * Whether heap allocations are counted, otherwise the allocation counts of the functions are always 0.
+         */
+        readonly allocationTracking: boolean;
     }
 
     interface ProfiledFunction {
@@ -2934,7 +3094,24 @@ declare global {
         readonly minTime: number;
         readonly maxTime: number;
         readonly totalTime: number;
+        readonly allocationCount: number;
+        readonly allocatedBytes: number;
         readonly parents: number[];
         readonly children: number[];
     }
+
+    interface ProfiledHook {
+        readonly plugin: string;
+        readonly hook: HookType;
+        readonly callCount: number;
+        /**
+         * Times are in microseconds.
+         */
+        readonly maxTime: number;
+        readonly totalTime: number;
+        /**
+         * The number of calls that exceeded the hook time budget set in the configuration.
+         */
+        readonly overBudgetCount: number;
+    }
 }
@@ -221,6 +221,14 @@ public:
         return (windowFlags & SDL_WINDOW_MINIMIZED) || (windowFlags & SDL_WINDOW_HIDDEN);
     }
 
+    int32_t GetDisplayRefreshRate() override
+    {
+        SDL_DisplayMode mode;
+        if (_window == nullptr || SDL_GetWindowDisplayMode(_window, &mode) != 0)
+            return 0;
+        return mode.refresh_rate;
+    }
+
     bool IsSteamOverlayActive() override
     {
         return _steamOverlayActive;
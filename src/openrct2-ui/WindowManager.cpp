@@ -458,8 +458,7 @@ public:
             case INTENT_ACTION_UPDATE_GUEST_COUNT:
                 gToolbarDirtyFlags |= BTM_TB_DIRTY_FLAG_PEEP_COUNT;
                 window_invalidate_by_class(WC_GUEST_LIST);
-                window_invalidate_by_class(WC_PARK_INFORMATION);
-                WindowGuestListRefreshList();
+                WindowGuestListUpdateGuestCount();
                 break;
 
             case INTENT_ACTION_UPDATE_PARK_RATING:
@@ -472,7 +471,7 @@ public:
                 break;
 
             case INTENT_ACTION_UPDATE_CASH:
-                window_invalidate_by_class(WC_FINANCES);
+                // The finances window compares the values it shows itself.
                 gToolbarDirtyFlags |= BTM_TB_DIRTY_FLAG_MONEY;
                 break;
 
@@ -14,7 +14,6 @@
 #include <cmath>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/common.h>
-#include <speex/speex_resampler.h>
 
 namespace OpenRCT2::Audio
 {
@@ -24,7 +23,7 @@ namespace OpenRCT2::Audio
 
     private:
         AudioSource_* _source = nullptr;
-        SpeexResamplerState* _resampler = nullptr;
+        ResampleState _resampleState;
 
         MixerGroup _group = MixerGroup::Sound;
         double _rate = 0;
@@ -54,11 +53,6 @@ namespace OpenRCT2::Audio
 
         ~AudioChannelImpl() override
         {
-            if (_resampler != nullptr)
-            {
-                speex_resampler_destroy(_resampler);
-                _resampler = nullptr;
-            }
             if (_deletesourceondone)
             {
                 delete _source;
@@ -70,14 +64,9 @@ namespace OpenRCT2::Audio
             return _source;
         }
 
-        [[nodiscard]] SpeexResamplerState* GetResampler() const override
-        {
-            return _resampler;
-        }
-
-        void SetResampler(SpeexResamplerState* value) override
+        [[nodiscard]] ResampleState& GetResampleState() override
         {
-            _resampler = value;
+            return _resampleState;
         }
 
         [[nodiscard]] MixerGroup GetGroup() const override
@@ -230,6 +219,7 @@ namespace OpenRCT2::Audio
             _loop = loop;
             _offset = 0;
             _done = false;
+            _resampleState = {};
         }
 
         void UpdateOldVolume() override
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <openrct2/audio/AudioChannel.h>
 #include <openrct2/audio/AudioSource.h>
@@ -16,7 +17,6 @@
 #include <string>
 
 struct SDL_RWops;
-using SpeexResamplerState = struct SpeexResamplerState_;
 
 namespace OpenRCT2::Audio
 {
@@ -53,11 +53,25 @@ namespace OpenRCT2::Audio
         [[nodiscard]] virtual AudioFormat GetFormat() const abstract;
     };
 
+    /**
+     * State the mixer keeps per channel to resample it continuously across audio callbacks.
+     */
+    struct ResampleState
+    {
+        // SDL supports up to 8 channels.
+        static constexpr size_t MaxChannels = 8;
+        static constexpr size_t HistoryFrames = 2;
+
+        // The last frames that were read, the next frames read from the channel follow them.
+        std::array<int16_t, HistoryFrames * MaxChannels> History{};
+        // Position of the next output frame in frames, relative to the first history frame.
+        double Position = HistoryFrames;
+    };
+
     struct ISDLAudioChannel : public IAudioChannel
     {
         [[nodiscard]] virtual AudioFormat GetFormat() const abstract;
-        [[nodiscard]] virtual SpeexResamplerState* GetResampler() const abstract;
-        virtual void SetResampler(SpeexResamplerState* value) abstract;
+        [[nodiscard]] virtual ResampleState& GetResampleState() abstract;
     };
 
     namespace AudioSource
@@ -22,7 +22,7 @@
 #include <openrct2/audio/audio.h>
 #include <openrct2/common.h>
 #include <openrct2/config/Config.h>
-#include <speex/speex_resampler.h>
+#include <utility>
 #include <vector>
 
 namespace OpenRCT2::Audio
@@ -44,9 +44,14 @@ namespace OpenRCT2::Audio
         IAudioSource* _css1Sources[RCT2SoundCount] = { nullptr };
         IAudioSource* _musicSources[PATH_ID_END] = { nullptr };
 
+        // Buffers only ever grow, so the audio callback does not allocate once they have reached the callback size.
         std::vector<uint8_t> _channelBuffer;
         std::vector<uint8_t> _convertBuffer;
         std::vector<uint8_t> _effectBuffer;
+        std::vector<float> _mixBuffer;
+
+        // Conversions from the formats of streamed sources, the sounds are converted to the device format when loaded.
+        std::vector<std::pair<AudioFormat, SDL_AudioCVT>> _conversions;
 
     public:
         AudioMixerImpl()
@@ -75,6 +80,7 @@ namespace OpenRCT2::Audio
             };
             want.userdata = this;
 
+            // No changes are allowed, so SDL converts to the device if required and the mixer always gets signed 16 bit.
             SDL_AudioSpec have;
             _deviceId = SDL_OpenAudioDevice(device, 0, &want, &have, 0);
             _format.format = have.format;
@@ -122,6 +128,9 @@ namespace OpenRCT2::Audio
             _convertBuffer.shrink_to_fit();
             _effectBuffer.clear();
             _effectBuffer.shrink_to_fit();
+            _mixBuffer.clear();
+            _mixBuffer.shrink_to_fit();
+            _conversions.clear();
         }
 
         void Lock() override
@@ -211,8 +220,10 @@ namespace OpenRCT2::Audio
         {
             UpdateAdjustedSound();
 
-            // Zero the output buffer
-            std::fill_n(dst, length, 0);
+            // Channels are summed up as floats and only clamped once all of them have been mixed.
+            const auto numSamples = length / _format.BytesPerSample();
+            EnsureSize(_mixBuffer, numSamples);
+            std::fill_n(_mixBuffer.begin(), numSamples, 0.0f);
 
             // Mix channels onto output buffer
             auto it = _channels.begin();
@@ -223,7 +234,7 @@ namespace OpenRCT2::Audio
                 if ((group != MixerGroup::Sound || gConfigSound.sound_enabled) && gConfigSound.master_sound_enabled
                     && gConfigSound.master_volume != 0)
                 {
-                    MixChannel(channel, dst, length);
+                    MixChannel(channel, length);
                 }
                 if ((channel->IsDone() && channel->DeleteOnDone()) || channel->IsStopping())
                 {
@@ -235,6 +246,8 @@ namespace OpenRCT2::Audio
                     it++;
                 }
             }
+
+            WriteS16(_mixBuffer.data(), reinterpret_cast<int16_t*>(dst), numSamples);
         }
 
         void UpdateAdjustedSound()
@@ -252,133 +265,133 @@ namespace OpenRCT2::Audio
             }
         }
 
-        void MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length)
+        void MixChannel(ISDLAudioChannel* channel, size_t length)
         {
-            int32_t byteRate = _format.GetByteRate();
-            auto numSamples = static_cast<int32_t>(length / byteRate);
-            double rate = 1;
-            if (_format.format == AUDIO_S16SYS)
+            const auto frameSize = static_cast<size_t>(_format.GetByteRate());
+            const auto numChannels = static_cast<size_t>(_format.channels);
+            if (numChannels > ResampleState::MaxChannels)
             {
-                rate = channel->GetRate();
+                return;
             }
+            auto numFrames = length / frameSize;
+            double rate = channel->GetRate();
 
-            bool mustConvert = false;
-            SDL_AudioCVT cvt;
-            cvt.len_ratio = 1;
+            const SDL_AudioCVT* conversion = nullptr;
             AudioFormat streamformat = channel->GetFormat();
             if (streamformat != _format)
             {
-                if (SDL_BuildAudioCVT(
-                        &cvt, streamformat.format, streamformat.channels, streamformat.freq, _format.format, _format.channels,
-                        _format.freq)
-                    == -1)
+                conversion = GetConversion(streamformat);
+                if (conversion == nullptr)
                 {
                     // Unable to convert channel data
                     return;
                 }
-                mustConvert = true;
             }
 
-            // Read raw PCM from channel
-            int32_t readSamples = numSamples * rate;
-            auto readLength = static_cast<size_t>(readSamples / cvt.len_ratio) * byteRate;
-            _channelBuffer.resize(readLength);
-            size_t bytesRead = channel->Read(_channelBuffer.data(), readLength);
+            // Read raw PCM from channel, leaving room for the history frames of the resampler in front of it
+            auto& resampleState = channel->GetResampleState();
+            const auto historySize = ResampleState::HistoryFrames * frameSize;
+            auto readFrames = rate != 1 ? GetResampleReadFrames(resampleState.Position, numFrames, rate) : numFrames;
+            auto lenRatio = conversion != nullptr ? conversion->len_ratio : 1.0;
+            auto readLength = static_cast<size_t>(readFrames / lenRatio) * frameSize;
+            EnsureSize(_channelBuffer, historySize + readLength);
+            size_t bytesRead = channel->Read(_channelBuffer.data() + historySize, readLength);
 
             // Convert data to required format if necessary
-            void* buffer = nullptr;
-            size_t bufferLen = 0;
-            if (mustConvert)
+            size_t bufferLen = bytesRead;
+            if (conversion != nullptr)
             {
-                if (Convert(&cvt, _channelBuffer.data(), bytesRead))
-                {
-                    buffer = cvt.buf;
-                    bufferLen = cvt.len_cvt;
-                }
-                else
+                SDL_AudioCVT cvt = *conversion;
+                if (!Convert(&cvt, _channelBuffer.data() + historySize, bytesRead))
                 {
                     return;
                 }
+                bufferLen = static_cast<size_t>(cvt.len_cvt);
+                EnsureSize(_channelBuffer, historySize + bufferLen);
+                std::copy_n(cvt.buf, bufferLen, _channelBuffer.data() + historySize);
             }
-            else
-            {
-                buffer = _channelBuffer.data();
-                bufferLen = bytesRead;
-            }
+
+            auto* frames = reinterpret_cast<int16_t*>(_channelBuffer.data());
+            const auto historySamples = ResampleState::HistoryFrames * numChannels;
+            const auto framesRead = bufferLen / frameSize;
+            std::copy_n(resampleState.History.begin(), historySamples, frames);
 
             // Apply effects
+            const int16_t* buffer = frames + historySamples;
             if (rate != 1)
             {
-                auto inRate = static_cast<int32_t>(bufferLen / byteRate);
-                int32_t outRate = numSamples;
-                if (bytesRead != readLength)
-                {
-                    inRate = _format.freq;
-                    outRate = _format.freq * (1 / rate);
-                }
-                _effectBuffer.resize(length);
-                bufferLen = ApplyResample(
-                    channel, buffer, static_cast<int32_t>(bufferLen / byteRate), numSamples, inRate, outRate);
-                buffer = _effectBuffer.data();
+                EnsureSize(_effectBuffer, length);
+                auto* resampled = reinterpret_cast<int16_t*>(_effectBuffer.data());
+                numFrames = ResampleS16(
+                    frames, ResampleState::HistoryFrames + framesRead, resampled, numFrames, numChannels,
+                    resampleState.Position, rate);
+                resampleState.Position += static_cast<double>(numFrames) * rate - static_cast<double>(framesRead);
+                buffer = resampled;
+            }
+            else
+            {
+                numFrames = std::min(numFrames, framesRead);
+                resampleState.Position = ResampleState::HistoryFrames;
             }
 
-            // Apply panning and volume
-            ApplyPan(channel, buffer, bufferLen, byteRate);
-            int32_t mixVolume = ApplyVolume(channel, buffer, bufferLen);
+            // The last frames read become the history, so a later rate change continues without a discontinuity.
+            std::copy_n(frames + framesRead * numChannels, historySamples, resampleState.History.begin());
 
-            // Finally mix on to destination buffer
-            size_t dstLength = std::min(length, bufferLen);
-            SDL_MixAudioFormat(
-                data, static_cast<const uint8_t*>(buffer), _format.format, static_cast<uint32_t>(dstLength), mixVolume);
+            // Finally mix on to the mix buffer with panning and volume
+            const auto [startVolume, endVolume] = GetMixVolume(channel);
+            if (numChannels == 2)
+            {
+                MixStereoS16(
+                    buffer, _mixBuffer.data(), numFrames, startVolume, endVolume, channel->GetOldVolumeL(),
+                    channel->GetVolumeL(), channel->GetOldVolumeR(), channel->GetVolumeR());
+            }
+            else
+            {
+                MixS16(buffer, _mixBuffer.data(), numFrames * numChannels, startVolume, endVolume);
+            }
 
             channel->UpdateOldVolume();
         }
 
-        /**
-         * Resample the given buffer into _effectBuffer.
-         * Assumes that srcBuffer is the same format as _format.
-         */
-        size_t ApplyResample(
-            ISDLAudioChannel* channel, const void* srcBuffer, int32_t srcSamples, int32_t dstSamples, int32_t inRate,
-            int32_t outRate)
+        const SDL_AudioCVT* GetConversion(const AudioFormat& format)
         {
-            int32_t byteRate = _format.GetByteRate();
-
-            // Create resampler
-            SpeexResamplerState* resampler = channel->GetResampler();
-            if (resampler == nullptr)
+            auto it = std::find_if(_conversions.begin(), _conversions.end(), [&format](const auto& conversion) {
+                return conversion.first == format;
+            });
+            if (it == _conversions.end())
             {
-                resampler = speex_resampler_init(_format.channels, _format.freq, _format.freq, 0, nullptr);
-                channel->SetResampler(resampler);
+                SDL_AudioCVT cvt;
+                if (SDL_BuildAudioCVT(
+                        &cvt, format.format, format.channels, format.freq, _format.format, _format.channels, _format.freq)
+                    == -1)
+                {
+                    return nullptr;
+                }
+                it = _conversions.emplace(_conversions.end(), format, cvt);
             }
-            speex_resampler_set_rate(resampler, inRate, outRate);
-
-            uint32_t inLen = srcSamples;
-            uint32_t outLen = dstSamples;
-            speex_resampler_process_interleaved_int(
-                resampler, static_cast<const spx_int16_t*>(srcBuffer), &inLen,
-                reinterpret_cast<spx_int16_t*>(_effectBuffer.data()), &outLen);
-
-            return outLen * byteRate;
+            return &it->second;
         }
 
-        void ApplyPan(const IAudioChannel* channel, void* buffer, size_t len, size_t sampleSize)
+        /**
+         * Returns the number of frames that have to be read, in addition to the history frames, to resample numFrames
+         * frames starting at the given position.
+         */
+        static size_t GetResampleReadFrames(double position, size_t numFrames, double rate)
         {
-            if (channel->GetPan() != 0.5f && _format.channels == 2)
+            if (numFrames == 0)
             {
-                switch (_format.format)
-                {
-                    case AUDIO_S16SYS:
-                        EffectPanS16(channel, static_cast<int16_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                        break;
-                    case AUDIO_U8:
-                        EffectPanU8(channel, static_cast<uint8_t*>(buffer), static_cast<int32_t>(len / sampleSize));
-                        break;
-                }
+                return 0;
             }
+            // The last output frame is interpolated between the frame at its position and the one after it.
+            const auto lastFrame = static_cast<size_t>(position + static_cast<double>(numFrames - 1) * rate) + 1;
+            return lastFrame >= ResampleState::HistoryFrames ? lastFrame + 1 - ResampleState::HistoryFrames : 0;
         }
 
-        int32_t ApplyVolume(const IAudioChannel* channel, void* buffer, size_t len)
+        /**
+         * Returns the volume at the start and end of the buffer, fading between them smooths out sudden volume changes
+         * which would otherwise click.
+         */
+        std::pair<float, float> GetMixVolume(const IAudioChannel* channel) const
         {
             float volumeAdjust = _volume;
             volumeAdjust *= gConfigSound.master_sound_enabled ? (static_cast<float>(gConfigSound.master_volume) / 100.0f)
@@ -407,83 +420,82 @@ namespace OpenRCT2::Audio
             {
                 endVolume = 0;
             }
+            return { static_cast<float>(startVolume) / MIXER_VOLUME_MAX, static_cast<float>(endVolume) / MIXER_VOLUME_MAX };
+        }
 
-            int32_t mixVolume = channel->GetVolume() * volumeAdjust;
-            if (startVolume != endVolume)
+        template<typename T> static void EnsureSize(std::vector<T>& buffer, size_t size)
+        {
+            if (buffer.size() < size)
             {
-                // Set to max since we are adjusting the volume ourselves
-                mixVolume = MIXER_VOLUME_MAX;
-
-                // Fade between volume levels to smooth out sound and minimize clicks from sudden volume changes
-                int32_t fadeLength = static_cast<int32_t>(len) / _format.BytesPerSample();
-                switch (_format.format)
-                {
-                    case AUDIO_S16SYS:
-                        EffectFadeS16(static_cast<int16_t*>(buffer), fadeLength, startVolume, endVolume);
-                        break;
-                    case AUDIO_U8:
-                        EffectFadeU8(static_cast<uint8_t*>(buffer), fadeLength, startVolume, endVolume);
-                        break;
-                }
+                buffer.resize(size);
             }
-            return mixVolume;
         }
 
-        static void EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length)
-        {
-            const float dt = 1.0f / static_cast<float>(length * 2.0f);
-            float volumeL = channel->GetOldVolumeL();
-            float volumeR = channel->GetOldVolumeR();
-            const float d_left = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
-            const float d_right = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
+        // The kernels below are plain loops over contiguous samples which compilers vectorise.
 
-            for (int32_t i = 0; i < length * 2; i += 2)
+        static void MixS16(const int16_t* src, float* dst, size_t numSamples, float startVolume, float endVolume)
+        {
+            const float step = (endVolume - startVolume) / static_cast<float>(std::max<size_t>(numSamples, 1));
+            for (size_t i = 0; i < numSamples; i++)
             {
-                data[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i + 0]));
-                data[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i + 1]));
-                volumeL += d_left;
-                volumeR += d_right;
+                dst[i] += static_cast<float>(src[i]) * (startVolume + static_cast<float>(i) * step);
             }
         }
 
-        static void EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length)
+        static void MixStereoS16(
+            const int16_t* src, float* dst, size_t numFrames, float startVolume, float endVolume, float startL, float endL,
+            float startR, float endR)
         {
-            float volumeL = channel->GetVolumeL();
-            float volumeR = channel->GetVolumeR();
-            float oldVolumeL = channel->GetOldVolumeL();
-            float oldVolumeR = channel->GetOldVolumeR();
-
-            for (int32_t i = 0; i < length * 2; i += 2)
+            const float dt = 1.0f / static_cast<float>(std::max<size_t>(numFrames, 1));
+            const float stepVolume = dt * (endVolume - startVolume);
+            const float stepL = dt * (endL - startL);
+            const float stepR = dt * (endR - startR);
+            for (size_t i = 0; i < numFrames; i++)
             {
-                float t = static_cast<float>(i) / static_cast<float>(length * 2.0f);
-                data[i] = static_cast<uint8_t>(data[i] * ((1.0 - t) * oldVolumeL + t * volumeL));
-                data[i + 1] = static_cast<uint8_t>(data[i + 1] * ((1.0 - t) * oldVolumeR + t * volumeR));
+                const float t = static_cast<float>(i);
+                const float volume = startVolume + t * stepVolume;
+                dst[i * 2 + 0] += static_cast<float>(src[i * 2 + 0]) * volume * (startL + t * stepL);
+                dst[i * 2 + 1] += static_cast<float>(src[i * 2 + 1]) * volume * (startR + t * stepR);
             }
         }
 
-        static void EffectFadeS16(int16_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
+        /**
+         * Linearly interpolates up to dstFrames frames from src, starting at the given frame position and advancing by
+         * rate frames for every output frame. Returns the number of frames written, which is less than dstFrames when
+         * src runs out. The cost per frame does not depend on the rate.
+         */
+        static size_t ResampleS16(
+            const int16_t* src, size_t srcFrames, int16_t* dst, size_t dstFrames, size_t numChannels, double position,
+            double rate)
         {
-            static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
-
-            float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-            float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-            for (int32_t i = 0; i < length; i++)
+            size_t numFrames = 0;
+            for (; numFrames < dstFrames; numFrames++)
             {
-                float t = static_cast<float>(i) / length;
-                data[i] = static_cast<int16_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+                // Positions are computed from the start rather than accumulated, so rounding errors do not add up.
+                const double framePosition = position + static_cast<double>(numFrames) * rate;
+                const auto index = static_cast<size_t>(framePosition);
+                if (index + 1 >= srcFrames)
+                {
+                    break;
+                }
+                const auto t = static_cast<float>(framePosition - static_cast<double>(index));
+                const int16_t* a = src + index * numChannels;
+                const int16_t* b = a + numChannels;
+                int16_t* out = dst + numFrames * numChannels;
+                for (size_t c = 0; c < numChannels; c++)
+                {
+                    const auto sampleA = static_cast<float>(a[c]);
+                    out[c] = static_cast<int16_t>(sampleA + (static_cast<float>(b[c]) - sampleA) * t);
+                }
             }
+            return numFrames;
         }
 
-        static void EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume, int32_t endvolume)
+        static void WriteS16(const float* src, int16_t* dst, size_t numSamples)
         {
-            static_assert(SDL_MIX_MAXVOLUME == MIXER_VOLUME_MAX, "Max volume differs between OpenRCT2 and SDL2");
-
-            float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-            float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
-            for (int32_t i = 0; i < length; i++)
+            for (size_t i = 0; i < numSamples; i++)
             {
-                float t = static_cast<float>(i) / length;
-                data[i] = static_cast<uint8_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+                dst[i] = static_cast<int16_t>(std::clamp(src[i], -32768.0f, 32767.0f));
             }
         }
 
@@ -495,7 +507,7 @@ namespace OpenRCT2::Audio
             if (len != 0 && cvt->len_mult != 0)
             {
                 size_t reqConvertBufferCapacity = len * cvt->len_mult;
-                _convertBuffer.resize(reqConvertBufferCapacity);
+                EnsureSize(_convertBuffer, reqConvertBufferCapacity);
                 std::copy_n(static_cast<const uint8_t*>(src), len, _convertBuffer.data());
 
                 cvt->len = static_cast<int32_t>(len);
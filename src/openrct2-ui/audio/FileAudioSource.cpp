@@ -12,22 +12,202 @@
 
 #include <SDL.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <openrct2/audio/AudioSource.h>
 #include <openrct2/common.h>
+#include <openrct2/profiling/Profiling.h>
+#include <thread>
+#include <vector>
 
 namespace OpenRCT2::Audio
 {
+    namespace
+    {
+        /**
+         * PCM data read ahead from a file by the streaming thread, for the audio callback to consume. The ring buffer
+         * has a single producer and a single consumer and is lock-free, so the callback never waits on file I/O.
+         */
+        struct StreamBuffer
+        {
+            static constexpr uint64_t NoSeek = std::numeric_limits<uint64_t>::max();
+            static constexpr size_t MaxReadSize = 64 * 1024;
+
+            SDL_RWops* const RW;
+            const uint64_t DataBegin;
+            const uint64_t DataLength;
+            std::vector<uint8_t> Ring;
+
+            // Total bytes written to and consumed from the ring. Written is advanced by the producer, Consumed by the
+            // consumer.
+            std::atomic<uint64_t> Written{};
+            std::atomic<uint64_t> Consumed{};
+            // Set by the consumer to have the producer discard the ring and continue from the given data offset.
+            std::atomic<uint64_t> SeekRequest{ NoSeek };
+            // Set by the consumer when it no longer needs the stream.
+            std::atomic_bool Closed{};
+
+            // Data offset of the next byte the producer reads, only used by the producer.
+            uint64_t FileOffset{};
+
+            StreamBuffer(SDL_RWops* rw, uint64_t dataBegin, uint64_t dataLength, size_t ringSize)
+                : RW(rw)
+                , DataBegin(dataBegin)
+                , DataLength(dataLength)
+                , Ring(ringSize)
+            {
+            }
+
+            StreamBuffer(const StreamBuffer&) = delete;
+            StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+            ~StreamBuffer()
+            {
+                SDL_RWclose(RW);
+            }
+
+            /**
+             * Fills the free space of the ring from the file, called by the producer.
+             */
+            void Fill()
+            {
+                auto seek = SeekRequest.load(std::memory_order_acquire);
+                if (seek != NoSeek)
+                {
+                    // The consumer does not consume while a seek is pending, so the ring can be emptied here.
+                    FileOffset = seek;
+                    Written.store(Consumed.load(std::memory_order_acquire), std::memory_order_release);
+                    if (!SeekRequest.compare_exchange_strong(seek, NoSeek, std::memory_order_acq_rel))
+                    {
+                        // Another seek came in meanwhile, handle it on the next fill.
+                        return;
+                    }
+                }
+
+                auto written = Written.load(std::memory_order_relaxed);
+                auto freeSpace = Ring.size() - static_cast<size_t>(written - Consumed.load(std::memory_order_acquire));
+                while (freeSpace > 0 && SeekRequest.load(std::memory_order_relaxed) == NoSeek)
+                {
+                    // Continue from the start at the end of the data, in case the channel loops.
+                    if (FileOffset >= DataLength)
+                    {
+                        FileOffset = 0;
+                    }
+
+                    const auto ringOffset = static_cast<size_t>(written % Ring.size());
+                    const auto len = std::min(
+                        { freeSpace, Ring.size() - ringOffset, static_cast<size_t>(DataLength - FileOffset), MaxReadSize });
+                    const auto fileOffset = static_cast<int64_t>(DataBegin + FileOffset);
+                    if (SDL_RWtell(RW) != fileOffset && SDL_RWseek(RW, fileOffset, RW_SEEK_SET) == -1)
+                    {
+                        break;
+                    }
+                    const auto bytesRead = SDL_RWread(RW, Ring.data() + ringOffset, 1, len);
+                    if (bytesRead == 0)
+                    {
+                        break;
+                    }
+                    FileOffset += bytesRead;
+                    written += bytesRead;
+                    freeSpace -= bytesRead;
+                    Written.store(written, std::memory_order_release);
+                }
+            }
+        };
+
+        /**
+         * The thread that keeps the ring buffers of all streamed sources filled.
+         */
+        class AudioStreamer
+        {
+        private:
+            static constexpr auto FillInterval = std::chrono::milliseconds(10);
+
+            std::vector<std::shared_ptr<StreamBuffer>> _streams;
+            std::mutex _mutex;
+            std::condition_variable _condStop;
+            bool _shouldStop = false;
+            std::thread _thread;
+
+        public:
+            static AudioStreamer& Get()
+            {
+                static AudioStreamer instance;
+                return instance;
+            }
+
+            AudioStreamer()
+                : _thread(&AudioStreamer::Run, this)
+            {
+            }
+
+            ~AudioStreamer()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _shouldStop = true;
+                }
+                _condStop.notify_all();
+                _thread.join();
+            }
+
+            void Add(std::shared_ptr<StreamBuffer> stream)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _streams.push_back(std::move(stream));
+            }
+
+        private:
+            void Run()
+            {
+                Profiling::SetThreadName("Audio Streaming");
+
+                std::vector<std::shared_ptr<StreamBuffer>> streams;
+                std::unique_lock<std::mutex> lock(_mutex);
+                while (!_shouldStop)
+                {
+                    // Streams are released here once closed, so their files are closed on this thread as well.
+                    _streams.erase(
+                        std::remove_if(
+                            _streams.begin(), _streams.end(), [](const auto& stream) { return stream->Closed.load(); }),
+                        _streams.end());
+                    streams = _streams;
+
+                    // Read without holding the lock, so adding a stream never waits on file I/O.
+                    lock.unlock();
+                    for (auto& stream : streams)
+                    {
+                        stream->Fill();
+                    }
+                    streams.clear();
+                    lock.lock();
+
+                    _condStop.wait_for(lock, FillInterval, [this]() { return _shouldStop; });
+                }
+            }
+        };
+    } // namespace
+
     /**
-     * An audio source where raw PCM data is streamed directly from
-     * a file.
+     * An audio source where raw PCM data is streamed from a file. The file is read ahead by the streaming thread, reading
+     * from the source only copies data that has already been loaded.
      */
     class FileAudioSource final : public ISDLAudioSource
     {
     private:
+        // Seconds of audio that are read ahead.
+        static constexpr int32_t ReadAheadSeconds = 2;
+
         AudioFormat _format = {};
-        SDL_RWops* _rw = nullptr;
-        uint64_t _dataBegin = 0;
+        std::shared_ptr<StreamBuffer> _stream;
         uint64_t _dataLength = 0;
+        // Data offset of the first byte in the ring, only used by the consumer.
+        uint64_t _readOffset = 0;
 
     public:
         ~FileAudioSource() override
@@ -47,40 +227,86 @@ namespace OpenRCT2::Audio
 
         size_t Read(void* dst, uint64_t offset, size_t len) override
         {
+            if (_stream == nullptr || offset >= _dataLength)
+            {
+                return 0;
+            }
+
+            auto& stream = *_stream;
+            const auto bytesToRead = static_cast<size_t>(std::min<uint64_t>(len, _dataLength - offset));
+
+            // The streaming thread continues from the start at the end of the data.
+            if (_readOffset == _dataLength && offset == 0)
+            {
+                _readOffset = 0;
+            }
+
             size_t bytesRead = 0;
-            int64_t currentPosition = SDL_RWtell(_rw);
-            if (currentPosition != -1)
+            if (offset == _readOffset && stream.SeekRequest.load(std::memory_order_acquire) == StreamBuffer::NoSeek)
             {
-                size_t bytesToRead = static_cast<size_t>(std::min<uint64_t>(len, _dataLength - offset));
-                int64_t dataOffset = _dataBegin + offset;
-                if (currentPosition != dataOffset)
-                {
-                    int64_t newPosition = SDL_RWseek(_rw, dataOffset, SEEK_SET);
-                    if (newPosition == -1)
-                    {
-                        return 0;
-                    }
-                }
-                bytesRead = SDL_RWread(_rw, dst, 1, bytesToRead);
+                const auto consumed = stream.Consumed.load(std::memory_order_relaxed);
+                const auto available = static_cast<size_t>(stream.Written.load(std::memory_order_acquire) - consumed);
+                bytesRead = std::min(available, bytesToRead);
+
+                const auto ringSize = stream.Ring.size();
+                const auto ringOffset = static_cast<size_t>(consumed % ringSize);
+                const auto firstLen = std::min(bytesRead, ringSize - ringOffset);
+                std::memcpy(dst, stream.Ring.data() + ringOffset, firstLen);
+                std::memcpy(static_cast<uint8_t*>(dst) + firstLen, stream.Ring.data(), bytesRead - firstLen);
+
+                stream.Consumed.store(consumed + bytesRead, std::memory_order_release);
+                _readOffset += bytesRead;
+            }
+
+            if (bytesRead < bytesToRead)
+            {
+                // The data has not been streamed in time or the channel has seeked. Rather than waiting, play silence
+                // and have the stream continue after it.
+                const int32_t silence = _format.format == AUDIO_U8 ? 0x80 : 0;
+                std::memset(static_cast<uint8_t*>(dst) + bytesRead, silence, bytesToRead - bytesRead);
+                _readOffset = offset + bytesToRead;
+                stream.SeekRequest.store(_readOffset, std::memory_order_release);
+                bytesRead = bytesToRead;
             }
             return bytesRead;
         }
 
         bool LoadWAV(SDL_RWops* rw)
         {
-            constexpr uint32_t DATA = 0x61746164;
-            constexpr uint32_t FMT = 0x20746D66;
-            constexpr uint32_t RIFF = 0x46464952;
-            constexpr uint32_t WAVE = 0x45564157;
-            constexpr uint16_t pcmformat = 0x0001;
-
             Unload();
 
             if (rw == nullptr)
             {
                 return false;
             }
-            _rw = rw;
+
+            uint64_t dataBegin = 0;
+            if (!ReadWAVHeader(rw, dataBegin))
+            {
+                SDL_RWclose(rw);
+                return false;
+            }
+
+            constexpr int64_t maxRingSize = 4 * 1024 * 1024;
+            const auto ringSize = std::clamp<int64_t>(
+                static_cast<int64_t>(_format.GetByteRate()) * _format.freq * ReadAheadSeconds, StreamBuffer::MaxReadSize,
+                maxRingSize);
+            _stream = std::make_shared<StreamBuffer>(rw, dataBegin, _dataLength, static_cast<size_t>(ringSize));
+
+            // Read the start right away, so the first audio callbacks do not play silence.
+            _stream->Fill();
+            AudioStreamer::Get().Add(_stream);
+            return true;
+        }
+
+    private:
+        bool ReadWAVHeader(SDL_RWops* rw, uint64_t& dataBegin)
+        {
+            constexpr uint32_t DATA = 0x61746164;
+            constexpr uint32_t FMT = 0x20746D66;
+            constexpr uint32_t RIFF = 0x46464952;
+            constexpr uint32_t WAVE = 0x45564157;
+            constexpr uint16_t pcmformat = 0x0001;
 
             uint32_t chunkId = SDL_ReadLE32(rw);
             if (chunkId != RIFF)
@@ -139,11 +365,10 @@ namespace OpenRCT2::Audio
             }
 
             _dataLength = dataChunkSize;
-            _dataBegin = SDL_RWtell(rw);
+            dataBegin = SDL_RWtell(rw);
             return true;
         }
 
-    private:
         static uint32_t FindChunk(SDL_RWops* rw, uint32_t wantedId)
         {
             uint32_t subchunkId = SDL_ReadLE32(rw);
@@ -171,13 +396,14 @@ namespace OpenRCT2::Audio
 
         void Unload()
         {
-            if (_rw != nullptr)
+            if (_stream != nullptr)
             {
-                SDL_RWclose(_rw);
-                _rw = nullptr;
+                // The streaming thread releases the stream and closes the file.
+                _stream->Closed = true;
+                _stream = nullptr;
             }
-            _dataBegin = 0;
             _dataLength = 0;
+            _readOffset = 0;
         }
     };
 
@@ -26,13 +26,15 @@ constexpr VDStruct VertexData[2] = {
     { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f },
 };
 
+constexpr size_t LINE_INSTANCES_SEGMENT_SIZE = 256 * 1024;
+
 DrawLineShader::DrawLineShader()
     : OpenGLShaderProgram("drawline")
+    , _instances(GL_ARRAY_BUFFER, LINE_INSTANCES_SEGMENT_SIZE)
 {
     GetLocations();
 
     glGenBuffers(1, &_vbo);
-    glGenBuffers(1, &_vboInstances);
     glGenVertexArrays(1, &_vao);
 
     glBindBuffer(GL_ARRAY_BUFFER, _vbo);
@@ -48,14 +50,8 @@ DrawLineShader::DrawLineShader()
     glVertexAttribPointer(
         vVertMat + 3, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, mat[3])));
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
-    glVertexAttribIPointer(vClip, 4, GL_INT, sizeof(DrawLineCommand), reinterpret_cast<void*>(offsetof(DrawLineCommand, clip)));
-    glVertexAttribIPointer(
-        vBounds, 4, GL_INT, sizeof(DrawLineCommand), reinterpret_cast<void*>(offsetof(DrawLineCommand, bounds)));
-    glVertexAttribIPointer(
-        vColour, 1, GL_UNSIGNED_INT, sizeof(DrawLineCommand), reinterpret_cast<void*>(offsetof(DrawLineCommand, colour)));
-    glVertexAttribIPointer(
-        vDepth, 1, GL_INT, sizeof(DrawLineCommand), reinterpret_cast<void*>(offsetof(DrawLineCommand, depth)));
+    glBindBuffer(GL_ARRAY_BUFFER, _instances.GetBuffer());
+    SetInstanceAttributes(0);
 
     glEnableVertexAttribArray(vVertMat + 0);
     glEnableVertexAttribArray(vVertMat + 1);
@@ -93,6 +89,16 @@ void DrawLineShader::GetLocations()
     vVertMat = GetAttributeLocation("vVertMat");
 }
 
+void DrawLineShader::SetInstanceAttributes(GLintptr offset)
+{
+    const auto attribute = [offset](size_t member) { return reinterpret_cast<void*>(offset + member); };
+
+    glVertexAttribIPointer(vClip, 4, GL_INT, sizeof(DrawLineCommand), attribute(offsetof(DrawLineCommand, clip)));
+    glVertexAttribIPointer(vBounds, 4, GL_INT, sizeof(DrawLineCommand), attribute(offsetof(DrawLineCommand, bounds)));
+    glVertexAttribIPointer(vColour, 1, GL_UNSIGNED_INT, sizeof(DrawLineCommand), attribute(offsetof(DrawLineCommand, colour)));
+    glVertexAttribIPointer(vDepth, 1, GL_INT, sizeof(DrawLineCommand), attribute(offsetof(DrawLineCommand, depth)));
+}
+
 void DrawLineShader::SetScreenSize(int32_t width, int32_t height)
 {
     glUniform2i(uScreenSize, width, height);
@@ -102,8 +108,8 @@ void DrawLineShader::DrawInstances(const LineCommandBatch& instances)
 {
     glBindVertexArray(_vao);
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(DrawLineCommand) * instances.size(), instances.data(), GL_STREAM_DRAW);
+    auto offset = _instances.Upload(instances.data(), sizeof(DrawLineCommand) * instances.size());
+    SetInstanceAttributes(offset);
 
     glDrawArraysInstanced(GL_LINES, 0, 2, static_cast<GLsizei>(instances.size()));
 }
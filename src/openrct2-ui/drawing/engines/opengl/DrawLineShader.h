@@ -12,6 +12,7 @@
 #include "DrawCommands.h"
 #include "GLSLTypes.h"
 #include "OpenGLShaderProgram.h"
+#include "OpenGLStreamBuffer.h"
 
 class DrawLineShader final : public OpenGLShaderProgram
 {
@@ -26,7 +27,7 @@ private:
     GLuint vVertMat;
 
     GLuint _vbo;
-    GLuint _vboInstances;
+    OpenGLStreamBuffer _instances;
     GLuint _vao;
 
 public:
@@ -38,4 +39,5 @@ public:
 
 private:
     void GetLocations();
+    void SetInstanceAttributes(GLintptr offset);
 };
@@ -27,13 +27,16 @@ constexpr VDStruct VertexData[4] = {
     { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f },
 };
 
+// Enough for the rectangles of a busy frame, larger batches grow the buffer.
+constexpr size_t RECT_INSTANCES_SEGMENT_SIZE = 2 * 1024 * 1024;
+
 DrawRectShader::DrawRectShader()
     : OpenGLShaderProgram("drawrect")
+    , _instances(GL_ARRAY_BUFFER, RECT_INSTANCES_SEGMENT_SIZE)
 {
     GetLocations();
 
     glGenBuffers(1, &_vbo);
-    glGenBuffers(1, &_vboInstances);
     glGenVertexArrays(1, &_vao);
 
     glBindBuffer(GL_ARRAY_BUFFER, _vbo);
@@ -51,29 +54,8 @@ DrawRectShader::DrawRectShader()
         vVertMat + 3, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, mat[3])));
     glVertexAttribPointer(vVertVec, 2, GL_FLOAT, GL_FALSE, sizeof(VDStruct), reinterpret_cast<void*>(offsetof(VDStruct, vec)));
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
-    glVertexAttribIPointer(vClip, 4, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, clip)));
-    glVertexAttribIPointer(
-        vTexColourAtlas, 1, GL_INT, sizeof(DrawRectCommand),
-        reinterpret_cast<void*>(offsetof(DrawRectCommand, texColourAtlas)));
-    glVertexAttribPointer(
-        vTexColourBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand),
-        reinterpret_cast<void*>(offsetof(DrawRectCommand, texColourBounds)));
-    glVertexAttribIPointer(
-        vTexMaskAtlas, 1, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, texMaskAtlas)));
-    glVertexAttribPointer(
-        vTexMaskBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand),
-        reinterpret_cast<void*>(offsetof(DrawRectCommand, texMaskBounds)));
-    glVertexAttribIPointer(
-        vPalettes, 3, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, palettes)));
-    glVertexAttribIPointer(
-        vFlags, 1, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, flags)));
-    glVertexAttribIPointer(
-        vColour, 1, GL_UNSIGNED_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, colour)));
-    glVertexAttribIPointer(
-        vBounds, 4, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, bounds)));
-    glVertexAttribIPointer(
-        vDepth, 1, GL_INT, sizeof(DrawRectCommand), reinterpret_cast<void*>(offsetof(DrawRectCommand, depth)));
+    glBindBuffer(GL_ARRAY_BUFFER, _instances.GetBuffer());
+    SetInstanceAttributes(0);
 
     glEnableVertexAttribArray(vVertMat + 0);
     glEnableVertexAttribArray(vVertMat + 1);
@@ -114,7 +96,6 @@ DrawRectShader::DrawRectShader()
 DrawRectShader::~DrawRectShader()
 {
     glDeleteBuffers(1, &_vbo);
-    glDeleteBuffers(1, &_vboInstances);
     glDeleteVertexArrays(1, &_vao);
 }
 
@@ -142,6 +123,28 @@ void DrawRectShader::GetLocations()
     vVertVec = GetAttributeLocation("vVertVec");
 }
 
+// Instances are streamed to a different part of the buffer for every batch, so the attributes have to follow them.
+void DrawRectShader::SetInstanceAttributes(GLintptr offset)
+{
+    const auto attribute = [offset](size_t member) { return reinterpret_cast<void*>(offset + member); };
+
+    glVertexAttribIPointer(vClip, 4, GL_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, clip)));
+    glVertexAttribIPointer(
+        vTexColourAtlas, 1, GL_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, texColourAtlas)));
+    glVertexAttribPointer(
+        vTexColourBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand),
+        attribute(offsetof(DrawRectCommand, texColourBounds)));
+    glVertexAttribIPointer(
+        vTexMaskAtlas, 1, GL_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, texMaskAtlas)));
+    glVertexAttribPointer(
+        vTexMaskBounds, 4, GL_FLOAT, GL_FALSE, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, texMaskBounds)));
+    glVertexAttribIPointer(vPalettes, 3, GL_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, palettes)));
+    glVertexAttribIPointer(vFlags, 1, GL_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, flags)));
+    glVertexAttribIPointer(vColour, 1, GL_UNSIGNED_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, colour)));
+    glVertexAttribIPointer(vBounds, 4, GL_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, bounds)));
+    glVertexAttribIPointer(vDepth, 1, GL_INT, sizeof(DrawRectCommand), attribute(offsetof(DrawRectCommand, depth)));
+}
+
 void DrawRectShader::SetScreenSize(int32_t width, int32_t height)
 {
     glUniform2i(uScreenSize, width, height);
@@ -162,8 +165,8 @@ void DrawRectShader::SetInstances(const RectCommandBatch& instances)
 {
     glBindVertexArray(_vao);
 
-    glBindBuffer(GL_ARRAY_BUFFER, _vboInstances);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(DrawRectCommand) * instances.size(), instances.data(), GL_STREAM_DRAW);
+    auto offset = _instances.Upload(instances.data(), sizeof(DrawRectCommand) * instances.size());
+    SetInstanceAttributes(offset);
 
     _instanceCount = static_cast<GLsizei>(instances.size());
 }
@@ -12,6 +12,7 @@
 #include "DrawCommands.h"
 #include "GLSLTypes.h"
 #include "OpenGLShaderProgram.h"
+#include "OpenGLStreamBuffer.h"
 
 #include <SDL_pixels.h>
 
@@ -40,7 +41,7 @@ private:
     GLuint vDepth;
 
     GLuint _vbo;
-    GLuint _vboInstances;
+    OpenGLStreamBuffer _instances;
     GLuint _vao;
 
     GLsizei _instanceCount = 0;
@@ -58,4 +59,5 @@ public:
 
 private:
     void GetLocations();
+    void SetInstanceAttributes(GLintptr offset);
 };
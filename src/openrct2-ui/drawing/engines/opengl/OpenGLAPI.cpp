@@ -54,6 +54,7 @@ void OpenGLAPI::SetTexture(uint16_t index, GLenum type, GLuint texture)
 {
     if (OpenGLState::ActiveTexture != index)
     {
+        OpenGLState::ActiveTexture = index;
         glActiveTexture(GL_TEXTURE0 + index);
     }
     glBindTexture(type, texture);
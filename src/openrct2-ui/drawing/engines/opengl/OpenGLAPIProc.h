@@ -47,6 +47,7 @@ OPENGL_PROC(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer)
 OPENGL_PROC(PFNGLBUFFERDATAPROC, glBufferData)
 OPENGL_PROC(PFNGLCLEARBUFFERFVPROC, glClearBufferfv)
 OPENGL_PROC(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv)
+OPENGL_PROC(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync)
 OPENGL_PROC(PFNGLCOMPILESHADERPROC, glCompileShader)
 OPENGL_PROC(PFNGLCREATEPROGRAMPROC, glCreateProgram)
 OPENGL_PROC(PFNGLCREATESHADERPROC, glCreateShader)
@@ -54,9 +55,11 @@ OPENGL_PROC(PFNGLDELETEBUFFERSPROC, glDeleteBuffers)
 OPENGL_PROC(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers)
 OPENGL_PROC(PFNGLDELETEPROGRAMPROC, glDeleteProgram)
 OPENGL_PROC(PFNGLDELETESHADERPROC, glDeleteShader)
+OPENGL_PROC(PFNGLDELETESYNCPROC, glDeleteSync)
 OPENGL_PROC(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays)
 OPENGL_PROC(PFNGLDETACHSHADERPROC, glDetachShader)
 OPENGL_PROC(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray)
+OPENGL_PROC(PFNGLFENCESYNCPROC, glFenceSync)
 OPENGL_PROC(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D)
 OPENGL_PROC(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation)
 OPENGL_PROC(PFNGLGENBUFFERSPROC, glGenBuffers)
@@ -68,6 +71,7 @@ OPENGL_PROC(PFNGLGETSHADERIVPROC, glGetShaderiv)
 OPENGL_PROC(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation)
 OPENGL_PROC(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays)
 OPENGL_PROC(PFNGLLINKPROGRAMPROC, glLinkProgram)
+OPENGL_PROC(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange)
 OPENGL_PROC(PFNGLSHADERSOURCEPROC, glShaderSource)
 OPENGL_PROC(PFNGLUNIFORM1IPROC, glUniform1i)
 OPENGL_PROC(PFNGLUNIFORM1IVPROC, glUniform1iv)
@@ -78,6 +82,7 @@ OPENGL_PROC(PFNGLUNIFORM2FPROC, glUniform2f)
 OPENGL_PROC(PFNGLUNIFORM4FPROC, glUniform4f)
 OPENGL_PROC(PFNGLUNIFORM4IPROC, glUniform4i)
 OPENGL_PROC(PFNGLUNIFORM4FVPROC, glUniform4fv)
+OPENGL_PROC(PFNGLUNMAPBUFFERPROC, glUnmapBuffer)
 OPENGL_PROC(PFNGLUSEPROGRAMPROC, glUseProgram)
 OPENGL_PROC(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer)
 OPENGL_PROC(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer)
@@ -109,8 +109,8 @@ public:
     void DrawSpriteSolid(rct_drawpixelinfo* dpi, ImageId image, int32_t x, int32_t y, uint8_t colour) override;
     void DrawGlyph(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, const PaletteMap& palette) override;
     void DrawBitmap(
-        rct_drawpixelinfo* dpi, uint32_t image, const void* pixels, int32_t width, int32_t height, int32_t x,
-        int32_t y) override;
+        rct_drawpixelinfo* dpi, uint32_t image, const void* pixels, int32_t width, int32_t height, int32_t x, int32_t y,
+        uint8_t colour) override;
 
     void FlushCommandBuffers();
 
@@ -125,6 +125,9 @@ class OpenGLWeatherDrawer final : public IWeatherDrawer
     OpenGLDrawingContext* _drawingContext;
 
 public:
+    // Set whenever weather has been drawn, it is drawn over the frame rather than being restored afterwards.
+    bool HasDrawn = false;
+
     explicit OpenGLWeatherDrawer(OpenGLDrawingContext* drawingContext)
         : _drawingContext(drawingContext)
     {
@@ -134,6 +137,8 @@ public:
         rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t width, int32_t height, int32_t xStart, int32_t yStart,
         const uint8_t* weatherpattern) override
     {
+        HasDrawn = true;
+
         const uint8_t* pattern = weatherpattern;
         auto patternXSpace = *pattern++;
         auto patternYSpace = *pattern++;
@@ -194,6 +199,10 @@ private:
     OpenGLFramebuffer* _smoothScaleFramebuffer = nullptr;
     OpenGLWeatherDrawer _weatherDrawer;
 
+    // Anything that changes what the windows draw invalidates its area, the same as for the software engine. While
+    // nothing has been invalidated the framebuffer still holds the previous frame and the windows are not drawn again.
+    bool _frameInvalidated = true;
+
 public:
     SDL_Color Palette[256];
     vec4 GLPalette[256];
@@ -246,6 +255,7 @@ public:
         ConfigureBits(width, height, width);
         ConfigureCanvas();
         _drawingContext->Resize(width, height);
+        _frameInvalidated = true;
     }
 
     void SetPalette(const GamePalette& palette) override
@@ -279,6 +289,7 @@ public:
 
     void Invalidate(int32_t left, int32_t top, int32_t right, int32_t bottom) override
     {
+        _frameInvalidated = true;
     }
 
     void BeginDraw() override
@@ -327,6 +338,12 @@ public:
         _drawingContext->CalculcateClipping(&_bitsDPI);
 
         window_update_all_viewports();
+        if (!_frameInvalidated && !_weatherDrawer.HasDrawn)
+        {
+            return;
+        }
+        _frameInvalidated = false;
+
         window_draw_all(&_bitsDPI, 0, 0, _width, _height);
     }
 
@@ -334,6 +351,7 @@ public:
     {
         _drawingContext->CalculcateClipping(&_bitsDPI);
 
+        _weatherDrawer.HasDrawn = false;
         DrawWeather(&_bitsDPI, &_weatherDrawer);
     }
 
@@ -369,6 +387,7 @@ public:
     void InvalidateImage(uint32_t image) override
     {
         _drawingContext->GetTextureCache()->InvalidateImage(image);
+        _frameInvalidated = true;
     }
 
     rct_drawpixelinfo* GetDPI()
@@ -505,6 +524,7 @@ void OpenGLDrawingContext::ResetPalette()
 void OpenGLDrawingContext::StartNewDraw()
 {
     _drawCount = 0;
+    _textureCache->NextFrame();
     _swapFramebuffer->Clear();
 }
 
@@ -578,6 +598,30 @@ void OpenGLDrawingContext::DrawLine(rct_drawpixelinfo* dpi, uint32_t colour, con
 {
     CalculcateClipping(dpi);
 
+    if (line.GetX1() == line.GetX2() || line.GetY1() == line.GetY2())
+    {
+        // Most lines are horizontal or vertical, draw them as rectangles so they are part of the same draw call as the
+        // sprites. This covers both end points like the software renderer does.
+        const int32_t left = std::min(line.GetX1(), line.GetX2()) + _offsetX;
+        const int32_t top = std::min(line.GetY1(), line.GetY2()) + _offsetY;
+        const int32_t right = std::max(line.GetX1(), line.GetX2()) + _offsetX;
+        const int32_t bottom = std::max(line.GetY1(), line.GetY2()) + _offsetY;
+
+        DrawRectCommand& command = _commandBuffers.rects.allocate();
+
+        command.clip = { _clipLeft, _clipTop, _clipRight, _clipBottom };
+        command.texColourAtlas = 0;
+        command.texColourBounds = { 0.0f, 0.0f, 0.0f, 0.0f };
+        command.texMaskAtlas = 0;
+        command.texMaskBounds = { 0.0f, 0.0f, 0.0f, 0.0f };
+        command.palettes = { 0, 0, 0 };
+        command.colour = colour & 0xFF;
+        command.bounds = { left, top, right + 1, bottom + 1 };
+        command.flags = DrawRectCommand::FLAG_NO_TEXTURE;
+        command.depth = _drawCount++;
+        return;
+    }
+
     DrawLineCommand& command = _commandBuffers.lines.allocate();
 
     command.clip = { _clipLeft, _clipTop, _clipRight, _clipBottom };
@@ -907,7 +951,8 @@ void OpenGLDrawingContext::DrawGlyph(rct_drawpixelinfo* dpi, uint32_t image, int
 }
 
 void OpenGLDrawingContext::DrawBitmap(
-    rct_drawpixelinfo* dpi, uint32_t image, const void* pixels, int32_t width, int32_t height, int32_t x, int32_t y)
+    rct_drawpixelinfo* dpi, uint32_t image, const void* pixels, int32_t width, int32_t height, int32_t x, int32_t y,
+    uint8_t colour)
 {
     CalculcateClipping(dpi);
 
@@ -939,20 +984,23 @@ void OpenGLDrawingContext::DrawBitmap(
 
     DrawRectCommand& command = _commandBuffers.rects.allocate();
 
+    // The bitmap only masks the colour, so the same texture serves every colour it is drawn in.
     command.clip = { _clipLeft, _clipTop, _clipRight, _clipBottom };
-    command.texColourAtlas = texture.index;
-    command.texColourBounds = texture.normalizedBounds;
-    command.texMaskAtlas = 0;
-    command.texMaskBounds = { 0.0f, 0.0f, 0.0f, 0.0f };
+    command.texColourAtlas = 0;
+    command.texColourBounds = { 0.0f, 0.0f, 0.0f, 0.0f };
+    command.texMaskAtlas = texture.index;
+    command.texMaskBounds = texture.normalizedBounds;
     command.palettes = { 0, 0, 0 };
-    command.flags = 0;
-    command.colour = 0;
+    command.flags = DrawRectCommand::FLAG_NO_TEXTURE | DrawRectCommand::FLAG_MASK;
+    command.colour = colour;
     command.bounds = { left, top, right, bottom };
     command.depth = _drawCount++;
 }
 
 void OpenGLDrawingContext::FlushCommandBuffers()
 {
+    _textureCache->FlushUploads();
+
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LESS);
 
@@ -0,0 +1,116 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_OPENGL
+
+#    include "OpenGLStreamBuffer.h"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <stdexcept>
+
+// Ranges start at multiples of this, which satisfies the alignment of all instance and pixel data.
+constexpr size_t STREAM_BUFFER_ALIGNMENT = 16;
+
+OpenGLStreamBuffer::OpenGLStreamBuffer(GLenum target, size_t segmentSize)
+    : _target(target)
+{
+    glGenBuffers(1, &_buffer);
+    Allocate(segmentSize);
+}
+
+OpenGLStreamBuffer::~OpenGLStreamBuffer()
+{
+    DeleteFences();
+    glDeleteBuffers(1, &_buffer);
+}
+
+void* OpenGLStreamBuffer::Map(size_t size, GLintptr& offset)
+{
+    glBindBuffer(_target, _buffer);
+
+    if (size > _segmentSize)
+    {
+        // Only reallocate for data that does not fit into a segment at all, the new storage is not in use by the GPU.
+        Allocate(std::max(size, _segmentSize * 2));
+    }
+    else if (_offset + size > _segmentSize)
+    {
+        // Fence off the draws that read the current segment and continue in the next one.
+        _fences[_segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        BeginSegment((_segment + 1) % SegmentCount);
+    }
+
+    offset = static_cast<GLintptr>(_segment * _segmentSize + _offset);
+    _offset = (_offset + size + STREAM_BUFFER_ALIGNMENT - 1) & ~(STREAM_BUFFER_ALIGNMENT - 1);
+
+    auto* data = glMapBufferRange(
+        _target, offset, static_cast<GLsizeiptr>(size),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (data == nullptr)
+    {
+        throw std::runtime_error("unable to map stream buffer");
+    }
+    return data;
+}
+
+void OpenGLStreamBuffer::Unmap()
+{
+    glUnmapBuffer(_target);
+}
+
+GLintptr OpenGLStreamBuffer::Upload(const void* data, size_t size)
+{
+    GLintptr offset;
+    std::memcpy(Map(size, offset), data, size);
+    Unmap();
+    return offset;
+}
+
+void OpenGLStreamBuffer::Allocate(size_t segmentSize)
+{
+    DeleteFences();
+
+    _segmentSize = (segmentSize + STREAM_BUFFER_ALIGNMENT - 1) & ~(STREAM_BUFFER_ALIGNMENT - 1);
+    _segment = 0;
+    _offset = 0;
+
+    glBindBuffer(_target, _buffer);
+    glBufferData(_target, static_cast<GLsizeiptr>(_segmentSize * SegmentCount), nullptr, GL_STREAM_DRAW);
+}
+
+void OpenGLStreamBuffer::BeginSegment(size_t segment)
+{
+    auto& fence = _fences[segment];
+    if (fence != nullptr)
+    {
+        // Usually signalled already, as the draws reading the other segments have been issued since.
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED)
+        {
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+    _segment = segment;
+    _offset = 0;
+}
+
+void OpenGLStreamBuffer::DeleteFences()
+{
+    for (auto& fence : _fences)
+    {
+        if (fence != nullptr)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+#endif /* DISABLE_OPENGL */
@@ -0,0 +1,65 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "OpenGLAPI.h"
+
+#include <array>
+#include <cstddef>
+#include <openrct2/common.h>
+
+/**
+ * A buffer that data for the GPU is streamed through, such as instance data or pixels to upload. The buffer is used
+ * as a ring of segments that is written through unsynchronised mappings, and a fence guards each segment so a segment
+ * is only written again once the GPU has finished reading it. This avoids both reallocating the buffer storage every
+ * frame and the implicit synchronisation of writing to a buffer that is still in use.
+ */
+class OpenGLStreamBuffer
+{
+private:
+    static constexpr size_t SegmentCount = 3;
+
+    GLenum _target;
+    GLuint _buffer = 0;
+    size_t _segmentSize = 0;
+    size_t _segment = 0;
+    size_t _offset = 0;
+    std::array<GLsync, SegmentCount> _fences{};
+
+public:
+    OpenGLStreamBuffer(GLenum target, size_t segmentSize);
+    ~OpenGLStreamBuffer();
+
+    OpenGLStreamBuffer(const OpenGLStreamBuffer&) = delete;
+    OpenGLStreamBuffer& operator=(const OpenGLStreamBuffer&) = delete;
+
+    GLuint GetBuffer() const
+    {
+        return _buffer;
+    }
+
+    /**
+     * Binds the buffer and maps size bytes of it for writing, offset receives the position of the mapped range in the
+     * buffer. The range must be unmapped before it is used by any draw call, and it stays valid until the GPU has
+     * finished all draws that are issued before the next call to Map.
+     */
+    void* Map(size_t size, GLintptr& offset);
+    void Unmap();
+
+    /**
+     * Copies data into the buffer, returns the offset it has been written to.
+     */
+    GLintptr Upload(const void* data, size_t size);
+
+private:
+    void Allocate(size_t segmentSize);
+    void BeginSegment(size_t segment);
+    void DeleteFences();
+};
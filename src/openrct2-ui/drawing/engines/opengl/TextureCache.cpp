@@ -34,33 +34,66 @@ void TextureCache::InvalidateImage(ImageIndex image)
 {
     unique_lock lock(_mutex);
 
+    // The image may be about to change, pending decodes could still be reading it.
+    _decodeJobs.Join();
+
     uint32_t index = _indexMap[image];
     if (index == UNUSED_INDEX)
         return;
 
-    AtlasTextureInfo& elem = _textureCache.at(index);
+    RemoveEntry(index);
+}
 
-    _atlases[elem.index].Free(elem);
-    _indexMap[image] = UNUSED_INDEX;
+void TextureCache::NextFrame()
+{
+    unique_lock lock(_mutex);
+
+    _currentFrame++;
+}
 
-    if (index == _textureCache.size() - 1)
+void TextureCache::FlushUploads()
+{
+    unique_lock lock(_mutex);
+
+    if (_pendingUploads.empty())
+        return;
+
+    _decodeJobs.Join();
+
+    size_t totalSize = 0;
+    for (const auto& upload : _pendingUploads)
     {
-        // Last element can be popped back.
-        _textureCache.pop_back();
+        totalSize += upload.pixels.size();
     }
-    else
+
+    // Stage all pixels in a pixel buffer object so the texture uploads do not have to wait for the copies.
+    if (_uploadBuffer == nullptr)
     {
-        // Swap last element with element to erase and then pop back.
-        AtlasTextureInfo& last = _textureCache.back();
+        _uploadBuffer = std::make_unique<OpenGLStreamBuffer>(GL_PIXEL_UNPACK_BUFFER, TEXTURE_CACHE_UPLOAD_SEGMENT_SIZE);
+    }
+    GLintptr offset;
+    auto* staging = static_cast<uint8_t*>(_uploadBuffer->Map(totalSize, offset));
+    for (const auto& upload : _pendingUploads)
+    {
+        std::copy(upload.pixels.begin(), upload.pixels.end(), staging);
+        staging += upload.pixels.size();
+    }
+    _uploadBuffer->Unmap();
 
-        // Move last to current.
-        elem = last;
+    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
+    for (const auto& upload : _pendingUploads)
+    {
+        const auto& bounds = upload.bounds;
+        glTexSubImage3D(
+            GL_TEXTURE_2D_ARRAY, 0, bounds.x, bounds.y, upload.index, bounds.z - bounds.x, bounds.w - bounds.y, 1,
+            GL_RED_INTEGER, GL_UNSIGNED_BYTE, reinterpret_cast<const GLvoid*>(offset));
+        offset += static_cast<GLintptr>(upload.pixels.size());
+    }
 
-        // Change index for moved element.
-        _indexMap[last.image] = index;
+    // Other texture uploads pass pointers to client memory.
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
-        _textureCache.pop_back();
-    }
+    _pendingUploads.clear();
 }
 
 // Note: for performance reasons, this returns a BasicTextureInfo over an AtlasTextureInfo (also to not expose the cache)
@@ -75,7 +108,8 @@ BasicTextureInfo TextureCache::GetOrLoadImageTexture(ImageId imageId)
         index = _indexMap[imageId.GetIndex()];
         if (index != UNUSED_INDEX)
         {
-            const auto& info = _textureCache[index];
+            auto& info = _textureCache[index];
+            info.lastUsedFrame = _currentFrame;
             return {
                 info.index,
                 info.normalizedBounds,
@@ -86,12 +120,8 @@ BasicTextureInfo TextureCache::GetOrLoadImageTexture(ImageId imageId)
     // Load new texture.
     unique_lock lock(_mutex);
 
-    index = static_cast<uint32_t>(_textureCache.size());
-
     AtlasTextureInfo info = LoadImageTexture(imageId);
-
-    _textureCache.push_back(info);
-    _indexMap[imageId.GetIndex()] = index;
+    AddEntry(info);
 
     return info;
 }
@@ -115,7 +145,8 @@ BasicTextureInfo TextureCache::GetOrLoadGlyphTexture(ImageId imageId, const Pale
         auto kvp = _glyphTextureMap.find(glyphId);
         if (kvp != _glyphTextureMap.end())
         {
-            const auto& info = kvp->second;
+            auto& info = _textureCache[kvp->second];
+            info.lastUsedFrame = _currentFrame;
             return {
                 info.index,
                 info.normalizedBounds,
@@ -127,9 +158,11 @@ BasicTextureInfo TextureCache::GetOrLoadGlyphTexture(ImageId imageId, const Pale
     unique_lock lock(_mutex);
 
     auto cacheInfo = LoadGlyphTexture(imageId, paletteMap);
-    auto it = _glyphTextureMap.insert(std::make_pair(glyphId, cacheInfo));
+    cacheInfo.isGlyph = true;
+    cacheInfo.palette = glyphId.Palette;
+    AddEntry(cacheInfo);
 
-    return (*it.first).second;
+    return cacheInfo;
 }
 
 BasicTextureInfo TextureCache::GetOrLoadBitmapTexture(ImageIndex image, const void* pixels, size_t width, size_t height)
@@ -143,7 +176,8 @@ BasicTextureInfo TextureCache::GetOrLoadBitmapTexture(ImageIndex image, const vo
         index = _indexMap[image];
         if (index != UNUSED_INDEX)
         {
-            const auto& info = _textureCache[index];
+            auto& info = _textureCache[index];
+            info.lastUsedFrame = _currentFrame;
             return {
                 info.index,
                 info.normalizedBounds,
@@ -154,14 +188,58 @@ BasicTextureInfo TextureCache::GetOrLoadBitmapTexture(ImageIndex image, const vo
     // Load new texture.
     unique_lock lock(_mutex);
 
-    index = uint32_t(_textureCache.size());
-
     AtlasTextureInfo info = LoadBitmapTexture(image, pixels, width, height);
+    AddEntry(info);
 
+    return info;
+}
+
+uint32_t TextureCache::AddEntry(const AtlasTextureInfo& info)
+{
+    auto index = static_cast<uint32_t>(_textureCache.size());
     _textureCache.push_back(info);
-    _indexMap[image] = index;
+    _textureCache.back().lastUsedFrame = _currentFrame;
+    if (info.isGlyph)
+    {
+        _glyphTextureMap[{ info.image, info.palette }] = index;
+    }
+    else
+    {
+        _indexMap[info.image] = index;
+    }
+    return index;
+}
 
-    return info;
+void TextureCache::RemoveEntry(uint32_t index)
+{
+    AtlasTextureInfo& elem = _textureCache.at(index);
+
+    _atlases[elem.index].Free(elem);
+    if (elem.isGlyph)
+    {
+        _glyphTextureMap.erase({ elem.image, elem.palette });
+    }
+    else
+    {
+        _indexMap[elem.image] = UNUSED_INDEX;
+    }
+
+    if (index != _textureCache.size() - 1)
+    {
+        // Swap last element with element to erase and then pop back.
+        elem = _textureCache.back();
+
+        // Change index for moved element.
+        if (elem.isGlyph)
+        {
+            _glyphTextureMap[{ elem.image, elem.palette }] = index;
+        }
+        else
+        {
+            _indexMap[elem.image] = index;
+        }
+    }
+    _textureCache.pop_back();
 }
 
 void TextureCache::CreateTextures()
@@ -180,6 +258,11 @@ void TextureCache::CreateTextures()
         if (_atlasesTextureDimensions < _atlasesTextureIndicesLimit)
             _atlasesTextureIndicesLimit = _atlasesTextureDimensions;
 
+        // Determine how many atlases fit into the memory budget
+        const size_t atlasBytes = static_cast<size_t>(_atlasesTextureDimensions) * _atlasesTextureDimensions;
+        const size_t budgetAtlases = std::max<size_t>((TEXTURE_CACHE_MEMORY_BUDGET_MB * 1024 * 1024) / atlasBytes, 1);
+        _atlasesTextureBudget = static_cast<GLint>(std::min<size_t>(budgetAtlases, _atlasesTextureIndicesLimit));
+
         glGenTextures(1, &_atlasesTexture);
         glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
         glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -247,7 +330,13 @@ void TextureCache::EnlargeAtlasesTexture(GLuint newEntries)
         }
 
         // Initial capacity will be 12 which covers most cases of a fully visible park.
+        // Growing past the budget only happens for a single frame that needs it, so do not grow further than that.
         _atlasesTextureCapacity = (_atlasesTextureCapacity + 6) << 1UL;
+        if (newIndices <= static_cast<GLuint>(_atlasesTextureBudget))
+        {
+            _atlasesTextureCapacity = std::min(_atlasesTextureCapacity, static_cast<GLuint>(_atlasesTextureBudget));
+        }
+        _atlasesTextureCapacity = std::max(_atlasesTextureCapacity, newIndices);
 
         glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
         glTexImage3D(
@@ -268,34 +357,46 @@ void TextureCache::EnlargeAtlasesTexture(GLuint newEntries)
 
 AtlasTextureInfo TextureCache::LoadImageTexture(ImageId imageId)
 {
-    rct_drawpixelinfo dpi = GetImageAsDPI(ImageId(imageId.GetIndex()));
+    auto image = ImageId(imageId.GetIndex());
+    auto g1Element = gfx_get_g1_element(image);
 
-    auto cacheInfo = AllocateImage(dpi.width, dpi.height);
+    auto cacheInfo = AllocateImage(g1Element->width, g1Element->height);
     cacheInfo.image = imageId.GetIndex();
 
-    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
-    glTexSubImage3D(
-        GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, dpi.width, dpi.height, 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, dpi.bits);
+    auto& upload = QueueUpload(cacheInfo);
+    const auto coords = ScreenCoordsXY{ -g1Element->x_offset, -g1Element->y_offset };
 
-    DeleteDPI(dpi);
+    // Temporary and scrolling text images are replaced while drawing, so they can not be decoded in the background.
+    const auto index = image.GetIndex();
+    if (index == SPR_TEMP || (index >= SPR_SCROLLING_TEXT_START && index < SPR_SCROLLING_TEXT_END))
+    {
+        auto dpi = GetUploadAsDPI(upload);
+        gfx_draw_sprite_software(&dpi, image, coords);
+    }
+    else
+    {
+        // Decode while the rest of the frame is being drawn, FlushUploads waits for it.
+        _decodeJobs.AddTask([&upload, image, coords]() {
+            auto dpi = GetUploadAsDPI(upload);
+            gfx_draw_sprite_software(&dpi, image, coords);
+        });
+    }
 
     return cacheInfo;
 }
 
 AtlasTextureInfo TextureCache::LoadGlyphTexture(ImageId imageId, const PaletteMap& paletteMap)
 {
-    rct_drawpixelinfo dpi = GetGlyphAsDPI(imageId, paletteMap);
+    auto g1Element = gfx_get_g1_element(imageId);
 
-    auto cacheInfo = AllocateImage(dpi.width, dpi.height);
+    auto cacheInfo = AllocateImage(g1Element->width, g1Element->height);
     cacheInfo.image = imageId.GetIndex();
 
-    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
-    glTexSubImage3D(
-        GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, dpi.width, dpi.height, 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, dpi.bits);
-
-    DeleteDPI(dpi);
+    // The palette map is only valid during this call, glyphs are small enough to decode right away.
+    auto& upload = QueueUpload(cacheInfo);
+    auto dpi = GetUploadAsDPI(upload);
+    const auto glyphCoords = ScreenCoordsXY{ -g1Element->x_offset, -g1Element->y_offset };
+    gfx_draw_sprite_palette_set_software(&dpi, imageId, glyphCoords, paletteMap);
 
     return cacheInfo;
 }
@@ -304,78 +405,130 @@ AtlasTextureInfo TextureCache::LoadBitmapTexture(ImageIndex image, const void* p
 {
     auto cacheInfo = AllocateImage(int32_t(width), int32_t(height));
     cacheInfo.image = image;
-    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
-    glTexSubImage3D(
-        GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, GLsizei(width), GLsizei(height), 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, reinterpret_cast<const GLvoid*>(pixels));
+
+    auto& upload = QueueUpload(cacheInfo);
+    std::copy_n(static_cast<const uint8_t*>(pixels), upload.pixels.size(), upload.pixels.begin());
+
     return cacheInfo;
 }
 
+TextureCache::PendingUpload& TextureCache::QueueUpload(const AtlasTextureInfo& info)
+{
+    const auto& bounds = info.bounds;
+    const auto numPixels = static_cast<size_t>(bounds.z - bounds.x) * (bounds.w - bounds.y);
+    _pendingUploads.push_back({ info.index, bounds, std::vector<uint8_t>(numPixels, 0) });
+    return _pendingUploads.back();
+}
+
 AtlasTextureInfo TextureCache::AllocateImage(int32_t imageWidth, int32_t imageHeight)
 {
     CreateTextures();
 
+    AtlasTextureInfo info;
+    if (TryAllocateImage(imageWidth, imageHeight, info, _atlasesTextureBudget))
+    {
+        return info;
+    }
+
+    // Out of budget, make room by evicting a share of the images that have not been drawn for the longest. Freed space
+    // may be too fragmented for this image, in which case everything that is not being drawn right now goes.
+    if (EvictImages(false) && TryAllocateImage(imageWidth, imageHeight, info, _atlasesTextureBudget))
+    {
+        return info;
+    }
+    if (EvictImages(true) && TryAllocateImage(imageWidth, imageHeight, info, _atlasesTextureBudget))
+    {
+        return info;
+    }
+
+    // All remaining images are needed for the current frame, so go over the budget rather than fail.
+    if (TryAllocateImage(imageWidth, imageHeight, info, _atlasesTextureIndicesLimit))
+    {
+        return info;
+    }
+
+    throw std::runtime_error("more texture atlases required, but device limit reached!");
+}
+
+bool TextureCache::TryAllocateImage(int32_t imageWidth, int32_t imageHeight, AtlasTextureInfo& info, GLint maxAtlases)
+{
     // Find an atlas that fits this image
     for (Atlas& atlas : _atlases)
     {
-        if (atlas.GetFreeSlots() > 0 && atlas.IsImageSuitable(imageWidth, imageHeight))
+        if (atlas.Allocate(imageWidth, imageHeight, info))
         {
-            return atlas.Allocate(imageWidth, imageHeight);
+            return true;
         }
     }
 
     // If there is no such atlas, then create a new one
-    if (static_cast<int32_t>(_atlases.size()) >= _atlasesTextureIndicesLimit)
+    if (static_cast<GLint>(_atlases.size()) >= maxAtlases)
     {
-        throw std::runtime_error("more texture atlases required, but device limit reached!");
+        return false;
     }
 
-    auto atlasIndex = static_cast<int32_t>(_atlases.size());
-    int32_t atlasSize = powf(2, static_cast<float>(Atlas::CalculateImageSizeOrder(imageWidth, imageHeight)));
+    auto atlasIndex = static_cast<GLuint>(_atlases.size());
 
 #    ifdef DEBUG
-    log_verbose("new texture atlas #%d (size %d) allocated", atlasIndex, atlasSize);
+    log_verbose("new texture atlas #%d allocated", atlasIndex);
 #    endif
 
-    _atlases.emplace_back(atlasIndex, atlasSize);
+    _atlases.emplace_back(atlasIndex);
     _atlases.back().Initialise(_atlasesTextureDimensions, _atlasesTextureDimensions);
 
     // Enlarge texture array to support new atlas
     EnlargeAtlasesTexture(1);
 
     // And allocate from the new atlas
-    return _atlases.back().Allocate(imageWidth, imageHeight);
+    return _atlases.back().Allocate(imageWidth, imageHeight, info);
 }
 
-rct_drawpixelinfo TextureCache::GetImageAsDPI(ImageId imageId)
+bool TextureCache::EvictImages(bool all)
 {
-    auto g1Element = gfx_get_g1_element(imageId);
-    int32_t width = g1Element->width;
-    int32_t height = g1Element->height;
-
-    rct_drawpixelinfo dpi = CreateDPI(width, height);
-    gfx_draw_sprite_software(&dpi, imageId, { -g1Element->x_offset, -g1Element->y_offset });
-    return dpi;
-}
-
-rct_drawpixelinfo TextureCache::GetGlyphAsDPI(ImageId imageId, const PaletteMap& palette)
-{
-    auto g1Element = gfx_get_g1_element(imageId);
-    int32_t width = g1Element->width;
-    int32_t height = g1Element->height;
+    std::vector<uint32_t> candidates;
+    for (uint32_t i = 0; i < _textureCache.size(); i++)
+    {
+        if (_textureCache[i].lastUsedFrame != _currentFrame)
+        {
+            candidates.push_back(i);
+        }
+    }
+    if (candidates.empty())
+    {
+        return false;
+    }
 
-    rct_drawpixelinfo dpi = CreateDPI(width, height);
+    // Evict a quarter at a time so that a busy scene does not have to evict again for every new image.
+    auto count = all ? candidates.size() : std::max<size_t>(candidates.size() / 4, 1);
+    std::partial_sort(
+        candidates.begin(), candidates.begin() + count, candidates.end(), [this](uint32_t a, uint32_t b) {
+            return _textureCache[a].lastUsedFrame < _textureCache[b].lastUsedFrame;
+        });
+    candidates.resize(count);
+
+    // Removing moves the last entry into the freed index, so remove from the back to keep the other indices valid.
+    std::sort(candidates.begin(), candidates.end(), std::greater<uint32_t>());
+    for (auto index : candidates)
+    {
+        RemoveEntry(index);
+    }
 
-    const auto glyphCoords = ScreenCoordsXY{ -g1Element->x_offset, -g1Element->y_offset };
-    gfx_draw_sprite_palette_set_software(&dpi, imageId, glyphCoords, palette);
-    return dpi;
+#    ifdef DEBUG
+    log_verbose("evicted %zu images from the texture atlases", count);
+#    endif
+    return true;
 }
 
 void TextureCache::FreeTextures()
 {
+    _decodeJobs.Join();
+    _pendingUploads.clear();
+    _uploadBuffer = nullptr;
+
     // Free array texture
     glDeleteTextures(1, &_atlasesTexture);
     _textureCache.clear();
+    _glyphTextureMap.clear();
     std::fill(_indexMap.begin(), _indexMap.end(), UNUSED_INDEX);
 }
 
@@ -401,6 +554,19 @@ void TextureCache::DeleteDPI(rct_drawpixelinfo dpi)
     delete[] dpi.bits;
 }
 
+rct_drawpixelinfo TextureCache::GetUploadAsDPI(PendingUpload& upload)
+{
+    rct_drawpixelinfo dpi;
+    dpi.bits = upload.pixels.data();
+    dpi.pitch = 0;
+    dpi.x = 0;
+    dpi.y = 0;
+    dpi.width = upload.bounds.z - upload.bounds.x;
+    dpi.height = upload.bounds.w - upload.bounds.y;
+    dpi.zoom_level = ZoomLevel{ 0 };
+    return dpi;
+}
+
 GLuint TextureCache::GetAtlasesTexture()
 {
     return _atlasesTexture;
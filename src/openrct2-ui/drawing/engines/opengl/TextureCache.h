@@ -11,12 +11,16 @@
 
 #include "GLSLTypes.h"
 #include "OpenGLAPI.h"
+#include "OpenGLStreamBuffer.h"
 
 #include <SDL_pixels.h>
 #include <algorithm>
 #include <array>
+#include <deque>
+#include <memory>
 #include <mutex>
 #include <openrct2/common.h>
+#include <openrct2/core/JobPool.h>
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/sprites.h>
 #ifndef __MACOSX__
@@ -58,9 +62,14 @@ struct GlyphId
 // granularity at which new atlases are allocated (2048 -> 4 MB of VRAM)
 constexpr int32_t TEXTURE_CACHE_MAX_ATLAS_SIZE = 2048;
 
-// Pixel dimensions of smallest supported slots in texture atlases
-// Must be a power of 2!
-constexpr int32_t TEXTURE_CACHE_SMALLEST_SLOT = 32;
+// Video memory the atlases may use before images that have not been drawn recently are evicted
+constexpr size_t TEXTURE_CACHE_MEMORY_BUDGET_MB = 256;
+
+// Pixels of newly loaded images are staged in segments of this size, more in a single frame grows the buffer
+constexpr size_t TEXTURE_CACHE_UPLOAD_SEGMENT_SIZE = 4 * 1024 * 1024;
+
+// Shelves are created with heights rounded up to this, so images of similar heights share them
+constexpr int32_t TEXTURE_CACHE_SHELF_GRANULARITY = 4;
 
 struct BasicTextureInfo
 {
@@ -68,33 +77,47 @@ struct BasicTextureInfo
     vec4 normalizedBounds;
 };
 
-// Location of an image (texture atlas index, slot and normalized coordinates)
+// Location of an image (texture atlas index, shelf and normalized coordinates)
 struct AtlasTextureInfo : public BasicTextureInfo
 {
     GLuint slot;
     ivec4 bounds;
     ImageIndex image;
+    // Set for glyphs, which are cached per palette as well.
+    bool isGlyph;
+    uint64_t palette;
+    uint32_t lastUsedFrame;
 };
 
-// Represents a texture atlas that images of a given maximum size can be allocated from
+// Represents a texture atlas that images of any size up to the atlas size can be allocated from
 // Atlases are all stored in the same 2D texture array, occupying the specified index
-// Slots in atlases are always squares.
+// Images are packed into shelves, rows of images of similar height that are stacked from the top of the atlas.
 class Atlas final
 {
 private:
+    struct Span
+    {
+        int32_t x;
+        int32_t width;
+    };
+
+    struct Shelf
+    {
+        int32_t y;
+        int32_t height;
+        // Free parts of the shelf, sorted by x and never adjacent to each other.
+        std::vector<Span> freeSpans;
+    };
+
     GLuint _index = 0;
-    int32_t _imageSize = 0;
     int32_t _atlasWidth = 0;
     int32_t _atlasHeight = 0;
-    std::vector<GLuint> _freeSlots;
-
-    int32_t _cols = 0;
-    int32_t _rows = 0;
+    int32_t _shelvesHeight = 0;
+    std::vector<Shelf> _shelves;
 
 public:
-    Atlas(GLuint index, int32_t imageSize)
+    explicit Atlas(GLuint index)
         : _index(index)
-        , _imageSize(imageSize)
     {
     }
 
@@ -102,81 +125,131 @@ public:
     {
         _atlasWidth = atlasWidth;
         _atlasHeight = atlasHeight;
+        _shelvesHeight = 0;
+        _shelves.clear();
+    }
 
-        _cols = std::max(1, _atlasWidth / _imageSize);
-        _rows = std::max(1, _atlasHeight / _imageSize);
-
-        _freeSlots.resize(_cols * _rows);
-        for (size_t i = 0; i < _freeSlots.size(); i++)
+    // Returns false if there is no room left for the image
+    bool Allocate(int32_t actualWidth, int32_t actualHeight, AtlasTextureInfo& info)
+    {
+        // Leave a pixel between images so sampling at the very edge can not pick up a neighbour.
+        const int32_t width = actualWidth + 1;
+        const int32_t height = actualHeight + 1;
+        if (width > _atlasWidth || height > _atlasHeight)
         {
-            _freeSlots[i] = static_cast<GLuint>(i);
+            return false;
         }
-    }
 
-    AtlasTextureInfo Allocate(int32_t actualWidth, int32_t actualHeight)
-    {
-        assert(!_freeSlots.empty());
+        // Prefer the lowest shelf the image fits in, but do not waste more than half of the shelf on it.
+        constexpr int32_t granularity = TEXTURE_CACHE_SHELF_GRANULARITY;
+        const int32_t shelfHeight = std::min(((height + granularity - 1) / granularity) * granularity, _atlasHeight);
+        auto shelfIndex = FindShelf(width, height, height + height / 2);
+        if (shelfIndex == -1 && _shelvesHeight + shelfHeight <= _atlasHeight)
+        {
+            shelfIndex = static_cast<int32_t>(_shelves.size());
+            _shelves.push_back({ _shelvesHeight, shelfHeight, { { 0, _atlasWidth } } });
+            _shelvesHeight += shelfHeight;
+        }
+        if (shelfIndex == -1)
+        {
+            // Once the atlas is out of vertical space, any shelf that is tall enough will do.
+            shelfIndex = FindShelf(width, height, _atlasHeight);
+        }
+        if (shelfIndex == -1)
+        {
+            return false;
+        }
 
-        GLuint slot = _freeSlots.back();
-        _freeSlots.pop_back();
+        auto& shelf = _shelves[shelfIndex];
+        auto span = std::find_if(
+            shelf.freeSpans.begin(), shelf.freeSpans.end(), [width](const Span& s) { return s.width >= width; });
+        const int32_t x = span->x;
+        span->x += width;
+        span->width -= width;
+        if (span->width == 0)
+        {
+            shelf.freeSpans.erase(span);
+        }
 
-        auto bounds = GetSlotCoordinates(slot, actualWidth, actualHeight);
+        const ivec4 bounds{ x, shelf.y, x + actualWidth, shelf.y + actualHeight };
 
-        AtlasTextureInfo info{};
+        info = {};
         info.index = _index;
-        info.slot = slot;
+        info.slot = static_cast<GLuint>(shelfIndex);
         info.bounds = bounds;
         info.normalizedBounds = NormalizeCoordinates(bounds);
-
-        return info;
+        return true;
     }
 
     void Free(const AtlasTextureInfo& info)
     {
         assert(_index == info.index);
+        assert(info.slot < _shelves.size());
 
-        _freeSlots.push_back(info.slot);
-    }
-
-    // Checks if specified image would be tightly packed in this atlas
-    // by checking if it is within the right power of 2 range
-    [[nodiscard]] bool IsImageSuitable(int32_t actualWidth, int32_t actualHeight) const
-    {
-        int32_t imageOrder = CalculateImageSizeOrder(actualWidth, actualHeight);
-        int32_t atlasOrder = log2(_imageSize);
+        auto& shelf = _shelves[info.slot];
+        Span freed{ info.bounds.x, info.bounds.z - info.bounds.x + 1 };
+        auto& spans = shelf.freeSpans;
+        auto next = std::lower_bound(
+            spans.begin(), spans.end(), freed.x, [](const Span& s, int32_t x) { return s.x < x; });
 
-        return imageOrder == atlasOrder;
+        // Merge with the free spans on either side.
+        if (next != spans.end() && next->x == freed.x + freed.width)
+        {
+            freed.width += next->width;
+            next = spans.erase(next);
+        }
+        if (next != spans.begin())
+        {
+            auto previous = std::prev(next);
+            if (previous->x + previous->width == freed.x)
+            {
+                previous->width += freed.width;
+                TrimShelves();
+                return;
+            }
+        }
+        spans.insert(next, freed);
+        TrimShelves();
     }
 
-    [[nodiscard]] int32_t GetFreeSlots() const
+    [[nodiscard]] bool IsEmpty() const
     {
-        return static_cast<int32_t>(_freeSlots.size());
+        return _shelves.empty();
     }
 
-    static int32_t CalculateImageSizeOrder(int32_t actualWidth, int32_t actualHeight)
+private:
+    [[nodiscard]] int32_t FindShelf(int32_t width, int32_t height, int32_t maxShelfHeight) const
     {
-        int32_t actualSize = std::max(actualWidth, actualHeight);
-
-        if (actualSize < TEXTURE_CACHE_SMALLEST_SLOT)
+        int32_t best = -1;
+        for (size_t i = 0; i < _shelves.size(); i++)
         {
-            actualSize = TEXTURE_CACHE_SMALLEST_SLOT;
+            const auto& shelf = _shelves[i];
+            if (shelf.height < height || shelf.height > maxShelfHeight)
+                continue;
+            if (best != -1 && shelf.height >= _shelves[best].height)
+                continue;
+            if (std::any_of(shelf.freeSpans.begin(), shelf.freeSpans.end(), [width](const Span& s) {
+                    return s.width >= width;
+                }))
+            {
+                best = static_cast<int32_t>(i);
+            }
         }
-
-        return static_cast<int32_t>(ceil(log2f(static_cast<float>(actualSize))));
+        return best;
     }
 
-private:
-    [[nodiscard]] ivec4 GetSlotCoordinates(GLuint slot, int32_t actualWidth, int32_t actualHeight) const
+    // Gives the space of empty shelves at the bottom of the stack back, so it can be used for shelves of other heights.
+    void TrimShelves()
     {
-        int32_t row = slot / _cols;
-        int32_t col = slot % _cols;
-
-        return ivec4{
-            _imageSize * col,
-            _imageSize * row,
-            _imageSize * col + actualWidth,
-            _imageSize * row + actualHeight,
-        };
+        while (!_shelves.empty())
+        {
+            const auto& spans = _shelves.back().freeSpans;
+            if (spans.size() != 1 || spans[0].width != _atlasWidth)
+                break;
+
+            _shelvesHeight -= _shelves.back().height;
+            _shelves.pop_back();
+        }
     }
 
     [[nodiscard]] vec4 NormalizeCoordinates(const ivec4& coords) const
@@ -200,10 +273,26 @@ private:
     GLuint _atlasesTextureCapacity = 0;
     GLuint _atlasesTextureIndices = 0;
     GLint _atlasesTextureIndicesLimit = 0;
+    GLint _atlasesTextureBudget = 0;
     std::vector<Atlas> _atlases;
-    std::unordered_map<GlyphId, AtlasTextureInfo, GlyphId::Hash, GlyphId::Equal> _glyphTextureMap;
+    std::unordered_map<GlyphId, uint32_t, GlyphId::Hash, GlyphId::Equal> _glyphTextureMap;
     std::vector<AtlasTextureInfo> _textureCache;
     std::array<uint32_t, SPR_IMAGE_LIST_END> _indexMap;
+    uint32_t _currentFrame = 0;
+
+    struct PendingUpload
+    {
+        GLuint index;
+        ivec4 bounds;
+        std::vector<uint8_t> pixels;
+    };
+
+    // Images that have been allocated in the atlases but not uploaded yet, in the order they were allocated in so
+    // that an image uploaded later always overwrites an evicted one that occupied the same space.
+    std::deque<PendingUpload> _pendingUploads;
+    std::unique_ptr<OpenGLStreamBuffer> _uploadBuffer;
+    // Decodes the pixels of the pending uploads, must be joined before any of them is accessed.
+    JobPool _decodeJobs;
 
     GLuint _paletteTexture = 0;
 
@@ -221,6 +310,10 @@ public:
     TextureCache();
     ~TextureCache();
     void InvalidateImage(ImageIndex image);
+    // Images used before the next call can not be evicted, as draw commands referring to them may still be queued.
+    void NextFrame();
+    // Uploads all images loaded since the last call, has to be called before drawing with the atlases texture.
+    void FlushUploads();
     BasicTextureInfo GetOrLoadImageTexture(ImageId imageId);
     BasicTextureInfo GetOrLoadGlyphTexture(ImageId imageId, const PaletteMap& paletteMap);
     BasicTextureInfo GetOrLoadBitmapTexture(ImageIndex image, const void* pixels, size_t width, size_t height);
@@ -236,11 +329,15 @@ private:
     AtlasTextureInfo LoadImageTexture(ImageId image);
     AtlasTextureInfo LoadGlyphTexture(ImageId image, const PaletteMap& paletteMap);
     AtlasTextureInfo AllocateImage(int32_t imageWidth, int32_t imageHeight);
+    bool TryAllocateImage(int32_t imageWidth, int32_t imageHeight, AtlasTextureInfo& info, GLint maxAtlases);
+    bool EvictImages(bool all);
+    void RemoveEntry(uint32_t index);
+    uint32_t AddEntry(const AtlasTextureInfo& info);
     AtlasTextureInfo LoadBitmapTexture(ImageIndex image, const void* pixels, size_t width, size_t height);
-    static rct_drawpixelinfo GetImageAsDPI(ImageId imageId);
-    static rct_drawpixelinfo GetGlyphAsDPI(ImageId imageId, const PaletteMap& paletteMap);
+    PendingUpload& QueueUpload(const AtlasTextureInfo& info);
     void FreeTextures();
 
     static rct_drawpixelinfo CreateDPI(int32_t width, int32_t height);
     static void DeleteDPI(rct_drawpixelinfo dpi);
+    static rct_drawpixelinfo GetUploadAsDPI(PendingUpload& upload);
 };
@@ -288,6 +288,68 @@ void CustomListView::SetItems(std::vector<ListViewItem>&& items, bool initialisi
     }
 }
 
+bool CustomListView::SetItem(size_t index, ListViewItem&& item)
+{
+    if (index >= Items.size())
+    {
+        return false;
+    }
+    Items[index] = std::move(item);
+    OnItemChanged();
+    return true;
+}
+
+bool CustomListView::InsertItem(size_t index, ListViewItem&& item)
+{
+    if (index > Items.size())
+    {
+        return false;
+    }
+    Items.insert(Items.begin() + index, std::move(item));
+
+    // Cells refer to item indices, which have moved up
+    if (SelectedCell && SelectedCell->Row >= static_cast<int32_t>(index))
+    {
+        SelectedCell->Row++;
+    }
+    HighlightedCell = std::nullopt;
+    LastHighlightedCell = std::nullopt;
+    OnItemChanged();
+    return true;
+}
+
+bool CustomListView::RemoveItem(size_t index)
+{
+    if (index >= Items.size())
+    {
+        return false;
+    }
+    Items.erase(Items.begin() + index);
+
+    // Cells refer to item indices, which have moved down
+    if (SelectedCell)
+    {
+        if (SelectedCell->Row == static_cast<int32_t>(index))
+        {
+            SelectedCell = std::nullopt;
+        }
+        else if (SelectedCell->Row > static_cast<int32_t>(index))
+        {
+            SelectedCell->Row--;
+        }
+    }
+    HighlightedCell = std::nullopt;
+    LastHighlightedCell = std::nullopt;
+    OnItemChanged();
+    return true;
+}
+
+void CustomListView::OnItemChanged()
+{
+    SortItems(CurrentSortColumn, CurrentSortOrder);
+    window_update_scroll_widgets(ParentWindow);
+}
+
 bool CustomListView::SortItem(size_t indexA, size_t indexB, int32_t column)
 {
     const auto& cellA = Items[indexA].Cells[column];
@@ -553,8 +615,11 @@ void CustomListView::Paint(rct_window* w, rct_drawpixelinfo* dpi, const rct_scro
     auto paletteIndex = ColourMapA[w->colours[1]].mid_light;
     gfx_fill_rect(dpi, { { dpi->x, dpi->y }, { dpi->x + dpi->width, dpi->y + dpi->height } }, paletteIndex);
 
-    int32_t y = ShowColumnHeaders ? COLUMN_HEADER_HEIGHT : 0;
-    for (size_t i = 0; i < Items.size(); i++)
+    // Skip straight to the first row in the scroll view area
+    const int32_t firstY = ShowColumnHeaders ? COLUMN_HEADER_HEIGHT : 0;
+    const auto firstRow = static_cast<size_t>(std::max(0, (dpi->y - firstY) / LIST_ROW_HEIGHT - 1));
+    int32_t y = firstY + static_cast<int32_t>(firstRow) * LIST_ROW_HEIGHT;
+    for (size_t i = firstRow; i < Items.size(); i++)
     {
         if (y > dpi->y + dpi->height)
         {
@@ -128,6 +128,10 @@ namespace OpenRCT2::Ui::Windows
         const std::vector<ListViewItem>& GetItems() const;
         void SetItems(const std::vector<ListViewItem>& items, bool initialising = false);
         void SetItems(std::vector<ListViewItem>&& items, bool initialising = false);
+        // Changes a single item, the current sort order is kept. Return false if the index is out of range.
+        bool SetItem(size_t index, ListViewItem&& item);
+        bool InsertItem(size_t index, ListViewItem&& item);
+        bool RemoveItem(size_t index);
         bool SortItem(size_t indexA, size_t indexB, int32_t column);
         void SortItems(int32_t column);
         void SortItems(int32_t column, ColumnSortOrder order);
@@ -148,6 +152,7 @@ namespace OpenRCT2::Ui::Windows
             bool isHighlighted) const;
         std::optional<RowColumn> GetItemIndexAt(const ScreenCoordsXY& pos);
         rct_widget* GetWidget() const;
+        void OnItemChanged();
         void Invalidate();
     };
 } // namespace OpenRCT2::Ui::Windows
@@ -697,6 +697,9 @@ namespace OpenRCT2::Scripting
                 ctx, &ScListViewWidget::selectedCell_get, &ScListViewWidget::selectedCell_set, "selectedCell");
             dukglue_register_property(ctx, &ScListViewWidget::columns_get, &ScListViewWidget::columns_set, "columns");
             dukglue_register_property(ctx, &ScListViewWidget::items_get, &ScListViewWidget::items_set, "items");
+            dukglue_register_method(ctx, &ScListViewWidget::setItem, "setItem");
+            dukglue_register_method(ctx, &ScListViewWidget::insertItem, "insertItem");
+            dukglue_register_method(ctx, &ScListViewWidget::removeItem, "removeItem");
         }
 
     private:
@@ -832,6 +835,39 @@ namespace OpenRCT2::Scripting
             }
         }
 
+        void setItem(uint32_t index, const DukValue& value)
+        {
+            auto listView = GetListView();
+            if (listView != nullptr && !listView->SetItem(index, FromDuk<ListViewItem>(value)))
+            {
+                ThrowItemIndexOutOfRange();
+            }
+        }
+
+        void insertItem(uint32_t index, const DukValue& value)
+        {
+            auto listView = GetListView();
+            if (listView != nullptr && !listView->InsertItem(index, FromDuk<ListViewItem>(value)))
+            {
+                ThrowItemIndexOutOfRange();
+            }
+        }
+
+        void removeItem(uint32_t index)
+        {
+            auto listView = GetListView();
+            if (listView != nullptr && !listView->RemoveItem(index))
+            {
+                ThrowItemIndexOutOfRange();
+            }
+        }
+
+        void ThrowItemIndexOutOfRange()
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            duk_error(ctx, DUK_ERR_RANGE_ERROR, "Index must be between zero and the number of items.");
+        }
+
         std::vector<DukValue> columns_get()
         {
             std::vector<DukValue> result;
@@ -12,6 +12,7 @@
 #include "../interface/Window.h"
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <openrct2/Context.h>
 #include <openrct2/Game.h>
@@ -21,6 +22,7 @@
 #include <openrct2/common.h>
 #include <openrct2/core/Console.hpp>
 #include <openrct2/core/Guard.hpp>
+#include <openrct2/core/MemoryStream.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/entity/EntityRegistry.h>
@@ -55,6 +57,10 @@ private:
     int32_t _lastScreenHeight = 0;
     CoordsXY _viewCentreLocation = {};
 
+    // Park data of the next load command, read on a worker thread so the scene change does not wait on the disk.
+    int32_t _preloadPosition = -1;
+    std::future<std::unique_ptr<TitleSequenceParkHandle>> _preload;
+
 public:
     explicit TitleSequencePlayer(GameState& gameState)
         : _gameState(gameState)
@@ -73,6 +79,9 @@ public:
 
     void Eject() override
     {
+        // The preload reads from the sequence, wait for it first.
+        _preloadPosition = -1;
+        _preload = {};
         _sequence = nullptr;
     }
 
@@ -95,6 +104,7 @@ public:
         _sequence = std::move(sequence);
 
         Reset();
+        PreloadPark(0);
         return true;
     }
 
@@ -283,12 +293,19 @@ private:
             {
                 bool loadSuccess = false;
                 uint8_t saveIndex = command.SaveIndex;
-                auto parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
+                auto parkHandle = TakePreloadedPark();
+                if (parkHandle == nullptr)
+                {
+                    parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
+                }
                 if (parkHandle != nullptr)
                 {
                     game_notify_map_change();
                     loadSuccess = LoadParkFromStream(parkHandle->Stream.get(), parkHandle->HintPath);
                 }
+
+                // Whether or not this one loaded, the sequence carries on with the next load command.
+                PreloadPark(_position + 1);
                 if (loadSuccess)
                 {
                     game_notify_map_changed();
@@ -328,6 +345,63 @@ private:
         return true;
     }
 
+    /**
+     * Starts reading the park of the first load command at or after the given position on a worker thread. Zipped
+     * parks are extracted and parks in a directory are read into memory.
+     */
+    void PreloadPark(int32_t startPosition)
+    {
+        _preloadPosition = -1;
+        _preload = {};
+
+        const auto numCommands = static_cast<int32_t>(_sequence->Commands.size());
+        for (int32_t i = 0; i < numCommands; i++)
+        {
+            auto position = (startPosition + i) % numCommands;
+            const auto& command = _sequence->Commands[position];
+            if (command.Type == TitleScript::Load)
+            {
+                _preloadPosition = position;
+                _preload = std::async(
+                    std::launch::async, [sequence = _sequence.get(), saveIndex = command.SaveIndex]() {
+                        std::unique_ptr<TitleSequenceParkHandle> handle;
+                        try
+                        {
+                            handle = TitleSequenceGetParkHandle(*sequence, saveIndex);
+                            if (handle != nullptr && !sequence->IsZip)
+                            {
+                                std::vector<uint8_t> data(static_cast<size_t>(handle->Stream->GetLength()));
+                                handle->Stream->Read(data.data(), data.size());
+                                handle->Stream = std::make_unique<OpenRCT2::MemoryStream>(std::move(data));
+                            }
+                        }
+                        catch (const std::exception&)
+                        {
+                            // Leave it to the load command to open the park again and report the error.
+                            handle = nullptr;
+                        }
+                        return handle;
+                    });
+                return;
+            }
+        }
+    }
+
+    /**
+     * Returns the preloaded park if it belongs to the load command at the current position, otherwise nullptr.
+     */
+    std::unique_ptr<TitleSequenceParkHandle> TakePreloadedPark()
+    {
+        std::unique_ptr<TitleSequenceParkHandle> handle;
+        if (_preloadPosition == _position && _preload.valid())
+        {
+            handle = _preload.get();
+        }
+        _preloadPosition = -1;
+        _preload = {};
+        return handle;
+    }
+
     void SetViewZoom(ZoomLevel zoom)
     {
         rct_window* w = window_get_main();
@@ -17,6 +17,7 @@
 #include <openrct2/localisation/LocalisationService.h>
 #include <openrct2/paint/Paint.h>
 #include <openrct2/paint/tile_element/Paint.TileElement.h>
+#include <openrct2/profiling/Profiling.h>
 #include <openrct2/ride/TrackPaint.h>
 
 static int32_t ResizeLanguage = LANGUAGE_UNDEFINED;
@@ -30,18 +31,22 @@ enum WindowDebugPaintWidgetIdx
     WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS,
     WIDX_TOGGLE_SHOW_BOUND_BOXES,
     WIDX_TOGGLE_SHOW_DIRTY_VISUALS,
+    WIDX_TOGGLE_SHOW_WINDOW_DRAW_TIMES,
+    WIDX_TOGGLE_SHOW_FRAME_STATS,
 };
 
 constexpr int32_t WINDOW_WIDTH = 200;
-constexpr int32_t WINDOW_HEIGHT = 8 + 15 + 15 + 15 + 15 + 11 + 8;
+constexpr int32_t WINDOW_HEIGHT = 8 + 15 + 15 + 15 + 15 + 15 + 15 + 11 + 8;
 
 static rct_widget window_debug_paint_widgets[] = {
-    MakeWidget({0,          0}, {WINDOW_WIDTH, WINDOW_HEIGHT}, WindowWidgetType::Frame,    WindowColour::Primary                                        ),
-    MakeWidget({8, 8 + 15 * 0}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_WIDE_PATHS     ),
-    MakeWidget({8, 8 + 15 * 1}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_BLOCKED_TILES  ),
-    MakeWidget({8, 8 + 15 * 2}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_SEGMENT_HEIGHTS),
-    MakeWidget({8, 8 + 15 * 3}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_BOUND_BOXES    ),
-    MakeWidget({8, 8 + 15 * 4}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_DIRTY_VISUALS  ),
+    MakeWidget({0,          0}, {WINDOW_WIDTH, WINDOW_HEIGHT}, WindowWidgetType::Frame,    WindowColour::Primary                                          ),
+    MakeWidget({8, 8 + 15 * 0}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_WIDE_PATHS       ),
+    MakeWidget({8, 8 + 15 * 1}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_BLOCKED_TILES    ),
+    MakeWidget({8, 8 + 15 * 2}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_SEGMENT_HEIGHTS  ),
+    MakeWidget({8, 8 + 15 * 3}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_BOUND_BOXES      ),
+    MakeWidget({8, 8 + 15 * 4}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_DIRTY_VISUALS    ),
+    MakeWidget({8, 8 + 15 * 5}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_WINDOW_DRAW_TIMES),
+    MakeWidget({8, 8 + 15 * 6}, {         185,            12}, WindowWidgetType::Checkbox, WindowColour::Secondary, STR_DEBUG_PAINT_SHOW_FRAME_STATS      ),
     WIDGETS_END,
 };
 
@@ -109,6 +114,19 @@ static void WindowDebugPaintMouseup([[maybe_unused]] rct_window* w, rct_widgetin
             gShowDirtyVisuals = !gShowDirtyVisuals;
             gfx_invalidate_screen();
             break;
+
+        case WIDX_TOGGLE_SHOW_WINDOW_DRAW_TIMES:
+            gShowWindowDrawTimes = !gShowWindowDrawTimes;
+            gfx_invalidate_screen();
+            break;
+
+        case WIDX_TOGGLE_SHOW_FRAME_STATS:
+            gShowFrameStats = !gShowFrameStats;
+            // The frame statistics are only recorded while profiling.
+            if (gShowFrameStats)
+                OpenRCT2::Profiling::Enable();
+            gfx_invalidate_screen();
+            break;
     }
 }
 
@@ -123,7 +141,7 @@ static void WindowDebugPaintInvalidate(rct_window* w)
 
         // Find the width of the longest string
         int16_t newWidth = 0;
-        for (size_t widgetIndex = WIDX_TOGGLE_SHOW_WIDE_PATHS; widgetIndex <= WIDX_TOGGLE_SHOW_DIRTY_VISUALS; widgetIndex++)
+        for (size_t widgetIndex = WIDX_TOGGLE_SHOW_WIDE_PATHS; widgetIndex <= WIDX_TOGGLE_SHOW_FRAME_STATS; widgetIndex++)
         {
             auto stringIdx = w->widgets[widgetIndex].text;
             auto string = ls.GetString(stringIdx);
@@ -144,6 +162,8 @@ static void WindowDebugPaintInvalidate(rct_window* w)
         w->widgets[WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS].right = newWidth - 8;
         w->widgets[WIDX_TOGGLE_SHOW_BOUND_BOXES].right = newWidth - 8;
         w->widgets[WIDX_TOGGLE_SHOW_DIRTY_VISUALS].right = newWidth - 8;
+        w->widgets[WIDX_TOGGLE_SHOW_WINDOW_DRAW_TIMES].right = newWidth - 8;
+        w->widgets[WIDX_TOGGLE_SHOW_FRAME_STATS].right = newWidth - 8;
 
         w->Invalidate();
     }
@@ -153,6 +173,8 @@ static void WindowDebugPaintInvalidate(rct_window* w)
     WidgetSetCheckboxValue(w, WIDX_TOGGLE_SHOW_SEGMENT_HEIGHTS, gShowSupportSegmentHeights);
     WidgetSetCheckboxValue(w, WIDX_TOGGLE_SHOW_BOUND_BOXES, gPaintBoundingBoxes);
     WidgetSetCheckboxValue(w, WIDX_TOGGLE_SHOW_DIRTY_VISUALS, gShowDirtyVisuals);
+    WidgetSetCheckboxValue(w, WIDX_TOGGLE_SHOW_WINDOW_DRAW_TIMES, gShowWindowDrawTimes);
+    WidgetSetCheckboxValue(w, WIDX_TOGGLE_SHOW_FRAME_STATS, gShowFrameStats);
 }
 
 static void WindowDebugPaintPaint(rct_window* w, rct_drawpixelinfo* dpi)
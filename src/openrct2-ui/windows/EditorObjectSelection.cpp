@@ -29,6 +29,7 @@
 #include <openrct2/object/ObjectList.h>
 #include <openrct2/object/ObjectManager.h>
 #include <openrct2/object/ObjectRepository.h>
+#include <openrct2/object/ObjectSearchIndex.h>
 #include <openrct2/object/RideObject.h>
 #include <openrct2/object/SceneryGroupObject.h>
 #include <openrct2/platform/Platform.h>
@@ -39,6 +40,7 @@
 #include <openrct2/util/Util.h>
 #include <openrct2/windows/Intent.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // clang-format off
@@ -231,6 +233,9 @@ private:
     int32_t _listSortType = RIDE_SORT_TYPE;
     bool _listSortDescending = false;
     std::unique_ptr<Object> _loadedObject;
+    // Whether each repository item matches _filter_string, by id.
+    std::vector<bool> _filterStringMatches;
+    std::string _filterStringMatchesText;
 
 public:
     /**
@@ -1105,6 +1110,7 @@ private:
 
         VisibleListDispose();
         selected_list_item = -1;
+        UpdateFilterStringMatches();
 
         const ObjectRepositoryItem* items = object_repository_get_items();
         for (int32_t i = 0; i < numObjects; i++)
@@ -1306,21 +1312,43 @@ private:
         if (item->Name.empty())
             return false;
 
-        // Get ride type
-        const char* rideTypeName = language_get_string(GetRideTypeStringId(item));
+        return item->Id < _filterStringMatches.size() && _filterStringMatches[item->Id];
+    }
 
-        // Get object name (ride/vehicle for rides) and type name (rides only) in uppercase
-        const auto nameUpper = String::ToUpper(item->Name);
-        const auto typeUpper = String::ToUpper(rideTypeName);
-        const auto pathUpper = String::ToUpper(item->Path);
-        const auto filterUpper = String::ToUpper(_filter_string);
+    /**
+     * Looks up the items whose name, authors, identifier or filename contain the filter string in the search index,
+     * along with the rides whose ride type name contains it.
+     */
+    void UpdateFilterStringMatches()
+    {
+        const auto numObjects = object_repository_get_items_count();
+        if (_filterStringMatchesText == _filter_string && _filterStringMatches.size() == numObjects)
+            return;
+
+        _filterStringMatchesText = _filter_string;
+        _filterStringMatches = object_repository_get_search_index().Search(_filterStringMatchesText);
+        if (_filterStringMatchesText.empty())
+            return;
 
-        // Check if the searched string exists in the name, ride type, or filename
-        bool inName = nameUpper.find(filterUpper) != std::string::npos;
-        bool inRideType = (item->Type == ObjectType::Ride) && typeUpper.find(filterUpper) != std::string::npos;
-        bool inPath = pathUpper.find(filterUpper) != std::string::npos;
+        // There are only a few ride type names, so match each of them once.
+        const auto filterUpper = String::ToUpper(_filterStringMatchesText);
+        std::unordered_map<rct_string_id, bool> rideTypeMatches;
+        const ObjectRepositoryItem* items = object_repository_get_items();
+        for (size_t i = 0; i < numObjects && i < _filterStringMatches.size(); i++)
+        {
+            const auto* item = &items[i];
+            if (item->Type != ObjectType::Ride || _filterStringMatches[i])
+                continue;
 
-        return inName || inRideType || inPath;
+            const auto rideTypeStringId = GetRideTypeStringId(item);
+            auto it = rideTypeMatches.find(rideTypeStringId);
+            if (it == rideTypeMatches.end())
+            {
+                const auto typeUpper = String::ToUpper(language_get_string(rideTypeStringId));
+                it = rideTypeMatches.emplace(rideTypeStringId, typeUpper.find(filterUpper) != std::string::npos).first;
+            }
+            _filterStringMatches[i] = it->second;
+        }
     }
 
     bool SourcesMatch(ObjectSourceGame source)
@@ -1380,6 +1408,7 @@ private:
     {
         if (!_FILTER_ALL || strlen(_filter_string) > 0)
         {
+            UpdateFilterStringMatches();
             const auto& selectionFlags = _objectSelectionFlags;
             std::fill(std::begin(_filter_object_counts), std::end(_filter_object_counts), 0);
 
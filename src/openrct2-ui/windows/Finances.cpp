@@ -449,6 +449,19 @@ static void WindowFinancesSummaryUpdate(rct_window* w)
     if (++w->frame_no >= WindowFinancesTabAnimationLoops[w->page])
         w->frame_no = 0;
     widget_invalidate(w, WIDX_TAB_1);
+
+    auto hash = WindowDataHash()
+                    .Add(w->page)
+                    .Add(gExpenditureTable)
+                    .Add(gDateMonthsElapsed)
+                    .Add(gCash)
+                    .Add(gBankLoan)
+                    .Add(gBankLoanInterestRate)
+                    .Add(gParkValue)
+                    .Add(gCompanyValue)
+                    .Add(gScenarioObjective.Type);
+    if (window_update_data_hash(w, hash))
+        w->Invalidate();
 }
 
 /**
@@ -641,8 +654,10 @@ static void WindowFinancesFinancialGraphUpdate(rct_window* w)
     // Tab animation
     if (++w->frame_no >= WindowFinancesTabAnimationLoops[w->page])
         w->frame_no = 0;
+    widget_invalidate(w, WIDX_TAB_2);
 
-    w->Invalidate();
+    if (window_update_data_hash(w, WindowDataHash().Add(w->page).Add(gCashHistory).Add(gCash).Add(gBankLoan)))
+        w->Invalidate();
 }
 
 /**
@@ -751,8 +766,10 @@ static void WindowFinancesParkValueGraphUpdate(rct_window* w)
     // Tab animation
     if (++w->frame_no >= WindowFinancesTabAnimationLoops[w->page])
         w->frame_no = 0;
+    widget_invalidate(w, WIDX_TAB_3);
 
-    w->Invalidate();
+    if (window_update_data_hash(w, WindowDataHash().Add(w->page).Add(gParkValueHistory).Add(gParkValue)))
+        w->Invalidate();
 }
 
 /**
@@ -855,7 +872,10 @@ static void WindowFinancesProfitGraphUpdate(rct_window* w)
     // Tab animation
     if (++w->frame_no >= WindowFinancesTabAnimationLoops[w->page])
         w->frame_no = 0;
-    widget_invalidate(w, WIDX_TAB_2);
+    widget_invalidate(w, WIDX_TAB_4);
+
+    if (window_update_data_hash(w, WindowDataHash().Add(w->page).Add(gWeeklyProfitHistory).Add(gCurrentProfit)))
+        w->Invalidate();
 }
 
 /**
@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <algorithm>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Viewport.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -30,6 +31,8 @@
 #include <openrct2/world/Footpath.h>
 #include <openrct2/world/Park.h>
 #include <openrct2/world/Surface.h>
+#include <utility>
+#include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_FOOTPATHS;
 static constexpr const int32_t WH = 421;
@@ -144,6 +147,8 @@ static money32 _window_footpath_cost;
 static uint32_t _footpathConstructionNextArrowPulse = 0;
 static uint8_t _lastUpdatedCameraRotation = UINT8_MAX;
 static bool _footpathErrorOccured;
+// The paths placed since the mouse button went down. Dragging across them again does not send their action again.
+static std::vector<std::pair<CoordsXYZ, int32_t>> _footpathDragPlacements;
 
 /** rct2: 0x0098D8B4 */
 static constexpr const uint8_t DefaultPathSlope[] = {
@@ -405,6 +410,7 @@ static void WindowFootpathTooldown(rct_window* w, rct_widgetindex widgetIndex, c
 {
     if (widgetIndex == WIDX_CONSTRUCT_ON_LAND)
     {
+        _footpathDragPlacements.clear();
         WindowFootpathPlacePathAtPoint(screenCoords);
     }
     else if (widgetIndex == WIDX_CONSTRUCT_BRIDGE_OR_TUNNEL)
@@ -434,6 +440,7 @@ static void WindowFootpathToolup(rct_window* w, rct_widgetindex widgetIndex, con
     if (widgetIndex == WIDX_CONSTRUCT_ON_LAND)
     {
         _footpathErrorOccured = false;
+        _footpathDragPlacements.clear();
     }
 }
 
@@ -1010,6 +1017,14 @@ static void WindowFootpathPlacePathAtPoint(const ScreenCoordsXY& screenCoords)
         z += PATH_HEIGHT_STEP;
     }
 
+    // The mouse moves within a tile much more often than across tiles, only new tiles have to be placed.
+    const auto placement = std::make_pair(CoordsXYZ{ info.Loc, z }, slope);
+    if (std::find(_footpathDragPlacements.begin(), _footpathDragPlacements.end(), placement) != _footpathDragPlacements.end())
+    {
+        return;
+    }
+    _footpathDragPlacements.push_back(placement);
+
     // Try and place path
     gGameCommandErrorTitle = STR_CANT_BUILD_FOOTPATH_HERE;
     auto selectedType = gFootpathSelection.GetSelectedSurface();
@@ -1201,14 +1201,34 @@ void WindowGuestMouseUp(rct_window* w, rct_widgetindex widgetIndex)
 void WindowGuestStatsUpdate(rct_window* w)
 {
     w->frame_no++;
+
+    widget_invalidate(w, WIDX_TAB_2);
+
     auto peep = GetGuest(w);
     if (peep == nullptr)
     {
         return;
     }
-    peep->WindowInvalidateFlags &= ~PEEP_INVALIDATE_PEEP_STATS;
 
-    w->Invalidate();
+    // Low stats make their bars blink.
+    bool blinkOn = game_is_paused() || (gCurrentRealTimeTicks & 8) == 0;
+    auto hash = WindowDataHash()
+                    .Add(w->page)
+                    .Add(peep->Happiness)
+                    .Add(peep->Energy)
+                    .Add(peep->Hunger)
+                    .Add(peep->Thirst)
+                    .Add(peep->Nausea)
+                    .Add(peep->Toilet)
+                    .Add(blinkOn)
+                    .Add((gCurrentTicks - peep->GetParkEntryTime()) >> 11)
+                    .Add(peep->Intensity)
+                    .Add(peep->NauseaTolerance);
+    if (window_update_data_hash(w, hash) || (peep->WindowInvalidateFlags & PEEP_INVALIDATE_PEEP_STATS))
+    {
+        peep->WindowInvalidateFlags &= ~PEEP_INVALIDATE_PEEP_STATS;
+        w->Invalidate();
+    }
 }
 
 /**
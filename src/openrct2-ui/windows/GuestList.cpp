@@ -8,6 +8,7 @@
  *****************************************************************************/
 
 #include <cmath>
+#include <limits>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Widget.h>
 #include <openrct2-ui/windows/Window.h>
@@ -15,6 +16,8 @@
 #include <openrct2/Game.h>
 #include <openrct2/config/Config.h>
 #include <openrct2/drawing/Drawing.h>
+#include <openrct2/entity/EntityIdSet.h>
+#include <openrct2/entity/EntityList.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/Guest.h>
 #include <openrct2/localisation/Formatter.h>
@@ -25,6 +28,7 @@
 #include <openrct2/util/Math.hpp>
 #include <openrct2/util/Util.h>
 #include <openrct2/world/Park.h>
+#include <unordered_map>
 #include <vector>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_GUESTS;
@@ -93,23 +97,37 @@ private:
     {
         uint8_t args[12]{};
 
-        rct_string_id GetFirstStringId()
+        rct_string_id GetFirstStringId() const
         {
             rct_string_id firstStrId{};
             std::memcpy(&firstStrId, args, sizeof(firstStrId));
             return firstStrId;
         }
 
-        bool operator==(const FilterArguments& other)
+        bool operator==(const FilterArguments& other) const
         {
             return std::memcmp(args, other.args, sizeof(args)) == 0;
         }
-        bool operator!=(const FilterArguments& other)
+        bool operator!=(const FilterArguments& other) const
         {
             return !(*this == other);
         }
     };
 
+    struct FilterArgumentsHash
+    {
+        size_t operator()(const FilterArguments& arguments) const
+        {
+            // FNV-1a
+            size_t hash = 2166136261U;
+            for (auto b : arguments.args)
+            {
+                hash = (hash ^ b) * 16777619U;
+            }
+            return hash;
+        }
+    };
+
     struct GuestGroup
     {
         size_t NumGuests{};
@@ -122,13 +140,24 @@ private:
         using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
 
         EntityId Id;
-        char Name[256];
+        // Tells guests apart that took over the entity slot of a guest that has left.
+        uint32_t PeepId;
+        std::string Name;
+    };
+
+    // Number of guests in the park that have the same arguments for the selected view.
+    struct GuestTally
+    {
+        FilterArguments Arguments;
+        size_t NumGuests{};
     };
 
     static constexpr const uint8_t SUMMARISED_GUEST_ROW_HEIGHT = SCROLLABLE_ROW_HEIGHT + 11;
     static constexpr const auto GUESTS_PER_PAGE = 2000;
     static constexpr const auto GUEST_PAGE_HEIGHT = GUESTS_PER_PAGE * SCROLLABLE_ROW_HEIGHT;
     static constexpr size_t MaxGroups = 240;
+    static constexpr size_t TallySlotsPerUpdate = 2048;
+    static constexpr uint16_t NoTally = std::numeric_limits<uint16_t>::max();
 
     TabId _selectedTab{};
     GuestViewType _selectedView{};
@@ -145,7 +174,20 @@ private:
     uint32_t _lastFindGroupsWait{};
     std::vector<GuestGroup> _groups;
 
+    // The groups are published from tallies that are kept up to date a slice of entity slots per update, so the window
+    // costs the same however many guests there are. Each slot remembers the tally it is counted in and its face.
+    GuestViewType _tallyView{};
+    std::vector<GuestTally> _tallies;
+    std::vector<uint16_t> _freeTallies;
+    std::unordered_map<FilterArguments, uint16_t, FilterArgumentsHash> _tallyIndex;
+    std::vector<uint16_t> _guestTallies;
+    std::vector<uint8_t> _guestFaces;
+    size_t _tallyCursor{};
+
+    // Sorted list of the guests shown on the individual tab, and the same guests as a set.
     std::vector<GuestItem> _guestList;
+    EntityIdSet _listedGuests;
+    bool _guestCountChanged{};
     std::optional<size_t> _highlightedIndex;
 
     uint32_t _tabAnimationIndex{};
@@ -265,6 +307,16 @@ public:
             _lastFindGroupsWait--;
         }
 
+        if (_selectedTab == TabId::Summarised)
+        {
+            TallyGuests(TallySlotsPerUpdate);
+        }
+        else if (_guestCountChanged)
+        {
+            UpdateList();
+        }
+        _guestCountChanged = false;
+
         // Current tab image animation
         _tabAnimationIndex++;
         if (_tabAnimationIndex >= (_selectedTab == TabId::Individual ? 24UL : 32UL))
@@ -556,18 +608,13 @@ public:
             {
                 auto i = screenCoords.y / SCROLLABLE_ROW_HEIGHT;
                 i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
-                for (const auto& guestItem : _guestList)
+                if (i >= 0 && static_cast<size_t>(i) < _guestList.size())
                 {
-                    if (i == 0)
+                    auto guest = GetEntity<Guest>(_guestList[i].Id);
+                    if (guest != nullptr)
                     {
-                        auto guest = GetEntity<Guest>(guestItem.Id);
-                        if (guest != nullptr)
-                        {
-                            WindowGuestOpen(guest);
-                        }
-                        break;
+                        WindowGuestOpen(guest);
                     }
-                    i--;
                 }
                 break;
             }
@@ -611,38 +658,21 @@ public:
         // Only the individual tab uses the GuestList so no point calculating it
         if (_selectedTab != TabId::Individual)
         {
-            RefreshGroups();
+            RefreshGroups(true);
         }
         else
         {
             _guestList.clear();
-
-            for (auto peep : EntityList<Guest>())
-            {
-                EntitySetFlashing(peep, false);
-                if (peep->OutsideOfPark)
-                    continue;
-                if (_selectedFilter)
-                {
-                    if (!IsPeepInFilter(*peep))
-                        continue;
-                    EntitySetFlashing(peep, true);
-                }
-                if (!GuestShouldBeVisible(*peep))
-                    continue;
-
-                auto& item = _guestList.emplace_back();
-                item.Id = peep->sprite_index;
-
-                Formatter ft;
-                peep->FormatNameTo(ft);
-                format_string(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
-            }
-
-            std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+            _listedGuests.clear();
+            UpdateList();
         }
     }
 
+    void OnGuestCountChanged()
+    {
+        _guestCountChanged = true;
+    }
+
 private:
     void DrawTabImages(rct_drawpixelinfo& dpi)
     {
@@ -661,15 +691,79 @@ private:
             windowPos + ScreenCoordsXY{ widgets[WIDX_TAB_2].left, widgets[WIDX_TAB_2].top });
     }
 
+    /**
+     * Brings the individual list up to date. Guests that stay in the list keep their place and formatted name, only the
+     * guests new to the list are formatted and merged into it.
+     */
+    void UpdateList()
+    {
+        // Drop guests that have been removed, including those whose entity slot has been reused since.
+        auto isGone = [this](const GuestItem& item) {
+            const auto* peep = GetEntity<Guest>(item.Id);
+            if (peep == nullptr || peep->Id != item.PeepId)
+            {
+                _listedGuests.erase(item.Id);
+                return true;
+            }
+            return false;
+        };
+        _guestList.erase(std::remove_if(_guestList.begin(), _guestList.end(), isGone), _guestList.end());
+
+        const auto listedCount = _guestList.size();
+        for (auto peep : EntityList<Guest>())
+        {
+            EntitySetFlashing(peep, false);
+            const bool listed = _listedGuests.contains(peep->sprite_index);
+            bool visible = false;
+            if (!peep->OutsideOfPark && (!_selectedFilter || IsPeepInFilter(*peep)))
+            {
+                if (_selectedFilter)
+                {
+                    EntitySetFlashing(peep, true);
+                }
+                // Names only change along with a full refresh, so listed guests still match the name filter.
+                visible = GuestShouldBeVisible(*peep) && (listed || GuestNameMatchesFilter(*peep));
+            }
+
+            if (visible && !listed)
+            {
+                auto& item = _guestList.emplace_back();
+                item.Id = peep->sprite_index;
+                item.PeepId = peep->Id;
+                item.Name = FormatGuestName(*peep);
+                _listedGuests.insert(peep->sprite_index);
+            }
+            else if (!visible && listed)
+            {
+                _listedGuests.erase(peep->sprite_index);
+            }
+        }
+
+        // Guests that are no longer visible are only in the list now.
+        auto isUnlisted = [this](const GuestItem& item) { return !_listedGuests.contains(item.Id); };
+        auto addedBegin = std::remove_if(_guestList.begin(), _guestList.begin() + listedCount, isUnlisted);
+        auto addedEnd = std::move(_guestList.begin() + listedCount, _guestList.end(), addedBegin);
+        _guestList.erase(addedEnd, _guestList.end());
+
+        auto compareFunc = GetGuestCompareFunc();
+        std::sort(addedBegin, _guestList.end(), compareFunc);
+        std::inplace_merge(_guestList.begin(), addedBegin, _guestList.end(), compareFunc);
+    }
+
     void DrawScrollIndividual(rct_drawpixelinfo& dpi)
     {
-        size_t index = 0;
-        auto y = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
-        for (const auto& guestItem : _guestList)
+        // Only visit the rows that lie within dpi.
+        const auto pageTop = static_cast<int32_t>(_selectedPage) * GUEST_PAGE_HEIGHT;
+        auto index = static_cast<size_t>(std::max(0, (dpi.y + pageTop) / SCROLLABLE_ROW_HEIGHT - 1));
+        for (; index < _guestList.size(); index++)
         {
+            const auto& guestItem = _guestList[index];
+            auto y = static_cast<int32_t>(index) * SCROLLABLE_ROW_HEIGHT - pageTop;
+            if (y >= dpi.y + dpi.height || y >= 0x7FFF)
+                break;
+
             // Check if y is beyond the scroll control
-            if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi.y && y < 0x7FFF
-                && y < dpi.y + dpi.height)
+            if (y + SCROLLABLE_ROW_HEIGHT + 1 >= -0x7FFF && y + SCROLLABLE_ROW_HEIGHT + 1 > dpi.y)
             {
                 // Highlight backcolour and text colour (format)
                 rct_string_id format = STR_BLACK_STRING;
@@ -723,8 +817,6 @@ private:
                         break;
                 }
             }
-            y += SCROLLABLE_ROW_HEIGHT;
-            index++;
         }
     }
 
@@ -785,20 +877,25 @@ private:
         if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
             return false;
 
-        if (!_filterName.empty())
-        {
-            char name[256]{};
+        return true;
+    }
 
-            Formatter ft;
-            peep.FormatNameTo(ft);
-            format_string(name, sizeof(name), STR_STRINGID, ft.Data());
-            if (strcasestr(name, _filterName.c_str()) == nullptr)
-            {
-                return false;
-            }
-        }
+    bool GuestNameMatchesFilter(const Guest& peep)
+    {
+        if (_filterName.empty())
+            return true;
 
-        return true;
+        return strcasestr(FormatGuestName(peep).c_str(), _filterName.c_str()) != nullptr;
+    }
+
+    static std::string FormatGuestName(const Guest& peep)
+    {
+        char name[256]{};
+
+        Formatter ft;
+        peep.FormatNameTo(ft);
+        format_string(name, sizeof(name), STR_STRINGID, ft.Data());
+        return name;
     }
 
     bool IsPeepInFilter(const Guest& peep)
@@ -826,56 +923,154 @@ private:
         return true;
     }
 
-    GuestGroup& FindOrAddGroup(FilterArguments&& arguments)
+    void ResetTallies()
+    {
+        _tallyView = _selectedView;
+        _tallies.clear();
+        _freeTallies.clear();
+        _tallyIndex.clear();
+        _guestTallies.assign(MAX_ENTITIES, NoTally);
+        _guestFaces.assign(MAX_ENTITIES, 0);
+        _tallyCursor = 0;
+    }
+
+    uint16_t FindOrAddTally(const FilterArguments& arguments)
+    {
+        auto it = _tallyIndex.find(arguments);
+        if (it != _tallyIndex.end())
+        {
+            return it->second;
+        }
+
+        uint16_t index;
+        if (!_freeTallies.empty())
+        {
+            index = _freeTallies.back();
+            _freeTallies.pop_back();
+            _tallies[index] = { arguments, 0 };
+        }
+        else
+        {
+            index = static_cast<uint16_t>(_tallies.size());
+            _tallies.push_back({ arguments, 0 });
+        }
+        _tallyIndex.emplace(arguments, index);
+        return index;
+    }
+
+    void TallyGuest(size_t index)
     {
-        auto foundGroup = std::find_if(
-            std::begin(_groups), std::end(_groups), [&arguments](GuestGroup& group) { return group.Arguments == arguments; });
-        if (foundGroup != std::end(_groups))
+        auto tally = NoTally;
+        auto* peep = GetEntity<Guest>(EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(index)));
+        if (peep != nullptr && !peep->OutsideOfPark)
+        {
+            tally = FindOrAddTally(GetArgumentsFromPeep(*peep, _tallyView));
+            _guestFaces[index] = get_peep_face_sprite_small(peep) - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
+        }
+
+        auto& oldTally = _guestTallies[index];
+        if (oldTally != tally)
         {
-            return *foundGroup;
+            if (oldTally != NoTally)
+            {
+                _tallies[oldTally].NumGuests--;
+            }
+            if (tally != NoTally)
+            {
+                _tallies[tally].NumGuests++;
+            }
+            oldTally = tally;
         }
-        auto& newGroup = _groups.emplace_back();
-        newGroup.Arguments = arguments;
-        return newGroup;
     }
 
-    void RefreshGroups()
+    /**
+     * Recounts the next count entity slots, continuing where the last call left off.
+     */
+    void TallyGuests(size_t count)
+    {
+        if (_guestTallies.empty() || _tallyView != _selectedView)
+        {
+            return;
+        }
+
+        const auto& guests = GetEntityList(EntityType::Guest);
+        for (size_t n = 0; n < count; n++)
+        {
+            const auto index = _tallyCursor;
+            _tallyCursor = (_tallyCursor + 1) % MAX_ENTITIES;
+            if (_guestTallies[index] != NoTally
+                || guests.contains(EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(index))))
+            {
+                TallyGuest(index);
+            }
+        }
+    }
+
+    void RefreshGroups(bool recount = false)
     {
         _lastFindGroupsTick = floor2(gCurrentTicks, 256);
         _lastFindGroupsSelectedView = _selectedView;
         _lastFindGroupsWait = 320;
-        _groups.clear();
 
-        for (auto peep : EntityList<Guest>())
+        if (recount || _guestTallies.empty() || _tallyView != _selectedView)
         {
-            if (peep->OutsideOfPark)
-                continue;
+            ResetTallies();
+            TallyGuests(MAX_ENTITIES);
+        }
 
-            auto& group = FindOrAddGroup(GetArgumentsFromPeep(*peep, _selectedView));
-            if (group.NumGuests < std::size(group.Faces))
+        // Forget arguments no guest has any more and leave out the empty group (basically guests with no thoughts).
+        std::vector<uint16_t> order;
+        for (size_t i = 0; i < _tallies.size(); i++)
+        {
+            const auto& tally = _tallies[i];
+            if (tally.NumGuests == 0)
             {
-                group.Faces[group.NumGuests] = get_peep_face_sprite_small(peep) - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
+                if (_tallyIndex.erase(tally.Arguments) != 0)
+                {
+                    _freeTallies.push_back(static_cast<uint16_t>(i));
+                }
+            }
+            else if (tally.Arguments.GetFirstStringId() != STR_EMPTY)
+            {
+                order.push_back(static_cast<uint16_t>(i));
             }
-            group.NumGuests++;
         }
 
-        // Remove empty group (basically guests with no thoughts)
-        auto foundGroup = std::find_if(std::begin(_groups), std::end(_groups), [](GuestGroup& group) {
-            return group.Arguments.GetFirstStringId() == STR_EMPTY;
+        // Sort groups by number of guests
+        std::sort(order.begin(), order.end(), [this](uint16_t a, uint16_t b) {
+            return _tallies[a].NumGuests > _tallies[b].NumGuests;
         });
-        if (foundGroup != std::end(_groups))
+
+        // Remove up to MaxGroups
+        if (order.size() > MaxGroups)
         {
-            _groups.erase(foundGroup);
+            order.resize(MaxGroups);
         }
 
-        // Sort groups by number of guests
-        std::sort(
-            _groups.begin(), _groups.end(), [](const GuestGroup& a, const GuestGroup& b) { return a.NumGuests > b.NumGuests; });
+        _groups.clear();
+        std::vector<uint16_t> tallyGroups(_tallies.size(), NoTally);
+        for (auto tallyIndex : order)
+        {
+            tallyGroups[tallyIndex] = static_cast<uint16_t>(_groups.size());
+            auto& group = _groups.emplace_back();
+            group.NumGuests = _tallies[tallyIndex].NumGuests;
+            group.Arguments = _tallies[tallyIndex].Arguments;
+        }
 
-        // Remove up to MaxGroups
-        if (_groups.size() > MaxGroups)
+        // The faces of the first guests in each group, by entity slot.
+        std::vector<uint8_t> numFaces(_groups.size(), 0);
+        for (size_t index = 0; index < _guestTallies.size(); index++)
         {
-            _groups.resize(MaxGroups);
+            const auto tally = _guestTallies[index];
+            if (tally == NoTally || tallyGroups[tally] == NoTally)
+                continue;
+
+            const auto groupIndex = tallyGroups[tally];
+            auto& group = _groups[groupIndex];
+            if (numFaces[groupIndex] < std::size(group.Faces))
+            {
+                group.Faces[numFaces[groupIndex]++] = _guestFaces[index];
+            }
         }
     }
 
@@ -952,7 +1147,7 @@ private:
                 }
             }
         }
-        return strlogicalcmp(a.Name, b.Name) < 0;
+        return strlogicalcmp(a.Name.c_str(), b.Name.c_str()) < 0;
     }
 
     static GuestItem::CompareFunc GetGuestCompareFunc()
@@ -992,3 +1187,12 @@ void WindowGuestListRefreshList()
         static_cast<GuestListWindow*>(w)->RefreshList();
     }
 }
+
+void WindowGuestListUpdateGuestCount()
+{
+    auto* w = window_find_by_class(WC_GUEST_LIST);
+    if (w != nullptr)
+    {
+        static_cast<GuestListWindow*>(w)->OnGuestCountChanged();
+    }
+}
@@ -8,9 +8,11 @@
  *****************************************************************************/
 
 #include <algorithm>
+#include <atomic>
 #include <ctime>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <openrct2-ui/interface/Widget.h>
 #include <openrct2-ui/windows/Window.h>
 #include <openrct2/Context.h>
@@ -20,6 +22,7 @@
 #include <openrct2/GameState.h>
 #include <openrct2/PlatformEnvironment.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
 #include <openrct2/core/Guard.hpp>
 #include <openrct2/core/Path.hpp>
@@ -36,6 +39,7 @@
 #include <openrct2/windows/Intent.h>
 #include <openrct2/world/Park.h>
 #include <string>
+#include <thread>
 #include <vector>
 
 #pragma region Widgets
@@ -82,6 +86,7 @@ static rct_widget window_loadsave_widgets[] =
 #pragma region Events
 
 static void WindowLoadsaveClose(rct_window *w);
+static void WindowLoadsaveUpdate(rct_window *w);
 static void WindowLoadsaveMouseup(rct_window *w, rct_widgetindex widgetIndex);
 static void WindowLoadsaveResize(rct_window *w);
 static void WindowLoadsaveScrollgetsize(rct_window *w, int32_t scrollIndex, int32_t *width, int32_t *height);
@@ -96,6 +101,7 @@ static void WindowLoadsaveScrollpaint(rct_window *w, rct_drawpixelinfo *dpi, int
 static rct_window_event_list window_loadsave_events([](auto& events)
 {
     events.close = &WindowLoadsaveClose;
+    events.update = &WindowLoadsaveUpdate;
     events.mouse_up = &WindowLoadsaveMouseup;
     events.resize = &WindowLoadsaveResize;
     events.get_scroll_size = &WindowLoadsaveScrollgetsize;
@@ -121,16 +127,27 @@ struct LoadSaveListItem
     std::string name{};
     std::string path{};
     time_t date_modified{ 0 };
+    // Formatted when the row is first painted.
     std::string date_formatted{};
     std::string time_formatted{};
     uint8_t type{ 0 };
     bool loaded{ false };
 };
 
+// Files of the current directory, scanned on a worker thread and added to the list in batches as they are found.
+struct LoadSaveFileScan
+{
+    std::mutex Mutex;
+    std::vector<LoadSaveListItem> Items;
+    std::atomic<bool> Cancelled{ false };
+    std::atomic<bool> Finished{ false };
+};
+
 static std::function<void(int32_t result, std::string_view)> _loadSaveCallback;
 static TrackDesign* _trackDesign;
 
 static std::vector<LoadSaveListItem> _listItems;
+static std::shared_ptr<LoadSaveFileScan> _fileScan;
 static char _directory[MAX_PATH];
 static char _shortenedDirectory[MAX_PATH];
 static char _parentDirectory[MAX_PATH];
@@ -331,12 +348,51 @@ rct_window* WindowLoadsaveOpen(
     return w;
 }
 
+static void WindowLoadsaveCancelFileScan()
+{
+    if (_fileScan != nullptr)
+    {
+        _fileScan->Cancelled = true;
+        _fileScan = nullptr;
+    }
+}
+
 static void WindowLoadsaveClose(rct_window* w)
 {
+    WindowLoadsaveCancelFileScan();
     _listItems.clear();
     window_close_by_class(WC_LOADSAVE_OVERWRITE_PROMPT);
 }
 
+static void WindowLoadsaveUpdate(rct_window* w)
+{
+    if (_fileScan == nullptr)
+    {
+        return;
+    }
+
+    // Check before taking the items, the last batch is added before the scan is marked as finished.
+    const bool finished = _fileScan->Finished;
+    std::vector<LoadSaveListItem> items;
+    {
+        std::lock_guard<std::mutex> lock(_fileScan->Mutex);
+        items = std::move(_fileScan->Items);
+        _fileScan->Items.clear();
+    }
+    if (finished)
+    {
+        _fileScan = nullptr;
+    }
+
+    if (!items.empty())
+    {
+        _listItems.insert(_listItems.end(), std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+        WindowLoadsaveSortList();
+        w->no_list_items = static_cast<uint16_t>(_listItems.size());
+        w->Invalidate();
+    }
+}
+
 static void WindowLoadsaveResize(rct_window* w)
 {
     if (w->width < w->min_width)
@@ -608,16 +664,8 @@ static void WindowLoadsaveTextinput(rct_window* w, rct_widgetindex widgetIndex,
             const u8string path = Path::WithExtension(
                 Path::Combine(_directory, text), RemovePatternWildcard(_extensionPattern));
 
-            overwrite = false;
-            for (auto& item : _listItems)
-            {
-                if (String::Equals(item.path, path))
-                {
-                    overwrite = true;
-                    break;
-                }
-            }
-
+            // The list may not have all files yet, so ask the file system.
+            overwrite = File::Exists(path);
             if (overwrite)
                 WindowOverwritePromptOpen(text, path.c_str());
             else
@@ -785,6 +833,14 @@ static void WindowLoadsaveScrollpaint(rct_window* w, rct_drawpixelinfo* dpi, int
         // Print formatted modified date, if this is a file
         if (_listItems[i].type == TYPE_FILE)
         {
+            auto& item = _listItems[i];
+            if (item.date_formatted.empty())
+            {
+                item.date_formatted = Platform::FormatShortDate(item.date_modified);
+                item.time_formatted = Platform::FormatTime(item.date_modified);
+            }
+
+
             ft = Formatter();
             ft.Add<rct_string_id>(STR_STRING);
             ft.Add<char*>(_listItems[i].date_formatted.c_str());
@@ -831,6 +887,7 @@ static void WindowLoadsavePopulateList(
     _extensionPattern = extensionPattern;
     _shortenedDirectory[0] = '\0';
 
+    WindowLoadsaveCancelFileScan();
     _listItems.clear();
 
     // Show "new" buttons when saving
@@ -908,43 +965,61 @@ static void WindowLoadsavePopulateList(
             _listItems.push_back(std::move(newListItem));
         }
 
-        // List all files with the wanted extensions
-        bool showExtension = false;
-        for (const u8string& extToken : String::Split(extensionPattern, ";"))
-        {
-            const u8string filter = Path::Combine(directory, extToken);
-            auto scanner = Path::ScanDirectory(filter, false);
-            while (scanner->Next())
-            {
-                LoadSaveListItem newListItem;
-                newListItem.path = scanner->GetPath();
-                newListItem.type = TYPE_FILE;
-                newListItem.date_modified = Platform::FileGetModifiedTime(newListItem.path.c_str());
-
-                // Cache a human-readable version of the modified date.
-                newListItem.date_formatted = Platform::FormatShortDate(newListItem.date_modified);
-                newListItem.time_formatted = Platform::FormatTime(newListItem.date_modified);
-
-                // Mark if file is the currently loaded game
-                newListItem.loaded = newListItem.path.compare(gCurrentLoadedPath.c_str()) == 0;
+        WindowLoadsaveSortList();
 
-                // Remove the extension (but only the first extension token)
-                if (!showExtension)
+        // List all files with the wanted extensions, this can take a while for large directories so it is done
+        // in the background.
+        _fileScan = std::make_shared<LoadSaveFileScan>();
+        std::thread(
+            [scan = _fileScan, directory = u8string(directory), extensionPattern = std::string(extensionPattern),
+             loadedPath = gCurrentLoadedPath]() {
+                constexpr size_t BatchSize = 64;
+                std::vector<LoadSaveListItem> batch;
+                auto flush = [&]() {
+                    std::lock_guard<std::mutex> lock(scan->Mutex);
+                    scan->Items.insert(
+                        scan->Items.end(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+                    batch.clear();
+                };
+
+                bool showExtension = false;
+                for (const u8string& extToken : String::Split(extensionPattern, ";"))
                 {
-                    newListItem.name = Path::GetFileNameWithoutExtension(newListItem.path);
+                    const u8string filter = Path::Combine(directory, extToken);
+                    auto scanner = Path::ScanDirectory(filter, false);
+                    while (!scan->Cancelled && scanner->Next())
+                    {
+                        LoadSaveListItem newListItem;
+                        newListItem.path = scanner->GetPath();
+                        newListItem.type = TYPE_FILE;
+                        newListItem.date_modified = Platform::FileGetModifiedTime(newListItem.path.c_str());
+
+                        // Mark if file is the currently loaded game
+                        newListItem.loaded = newListItem.path.compare(loadedPath) == 0;
+
+                        // Remove the extension (but only the first extension token)
+                        if (!showExtension)
+                        {
+                            newListItem.name = Path::GetFileNameWithoutExtension(newListItem.path);
+                        }
+                        else
+                        {
+                            newListItem.name = Path::GetFileName(newListItem.path);
+                        }
+
+                        batch.push_back(std::move(newListItem));
+                        if (batch.size() >= BatchSize)
+                        {
+                            flush();
+                        }
+                    }
+
+                    showExtension = true; // Show any extension after the first iteration
                 }
-                else
-                {
-                    newListItem.name = Path::GetFileName(newListItem.path);
-                }
-
-                _listItems.push_back(std::move(newListItem));
-            }
-
-            showExtension = true; // Show any extension after the first iteration
-        }
-
-        WindowLoadsaveSortList();
+                flush();
+                scan->Finished = true;
+            })
+            .detach();
     }
 
     w->Invalidate();
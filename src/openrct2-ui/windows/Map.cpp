@@ -23,6 +23,7 @@
 #include <openrct2/actions/PlacePeepSpawnAction.h>
 #include <openrct2/actions/SurfaceSetStyleAction.h>
 #include <openrct2/audio/audio.h>
+#include <openrct2/drawing/Image.h>
 #include <openrct2/entity/EntityList.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/Staff.h>
@@ -147,6 +148,9 @@ public:
 
         map.rotation = get_current_rotation();
 
+        auto g1 = GetMapImageElement();
+        _mapImage = gfx_object_allocate_images(&g1, 1);
+
         InitMap();
         gWindowSceneryRotation = 0;
         CentreMapOnViewPoint();
@@ -157,6 +161,8 @@ public:
 
     void OnClose() override
     {
+        gfx_object_free_images(_mapImage, 1);
+        _mapImage = ImageIndexUndefined;
         _mapImageData.clear();
         _mapImageData.shrink_to_fit();
         if ((input_test_flag(INPUT_FLAG_TOOL_ACTIVE)) && gCurrentToolWidget.window_classification == classification
@@ -266,6 +272,8 @@ public:
 
                     selected_tab = widgetIndex;
                     list_information_type = 0;
+                    // Every pixel changes colour, have the sweep go over the whole map again.
+                    _fastSweepLines = MAXIMUM_MAP_SIZE_TECHNICAL;
                 }
         }
     }
@@ -304,8 +312,7 @@ public:
             CentreMapOnViewPoint();
         }
 
-        for (int32_t i = 0; i < 16; i++)
-            SetMapPixels();
+        UpdateMapPixels();
 
         Invalidate();
 
@@ -665,15 +672,23 @@ public:
     {
         gfx_clear(&dpi, PALETTE_INDEX_10);
 
-        rct_g1_element g1temp = {};
-        g1temp.offset = _mapImageData.data();
-        g1temp.width = MAP_WINDOW_MAP_SIZE;
-        g1temp.height = MAP_WINDOW_MAP_SIZE;
-        g1temp.x_offset = -8;
-        g1temp.y_offset = -8;
-        gfx_set_g1_element(SPR_TEMP, &g1temp);
-        drawing_engine_invalidate_image(SPR_TEMP);
-        gfx_draw_sprite(&dpi, ImageId(SPR_TEMP), { 0, 0 });
+        if (_mapImage != ImageIndexUndefined)
+        {
+            // Only have the drawing engine upload the image again when its pixels have changed.
+            if (_mapImageChanged)
+            {
+                drawing_engine_invalidate_image(_mapImage);
+                _mapImageChanged = false;
+            }
+            gfx_draw_sprite(&dpi, ImageId(_mapImage), { 0, 0 });
+        }
+        else
+        {
+            auto g1temp = GetMapImageElement();
+            gfx_set_g1_element(SPR_TEMP, &g1temp);
+            drawing_engine_invalidate_image(SPR_TEMP);
+            gfx_draw_sprite(&dpi, ImageId(SPR_TEMP), { 0, 0 });
+        }
 
         if (selected_tab == PAGE_PEEPS)
         {
@@ -881,7 +896,48 @@ private:
     void InitMap()
     {
         std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
+        _mapImageChanged = true;
         _currentLine = 0;
+        _fastSweepLines = MAXIMUM_MAP_SIZE_TECHNICAL;
+    }
+
+    rct_g1_element GetMapImageElement()
+    {
+        rct_g1_element g1 = {};
+        g1.offset = _mapImageData.data();
+        g1.width = MAP_WINDOW_MAP_SIZE;
+        g1.height = MAP_WINDOW_MAP_SIZE;
+        g1.x_offset = -8;
+        g1.y_offset = -8;
+        return g1;
+    }
+
+    /**
+     * Redraws the tiles that have been invalidated since the last update. The sweep over all tiles fills the image after
+     * it has been reset, after that it only runs a line per update to pick up changes that do not invalidate their tiles,
+     * the editors change surfaces without doing so.
+     */
+    void UpdateMapPixels()
+    {
+        if (!map_take_changed_tiles(_changedTiles))
+        {
+            _fastSweepLines = MAXIMUM_MAP_SIZE_TECHNICAL;
+        }
+        for (const auto& tilePos : _changedTiles)
+        {
+            SetMapPixel(tilePos);
+        }
+
+        int32_t lines = 1;
+        if (_fastSweepLines > 0 || (gScreenFlags & SCREEN_FLAGS_EDITOR))
+        {
+            lines = 16;
+        }
+        for (int32_t i = 0; i < lines; i++)
+        {
+            SetMapPixels();
+        }
+        _fastSweepLines = std::max(_fastSweepLines - lines, 0);
     }
 
     void CentreMapOnViewPoint()
@@ -979,18 +1035,7 @@ private:
         {
             if (!map_is_edge({ x, y }))
             {
-                uint16_t colour = 0;
-                switch (selected_tab)
-                {
-                    case PAGE_PEEPS:
-                        colour = GetPixelColourPeep({ x, y });
-                        break;
-                    case PAGE_RIDES:
-                        colour = GetPixelColourRide({ x, y });
-                        break;
-                }
-                destination[0] = (colour >> 8) & 0xFF;
-                destination[1] = colour;
+                WriteMapPixel(destination, GetPixelColour({ x, y }));
             }
             x += dx;
             y += dy;
@@ -1004,6 +1049,62 @@ private:
             _currentLine = 0;
     }
 
+    void SetMapPixel(const TileCoordsXY& tilePos)
+    {
+        const auto c = tilePos.ToCoordsXY();
+        if (map_is_edge(c))
+            return;
+
+        // Find the line and the step along it SetMapPixels would draw the tile at.
+        constexpr int32_t last = MAXIMUM_MAP_SIZE_TECHNICAL - 1;
+        int32_t line = 0, i = 0;
+        switch (get_current_rotation())
+        {
+            case 0:
+                line = tilePos.x;
+                i = tilePos.y;
+                break;
+            case 1:
+                line = tilePos.y;
+                i = last - tilePos.x;
+                break;
+            case 2:
+                line = last - tilePos.x;
+                i = last - tilePos.y;
+                break;
+            case 3:
+                line = last - tilePos.y;
+                i = tilePos.x;
+                break;
+        }
+        auto destination = _mapImageData.data() + ((line + i) * MAP_WINDOW_MAP_SIZE) + (last - line + i);
+        WriteMapPixel(destination, GetPixelColour(c));
+    }
+
+    void WriteMapPixel(uint8_t* destination, uint16_t colour)
+    {
+        const uint8_t left = (colour >> 8) & 0xFF;
+        const uint8_t right = colour & 0xFF;
+        if (destination[0] != left || destination[1] != right)
+        {
+            destination[0] = left;
+            destination[1] = right;
+            _mapImageChanged = true;
+        }
+    }
+
+    uint16_t GetPixelColour(const CoordsXY& c)
+    {
+        switch (selected_tab)
+        {
+            case PAGE_PEEPS:
+                return GetPixelColourPeep(c);
+            case PAGE_RIDES:
+                return GetPixelColourRide(c);
+        }
+        return 0;
+    }
+
     uint16_t GetPixelColourPeep(const CoordsXY& c)
     {
         auto* surfaceElement = map_get_surface_element_at(c);
@@ -1107,15 +1208,40 @@ private:
         return colourB;
     }
 
+    /**
+     * Returns the part of the map that is visible in dpi, with some tiles to spare for rounding and the larger dots of
+     * flashing peeps.
+     */
+    MapRange GetVisibleMapRange(const rct_drawpixelinfo& dpi)
+    {
+        const ScreenCoordsXY corners[] = {
+            { dpi.x, dpi.y },
+            { dpi.x + dpi.width, dpi.y },
+            { dpi.x, dpi.y + dpi.height },
+            { dpi.x + dpi.width, dpi.y + dpi.height },
+        };
+        auto leftTop = ScreenToMap(corners[0]);
+        auto rightBottom = leftTop;
+        for (const auto& corner : corners)
+        {
+            auto c = ScreenToMap(corner);
+            leftTop = { std::min(leftTop.x, c.x), std::min(leftTop.y, c.y) };
+            rightBottom = { std::max(rightBottom.x, c.x), std::max(rightBottom.y, c.y) };
+        }
+        constexpr int32_t margin = 2 * COORDS_XY_STEP;
+        return MapRange(leftTop.x - margin, leftTop.y - margin, rightBottom.x + margin, rightBottom.y + margin);
+    }
+
     void PaintPeepOverlay(rct_drawpixelinfo* dpi)
     {
+        const auto visibleRange = GetVisibleMapRange(*dpi);
         auto flashColour = GetGuestFlashColour();
-        for (auto guest : EntityList<Guest>())
+        for (auto guest : EntityRangeQuery<Guest>(visibleRange))
         {
             DrawMapPeepPixel(guest, flashColour, dpi);
         }
         flashColour = GetStaffFlashColour();
-        for (auto staff : EntityList<Staff>())
+        for (auto staff : EntityRangeQuery<Staff>(visibleRange))
         {
             DrawMapPeepPixel(staff, flashColour, dpi);
         }
@@ -1325,8 +1451,14 @@ private:
 
     uint8_t _activeTool;
     uint32_t _currentLine;
+    // Lines left until the sweep has been over the whole map since the image was reset.
+    int32_t _fastSweepLines;
     uint16_t _landRightsToolSize;
     std::vector<uint8_t> _mapImageData;
+    // The map pixels have an image of their own, so the drawing engine can keep them uploaded while they do not change.
+    ImageIndex _mapImage = ImageIndexUndefined;
+    bool _mapImageChanged{};
+    std::vector<TileCoordsXY> _changedTiles;
 
     static constexpr const uint16_t RideKeyColours[] = {
         MapColour(PALETTE_INDEX_61),  // COLOUR_KEY_RIDE
@@ -899,6 +899,10 @@ static void WindowParkGuestsUpdate(rct_window* w)
     w->frame_no++;
     w->var_492 = (w->var_492 + 1) % 24;
     widget_invalidate(w, WIDX_TAB_3);
+
+    // Invalidate guest count if changed
+    if (window_update_data_hash(w, WindowDataHash().Add(w->page).Add(gNumGuestsInPark)))
+        widget_invalidate(w, WIDX_PAGE_BACKGROUND);
 }
 
 /**
@@ -1039,6 +1043,10 @@ static void WindowParkPriceUpdate(rct_window* w)
 {
     w->frame_no++;
     widget_invalidate(w, WIDX_TAB_4);
+
+    // Invalidate income from admissions if changed
+    if (window_update_data_hash(w, WindowDataHash().Add(w->page).Add(gTotalIncomeFromAdmissions)))
+        widget_invalidate(w, WIDX_PAGE_BACKGROUND);
 }
 
 /**
@@ -1161,6 +1169,10 @@ static void WindowParkStatsUpdate(rct_window* w)
         w->numberOfStaff = i;
         widget_invalidate(w, WIDX_PAGE_BACKGROUND);
     }
+
+    // Invalidate guest and admission counts if changed
+    if (window_update_data_hash(w, WindowDataHash().Add(w->page).Add(gNumGuestsInPark).Add(gTotalAdmissions)))
+        widget_invalidate(w, WIDX_PAGE_BACKGROUND);
 }
 
 /**
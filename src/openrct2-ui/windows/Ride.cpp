@@ -57,6 +57,7 @@
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
 #include <openrct2/world/Park.h>
+#include <openrct2/world/TileElementsView.h>
 #include <optional>
 #include <vector>
 
@@ -434,6 +435,7 @@ static void WindowRideMainViewportRotate(rct_window* w);
 static void WindowRideMainInvalidate(rct_window* w);
 static void WindowRideMainPaint(rct_window* w, rct_drawpixelinfo* dpi);
 static void WindowRideMainFollowRide(rct_window* w);
+static rct_string_id WindowRideGetStatus(rct_window* w, Formatter& ft);
 
 static void WindowRideVehicleMouseup(rct_window* w, rct_widgetindex widgetIndex);
 static void WindowRideVehicleResize(rct_window* w);
@@ -1056,26 +1058,18 @@ static void WindowRideDisableTabs(rct_window* w)
 static void WindowRideUpdateOverallView(Ride* ride)
 {
     // Calculate x, y, z bounds of the entire ride using its track elements
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-
     CoordsXYZ min = { std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max(),
                       std::numeric_limits<int32_t>::max() };
     CoordsXYZ max = { std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::min(),
                       std::numeric_limits<int32_t>::min() };
 
-    while (tile_element_iterator_next(&it))
-    {
-        if (it.element->GetType() != TileElementType::Track)
-            continue;
-
-        if (it.element->AsTrack()->GetRideIndex() != ride->id)
-            continue;
+    ForEachMapElement<TrackElement>([ride, &min, &max](const TileCoordsXY& tilePos, TrackElement& trackElement) {
+        if (trackElement.GetRideIndex() != ride->id)
+            return;
 
-        auto location = TileCoordsXY(it.x, it.y).ToCoordsXY();
-        int32_t baseZ = it.element->GetBaseZ();
-        int32_t clearZ = it.element->GetClearanceZ();
+        auto location = tilePos.ToCoordsXY();
+        int32_t baseZ = trackElement.GetBaseZ();
+        int32_t clearZ = trackElement.GetClearanceZ();
 
         min.x = std::min(min.x, location.x);
         min.y = std::min(min.y, location.y);
@@ -1084,7 +1078,7 @@ static void WindowRideUpdateOverallView(Ride* ride)
         max.x = std::max(max.x, location.x);
         max.y = std::max(max.y, location.y);
         max.z = std::max(max.z, clearZ);
-    }
+    });
 
     const auto rideIndex = ride->id.ToUnderlying();
     if (rideIndex >= ride_overall_views.size())
@@ -2199,18 +2193,16 @@ static void WindowRideMainUpdate(rct_window* w)
             if (w->ride.view == 0)
                 return;
 
-            if (w->ride.view <= ride->num_vehicles)
+            // Only redraw the vehicle or station status when its text changes, e.g. the speed of a travelling vehicle.
+            auto ft = Formatter();
+            auto stringId = WindowRideGetStatus(w, ft);
+            auto hash = WindowDataHash().Add(w->page).Add(w->ride.view).Add(stringId);
+            for (size_t i = 0; i < ft.NumBytes(); i++)
             {
-                Vehicle* vehicle = GetEntity<Vehicle>(ride->vehicles[w->ride.view - 1]);
-                if (vehicle == nullptr
-                    || (vehicle->status != Vehicle::Status::Travelling
-                        && vehicle->status != Vehicle::Status::TravellingCableLift
-                        && vehicle->status != Vehicle::Status::TravellingDodgems
-                        && vehicle->status != Vehicle::Status::TravellingBoat))
-                {
-                    return;
-                }
+                hash.Add(ft.Data()[i]);
             }
+            if (!window_update_data_hash(w, hash))
+                return;
         }
         ride->window_invalidate_flags &= ~RIDE_INVALIDATE_RIDE_MAIN;
     }
@@ -9,6 +9,7 @@
 
 #include "../interface/Theme.h"
 
+#include <algorithm>
 #include <iterator>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -24,7 +25,9 @@
 #include <openrct2/sprites.h>
 #include <openrct2/util/Util.h>
 #include <openrct2/windows/Intent.h>
+#include <openrct2/world/Map.h>
 #include <openrct2/world/Park.h>
+#include <openrct2/world/TileElementsView.h>
 
 static constexpr const rct_string_id WINDOW_TITLE = STR_NONE;
 static constexpr const int32_t WH = 240;
@@ -158,7 +161,22 @@ class RideListWindow final : public Window
 private:
     bool _quickDemolishMode = false;
     int32_t _windowRideListInformationType = INFORMATION_TYPE_STATUS;
-    std::vector<RideId> _rideList;
+
+    struct RideListItem
+    {
+        RideId Id;
+        // Rides with the higher key come first, unless the list is sorted by name.
+        int64_t Key{};
+        // Only set when the list is sorted by name.
+        std::string Name;
+
+        bool operator==(const RideListItem& other) const
+        {
+            return Id == other.Id && Key == other.Key && Name == other.Name;
+        }
+    };
+
+    std::vector<RideListItem> _rideList;
 
 public:
     void OnOpen() override
@@ -197,12 +215,11 @@ public:
             height = min_height;
         }
 
-        // Refreshing the list can be a very intensive operation
-        // owing to its use of ride_has_any_track_elements().
-        // This makes sure it's only refreshed every 64 ticks.
+        // Not every change to a ride marks it for the list, so rebuild the list every 64 ticks. The window is only
+        // invalidated if that changed anything.
         if (!(gCurrentRealTimeTicks & 0x3f))
         {
-            RefreshList();
+            UpdateList();
         }
     }
 
@@ -357,6 +374,8 @@ public:
      */
     void OnUpdate() override
     {
+        UpdateChangedRides();
+
         frame_no = (frame_no + 1) % 64;
         widget_invalidate(this, WIDX_TAB_1 + page);
         if (_windowRideListInformationType != INFORMATION_TYPE_STATUS)
@@ -399,7 +418,7 @@ public:
             return;
 
         // Open ride window
-        const auto rideIndex = _rideList[index];
+        const auto rideIndex = _rideList[index].Id;
         auto* ridePtr = get_ride(rideIndex);
         if (_quickDemolishMode && network_get_mode() != NETWORK_MODE_CLIENT)
         {
@@ -533,9 +552,14 @@ public:
         gfx_fill_rect(
             &dpi, { dpiCoords, dpiCoords + ScreenCoordsXY{ dpi.width, dpi.height } }, ColourMapA[colours[1]].mid_light);
 
-        auto y = 0;
-        for (size_t i = 0; i < _rideList.size(); i++)
+        // Only draw the rows that lie within dpi.
+        auto first = static_cast<size_t>(std::max(0, dpi.y / SCROLLABLE_ROW_HEIGHT - 1));
+        for (size_t i = first; i < _rideList.size(); i++)
         {
+            auto y = static_cast<int32_t>(i) * SCROLLABLE_ROW_HEIGHT;
+            if (y >= dpi.y + dpi.height + SCROLLABLE_ROW_HEIGHT)
+                break;
+
             rct_string_id format = (_quickDemolishMode ? STR_RED_STRINGID : STR_BLACK_STRING);
             if (i == static_cast<size_t>(selected_list_item))
             {
@@ -545,7 +569,7 @@ public:
             }
 
             // Get ride
-            const auto* ridePtr = get_ride(_rideList[i]);
+            const auto* ridePtr = get_ride(_rideList[i].Id);
             if (ridePtr == nullptr)
                 continue;
 
@@ -730,7 +754,6 @@ public:
                 ft.Add<rct_string_id>(formatSecondary);
             }
             DrawTextEllipsised(&dpi, { 160, y - 1 }, 157, format, ft);
-            y += SCROLLABLE_ROW_HEIGHT;
         }
     }
 
@@ -770,162 +793,220 @@ private:
             dpi, ImageId(sprite_idx), windowPos + ScreenCoordsXY{ widgets[WIDX_TAB_3].left, widgets[WIDX_TAB_3].top });
     }
 
+    RideListItem CreateItem(const Ride& ride) const
+    {
+        RideListItem item;
+        item.Id = ride.id;
+        switch (list_information_type)
+        {
+            case INFORMATION_TYPE_STATUS:
+                item.Name = ride.GetName();
+                break;
+            case INFORMATION_TYPE_POPULARITY:
+                item.Key = ride.popularity;
+                break;
+            case INFORMATION_TYPE_SATISFACTION:
+                item.Key = ride.satisfaction;
+                break;
+            case INFORMATION_TYPE_PROFIT:
+                item.Key = ride.profit;
+                break;
+            case INFORMATION_TYPE_TOTAL_CUSTOMERS:
+                item.Key = ride.total_customers;
+                break;
+            case INFORMATION_TYPE_TOTAL_PROFIT:
+                item.Key = ride.total_profit;
+                break;
+            case INFORMATION_TYPE_CUSTOMERS:
+                item.Key = ride_customers_per_hour(&ride);
+                break;
+            case INFORMATION_TYPE_AGE:
+                item.Key = ride.build_date;
+                break;
+            case INFORMATION_TYPE_INCOME:
+                item.Key = ride.income_per_hour;
+                break;
+            case INFORMATION_TYPE_RUNNING_COST:
+                item.Key = ride.upkeep_cost;
+                break;
+            case INFORMATION_TYPE_QUEUE_LENGTH:
+                item.Key = ride.GetTotalQueueLength();
+                break;
+            case INFORMATION_TYPE_QUEUE_TIME:
+                item.Key = ride.GetMaxQueueTime();
+                break;
+            case INFORMATION_TYPE_RELIABILITY:
+                item.Key = ride.reliability_percentage;
+                break;
+            case INFORMATION_TYPE_DOWN_TIME:
+                item.Key = ride.downtime;
+                break;
+            case INFORMATION_TYPE_GUESTS_FAVOURITE:
+                item.Key = ride.guests_favourite;
+                break;
+            case INFORMATION_TYPE_EXCITEMENT:
+                item.Key = ride.excitement;
+                break;
+            case INFORMATION_TYPE_INTENSITY:
+                item.Key = ride.intensity;
+                break;
+            case INFORMATION_TYPE_NAUSEA:
+                item.Key = ride.nausea;
+                break;
+        }
+        return item;
+    }
+
     /**
-     * Used in RefreshList() to handle the sorting of the list.
-     * Uses a lambda function (predicate) as exit criteria for the algorithm.
+     * Names sort ascending and all other keys descending. Ties are broken by ride index, which is the order the rides
+     * are visited in.
      */
-    template<typename TSortPred> int32_t SortList(int32_t currentListPosition, const Ride& thisRide, const TSortPred& pred)
+    bool CompareItems(const RideListItem& a, const RideListItem& b) const
     {
-        while (--currentListPosition >= 0)
+        if (list_information_type == INFORMATION_TYPE_STATUS)
+        {
+            auto result = strlogicalcmp(a.Name.c_str(), b.Name.c_str());
+            if (result != 0)
+                return result < 0;
+        }
+        else if (a.Key != b.Key)
         {
-            const auto* otherRide = get_ride(_rideList[currentListPosition]);
-            if (otherRide != nullptr)
+            return a.Key > b.Key;
+        }
+        return a.Id.ToUnderlying() < b.Id.ToUnderlying();
+    }
+
+    bool IsRideListed(const Ride& ride, const std::vector<bool>& ridesWithTrack) const
+    {
+        if (ride.GetClassification() != static_cast<RideClassification>(page))
+            return false;
+        if (ride.status == RideStatus::Closed)
+        {
+            const auto index = ride.id.ToUnderlying();
+            return index < ridesWithTrack.size() && ridesWithTrack[index];
+        }
+        return true;
+    }
+
+    /**
+     * Finds the rides that have a track element that is not a ghost, if there are any closed rides in the list that
+     * need to know. Looking at every tile element once is much cheaper than calling ride_has_any_track_elements for
+     * each closed ride.
+     */
+    std::vector<bool> GetRidesWithTrack() const
+    {
+        std::vector<bool> ridesWithTrack;
+        auto rideManager = GetRideManager();
+        auto anyClosed = std::any_of(rideManager.begin(), rideManager.end(), [this](const Ride& ride) {
+            return ride.status == RideStatus::Closed && ride.GetClassification() == static_cast<RideClassification>(page);
+        });
+        if (!anyClosed)
+            return ridesWithTrack;
+
+        OpenRCT2::ForEachMapElement<TrackElement>([&ridesWithTrack](const TileCoordsXY&, TrackElement& trackElement) {
+            if (trackElement.IsGhost())
+                return;
+
+            const auto index = trackElement.GetRideIndex().ToUnderlying();
+            if (index >= ridesWithTrack.size())
             {
-                if (pred(thisRide, *otherRide))
-                    break;
-                std::swap(_rideList[currentListPosition], _rideList[currentListPosition + 1]);
+                ridesWithTrack.resize(index + 1);
+            }
+            ridesWithTrack[index] = true;
+        });
+        return ridesWithTrack;
+    }
+
+    std::vector<RideListItem> CreateList()
+    {
+        const auto ridesWithTrack = GetRidesWithTrack();
+        std::vector<RideListItem> list;
+        for (auto& rideRef : GetRideManager())
+        {
+            rideRef.window_invalidate_flags &= ~RIDE_INVALIDATE_RIDE_LIST;
+            if (IsRideListed(rideRef, ridesWithTrack))
+            {
+                list.push_back(CreateItem(rideRef));
             }
         }
-        return currentListPosition;
+        std::sort(
+            list.begin(), list.end(), [this](const RideListItem& a, const RideListItem& b) { return CompareItems(a, b); });
+        return list;
     }
+
     /**
      *
      *  rct2: 0x006B39A8
      */
     void RefreshList()
     {
-        _rideList.clear();
+        _rideList = CreateList();
+
+        selected_list_item = -1;
+        Invalidate();
+    }
+
+    void UpdateList()
+    {
+        auto list = CreateList();
+        if (list == _rideList)
+            return;
 
-        size_t listIndex = 0;
+        _rideList = std::move(list);
+        selected_list_item = -1;
+        Invalidate();
+    }
+
+    /**
+     * Moves the rides that have been marked for the ride list to their new place, without sorting the list again.
+     */
+    void UpdateChangedRides()
+    {
+        std::vector<bool> ridesWithTrack;
+        bool ridesWithTrackValid = false;
+        bool changed = false;
         for (auto& rideRef : GetRideManager())
         {
-            if (rideRef.GetClassification() != static_cast<RideClassification>(page)
-                || (rideRef.status == RideStatus::Closed && !ride_has_any_track_elements(&rideRef)))
+            if (!(rideRef.window_invalidate_flags & RIDE_INVALIDATE_RIDE_LIST))
                 continue;
+            rideRef.window_invalidate_flags &= ~RIDE_INVALIDATE_RIDE_LIST;
 
-            if (rideRef.window_invalidate_flags & RIDE_INVALIDATE_RIDE_LIST)
+            auto it = std::find_if(
+                _rideList.begin(), _rideList.end(), [&rideRef](const RideListItem& item) { return item.Id == rideRef.id; });
+            if (rideRef.status == RideStatus::Closed && !ridesWithTrackValid)
             {
-                rideRef.window_invalidate_flags &= ~RIDE_INVALIDATE_RIDE_LIST;
+                ridesWithTrack = GetRidesWithTrack();
+                ridesWithTrackValid = true;
+            }
+            if (!IsRideListed(rideRef, ridesWithTrack))
+            {
+                if (it != _rideList.end())
+                {
+                    _rideList.erase(it);
+                    changed = true;
+                }
+                continue;
             }
 
-            _rideList.push_back(rideRef.id);
-            auto currentListPosition = static_cast<int32_t>(listIndex);
-            switch (list_information_type)
+            auto item = CreateItem(rideRef);
+            if (it != _rideList.end())
             {
-                case INFORMATION_TYPE_STATUS:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return 0 <= strlogicalcmp(thisRide.GetName().c_str(), otherRide.GetName().c_str());
-                        });
-                    break;
-                case INFORMATION_TYPE_POPULARITY:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.popularity * 4 <= otherRide.popularity * 4;
-                        });
-                    break;
-                case INFORMATION_TYPE_SATISFACTION:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.satisfaction * 5 <= otherRide.satisfaction * 5;
-                        });
-                    break;
-                case INFORMATION_TYPE_PROFIT:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.profit <= otherRide.profit;
-                        });
-                    break;
-                case INFORMATION_TYPE_TOTAL_CUSTOMERS:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.total_customers <= otherRide.total_customers;
-                        });
-                    break;
-                case INFORMATION_TYPE_TOTAL_PROFIT:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.total_profit <= otherRide.total_profit;
-                        });
-                    break;
-                case INFORMATION_TYPE_CUSTOMERS:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return ride_customers_per_hour(&thisRide) <= ride_customers_per_hour(&otherRide);
-                        });
-                    break;
-                case INFORMATION_TYPE_AGE:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.build_date <= otherRide.build_date;
-                        });
-                    break;
-                case INFORMATION_TYPE_INCOME:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.income_per_hour <= otherRide.income_per_hour;
-                        });
-                    break;
-                case INFORMATION_TYPE_RUNNING_COST:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.upkeep_cost <= otherRide.upkeep_cost;
-                        });
-                    break;
-                case INFORMATION_TYPE_QUEUE_LENGTH:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.GetTotalQueueLength() <= otherRide.GetTotalQueueLength();
-                        });
-                    break;
-                case INFORMATION_TYPE_QUEUE_TIME:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.GetMaxQueueTime() <= otherRide.GetMaxQueueTime();
-                        });
-                    break;
-                case INFORMATION_TYPE_RELIABILITY:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.reliability_percentage <= otherRide.reliability_percentage;
-                        });
-                    break;
-                case INFORMATION_TYPE_DOWN_TIME:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.downtime <= otherRide.downtime;
-                        });
-                    break;
-                case INFORMATION_TYPE_GUESTS_FAVOURITE:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.guests_favourite <= otherRide.guests_favourite;
-                        });
-                    break;
-                case INFORMATION_TYPE_EXCITEMENT:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.excitement <= otherRide.excitement;
-                        });
-                    break;
-                case INFORMATION_TYPE_INTENSITY:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.intensity <= otherRide.intensity;
-                        });
-                    break;
-                case INFORMATION_TYPE_NAUSEA:
-                    currentListPosition = SortList(
-                        currentListPosition, rideRef, [](const Ride& thisRide, const Ride& otherRide) -> bool {
-                            return thisRide.nausea <= otherRide.nausea;
-                        });
-                    break;
+                if (*it == item)
+                    continue;
+                _rideList.erase(it);
             }
-            listIndex++;
+            auto position = std::lower_bound(
+                _rideList.begin(), _rideList.end(), item,
+                [this](const RideListItem& a, const RideListItem& b) { return CompareItems(a, b); });
+            _rideList.insert(position, std::move(item));
+            changed = true;
         }
 
-        selected_list_item = -1;
-        Invalidate();
+        if (changed)
+        {
+            selected_list_item = -1;
+            Invalidate();
+        }
     }
 
     // window_ride_list_close_all
@@ -735,10 +735,11 @@ public:
     {
         _tabEntries.clear();
 
+        const auto inventedGroups = scenery_get_invented_groups();
         for (ObjectEntryIndex scenerySetIndex = 0; scenerySetIndex < MaxTabs - 1; scenerySetIndex++)
         {
             const auto* sceneryGroupEntry = get_scenery_group_entry(scenerySetIndex);
-            if (sceneryGroupEntry != nullptr && scenery_group_is_invented(scenerySetIndex))
+            if (sceneryGroupEntry != nullptr && inventedGroups[scenerySetIndex])
             {
                 SceneryTabInfo tabInfo;
                 tabInfo.SceneryGroupIndex = scenerySetIndex;
@@ -27,7 +27,6 @@
 #    include <openrct2/platform/Platform.h>
 #    include <openrct2/sprites.h>
 #    include <openrct2/util/Util.h>
-#    include <tuple>
 
 #    define WWIDTH_MIN 500
 #    define WHEIGHT_MIN 300
@@ -37,7 +36,8 @@
 
 static char _playerName[32 + 1];
 static ServerList _serverList;
-static std::future<std::tuple<std::vector<ServerListEntry>, rct_string_id>> _fetchFuture;
+static std::future<std::vector<ServerListEntry>> _fetchLocalFuture;
+static std::future<std::vector<ServerListEntry>> _fetchOnlineFuture;
 static uint32_t _numPlayersOnline = 0;
 static rct_string_id _statusText = STR_SERVER_LIST_CONNECTING;
 
@@ -113,7 +113,7 @@ static bool _showNetworkVersionTooltip = false;
 static std::string _version;
 
 static void JoinServer(std::string address);
-static void ServerListFetchServersBegin();
+static void ServerListFetchServersBegin(bool useCache);
 static void ServerListFetchServersCheck(rct_window* w);
 
 rct_window* WindowServerListOpen()
@@ -148,7 +148,7 @@ rct_window* WindowServerListOpen()
     _serverList.ReadAndAddFavourites();
     window->no_list_items = static_cast<uint16_t>(_serverList.GetCount());
 
-    ServerListFetchServersBegin();
+    ServerListFetchServersBegin(true);
 
     return window;
 }
@@ -156,7 +156,8 @@ rct_window* WindowServerListOpen()
 static void WindowServerListClose(rct_window* w)
 {
     _serverList = {};
-    _fetchFuture = {};
+    _fetchLocalFuture = {};
+    _fetchOnlineFuture = {};
 }
 
 static void WindowServerListMouseup(rct_window* w, rct_widgetindex widgetIndex)
@@ -189,7 +190,7 @@ static void WindowServerListMouseup(rct_window* w, rct_widgetindex widgetIndex)
             break;
         }
         case WIDX_FETCH_SERVERS:
-            ServerListFetchServersBegin();
+            ServerListFetchServersBegin(false);
             break;
         case WIDX_ADD_SERVER:
             WindowTextInputOpen(w, widgetIndex, STR_ADD_SERVER, STR_ENTER_HOSTNAME_OR_IP_ADDRESS, {}, STR_NONE, 0, 128);
@@ -524,9 +525,9 @@ static void JoinServer(std::string address)
     }
 }
 
-static void ServerListFetchServersBegin()
+static void ServerListFetchServersBegin(bool useCache)
 {
-    if (_fetchFuture.valid())
+    if (_fetchLocalFuture.valid() || _fetchOnlineFuture.valid())
     {
         // A fetch is already in progress
         return;
@@ -536,70 +537,56 @@ static void ServerListFetchServersBegin()
     _serverList.ReadAndAddFavourites();
     _statusText = STR_SERVER_LIST_CONNECTING;
 
-    _fetchFuture = std::async(std::launch::async, [] {
-        // Spin off background fetches
-        auto lanF = _serverList.FetchLocalServerListAsync();
-        auto wanF = _serverList.FetchOnlineServerListAsync();
+    // Both fetches run in the background, their results are added as soon as each of them arrives.
+    _fetchLocalFuture = _serverList.FetchLocalServerListAsync();
+    _fetchOnlineFuture = _serverList.FetchOnlineServerListAsync(useCache);
+    if (!_fetchOnlineFuture.valid())
+    {
+        _statusText = STR_SERVER_LIST_NO_CONNECTION;
+    }
+}
+
+static bool ServerListFetchIsReady(const std::future<std::vector<ServerListEntry>>& future)
+{
+    return future.valid() && future.wait_for(std::chrono::seconds::zero()) == std::future_status::ready;
+}
 
-        // Merge or deal with errors
-        std::vector<ServerListEntry> allEntries;
+static void ServerListFetchServersCheck(rct_window* w)
+{
+    if (ServerListFetchIsReady(_fetchLocalFuture))
+    {
         try
         {
-            auto entries = lanF.get();
-            allEntries.insert(allEntries.end(), entries.begin(), entries.end());
+            _serverList.AddRange(_fetchLocalFuture.get());
         }
-        catch (...)
+        catch (const std::exception& e)
         {
+            log_warning("Unable to query LAN servers: %s", e.what());
         }
+        _fetchLocalFuture = {};
+        _numPlayersOnline = _serverList.GetTotalPlayerCount();
+        w->Invalidate();
+    }
 
-        auto status = STR_NONE;
+    if (ServerListFetchIsReady(_fetchOnlineFuture))
+    {
         try
         {
-            auto entries = wanF.get();
-            allEntries.insert(allEntries.end(), entries.begin(), entries.end());
+            _serverList.AddRange(_fetchOnlineFuture.get());
+            _statusText = STR_X_PLAYERS_ONLINE;
         }
         catch (const MasterServerException& e)
         {
-            status = e.StatusText;
+            _statusText = e.StatusText;
         }
-        catch (...)
+        catch (const std::exception& e)
         {
-            status = STR_SERVER_LIST_NO_CONNECTION;
-        }
-        return std::make_tuple(allEntries, status);
-    });
-}
-
-static void ServerListFetchServersCheck(rct_window* w)
-{
-    if (_fetchFuture.valid())
-    {
-        auto status = _fetchFuture.wait_for(std::chrono::seconds::zero());
-        if (status == std::future_status::ready)
-        {
-            try
-            {
-                auto [entries, statusText] = _fetchFuture.get();
-                _serverList.AddRange(entries);
-                _numPlayersOnline = _serverList.GetTotalPlayerCount();
-                _statusText = STR_X_PLAYERS_ONLINE;
-                if (statusText != STR_NONE)
-                {
-                    _statusText = statusText;
-                }
-            }
-            catch (const MasterServerException& e)
-            {
-                _statusText = e.StatusText;
-            }
-            catch (const std::exception& e)
-            {
-                _statusText = STR_SERVER_LIST_NO_CONNECTION;
-                log_warning("Unable to connect to master server: %s", e.what());
-            }
-            _fetchFuture = {};
-            w->Invalidate();
+            _statusText = STR_SERVER_LIST_NO_CONNECTION;
+            log_warning("Unable to connect to master server: %s", e.what());
         }
+        _fetchOnlineFuture = {};
+        _numPlayersOnline = _serverList.GetTotalPlayerCount();
+        w->Invalidate();
     }
 }
 
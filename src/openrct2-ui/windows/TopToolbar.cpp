@@ -1771,6 +1771,8 @@ static void WindowTopToolbarSceneryToolDown(const ScreenCoordsXY& windowPos, rct
                 }
             }
 
+            // A scattered cluster redraws its area once.
+            MapInvalidationScope invalidationScope;
             bool forceError = true;
             for (int32_t q = 0; q < quantity; q++)
             {
@@ -78,6 +78,17 @@ private:
     std::unique_ptr<TrackDesign> _loadedTrackDesign;
     std::vector<uint8_t> _trackDesignPreviewPixels;
 
+    // Previews of recently shown designs, most recent last. Going back to one of them reuses its preview instead of
+    // placing the design on the preview map again. Only kept while the list stays the same.
+    struct CachedPreview
+    {
+        uint16_t TrackDesignIndex;
+        std::unique_ptr<TrackDesign> Design;
+        std::vector<uint8_t> Pixels;
+    };
+    static constexpr size_t MaxCachedPreviews = 16;
+    std::vector<CachedPreview> _cachedPreviews;
+
     void FilterList()
     {
         _filteredTrackIds.clear();
@@ -172,6 +183,9 @@ private:
 
     void LoadDesignsList(RideSelection item)
     {
+        _cachedPreviews.clear();
+        _loadedTrackDesignIndex = TRACK_DESIGN_INDEX_UNLOADED;
+
         auto repo = OpenRCT2::GetContext()->GetTrackDesignRepository();
         std::string entryName;
         if (item.Type < 0x80)
@@ -186,6 +200,32 @@ private:
         FilterList();
     }
 
+    void CacheLoadedPreview()
+    {
+        if (_loadedTrackDesignIndex == TRACK_DESIGN_INDEX_UNLOADED || _loadedTrackDesign == nullptr)
+            return;
+
+        if (_cachedPreviews.size() >= MaxCachedPreviews)
+        {
+            _cachedPreviews.erase(_cachedPreviews.begin());
+        }
+        _cachedPreviews.push_back({ _loadedTrackDesignIndex, std::move(_loadedTrackDesign), _trackDesignPreviewPixels });
+    }
+
+    bool TakeCachedPreview(uint16_t trackDesignIndex)
+    {
+        auto it = std::find_if(_cachedPreviews.begin(), _cachedPreviews.end(), [trackDesignIndex](const auto& preview) {
+            return preview.TrackDesignIndex == trackDesignIndex;
+        });
+        if (it == _cachedPreviews.end())
+            return false;
+
+        _loadedTrackDesign = std::move(it->Design);
+        _trackDesignPreviewPixels.swap(it->Pixels);
+        _cachedPreviews.erase(it);
+        return true;
+    }
+
     bool LoadDesignPreview(utf8* path)
     {
         _loadedTrackDesign = TrackDesignImport(path);
@@ -237,6 +277,7 @@ public:
         _loadedTrackDesign = nullptr;
         _trackDesignPreviewPixels.clear();
         _trackDesignPreviewPixels.shrink_to_fit();
+        _cachedPreviews.clear();
 
         // Dispose track list
         for (auto& trackDesign : _trackDesigns)
@@ -274,6 +315,8 @@ public:
             case WIDX_TOGGLE_SCENERY:
                 gTrackDesignSceneryToggle = !gTrackDesignSceneryToggle;
                 _loadedTrackDesignIndex = TRACK_DESIGN_INDEX_UNLOADED;
+                // Previews depend on whether scenery is shown.
+                _cachedPreviews.clear();
                 Invalidate();
                 break;
             case WIDX_BACK:
@@ -482,7 +525,8 @@ public:
 
         if (_loadedTrackDesignIndex != trackIndex)
         {
-            if (LoadDesignPreview(path))
+            CacheLoadedPreview();
+            if (TakeCachedPreview(trackIndex) || LoadDesignPreview(path))
             {
                 _loadedTrackDesignIndex = trackIndex;
             }
@@ -98,6 +98,7 @@ rct_window* WindowNewCampaignOpen(int16_t campaignType);
 
 rct_window* WindowInstallTrackOpen(const utf8* path);
 void WindowGuestListRefreshList();
+void WindowGuestListUpdateGuestCount();
 rct_window* WindowGuestListOpen();
 rct_window* WindowGuestListOpenWithFilter(GuestListFilterType type, int32_t index);
 rct_window* WindowStaffFirePromptOpen(Peep* peep);
@@ -13,6 +13,7 @@
 #include "OpenRCT2.h"
 #include "core/FileStream.h"
 #include "core/Imaging.h"
+#include "core/JobPool.h"
 #include "core/Json.hpp"
 #include "core/Path.hpp"
 #include "drawing/Drawing.h"
@@ -223,28 +224,24 @@ static bool SpriteImageExport(const rct_g1_element& spriteElement, u8string_view
     }
 }
 
+static IMAGE_FORMAT GetSpriteImageFormat(ImageImporter::Palette palette)
+{
+    return palette == ImageImporter::Palette::KeepIndices ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
+}
+
 static std::optional<ImageImporter::ImportResult> SpriteImageImport(
-    const char* path, int16_t x_offset, int16_t y_offset, ImageImporter::Palette palette, bool forceBmp,
+    const Image& image, int16_t x_offset, int16_t y_offset, ImageImporter::Palette palette, bool forceBmp,
     ImageImporter::ImportMode mode)
 {
     try
     {
-        auto format = IMAGE_FORMAT::PNG_32;
         auto flags = ImageImporter::ImportFlags::None;
-
         if (!forceBmp)
         {
             flags = ImageImporter::ImportFlags::RLE;
         }
 
-        if (palette == ImageImporter::Palette::KeepIndices)
-        {
-            format = IMAGE_FORMAT::PNG;
-        }
-
         ImageImporter importer;
-        auto image = Imaging::ReadFromFile(path, format);
-
         return importer.Import(image, x_offset, y_offset, palette, flags, mode);
     }
     catch (const std::exception& e)
@@ -254,6 +251,23 @@ static std::optional<ImageImporter::ImportResult> SpriteImageImport(
     }
 }
 
+static std::optional<ImageImporter::ImportResult> SpriteImageImport(
+    const char* path, int16_t x_offset, int16_t y_offset, ImageImporter::Palette palette, bool forceBmp,
+    ImageImporter::ImportMode mode)
+{
+    Image image;
+    try
+    {
+        image = Imaging::ReadFromFile(path, GetSpriteImageFormat(palette));
+    }
+    catch (const std::exception& e)
+    {
+        fprintf(stderr, "%s\n", e.what());
+        return std::nullopt;
+    }
+    return SpriteImageImport(image, x_offset, y_offset, palette, forceBmp, mode);
+}
+
 // TODO: Remove when C++20 is enabled and std::format can be used
 static std::string PopStr(std::ostringstream& oss)
 {
@@ -557,7 +571,15 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
 
         fprintf(stdout, "Building: %s\n", spriteFilePath);
 
-        json_t sprite_description;
+        struct SpriteBuildEntry
+        {
+            std::string ImagePath;
+            int16_t XOffset;
+            int16_t YOffset;
+            ImageImporter::Palette Palette;
+            bool ForceBmp;
+        };
+        std::vector<SpriteBuildEntry> entries;
 
         // Note: jsonSprite is deliberately left non-const: json_t behaviour changes when const
         for (auto& [jsonKey, jsonSprite] : jsonSprites.items())
@@ -584,20 +606,37 @@ int32_t cmdline_for_sprite(const char** argv, int32_t argc)
             bool forceBmp = !jsonSprite["palette"].is_null() && Json::GetBoolean(jsonSprite["forceBmp"]);
 
             auto imagePath = Path::GetAbsolute(Path::Combine(directoryPath, strPath));
+            entries.push_back(
+                { imagePath, Json::GetNumber<int16_t>(x_offset), Json::GetNumber<int16_t>(y_offset), palette, forceBmp });
+        }
+
+        // Decode and import the images a batch at a time on the job pool, adding them stays in order.
+        constexpr size_t BatchSize = 64;
+        for (size_t batchStart = 0; batchStart < entries.size(); batchStart += BatchSize)
+        {
+            const auto batchEnd = std::min(entries.size(), batchStart + BatchSize);
+            std::vector<std::optional<ImageImporter::ImportResult>> importResults(batchEnd - batchStart);
+            JobPool::ParallelFor(batchStart, batchEnd, 1, [&](size_t i) {
+                const auto& entry = entries[i];
+                importResults[i - batchStart] = SpriteImageImport(
+                    entry.ImagePath.c_str(), entry.XOffset, entry.YOffset, entry.Palette, entry.ForceBmp, gSpriteMode);
+            });
 
-            auto importResult = SpriteImageImport(
-                imagePath.c_str(), Json::GetNumber<int16_t>(x_offset), Json::GetNumber<int16_t>(y_offset), palette, forceBmp,
-                gSpriteMode);
-            if (importResult == std::nullopt)
+            for (size_t i = batchStart; i < batchEnd; i++)
             {
-                fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath.c_str());
-                return -1;
+                const auto& entry = entries[i];
+                auto& importResult = importResults[i - batchStart];
+                if (importResult == std::nullopt)
+                {
+                    fprintf(stderr, "Could not import image file: %s\nCanceling\n", entry.ImagePath.c_str());
+                    return -1;
+                }
+
+                spriteFile.AddImage(importResult.value());
+
+                if (!silent)
+                    fprintf(stdout, "Added: %s\n", entry.ImagePath.c_str());
             }
-
-            spriteFile.AddImage(importResult.value());
-
-            if (!silent)
-                fprintf(stdout, "Added: %s\n", imagePath.c_str());
         }
 
         if (!spriteFile.Save(spriteFilePath))
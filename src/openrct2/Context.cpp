@@ -34,6 +34,7 @@
 #include "core/FileStream.h"
 #include "core/Guard.hpp"
 #include "core/Http.h"
+#include "core/JobPool.h"
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
@@ -79,6 +80,7 @@
 #include <iterator>
 #include <memory>
 #include <string>
+#include <thread>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Audio;
@@ -126,16 +128,27 @@ namespace OpenRCT2
         std::unique_ptr<Painter> _painter;
 
         bool _initialised = false;
+        // How long each start-up stage took, printed with --startup-profile.
+        std::vector<std::pair<std::string, float>> _startupTimings;
+        std::mutex _startupTimingsMutex;
 
         Timer _timer;
         float _ticksAccumulator = 0.0f;
+        float _droppedTicksAccumulator = 0.0f;
         float _realtimeAccumulator = 0.0f;
+        // Real time since the previous tick started, for the jitter of the tick schedule.
+        Timer _tickIntervalTimer;
+        TickScheduleStats _tickScheduleStats;
         float _timeScale = 1.0f;
         bool _variableFrame = false;
+        // How long the last frame took to draw, in seconds.
+        float _lastDrawTime = 0.0f;
 
         // If set, will end the OpenRCT2 game loop. Intentionally private to this module so that the flag can not be set back to
         // false.
         bool _finished = false;
+        // Set in processes forked to host one of the additional parks.
+        bool _isForkedServer = false;
 
         std::future<void> _versionCheckFuture;
         NewVersionInfo _newVersionInfo;
@@ -371,8 +384,17 @@ namespace OpenRCT2
             }
             _initialised = true;
 
+            Profiling::SetThreadName("Main");
+
+            Timer startupTimer;
+
             crash_init();
 
+            // The workers are started on first use, which must come after this.
+            const auto workerThreads = gCustomWorkerThreads >= 0 ? gCustomWorkerThreads : gConfigGeneral.worker_threads;
+            const auto& workerAffinity = gCustomWorkerAffinity.empty() ? gConfigGeneral.worker_affinity : gCustomWorkerAffinity;
+            JobPool::Configure(static_cast<size_t>(std::max(workerThreads, 0)), workerAffinity);
+
             if (String::Equals(gConfigGeneral.last_run_version, OPENRCT2_VERSION))
             {
                 gOpenRCT2ShowChangelog = false;
@@ -465,35 +487,59 @@ namespace OpenRCT2
             }
 
             EnsureUserContentDirectoriesExist();
+            // The copied saves and landscapes are picked up by the scenario scan.
+            CopyOriginalUserFilesOver();
 
+            // The repositories are scanned on the worker pool while the main thread sets up audio and graphics. The
+            // scenario scan reads park files which look up their objects, so it runs after the object repository.
             // TODO Ideally we want to delay this until we show the title so that we can
             //      still open the game window and draw a progress screen for the creation
             //      of the object cache.
-            _objectRepository->LoadOrConstruct(_localisationService->GetCurrentLanguage());
-
-            // TODO Like objects, this can take a while if there are a lot of track designs
-            //      its also really something really we might want to do in the background
-            //      as its not required until the player wants to place a new ride.
-            _trackDesignRepository->Scan(_localisationService->GetCurrentLanguage());
-
-            _scenarioRepository->Scan(_localisationService->GetCurrentLanguage());
-            TitleSequenceManager::Scan();
+            const auto language = _localisationService->GetCurrentLanguage();
+            std::exception_ptr startupError;
+            std::mutex startupErrorMutex;
+            JobPool startupJobs;
+            auto addStartupTask = [&](std::function<void()> fn) {
+                startupJobs.AddTask([&, fn]() {
+                    try
+                    {
+                        fn();
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(startupErrorMutex);
+                        startupError = std::current_exception();
+                    }
+                });
+            };
+            addStartupTask([this, language]() {
+                RunStartupStage("Object repository", [&]() { _objectRepository->LoadOrConstruct(language); });
+                RunStartupStage("Scenario repository", [&]() { _scenarioRepository->Scan(language); });
+            });
+            addStartupTask([this, language]() {
+                RunStartupStage("Track design repository", [&]() { _trackDesignRepository->Scan(language); });
+            });
+            addStartupTask([this]() { RunStartupStage("Title sequences", []() { TitleSequenceManager::Scan(); }); });
 
             if (!gOpenRCT2Headless)
             {
-                Init();
-                PopulateDevices();
-                InitRideSoundsAndInfo();
+                RunStartupStage("Audio", []() {
+                    Init();
+                    PopulateDevices();
+                    InitRideSoundsAndInfo();
+                });
                 gGameSoundsOff = !gConfigSound.master_sound_enabled;
             }
 
             chat_init();
-            CopyOriginalUserFilesOver();
 
             if (!gOpenRCT2NoGraphics)
             {
-                if (!LoadBaseGraphics())
+                bool loadedGraphics = false;
+                RunStartupStage("Base graphics", [&]() { loadedGraphics = LoadBaseGraphics(); });
+                if (!loadedGraphics)
                 {
+                    startupJobs.Join();
                     return false;
                 }
 #ifdef __ENABLE_LIGHTFX__
@@ -501,6 +547,12 @@ namespace OpenRCT2
 #endif
             }
 
+            startupJobs.Join();
+            if (startupError != nullptr)
+            {
+                std::rethrow_exception(startupError);
+            }
+
             input_reset_place_obj_modifier();
             viewport_init_all();
 
@@ -514,9 +566,33 @@ namespace OpenRCT2
             _titleScreen = std::make_unique<TitleScreen>(*_gameState);
             _uiContext->Initialise();
 
+            if (gOpenRCT2StartupProfile)
+            {
+                PrintStartupProfile(startupTimer.GetElapsedTime().count());
+            }
             return true;
         }
 
+        template<typename TFn> void RunStartupStage(const char* name, TFn&& fn)
+        {
+            Timer timer;
+            fn();
+            auto elapsed = timer.GetElapsedTime().count();
+
+            std::lock_guard<std::mutex> lock(_startupTimingsMutex);
+            _startupTimings.emplace_back(name, elapsed);
+        }
+
+        void PrintStartupProfile(float total)
+        {
+            Console::WriteLine("Start-up profile:");
+            for (const auto& [name, elapsed] : _startupTimings)
+            {
+                Console::WriteLine("  %-24s %8.1f ms", name.c_str(), elapsed * 1000.0f);
+            }
+            Console::WriteLine("  %-24s %8.1f ms", "Total", total * 1000.0f);
+        }
+
         void InitialiseDrawingEngine() final override
         {
             assert(_drawingEngine == nullptr);
@@ -803,12 +879,15 @@ namespace OpenRCT2
 
         bool LoadBaseGraphics()
         {
+            // CSG1 only logs its errors, so it is read on the worker pool while g1 and g2 are loaded here.
+            JobPool jobPool;
+            jobPool.AddTask([]() { gfx_load_csg(); });
             if (!gfx_load_g1(*_env))
             {
                 return false;
             }
             gfx_load_g2();
-            gfx_load_csg();
+            jobPool.Join();
             font_sprite_initialise_characters();
             return true;
         }
@@ -818,6 +897,11 @@ namespace OpenRCT2
          */
         void Launch()
         {
+#ifndef DISABLE_NETWORK
+            // Fork before any other threads are started, the forks would not have them.
+            ForkAdditionalServers();
+#endif
+
             if (!_versionCheckFuture.valid())
             {
                 _versionCheckFuture = std::async(std::launch::async, [this] {
@@ -955,10 +1039,58 @@ namespace OpenRCT2
             }
 #endif // DISABLE_NETWORK
 
-            _stdInOutConsole.Start();
+            // Only one process can read the console input.
+            if (!_isForkedServer)
+            {
+                _stdInOutConsole.Start();
+            }
             RunGameLoop();
         }
 
+#ifndef DISABLE_NETWORK
+        /**
+         * Hosts each additional park in a forked copy of this process on the ports following the first park's. The forks
+         * share the repositories and everything else loaded at start-up until either process modifies it.
+         */
+        void ForkAdditionalServers()
+        {
+            if (gNetworkStart != NETWORK_MODE_SERVER || gNetworkStartAdditionalParks.empty())
+            {
+                return;
+            }
+
+            if (gNetworkStartPort == 0)
+            {
+                gNetworkStartPort = gConfigNetwork.default_port;
+            }
+
+            const auto parks = std::move(gNetworkStartAdditionalParks);
+            gNetworkStartAdditionalParks.clear();
+            const auto firstPort = gNetworkStartPort;
+            for (size_t i = 0; i < parks.size(); i++)
+            {
+                const auto port = firstPort + static_cast<int32_t>(i) + 1;
+                const auto pid = Platform::ForkProcess();
+                if (pid == 0)
+                {
+                    String::Set(gOpenRCT2StartupActionPath, sizeof(gOpenRCT2StartupActionPath), parks[i].c_str());
+                    gNetworkStartPort = port;
+                    _isForkedServer = true;
+                    return;
+                }
+
+                if (pid < 0)
+                {
+                    Console::Error::WriteLine("Unable to start a server process for '%s'.", parks[i].c_str());
+                }
+                else
+                {
+                    Console::WriteLine("Hosting '%s' on port %d in process %d.", parks[i].c_str(), port, pid);
+                }
+            }
+        }
+#endif // DISABLE_NETWORK
+
         bool ShouldDraw()
         {
             if (gOpenRCT2Headless)
@@ -1027,21 +1159,52 @@ namespace OpenRCT2
 
             UpdateTimeAccumulators(deltaTime);
 
+            const auto tickTimeBudget = GetTickTimeBudget();
             if (useVariableFrame)
             {
-                RunVariableFrame(deltaTime);
+                RunVariableFrame(deltaTime, tickTimeBudget);
             }
             else
             {
-                RunFixedFrame(deltaTime);
+                RunFixedFrame(deltaTime, tickTimeBudget);
             }
         }
 
+        /**
+         * Returns how long the ticks of a frame may take with pace_game_ticks: the part of the display's frame interval
+         * that is not needed for drawing. The remaining ticks are left for the following frames, so catching up after a
+         * stall or running at a high game speed does not hold back drawing. Returns 0 if ticks are not paced.
+         */
+        float GetTickTimeBudget()
+        {
+            if (!gConfigGeneral.pace_game_ticks || !ShouldDraw())
+                return 0.0f;
+
+            auto refreshRate = _uiContext->GetDisplayRefreshRate();
+            if (refreshRate <= 0)
+                refreshRate = 60;
+            const auto frameInterval = 1.0f / refreshRate;
+
+            // Always leave some time for ticks, the game could never catch up otherwise.
+            return std::max(frameInterval - _lastDrawTime, frameInterval / 4);
+        }
+
         void UpdateTimeAccumulators(float deltaTime)
         {
             // Ticks
             float scaledDeltaTime = deltaTime * _timeScale;
-            _ticksAccumulator = std::min(_ticksAccumulator + scaledDeltaTime, GAME_UPDATE_MAX_THRESHOLD);
+            _ticksAccumulator += scaledDeltaTime;
+            if (_ticksAccumulator > GAME_UPDATE_MAX_THRESHOLD)
+            {
+                // Too far behind to catch up, account for the time that is given up.
+                _droppedTicksAccumulator += _ticksAccumulator - GAME_UPDATE_MAX_THRESHOLD;
+                _ticksAccumulator = GAME_UPDATE_MAX_THRESHOLD;
+                while (_droppedTicksAccumulator >= GAME_UPDATE_TIME_MS)
+                {
+                    _tickScheduleStats.DroppedTicks++;
+                    _droppedTicksAccumulator -= GAME_UPDATE_TIME_MS;
+                }
+            }
 
             // Real Time.
             _realtimeAccumulator = std::min(_realtimeAccumulator + deltaTime, GAME_UPDATE_MAX_THRESHOLD);
@@ -1052,7 +1215,7 @@ namespace OpenRCT2
             }
         }
 
-        void RunFixedFrame(float deltaTime)
+        void RunFixedFrame(float deltaTime, float tickTimeBudget)
         {
             PROFILED_FUNCTION();
 
@@ -1060,19 +1223,25 @@ namespace OpenRCT2
 
             if (_ticksAccumulator < GAME_UPDATE_TIME_MS)
             {
-                const auto sleepTimeSec = (GAME_UPDATE_TIME_MS - _ticksAccumulator);
-                Platform::Sleep(static_cast<uint32_t>(sleepTimeSec * 1000.f));
+                // Sleep for the exact remainder, whole milliseconds would wake up early and spin until the tick is due.
+                const auto sleepTimeSec = (GAME_UPDATE_TIME_MS - _ticksAccumulator) / _timeScale;
+                std::this_thread::sleep_for(std::chrono::duration<float>(sleepTimeSec));
                 return;
             }
 
+            Timer tickTimer;
             while (_ticksAccumulator >= GAME_UPDATE_TIME_MS)
             {
+                RecordTickStart();
                 Tick();
 
                 // Always run this at a fixed rate, Update can cause multiple ticks if the game is speed up.
                 window_update_all();
 
                 _ticksAccumulator -= GAME_UPDATE_TIME_MS;
+
+                if (tickTimeBudget > 0 && tickTimer.GetElapsedTime().count() >= tickTimeBudget)
+                    break;
             }
 
             if (ShouldDraw())
@@ -1081,7 +1250,7 @@ namespace OpenRCT2
             }
         }
 
-        void RunVariableFrame(float deltaTime)
+        void RunVariableFrame(float deltaTime, float tickTimeBudget)
         {
             PROFILED_FUNCTION();
 
@@ -1090,12 +1259,14 @@ namespace OpenRCT2
 
             _uiContext->ProcessMessages();
 
+            Timer tickTimer;
             while (_ticksAccumulator >= GAME_UPDATE_TIME_MS)
             {
                 // Get the original position of each sprite
                 if (shouldDraw)
                     tweener.PreTick();
 
+                RecordTickStart();
                 Tick();
 
                 // Always run this at a fixed rate, Update can cause multiple ticks if the game is speed up.
@@ -1106,6 +1277,10 @@ namespace OpenRCT2
                 // Get the next position of each sprite
                 if (shouldDraw)
                     tweener.PostTick();
+
+                // Deferred ticks leave the accumulator above one tick, which draws the sprites at their latest position.
+                if (tickTimeBudget > 0 && tickTimer.GetElapsedTime().count() >= tickTimeBudget)
+                    break;
             }
 
             if (shouldDraw)
@@ -1117,12 +1292,32 @@ namespace OpenRCT2
             }
         }
 
+        void RecordTickStart()
+        {
+            // Whatever is left in the accumulator beyond one tick is how late this tick is.
+            const auto latency = (_ticksAccumulator - GAME_UPDATE_TIME_MS) / _timeScale;
+            const auto interval = _tickIntervalTimer.GetElapsedTimeAndRestart().count();
+            const auto jitter = std::abs(interval - GAME_UPDATE_TIME_MS / _timeScale);
+            _tickScheduleStats.Record(latency, jitter);
+        }
+
         void Draw()
         {
             PROFILED_FUNCTION();
 
+            Timer drawTimer;
             _drawingEngine->BeginDraw();
             _painter->Paint(*_drawingEngine);
+            Present();
+            _lastDrawTime = drawTimer.GetElapsedTime().count();
+
+            Profiling::MarkFrame();
+        }
+
+        void Present()
+        {
+            PROFILED_FRAME_STAGE(Present);
+
             _drawingEngine->EndDraw();
         }
 
@@ -1166,9 +1361,20 @@ namespace OpenRCT2
             _scriptEngine.Tick();
 #endif
             _stdInOutConsole.ProcessEvalQueue();
+            CheckForChangedUserContent();
             _uiContext->Tick();
         }
 
+        /**
+         * Picks up the objects, track designs and title sequences that have been written to the user directories.
+         */
+        void CheckForChangedUserContent()
+        {
+            _objectRepository->CheckForChangedFiles();
+            _trackDesignRepository->CheckForChangedFiles();
+            TitleSequenceManager::CheckForChangedFiles();
+        }
+
         /**
          * Ensure that the custom user content folders are present
          */
@@ -1300,6 +1506,11 @@ namespace OpenRCT2
         {
             return _timeScale;
         }
+
+        const TickScheduleStats& GetTickScheduleStats() const override
+        {
+            return _tickScheduleStats;
+        }
     };
 
     Context* Context::Instance = nullptr;
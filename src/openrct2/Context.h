@@ -13,6 +13,7 @@
 #include "core/String.hpp"
 #include "world/Location.hpp"
 
+#include <array>
 #include <memory>
 #include <string>
 
@@ -116,6 +117,45 @@ namespace OpenRCT2
         struct Painter;
     }
 
+    /**
+     * Records how the game ticks keep to their schedule. Latency is how long after its scheduled time a tick started,
+     * jitter is how much the time between two tick starts differed from the update interval.
+     */
+    struct TickScheduleStats
+    {
+        // Upper bounds of the histogram buckets in seconds, the last bucket counts everything above them.
+        static constexpr std::array<float, 8> BucketBounds = { 0.001f, 0.0025f, 0.005f, 0.01f, 0.025f, 0.05f, 0.1f, 0.25f };
+        using Histogram = std::array<uint64_t, BucketBounds.size() + 1>;
+
+        Histogram Latency{};
+        Histogram Jitter{};
+        double LatencySum{};
+        double JitterSum{};
+        uint64_t Ticks{};
+        // Ticks given up because the game fell further behind than it is allowed to catch up with.
+        uint64_t DroppedTicks{};
+
+        void Record(float latency, float jitter)
+        {
+            Latency[GetBucket(latency)]++;
+            Jitter[GetBucket(jitter)]++;
+            LatencySum += latency;
+            JitterSum += jitter;
+            Ticks++;
+        }
+
+    private:
+        static size_t GetBucket(float value)
+        {
+            size_t bucket = 0;
+            while (bucket < BucketBounds.size() && value > BucketBounds[bucket])
+            {
+                bucket++;
+            }
+            return bucket;
+        }
+    };
+
     /**
      * Represents an instance of OpenRCT2 and can be used to get various services.
      */
@@ -167,6 +207,7 @@ namespace OpenRCT2
 
         virtual void SetTimeScale(float newScale) abstract;
         virtual float GetTimeScale() const abstract;
+        virtual const TickScheduleStats& GetTickScheduleStats() const abstract;
     };
 
     [[nodiscard]] std::unique_ptr<IContext> CreateContext();
@@ -507,16 +507,13 @@ bool window_editor_object_selection_select_object(uint8_t isMasterObject, int32_
         return false;
     }
 
-    int32_t numObjects = static_cast<int32_t>(object_repository_get_items_count());
-    // Get repository item index
-    int32_t index = -1;
-    const ObjectRepositoryItem* items = object_repository_get_items();
-    for (int32_t i = 0; i < numObjects; i++)
+    // Repository item ids are their index in the repository, no need to search for it. Selecting a scenery group
+    // comes through here for every object in the group.
+    auto index = item->Id;
+    if (index >= _objectSelectionFlags.size())
     {
-        if (&items[i] == item)
-        {
-            index = i;
-        }
+        set_object_selection_error(isMasterObject, STR_OBJECT_SELECTION_ERR_OBJECT_DATA_NOT_FOUND);
+        return false;
     }
 
     uint8_t* selectionFlags = &_objectSelectionFlags[index];
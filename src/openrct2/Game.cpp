@@ -41,6 +41,7 @@
 #include "network/network.h"
 #include "object/Object.h"
 #include "object/ObjectList.h"
+#include "peep/GuestPathfinding.h"
 #include "platform/Platform.h"
 #include "ride/Ride.h"
 #include "ride/RideRatings.h"
@@ -344,6 +345,9 @@ void rct2_to_utf8_self(char* buffer, size_t length)
 // For example recalculate guest count by looking at all the guests instead of trusting the value in the file.
 void game_fix_save_vars()
 {
+    // Restores the queue links that are not saved and fixes queue lengths that do not match the queues.
+    ride_rebuild_all_queues();
+
     // Recalculates peep count after loading a save to fix corrupted files
     uint32_t guestCount = 0;
     {
@@ -460,6 +464,7 @@ void game_load_init()
 {
     IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
     snapshots->Reset();
+    PathfindInvalidateCaches();
 
     gScreenFlags = SCREEN_FLAGS_PLAYING;
     OpenRCT2::Audio::StopAll();
@@ -681,6 +686,12 @@ static void limit_autosave_count(const size_t numberOfFilesToKeep, bool processL
 
 void game_autosave()
 {
+    if (scenario_is_saving_in_background())
+    {
+        log_warning("Skipping autosave, the previous autosave is still being written.");
+        return;
+    }
+
     auto subDirectory = DIRID::SAVE;
     const char* fileExtension = ".park";
     uint32_t saveFlags = 0x80000000;
@@ -716,7 +727,7 @@ void game_autosave()
         File::Copy(path, backupPath, true);
     }
 
-    if (!scenario_save(path, saveFlags))
+    if (!scenario_save_in_background(path, saveFlags))
         Console::Error::WriteLine("Could not autosave the scenario. Is the save folder writeable?");
 }
 
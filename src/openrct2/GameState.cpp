@@ -102,7 +102,7 @@ void GameState::InitAll(const TileCoordsXY& mapSize)
  */
 void GameState::Tick()
 {
-    PROFILED_FUNCTION();
+    PROFILED_FRAME_STAGE(Logic);
 
     gInUpdateCode = true;
 
@@ -182,10 +182,12 @@ void GameState::Tick()
         }
     }
 
+    const bool measureLogic = network_get_mode() == NETWORK_MODE_SERVER && gConfigNetwork.log_server_metrics;
+
     // Update the game one or more times
     for (uint32_t i = 0; i < numUpdates; i++)
     {
-        UpdateLogic();
+        UpdateLogic(measureLogic ? &_logicTimings : nullptr);
         if (gGameSpeed == 1)
         {
             if (input_get_state() == InputState::Reset || input_get_state() == InputState::Normal)
@@ -250,6 +252,25 @@ void GameState::Tick()
     gInUpdateCode = false;
 }
 
+std::chrono::duration<double> LogicTimings::GetPartTime(LogicTimePart part, size_t index) const
+{
+    std::chrono::duration<double> previous{};
+    for (const auto& [otherPart, name] : LogicTimePartNames)
+    {
+        auto it = TimingInfo.find(otherPart);
+        if (it == TimingInfo.end())
+        {
+            continue;
+        }
+        if (otherPart == part)
+        {
+            return it->second[index] - previous;
+        }
+        previous = it->second[index];
+    }
+    return {};
+}
+
 void GameState::UpdateLogic(LogicTimings* timings)
 {
     PROFILED_FUNCTION();
@@ -394,6 +415,11 @@ void GameState::UpdateLogic(LogicTimings* timings)
     if (timings != nullptr)
     {
         timings->CurrentIdx = (timings->CurrentIdx + 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
+        timings->Ticks++;
+        if (std::chrono::high_resolution_clock::now() - start_time > std::chrono::duration<double>(GAME_UPDATE_TIME_MS))
+        {
+            timings->Overruns++;
+        }
     }
 }
 
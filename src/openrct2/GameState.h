@@ -16,6 +16,7 @@
 #include <chrono>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 
 namespace OpenRCT2
 {
@@ -48,6 +49,32 @@ namespace OpenRCT2
         Scripts,
     };
 
+    // Names of the parts in reports, in the order they are reported by GameState::UpdateLogic.
+    constexpr std::pair<LogicTimePart, const char*> LogicTimePartNames[] = {
+        { LogicTimePart::NetworkUpdate, "network_update" },
+        { LogicTimePart::Date, "date" },
+        { LogicTimePart::Scenario, "scenario" },
+        { LogicTimePart::Climate, "climate" },
+        { LogicTimePart::MapTiles, "map_tiles" },
+        { LogicTimePart::MapStashProvisionalElements, "map_stash_provisional_elements" },
+        { LogicTimePart::MapPathWideFlags, "map_path_wide_flags" },
+        { LogicTimePart::Peep, "peep" },
+        { LogicTimePart::MapRestoreProvisionalElements, "map_restore_provisional_elements" },
+        { LogicTimePart::Vehicle, "vehicle" },
+        { LogicTimePart::Misc, "misc" },
+        { LogicTimePart::Ride, "ride" },
+        { LogicTimePart::Park, "park" },
+        { LogicTimePart::Research, "research" },
+        { LogicTimePart::RideRatings, "ride_ratings" },
+        { LogicTimePart::RideMeasurments, "ride_measurements" },
+        { LogicTimePart::News, "news" },
+        { LogicTimePart::MapAnimation, "map_animation" },
+        { LogicTimePart::Sounds, "sounds" },
+        { LogicTimePart::GameActions, "game_actions" },
+        { LogicTimePart::NetworkFlush, "network_flush" },
+        { LogicTimePart::Scripts, "scripts" },
+    };
+
     // ~6.5s at 40Hz
     constexpr size_t LOGIC_UPDATE_MEASUREMENTS_COUNT = 256;
 
@@ -59,6 +86,13 @@ namespace OpenRCT2
     {
         LogicTimingInfo TimingInfo;
         size_t CurrentIdx{};
+        // Updates measured in total and how many of them took longer than an update interval.
+        uint64_t Ticks{};
+        uint64_t Overruns{};
+
+        // Time spent in the part during the update at the given index. The parts are timed from the start of the
+        // update, so this is the difference to the previous part.
+        std::chrono::duration<double> GetPartTime(LogicTimePart part, size_t index) const;
     };
 
     /**
@@ -69,6 +103,8 @@ namespace OpenRCT2
     private:
         std::unique_ptr<Park> _park;
         Date _date;
+        // Only filled in while the server metrics are enabled.
+        LogicTimings _logicTimings;
 
     public:
         GameState();
@@ -83,6 +119,11 @@ namespace OpenRCT2
             return *_park;
         }
 
+        const LogicTimings& GetLogicTimings() const
+        {
+            return _logicTimings;
+        }
+
         void InitAll(const TileCoordsXY& mapSize);
         void Tick();
         void UpdateLogic(LogicTimings* timings = nullptr);
@@ -10,6 +10,7 @@
 #include "GameStateSnapshots.h"
 
 #include "core/CircularBuffer.h"
+#include "core/JobPool.h"
 #include "entity/Balloon.h"
 #include "entity/Duck.h"
 #include "entity/EntityList.h"
@@ -21,6 +22,7 @@
 #include "entity/Particle.h"
 #include "entity/Staff.h"
 #include "ride/Vehicle.h"
+#include "scenario/Scenario.h"
 
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
@@ -43,12 +45,15 @@ struct GameStateSnapshot_t
     GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
     {
         tick = mv.tick;
+        srand0 = mv.srand0;
+        randStreamSeed = mv.randStreamSeed;
         storedSprites = std::move(mv.storedSprites);
         return *this;
     }
 
     uint32_t tick = InvalidTick;
     uint32_t srand0 = 0;
+    Random::Rct2::State randStreamSeed{};
 
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
@@ -185,6 +190,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         snapshot.SerialiseSprites(
             [](const EntityId index) { return reinterpret_cast<EntitySnapshot*>(GetEntity(index)); }, MAX_ENTITIES, true);
+        snapshot.randStreamSeed = gScenarioRandStreamSeed;
 
         // log_info("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
     }
@@ -203,6 +209,8 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     {
         ds << snapshot.tick;
         ds << snapshot.srand0;
+        ds << snapshot.randStreamSeed.s0;
+        ds << snapshot.randStreamSeed.s1;
         ds << snapshot.storedSprites;
         ds << snapshot.parkParameters;
     }
@@ -632,14 +640,30 @@ struct GameStateSnapshots final : public IGameStateSnapshots
         res.tickRight = cmp.tick;
         res.srand0Left = base.srand0;
         res.srand0Right = cmp.srand0;
+        res.randStreamSeedLeft = base.randStreamSeed;
+        res.randStreamSeedRight = cmp.randStreamSeed;
 
-        std::vector<EntitySnapshot> spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
-        std::vector<EntitySnapshot> spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
-
-        for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
+        // Decoding rewinds the stream of the snapshot, so both can only be decoded at once when they are distinct.
+        std::vector<EntitySnapshot> spritesBase;
+        std::vector<EntitySnapshot> spritesCmp;
+        if (&base != &cmp)
+        {
+            JobPool jobPool;
+            jobPool.AddTask([&]() { spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base)); });
+            spritesCmp = BuildSpriteList(const_cast<GameStateSnapshot_t&>(cmp));
+            jobPool.Join();
+        }
+        else
         {
-            GameStateSpriteChange_t changeData;
-            changeData.spriteIndex = i;
+            spritesBase = BuildSpriteList(const_cast<GameStateSnapshot_t&>(base));
+            spritesCmp = spritesBase;
+        }
+
+        // Every entity slot is compared on its own, the results keep the slot order.
+        res.spriteChanges.resize(spritesBase.size());
+        JobPool::ParallelFor(0, spritesBase.size(), 1024, [&](size_t i) {
+            GameStateSpriteChange_t& changeData = res.spriteChanges[i];
+            changeData.spriteIndex = static_cast<uint32_t>(i);
 
             const EntitySnapshot& spriteBase = spritesBase[i];
             const EntitySnapshot& spriteCmp = spritesCmp[i];
@@ -675,9 +699,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
                     changeData.changeType = GameStateSpriteChange_t::MODIFIED;
                 }
             }
-
-            res.spriteChanges.push_back(std::move(changeData));
-        }
+        });
 
         return res;
     }
@@ -739,6 +761,12 @@ struct GameStateSnapshots final : public IGameStateSnapshots
             cmpData.srand0Right);
         outputBuffer += tempBuffer;
 
+        snprintf(
+            tempBuffer, sizeof(tempBuffer), "stream seed left = %08X %08X, stream seed right = %08X %08X\n",
+            cmpData.randStreamSeedLeft.s0, cmpData.randStreamSeedLeft.s1, cmpData.randStreamSeedRight.s0,
+            cmpData.randStreamSeedRight.s1);
+        outputBuffer += tempBuffer;
+
         for (auto& change : cmpData.spriteChanges)
         {
             if (change.changeType == GameStateSpriteChange_t::EQUAL)
@@ -11,6 +11,7 @@
 
 #include "common.h"
 #include "core/DataSerialiser.h"
+#include "core/Random.hpp"
 
 #include <memory>
 #include <set>
@@ -51,6 +52,8 @@ struct GameStateCompareData_t
     uint32_t tickRight;
     uint32_t srand0Left;
     uint32_t srand0Right;
+    Random::Rct2::State randStreamSeedLeft;
+    Random::Rct2::State randStreamSeedRight;
     std::vector<GameStateSpriteChange_t> spriteChanges;
 };
 
@@ -12,10 +12,13 @@
 StartupAction gOpenRCT2StartupAction = StartupAction::Title;
 utf8 gOpenRCT2StartupActionPath[512] = { 0 };
 u8string gCustomUserDataPath = {};
+u8string gCustomCachePath = {};
 u8string gCustomOpenRCT2DataPath = {};
 u8string gCustomRCT1DataPath = {};
 u8string gCustomRCT2DataPath = {};
 u8string gCustomPassword = {};
+int32_t gCustomWorkerThreads = -1;
+u8string gCustomWorkerAffinity = {};
 u8string gSilentRecordingName = {};
 
 bool gOpenRCT2Headless = false;
@@ -23,6 +26,7 @@ bool gOpenRCT2NoGraphics = false;
 
 bool gOpenRCT2ShowChangelog;
 bool gOpenRCT2SilentBreakpad;
+bool gOpenRCT2StartupProfile = false;
 
 uint32_t gCurrentDrawCount = 0;
 uint8_t gScreenFlags;
@@ -13,6 +13,7 @@
 #include "core/String.hpp"
 
 #include <string>
+#include <vector>
 
 enum class PromptMode : uint8_t;
 
@@ -40,14 +41,19 @@ enum
 extern StartupAction gOpenRCT2StartupAction;
 extern utf8 gOpenRCT2StartupActionPath[512];
 extern u8string gCustomUserDataPath;
+extern u8string gCustomCachePath;
 extern u8string gCustomOpenRCT2DataPath;
 extern u8string gCustomRCT1DataPath;
 extern u8string gCustomRCT2DataPath;
 extern u8string gCustomPassword;
+// Override the worker configuration when set, -1 and an empty list leave it to config.ini.
+extern int32_t gCustomWorkerThreads;
+extern u8string gCustomWorkerAffinity;
 extern bool gOpenRCT2Headless;
 extern bool gOpenRCT2NoGraphics;
 extern bool gOpenRCT2ShowChangelog;
 extern bool gOpenRCT2SilentBreakpad;
+extern bool gOpenRCT2StartupProfile;
 extern u8string gSilentRecordingName;
 
 #ifndef DISABLE_NETWORK
@@ -55,6 +61,8 @@ extern int32_t gNetworkStart;
 extern std::string gNetworkStartHost;
 extern int32_t gNetworkStartPort;
 extern std::string gNetworkStartAddress;
+// Parks hosted by forked server processes on the ports following gNetworkStartPort.
+extern std::vector<u8string> gNetworkStartAdditionalParks;
 #endif
 
 extern uint32_t gCurrentDrawCount;
@@ -53,6 +53,12 @@ public:
     virtual ParkLoadResult LoadFromStream(
         OpenRCT2::IStream* stream, bool isScenario, bool skipObjectCheck = false, const utf8* path = String::Empty) abstract;
 
+    /**
+     * Only reads the parts of the file that GetDetails needs, without parsing the map or resolving objects. The park
+     * can not be imported afterwards.
+     */
+    virtual void LoadDetails(const utf8* path) abstract;
+
     virtual void Import() abstract;
     virtual bool GetDetails(scenario_index_entry* dst) abstract;
 };
@@ -152,6 +152,10 @@ std::unique_ptr<IPlatformEnvironment> OpenRCT2::CreatePlatformEnvironment()
         basePaths[static_cast<size_t>(DIRBASE::CONFIG)] = gCustomUserDataPath;
         basePaths[static_cast<size_t>(DIRBASE::CACHE)] = gCustomUserDataPath;
     }
+    if (!gCustomCachePath.empty())
+    {
+        basePaths[static_cast<size_t>(DIRBASE::CACHE)] = gCustomCachePath;
+    }
 
     if (basePaths[static_cast<size_t>(DIRBASE::DOCUMENTATION)].empty())
     {
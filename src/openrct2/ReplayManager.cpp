@@ -11,6 +11,7 @@
 
 #include "Context.h"
 #include "Game.h"
+#include "GameState.h"
 #include "GameStateSnapshots.h"
 #include "OpenRCT2.h"
 #include "ParkImporter.h"
@@ -35,6 +36,7 @@
 #include "world/Park.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <vector>
@@ -78,6 +80,15 @@ namespace OpenRCT2
         OpenRCT2::MemoryStream data;
     };
 
+    struct ReplayKeyframe
+    {
+        uint32_t tick;
+        // Commands from this index on had not been executed yet when the keyframe was taken.
+        uint32_t commandIndex;
+        OpenRCT2::MemoryStream parkData;
+        OpenRCT2::MemoryStream parkParams;
+    };
+
     struct ReplayRecordData
     {
         uint32_t magic;
@@ -95,15 +106,20 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, EntitiesChecksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        // Parks saved during the recording in ascending tick order, to start playback from later on.
+        std::vector<ReplayKeyframe> keyframes;
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 10;
+        static constexpr uint16_t ReplayVersion = 12;
+        // Replays without keyframes can still be played.
+        static constexpr uint16_t ReplayVersionNoKeyframes = 11;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
+        static constexpr uint32_t KeyframeTicks = 40 * 60 * 5;  // About five minutes at normal speed.
 
         enum class ReplayMode
         {
@@ -167,6 +183,12 @@ namespace OpenRCT2
                 _nextChecksumTick = gCurrentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && gCurrentTicks >= _nextKeyframeTick)
+            {
+                AddKeyframe();
+                _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (gCurrentTicks >= _currentRecording->tickEnd)
@@ -243,19 +265,10 @@ namespace OpenRCT2
 
             replayData->filePath = name;
 
-            auto context = GetContext();
-            auto& objManager = context->GetObjectManager();
-            auto objects = objManager.GetPackableObjects();
-
-            auto exporter = std::make_unique<ParkFileExporter>();
-            exporter->ExportObjectsList = objects;
-            exporter->Export(replayData->parkData);
+            ExportPark(replayData->parkData, replayData->parkParams);
 
             replayData->timeRecorded = std::chrono::seconds(std::time(nullptr)).count();
 
-            DataSerialiser parkParamsDs(true, replayData->parkParams);
-            SerialiseParkParameters(parkParamsDs);
-
             DataSerialiser cheatDataDs(true, replayData->cheatData);
             SerialiseCheats(cheatDataDs);
 
@@ -267,10 +280,34 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = gCurrentTicks + 1;
+            _nextKeyframeTick = gCurrentTicks + KeyframeTicks;
 
             return true;
         }
 
+        void ExportPark(MemoryStream& parkData, MemoryStream& parkParams)
+        {
+            auto context = GetContext();
+            auto& objManager = context->GetObjectManager();
+            auto objects = objManager.GetPackableObjects();
+
+            auto exporter = std::make_unique<ParkFileExporter>();
+            exporter->ExportObjectsList = objects;
+            exporter->Export(parkData);
+
+            DataSerialiser parkParamsDs(true, parkParams);
+            SerialiseParkParameters(parkParamsDs);
+        }
+
+        void AddKeyframe()
+        {
+            ReplayKeyframe keyframe{};
+            keyframe.tick = gCurrentTicks;
+            keyframe.commandIndex = _commandId;
+            ExportPark(keyframe.parkData, keyframe.parkParams);
+            _currentRecording->keyframes.push_back(std::move(keyframe));
+        }
+
         virtual bool StopRecording(bool discard = false) override
         {
             if (_mode != ReplayMode::RECORDING && _mode != ReplayMode::NORMALISATION)
@@ -293,7 +330,8 @@ namespace OpenRCT2
             TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
 
             // Serialise Body.
-            DataSerialiser recSerialiser(true);
+            auto recStream = MemoryStream::CreatePooled(MemoryStreamUsage::Replay);
+            DataSerialiser recSerialiser(true, recStream);
             Serialise(recSerialiser, *_currentRecording);
 
             const auto& stream = recSerialiser.GetStream();
@@ -371,6 +409,7 @@ namespace OpenRCT2
                 info.Ticks = data->tickEnd - data->tickStart;
             info.NumCommands = static_cast<uint32_t>(data->commands.size());
             info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            info.NumKeyframes = static_cast<uint32_t>(data->keyframes.size());
 
             return true;
         }
@@ -414,7 +453,16 @@ namespace OpenRCT2
             }
         }
 
-        virtual bool StartPlayback(const std::string& file) override
+        void SkipSnapshot(MemoryStream& snapshotStream)
+        {
+            DataSerialiser ds(false, snapshotStream);
+
+            IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
+            GameStateSnapshot_t& replaySnapshot = snapshots->CreateSnapshot();
+            snapshots->SerialiseSnapshot(replaySnapshot, ds);
+        }
+
+        virtual bool StartPlayback(const std::string& file, uint32_t seekTicks /*= 0*/) override
         {
             if (_mode != ReplayMode::NONE && _mode != ReplayMode::NORMALISATION)
                 return false;
@@ -427,26 +475,81 @@ namespace OpenRCT2
                 return false;
             }
 
-            if (!LoadReplayDataMap(*replayData))
+            // Start from the last keyframe before the tick to seek to, or from the beginning if there is none.
+            const auto seekTick = replayData->tickStart + std::min(seekTicks, replayData->tickEnd - replayData->tickStart);
+            const ReplayKeyframe* keyframe = nullptr;
+            if (_mode != ReplayMode::NORMALISATION)
             {
-                log_error("Unable to load map.");
-                return false;
+                for (const auto& candidate : replayData->keyframes)
+                {
+                    if (candidate.tick > seekTick)
+                        break;
+                    keyframe = &candidate;
+                }
             }
 
-            gCurrentTicks = replayData->tickStart;
+            if (keyframe != nullptr)
+            {
+                if (!LoadReplayDataMap(keyframe->parkData, keyframe->parkParams))
+                {
+                    log_error("Unable to load keyframe map.");
+                    return false;
+                }
+
+                gCurrentTicks = keyframe->tick;
+
+                // The snapshot is of the start of the replay, only read past it to get to the one at the end.
+                SkipSnapshot(replayData->gameStateSnapshots);
+
+                // Drop what happened before the keyframe, it is part of the keyframe's park already.
+                auto& commands = replayData->commands;
+                for (auto it = commands.begin(); it != commands.end();)
+                {
+                    if (it->commandIndex < keyframe->commandIndex)
+                        it = commands.erase(it);
+                    else
+                        it++;
+                }
+
+                const auto& checksums = replayData->checksums;
+                auto checksumIt = std::lower_bound(
+                    checksums.begin(), checksums.end(), keyframe->tick,
+                    [](const auto& checksum, uint32_t tick) { return checksum.first < tick; });
+                replayData->checksumIndex = static_cast<uint32_t>(std::distance(checksums.begin(), checksumIt));
+            }
+            else
+            {
+                if (!LoadReplayDataMap(replayData->parkData, replayData->parkParams))
+                {
+                    log_error("Unable to load map.");
+                    return false;
+                }
+
+                gCurrentTicks = replayData->tickStart;
 
-            LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+                LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+
+                replayData->checksumIndex = 0;
+            }
 
             _currentReplay = std::move(replayData);
-            _currentReplay->checksumIndex = 0;
             _faultyChecksumIndex = -1;
 
             // Make sure game is not paused.
             gGamePaused = 0;
 
             if (_mode != ReplayMode::NORMALISATION)
+            {
                 _mode = ReplayMode::PLAYING;
 
+                // Simulate the ticks between the keyframe and the requested tick.
+                auto* gameState = GetContext()->GetGameState();
+                while (IsReplaying() && gCurrentTicks < seekTick && !IsPlaybackStateMismatching())
+                {
+                    gameState->UpdateLogic();
+                }
+            }
+
             return true;
         }
 
@@ -484,7 +587,7 @@ namespace OpenRCT2
         {
             _mode = ReplayMode::NORMALISATION;
 
-            if (!StartPlayback(file))
+            if (!StartPlayback(file, 0))
             {
                 return false;
             }
@@ -513,17 +616,19 @@ namespace OpenRCT2
             }
         }
 
-        bool LoadReplayDataMap(ReplayRecordData& data)
+        bool LoadReplayDataMap(const MemoryStream& parkData, const MemoryStream& parkParams)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                // Read copies so the replay data can be loaded more than once.
+                auto parkDataStream = MemoryStream(parkData.GetData(), parkData.GetLength());
+                auto parkParamsStream = MemoryStream(parkParams.GetData(), parkParams.GetLength());
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkDataStream, false);
                 objManager.LoadObjects(loadResult.RequiredObjects);
 
                 importer->Import();
@@ -531,7 +636,7 @@ namespace OpenRCT2
                 EntityTweener::Get().Reset();
 
                 // Load all map global variables.
-                DataSerialiser parkParamsDs(false, data.parkParams);
+                DataSerialiser parkParamsDs(false, parkParamsStream);
                 SerialiseParkParameters(parkParamsDs);
 
                 game_load_init();
@@ -704,7 +809,7 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            return data.version == ReplayVersion || data.version == ReplayVersionNoKeyframes;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -777,6 +882,25 @@ namespace OpenRCT2
             }
 
             serialiser << data.gameStateSnapshots;
+
+            if (data.version >= ReplayVersion)
+            {
+                uint32_t countKeyframes = static_cast<uint32_t>(data.keyframes.size());
+                serialiser << countKeyframes;
+
+                if (serialiser.IsLoading())
+                {
+                    data.keyframes.resize(countKeyframes);
+                }
+
+                for (auto& keyframe : data.keyframes)
+                {
+                    serialiser << keyframe.tick;
+                    serialiser << keyframe.commandIndex;
+                    serialiser << keyframe.parkData;
+                    serialiser << keyframe.parkParams;
+                }
+            }
             return true;
         }
 
@@ -869,6 +993,7 @@ namespace OpenRCT2
         int32_t _faultyChecksumIndex = -1;
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
+        uint32_t _nextKeyframeTick = 0;
         uint32_t _nextReplayTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
@@ -14,6 +14,7 @@
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
 #include "../windows/Intent.h"
+#include "../world/Map.h"
 
 ChangeMapSizeAction::ChangeMapSizeAction(const TileCoordsXY& targetSize)
     : _targetSize(targetSize)
@@ -65,6 +66,9 @@ GameActions::Result ChangeMapSizeAction::Execute() const
         map_remove_out_of_range_elements();
     }
 
+    // The new and removed boundary tiles change which land is for sale.
+    map_count_remaining_land_rights();
+
     auto* ctx = OpenRCT2::GetContext();
     auto uiContext = ctx->GetUiContext();
     auto* windowManager = uiContext->GetWindowManager();
@@ -44,6 +44,7 @@ GameActions::Result ClearAction::Query() const
 
 GameActions::Result ClearAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return QueryExecute(true);
 }
 
@@ -12,6 +12,7 @@
 
 #    include "../Context.h"
 #    include "../scripting/ScriptEngine.h"
+#    include "../world/Map.h"
 
 CustomAction::CustomAction(const std::string& id, const std::string& json)
     : _id(id)
@@ -48,6 +49,8 @@ GameActions::Result CustomAction::Query() const
 
 GameActions::Result CustomAction::Execute() const
 {
+    // Plugin actions may change any number of tiles, redraw them together.
+    MapInvalidationScope invalidationScope;
     auto& scriptingEngine = OpenRCT2::GetContext()->GetScriptEngine();
     return scriptingEngine.QueryOrExecuteCustomGameAction(_id, _json, true);
 }
@@ -11,6 +11,7 @@
 
 #include "../Context.h"
 #include "../ReplayManager.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
@@ -18,6 +19,7 @@
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
 #include "../network/network.h"
+#include "../peep/GuestPathfinding.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
 #include "../scenario/Scenario.h"
@@ -26,10 +28,12 @@
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 
 #include <algorithm>
+#include <deque>
 #include <iterator>
 
 using namespace OpenRCT2;
@@ -48,21 +52,11 @@ namespace GameActions
             , action(std::move(ga))
         {
         }
-
-        bool operator<(const QueuedGameAction& comp) const
-        {
-            // First sort by tick
-            if (tick < comp.tick)
-                return true;
-            if (tick > comp.tick)
-                return false;
-
-            // If the ticks are equal sort by commandIndex
-            return uniqueId < comp.uniqueId;
-        }
     };
 
-    static std::multiset<QueuedGameAction> _actionQueue;
+    // Sorted by tick and then by uniqueId. Ids only ever grow, so an action goes after all others with the same or an
+    // earlier tick, which almost always is the back of the queue.
+    static std::deque<QueuedGameAction> _actionQueue;
     static uint32_t _nextUniqueId = 0;
     static bool _suspended = false;
 
@@ -82,15 +76,42 @@ namespace GameActions
         Enqueue(std::move(action), tick);
     }
 
-    void Enqueue(GameAction::Ptr&& ga, uint32_t tick)
+    static void AssignLocalPlayer(GameAction& ga)
     {
-        if (ga->GetPlayer() == -1 && network_get_mode() != NETWORK_MODE_NONE)
+        if (ga.GetPlayer() == -1 && network_get_mode() != NETWORK_MODE_NONE)
         {
             // Server can directly invoke actions and will have no player id assigned
             // as that normally happens when receiving them over network.
-            ga->SetPlayer(network_get_current_player_id());
+            ga.SetPlayer(network_get_current_player_id());
+        }
+    }
+
+    static std::deque<QueuedGameAction>::iterator GetQueuePosition(uint32_t tick)
+    {
+        if (_actionQueue.empty() || _actionQueue.back().tick <= tick)
+        {
+            return _actionQueue.end();
+        }
+        return std::upper_bound(
+            _actionQueue.begin(), _actionQueue.end(), tick,
+            [](uint32_t t, const QueuedGameAction& queued) { return t < queued.tick; });
+    }
+
+    void Enqueue(GameAction::Ptr&& ga, uint32_t tick)
+    {
+        AssignLocalPlayer(*ga);
+        _actionQueue.emplace(GetQueuePosition(tick), tick, std::move(ga), _nextUniqueId++);
+    }
+
+    void Enqueue(std::vector<GameAction::Ptr>&& actions, uint32_t tick)
+    {
+        // The actions share the tick and get ascending ids, so each one belongs right after the previous one.
+        auto it = GetQueuePosition(tick);
+        for (auto& ga : actions)
+        {
+            AssignLocalPlayer(*ga);
+            it = std::next(_actionQueue.emplace(it, tick, std::move(ga), _nextUniqueId++));
         }
-        _actionQueue.emplace(tick, std::move(ga), _nextUniqueId++);
     }
 
     void ProcessQueue()
@@ -103,14 +124,14 @@ namespace GameActions
 
         const uint32_t currentTick = gCurrentTicks;
 
-        while (_actionQueue.begin() != _actionQueue.end())
+        while (!_actionQueue.empty())
         {
             // run all the game commands at the current tick
-            const QueuedGameAction& queued = *_actionQueue.begin();
+            const QueuedGameAction& front = _actionQueue.front();
 
             if (network_get_mode() == NETWORK_MODE_CLIENT)
             {
-                if (queued.tick < currentTick)
+                if (front.tick < currentTick)
                 {
                     // This should never happen.
                     Guard::Assert(
@@ -118,14 +139,18 @@ namespace GameActions
                         "Discarding game action %s (%u) from tick behind current tick, ID: %08X, Action Tick: %08X, Current "
                         "Tick: "
                         "%08X\n",
-                        queued.action->GetName(), queued.action->GetType(), queued.uniqueId, queued.tick, currentTick);
+                        front.action->GetName(), front.action->GetType(), front.uniqueId, front.tick, currentTick);
                 }
-                else if (queued.tick > currentTick)
+                else if (front.tick > currentTick)
                 {
-                    return;
+                    break;
                 }
             }
 
+            // Executing the action may queue further ones, which would move the elements of the queue.
+            const QueuedGameAction queued = std::move(_actionQueue.front());
+            _actionQueue.pop_front();
+
             // Remove ghost scenery so it doesn't interfere with incoming network command
             switch (queued.action->GetType())
             {
@@ -134,6 +159,7 @@ namespace GameActions
                 case GameCommand::PlaceBanner:
                 case GameCommand::PlaceScenery:
                     scenery_remove_ghost_tool_placement();
+                    scenery_resolve_speculative_placement(*queued.action);
                     break;
                 default:
                     break;
@@ -150,9 +176,9 @@ namespace GameActions
                 // Relay this action to all other clients.
                 network_send_game_action(action);
             }
-
-            _actionQueue.erase(_actionQueue.begin());
         }
+
+        scenery_restore_speculative_placements();
     }
 
     void ClearQueue()
@@ -160,6 +186,11 @@ namespace GameActions
         _actionQueue.clear();
     }
 
+    size_t GetQueueSize()
+    {
+        return _actionQueue.size();
+    }
+
     GameAction::Ptr Clone(const GameAction* action)
     {
         std::unique_ptr<GameAction> ga = GameActions::Create(action->GetType());
@@ -285,6 +316,47 @@ namespace GameActions
         network_append_server_log(text);
     }
 
+    /**
+     * Whether executing an action of this type can change the footpath network, the entrances guests walk to or what
+     * kind of ride a track belongs to, which invalidates the pathfinding caches.
+     */
+    static bool AffectsFootpathNetwork(GameCommand type)
+    {
+        switch (type)
+        {
+            case GameCommand::PlacePath:
+            case GameCommand::PlacePathFromTrack:
+            case GameCommand::RemovePath:
+            case GameCommand::PlaceFootpathAddition:
+            case GameCommand::RemoveFootpathAddition:
+            case GameCommand::PlaceBanner:
+            case GameCommand::RemoveBanner:
+            case GameCommand::SetBannerStyle:
+            case GameCommand::PlaceRideEntranceOrExit:
+            case GameCommand::RemoveRideEntranceOrExit:
+            case GameCommand::PlaceParkEntrance:
+            case GameCommand::RemoveParkEntrance:
+            case GameCommand::PlaceTrack:
+            case GameCommand::RemoveTrack:
+            case GameCommand::DemolishRide:
+            case GameCommand::SetRideSetting:
+            case GameCommand::PlaceTrackDesign:
+            case GameCommand::PlaceMazeDesign:
+            case GameCommand::SetMazeTrack:
+            case GameCommand::ClearScenery:
+            case GameCommand::SetLandHeight:
+            case GameCommand::RaiseLand:
+            case GameCommand::LowerLand:
+            case GameCommand::EditLandSmooth:
+            case GameCommand::ModifyTile:
+            case GameCommand::ChangeMapSize:
+            case GameCommand::Cheat:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     static GameActions::Result ExecuteInternal(const GameAction* action, bool topLevel)
     {
         Guard::ArgumentNotNull(action);
@@ -331,6 +403,11 @@ namespace GameActions
                         log_verbose("[%s] GameAction::Execute %s (Out)", GetRealm(), action->GetName());
                         network_send_game_action(action);
 
+                        if (gConfigNetwork.speculative_placement)
+                        {
+                            scenery_speculate_placement(*action);
+                        }
+
                         return result;
                     }
                 }
@@ -353,6 +430,9 @@ namespace GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+
+            // Actions may change elements in place, also when they fail part way.
+            map_bump_elements_revision();
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
@@ -364,6 +444,12 @@ namespace GameActions
 
             LogActionFinish(logContext, action, result);
 
+            if (result.Error == GameActions::Status::Ok && !(flags & GAME_COMMAND_FLAG_GHOST)
+                && AffectsFootpathNetwork(action->GetType()))
+            {
+                PathfindInvalidateCaches();
+            }
+
             // If not top level just give away the result.
             if (!topLevel)
                 return result;
@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace GameActions
 {
@@ -279,8 +280,10 @@ namespace GameActions
 
     void Enqueue(const GameAction* ga, uint32_t tick);
     void Enqueue(GameAction::Ptr&& ga, uint32_t tick);
+    void Enqueue(std::vector<GameAction::Ptr>&& actions, uint32_t tick);
     void ProcessQueue();
     void ClearQueue();
+    size_t GetQueueSize();
 
     GameAction::Ptr Create(GameCommand id);
     GameAction::Ptr Clone(const GameAction* action);
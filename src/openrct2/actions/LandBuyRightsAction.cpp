@@ -55,6 +55,7 @@ GameActions::Result LandBuyRightsAction::Query() const
 
 GameActions::Result LandBuyRightsAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return QueryExecute(true);
 }
 
@@ -93,10 +94,6 @@ GameActions::Result LandBuyRightsAction::QueryExecute(bool isExecuting) const
             }
         }
     }
-    if (isExecuting)
-    {
-        map_count_remaining_land_rights();
-    }
     return res;
 }
 
@@ -132,7 +129,7 @@ GameActions::Result LandBuyRightsAction::map_buy_land_rights_for_tile(const Coor
             }
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(OWNERSHIP_OWNED);
+                map_set_surface_ownership(surfaceElement, OWNERSHIP_OWNED);
                 update_park_fences_around_tile(loc);
             }
             res.Cost = gLandPrice;
@@ -153,7 +150,7 @@ GameActions::Result LandBuyRightsAction::map_buy_land_rights_for_tile(const Coor
 
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
+                map_set_surface_ownership(surfaceElement, surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 map_invalidate_tile({ loc, baseZ, baseZ + 16 });
             }
@@ -50,6 +50,7 @@ GameActions::Result LandLowerAction::Query() const
 
 GameActions::Result LandLowerAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return QueryExecute(true);
 }
 
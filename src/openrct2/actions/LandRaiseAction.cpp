@@ -51,6 +51,7 @@ GameActions::Result LandRaiseAction::Query() const
 
 GameActions::Result LandRaiseAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return QueryExecute(true);
 }
 
@@ -60,6 +60,7 @@ GameActions::Result LandSetRightsAction::Query() const
 
 GameActions::Result LandSetRightsAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return QueryExecute(true);
 }
 
@@ -97,7 +98,6 @@ GameActions::Result LandSetRightsAction::QueryExecute(bool isExecuting) const
 
     if (isExecuting)
     {
-        map_count_remaining_land_rights();
         OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::PlaceItem, centre);
     }
     return res;
@@ -118,15 +118,16 @@ GameActions::Result LandSetRightsAction::map_buy_land_rights_for_tile(const Coor
         case LandSetRightSetting::UnownLand:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(
-                    surfaceElement->GetOwnership() & ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED));
+                map_set_surface_ownership(
+                    surfaceElement, surfaceElement->GetOwnership() & ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED));
                 update_park_fences_around_tile(loc);
             }
             return res;
         case LandSetRightSetting::UnownConstructionRights:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() & ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
+                map_set_surface_ownership(
+                    surfaceElement, surfaceElement->GetOwnership() & ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 map_invalidate_tile({ loc, baseZ, baseZ + 16 });
             }
@@ -134,7 +135,7 @@ GameActions::Result LandSetRightsAction::map_buy_land_rights_for_tile(const Coor
         case LandSetRightSetting::SetForSale:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() | OWNERSHIP_AVAILABLE);
+                map_set_surface_ownership(surfaceElement, surfaceElement->GetOwnership() | OWNERSHIP_AVAILABLE);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 map_invalidate_tile({ loc, baseZ, baseZ + 16 });
             }
@@ -142,7 +143,8 @@ GameActions::Result LandSetRightsAction::map_buy_land_rights_for_tile(const Coor
         case LandSetRightSetting::SetConstructionRightsForSale:
             if (isExecuting)
             {
-                surfaceElement->SetOwnership(surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE);
+                map_set_surface_ownership(
+                    surfaceElement, surfaceElement->GetOwnership() | OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE);
                 uint16_t baseZ = surfaceElement->GetBaseZ();
                 map_invalidate_tile({ loc, baseZ, baseZ + 16 });
             }
@@ -188,7 +190,7 @@ GameActions::Result LandSetRightsAction::map_buy_land_rights_for_tile(const Coor
                             }),
                         gPeepSpawns.end());
                 }
-                surfaceElement->SetOwnership(_ownership);
+                map_set_surface_ownership(surfaceElement, _ownership);
                 update_park_fences_around_tile(loc);
                 gMapLandRightsUpdateSuccess = true;
             }
@@ -52,6 +52,7 @@ GameActions::Result LandSmoothAction::Query() const
 
 GameActions::Result LandSmoothAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return SmoothLand(true);
 }
 
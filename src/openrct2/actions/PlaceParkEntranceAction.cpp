@@ -134,7 +134,7 @@ GameActions::Result PlaceParkEntranceAction::Execute() const
             SurfaceElement* surfaceElement = map_get_surface_element_at(entranceLoc);
             if (surfaceElement != nullptr)
             {
-                surfaceElement->SetOwnership(OWNERSHIP_UNOWNED);
+                map_set_surface_ownership(surfaceElement, OWNERSHIP_UNOWNED);
             }
         }
 
@@ -198,8 +198,7 @@ GameActions::Result RideEntranceExitPlaceAction::Execute() const
     else
     {
         station.Entrance = TileCoordsXYZD(CoordsXYZD{ _loc, z, entranceElement->GetDirection() });
-        station.LastPeepInQueue = EntityId::GetNull();
-        station.QueueLength = 0;
+        ride->QueueClear(_stationNum);
 
         map_animation_create(MAP_ANIMATION_TYPE_RIDE_ENTRANCE, { _loc, z });
     }
@@ -35,6 +35,7 @@
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/Surface.h"
+#include "../world/TileElementsView.h"
 #include "ParkSetLoanAction.h"
 #include "ParkSetParameterAction.h"
 
@@ -378,35 +379,20 @@ void SetCheatAction::SetGrassLength(int32_t length) const
 
 void SetCheatAction::WaterPlants() const
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() == TileElementType::SmallScenery)
-        {
-            it.element->AsSmallScenery()->SetAge(0);
-        }
-    } while (tile_element_iterator_next(&it));
+    OpenRCT2::ForEachMapElement<SmallSceneryElement>(
+        [](const TileCoordsXY&, SmallSceneryElement& sceneryElement) { sceneryElement.SetAge(0); });
 
     gfx_invalidate_screen();
 }
 
 void SetCheatAction::FixVandalism() const
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() != TileElementType::Path)
-            continue;
-
-        if (!(it.element)->AsPath()->HasAddition())
-            continue;
-
-        it.element->AsPath()->SetIsBroken(false);
-    } while (tile_element_iterator_next(&it));
+    OpenRCT2::ForEachMapElement<PathElement>([](const TileCoordsXY&, PathElement& pathElement) {
+        if (pathElement.HasAddition())
+        {
+            pathElement.SetIsBroken(false);
+        }
+    });
 
     gfx_invalidate_screen();
 }
@@ -418,22 +404,14 @@ void SetCheatAction::RemoveLitter() const
         EntityRemove(litter);
     }
 
-    tile_element_iterator it{};
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() != TileElementType::Path)
-            continue;
-
-        auto* path = it.element->AsPath();
-        if (path->HasAddition())
-            continue;
+    OpenRCT2::ForEachMapElement<PathElement>([](const TileCoordsXY&, PathElement& path) {
+        if (path.HasAddition())
+            return;
 
-        auto* pathBitEntry = path->GetAdditionEntry();
+        auto* pathBitEntry = path.GetAdditionEntry();
         if (pathBitEntry != nullptr && pathBitEntry->flags & PATH_BIT_FLAG_IS_BIN)
-            path->SetAdditionStatus(0xFF);
-
-    } while (tile_element_iterator_next(&it));
+            path.SetAdditionStatus(0xFF);
+    });
 
     gfx_invalidate_screen();
 }
@@ -632,8 +610,7 @@ void SetCheatAction::RemoveAllGuests() const
 
         for (auto& station : ride.GetStations())
         {
-            station.QueueLength = 0;
-            station.LastPeepInQueue = EntityId::GetNull();
+            ride.QueueClear(ride.GetStationIndex(&station));
         }
 
         for (auto trainIndex : ride.vehicles)
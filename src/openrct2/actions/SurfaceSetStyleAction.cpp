@@ -151,6 +151,8 @@ GameActions::Result SurfaceSetStyleAction::Execute() const
     res.ErrorTitle = STR_CANT_CHANGE_LAND_TYPE;
     res.Expenditure = ExpenditureType::Landscaping;
 
+    MapInvalidationScope invalidationScope;
+
     auto validRange = ClampRangeWithinMap(_range.Normalise());
     auto xMid = (validRange.GetLeft() + validRange.GetRight()) / 2 + 16;
     auto yMid = (validRange.GetTop() + validRange.GetBottom()) / 2 + 16;
@@ -196,6 +198,7 @@ GameActions::Result SurfaceSetStyleAction::Execute() const
                         surfaceCost += surfaceObject->Price;
 
                         surfaceElement->SetSurfaceStyle(_surfaceStyle);
+                        map_invalidate_tile_updates(coords);
 
                         map_invalidate_tile_full(coords);
                         footpath_remove_litter({ coords, tile_element_height(coords) });
@@ -38,6 +38,7 @@ GameActions::Result WaterLowerAction::Query() const
 
 GameActions::Result WaterLowerAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return QueryExecute(true);
 }
 
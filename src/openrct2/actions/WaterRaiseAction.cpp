@@ -38,6 +38,7 @@ GameActions::Result WaterRaiseAction::Query() const
 
 GameActions::Result WaterRaiseAction::Execute() const
 {
+    MapInvalidationScope invalidationScope;
     return QueryExecute(true);
 }
 
@@ -7,21 +7,116 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../core/Console.hpp"
+#include "../core/String.hpp"
 #include "../interface/Screenshot.h"
 #include "CommandLine.hpp"
 
+#include <cstdlib>
+#include <vector>
+
+static const char* _benchZooms = nullptr;
+static const char* _benchResolutions = nullptr;
+static const char* _benchThreads = nullptr;
+static const char* _benchOutput = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BenchGfxOptions[]
+{
+    { CMDLINE_TYPE_STRING, &_benchZooms,       NAC, "zooms",       "comma separated zoom levels (default: all)"               },
+    { CMDLINE_TYPE_STRING, &_benchResolutions, NAC, "resolutions", "comma separated <width>x<height> or map (default: map)"   },
+    { CMDLINE_TYPE_STRING, &_benchThreads,     NAC, "threads",     "comma separated thread counts, 0 for config (default: 0)" },
+    { CMDLINE_TYPE_STRING, &_benchOutput,      NAC, "output",      "file to write the JSON report to"                         },
+    OptionTableEnd
+};
+// clang-format on
+
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator);
 
 const CommandLineCommand CommandLine::BenchGfxCommands[]{
     // Main commands
-    DefineCommand("", "<file> [iterations count]", nullptr, HandleBenchGfx), CommandTableEnd
+    DefineCommand(
+        "",
+        "<file> [iterations count] [--zooms=<zoom>[,<zoom>...]] [--resolutions=<width>x<height>|map[,...]] "
+        "[--threads=<count>[,<count>...]] [--output=<file>]",
+        BenchGfxOptions, HandleBenchGfx),
+    CommandTableEnd
 };
 
+static bool ParseBenchGfxOptions(GfxBenchOptions& options)
+{
+    if (_benchZooms != nullptr)
+    {
+        for (const auto& value : String::Split(_benchZooms, ","))
+        {
+            const auto zoom = std::atoi(value.c_str());
+            if (zoom < 0 || zoom >= static_cast<int8_t>(ZoomLevel::max()))
+            {
+                Console::Error::WriteLine("Invalid zoom level: %s", value.c_str());
+                return false;
+            }
+            options.Zooms.push_back(ZoomLevel{ static_cast<int8_t>(zoom) });
+        }
+    }
+    if (_benchResolutions != nullptr)
+    {
+        for (const auto& value : String::Split(_benchResolutions, ","))
+        {
+            if (value == "map")
+            {
+                options.Resolutions.emplace_back();
+                continue;
+            }
+            const auto parts = String::Split(value, "x");
+            const auto width = parts.size() == 2 ? std::atoi(parts[0].c_str()) : 0;
+            const auto height = parts.size() == 2 ? std::atoi(parts[1].c_str()) : 0;
+            if (width <= 0 || height <= 0)
+            {
+                Console::Error::WriteLine("Invalid resolution: %s", value.c_str());
+                return false;
+            }
+            options.Resolutions.emplace_back(width, height);
+        }
+    }
+    if (_benchThreads != nullptr)
+    {
+        for (const auto& value : String::Split(_benchThreads, ","))
+        {
+            const auto threads = std::atoi(value.c_str());
+            if (threads < 0)
+            {
+                Console::Error::WriteLine("Invalid thread count: %s", value.c_str());
+                return false;
+            }
+            options.Threads.push_back(threads);
+        }
+    }
+    if (_benchOutput != nullptr)
+    {
+        options.OutputPath = _benchOutput;
+    }
+    return true;
+}
+
 static exitcode_t HandleBenchGfx(CommandLineArgEnumerator* argEnumerator)
 {
-    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
-    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
-    int32_t result = cmdline_for_gfxbench(argv, argc);
+    GfxBenchOptions options;
+    if (!ParseBenchGfxOptions(options))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    // Options have already been parsed, only pass on the positional arguments.
+    const char** args = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    std::vector<const char*> argv;
+    for (int32_t i = 0; i < argEnumerator->GetCount() - argEnumerator->GetIndex(); i++)
+    {
+        if (args[i][0] != '-')
+        {
+            argv.push_back(args[i]);
+        }
+    }
+    int32_t result = cmdline_for_gfxbench(argv.data(), static_cast<int32_t>(argv.size()), options);
     if (result < 0)
     {
         return EXITCODE_FAIL;
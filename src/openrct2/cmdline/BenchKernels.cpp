@@ -0,0 +1,245 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#ifdef USE_BENCHMARK
+
+#    include "../Context.h"
+#    include "../OpenRCT2.h"
+#    include "../core/File.h"
+#    include "../entity/EntityList.h"
+#    include "../entity/EntityRegistry.h"
+#    include "../entity/Guest.h"
+#    include "../peep/GuestPathfinding.h"
+#    include "../platform/Platform.h"
+#    include "../ride/Ride.h"
+#    include "../ride/RideRatings.h"
+#    include "../ride/Vehicle.h"
+#    include "../world/Entrance.h"
+#    include "../world/Map.h"
+
+#    include <benchmark/benchmark.h>
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+using namespace OpenRCT2;
+
+// All benchmarks share one context, each of them loads its park again so they do not see each other's changes.
+static IContext* _context;
+
+using KernelFn = void (*)(benchmark::State& state);
+
+static std::vector<Guest*> GetGuestsInPark()
+{
+    std::vector<Guest*> guests;
+    for (auto* guest : EntityList<Guest>())
+    {
+        if (!guest->OutsideOfPark && guest->State == PeepState::Walking)
+        {
+            guests.push_back(guest);
+        }
+    }
+    return guests;
+}
+
+static void BM_pathfind_choose_direction(benchmark::State& state)
+{
+    auto guests = GetGuestsInPark();
+    if (guests.empty() || gParkEntrances.empty())
+    {
+        state.SkipWithError("Park has no walking guests or no park entrance.");
+        return;
+    }
+
+    // Every guest heads for the first park entrance, as when leaving the park.
+    const auto& entrance = gParkEntrances[0];
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        auto* guest = guests[index];
+        index = (index + 1) % guests.size();
+
+        gPeepPathFindGoalPosition = TileCoordsXYZ(entrance);
+        gPeepPathFindIgnoreForeignQueues = true;
+        gPeepPathFindQueueRideIndex = RideId::GetNull();
+        benchmark::DoNotOptimize(peep_pathfind_choose_direction(TileCoordsXYZ{ guest->NextLoc }, guest));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ride_ratings_update_ride(benchmark::State& state)
+{
+    auto rideManager = GetRideManager();
+    if (rideManager.size() == 0)
+    {
+        state.SkipWithError("Park has no rides.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& ride : rideManager)
+        {
+            ride_ratings_update_ride(ride);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rideManager.size());
+}
+
+static void BM_find_rides_to_go_on(benchmark::State& state)
+{
+    auto guests = GetGuestsInPark();
+    if (guests.empty())
+    {
+        state.SkipWithError("Park has no walking guests.");
+        return;
+    }
+
+    size_t index = 0;
+    for (auto _ : state)
+    {
+        auto* guest = guests[index];
+        index = (index + 1) % guests.size();
+
+        auto rides = guest->FindRidesToGoOn();
+        benchmark::DoNotOptimize(rides);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_vehicle_update_all(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        vehicle_update_all();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_map_update_tiles(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        map_update_tiles();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_entities_checksum(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto checksum = GetAllEntitiesChecksum();
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_kernel(benchmark::State& state, const std::string& path, KernelFn fn)
+{
+    if (!_context->LoadParkFromFile(path))
+    {
+        state.SkipWithError("Failed to load file!");
+        return;
+    }
+    fn(state);
+}
+
+static int CmdlineForBenchKernels(int argc, const char* const* argv)
+{
+    static constexpr std::pair<const char*, KernelFn> Kernels[] = {
+        { "peep_pathfind_choose_direction", BM_pathfind_choose_direction },
+        { "ride_ratings_update_ride", BM_ride_ratings_update_ride },
+        { "Guest::FindRidesToGoOn", BM_find_rides_to_go_on },
+        { "vehicle_update_all", BM_vehicle_update_all },
+        { "map_update_tiles", BM_map_update_tiles },
+        { "GetAllEntitiesChecksum", BM_entities_checksum },
+    };
+
+    // Google benchmark does stuff to argv. It doesn't modify the pointees,
+    // but it wants to reorder the pointers, so present a copy of them.
+    std::vector<char*> argv_for_benchmark;
+
+    // argv[0] is expected to contain the binary name. It's only for logging purposes, don't bother.
+    argv_for_benchmark.push_back(nullptr);
+
+    // Extract file names from argument list. If there is no such file, consider it benchmark option.
+    for (int i = 0; i < argc; i++)
+    {
+        if (File::Exists(argv[i]))
+        {
+            for (const auto& [kernelName, kernelFn] : Kernels)
+            {
+                auto name = std::string(argv[i]) + "/" + kernelName;
+                benchmark::RegisterBenchmark(name.c_str(), BM_kernel, std::string(argv[i]), kernelFn);
+            }
+        }
+        else
+        {
+            argv_for_benchmark.push_back(const_cast<char*>(argv[i]));
+        }
+    }
+    // Update argc with all the changes made
+    argc = static_cast<int>(argv_for_benchmark.size());
+    ::benchmark::Initialize(&argc, &argv_for_benchmark[0]);
+    if (::benchmark::ReportUnrecognizedArguments(argc, &argv_for_benchmark[0]))
+        return -1;
+
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        log_error("Context initialization failed.");
+        return -1;
+    }
+    _context = context.get();
+
+    ::benchmark::RunSpecifiedBenchmarks();
+    _context = nullptr;
+    return 0;
+}
+
+static exitcode_t HandleBenchKernels(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* const* argv = static_cast<const char* const*>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    int32_t result = CmdlineForBenchKernels(argc, argv);
+    if (result < 0)
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+#else
+static exitcode_t HandleBenchKernels(CommandLineArgEnumerator* argEnumerator)
+{
+    log_error("Sorry, Google benchmark not enabled in this build");
+    return EXITCODE_FAIL;
+}
+#endif // USE_BENCHMARK
+
+const CommandLineCommand CommandLine::BenchKernelsCommands[]{
+#ifdef USE_BENCHMARK
+    DefineCommand(
+        "",
+        "<file>... [--benchmark_list_tests={true|false}] [--benchmark_filter=<regex>] [--benchmark_min_time=<min_time>] "
+        "[--benchmark_repetitions=<num_repetitions>] [--benchmark_report_aggregates_only={true|false}] "
+        "[--benchmark_format=<console|json|csv>] [--benchmark_out=<filename>] [--benchmark_out_format=<json|console|csv>] "
+        "[--benchmark_color={auto|true|false}] [--benchmark_counters_tabular={true|false}] [--v=<verbosity>]",
+        nullptr, HandleBenchKernels),
+    CommandTableEnd
+#else
+    DefineCommand("", "*** SORRY NOT ENABLED IN THIS BUILD ***", nullptr, HandleBenchKernels), CommandTableEnd
+#endif // USE_BENCHMARK
+};
@@ -33,6 +33,7 @@
 #    include <benchmark/benchmark.h>
 #    include <cstdint>
 #    include <iterator>
+#    include <string>
 #    include <vector>
 
 static void fixup_pointers(std::vector<RecordedPaintSession>& s)
@@ -132,7 +133,9 @@ static std::vector<RecordedPaintSession> extract_paint_session(std::string_view
 }
 
 // This function is based on benchgfx_render_screenshots
-static void BM_paint_session_arrange(benchmark::State& state, const std::vector<RecordedPaintSession> inputSessions)
+static void BM_paint_session_arrange(
+    benchmark::State& state, const std::vector<RecordedPaintSession> inputSessions,
+    void (*arrangeFn)(PaintSessionCore&))
 {
     auto sessions = inputSessions;
     // Fixing up the pointers continuously is wasteful. Fix it up once for `sessions` and store a copy.
@@ -146,7 +149,7 @@ static void BM_paint_session_arrange(benchmark::State& state, const std::vector<
         state.PauseTiming();
         std::copy_n(local_s, std::size(sessions), sessions.begin());
         state.ResumeTiming();
-        PaintSessionArrange(sessions[0].Session);
+        arrangeFn(sessions[0].Session);
         benchmark::DoNotOptimize(sessions);
     }
     state.SetItemsProcessed(state.iterations() * std::size(sessions));
@@ -166,7 +169,7 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
         {
             quad = reinterpret_cast<paint_struct*>(-1);
         }
-        benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions);
+        benchmark::RegisterBenchmark("baseline", BM_paint_session_arrange, sessions, PaintSessionArrange);
     }
 
     // Google benchmark does stuff to argv. It doesn't modify the pointees,
@@ -184,7 +187,13 @@ static int cmdline_for_bench_sprite_sort(int argc, const char** argv)
             // Register benchmark for sv6 if valid
             std::vector<RecordedPaintSession> sessions = extract_paint_session(argv[i]);
             if (!sessions.empty())
-                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions);
+            {
+                benchmark::RegisterBenchmark(argv[i], BM_paint_session_arrange, sessions, PaintSessionArrange);
+                // The original linked-list implementation, to compare against.
+                auto referenceName = std::string(argv[i]) + " (reference)";
+                benchmark::RegisterBenchmark(
+                    referenceName.c_str(), BM_paint_session_arrange, sessions, PaintSessionArrangeReference);
+            }
         }
         else
         {
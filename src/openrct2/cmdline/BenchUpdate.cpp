@@ -9,21 +9,46 @@
 
 #include "CommandLine.hpp"
 
+#include "../Context.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../actions/GuestSetNameAction.h"
+#include "../actions/RideSetPriceAction.h"
+#include "../actions/SetCheatAction.h"
+#include "../actions/SetParkEntranceFeeAction.h"
+#include "../actions/StaffHireNewAction.h"
+#include "../core/Console.hpp"
+#include "../core/DataSerialiser.h"
+#include "../core/File.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../entity/EntityList.h"
+#include "../entity/EntityRegistry.h"
+#include "../entity/Guest.h"
+#include "../entity/Staff.h"
+#include "../network/NetworkPacket.h"
+#include "../platform/Platform.h"
+#include "../ride/Ride.h"
+#include "../world/Park.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
 #ifdef USE_BENCHMARK
 
-#    include "../Context.h"
-#    include "../GameState.h"
-#    include "../OpenRCT2.h"
-#    include "../core/File.h"
-#    include "../platform/Platform.h"
+#    include "../profiling/Profiling.h"
+#    include "../ride/RideRatings.h"
 
 #    include <benchmark/benchmark.h>
-#    include <cstdint>
 #    include <iterator>
-#    include <numeric>
-#    include <vector>
-
-using namespace OpenRCT2;
 
 static void BM_update(benchmark::State& state, const std::string& filename)
 {
@@ -35,9 +60,12 @@ static void BM_update(benchmark::State& state, const std::string& filename)
             state.SkipWithError("Failed to load file!");
         }
 
+        ride_ratings_reset_proximity_cache_stats();
+
         std::vector<LogicTimings> timings(1);
         timings.reserve(100);
         int currentTimingIdx = 0;
+        const auto allocationsBefore = Profiling::GetThreadAllocations();
         for (auto _ : state)
         {
             if (timings[currentTimingIdx].CurrentIdx == (LOGIC_UPDATE_MEASUREMENTS_COUNT - 1))
@@ -49,14 +77,26 @@ static void BM_update(benchmark::State& state, const std::string& filename)
             context->GetGameState()->UpdateLogic(timingToUse);
         }
         state.SetItemsProcessed(state.iterations());
-        auto accumulator = [timings](LogicTimePart part) -> double {
-            std::chrono::duration<double> timesum;
+        if (Profiling::IsAllocationTrackingEnabled())
+        {
+            // Only counts the allocations made on the benchmark thread.
+            const auto allocationsAfter = Profiling::GetThreadAllocations();
+            state.counters["Allocations"] = benchmark::Counter(
+                static_cast<double>(allocationsAfter.Count - allocationsBefore.Count), benchmark::Counter::kAvgIterations);
+            state.counters["AllocatedBytes"] = benchmark::Counter(
+                static_cast<double>(allocationsAfter.Bytes - allocationsBefore.Bytes), benchmark::Counter::kAvgIterations);
+        }
+        auto accumulator = [&timings](LogicTimePart part) -> double {
+            // Entries that have not been written yet are zero for every part and add nothing.
+            std::chrono::duration<double, std::milli> timesum{};
             for (const auto& timing : timings)
             {
-                timesum = std::accumulate(
-                    timing.TimingInfo.at(part).begin(), timing.TimingInfo.at(part).end(), std::chrono::duration<double>());
+                for (size_t i = 0; i < LOGIC_UPDATE_MEASUREMENTS_COUNT; i++)
+                {
+                    timesum += timing.GetPartTime(part, i);
+                }
             }
-            return std::chrono::duration_cast<std::chrono::milliseconds>(timesum).count();
+            return timesum.count();
         };
         state.counters["NetworkUpdateAcc_ms"] = accumulator(LogicTimePart::NetworkUpdate);
         state.counters["DateAcc_ms"] = accumulator(LogicTimePart::Date);
@@ -80,6 +120,10 @@ static void BM_update(benchmark::State& state, const std::string& filename)
         state.counters["GameActionsAcc_ms"] = accumulator(LogicTimePart::GameActions);
         state.counters["NetworkFlushAcc_ms"] = accumulator(LogicTimePart::NetworkFlush);
         state.counters["ScriptsAcc_ms"] = accumulator(LogicTimePart::Scripts);
+
+        auto proximityCacheStats = ride_ratings_get_proximity_cache_stats();
+        state.counters["RideRatingsProximityCacheHits"] = static_cast<double>(proximityCacheStats.Hits);
+        state.counters["RideRatingsProximityCacheMisses"] = static_cast<double>(proximityCacheStats.Misses);
     }
     else
     {
@@ -145,7 +189,430 @@ static exitcode_t HandleBenchUpdate(CommandLineArgEnumerator* argEnumerator)
 }
 #endif // USE_BENCHMARK
 
+static const char* _reportTicks = nullptr;
+static const char* _reportOutput = nullptr;
+static const char* _reportBaseline = nullptr;
+static float _reportTolerance = 10.0f;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BenchReportOptions[]
+{
+    { CMDLINE_TYPE_STRING, &_reportTicks,     NAC, "ticks",     "comma separated tick counts to run each park for (default: 1000)" },
+    { CMDLINE_TYPE_STRING, &_reportOutput,    NAC, "output",    "file to write the JSON report to instead of the console"         },
+    { CMDLINE_TYPE_STRING, &_reportBaseline,  NAC, "baseline",  "JSON report to compare against, fails on regressions"            },
+    { CMDLINE_TYPE_REAL,   &_reportTolerance, NAC, "tolerance", "allowed slowdown against the baseline in percent (default: 10)"  },
+    OptionTableEnd
+};
+// clang-format on
+
+static json_t GetSampleStats(std::vector<double>& samples)
+{
+    json_t stats = json_t::object();
+    if (samples.empty())
+    {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const auto percentile = [&samples](double fraction) {
+        return samples[std::min(static_cast<size_t>(fraction * samples.size()), samples.size() - 1)];
+    };
+    double total = 0;
+    for (auto sample : samples)
+    {
+        total += sample;
+    }
+    stats["total_ms"] = total;
+    stats["mean_ms"] = total / samples.size();
+    stats["p50_ms"] = percentile(0.50);
+    stats["p95_ms"] = percentile(0.95);
+    stats["p99_ms"] = percentile(0.99);
+    return stats;
+}
+
+static bool RunBenchReport(IContext& context, const std::string& path, uint32_t ticks, json_t& result)
+{
+    if (!context.LoadParkFromFile(path))
+    {
+        Console::Error::WriteLine("Failed to load park: %s", path.c_str());
+        return false;
+    }
+
+    LogicTimings timings;
+    std::vector<double> tickTimes;
+    std::vector<std::vector<double>> partTimes(std::size(LogicTimePartNames));
+    tickTimes.reserve(ticks);
+    for (auto& times : partTimes)
+    {
+        times.reserve(ticks);
+    }
+
+    auto* gameState = context.GetGameState();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        gameState->UpdateLogic(&timings);
+        const std::chrono::duration<double, std::milli> tickTime = std::chrono::high_resolution_clock::now() - startTime;
+        tickTimes.push_back(tickTime.count());
+
+        const auto index = (timings.CurrentIdx + LOGIC_UPDATE_MEASUREMENTS_COUNT - 1) % LOGIC_UPDATE_MEASUREMENTS_COUNT;
+        for (size_t part = 0; part < std::size(LogicTimePartNames); part++)
+        {
+            const std::chrono::duration<double, std::milli> partTime = timings.GetPartTime(
+                LogicTimePartNames[part].first, index);
+            partTimes[part].push_back(partTime.count());
+        }
+    }
+
+    result["park"] = Path::GetFileName(path);
+    result["ticks"] = ticks;
+    result["overruns"] = timings.Overruns;
+    result["tick"] = GetSampleStats(tickTimes);
+    json_t parts = json_t::object();
+    for (size_t part = 0; part < std::size(LogicTimePartNames); part++)
+    {
+        if (timings.TimingInfo.find(LogicTimePartNames[part].first) != timings.TimingInfo.end())
+        {
+            parts[LogicTimePartNames[part].second] = GetSampleStats(partTimes[part]);
+        }
+    }
+    result["parts"] = parts;
+    return true;
+}
+
+/**
+ * Compares the results with the runs of the same parks and tick counts in the baseline. Only the tick times are
+ * gated on, the parts of the update are listed to point out where a regression comes from.
+ */
+static bool CompareBenchReport(const json_t& results, const json_t& baseline, double tolerance)
+{
+    const auto isSlower = [tolerance](const json_t& stats, const json_t& baselineStats, const char* key) {
+        const auto value = Json::GetNumber<double>(stats[key]);
+        const auto baselineValue = Json::GetNumber<double>(baselineStats[key]);
+        return baselineValue > 0 && value > baselineValue * (1.0 + tolerance / 100.0);
+    };
+
+    bool passed = true;
+    for (const auto& result : results)
+    {
+        auto it = std::find_if(baseline.begin(), baseline.end(), [&result](const json_t& baselineResult) {
+            return baselineResult["park"] == result["park"] && baselineResult["ticks"] == result["ticks"];
+        });
+        if (it == baseline.end())
+        {
+            Console::WriteLine(
+                "%s (%u ticks): not in baseline", result["park"].get<std::string>().c_str(), result["ticks"].get<uint32_t>());
+            continue;
+        }
+
+        const auto& baselineResult = *it;
+        for (const char* key : { "mean_ms", "p95_ms" })
+        {
+            const auto value = Json::GetNumber<double>(result["tick"][key]);
+            const auto baselineValue = Json::GetNumber<double>(baselineResult["tick"][key]);
+            const bool regressed = isSlower(result["tick"], baselineResult["tick"], key);
+            Console::WriteLine(
+                "%s (%u ticks): tick %s %.4f, baseline %.4f%s", result["park"].get<std::string>().c_str(),
+                result["ticks"].get<uint32_t>(), key, value, baselineValue, regressed ? " REGRESSED" : "");
+            passed &= !regressed;
+        }
+
+        for (const auto& [part, name] : LogicTimePartNames)
+        {
+            const auto& stats = result["parts"].value(name, json_t::object());
+            const auto& baselineStats = baselineResult["parts"].value(name, json_t::object());
+            if (isSlower(stats, baselineStats, "mean_ms"))
+            {
+                Console::WriteLine(
+                    "    %s mean_ms %.4f, baseline %.4f", name, Json::GetNumber<double>(stats["mean_ms"]),
+                    Json::GetNumber<double>(baselineStats["mean_ms"]));
+            }
+        }
+    }
+    return passed;
+}
+
+static exitcode_t HandleBenchReport(CommandLineArgEnumerator* argEnumerator)
+{
+    std::vector<std::string> parks;
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument))
+    {
+        // Options have already been parsed.
+        if (argument[0] == '-')
+        {
+            break;
+        }
+        parks.emplace_back(argument);
+    }
+    if (parks.empty())
+    {
+        Console::Error::WriteLine("Missing arguments <file>...");
+        return EXITCODE_FAIL;
+    }
+
+    std::vector<uint32_t> tickCounts;
+    for (const auto& value : String::Split(_reportTicks != nullptr ? _reportTicks : "1000", ","))
+    {
+        const auto ticks = std::strtoul(value.c_str(), nullptr, 10);
+        if (ticks == 0)
+        {
+            Console::Error::WriteLine("Invalid tick count: %s", value.c_str());
+            return EXITCODE_FAIL;
+        }
+        tickCounts.push_back(static_cast<uint32_t>(ticks));
+    }
+
+    json_t baseline;
+    if (_reportBaseline != nullptr)
+    {
+        try
+        {
+            baseline = Json::ReadFromFile(_reportBaseline).value("results", json_t::array());
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("Failed to read baseline: %s", e.what());
+            return EXITCODE_FAIL;
+        }
+    }
+
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    json_t results = json_t::array();
+    for (const auto& park : parks)
+    {
+        for (auto ticks : tickCounts)
+        {
+            json_t result;
+            if (!RunBenchReport(*context, park, ticks, result))
+            {
+                return EXITCODE_FAIL;
+            }
+            results.push_back(result);
+        }
+    }
+
+    const json_t report = { { "results", results } };
+    if (_reportOutput != nullptr)
+    {
+        Json::WriteToFile(_reportOutput, report);
+    }
+    else
+    {
+        Console::WriteLine("%s", report.dump(4).c_str());
+    }
+
+    if (_reportBaseline != nullptr && !CompareBenchReport(results, baseline, _reportTolerance))
+    {
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+static int32_t _loadGuests = 0;
+static int32_t _loadStaff = 0;
+static int32_t _loadBots = 0;
+static int32_t _loadBotInterval = 40;
+static int32_t _loadTicks = 1000;
+static const char* _loadOutput = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition BenchLoadOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_loadGuests,      NAC, "guests",       "number of guests to add to the park"                     },
+    { CMDLINE_TYPE_INTEGER, &_loadStaff,       NAC, "staff",        "number of staff to hire"                                 },
+    { CMDLINE_TYPE_INTEGER, &_loadBots,        NAC, "bots",         "number of simulated players issuing game actions"        },
+    { CMDLINE_TYPE_INTEGER, &_loadBotInterval, NAC, "bot-interval", "ticks between the actions of each player (default: 40)"  },
+    { CMDLINE_TYPE_INTEGER, &_loadTicks,       NAC, "ticks",        "number of ticks to run for (default: 1000)"              },
+    { CMDLINE_TYPE_STRING,  &_loadOutput,      NAC, "output",       "file to write the JSON report to instead of the console" },
+    OptionTableEnd
+};
+// clang-format on
+
+/**
+ * Number of bytes an action takes up in a game action packet, see NetworkBase::AddToGameActionBatch.
+ */
+static size_t GetBatchedActionSize(const GameAction& action)
+{
+    DataSerialiser stream(true);
+    action.Serialise(stream);
+    return sizeof(uint32_t) + sizeof(uint32_t) + stream.GetStream().GetLength();
+}
+
+/**
+ * Creates the next game action of a simulated player. The mix resembles what players of a running server do most, the
+ * actions only touch what the park already has so they can be issued indefinitely.
+ */
+static GameAction::Ptr CreateBotAction(std::mt19937& rng, const std::vector<RideId>& rides, const std::vector<EntityId>& guests)
+{
+    switch (rng() % 3)
+    {
+        case 0:
+            if (!rides.empty())
+            {
+                const auto rideId = rides[rng() % rides.size()];
+                const auto* ride = get_ride(rideId);
+                if (ride != nullptr)
+                {
+                    const auto price = static_cast<money16>(ride->price[0] + ((rng() % 2) != 0 ? 10 : -10));
+                    return std::make_unique<RideSetPriceAction>(rideId, std::clamp<money16>(price, 0, 200), true);
+                }
+            }
+            break;
+        case 1:
+            if (!guests.empty())
+            {
+                const auto guestId = guests[rng() % guests.size()];
+                return std::make_unique<GuestSetNameAction>(guestId, "Guest " + std::to_string(rng() % 10000));
+            }
+            break;
+    }
+    return std::make_unique<SetParkEntranceFeeAction>(static_cast<money16>((rng() % 10) * 10));
+}
+
+static exitcode_t HandleBenchLoad(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* path;
+    if (!argEnumerator->TryPopString(&path) || path[0] == '-')
+    {
+        Console::Error::WriteLine("Missing argument <file>.");
+        return EXITCODE_FAIL;
+    }
+    if (_loadGuests < 0 || _loadStaff < 0 || _loadBots < 0 || _loadBotInterval <= 0 || _loadTicks <= 0)
+    {
+        Console::Error::WriteLine("Invalid load parameters.");
+        return EXITCODE_FAIL;
+    }
+
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(path))
+    {
+        Console::Error::WriteLine("Failed to load park: %s", path);
+        return EXITCODE_FAIL;
+    }
+
+    // Scale the park up the same way players would, the cheat adds at most 10000 guests at a time.
+    for (int32_t remaining = _loadGuests; remaining > 0; remaining -= 10000)
+    {
+        auto action = SetCheatAction(CheatType::GenerateGuests, std::min(remaining, 10000));
+        GameActions::Execute(&action);
+    }
+    for (int32_t i = 0; i < _loadStaff; i++)
+    {
+        const auto staffType = static_cast<StaffType>(i % EnumValue(StaffType::Count));
+        auto action = StaffHireNewAction(true, staffType, EntertainerCostume::Panda, 0);
+        GameActions::Execute(&action);
+    }
+
+    std::vector<RideId> rides;
+    for (const auto& ride : GetRideManager())
+    {
+        rides.push_back(ride.id);
+    }
+    std::vector<EntityId> guests;
+    for (auto* guest : EntityList<Guest>())
+    {
+        guests.push_back(guest->sprite_index);
+    }
+
+    // Without clients to connect, the traffic is derived from the packets the server would send to each client: a tick
+    // packet every tick, a sprite checksum every 100 ticks and one game action packet for each tick with actions. The
+    // players' actions are relayed to every client, the player that sent them included.
+    constexpr size_t TickPacketSize = sizeof(PacketHeader) + sizeof(uint32_t) * 3;
+    constexpr size_t ActionPacketSize = sizeof(PacketHeader) + sizeof(uint32_t) * 2;
+    const size_t checksumSize = EntitiesChecksum{}.ToString().size() + 1;
+    size_t downloadBytes = 0;
+    std::vector<size_t> uploadBytes(_loadBots);
+    size_t actionCount = 0;
+
+    std::mt19937 rng(0);
+    std::vector<double> tickTimes;
+    tickTimes.reserve(_loadTicks);
+    auto* gameState = context->GetGameState();
+    for (int32_t tick = 0; tick < _loadTicks; tick++)
+    {
+        size_t actionBytes = 0;
+        for (int32_t bot = 0; bot < _loadBots; bot++)
+        {
+            // Spread the players over the interval rather than have all of them act on the same tick.
+            if ((tick + bot) % _loadBotInterval != 0)
+            {
+                continue;
+            }
+            auto action = CreateBotAction(rng, rides, guests);
+            const auto size = GetBatchedActionSize(*action);
+            uploadBytes[bot] += ActionPacketSize + size;
+            actionBytes += size;
+            actionCount++;
+            GameActions::Enqueue(std::move(action), gCurrentTicks);
+        }
+        downloadBytes += TickPacketSize + ((tick % 100) == 0 ? checksumSize : 0);
+        if (actionBytes != 0)
+        {
+            downloadBytes += ActionPacketSize + actionBytes;
+        }
+
+        const auto startTime = std::chrono::high_resolution_clock::now();
+        gameState->UpdateLogic();
+        const std::chrono::duration<double, std::milli> tickTime = std::chrono::high_resolution_clock::now() - startTime;
+        tickTimes.push_back(tickTime.count());
+    }
+
+    const double seconds = static_cast<double>(_loadTicks) / GAME_UPDATE_FPS;
+    size_t totalUploadBytes = 0;
+    for (auto bytes : uploadBytes)
+    {
+        totalUploadBytes += bytes;
+    }
+
+    json_t result;
+    result["park"] = Path::GetFileName(path);
+    result["ticks"] = _loadTicks;
+    result["guests"] = GetEntityListCount(EntityType::Guest);
+    result["staff"] = GetEntityListCount(EntityType::Staff);
+    result["rides"] = rides.size();
+    result["bots"] = _loadBots;
+    result["actions"] = actionCount;
+    result["tick"] = GetSampleStats(tickTimes);
+    result["download_bytes_per_second_per_client"] = downloadBytes / seconds;
+    result["upload_bytes_per_second_per_bot"] = _loadBots > 0 ? totalUploadBytes / seconds / _loadBots : 0.0;
+
+    if (_loadOutput != nullptr)
+    {
+        Json::WriteToFile(_loadOutput, result);
+    }
+    else
+    {
+        Console::WriteLine("%s", result.dump(4).c_str());
+    }
+    return EXITCODE_OK;
+}
+
 const CommandLineCommand CommandLine::BenchUpdateCommands[]{
+    DefineCommand(
+        "report", "<file>... [--ticks=<ticks>[,<ticks>...]] [--output=<file>] [--baseline=<file>] [--tolerance=<percent>]",
+        BenchReportOptions, HandleBenchReport),
+    DefineCommand(
+        "load", "<file> [--guests=<count>] [--staff=<count>] [--bots=<count>] [--bot-interval=<ticks>] [--ticks=<ticks>] "
+        "[--output=<file>]",
+        BenchLoadOptions, HandleBenchLoad),
 #ifdef USE_BENCHMARK
     DefineCommand(
         "",
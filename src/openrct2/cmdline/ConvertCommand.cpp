@@ -13,15 +13,29 @@
 #include "../ParkImporter.h"
 #include "../common.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/FileStream.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
+#include "../core/Timer.hpp"
 #include "../interface/Window.h"
 #include "../object/ObjectManager.h"
 #include "../park/ParkFile.h"
+#include "../platform/Platform.h"
 #include "../scenario/Scenario.h"
 #include "CommandLine.hpp"
 
+#include <future>
 #include <memory>
+#include <utility>
+#include <vector>
 
+static void ConvertPark(
+    IObjectManager& objManager, const std::string& sourcePath, FileExtension sourceFileType, OpenRCT2::IStream& sourceStream,
+    const std::string& destinationPath);
+static bool IsBatchSource(const std::string& sourcePath);
+static exitcode_t HandleCommandConvertBatch(const std::string& sourcePath, const std::string& destinationPath);
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType);
 static u8string GetFileTypeFriendlyName(FileExtension fileType);
 
@@ -53,6 +67,11 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     }
 
     const auto destinationPath = Path::GetAbsolute(rawDestinationPath);
+    if (IsBatchSource(sourcePath))
+    {
+        return HandleCommandConvertBatch(sourcePath, destinationPath);
+    }
+
     auto destinationFileType = get_file_extension_type(destinationPath.c_str());
 
     // Validate target type
@@ -93,12 +112,8 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
 
     try
     {
-        auto importer = ParkImporter::Create(sourcePath);
-        auto loadResult = importer->Load(sourcePath.c_str());
-
-        objManager.LoadObjects(loadResult.RequiredObjects);
-
-        importer->Import();
+        auto fs = OpenRCT2::FileStream(sourcePath, OpenRCT2::FILE_MODE_OPEN);
+        ConvertPark(objManager, sourcePath, sourceFileType, fs, destinationPath);
     }
     catch (const std::exception& ex)
     {
@@ -106,30 +121,128 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
         return EXITCODE_FAIL;
     }
 
-    if (sourceFileType == FileExtension::SC4 || sourceFileType == FileExtension::SC6)
+    Console::WriteLine("Conversion successful!");
+    return EXITCODE_OK;
+}
+
+static void ConvertPark(
+    IObjectManager& objManager, const std::string& sourcePath, FileExtension sourceFileType, OpenRCT2::IStream& sourceStream,
+    const std::string& destinationPath)
+{
+    auto isScenario = sourceFileType == FileExtension::SC4 || sourceFileType == FileExtension::SC6;
+
+    auto importer = ParkImporter::Create(sourcePath);
+    auto loadResult = importer->LoadFromStream(&sourceStream, isScenario, false, sourcePath.c_str());
+
+    objManager.LoadObjects(loadResult.RequiredObjects);
+
+    importer->Import();
+
+    if (isScenario)
     {
         // We are converting a scenario, so reset the park
         scenario_begin();
     }
 
-    try
-    {
-        auto exporter = std::make_unique<ParkFileExporter>();
+    auto exporter = std::make_unique<ParkFileExporter>();
+
+    // HACK remove the main window so it saves the park with the
+    //      correct initial view
+    window_close_by_class(WC_MAIN_WINDOW);
+
+    exporter->Export(destinationPath);
+}
 
-        // HACK remove the main window so it saves the park with the
-        //      correct initial view
-        window_close_by_class(WC_MAIN_WINDOW);
+static bool IsBatchSource(const std::string& sourcePath)
+{
+    return Path::DirectoryExists(sourcePath) || sourcePath.find_first_of("*?") != std::string::npos;
+}
 
-        exporter->Export(destinationPath);
+/**
+ * Converts every legacy park matched by the source directory or wildcard pattern to a .park file in the destination
+ * directory. The context and object repository are only initialised once for the whole batch. Parks are imported into
+ * the global game state, so the conversions themselves run one after another while the next source file is read in
+ * the background.
+ */
+static exitcode_t HandleCommandConvertBatch(const std::string& sourcePath, const std::string& destinationPath)
+{
+    std::string pattern;
+    bool recurse;
+    if (Path::DirectoryExists(sourcePath))
+    {
+        pattern = Path::Combine(sourcePath, "*.sc4;*.sv4;*.sc6;*.sv6");
+        recurse = true;
     }
-    catch (const std::exception& ex)
+    else
     {
-        Console::Error::WriteLine(ex.what());
+        pattern = sourcePath;
+        recurse = false;
+    }
+
+    // Collect the files up front so the next one can be read while the current one is being converted.
+    std::vector<std::pair<std::string, std::string>> files;
+    auto scanner = Path::ScanDirectory(pattern, recurse);
+    while (scanner->Next())
+    {
+        auto relativeDestination = Path::WithExtension(scanner->GetPathRelative(), ".park");
+        files.emplace_back(scanner->GetPath(), Path::Combine(destinationPath, relativeDestination));
+    }
+    if (files.empty())
+    {
+        Console::Error::WriteLine("No .SC4, .SV4, .SC6 or .SV6 files found in '%s'.", sourcePath.c_str());
         return EXITCODE_FAIL;
     }
 
-    Console::WriteLine("Conversion successful!");
-    return EXITCODE_OK;
+    gOpenRCT2Headless = true;
+    auto context = OpenRCT2::CreateContext();
+    context->Initialise();
+
+    auto& objManager = context->GetObjectManager();
+
+    auto readFile = [](const std::string& path) { return File::ReadAllBytes(path); };
+    auto nextData = std::async(std::launch::async, readFile, files[0].first);
+
+    OpenRCT2::Timer timer;
+    size_t numConverted = 0;
+    uint64_t totalBytes = 0;
+    for (size_t i = 0; i < files.size(); i++)
+    {
+        const auto& [filePath, fileDestinationPath] = files[i];
+        try
+        {
+            auto data = nextData.get();
+            if (i + 1 < files.size())
+            {
+                nextData = std::async(std::launch::async, readFile, files[i + 1].first);
+            }
+
+            Platform::EnsureDirectoryExists(Path::GetDirectory(fileDestinationPath));
+
+            OpenRCT2::MemoryStream ms(data.data(), data.size());
+            auto fileType = get_file_extension_type(filePath.c_str());
+            ConvertPark(objManager, filePath, fileType, ms, fileDestinationPath);
+
+            Console::WriteLine("Converted %s", filePath.c_str());
+            numConverted++;
+            totalBytes += data.size();
+        }
+        catch (const std::exception& ex)
+        {
+            Console::Error::WriteLine("Unable to convert %s: %s", filePath.c_str(), ex.what());
+            if (i + 1 < files.size() && !nextData.valid())
+            {
+                nextData = std::async(std::launch::async, readFile, files[i + 1].first);
+            }
+        }
+    }
+
+    auto elapsed = timer.GetElapsedTime().count();
+    auto numFailed = files.size() - numConverted;
+    Console::WriteLine(
+        "Converted %zu of %zu parks in %.2f seconds (%.1f parks/s, %.1f MiB/s), %zu failed.", numConverted, files.size(),
+        elapsed, elapsed > 0 ? numConverted / elapsed : 0.0f, elapsed > 0 ? (totalBytes / (1024.0f * 1024.0f)) / elapsed : 0.0f,
+        numFailed);
+    return numFailed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
 }
 
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType)
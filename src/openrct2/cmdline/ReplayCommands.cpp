@@ -0,0 +1,258 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "CommandLine.hpp"
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../core/FileScanner.h"
+#include "../core/Json.hpp"
+#include "../core/Path.hpp"
+#include "../core/String.hpp"
+#include "../platform/Platform.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static int32_t _verifyJobs = 0;
+static const char* _verifyOutput = nullptr;
+
+// clang-format off
+static constexpr const CommandLineOptionDefinition ReplayVerifyOptions[]
+{
+    { CMDLINE_TYPE_INTEGER, &_verifyJobs,   NAC, "jobs",   "number of replays to verify at once (default: number of cores)" },
+    { CMDLINE_TYPE_STRING,  &_verifyOutput, NAC, "output", "file to write the JSON summary to instead of the console"       },
+    OptionTableEnd
+};
+// clang-format on
+
+static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator);
+static exitcode_t HandleReplayRun(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::ReplayCommands[]{
+    DefineCommand("verify", "<file|directory>... [--jobs=<count>] [--output=<file>]", ReplayVerifyOptions, HandleReplayVerify),
+    DefineCommand("run", "<file>", nullptr, HandleReplayRun),
+    CommandTableEnd
+};
+
+/**
+ * Plays back the replay as fast as possible in a context of its own and reports whether its state matched the
+ * recording throughout.
+ */
+static json_t RunReplay(const std::string& path)
+{
+    json_t result;
+    result["replay"] = path;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        result["error"] = "Context initialization failed.";
+        return result;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+    if (!replayManager->StartPlayback(path))
+    {
+        result["error"] = "Failed to start playback.";
+        return result;
+    }
+
+    auto* gameState = context->GetGameState();
+    uint32_t ticks = 0;
+    bool mismatch = false;
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    while (replayManager->IsReplaying())
+    {
+        gameState->UpdateLogic();
+        ticks++;
+        if (replayManager->IsPlaybackStateMismatching())
+        {
+            mismatch = true;
+            break;
+        }
+    }
+    const std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - startTime;
+
+    result["ticks"] = ticks;
+    result["mismatch"] = mismatch;
+    if (mismatch)
+    {
+        result["mismatch_tick"] = gCurrentTicks;
+    }
+    result["ticks_per_second"] = duration.count() > 0 ? ticks / duration.count() : 0.0;
+    return result;
+}
+
+/**
+ * Verifies the replay in a child process, as the game state of a process can only be used for one replay at a time.
+ * The child prints its result as the last line of its output.
+ */
+static json_t RunReplayProcess(const std::string& executablePath, const std::string& path)
+{
+    std::string output;
+    const auto command = String::StdFormat("\"%s\" replay run \"%s\"", executablePath.c_str(), path.c_str());
+    const auto exitCode = Platform::Execute(command, &output);
+
+    const auto lineStart = output.find_last_of('\n');
+    const auto lastLine = lineStart == std::string::npos ? output : output.substr(lineStart + 1);
+    try
+    {
+        auto result = Json::FromString(lastLine);
+        if (result.is_object())
+        {
+            return result;
+        }
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    json_t result;
+    result["replay"] = path;
+    result["error"] = String::StdFormat("Replay process exited with %d.", exitCode);
+    return result;
+}
+
+static std::vector<std::string> GetReplayFiles(CommandLineArgEnumerator* argEnumerator)
+{
+    std::vector<std::string> files;
+    const char* argument;
+    while (argEnumerator->TryPopString(&argument))
+    {
+        // Options have already been parsed.
+        if (argument[0] == '-')
+        {
+            break;
+        }
+
+        if (Path::DirectoryExists(argument))
+        {
+            auto scanner = Path::ScanDirectory(Path::Combine(argument, u8"*.parkrep"), true);
+            while (scanner->Next())
+            {
+                files.push_back(scanner->GetPath());
+            }
+        }
+        else
+        {
+            files.emplace_back(argument);
+        }
+    }
+    return files;
+}
+
+static exitcode_t HandleReplayVerify(CommandLineArgEnumerator* argEnumerator)
+{
+    const auto files = GetReplayFiles(argEnumerator);
+    if (files.empty())
+    {
+        Console::Error::WriteLine("Missing arguments <file|directory>...");
+        return EXITCODE_FAIL;
+    }
+
+    size_t jobs = _verifyJobs > 0 ? _verifyJobs : std::max(1u, std::thread::hardware_concurrency());
+#ifdef _WIN32
+    // Platform::Execute is not implemented, so every replay has to be verified in this process.
+    jobs = 1;
+#endif
+    jobs = std::min(jobs, files.size());
+
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::vector<json_t> results(files.size());
+    if (jobs == 1)
+    {
+        for (size_t i = 0; i < files.size(); i++)
+        {
+            results[i] = RunReplay(files[i]);
+        }
+    }
+    else
+    {
+        const auto executablePath = Platform::GetCurrentExecutablePath();
+        std::atomic<size_t> next{};
+        std::vector<std::future<void>> runners;
+        for (size_t i = 0; i < jobs; i++)
+        {
+            runners.push_back(std::async(std::launch::async, [&]() {
+                for (auto index = next++; index < files.size(); index = next++)
+                {
+                    results[index] = RunReplayProcess(executablePath, files[index]);
+                }
+            }));
+        }
+        for (auto& runner : runners)
+        {
+            runner.get();
+        }
+    }
+
+    size_t mismatches = 0;
+    size_t errors = 0;
+    for (const auto& result : results)
+    {
+        if (result.contains("error"))
+        {
+            errors++;
+        }
+        else if (result.value("mismatch", false))
+        {
+            mismatches++;
+        }
+    }
+
+    const json_t summary = {
+        { "replays", files.size() },
+        { "mismatches", mismatches },
+        { "errors", errors },
+        { "results", results },
+    };
+    if (_verifyOutput != nullptr)
+    {
+        Json::WriteToFile(_verifyOutput, summary);
+    }
+    else
+    {
+        Console::WriteLine("%s", summary.dump(4).c_str());
+    }
+    return mismatches == 0 && errors == 0 ? EXITCODE_OK : EXITCODE_FAIL;
+}
+
+static exitcode_t HandleReplayRun(CommandLineArgEnumerator* argEnumerator)
+{
+    const char* path;
+    if (!argEnumerator->TryPopString(&path))
+    {
+        Console::Error::WriteLine("Missing argument <file>.");
+        return EXITCODE_FAIL;
+    }
+
+    Platform::CoreInit();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    const auto result = RunReplay(path);
+    Console::WriteLine("%s", result.dump().c_str());
+    return result.contains("error") || result.value("mismatch", false) ? EXITCODE_FAIL : EXITCODE_OK;
+}
@@ -42,6 +42,7 @@ int32_t gNetworkStart = NETWORK_MODE_NONE;
 std::string gNetworkStartHost;
 int32_t gNetworkStartPort = NETWORK_DEFAULT_PORT;
 std::string gNetworkStartAddress;
+std::vector<u8string> gNetworkStartAdditionalParks;
 
 static uint32_t _port = 0;
 static char* _address = nullptr;
@@ -56,10 +57,14 @@ static bool _verbose = false;
 static bool _headless = false;
 static u8string _password = {};
 static u8string _userDataPath = {};
+static u8string _cachePath = {};
 static u8string _openrct2DataPath = {};
 static u8string _rct1DataPath = {};
 static u8string _rct2DataPath = {};
 static bool _silentBreakpad = false;
+static bool _startupProfile = false;
+static int32_t _workerThreads = -1;
+static u8string _workerAffinity = {};
 
 // clang-format off
 static constexpr const CommandLineOptionDefinition StandardOptions[]
@@ -71,15 +76,19 @@ static constexpr const CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_SWITCH,  &_about,            NAC, "about",              "show information about " OPENRCT2_NAME                      },
     { CMDLINE_TYPE_SWITCH,  &_verbose,          NAC, "verbose",            "log verbose messages"                                       },
     { CMDLINE_TYPE_SWITCH,  &_headless,         NAC, "headless",           "run " OPENRCT2_NAME " headless" IMPLIES_SILENT_BREAKPAD     },
+    { CMDLINE_TYPE_SWITCH,  &_startupProfile,   NAC, "startup-profile",    "print how long each start-up stage takes"                   },
 #ifndef DISABLE_NETWORK                                                    
     { CMDLINE_TYPE_INTEGER, &_port,             NAC, "port",               "port to use for hosting or joining a server"                },
     { CMDLINE_TYPE_STRING,  &_address,          NAC, "address",            "address to listen on when hosting a server"                 },
 #endif                                                                     
     { CMDLINE_TYPE_STRING,  &_password,         NAC, "password",           "password needed to join the server"                         },
     { CMDLINE_TYPE_STRING,  &_userDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)"    },
+    { CMDLINE_TYPE_STRING,  &_cachePath,        NAC, "cache-path",         "path to the cache directory (containing objects.idx)"       },
     { CMDLINE_TYPE_STRING,  &_openrct2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
     { CMDLINE_TYPE_STRING,  &_rct2DataPath,     NAC, "rct2-data-path",     "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_INTEGER, &_workerThreads,    NAC, "worker-threads",     "number of worker threads, 0 for one per core"               },
+    { CMDLINE_TYPE_STRING,  &_workerAffinity,   NAC, "worker-affinity",    "cores the worker threads may run on, e.g. 0-3,8"            },
 #ifdef USE_BREAKPAD
     { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
@@ -125,7 +134,7 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
     DefineCommand("intro",    "",                       StandardOptions, HandleCommandIntro  ),
 #ifndef DISABLE_NETWORK
-    DefineCommand("host",     "<uri>",                  StandardOptions, HandleCommandHost   ),
+    DefineCommand("host",     "<uri>...",               StandardOptions, HandleCommandHost   ),
     DefineCommand("join",     "<hostname>",             StandardOptions, HandleCommandJoin   ),
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
@@ -143,7 +152,9 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("benchgfx",        CommandLine::BenchGfxCommands         ),
     DefineSubCommand("benchspritesort", CommandLine::BenchSpriteSortCommands  ),
     DefineSubCommand("benchsimulate",   CommandLine::BenchUpdateCommands      ),
+    DefineSubCommand("benchkernels",    CommandLine::BenchKernelsCommands     ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("replay",          CommandLine::ReplayCommands           ),
     CommandTableEnd
 };
 
@@ -157,6 +168,7 @@ const CommandLineExample CommandLine::RootExamples[]
 #endif
 #ifndef DISABLE_NETWORK
     { "host ./my_park.sv6 --port 11753 --headless",   "run a headless server for a saved park" },
+    { "host ./a.park ./b.park --headless",            "run headless servers for two parks"     },
 #endif
     ExampleTableEnd
 };
@@ -198,12 +210,18 @@ exitcode_t CommandLine::HandleCommandDefault()
     gOpenRCT2Headless = _headless;
     gOpenRCT2NoGraphics = _headless;
     gOpenRCT2SilentBreakpad = _silentBreakpad || _headless;
+    gOpenRCT2StartupProfile = _startupProfile;
 
     if (!_userDataPath.empty())
     {
         gCustomUserDataPath = Path::GetAbsolute(_userDataPath);
     }
 
+    if (!_cachePath.empty())
+    {
+        gCustomCachePath = Path::GetAbsolute(_cachePath);
+    }
+
     if (!_openrct2DataPath.empty())
     {
         gCustomOpenRCT2DataPath = Path::GetAbsolute(_openrct2DataPath);
@@ -224,6 +242,16 @@ exitcode_t CommandLine::HandleCommandDefault()
         gCustomPassword = _password;
     }
 
+    if (_workerThreads >= 0)
+    {
+        gCustomWorkerThreads = _workerThreads;
+    }
+
+    if (!_workerAffinity.empty())
+    {
+        gCustomWorkerAffinity = _workerAffinity;
+    }
+
     return result;
 }
 
@@ -294,6 +322,24 @@ exitcode_t HandleCommandHost(CommandLineArgEnumerator* enumerator)
         return EXITCODE_FAIL;
     }
 
+    // Any further parks are hosted by forked processes, they share everything loaded at start-up.
+    gNetworkStartAdditionalParks.clear();
+    const char* additionalParkUri;
+    while (enumerator->TryPopString(&additionalParkUri))
+    {
+        if (additionalParkUri[0] == '-')
+        {
+            enumerator->Backtrack();
+            break;
+        }
+        gNetworkStartAdditionalParks.emplace_back(additionalParkUri);
+    }
+    if (!gNetworkStartAdditionalParks.empty() && !_headless)
+    {
+        Console::Error::WriteLine("Hosting more than one park requires --headless.");
+        return EXITCODE_FAIL;
+    }
+
     gOpenRCT2StartupAction = StartupAction::Open;
     String::Set(gOpenRCT2StartupActionPath, sizeof(gOpenRCT2StartupActionPath), parkUri);
 
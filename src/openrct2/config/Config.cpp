@@ -197,6 +197,9 @@ namespace Config
             model->window_scale = reader->GetFloat("window_scale", Platform::GetDefaultScale());
             model->show_fps = reader->GetBoolean("show_fps", false);
             model->multithreading = reader->GetBoolean("multi_threading", false);
+            model->worker_threads = std::max(reader->GetInt32("worker_threads", 0), 0);
+            model->worker_affinity = reader->GetString("worker_affinity", "");
+            model->pace_game_ticks = reader->GetBoolean("pace_game_ticks", false);
             model->trap_cursor = reader->GetBoolean("trap_cursor", false);
             model->auto_open_shops = reader->GetBoolean("auto_open_shops", false);
             model->scenario_select_mode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -211,9 +214,14 @@ namespace Config
             model->zoom_to_cursor = reader->GetBoolean("zoom_to_cursor", true);
             model->render_weather_effects = reader->GetBoolean("render_weather_effects", true);
             model->render_weather_gloom = reader->GetBoolean("render_weather_gloom", true);
+            model->level_of_detail = reader->GetBoolean("level_of_detail", false);
             model->show_guest_purchases = reader->GetBoolean("show_guest_purchases", false);
             model->show_real_names_of_guests = reader->GetBoolean("show_real_names_of_guests", true);
             model->allow_early_completion = reader->GetBoolean("allow_early_completion", false);
+            model->guest_flow_field_pathfinding = reader->GetBoolean("guest_flow_field_pathfinding", false);
+            model->tile_block_layout = reader->GetBoolean("tile_block_layout", false);
+            model->parallel_ride_ratings = reader->GetBoolean("parallel_ride_ratings", false);
+            model->ride_ratings_proximity_cache = reader->GetBoolean("ride_ratings_proximity_cache", false);
             model->transparent_screenshot = reader->GetBoolean("transparent_screenshot", true);
             model->transparent_water = reader->GetBoolean("transparent_water", true);
 
@@ -281,6 +289,9 @@ namespace Config
         writer->WriteFloat("window_scale", model->window_scale);
         writer->WriteBoolean("show_fps", model->show_fps);
         writer->WriteBoolean("multi_threading", model->multithreading);
+        writer->WriteInt32("worker_threads", model->worker_threads);
+        writer->WriteString("worker_affinity", model->worker_affinity);
+        writer->WriteBoolean("pace_game_ticks", model->pace_game_ticks);
         writer->WriteBoolean("trap_cursor", model->trap_cursor);
         writer->WriteBoolean("auto_open_shops", model->auto_open_shops);
         writer->WriteInt32("scenario_select_mode", model->scenario_select_mode);
@@ -295,9 +306,14 @@ namespace Config
         writer->WriteBoolean("zoom_to_cursor", model->zoom_to_cursor);
         writer->WriteBoolean("render_weather_effects", model->render_weather_effects);
         writer->WriteBoolean("render_weather_gloom", model->render_weather_gloom);
+        writer->WriteBoolean("level_of_detail", model->level_of_detail);
         writer->WriteBoolean("show_guest_purchases", model->show_guest_purchases);
         writer->WriteBoolean("show_real_names_of_guests", model->show_real_names_of_guests);
         writer->WriteBoolean("allow_early_completion", model->allow_early_completion);
+        writer->WriteBoolean("guest_flow_field_pathfinding", model->guest_flow_field_pathfinding);
+        writer->WriteBoolean("tile_block_layout", model->tile_block_layout);
+        writer->WriteBoolean("parallel_ride_ratings", model->parallel_ride_ratings);
+        writer->WriteBoolean("ride_ratings_proximity_cache", model->ride_ratings_proximity_cache);
         writer->WriteEnum<VirtualFloorStyles>("virtual_floor_style", model->virtual_floor_style, Enum_VirtualFloorStyle);
         writer->WriteBoolean("transparent_screenshot", model->transparent_screenshot);
         writer->WriteBoolean("transparent_water", model->transparent_water);
@@ -421,8 +437,10 @@ namespace Config
             model->known_keys_only = reader->GetBoolean("known_keys_only", false);
             model->log_chat = reader->GetBoolean("log_chat", false);
             model->log_server_actions = reader->GetBoolean("log_server_actions", false);
+            model->log_server_metrics = reader->GetBoolean("log_server_metrics", false);
             model->pause_server_if_no_clients = reader->GetBoolean("pause_server_if_no_clients", false);
             model->desync_debugging = reader->GetBoolean("desync_debugging", false);
+            model->speculative_placement = reader->GetBoolean("speculative_placement", true);
         }
     }
 
@@ -448,8 +466,10 @@ namespace Config
         writer->WriteBoolean("known_keys_only", model->known_keys_only);
         writer->WriteBoolean("log_chat", model->log_chat);
         writer->WriteBoolean("log_server_actions", model->log_server_actions);
+        writer->WriteBoolean("log_server_metrics", model->log_server_metrics);
         writer->WriteBoolean("pause_server_if_no_clients", model->pause_server_if_no_clients);
         writer->WriteBoolean("desync_debugging", model->desync_debugging);
+        writer->WriteBoolean("speculative_placement", model->speculative_placement);
     }
 
     static void ReadNotifications(IIniReader* reader)
@@ -551,6 +571,7 @@ namespace Config
             auto model = &gConfigPlugin;
             model->enable_hot_reloading = reader->GetBoolean("enable_hot_reloading", false);
             model->allowed_hosts = reader->GetString("allowed_hosts", "");
+            model->hook_time_budget = reader->GetFloat("hook_time_budget", 0.0f);
         }
     }
 
@@ -560,6 +581,7 @@ namespace Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->enable_hot_reloading);
         writer->WriteString("allowed_hosts", model->allowed_hosts);
+        writer->WriteFloat("hook_time_budget", model->hook_time_budget);
     }
 
     static bool SetDefaults()
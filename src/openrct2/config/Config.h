@@ -42,6 +42,9 @@ struct GeneralConfiguration
     bool use_vsync;
     bool show_fps;
     bool multithreading;
+    int32_t worker_threads;
+    std::string worker_affinity;
+    bool pace_game_ticks;
     bool minimize_fullscreen_focus_loss;
     bool disable_screensaver;
 
@@ -54,6 +57,7 @@ struct GeneralConfiguration
     bool enable_light_fx_for_vehicles;
     bool upper_case_banners;
     bool render_weather_effects;
+    bool level_of_detail;
     bool render_weather_gloom;
     bool disable_lightning_effect;
     bool show_guest_purchases;
@@ -104,6 +108,10 @@ struct GeneralConfiguration
     bool steam_overlay_pause;
     bool show_real_names_of_guests;
     bool allow_early_completion;
+    bool guest_flow_field_pathfinding;
+    bool tile_block_layout;
+    bool parallel_ride_ratings;
+    bool ride_ratings_proximity_cache;
 
     // Loading and saving
     bool confirmation_prompt;
@@ -167,8 +175,10 @@ struct NetworkConfiguration
     bool known_keys_only;
     bool log_chat;
     bool log_server_actions;
+    bool log_server_metrics;
     bool pause_server_if_no_clients;
     bool desync_debugging;
+    bool speculative_placement;
 };
 
 struct NotificationConfiguration
@@ -215,6 +225,8 @@ struct PluginConfiguration
 {
     bool enable_hot_reloading;
     std::string allowed_hosts;
+    // Milliseconds a single hook call may take before it is logged, 0 disables the check.
+    float hook_time_budget;
 };
 
 enum class Sort : int32_t
@@ -10,9 +10,11 @@
 #pragma once
 
 #include "../common.h"
+#include "Endianness.h"
 #include "IStream.hpp"
 
 #include <array>
+#include <cstring>
 
 namespace OpenRCT2
 {
@@ -100,7 +102,24 @@ namespace OpenRCT2
 
         template<size_t N> void Write(const void* buffer)
         {
-            Write(buffer, N);
+            if constexpr (N <= sizeof(uint64_t))
+            {
+                // Same as Write(buffer, N) for a single word, without the loop and the variable length copy.
+                uint64_t temp{};
+                std::memcpy(&temp, buffer, N);
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                temp = ByteSwapBE(temp);
+#endif
+
+                uint64_t* hash = reinterpret_cast<uint64_t*>(_checksum.data());
+                *hash ^= temp;
+                *hash *= Prime;
+            }
+            else
+            {
+                Write(buffer, N);
+            }
         }
 
         uint64_t TryRead(void* buffer, uint64_t length) override
@@ -25,11 +25,14 @@
 #include "Endianness.h"
 #include "MemoryStream.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 
 template<typename T> struct DataSerializerTraits_t
 {
@@ -267,6 +270,51 @@ template<> struct DataSerializerTraits_t<OpenRCT2::MemoryStream>
     }
 };
 
+/**
+ * Encodes and decodes runs of integers and enums with one stream access per chunk rather than one per element, using
+ * the same byte order as DataSerializerTraitsIntegral and DataSerializerTraits_enum.
+ */
+template<typename T> struct DataSerializerTraitsBulk
+{
+    // Not bool, std::vector<bool> has no contiguous storage.
+    static constexpr bool IsSupported = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T>;
+    static constexpr size_t ChunkLength = 256;
+
+    static void encode(OpenRCT2::IStream* stream, const T* data, size_t count)
+    {
+        if constexpr (sizeof(T) == 1)
+        {
+            stream->Write(data, count);
+        }
+        else
+        {
+            T chunk[ChunkLength];
+            while (count > 0)
+            {
+                const auto length = std::min(count, ChunkLength);
+                for (size_t i = 0; i < length; i++)
+                {
+                    chunk[i] = ByteSwapBE(data[i]);
+                }
+                stream->Write(chunk, length * sizeof(T));
+                data += length;
+                count -= length;
+            }
+        }
+    }
+    static void decode(OpenRCT2::IStream* stream, T* data, size_t count)
+    {
+        stream->Read(data, count * sizeof(T));
+        if constexpr (sizeof(T) != 1)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                data[i] = ByteSwapBE(data[i]);
+            }
+        }
+    }
+};
+
 template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
 {
     static void encode(OpenRCT2::IStream* stream, const _Ty (&val)[_Size])
@@ -275,10 +323,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerTraitsBulk<_Ty>::IsSupported)
         {
-            s.encode(stream, sub);
+            DataSerializerTraitsBulk<_Ty>::encode(stream, std::data(val), _Size);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
     static void decode(OpenRCT2::IStream* stream, _Ty (&val)[_Size])
@@ -290,10 +345,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraitsPODArray
         if (len != _Size)
             throw std::runtime_error("Invalid size, can't decode");
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerTraitsBulk<_Ty>::IsSupported)
+        {
+            DataSerializerTraitsBulk<_Ty>::decode(stream, std::data(val), _Size);
+        }
+        else
         {
-            s.decode(stream, sub);
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.decode(stream, sub);
+            }
         }
     }
     static void log(OpenRCT2::IStream* stream, const _Ty (&val)[_Size])
@@ -343,10 +405,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraits_t<std::array<_T
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerTraitsBulk<_Ty>::IsSupported)
         {
-            s.encode(stream, sub);
+            DataSerializerTraitsBulk<_Ty>::encode(stream, std::data(val), _Size);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
     static void decode(OpenRCT2::IStream* stream, std::array<_Ty, _Size>& val)
@@ -358,10 +427,17 @@ template<typename _Ty, size_t _Size> struct DataSerializerTraits_t<std::array<_T
         if (len != _Size)
             throw std::runtime_error("Invalid size, can't decode");
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerTraitsBulk<_Ty>::IsSupported)
+        {
+            DataSerializerTraitsBulk<_Ty>::decode(stream, std::data(val), _Size);
+        }
+        else
         {
-            s.decode(stream, sub);
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.decode(stream, sub);
+            }
         }
     }
     static void log(OpenRCT2::IStream* stream, const std::array<_Ty, _Size>& val)
@@ -385,10 +461,17 @@ template<typename _Ty> struct DataSerializerTraits_t<std::vector<_Ty>>
         uint16_t swapped = ByteSwapBE(len);
         stream->Write(&swapped);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto&& sub : val)
+        if constexpr (DataSerializerTraitsBulk<_Ty>::IsSupported)
         {
-            s.encode(stream, sub);
+            DataSerializerTraitsBulk<_Ty>::encode(stream, val.data(), len);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto&& sub : val)
+            {
+                s.encode(stream, sub);
+            }
         }
     }
     static void decode(OpenRCT2::IStream* stream, std::vector<_Ty>& val)
@@ -397,12 +480,21 @@ template<typename _Ty> struct DataSerializerTraits_t<std::vector<_Ty>>
         stream->Read(&len);
         len = ByteSwapBE(len);
 
-        DataSerializerTraits<_Ty> s;
-        for (auto i = 0; i < len; ++i)
+        if constexpr (DataSerializerTraitsBulk<_Ty>::IsSupported)
         {
-            _Ty sub{};
-            s.decode(stream, sub);
-            val.push_back(std::move(sub));
+            const auto offset = val.size();
+            val.resize(offset + len);
+            DataSerializerTraitsBulk<_Ty>::decode(stream, val.data() + offset, len);
+        }
+        else
+        {
+            DataSerializerTraits<_Ty> s;
+            for (auto i = 0; i < len; ++i)
+            {
+                _Ty sub{};
+                s.decode(stream, sub);
+                val.push_back(std::move(sub));
+            }
         }
     }
     static void log(OpenRCT2::IStream* stream, const std::vector<_Ty>& val)
@@ -16,36 +16,32 @@
 #include "FileScanner.h"
 #include "FileStream.h"
 #include "JobPool.h"
-#include "Numerics.hpp"
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
+#include <random>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
 {
 private:
-    struct DirectoryStats
+    struct FileEntry
     {
-        uint32_t TotalFiles = 0;
-        uint64_t TotalFileSize = 0;
-        uint32_t FileDateModifiedChecksum = 0;
-        uint32_t PathChecksum = 0;
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
     };
 
-    struct ScanResult
+    // A scanned file and the item created from it, HasItem is false if the file could not be indexed.
+    struct IndexedFile
     {
-        DirectoryStats const Stats;
-        std::vector<std::string> const Files;
-
-        ScanResult(DirectoryStats stats, std::vector<std::string> files)
-            : Stats(stats)
-            , Files(files)
-        {
-        }
+        FileEntry File;
+        bool HasItem = false;
+        TItem Item{};
     };
 
     struct FileIndexHeader
@@ -55,12 +51,11 @@ private:
         uint8_t VersionA = 0;
         uint8_t VersionB = 0;
         uint16_t LanguageId = 0;
-        DirectoryStats Stats;
-        uint32_t NumItems = 0;
+        uint32_t NumFiles = 0;
     };
 
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -96,32 +91,20 @@ public:
     virtual ~FileIndex() = default;
 
     /**
-     * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * Queries and directories and loads the index. Files whose path, size and modification time match the index are
+     * loaded from it, only added or changed files are indexed again.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
-        auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
-        {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
-        }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
-        }
-        return items;
+        auto files = Scan();
+        auto indexedFiles = ReadIndexFile(language);
+        return Build(language, files, std::move(indexedFiles));
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
-        auto scanResult = Scan();
-        auto items = Build(language, scanResult);
-        return items;
+        auto files = Scan();
+        return Build(language, files, {});
     }
 
 protected:
@@ -137,121 +120,137 @@ protected:
     virtual void Serialise(DataSerialiser& ds, TItem& item) const abstract;
 
 private:
-    ScanResult Scan() const
+    std::vector<FileEntry> Scan() const
     {
-        DirectoryStats stats{};
-        std::vector<std::string> files;
+        std::vector<FileEntry> files;
         for (const auto& directory : SearchPaths)
         {
             auto absoluteDirectory = Path::GetAbsolute(directory);
             log_verbose("FileIndex:Scanning for %s in '%s'", _pattern.c_str(), absoluteDirectory.c_str());
 
             auto pattern = Path::Combine(absoluteDirectory, _pattern);
-            auto scanner = Path::ScanDirectory(pattern, true);
-            while (scanner->Next())
+            for (auto& file : Path::ScanDirectoryParallel(pattern))
             {
-                auto fileInfo = scanner->GetFileInfo();
-                auto path = std::string(scanner->GetPath());
-
-                stats.TotalFiles++;
-                stats.TotalFileSize += fileInfo->Size;
-                stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo->LastModified >> 32)
-                    ^ static_cast<uint32_t>(fileInfo->LastModified & 0xFFFFFFFF);
-                stats.FileDateModifiedChecksum = Numerics::ror32(stats.FileDateModifiedChecksum, 5);
-                stats.PathChecksum += GetPathChecksum(path);
-
-                files.push_back(std::move(path));
+                files.push_back({ std::move(file.Path), file.Size, file.LastModified });
             }
         }
-        return ScanResult(stats, files);
+        return files;
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, std::vector<IndexedFile>& files, const std::vector<size_t>& indices, size_t rangeStart,
+        size_t rangeEnd, std::atomic<size_t>& processed, std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            auto& file = files[indices[i]];
 
             if (_log_levels[static_cast<uint8_t>(DiagnosticLevel::Verbose)])
             {
                 std::lock_guard<std::mutex> lock(printLock);
-                log_verbose("FileIndex:Indexing '%s'", filePath.c_str());
+                log_verbose("FileIndex:Indexing '%s'", file.File.Path.c_str());
             }
 
-            auto item = Create(language, filePath);
-            if (std::get<0>(item))
+            auto item = Create(language, file.File.Path);
+            file.HasItem = std::get<0>(item);
+            if (file.HasItem)
             {
-                items.push_back(std::get<1>(item));
+                file.Item = std::move(std::get<1>(item));
             }
 
             processed++;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    std::vector<TItem> Build(
+        int32_t language, const std::vector<FileEntry>& scannedFiles, std::vector<IndexedFile> indexedFiles) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        std::unordered_map<std::string_view, IndexedFile*> indexedFileMap;
+        for (auto& indexedFile : indexedFiles)
+        {
+            indexedFileMap.emplace(indexedFile.File.Path, &indexedFile);
+        }
 
-        auto startTime = std::chrono::high_resolution_clock::now();
+        // Reuse the indexed entries of unchanged files, everything else has to be created again.
+        std::vector<IndexedFile> files(scannedFiles.size());
+        std::vector<size_t> changedFiles;
+        for (size_t i = 0; i < scannedFiles.size(); i++)
+        {
+            const auto& scannedFile = scannedFiles[i];
+            auto it = indexedFileMap.find(scannedFile.Path);
+            files[i].File = scannedFile;
+            if (it != indexedFileMap.end() && it->second->File.Size == scannedFile.Size
+                && it->second->File.LastModified == scannedFile.LastModified)
+            {
+                files[i].HasItem = it->second->HasItem;
+                files[i].Item = std::move(it->second->Item);
+            }
+            else
+            {
+                changedFiles.push_back(i);
+            }
+        }
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        if (!changedFiles.empty() || files.size() != indexedFiles.size())
         {
-            JobPool jobPool;
-            std::mutex printLock; // For verbose prints.
+            Console::WriteLine("Building %s (%zu of %zu items)", _name.c_str(), changedFiles.size(), files.size());
 
-            std::list<std::vector<TItem>> containers;
+            auto startTime = std::chrono::high_resolution_clock::now();
 
-            size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
+            const size_t totalCount = changedFiles.size();
+            if (totalCount > 0)
+            {
+                JobPool jobPool;
+                std::mutex printLock; // For verbose prints.
 
-            std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
+                size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
-            auto reportProgress = [&]() {
-                const size_t completed = processed;
-                Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
-            };
+                std::atomic<size_t> processed = ATOMIC_VAR_INIT(0);
 
-            for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
-            {
-                if (rangeStart + stepSize > totalCount)
+                auto reportProgress = [&]() {
+                    const size_t completed = processed;
+                    Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
+                };
+
+                for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
                 {
-                    stepSize = totalCount - rangeStart;
-                }
+                    if (rangeStart + stepSize > totalCount)
+                    {
+                        stepSize = totalCount - rangeStart;
+                    }
 
-                auto& items = containers.emplace_back();
+                    jobPool.AddTask(std::bind(
+                        &FileIndex<TItem>::BuildRange, this, language, std::ref(files), std::cref(changedFiles), rangeStart,
+                        rangeStart + stepSize, std::ref(processed), std::ref(printLock)));
 
-                jobPool.AddTask(std::bind(
-                    &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
-                    std::ref(items), std::ref(processed), std::ref(printLock)));
+                    reportProgress();
+                }
 
-                reportProgress();
+                jobPool.Join(reportProgress);
             }
 
-            jobPool.Join(reportProgress);
+            WriteIndexFile(language, files);
 
-            for (const auto& itr : containers)
+            auto endTime = std::chrono::high_resolution_clock::now();
+            auto duration = std::chrono::duration<float>(endTime - startTime);
+            Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+        }
+
+        std::vector<TItem> allItems;
+        allItems.reserve(files.size());
+        for (auto& file : files)
+        {
+            if (file.HasItem)
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                allItems.push_back(std::move(file.Item));
             }
         }
-
-        WriteIndexFile(language, scanResult.Stats, allItems);
-
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration<float>(endTime - startTime);
-        Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
-
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    std::vector<IndexedFile> ReadIndexFile(int32_t language) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        std::vector<IndexedFile> files;
         if (File::Exists(_indexPath))
         {
             try
@@ -259,24 +258,26 @@ private:
                 log_verbose("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
-                // Read header, check if we need to re-scan
+                // Read header, the whole index is discarded if it was written by a different version or language
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    files.reserve(header.NumFiles);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
-                    for (uint32_t i = 0; i < header.NumItems; i++)
+                    for (uint32_t i = 0; i < header.NumFiles; i++)
                     {
-                        TItem item;
-                        Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        IndexedFile file;
+                        ds << file.File.Path;
+                        ds << file.File.Size;
+                        ds << file.File.LastModified;
+                        ds << file.HasItem;
+                        if (file.HasItem)
+                        {
+                            Serialise(ds, file.Item);
+                        }
+                        files.push_back(std::move(file));
                     }
-                    loadedItems = true;
                 }
                 else
                 {
@@ -287,55 +288,60 @@ private:
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                files.clear();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return files;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, std::vector<TItem>& items) const
+    void WriteIndexFile(int32_t language, std::vector<IndexedFile>& files) const
     {
+        // The cache directory can be shared by several instances, so the index is written to a file of our own and
+        // then moved into place. Readers never see a partially written index.
+        auto tempPath = _indexPath + "." + std::to_string(std::random_device{}()) + ".tmp";
         try
         {
             log_verbose("FileIndex:Writing index: '%s'", _indexPath.c_str());
             Path::CreateDirectory(Path::GetDirectory(_indexPath));
-            auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_WRITE);
-
-            // Write header
-            FileIndexHeader header;
-            header.MagicNumber = _magicNumber;
-            header.VersionA = FILE_INDEX_VERSION;
-            header.VersionB = _version;
-            header.LanguageId = language;
-            header.Stats = stats;
-            header.NumItems = static_cast<uint32_t>(items.size());
-            fs.WriteValue(header);
-
-            DataSerialiser ds(true, fs);
-            // Write items
-            for (auto& item : items)
+            WriteIndexFile(tempPath, language, files);
+            if (!File::Move(tempPath, _indexPath))
             {
-                Serialise(ds, item);
+                throw std::runtime_error("Unable to move the index into place.");
             }
         }
         catch (const std::exception& e)
         {
             Console::Error::WriteLine("Unable to save index: '%s'.", _indexPath.c_str());
             Console::Error::WriteLine("%s", e.what());
+            File::Delete(tempPath);
         }
     }
 
-    static uint32_t GetPathChecksum(const std::string& path)
+    void WriteIndexFile(const std::string& path, int32_t language, std::vector<IndexedFile>& files) const
     {
-        uint32_t hash = 0xD8430DED;
-        for (const utf8* ch = path.c_str(); *ch != '\0'; ch++)
+        auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_WRITE);
+
+        // Write header
+        FileIndexHeader header;
+        header.MagicNumber = _magicNumber;
+        header.VersionA = FILE_INDEX_VERSION;
+        header.VersionB = _version;
+        header.LanguageId = language;
+        header.NumFiles = static_cast<uint32_t>(files.size());
+        fs.WriteValue(header);
+
+        DataSerialiser ds(true, fs);
+        // Write the files with their items
+        for (auto& file : files)
         {
-            hash += (*ch);
-            hash += (hash << 10);
-            hash ^= (hash >> 6);
+            ds << file.File.Path;
+            ds << file.File.Size;
+            ds << file.File.LastModified;
+            ds << file.HasItem;
+            if (file.HasItem)
+            {
+                Serialise(ds, file.Item);
+            }
         }
-        hash += (hash << 3);
-        hash ^= (hash >> 11);
-        hash += (hash << 15);
-        return hash;
     }
 };
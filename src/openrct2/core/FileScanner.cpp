@@ -24,11 +24,13 @@
 #endif
 
 #include "FileScanner.h"
+#include "JobPool.h"
 #include "Memory.hpp"
 #include "Numerics.hpp"
 #include "Path.hpp"
 #include "String.hpp"
 
+#include <iterator>
 #include <memory>
 #include <stack>
 #include <string>
@@ -162,7 +164,47 @@ public:
 
     virtual void GetDirectoryChildren(std::vector<DirectoryChild>& children, const std::string& path) abstract;
 
+    void CollectFiles(std::vector<ScannedFile>& files)
+    {
+        CollectFiles(files, _rootPath);
+    }
+
 private:
+    void CollectFiles(std::vector<ScannedFile>& files, const std::string& directory)
+    {
+        std::vector<DirectoryChild> children;
+        GetDirectoryChildren(children, directory);
+
+        std::vector<const DirectoryChild*> subDirectories;
+        for (const auto& child : children)
+        {
+            if (child.Type == DIRECTORY_CHILD_TYPE::DC_DIRECTORY)
+            {
+                subDirectories.push_back(&child);
+            }
+        }
+
+        // Each sub directory collects into its own list, they are joined in listing order below.
+        std::vector<std::vector<ScannedFile>> subDirectoryFiles(subDirectories.size());
+        JobPool::ParallelFor(0, subDirectories.size(), 1, [&](size_t i) {
+            CollectFiles(subDirectoryFiles[i], Path::Combine(directory, subDirectories[i]->Name));
+        });
+
+        size_t subDirectoryIndex = 0;
+        for (const auto& child : children)
+        {
+            if (child.Type == DIRECTORY_CHILD_TYPE::DC_DIRECTORY)
+            {
+                auto& subFiles = subDirectoryFiles[subDirectoryIndex++];
+                files.insert(files.end(), std::make_move_iterator(subFiles.begin()), std::make_move_iterator(subFiles.end()));
+            }
+            else if (PatternMatch(child.Name))
+            {
+                files.push_back({ Path::Combine(directory, child.Name), child.Size, child.LastModified });
+            }
+        }
+    }
+
     void PushState(const std::string& directory)
     {
         DirectoryState newState;
@@ -172,7 +214,7 @@ private:
         _directoryStack.push(newState);
     }
 
-    bool PatternMatch(const std::string& fileName)
+    bool PatternMatch(const std::string& fileName) const
     {
         for (const auto& pattern : _patterns)
         {
@@ -280,13 +322,25 @@ public:
         int32_t count = scandir(path.c_str(), &namelist, FilterFunc, alphasort);
         if (count > 0)
         {
+            std::vector<const struct dirent*> nodes;
             for (int32_t i = 0; i < count; i++)
             {
                 const struct dirent* node = namelist[i];
                 if (!String::Equals(node->d_name, ".") && !String::Equals(node->d_name, ".."))
                 {
-                    children.push_back(CreateChild(path.c_str(), node));
+                    nodes.push_back(node);
                 }
+            }
+
+            // Every file is stat'd, which is slow on network storage, so large directories are split over the workers.
+            auto start = children.size();
+            children.resize(start + nodes.size());
+            JobPool::ParallelFor(0, nodes.size(), 64, [&](size_t i) {
+                children[start + i] = CreateChild(path.c_str(), nodes[i]);
+            });
+
+            for (int32_t i = 0; i < count; i++)
+            {
                 free(namelist[i]);
             }
             free(namelist);
@@ -344,6 +398,16 @@ std::unique_ptr<IFileScanner> Path::ScanDirectory(const std::string& pattern, bo
 #endif
 }
 
+std::vector<ScannedFile> Path::ScanDirectoryParallel(const std::string& pattern)
+{
+    auto scanner = ScanDirectory(pattern, true);
+    auto baseScanner = static_cast<FileScannerBase*>(scanner.get());
+
+    std::vector<ScannedFile> files;
+    baseScanner->CollectFiles(files);
+    return files;
+}
+
 void Path::QueryDirectory(QueryDirectoryResult* result, const std::string& pattern)
 {
     auto scanner = Path::ScanDirectory(pattern, true);
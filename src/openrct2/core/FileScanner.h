@@ -23,6 +23,13 @@ struct FileInfo
     uint64_t LastModified;
 };
 
+struct ScannedFile
+{
+    std::string Path;
+    uint64_t Size;
+    uint64_t LastModified;
+};
+
 struct IFileScanner
 {
     virtual ~IFileScanner() = default;
@@ -54,6 +61,13 @@ namespace Path
      */
     [[nodiscard]] std::unique_ptr<IFileScanner> ScanDirectory(const std::string& pattern, bool recurse);
 
+    /**
+     * Scans a directory and all sub directories for files that matches the given pattern. Sub directories are
+     * listed in parallel, the files are returned in the same order as ScanDirectory would visit them.
+     * @param pattern The path followed by a semi-colon delimited list of wildcard patterns.
+     */
+    [[nodiscard]] std::vector<ScannedFile> ScanDirectoryParallel(const std::string& pattern);
+
     /**
      * Scans a directory and all sub directories
      * @param result The query result to modify.
@@ -7,9 +7,11 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <algorithm>
 #include <array>
 #include <cstdio>
 #include <stdexcept>
+#include <utility>
 
 #ifdef _WIN32
 #    include <windows.h>
@@ -196,3 +198,21 @@ void FileWatcher::WatchDirectory()
     }
 #endif
 }
+
+FileChangeQueue::FileChangeQueue(const std::string& directoryPath)
+{
+    _watcher = std::make_unique<FileWatcher>(directoryPath);
+    _watcher->OnFileChanged = [this](const std::string& path) {
+        std::lock_guard<std::mutex> guard(_mutex);
+        if (std::find(_changedFiles.begin(), _changedFiles.end(), path) == _changedFiles.end())
+        {
+            _changedFiles.push_back(path);
+        }
+    };
+}
+
+std::vector<std::string> FileChangeQueue::TakeChangedFiles()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    return std::exchange(_changedFiles, {});
+}
@@ -10,6 +10,8 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -65,3 +67,24 @@ private:
 
     void WatchDirectory();
 };
+
+/**
+ * Collects the files a FileWatcher reports as changed, so they can be picked up on the main thread. Throws if the
+ * directory can not be watched.
+ */
+class FileChangeQueue
+{
+private:
+    std::mutex _mutex;
+    std::vector<std::string> _changedFiles;
+    // Declared last, so the watcher thread has stopped before the queue goes away.
+    std::unique_ptr<FileWatcher> _watcher;
+
+public:
+    explicit FileChangeQueue(const std::string& directoryPath);
+
+    /**
+     * Returns the files that changed since the last call, each one once, in the order they first changed.
+     */
+    std::vector<std::string> TakeChangedFiles();
+};
@@ -14,6 +14,9 @@
 #include <cstdio>
 #include <vector>
 
+/**
+ * A set of values for each handle. The values of a handle are kept sorted, so they can be found with a binary search.
+ */
 template<typename Handle, typename V> class GroupVector
 {
     std::vector<std::vector<V>> _data;
@@ -26,7 +29,7 @@ public:
             return false;
 
         const auto& values = _data[index];
-        return std::find(values.begin(), values.end(), value) != values.end();
+        return std::binary_search(values.begin(), values.end(), value);
     }
 
     void Add(Handle handle, V value)
@@ -38,11 +41,11 @@ public:
         }
         auto& values = _data[index];
 
-        auto it = std::find(values.begin(), values.end(), value);
-        if (it != values.end())
+        auto it = std::lower_bound(values.begin(), values.end(), value);
+        if (it != values.end() && *it == value)
             return;
 
-        values.push_back(value);
+        values.insert(it, value);
     }
 
     void Set(Handle handle, std::vector<V>&& values)
@@ -52,7 +55,9 @@ public:
         {
             _data.resize(index + 1);
         }
-        _data[index] = values;
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        _data[index] = std::move(values);
     }
 
     std::vector<V>* GetAll(Handle handle)
@@ -83,7 +88,11 @@ public:
     {
         for (auto& values : _data)
         {
-            values.erase(std::remove_if(values.begin(), values.end(), [value](auto v) { return v == value; }), values.end());
+            auto it = std::lower_bound(values.begin(), values.end(), value);
+            if (it != values.end() && *it == value)
+            {
+                values.erase(it);
+            }
         }
     }
 };
@@ -150,9 +150,22 @@ namespace Http
         return body;
     }
 
+    // WinHTTP keeps the connections of a session open, so all requests share one session.
+    static HINTERNET GetSession()
+    {
+        static HINTERNET session = []() {
+            auto userAgent = String::ToWideChar(OPENRCT2_USER_AGENT);
+            return WinHttpOpen(
+                userAgent.c_str(), WINHTTP_ACCESS_TYPE_DEFAULT_PROXY, WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
+        }();
+        if (session == nullptr)
+            ThrowWin32Exception("WinHttpOpen");
+        return session;
+    }
+
     Response Do(const Request& req)
     {
-        HINTERNET hSession{}, hConnect{}, hRequest{};
+        HINTERNET hConnect{}, hRequest{};
         try
         {
             URL_COMPONENTS url{};
@@ -166,12 +179,7 @@ namespace Http
             if (!WinHttpCrackUrl(wUrl.c_str(), 0, 0, &url))
                 throw std::invalid_argument("Unable to parse URI.");
 
-            auto userAgent = String::ToWideChar(OPENRCT2_USER_AGENT);
-            hSession = WinHttpOpen(
-                userAgent.c_str(), WINHTTP_ACCESS_TYPE_DEFAULT_PROXY, WINHTTP_NO_PROXY_NAME, WINHTTP_NO_PROXY_BYPASS, 0);
-            if (hSession == nullptr)
-                ThrowWin32Exception("WinHttpOpen");
-
+            auto hSession = GetSession();
             auto wHostName = std::wstring(url.lpszHostName, url.dwHostNameLength);
             hConnect = WinHttpConnect(hSession, wHostName.c_str(), url.nPort, 0);
             if (hConnect == nullptr)
@@ -219,7 +227,6 @@ namespace Http
             }
             response.header = std::move(headers);
 
-            WinHttpCloseHandle(hSession);
             WinHttpCloseHandle(hConnect);
             WinHttpCloseHandle(hRequest);
             return response;
@@ -229,7 +236,6 @@ namespace Http
 #    ifdef DEBUG
             Console::Error::WriteLine("HTTP request failed: %s", e.what());
 #    endif
-            WinHttpCloseHandle(hSession);
             WinHttpCloseHandle(hConnect);
             WinHttpCloseHandle(hRequest);
             throw;
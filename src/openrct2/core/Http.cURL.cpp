@@ -82,14 +82,29 @@ namespace Http
         return 0;
     }
 
+    // Each thread keeps its handle, so the connection cache of the handle is reused by the next request.
+    struct CurlHandle
+    {
+        CURL* Handle = curl_easy_init();
+
+        ~CurlHandle()
+        {
+            if (Handle != nullptr)
+                curl_easy_cleanup(Handle);
+        }
+    };
+
     Response Do(const Request& req)
     {
-        CURL* curl = curl_easy_init();
-        std::shared_ptr<void> _(nullptr, [curl](...) { curl_easy_cleanup(curl); });
+        thread_local CurlHandle handle;
+        CURL* curl = handle.Handle;
 
         if (!curl)
             throw std::runtime_error("Failed to initialize curl");
 
+        // Clears the options of the previous request, the open connections are kept.
+        curl_easy_reset(curl);
+
         Response res;
         WriteThis wt;
 
@@ -123,7 +138,7 @@ namespace Http
         curl_easy_setopt(curl, CURLOPT_USERAGENT, OPENRCT2_USER_AGENT);
 
         curl_slist* chunk = nullptr;
-        std::shared_ptr<void> __(nullptr, [chunk](...) { curl_slist_free_all(chunk); });
+        std::shared_ptr<void> __(nullptr, [&chunk](...) { curl_slist_free_all(chunk); });
         for (auto header : req.header)
         {
             std::string hs = header.first + ": " + header.second;
@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_HTTP
+
+#    include "Http.h"
+
+#    include <condition_variable>
+#    include <deque>
+#    include <mutex>
+
+namespace Http
+{
+    // Requests are run by a few long-lived threads, which keep their connections open for the next request.
+    static constexpr size_t MaxConcurrentRequests = 4;
+
+    struct PendingRequest
+    {
+        Request Req;
+        std::function<void(Response& res)> Callback;
+    };
+
+    class RequestQueue
+    {
+    private:
+        std::mutex _mutex;
+        std::condition_variable _condPending;
+        std::deque<PendingRequest> _pending;
+        size_t _threadCount{};
+        size_t _idleCount{};
+
+    public:
+        static RequestQueue& Get()
+        {
+            // Never destroyed, the detached request threads may still wait on it while the game exits.
+            static auto* instance = new RequestQueue();
+            return *instance;
+        }
+
+        void Push(PendingRequest&& request)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pending.push_back(std::move(request));
+            if (_pending.size() > _idleCount && _threadCount < MaxConcurrentRequests)
+            {
+                _threadCount++;
+                std::thread(&RequestQueue::ProcessRequests, this).detach();
+            }
+            else
+            {
+                _condPending.notify_one();
+            }
+        }
+
+    private:
+        void ProcessRequests()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true)
+            {
+                _idleCount++;
+                _condPending.wait(lock, [this]() { return !_pending.empty(); });
+                _idleCount--;
+
+                auto request = std::move(_pending.front());
+                _pending.pop_front();
+                lock.unlock();
+
+                Response res{};
+                try
+                {
+                    res = Do(request.Req);
+                }
+                catch (const std::exception& e)
+                {
+                    res = {};
+                    res.error = e.what();
+                }
+                request.Callback(res);
+
+                lock.lock();
+            }
+        }
+    };
+
+    void DoAsync(const Request& req, std::function<void(Response& res)> fn)
+    {
+        RequestQueue::Get().Push({ req, std::move(fn) });
+    }
+} // namespace Http
+
+#endif // DISABLE_HTTP
@@ -54,23 +54,11 @@ namespace Http
 
     Response Do(const Request& req);
 
-    inline void DoAsync(const Request& req, std::function<void(Response& res)> fn)
-    {
-        auto thread = std::thread([=]() {
-            Response res{};
-            try
-            {
-                res = Do(req);
-            }
-            catch (std::exception& e)
-            {
-                res.error = e.what();
-                return;
-            }
-            fn(res);
-        });
-        thread.detach();
-    }
+    /**
+     * Queues the request to be run by one of the request threads, at most a few requests run at the same time. fn is
+     * called on that thread, with the status left as Invalid and error set if the request failed.
+     */
+    void DoAsync(const Request& req, std::function<void(Response& res)> fn);
 } // namespace Http
 
 #endif // DISABLE_HTTP
@@ -16,14 +16,18 @@
 #include "FileSystem.hpp"
 #include "Guard.hpp"
 #include "IStream.hpp"
+#include "JobPool.h"
 #include "Memory.hpp"
 #include "String.hpp"
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <png.h>
 #include <stdexcept>
 #include <unordered_map>
+#include <zlib.h>
 
 namespace Imaging
 {
@@ -163,6 +167,186 @@ namespace Imaging
         }
     }
 
+    static png_colorp SetPngPalette(png_structp png_ptr, png_infop info_ptr, const GamePalette& palette)
+    {
+        auto png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
+        if (png_palette == nullptr)
+        {
+            throw std::runtime_error("png_malloc failed.");
+        }
+        for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
+        {
+            const auto& entry = palette[static_cast<uint16_t>(i)];
+            png_palette[i].blue = entry.Blue;
+            png_palette[i].green = entry.Green;
+            png_palette[i].red = entry.Red;
+        }
+        png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+        return png_palette;
+    }
+
+    // Size of the filtered data each band of a large image is deflated in.
+    constexpr size_t PNG_BAND_SIZE = 256 * 1024;
+    // Deflate can refer back this far, each band is primed with the data that precedes it.
+    constexpr size_t DEFLATE_WINDOW_SIZE = 32 * 1024;
+    constexpr size_t PNG_IDAT_SIZE = 256 * 1024;
+
+    static uint8_t PaethPredictor(uint8_t a, uint8_t b, uint8_t c)
+    {
+        int32_t p = a + b - c;
+        int32_t pa = std::abs(p - a);
+        int32_t pb = std::abs(p - b);
+        int32_t pc = std::abs(p - c);
+        if (pa <= pb && pa <= pc)
+            return a;
+        if (pb <= pc)
+            return b;
+        return c;
+    }
+
+    /**
+     * Filters a row into dst, which is one byte longer for the filter type. Paletted rows are not filtered, as libpng
+     * does, other rows use the filter with the smallest sum of absolute differences.
+     */
+    static void FilterPngRow(const uint8_t* row, const uint8_t* prevRow, size_t length, size_t bpp, bool adaptive, uint8_t* dst)
+    {
+        if (!adaptive)
+        {
+            dst[0] = PNG_FILTER_VALUE_NONE;
+            std::memcpy(dst + 1, row, length);
+            return;
+        }
+
+        static thread_local std::vector<uint8_t> filtered;
+        filtered.resize(PNG_FILTER_VALUE_LAST * length);
+
+        uint32_t bestSum = UINT32_MAX;
+        int32_t bestFilter = PNG_FILTER_VALUE_NONE;
+        for (int32_t filter = PNG_FILTER_VALUE_NONE; filter < PNG_FILTER_VALUE_LAST; filter++)
+        {
+            auto* out = filtered.data() + filter * length;
+            uint32_t sum = 0;
+            for (size_t i = 0; i < length; i++)
+            {
+                uint8_t left = i >= bpp ? row[i - bpp] : 0;
+                uint8_t up = prevRow != nullptr ? prevRow[i] : 0;
+                uint8_t upLeft = prevRow != nullptr && i >= bpp ? prevRow[i - bpp] : 0;
+                uint8_t value = row[i];
+                switch (filter)
+                {
+                    case PNG_FILTER_VALUE_SUB:
+                        value -= left;
+                        break;
+                    case PNG_FILTER_VALUE_UP:
+                        value -= up;
+                        break;
+                    case PNG_FILTER_VALUE_AVG:
+                        value -= static_cast<uint8_t>((left + up) / 2);
+                        break;
+                    case PNG_FILTER_VALUE_PAETH:
+                        value -= PaethPredictor(left, up, upLeft);
+                        break;
+                }
+                out[i] = value;
+                sum += value < 128 ? value : 256 - value;
+            }
+            if (sum < bestSum)
+            {
+                bestSum = sum;
+                bestFilter = filter;
+            }
+        }
+        dst[0] = static_cast<uint8_t>(bestFilter);
+        std::memcpy(dst + 1, filtered.data() + bestFilter * length, length);
+    }
+
+    /**
+     * Deflates the filtered rows of a large image in bands on the job pool and writes them as one zlib stream. Every band
+     * is primed with the window that precedes it, so the result decodes as a whole and compresses almost as well.
+     */
+    static void WritePngBands(png_structp png_ptr, const Image& image, size_t rowsPerBand)
+    {
+        const size_t bpp = image.Depth / 8;
+        const size_t rowLength = image.Width * bpp;
+        const size_t filteredLength = rowLength + 1;
+        const bool adaptive = image.Depth != 8;
+
+        std::vector<uint8_t> filtered(filteredLength * image.Height);
+        JobPool::ParallelFor(0, image.Height, 64, [&](size_t y) {
+            const auto* row = image.Pixels.data() + y * image.Stride;
+            const auto* prevRow = y > 0 ? row - image.Stride : nullptr;
+            FilterPngRow(row, prevRow, rowLength, bpp, adaptive, filtered.data() + y * filteredLength);
+        });
+
+        const size_t bandLength = rowsPerBand * filteredLength;
+        const size_t bandCount = (filtered.size() + bandLength - 1) / bandLength;
+        std::vector<std::vector<uint8_t>> bands(bandCount);
+        std::vector<uLong> bandChecksums(bandCount);
+        std::vector<uint8_t> bandFailed(bandCount);
+        JobPool::ParallelFor(0, bandCount, 1, [&](size_t band) {
+            const size_t begin = band * bandLength;
+            const size_t length = std::min(bandLength, filtered.size() - begin);
+            const bool last = band == bandCount - 1;
+            bandChecksums[band] = adler32(adler32(0, Z_NULL, 0), filtered.data() + begin, static_cast<uInt>(length));
+
+            z_stream zs{};
+            auto strategy = adaptive ? Z_FILTERED : Z_DEFAULT_STRATEGY;
+            if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, strategy) != Z_OK)
+            {
+                bandFailed[band] = true;
+                return;
+            }
+            if (begin > 0)
+            {
+                const size_t dictLength = std::min(begin, DEFLATE_WINDOW_SIZE);
+                deflateSetDictionary(&zs, filtered.data() + begin - dictLength, static_cast<uInt>(dictLength));
+            }
+
+            // A sync flush ends the band on a byte boundary with an empty stored block.
+            auto& out = bands[band];
+            out.resize(deflateBound(&zs, static_cast<uLong>(length)) + 16);
+            zs.next_in = const_cast<Bytef*>(filtered.data() + begin);
+            zs.avail_in = static_cast<uInt>(length);
+            zs.next_out = out.data();
+            zs.avail_out = static_cast<uInt>(out.size());
+            auto result = deflate(&zs, last ? Z_FINISH : Z_SYNC_FLUSH);
+            if ((last && result != Z_STREAM_END) || (!last && (result != Z_OK || zs.avail_in != 0 || zs.avail_out == 0)))
+            {
+                bandFailed[band] = true;
+            }
+            out.resize(zs.total_out);
+            deflateEnd(&zs);
+        });
+        if (std::find(bandFailed.begin(), bandFailed.end(), 1) != bandFailed.end())
+        {
+            throw std::runtime_error("Unable to compress image.");
+        }
+
+        // Deflated bands need a zlib header and the checksum of all filtered data.
+        std::vector<uint8_t> idat = { 0x78, 0x9C };
+        for (const auto& band : bands)
+        {
+            idat.insert(idat.end(), band.begin(), band.end());
+        }
+        uLong checksum = bandChecksums[0];
+        for (size_t band = 1; band < bandCount; band++)
+        {
+            const size_t length = std::min(bandLength, filtered.size() - band * bandLength);
+            checksum = adler32_combine(checksum, bandChecksums[band], static_cast<z_off_t>(length));
+        }
+        idat.push_back(static_cast<uint8_t>(checksum >> 24));
+        idat.push_back(static_cast<uint8_t>(checksum >> 16));
+        idat.push_back(static_cast<uint8_t>(checksum >> 8));
+        idat.push_back(static_cast<uint8_t>(checksum));
+
+        for (size_t begin = 0; begin < idat.size(); begin += PNG_IDAT_SIZE)
+        {
+            const size_t length = std::min(PNG_IDAT_SIZE, idat.size() - begin);
+            png_write_chunk(png_ptr, reinterpret_cast<png_const_bytep>("IDAT"), idat.data() + begin, length);
+        }
+        png_write_chunk(png_ptr, reinterpret_cast<png_const_bytep>("IEND"), nullptr, 0);
+    }
+
     static void WritePng(std::ostream& ostream, const Image& image)
     {
         png_structp png_ptr = nullptr;
@@ -194,19 +378,7 @@ namespace Imaging
                 }
 
                 // Set the palette
-                png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
-                if (png_palette == nullptr)
-                {
-                    throw std::runtime_error("png_malloc failed.");
-                }
-                for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
-                {
-                    const auto& entry = (*image.Palette)[static_cast<uint16_t>(i)];
-                    png_palette[i].blue = entry.Blue;
-                    png_palette[i].green = entry.Green;
-                    png_palette[i].red = entry.Red;
-                }
-                png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+                png_palette = SetPngPalette(png_ptr, info_ptr, *image.Palette);
             }
 
             png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
@@ -232,14 +404,22 @@ namespace Imaging
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            const size_t rowsPerBand = std::max<size_t>(1, PNG_BAND_SIZE / (image.Width * (image.Depth / 8) + 1));
+            if (image.Height > rowsPerBand)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                WritePngBands(png_ptr, image, rowsPerBand);
             }
+            else
+            {
+                auto pixels = image.Pixels.data();
+                for (uint32_t y = 0; y < image.Height; y++)
+                {
+                    png_write_row(png_ptr, const_cast<png_byte*>(pixels));
+                    pixels += image.Stride;
+                }
 
-            png_write_end(png_ptr, nullptr);
+                png_write_end(png_ptr, nullptr);
+            }
             png_destroy_info_struct(png_ptr, &info_ptr);
             png_free(png_ptr, png_palette);
             png_destroy_write_struct(&png_ptr, nullptr);
@@ -324,6 +504,24 @@ namespace Imaging
         return ReadFromStream(istream, format);
     }
 
+    std::vector<Image> ReadFromFiles(
+        const std::vector<std::pair<std::string, IMAGE_FORMAT>>& files, std::vector<std::string>& errors)
+    {
+        std::vector<Image> result(files.size());
+        errors.assign(files.size(), {});
+        JobPool::ParallelFor(0, files.size(), 1, [&](size_t i) {
+            try
+            {
+                result[i] = ReadFromFile(files[i].first, files[i].second);
+            }
+            catch (const std::exception& e)
+            {
+                errors[i] = *e.what() != '\0' ? e.what() : "Unable to read image.";
+            }
+        });
+        return result;
+    }
+
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format)
     {
         switch (format)
@@ -341,4 +539,233 @@ namespace Imaging
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    struct PngStreamWriter::State
+    {
+        std::ofstream Stream;
+        png_structp Png{};
+        png_infop Info{};
+        png_colorp Palette{};
+        uint32_t Height{};
+        uint32_t RowsWritten{};
+
+        ~State()
+        {
+            if (Png != nullptr)
+            {
+                png_free(Png, Palette);
+                png_destroy_write_struct(&Png, &Info);
+            }
+        }
+    };
+
+    PngStreamWriter::PngStreamWriter(std::string_view path, uint32_t width, uint32_t height, const GamePalette& palette)
+        : _state(std::make_unique<State>())
+    {
+        auto& state = *_state;
+        state.Height = height;
+        state.Stream.open(fs::u8path(path), std::ios::binary);
+        if (!state.Stream.is_open())
+        {
+            throw std::runtime_error("Unable to open file for writing.");
+        }
+
+        state.Png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+        if (state.Png == nullptr)
+        {
+            throw std::runtime_error("png_create_write_struct failed.");
+        }
+        state.Info = png_create_info_struct(state.Png);
+        if (state.Info == nullptr)
+        {
+            throw std::runtime_error("png_create_info_struct failed.");
+        }
+
+        png_text text_ptr[1];
+        text_ptr[0].key = const_cast<char*>("Software");
+        text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
+        text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
+
+        state.Palette = SetPngPalette(state.Png, state.Info, palette);
+        png_set_write_fn(state.Png, &state.Stream, PngWriteData, PngFlush);
+
+        // Set error handler
+        if (setjmp(png_jmpbuf(state.Png)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+
+        // Write header
+        png_byte transparentIndex = 0;
+        png_set_tRNS(state.Png, state.Info, &transparentIndex, 1, nullptr);
+        png_set_text(state.Png, state.Info, text_ptr, 1);
+        png_set_IHDR(
+            state.Png, state.Info, width, height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+            PNG_FILTER_TYPE_DEFAULT);
+        png_write_info(state.Png, state.Info);
+    }
+
+    PngStreamWriter::~PngStreamWriter() = default;
+
+    void PngStreamWriter::WriteRows(const uint8_t* pixels, uint32_t rowCount, uint32_t stride)
+    {
+        auto& state = *_state;
+        if (state.RowsWritten + rowCount > state.Height)
+        {
+            throw std::runtime_error("Too many rows written to png.");
+        }
+
+        if (setjmp(png_jmpbuf(state.Png)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+        for (uint32_t y = 0; y < rowCount; y++)
+        {
+            png_write_row(state.Png, const_cast<png_byte*>(pixels));
+            pixels += stride;
+        }
+        state.RowsWritten += rowCount;
+    }
+
+    void PngStreamWriter::Finish()
+    {
+        auto& state = *_state;
+        if (state.RowsWritten != state.Height)
+        {
+            throw std::runtime_error("Not all rows have been written to png.");
+        }
+
+        if (setjmp(png_jmpbuf(state.Png)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+        png_write_end(state.Png, nullptr);
+        state.Stream.flush();
+    }
+
+    struct PngStreamReader::State
+    {
+        std::ifstream Stream;
+        png_structp Png{};
+        png_infop Info{};
+        uint32_t Width{};
+        uint32_t Height{};
+        uint32_t RowsRead{};
+        // The whole image, only used for interlaced images.
+        std::vector<uint8_t> Pixels;
+
+        ~State()
+        {
+            if (Png != nullptr)
+            {
+                png_destroy_read_struct(&Png, &Info, nullptr);
+            }
+        }
+    };
+
+    PngStreamReader::PngStreamReader(std::string_view path)
+        : _state(std::make_unique<State>())
+    {
+        auto& state = *_state;
+        state.Stream.open(fs::u8path(path), std::ios::binary);
+        if (!state.Stream.is_open())
+        {
+            throw std::runtime_error("Unable to open file for reading.");
+        }
+
+        state.Png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+        if (state.Png == nullptr)
+        {
+            throw std::runtime_error("png_create_read_struct failed.");
+        }
+        state.Info = png_create_info_struct(state.Png);
+        if (state.Info == nullptr)
+        {
+            throw std::runtime_error("png_create_info_struct failed.");
+        }
+
+        png_set_read_fn(state.Png, &state.Stream, PngReadData);
+
+        // Declared before setjmp so a png error does not skip its destructor
+        std::vector<png_bytep> rowPointers;
+
+        // Set error handler
+        if (setjmp(png_jmpbuf(state.Png)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+
+        png_read_info(state.Png, state.Info);
+        png_uint_32 pngWidth, pngHeight;
+        int bitDepth, colourType, interlaceType;
+        png_get_IHDR(
+            state.Png, state.Info, &pngWidth, &pngHeight, &bitDepth, &colourType, &interlaceType, nullptr, nullptr);
+
+        // Same transforms as reading a whole png expanded to 32bpp, plus an opaque alpha where there is none
+        png_set_strip_16(state.Png);
+        png_set_packing(state.Png);
+        png_set_expand(state.Png);
+        png_set_gray_to_rgb(state.Png);
+        if (!(colourType & PNG_COLOR_MASK_ALPHA) && !png_get_valid(state.Png, state.Info, PNG_INFO_tRNS))
+        {
+            png_set_filler(state.Png, 0xFF, PNG_FILLER_AFTER);
+        }
+        png_set_interlace_handling(state.Png);
+        png_read_update_info(state.Png, state.Info);
+
+        auto rowBytes = png_get_rowbytes(state.Png, state.Info);
+        if (rowBytes != pngWidth * 4)
+        {
+            throw std::runtime_error("Unexpected png row size.");
+        }
+        state.Width = pngWidth;
+        state.Height = pngHeight;
+
+        if (interlaceType != PNG_INTERLACE_NONE)
+        {
+            state.Pixels.resize(rowBytes * pngHeight);
+            rowPointers.resize(pngHeight);
+            for (png_uint_32 y = 0; y < pngHeight; y++)
+            {
+                rowPointers[y] = state.Pixels.data() + y * rowBytes;
+            }
+            png_read_image(state.Png, rowPointers.data());
+        }
+    }
+
+    PngStreamReader::~PngStreamReader() = default;
+
+    uint32_t PngStreamReader::GetWidth() const
+    {
+        return _state->Width;
+    }
+
+    uint32_t PngStreamReader::GetHeight() const
+    {
+        return _state->Height;
+    }
+
+    void PngStreamReader::ReadRow(uint8_t* pixels)
+    {
+        auto& state = *_state;
+        if (state.RowsRead >= state.Height)
+        {
+            throw std::runtime_error("Too many rows read from png.");
+        }
+
+        if (!state.Pixels.empty())
+        {
+            const auto rowBytes = static_cast<size_t>(state.Width) * 4;
+            std::copy_n(state.Pixels.data() + state.RowsRead * rowBytes, rowBytes, pixels);
+        }
+        else
+        {
+            if (setjmp(png_jmpbuf(state.Png)))
+            {
+                throw std::runtime_error("PNG ERROR");
+            }
+            png_read_row(state.Png, pixels, nullptr);
+        }
+        state.RowsRead++;
+    }
 } // namespace Imaging
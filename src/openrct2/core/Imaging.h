@@ -15,7 +15,9 @@
 #include <functional>
 #include <istream>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 struct rct_drawpixelinfo;
@@ -51,5 +53,55 @@ namespace Imaging
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
+    /**
+     * Reads several images at once on the job pool. An image that can not be read is left empty and the reason is put
+     * at its index in errors, which is empty for the images that were read.
+     */
+    std::vector<Image> ReadFromFiles(
+        const std::vector<std::pair<std::string, IMAGE_FORMAT>>& files, std::vector<std::string>& errors);
+
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
+
+    /**
+     * Writes an 8-bit paletted png a band of rows at a time, so the whole image never has to be held in memory.
+     */
+    class PngStreamWriter
+    {
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+
+    public:
+        PngStreamWriter(std::string_view path, uint32_t width, uint32_t height, const GamePalette& palette);
+        PngStreamWriter(const PngStreamWriter&) = delete;
+        PngStreamWriter& operator=(const PngStreamWriter&) = delete;
+        ~PngStreamWriter();
+
+        void WriteRows(const uint8_t* pixels, uint32_t rowCount, uint32_t stride);
+        // Must be called once all rows have been written.
+        void Finish();
+    };
+
+    /**
+     * Reads a png a row at a time as 32bpp RGBA, so the whole image never has to be held in memory. Interlaced images
+     * can not be read that way, they are decoded in full when opened.
+     */
+    class PngStreamReader
+    {
+    private:
+        struct State;
+        std::unique_ptr<State> _state;
+
+    public:
+        explicit PngStreamReader(std::string_view path);
+        PngStreamReader(const PngStreamReader&) = delete;
+        PngStreamReader& operator=(const PngStreamReader&) = delete;
+        ~PngStreamReader();
+
+        uint32_t GetWidth() const;
+        uint32_t GetHeight() const;
+
+        // Reads the next row into pixels, which must hold GetWidth() * 4 bytes.
+        void ReadRow(uint8_t* pixels);
+    };
 } // namespace Imaging
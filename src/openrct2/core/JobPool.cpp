@@ -9,65 +9,455 @@
 
 #include "JobPool.h"
 
+#include "../Diagnostic.h"
+#include "../profiling/Profiling.h"
+
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
-JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
-    : WorkFn(workFn)
-    , CompletionFn(completionFn)
-{
-}
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <pthread.h>
+#endif
+#ifdef __linux__
+#    include <sched.h>
+#endif
 
-JobPool::JobPool(size_t maxThreads)
+namespace
 {
-    maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
-    for (size_t n = 0; n < maxThreads; n++)
+    struct Job
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
-    }
-}
+        void (*Fn)(void* ctx);
+        void* Ctx;
+        // Identifies the group the job belongs to, so a waiting thread can pick up its own work.
+        const void* Tag;
+    };
 
-JobPool::~JobPool()
-{
+    constexpr size_t NoWorker = std::numeric_limits<size_t>::max();
+    thread_local size_t _workerIndex = NoWorker;
+    std::atomic<size_t> _maxParallelism = { 0 };
+
+    // Set by JobPool::Configure before the workers are started.
+    size_t _configuredWorkerCount = 0;
+    std::vector<size_t> _workerCpus;
+    bool _workersStarted = false;
+
+    /**
+     * Parses a list of cores such as "0-3,8". Returns false if the list is not valid.
+     */
+    bool ParseCpuList(std::string_view cpuList, std::vector<size_t>& cpus)
     {
-        unique_lock lock(_mutex);
-        _shouldStop = true;
-        _condPending.notify_all();
+        cpus.clear();
+        size_t pos = 0;
+        while (pos < cpuList.size())
+        {
+            auto end = cpuList.find(',', pos);
+            if (end == std::string_view::npos)
+            {
+                end = cpuList.size();
+            }
+            const auto part = std::string(cpuList.substr(pos, end - pos));
+            pos = end + 1;
+            if (part.empty())
+            {
+                continue;
+            }
+
+            char* rest = nullptr;
+            const auto first = std::strtoul(part.c_str(), &rest, 10);
+            auto last = first;
+            if (rest == part.c_str())
+            {
+                return false;
+            }
+            if (*rest == '-')
+            {
+                const char* lastStart = rest + 1;
+                last = std::strtoul(lastStart, &rest, 10);
+                if (rest == lastStart || last < first)
+                {
+                    return false;
+                }
+            }
+            if (*rest != '\0' || last >= 4096)
+            {
+                return false;
+            }
+            for (auto cpu = first; cpu <= last; cpu++)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return true;
     }
 
-    for (auto& th : _threads)
+    void SetCurrentThreadAffinity(const std::vector<size_t>& cpus)
     {
-        assert(th.joinable() != false);
-        th.join();
+        if (cpus.empty())
+        {
+            return;
+        }
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (auto cpu : cpus)
+        {
+            if (cpu < CPU_SETSIZE)
+            {
+                CPU_SET(cpu, &set);
+            }
+        }
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        {
+            log_warning("Unable to set the core affinity of a worker thread.");
+        }
+#elif defined(_WIN32)
+        // Only the cores of the first processor group can be selected.
+        DWORD_PTR mask = 0;
+        for (auto cpu : cpus)
+        {
+            if (cpu < sizeof(DWORD_PTR) * 8)
+            {
+                mask |= DWORD_PTR{ 1 } << cpu;
+            }
+        }
+        if (mask == 0 || SetThreadAffinityMask(GetCurrentThread(), mask) == 0)
+        {
+            log_warning("Unable to set the core affinity of a worker thread.");
+        }
+#else
+        log_verbose("Worker core affinity is not supported on this platform.");
+#endif
     }
+
+    class WorkerPool
+    {
+    private:
+        struct Worker
+        {
+            std::mutex Mutex;
+            std::deque<Job> Jobs;
+            std::atomic<uint64_t> JobsRun = { 0 };
+            std::atomic<uint64_t> BusyNanoseconds = { 0 };
+        };
+
+        std::vector<std::unique_ptr<Worker>> _workers;
+        std::vector<std::unique_ptr<std::thread>> _threads;
+        std::atomic<size_t> _queued = { 0 };
+        std::atomic<size_t> _sleeping = { 0 };
+        std::atomic<size_t> _nextWorker = { 0 };
+        std::atomic_bool _shouldStop = { false };
+        std::unique_ptr<std::condition_variable> _condWork = std::make_unique<std::condition_variable>();
+        std::mutex _sleepMutex;
+
+    public:
+        static WorkerPool& Get()
+        {
+            static WorkerPool instance;
+            return instance;
+        }
+
+        WorkerPool()
+        {
+            // The thread that waits on a job group helps out with it, so leave one core for it.
+            _workersStarted = true;
+            auto cores = _workerCpus.empty() ? static_cast<size_t>(std::thread::hardware_concurrency()) : _workerCpus.size();
+            auto count = std::max<size_t>(cores, 2) - 1;
+            if (_configuredWorkerCount != 0)
+            {
+                count = _configuredWorkerCount;
+            }
+            for (size_t n = 0; n < count; n++)
+            {
+                _workers.push_back(std::make_unique<Worker>());
+            }
+            StartThreads();
+
+#ifndef _WIN32
+            pthread_atfork(
+                [] { Get().LockForFork(); }, [] { Get().UnlockForFork(); },
+                [] {
+                    auto& pool = Get();
+                    pool.UnlockForFork();
+                    pool.RestartThreadsAfterFork();
+                });
+#endif
+        }
+
+        ~WorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _shouldStop = true;
+            }
+            _condWork->notify_all();
+
+            for (auto& th : _threads)
+            {
+                assert(th->joinable() != false);
+                th->join();
+            }
+        }
+
+        size_t GetWorkerCount() const
+        {
+            return _workers.size();
+        }
+
+        JobPool::WorkerStats GetStats() const
+        {
+            JobPool::WorkerStats stats{ _workers.size(), 0, 0 };
+            for (const auto& worker : _workers)
+            {
+                stats.JobsRun += worker->JobsRun.load(std::memory_order_relaxed);
+                stats.BusySeconds += worker->BusyNanoseconds.load(std::memory_order_relaxed) / 1e9;
+            }
+            return stats;
+        }
+
+        void Submit(const Job& job)
+        {
+            // Workers queue onto their own deque, everyone else distributes the jobs round-robin.
+            auto index = _workerIndex;
+            if (index == NoWorker)
+            {
+                index = _nextWorker.fetch_add(1, std::memory_order_relaxed) % _workers.size();
+            }
+
+            auto& worker = *_workers[index];
+            {
+                std::lock_guard<std::mutex> lock(worker.Mutex);
+                worker.Jobs.push_back(job);
+                _queued++;
+            }
+
+            if (_sleeping > 0)
+            {
+                // Taking the lock guarantees the sleeping worker is waiting on the condition before it is notified.
+                {
+                    std::lock_guard<std::mutex> lock(_sleepMutex);
+                }
+                _condWork->notify_one();
+            }
+        }
+
+        /**
+         * Runs one queued job with the given tag, or any job if tag is nullptr. Returns false if there was none.
+         */
+        bool TryRunJob(const void* tag)
+        {
+            Job job;
+            if (!TryTakeJob(tag, job))
+            {
+                return false;
+            }
+            job.Fn(job.Ctx);
+            return true;
+        }
+
+    private:
+        void StartThreads()
+        {
+            for (size_t n = 0; n < _workers.size(); n++)
+            {
+                _threads.push_back(std::make_unique<std::thread>(&WorkerPool::ProcessQueue, this, n));
+            }
+        }
+
+        // Holding every lock while forking keeps the child from inheriting a lock taken by a worker.
+        void LockForFork()
+        {
+            _sleepMutex.lock();
+            for (auto& worker : _workers)
+            {
+                worker->Mutex.lock();
+            }
+        }
+
+        void UnlockForFork()
+        {
+            for (auto& worker : _workers)
+            {
+                worker->Mutex.unlock();
+            }
+            _sleepMutex.unlock();
+        }
+
+        // Only the forking thread exists in the child. The handles of the parent's workers can neither be joined nor
+        // destroyed and the condition still counts them as waiters, so both are leaked.
+        void RestartThreadsAfterFork()
+        {
+            for (auto& th : _threads)
+            {
+                th.release();
+            }
+            _threads.clear();
+            _condWork.release();
+            _condWork = std::make_unique<std::condition_variable>();
+            _sleeping = 0;
+            StartThreads();
+        }
+
+        bool TryTakeJob(const void* tag, Job& job)
+        {
+            const auto count = _workers.size();
+            const auto start = _workerIndex == NoWorker ? 0 : _workerIndex;
+            for (size_t n = 0; n < count; n++)
+            {
+                auto& worker = *_workers[(start + n) % count];
+                std::lock_guard<std::mutex> lock(worker.Mutex);
+                auto& jobs = worker.Jobs;
+                if (tag == nullptr)
+                {
+                    if (jobs.empty())
+                    {
+                        continue;
+                    }
+                    // Take the newest job from our own deque and the oldest one when stealing.
+                    if (n == 0 && _workerIndex != NoWorker)
+                    {
+                        job = jobs.back();
+                        jobs.pop_back();
+                    }
+                    else
+                    {
+                        job = jobs.front();
+                        jobs.pop_front();
+                    }
+                    _queued--;
+                    return true;
+                }
+
+                auto it = std::find_if(jobs.begin(), jobs.end(), [tag](const Job& j) { return j.Tag == tag; });
+                if (it != jobs.end())
+                {
+                    job = *it;
+                    jobs.erase(it);
+                    _queued--;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void ProcessQueue(size_t index)
+        {
+            _workerIndex = index;
+            OpenRCT2::Profiling::SetThreadName("Worker " + std::to_string(index));
+            SetCurrentThreadAffinity(_workerCpus);
+
+            auto& worker = *_workers[index];
+            while (!_shouldStop)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                if (TryRunJob(nullptr))
+                {
+                    const auto busy = std::chrono::steady_clock::now() - start;
+                    worker.BusyNanoseconds.fetch_add(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(busy).count(), std::memory_order_relaxed);
+                    worker.JobsRun.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(_sleepMutex);
+                _sleeping++;
+                _condWork->wait(lock, [this]() { return _shouldStop || _queued > 0; });
+                _sleeping--;
+            }
+        }
+    };
+
+    struct ParallelForContext
+    {
+        std::atomic<size_t> Next;
+        size_t End;
+        size_t Grain;
+        void* Ctx;
+        JobPool::RangeFn Fn;
+
+        size_t Runners;
+        std::condition_variable CondDone;
+        std::mutex Mutex;
+
+        void Run()
+        {
+            while (true)
+            {
+                auto rangeBegin = Next.fetch_add(Grain);
+                if (rangeBegin >= End)
+                {
+                    break;
+                }
+                Fn(Ctx, rangeBegin, std::min(rangeBegin + Grain, End));
+            }
+        }
+
+        static void RunJob(void* ctx)
+        {
+            auto& context = *static_cast<ParallelForContext*>(ctx);
+            context.Run();
+
+            std::lock_guard<std::mutex> lock(context.Mutex);
+            context.Runners--;
+            if (context.Runners == 0)
+            {
+                context.CondDone.notify_all();
+            }
+        }
+    };
+} // namespace
+
+JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn, JobPool* owner)
+    : WorkFn(workFn)
+    , CompletionFn(completionFn)
+    , Owner(owner)
+{
+}
+
+JobPool::~JobPool()
+{
+    // Tasks refer back to the pool, so they must not outlive it.
+    Join();
 }
 
 void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
 {
-    unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    TaskData* taskData;
+    {
+        unique_lock lock(_mutex);
+        taskData = &_tasks.emplace_back(workFn, completionFn, this);
+        _outstanding++;
+    }
+    WorkerPool::Get().Submit({ &JobPool::RunTask, taskData, this });
 }
 
 void JobPool::Join(std::function<void()> reportFn)
 {
+    auto& workers = WorkerPool::Get();
     unique_lock lock(_mutex);
     while (true)
     {
-        // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
-
         // Dispatch all completion callbacks if there are any.
         while (!_completed.empty())
         {
-            auto taskData = _completed.front();
+            auto* taskData = _completed.front();
             _completed.pop_front();
 
-            if (taskData.CompletionFn)
+            if (taskData->CompletionFn)
             {
                 lock.unlock();
 
-                taskData.CompletionFn();
+                taskData->CompletionFn();
 
                 lock.lock();
             }
@@ -83,43 +473,116 @@ void JobPool::Join(std::function<void()> reportFn)
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (_completed.empty() && _outstanding == 0)
         {
             break;
         }
+
+        // Rather than idling, run one of our own tasks that has not been picked up yet. Workers joining a nested pool
+        // may run anything, otherwise all workers could end up waiting on each other.
+        lock.unlock();
+        bool ranTask = workers.TryRunJob(this) || (_workerIndex != NoWorker && workers.TryRunJob(nullptr));
+        lock.lock();
+
+        if (!ranTask)
+        {
+            // Wait for the remaining tasks to finish or for completed tasks.
+            _condComplete.wait(lock, [this]() { return _outstanding == 0 || !_completed.empty(); });
+        }
     }
+    _tasks.clear();
 }
 
 size_t JobPool::CountPending()
 {
-    return _pending.size();
+    unique_lock lock(_mutex);
+    return _outstanding;
 }
 
-void JobPool::ProcessQueue()
+size_t JobPool::GetWorkerCount()
 {
-    unique_lock lock(_mutex);
-    do
+    return WorkerPool::Get().GetWorkerCount();
+}
+
+void JobPool::Configure(size_t workerCount, std::string_view cpuList)
+{
+    if (_workersStarted)
     {
-        // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        log_warning("The worker threads have already been started, their configuration is not changed.");
+        return;
+    }
 
-        if (!_pending.empty())
-        {
-            _processing++;
+    _configuredWorkerCount = workerCount;
+    if (!ParseCpuList(cpuList, _workerCpus))
+    {
+        log_warning("Invalid worker core list '%s', the workers may run on any core.", std::string(cpuList).c_str());
+        _workerCpus.clear();
+    }
+}
+
+JobPool::WorkerStats JobPool::GetWorkerStats()
+{
+    return WorkerPool::Get().GetStats();
+}
 
-            auto taskData = _pending.front();
-            _pending.pop_front();
+void JobPool::SetMaxParallelism(size_t threads)
+{
+    _maxParallelism = threads;
+}
 
-            lock.unlock();
+void JobPool::RunTask(void* ctx)
+{
+    auto* taskData = static_cast<TaskData*>(ctx);
+    taskData->WorkFn();
 
-            taskData.WorkFn();
+    auto* owner = taskData->Owner;
+    unique_lock lock(owner->_mutex);
+    owner->_completed.push_back(taskData);
+    owner->_outstanding--;
+    owner->_condComplete.notify_one();
+}
 
-            lock.lock();
+void JobPool::ParallelForRange(size_t begin, size_t end, size_t grain, void* ctx, RangeFn fn)
+{
+    if (begin >= end)
+    {
+        return;
+    }
 
-            _completed.push_back(std::move(taskData));
+    auto& workers = WorkerPool::Get();
+    grain = std::max<size_t>(grain, 1);
+    auto chunks = (end - begin + grain - 1) / grain;
+    auto runners = std::min(chunks - 1, workers.GetWorkerCount());
+    const auto maxParallelism = _maxParallelism.load(std::memory_order_relaxed);
+    if (maxParallelism != 0)
+    {
+        runners = std::min(runners, maxParallelism - 1);
+    }
+    if (runners == 0)
+    {
+        fn(ctx, begin, end);
+        return;
+    }
 
-            _processing--;
-            _condComplete.notify_one();
-        }
-    } while (!_shouldStop);
+    ParallelForContext context;
+    context.Next = begin;
+    context.End = end;
+    context.Grain = grain;
+    context.Ctx = ctx;
+    context.Fn = fn;
+    context.Runners = runners;
+    for (size_t n = 0; n < runners; n++)
+    {
+        workers.Submit({ &ParallelForContext::RunJob, &context, &context });
+    }
+
+    context.Run();
+
+    // Runners that have not started yet would find no work left, run them here instead of waiting for a worker.
+    while (workers.TryRunJob(&context))
+    {
+    }
+
+    std::unique_lock<std::mutex> lock(context.Mutex);
+    context.CondDone.wait(lock, [&context]() { return context.Runners == 0; });
 }
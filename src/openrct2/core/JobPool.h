@@ -11,42 +11,92 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
 #include <deque>
 #include <functional>
 #include <mutex>
-#include <thread>
-#include <vector>
+#include <string_view>
+#include <type_traits>
 
+/**
+ * A group of tasks that is executed by the shared worker threads. The workers are started once and each own a job
+ * deque, idle workers steal from the others. Creating a JobPool is cheap as it does not spawn any threads itself.
+ */
 class JobPool
 {
+public:
+    using RangeFn = void (*)(void* ctx, size_t begin, size_t end);
+
+    struct WorkerStats
+    {
+        size_t Workers;
+        uint64_t JobsRun;
+        double BusySeconds;
+    };
+
 private:
     struct TaskData
     {
         const std::function<void()> WorkFn;
         const std::function<void()> CompletionFn;
+        JobPool* const Owner;
 
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn);
+        TaskData(std::function<void()> workFn, std::function<void()> completionFn, JobPool* owner);
     };
 
-    std::atomic_bool _shouldStop = { false };
-    std::atomic<size_t> _processing = { 0 };
-    std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
-    std::deque<TaskData> _completed;
-    std::condition_variable _condPending;
+    size_t _outstanding = 0;
+    std::deque<TaskData> _tasks;
+    std::deque<TaskData*> _completed;
     std::condition_variable _condComplete;
     std::mutex _mutex;
 
     using unique_lock = std::unique_lock<std::mutex>;
 
 public:
-    JobPool(size_t maxThreads = 255);
+    JobPool() = default;
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
     ~JobPool();
 
     void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
     void Join(std::function<void()> reportFn = nullptr);
     size_t CountPending();
 
+    /**
+     * Calls fn(i) for every i in [begin, end), handing out chunks of grain indices to the workers and the calling
+     * thread. Returns once all indices have been processed.
+     */
+    template<typename TFn> static void ParallelFor(size_t begin, size_t end, size_t grain, TFn&& fn)
+    {
+        using TFunc = std::remove_reference_t<TFn>;
+        auto* ctx = const_cast<void*>(static_cast<const void*>(&fn));
+        ParallelForRange(begin, end, grain, ctx, [](void* fnCtx, size_t rangeBegin, size_t rangeEnd) {
+            auto& func = *static_cast<TFunc*>(fnCtx);
+            for (size_t i = rangeBegin; i < rangeEnd; i++)
+            {
+                func(i);
+            }
+        });
+    }
+
+    static size_t GetWorkerCount();
+
+    /**
+     * Sets up the shared workers, which only has an effect before they are first used. workerCount 0 picks one worker
+     * per core the process may run on, leaving one for the calling thread. cpuList restricts the workers to the listed
+     * cores, e.g. "0-3,8", an empty list lets them run anywhere.
+     */
+    static void Configure(size_t workerCount, std::string_view cpuList);
+
+    // Totals over all shared workers since they were started.
+    static WorkerStats GetWorkerStats();
+
+    /**
+     * Limits the number of threads ParallelFor spreads the work over, the calling thread included. 0 removes the limit.
+     */
+    static void SetMaxParallelism(size_t threads);
+
 private:
-    void ProcessQueue();
+    static void ParallelForRange(size_t begin, size_t end, size_t grain, void* ctx, RangeFn fn);
+    static void RunTask(void* ctx);
 };
@@ -12,10 +12,94 @@
 #include "Memory.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <mutex>
+#include <vector>
 
 namespace OpenRCT2
 {
+    namespace
+    {
+        // Shared by all threads, as background saves give their buffer back on the thread that wrote the file.
+        class MemoryStreamPool
+        {
+        private:
+            struct Buffer
+            {
+                void* Data;
+                size_t Capacity;
+            };
+
+            static constexpr size_t MaxBuffers = 2;
+            // Larger buffers are freed, so a single huge park does not keep its memory around.
+            static constexpr size_t MaxBufferCapacity = 64 * 1024 * 1024;
+
+            std::vector<Buffer> _buffers;
+            std::array<size_t, static_cast<size_t>(MemoryStreamUsage::Count)> _lengthHints{};
+            std::mutex _mutex;
+
+        public:
+            static MemoryStreamPool& Get()
+            {
+                static MemoryStreamPool pool;
+                return pool;
+            }
+
+            ~MemoryStreamPool()
+            {
+                for (auto& buffer : _buffers)
+                {
+                    Memory::Free(buffer.Data);
+                }
+            }
+
+            /**
+             * Takes the smallest buffer that fits the length of the previous stream of the same usage, or the largest
+             * one if none does.
+             */
+            Buffer Take(MemoryStreamUsage usage, size_t& length)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                length = _lengthHints[static_cast<size_t>(usage)];
+                if (_buffers.empty())
+                {
+                    return {};
+                }
+
+                auto best = _buffers.begin();
+                for (auto it = _buffers.begin(); it != _buffers.end(); it++)
+                {
+                    auto fits = it->Capacity >= length;
+                    auto bestFits = best->Capacity >= length;
+                    if (fits ? (!bestFits || it->Capacity < best->Capacity) : (!bestFits && it->Capacity > best->Capacity))
+                    {
+                        best = it;
+                    }
+                }
+                auto result = *best;
+                _buffers.erase(best);
+                return result;
+            }
+
+            void Give(MemoryStreamUsage usage, void* data, size_t capacity, size_t length)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _lengthHints[static_cast<size_t>(usage)] = length;
+                if (data == nullptr)
+                {
+                    return;
+                }
+                if (_buffers.size() >= MaxBuffers || capacity > MaxBufferCapacity)
+                {
+                    Memory::Free(data);
+                    return;
+                }
+                _buffers.push_back({ data, capacity });
+            }
+        };
+    } // namespace
+
     MemoryStream::MemoryStream(const MemoryStream& copy)
     {
         _access = copy._access;
@@ -67,38 +151,72 @@ namespace OpenRCT2
         , _dataSize(mv._dataSize)
         , _data(mv._data)
         , _position(mv._position)
+        , _usage(mv._usage)
     {
         mv._data = nullptr;
         mv._position = nullptr;
         mv._dataCapacity = 0;
         mv._dataSize = 0;
+        mv._usage = MemoryStreamUsage::None;
     }
 
     MemoryStream::~MemoryStream()
+    {
+        ReleaseData();
+    }
+
+    void MemoryStream::ReleaseData()
     {
         if (_access & MEMORY_ACCESS::OWNER)
         {
-            Memory::Free(_data);
+            if (_usage != MemoryStreamUsage::None)
+            {
+                MemoryStreamPool::Get().Give(_usage, _data, _dataCapacity, _dataSize);
+            }
+            else
+            {
+                Memory::Free(_data);
+            }
         }
         _dataCapacity = 0;
         _dataSize = 0;
         _data = nullptr;
+        _position = nullptr;
+        _usage = MemoryStreamUsage::None;
+    }
+
+    MemoryStream MemoryStream::CreatePooled(MemoryStreamUsage usage)
+    {
+        size_t length = 0;
+        auto buffer = MemoryStreamPool::Get().Take(usage, length);
+
+        MemoryStream result;
+        result._usage = usage;
+        result._data = buffer.Data;
+        result._dataCapacity = buffer.Capacity;
+        result._position = result._data;
+        result.EnsureCapacity(length);
+        return result;
     }
 
     MemoryStream& MemoryStream::operator=(MemoryStream&& mv) noexcept
     {
         if (this != &mv)
         {
+            ReleaseData();
+
             _access = mv._access;
             _dataCapacity = mv._dataCapacity;
             _data = mv._data;
             _dataSize = mv._dataSize;
             _position = mv._position;
+            _usage = mv._usage;
 
             mv._data = nullptr;
             mv._position = nullptr;
             mv._dataCapacity = 0;
             mv._dataSize = 0;
+            mv._usage = MemoryStreamUsage::None;
         }
 
         return *this;
@@ -119,6 +237,7 @@ namespace OpenRCT2
     void* MemoryStream::TakeData()
     {
         _access &= ~MEMORY_ACCESS::OWNER;
+        _usage = MemoryStreamUsage::None;
         return _data;
     }
 
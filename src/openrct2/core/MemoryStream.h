@@ -23,6 +23,19 @@ namespace OpenRCT2
         constexpr uint8_t OWNER = 1 << 2;
     }; // namespace MEMORY_ACCESS
 
+    /**
+     * Kinds of transient streams that are built over and over again, see MemoryStream::CreatePooled.
+     */
+    enum class MemoryStreamUsage : uint8_t
+    {
+        None,
+        ParkSave,
+        MapSend,
+        Snapshot,
+        Replay,
+        Count,
+    };
+
     /**
      * A stream for reading and writing to a buffer in memory. By default this buffer can grow.
      */
@@ -34,6 +47,7 @@ namespace OpenRCT2
         size_t _dataSize = 0;
         void* _data = nullptr;
         void* _position = nullptr;
+        MemoryStreamUsage _usage = MemoryStreamUsage::None;
 
     public:
         MemoryStream() = default;
@@ -47,6 +61,13 @@ namespace OpenRCT2
 
         MemoryStream& operator=(MemoryStream&& mv) noexcept;
 
+        /**
+         * Creates a growable stream whose buffer is taken from a shared pool and handed back to it when the stream is
+         * destroyed, unless the data is taken. It starts out with the length the previous stream of the same usage ended
+         * up with, so repeated saves and sends do not have to grow their buffer again.
+         */
+        static MemoryStream CreatePooled(MemoryStreamUsage usage);
+
         const void* GetData() const override;
         void* GetDataCopy() const;
         void* TakeData();
@@ -115,6 +136,7 @@ namespace OpenRCT2
 
     private:
         void EnsureCapacity(size_t capacity);
+        void ReleaseData();
     };
 
 } // namespace OpenRCT2
@@ -14,6 +14,10 @@
 #include <limits>
 #include <type_traits>
 
+#ifdef _MSC_VER
+#    include <intrin.h>
+#endif
+
 namespace Numerics
 {
     /**
@@ -68,6 +72,30 @@ namespace Numerics
         return (x >> shift | x << (4 - shift)) & 0x0F;
     }
 
+    /**
+     * Index of the least significant set bit
+     * @param x unsigned 64-bit integer value, must not be zero
+     * @return number of trailing zero bits
+     */
+    [[maybe_unused]] static inline size_t ctz64(uint64_t x)
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long i;
+        _BitScanForward64(&i, x);
+        return i;
+#elif defined(__GNUC__)
+        return static_cast<size_t>(__builtin_ctzll(x));
+#else
+        size_t i = 0;
+        while ((x & 1u) == 0)
+        {
+            x >>= 1u;
+            i++;
+        }
+        return i;
+#endif
+    }
+
     const constexpr auto rol8 = rol<uint8_t>;
     const constexpr auto ror8 = ror<uint8_t>;
     const constexpr auto rol16 = rol<uint16_t>;
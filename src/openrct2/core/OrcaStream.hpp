@@ -13,11 +13,14 @@
 #include "Crypt.h"
 #include "FileStream.h"
 #include "Identifier.hpp"
+#include "JobPool.h"
 #include "MemoryStream.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <stack>
@@ -37,8 +40,12 @@ namespace OpenRCT2
 
         static constexpr uint32_t COMPRESSION_NONE = 0;
         static constexpr uint32_t COMPRESSION_GZIP = 1;
+        // The data is split into blocks that are gzipped independently, so they can be (de)compressed in parallel.
+        static constexpr uint32_t COMPRESSION_GZIP_BLOCKS = 2;
 
     private:
+        static constexpr uint32_t COMPRESSION_BLOCK_SIZE = 1024 * 1024;
+
 #pragma pack(push, 1)
         struct Header
         {
@@ -62,6 +69,38 @@ namespace OpenRCT2
         };
 #pragma pack(pop)
 
+    public:
+        /**
+         * The data and compressed blocks of a previous write. Blocks whose data has not changed since are reused instead
+         * of being compressed again.
+         */
+        struct BlockCache
+        {
+            std::vector<uint8_t> UncompressedData;
+            std::vector<std::vector<uint8_t>> CompressedBlocks;
+        };
+
+        /**
+         * Serialised chunks of a writing stream that still have to be compressed and written. This no longer touches any
+         * game state, so it can be written from another thread.
+         */
+        class PendingWrite
+        {
+            friend OrcaStream;
+
+        private:
+            Header _header{};
+            std::vector<ChunkEntry> _chunks;
+            MemoryStream _buffer;
+
+        public:
+            void Write(IStream& stream, BlockCache* blockCache = nullptr)
+            {
+                OrcaStream::Write(stream, _header, _chunks, _buffer, blockCache);
+            }
+        };
+
+    private:
         IStream* _stream;
         Mode _mode;
         Header _header;
@@ -69,6 +108,13 @@ namespace OpenRCT2
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
 
+        // State of a COMPRESSION_GZIP_BLOCKS stream that is being read.
+        MemoryStream _compressedBuffer;
+        std::vector<uint64_t> _blockOffsets;
+        std::vector<uint8_t> _blockLoaded;
+        std::vector<uint8_t> _uncompressedData;
+        uint32_t _blockSize{};
+
     public:
         OrcaStream(IStream& stream, const Mode mode)
         {
@@ -100,7 +146,7 @@ namespace OpenRCT2
                 // Uncompress
                 if (_header.Compression == COMPRESSION_GZIP)
                 {
-                    auto uncompressedData = Ungzip(_buffer.GetData(), _buffer.GetLength());
+                    auto uncompressedData = Ungzip(_buffer.GetData(), _buffer.GetLength(), static_cast<size_t>(_header.UncompressedSize));
                     if (_header.UncompressedSize != uncompressedData.size())
                     {
                         // Warning?
@@ -108,13 +154,22 @@ namespace OpenRCT2
                     _buffer.Clear();
                     _buffer.Write(uncompressedData.data(), uncompressedData.size());
                 }
+                else if (_header.Compression == COMPRESSION_GZIP_BLOCKS)
+                {
+                    // Blocks are only decompressed once a chunk that lies in them is read.
+                    ReadBlockTable();
+                }
+                else if (_header.Compression != COMPRESSION_NONE)
+                {
+                    throw std::runtime_error("Unsupported compression type.");
+                }
             }
             else
             {
                 _header = {};
-                _header.Compression = COMPRESSION_GZIP;
+                _header.Compression = COMPRESSION_GZIP_BLOCKS;
 
-                _buffer = MemoryStream{};
+                _buffer = MemoryStream::CreatePooled(MemoryStreamUsage::ParkSave);
             }
         }
 
@@ -122,51 +177,25 @@ namespace OpenRCT2
 
         ~OrcaStream()
         {
-            if (_mode == Mode::WRITING)
+            if (_mode == Mode::WRITING && _stream != nullptr)
             {
-                const void* uncompressedData = _buffer.GetData();
-                const uint64_t uncompressedSize = _buffer.GetLength();
-
-                _header.NumChunks = static_cast<uint32_t>(_chunks.size());
-                _header.UncompressedSize = uncompressedSize;
-                _header.CompressedSize = uncompressedSize;
-                _header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
-
-                // Compress data
-                std::optional<std::vector<uint8_t>> compressedBytes;
-                if (_header.Compression == COMPRESSION_GZIP)
-                {
-                    compressedBytes = Gzip(uncompressedData, uncompressedSize);
-                    if (compressedBytes)
-                    {
-                        _header.CompressedSize = compressedBytes->size();
-                    }
-                    else
-                    {
-                        // Compression failed
-                        _header.Compression = COMPRESSION_NONE;
-                    }
-                }
-
-                // Write header and chunk table
-                _stream->WriteValue(_header);
-                for (const auto& chunk : _chunks)
-                {
-                    _stream->WriteValue(chunk);
-                }
-
-                // Write chunk data
-                if (compressedBytes)
-                {
-                    _stream->Write(compressedBytes->data(), compressedBytes->size());
-                }
-                else
-                {
-                    _stream->Write(uncompressedData, uncompressedSize);
-                }
+                Write(*_stream, _header, _chunks, _buffer, nullptr);
             }
         }
 
+        /**
+         * Takes the serialised chunks out of a writing stream, which then no longer writes anything when it is destroyed.
+         */
+        PendingWrite TakePendingWrite()
+        {
+            PendingWrite result;
+            result._header = _header;
+            result._chunks = std::move(_chunks);
+            result._buffer = std::move(_buffer);
+            _stream = nullptr;
+            return result;
+        }
+
         Mode GetMode() const
         {
             return _mode;
@@ -207,12 +236,223 @@ namespace OpenRCT2
         }
 
     private:
+        static void Write(
+            IStream& stream, Header& header, const std::vector<ChunkEntry>& chunks, const MemoryStream& buffer,
+            BlockCache* blockCache)
+        {
+            const void* uncompressedData = buffer.GetData();
+            const uint64_t uncompressedSize = buffer.GetLength();
+
+            header.NumChunks = static_cast<uint32_t>(chunks.size());
+            header.UncompressedSize = uncompressedSize;
+            header.CompressedSize = uncompressedSize;
+            header.FNV1a = Crypt::FNV1a(uncompressedData, uncompressedSize);
+
+            // Compress data
+            std::optional<std::vector<uint8_t>> compressedBytes;
+            std::vector<std::vector<uint8_t>> compressedBlocks;
+            if (header.Compression == COMPRESSION_GZIP_BLOCKS)
+            {
+                compressedBlocks = CompressBlocks(static_cast<const uint8_t*>(uncompressedData), uncompressedSize, blockCache);
+                if (compressedBlocks.size() == GetNumBlocks(uncompressedSize, COMPRESSION_BLOCK_SIZE))
+                {
+                    header.CompressedSize = sizeof(uint32_t) * 2;
+                    for (const auto& block : compressedBlocks)
+                    {
+                        header.CompressedSize += sizeof(uint64_t) + block.size();
+                    }
+                }
+                else
+                {
+                    // Compression failed
+                    header.Compression = COMPRESSION_NONE;
+                }
+            }
+            else if (header.Compression == COMPRESSION_GZIP)
+            {
+                compressedBytes = Gzip(uncompressedData, uncompressedSize);
+                if (compressedBytes)
+                {
+                    header.CompressedSize = compressedBytes->size();
+                }
+                else
+                {
+                    // Compression failed
+                    header.Compression = COMPRESSION_NONE;
+                }
+            }
+
+            // Write header and chunk table
+            stream.WriteValue(header);
+            for (const auto& chunk : chunks)
+            {
+                stream.WriteValue(chunk);
+            }
+
+            // Write chunk data
+            if (header.Compression == COMPRESSION_GZIP_BLOCKS)
+            {
+                stream.WriteValue<uint32_t>(COMPRESSION_BLOCK_SIZE);
+                stream.WriteValue<uint32_t>(static_cast<uint32_t>(compressedBlocks.size()));
+                for (const auto& block : compressedBlocks)
+                {
+                    stream.WriteValue<uint64_t>(block.size());
+                }
+                for (const auto& block : compressedBlocks)
+                {
+                    stream.Write(block.data(), block.size());
+                }
+
+                if (blockCache != nullptr)
+                {
+                    const auto* data = static_cast<const uint8_t*>(uncompressedData);
+                    blockCache->UncompressedData.assign(data, data + uncompressedSize);
+                    blockCache->CompressedBlocks = std::move(compressedBlocks);
+                }
+            }
+            else if (compressedBytes)
+            {
+                stream.Write(compressedBytes->data(), compressedBytes->size());
+            }
+            else
+            {
+                stream.Write(uncompressedData, uncompressedSize);
+            }
+        }
+
+        static uint64_t GetNumBlocks(uint64_t length, uint64_t blockSize)
+        {
+            return (length + blockSize - 1) / blockSize;
+        }
+
+        static bool IsBlockUnchanged(const BlockCache* cache, size_t index, const uint8_t* data, uint64_t length)
+        {
+            if (cache == nullptr || index >= cache->CompressedBlocks.size())
+            {
+                return false;
+            }
+            const auto offset = static_cast<uint64_t>(index) * COMPRESSION_BLOCK_SIZE;
+            const auto cachedLength = std::min<uint64_t>(cache->UncompressedData.size() - offset, COMPRESSION_BLOCK_SIZE);
+            return cachedLength == length
+                && std::memcmp(data, cache->UncompressedData.data() + offset, static_cast<size_t>(length)) == 0;
+        }
+
+        /**
+         * Gzips every block of the data on the worker pool, blocks that are unchanged in the cache are copied from it.
+         * Returns no blocks if any of them failed to compress.
+         */
+        static std::vector<std::vector<uint8_t>> CompressBlocks(const uint8_t* data, uint64_t length, const BlockCache* cache)
+        {
+            std::vector<std::vector<uint8_t>> blocks(static_cast<size_t>(GetNumBlocks(length, COMPRESSION_BLOCK_SIZE)));
+            std::atomic_bool failed = false;
+            JobPool::ParallelFor(0, blocks.size(), 1, [&](size_t i) {
+                const auto offset = static_cast<uint64_t>(i) * COMPRESSION_BLOCK_SIZE;
+                const auto blockLength = std::min<uint64_t>(length - offset, COMPRESSION_BLOCK_SIZE);
+                if (IsBlockUnchanged(cache, i, data + offset, blockLength))
+                {
+                    blocks[i] = cache->CompressedBlocks[i];
+                    return;
+                }
+                try
+                {
+                    blocks[i] = Gzip(data + offset, static_cast<size_t>(blockLength));
+                }
+                catch (const std::exception&)
+                {
+                    failed = true;
+                }
+            });
+            if (failed)
+            {
+                blocks.clear();
+            }
+            return blocks;
+        }
+
+        void ReadBlockTable()
+        {
+            _compressedBuffer = std::move(_buffer);
+            _compressedBuffer.SetPosition(0);
+            _blockSize = _compressedBuffer.ReadValue<uint32_t>();
+            const auto numBlocks = _compressedBuffer.ReadValue<uint32_t>();
+            if (_blockSize == 0 || numBlocks != GetNumBlocks(_header.UncompressedSize, _blockSize))
+            {
+                throw std::runtime_error("Invalid compressed block table.");
+            }
+
+            const auto compressedLength = _compressedBuffer.GetLength();
+            _blockOffsets.resize(numBlocks + 1);
+            _blockOffsets[0] = _compressedBuffer.GetPosition() + numBlocks * sizeof(uint64_t);
+            for (uint32_t i = 0; i < numBlocks; i++)
+            {
+                const auto blockLength = _compressedBuffer.ReadValue<uint64_t>();
+                if (blockLength > compressedLength || _blockOffsets[i] + blockLength > compressedLength)
+                {
+                    throw std::runtime_error("Invalid compressed block table.");
+                }
+                _blockOffsets[i + 1] = _blockOffsets[i] + blockLength;
+            }
+
+            _blockLoaded.assign(numBlocks, 0);
+            _uncompressedData.resize(static_cast<size_t>(_header.UncompressedSize));
+            _buffer = MemoryStream(_uncompressedData.data(), _uncompressedData.size());
+        }
+
+        /**
+         * Decompresses the blocks covering the given range of the uncompressed data that have not been loaded yet.
+         */
+        void LoadBlocks(uint64_t offset, uint64_t length)
+        {
+            const auto end = std::min<uint64_t>(offset + length, _uncompressedData.size());
+            if (_blockLoaded.empty() || offset >= end)
+            {
+                return;
+            }
+
+            const auto* data = static_cast<const uint8_t*>(_compressedBuffer.GetData());
+            std::atomic_bool failed = false;
+            JobPool::ParallelFor(
+                static_cast<size_t>(offset / _blockSize), static_cast<size_t>((end - 1) / _blockSize + 1), 1, [&](size_t i) {
+                    if (_blockLoaded[i])
+                    {
+                        return;
+                    }
+
+                    const auto blockOffset = static_cast<uint64_t>(i) * _blockSize;
+                    const auto blockLength = static_cast<size_t>(
+                        std::min<uint64_t>(_uncompressedData.size() - blockOffset, _blockSize));
+                    try
+                    {
+                        auto block = Ungzip(
+                            data + _blockOffsets[i], static_cast<size_t>(_blockOffsets[i + 1] - _blockOffsets[i]), blockLength);
+                        if (block.size() == blockLength)
+                        {
+                            std::memcpy(_uncompressedData.data() + blockOffset, block.data(), blockLength);
+                            _blockLoaded[i] = 1;
+                        }
+                        else
+                        {
+                            failed = true;
+                        }
+                    }
+                    catch (const std::exception&)
+                    {
+                        failed = true;
+                    }
+                });
+            if (failed)
+            {
+                throw std::runtime_error("Unable to decompress data.");
+            }
+        }
+
         bool SeekChunk(const uint32_t id)
         {
             const auto result = std::find_if(_chunks.begin(), _chunks.end(), [id](const ChunkEntry& e) { return e.Id == id; });
             if (result != _chunks.end())
             {
                 const auto offset = result->Offset;
+                LoadBlocks(offset, result->Length);
                 _buffer.SetPosition(offset);
                 return true;
             }
@@ -186,6 +186,32 @@ namespace Random
         }
     };
 
+    /**
+     * Mixes value into the hash h, using the block mixing step of MurmurHash3.
+     */
+    constexpr uint32_t HashCombine(uint32_t h, uint32_t value)
+    {
+        value *= 0xCC9E2D51;
+        value = rol32(value, 15);
+        value *= 0x1B873593;
+        h ^= value;
+        h = rol32(h, 13);
+        return h * 5 + 0xE6546B64;
+    }
+
+    /**
+     * Final avalanche step of MurmurHash3, so that hashes of similar keys differ in about half of their bits.
+     */
+    constexpr uint32_t HashFinalise(uint32_t h)
+    {
+        h ^= h >> 16;
+        h *= 0x85EBCA6B;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35;
+        h ^= h >> 16;
+        return h;
+    }
+
     namespace Rct2
     {
         using Engine = RotateEngine<uint32_t, 0x1234567F, 7, 3>;
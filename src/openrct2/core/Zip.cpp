@@ -12,6 +12,7 @@
 #include "IStream.hpp"
 
 #include <algorithm>
+#include <unordered_map>
 #ifndef __ANDROID__
 #    include <zip.h>
 #endif
@@ -74,6 +75,10 @@ private:
     ZIP_ACCESS _access;
     std::vector<std::vector<uint8_t>> _writeBuffers;
 
+    // Normalised paths of a read-only archive, built on the first look up. Objects look up each of their images.
+    mutable std::unordered_map<std::string, size_t> _indexFromPath;
+    mutable bool _indexFromPathBuilt{};
+
 public:
     ZipArchive(std::string_view path, ZIP_ACCESS access)
     {
@@ -125,6 +130,37 @@ public:
         return 0;
     }
 
+    std::optional<size_t> GetIndexFromPath(std::string_view path) const override
+    {
+        if (_access != ZIP_ACCESS::READ)
+        {
+            return IZipArchive::GetIndexFromPath(path);
+        }
+
+        if (!_indexFromPathBuilt)
+        {
+            auto numFiles = GetNumFiles();
+            _indexFromPath.reserve(numFiles);
+            for (size_t i = 0; i < numFiles; i++)
+            {
+                // Keep the first match, as the linear search does.
+                _indexFromPath.emplace(NormalisePath(GetFileName(i)), i);
+            }
+            _indexFromPathBuilt = true;
+        }
+
+        auto normalisedPath = NormalisePath(path);
+        if (!normalisedPath.empty())
+        {
+            auto it = _indexFromPath.find(normalisedPath);
+            if (it != _indexFromPath.end())
+            {
+                return it->second;
+            }
+        }
+        return std::nullopt;
+    }
+
     std::vector<uint8_t> GetFileData(std::string_view path) const override
     {
         std::vector<uint8_t> result;
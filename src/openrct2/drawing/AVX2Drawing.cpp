@@ -42,6 +42,106 @@ void mask_avx2(
     }
 }
 
+// Looks up every byte of indices in a 256 entry table split into 16 rows of 16 entries, each row is repeated in both
+// lanes as the shuffle does not cross lanes.
+static __m256i remap_lookup_avx2(const __m256i (&table)[16], __m256i indices)
+{
+    const __m256i lowMask = _mm256_set1_epi8(0x0F);
+    const __m256i low = _mm256_and_si256(indices, lowMask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(indices, 4), lowMask);
+    __m256i result = _mm256_setzero_si256();
+    for (int32_t row = 0; row < 16; row++)
+    {
+        const __m256i select = _mm256_cmpeq_epi8(high, _mm256_set1_epi8(static_cast<char>(row)));
+        result = _mm256_or_si256(result, _mm256_and_si256(_mm256_shuffle_epi8(table[row], low), select));
+    }
+    return result;
+}
+
+void remap_run_avx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+{
+    int32_t i = 0;
+    if (count >= 32)
+    {
+        __m256i table[16];
+        for (int32_t row = 0; row < 16; row++)
+        {
+            table[row] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(map + row * 16)));
+        }
+
+        const __m256i zero256 = {};
+        for (; i + 32 <= count; i += 32)
+        {
+            const __m256i source = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            const __m256i pixel = remap_lookup_avx2(table, remapDst ? dest : source);
+            // Keep the destination where the source is transparent or remaps to transparent.
+            const __m256i keep = _mm256_or_si256(_mm256_cmpeq_epi8(source, zero256), _mm256_cmpeq_epi8(pixel, zero256));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(pixel, dest, keep));
+        }
+    }
+    // Any CPU with AVX2 also has SSE4.1, which still covers the part of a short run that fits 16 pixels.
+    remap_run_sse4_1(src + i, dst + i, map, count - i, remapDst);
+}
+
+void light_blend_run_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+{
+    int32_t i = 0;
+    const __m256i zero256 = {};
+    const __m256i scale = _mm256_set1_epi16(static_cast<int16_t>(intensity + 1));
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i source = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        // Unpacking and packing both work per 128 bit lane, so the pixels come out in their original order.
+        const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(source, zero256), scale), 8);
+        const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(source, zero256), scale), 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_adds_epu8(dest, _mm256_packus_epi16(lo, hi)));
+    }
+    light_blend_run_sse4_1(src + i, dst + i, count - i, intensity);
+}
+
+void filter_run_avx2(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count)
+{
+    int32_t i = 0;
+    if (count >= 32)
+    {
+        __m256i table[16];
+        for (int32_t row = 0; row < 16; row++)
+        {
+            table[row] = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(map + row * 16)));
+        }
+
+        for (; i + 32 <= count; i += 32)
+        {
+            const __m256i dest = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), remap_lookup_avx2(table, dest));
+        }
+    }
+    filter_run_scalar(dst + i, map, count - i);
+}
+
+void palette_convert_run_avx2(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t count)
+{
+    int32_t i = 0;
+    const auto* table = reinterpret_cast<const int*>(palette);
+    for (; i + 32 <= count; i += 32)
+    {
+        // Widen 8 indices at a time and gather their colours, four gathers are kept in flight.
+        const __m256i indices0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        const __m256i indices1 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + 8)));
+        const __m256i indices2 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + 16)));
+        const __m256i indices3 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i + 24)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_i32gather_epi32(table, indices0, 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 8), _mm256_i32gather_epi32(table, indices1, 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 16), _mm256_i32gather_epi32(table, indices2, 4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 24), _mm256_i32gather_epi32(table, indices3, 4));
+    }
+    palette_convert_run_scalar(src + i, dst + i, palette, count - i);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +155,26 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void remap_run_avx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void light_blend_run_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void filter_run_avx2(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void palette_convert_run_avx2(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t count)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
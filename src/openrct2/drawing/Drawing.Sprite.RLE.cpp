@@ -166,6 +166,21 @@ static void FASTCALL DrawRLESpriteMinify(rct_drawpixelinfo& dpi, const DrawSprit
             else
             {
                 auto& paletteMap = args.PalMap;
+                if constexpr (
+                    TZoom == 0 && (TBlendOp & BLEND_TRANSPARENT) != 0
+                    && ((TBlendOp & BLEND_SRC) == 0 || (TBlendOp & BLEND_DST) == 0))
+                {
+                    // The run is contiguous at this zoom level, so it can be remapped at once.
+                    auto map = paletteMap.GetFullMap();
+                    if (map != nullptr)
+                    {
+                        if (numPixels > 0)
+                        {
+                            remap_run_fn(src, dst, map, numPixels, (TBlendOp & BLEND_DST) != 0);
+                        }
+                        continue;
+                    }
+                }
                 while (numPixels > 0)
                 {
                     BlitPixel<TBlendOp>(src, dst, paletteMap);
@@ -0,0 +1,209 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../sprites.h"
+#include "Drawing.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    struct ZoomedSprite
+    {
+        uint32_t Key;
+        size_t Slot;
+        rct_g1_element Element;
+        std::vector<uint8_t> Data;
+    };
+
+    constexpr size_t SlotCount = 1 << 16;
+    constexpr size_t MaxEntries = SlotCount / 2;
+    constexpr size_t MaxDataSize = 64 * 1024 * 1024;
+
+    // Open addressing table that is only ever appended to while drawing, so lookups do not need to take the lock.
+    std::array<std::atomic<const ZoomedSprite*>, SlotCount> _slots{};
+    std::vector<std::unique_ptr<ZoomedSprite>> _entries;
+    size_t _dataSize{};
+    std::atomic_bool _full{};
+    std::mutex _mutex;
+
+    constexpr uint32_t GetKey(ImageIndex imageIndex, ZoomLevel zoom)
+    {
+        return (static_cast<uint32_t>(imageIndex) << 3) | static_cast<uint32_t>(static_cast<int8_t>(zoom));
+    }
+
+    constexpr size_t GetSlot(uint32_t key)
+    {
+        return (key * 2654435761u) >> 16;
+    }
+
+    const ZoomedSprite* Find(uint32_t key)
+    {
+        for (auto slot = GetSlot(key);; slot = (slot + 1) % SlotCount)
+        {
+            auto* sprite = _slots[slot].load(std::memory_order_acquire);
+            if (sprite == nullptr || sprite->Key == key)
+            {
+                return sprite;
+            }
+        }
+    }
+
+    /**
+     * Builds a copy of an RLE sprite that keeps every 2^zoom'th pixel of every 2^zoom'th row, to be drawn at zoom level 0.
+     */
+    std::unique_ptr<ZoomedSprite> BuildZoomedSprite(const rct_g1_element& g1, ZoomLevel zoom)
+    {
+        const auto level = static_cast<int8_t>(zoom);
+        const int32_t factor = 1 << level;
+        const int32_t width = (g1.width + factor - 1) >> level;
+        const int32_t height = (g1.height + factor - 1) >> level;
+        if (g1.offset == nullptr || width <= 0 || height <= 0)
+        {
+            return nullptr;
+        }
+
+        auto result = std::make_unique<ZoomedSprite>();
+        auto& data = result->Data;
+        data.resize(static_cast<size_t>(height) * 2);
+
+        // Pixels of the current source row, -1 where it is transparent.
+        std::vector<int16_t> row(g1.width);
+        for (int32_t y = 0; y < height; y++)
+        {
+            std::fill(row.begin(), row.end(), -1);
+            const auto* src0 = g1.offset;
+            const int32_t srcY = y * factor;
+            auto nextRun = src0 + (src0[srcY * 2] | (src0[srcY * 2 + 1] << 8));
+            bool isEndOfLine = false;
+            while (!isEndOfLine)
+            {
+                auto src = nextRun;
+                auto dataSize = *src++;
+                auto firstPixelX = *src++;
+                isEndOfLine = (dataSize & 0x80) != 0;
+                dataSize &= 0x7F;
+                nextRun = src + dataSize;
+                for (int32_t i = 0; i < dataSize && firstPixelX + i < g1.width; i++)
+                {
+                    row[firstPixelX + i] = src[i];
+                }
+            }
+
+            // Line offsets are 16 bit, so the sprite can not be cached if the data grows beyond that.
+            if (data.size() > 0xFFFF)
+            {
+                return nullptr;
+            }
+            data[y * 2] = static_cast<uint8_t>(data.size());
+            data[y * 2 + 1] = static_cast<uint8_t>(data.size() >> 8);
+
+            size_t lastRun = SIZE_MAX;
+            int32_t x = 0;
+            while (x < width)
+            {
+                if (row[x * factor] < 0)
+                {
+                    x++;
+                    continue;
+                }
+
+                lastRun = data.size();
+                data.push_back(0);
+                data.push_back(static_cast<uint8_t>(x));
+                uint8_t numPixels = 0;
+                for (; x < width && row[x * factor] >= 0 && numPixels < 127; x++, numPixels++)
+                {
+                    data.push_back(static_cast<uint8_t>(row[x * factor]));
+                }
+                data[lastRun] = numPixels;
+            }
+
+            if (lastRun == SIZE_MAX)
+            {
+                // Empty lines still need a run to end them.
+                data.push_back(0x80);
+                data.push_back(0);
+            }
+            else
+            {
+                data[lastRun] |= 0x80;
+            }
+        }
+
+        result->Element.offset = data.data();
+        result->Element.width = width;
+        result->Element.height = height;
+        result->Element.flags = G1_FLAG_RLE_COMPRESSION;
+        return result;
+    }
+} // namespace
+
+const rct_g1_element* gfx_get_zoomed_sprite(ImageIndex imageIndex, const rct_g1_element& g1, ZoomLevel zoom)
+{
+    const auto key = GetKey(imageIndex, zoom);
+    if (const auto* sprite = Find(key); sprite != nullptr)
+    {
+        return &sprite->Element;
+    }
+
+    // The temporary image is replaced all the time.
+    if (imageIndex == SPR_TEMP || _full.load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    // Build outside of the lock, another thread might end up building the same sprite but that is cheaper than making
+    // every thread wait.
+    auto sprite = BuildZoomedSprite(g1, zoom);
+    if (sprite == nullptr)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (const auto* existing = Find(key); existing != nullptr)
+    {
+        return &existing->Element;
+    }
+    if (_entries.size() >= MaxEntries || _dataSize + sprite->Data.size() > MaxDataSize)
+    {
+        _full = true;
+        return nullptr;
+    }
+
+    auto slot = GetSlot(key);
+    while (_slots[slot].load(std::memory_order_relaxed) != nullptr)
+    {
+        slot = (slot + 1) % SlotCount;
+    }
+    sprite->Key = key;
+    sprite->Slot = slot;
+    _dataSize += sprite->Data.size();
+    auto* result = _entries.emplace_back(std::move(sprite)).get();
+    _slots[slot].store(result, std::memory_order_release);
+    return &result->Element;
+}
+
+void gfx_invalidate_zoomed_sprites()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& sprite : _entries)
+    {
+        _slots[sprite->Slot].store(nullptr, std::memory_order_relaxed);
+    }
+    _entries.clear();
+    _dataSize = 0;
+    _full = false;
+}
@@ -23,6 +23,7 @@
 #include "ScrollingText.h"
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -180,6 +181,22 @@ void mask_scalar(
     }
 }
 
+void remap_run_scalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (src[i] != 0)
+        {
+            auto pixel = map[remapDst ? dst[i] : src[i]];
+            if (pixel != 0)
+            {
+                dst[i] = pixel;
+            }
+        }
+    }
+}
+
 static rct_gx _g1 = {};
 static rct_gx _g2 = {};
 static rct_gx _csg = {};
@@ -188,8 +205,44 @@ static bool _csgLoaded = false;
 
 static rct_g1_element _g1Temp = {};
 static std::vector<rct_g1_element> _imageListElements;
+// Every loaded element by image id, so that looking one up is a single load. Ids that are not loaded are nullptr and
+// take the range checks in gfx_get_g1_element. Rebuilt whenever a range is loaded, unloaded or moved.
+static std::vector<const rct_g1_element*> _elementLookup;
+// Changes whenever the element lookup is rebuilt, the palettes the colour remaps are built from may have moved.
+static uint32_t _elementLookupGeneration = 1;
 bool gTinyFontAntiAliased = false;
 
+static void gfx_add_to_element_lookup(size_t begin, size_t maxCount, const rct_g1_element* elements, size_t count)
+{
+    count = std::min(count, maxCount);
+    for (size_t i = 0; i < count; i++)
+    {
+        _elementLookup[begin + i] = &elements[i];
+    }
+}
+
+static void gfx_rebuild_element_lookup()
+{
+    _elementLookupGeneration++;
+    _elementLookup.assign(SPR_IMAGE_LIST_BEGIN + _imageListElements.size(), nullptr);
+    gfx_add_to_element_lookup(0, SPR_RCTC_G1_END, _g1.elements.data(), _g1.elements.size());
+    gfx_add_to_element_lookup(
+        SPR_G2_BEGIN, SPR_G2_END - SPR_G2_BEGIN, _g2.elements.data(),
+        std::min<size_t>(_g2.header.num_entries, _g2.elements.size()));
+    if (_csgLoaded)
+    {
+        gfx_add_to_element_lookup(
+            SPR_CSG_BEGIN, SPR_CSG_END - SPR_CSG_BEGIN, _csg.elements.data(),
+            std::min<size_t>(_csg.header.num_entries, _csg.elements.size()));
+    }
+    gfx_add_to_element_lookup(
+        SPR_SCROLLING_TEXT_START, SPR_SCROLLING_TEXT_END - SPR_SCROLLING_TEXT_START, _scrollingText,
+        std::size(_scrollingText));
+    gfx_add_to_element_lookup(
+        SPR_IMAGE_LIST_BEGIN, SPR_IMAGE_LIST_END - SPR_IMAGE_LIST_BEGIN, _imageListElements.data(),
+        _imageListElements.size());
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -224,6 +277,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         {
             _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
         }
+        gfx_rebuild_element_lookup();
         return true;
     }
     catch (const std::exception&)
@@ -243,23 +297,30 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
+    gfx_invalidate_zoomed_sprites();
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
+    gfx_rebuild_element_lookup();
 }
 
 void gfx_unload_g2()
 {
+    gfx_invalidate_zoomed_sprites();
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
+    gfx_rebuild_element_lookup();
 }
 
 void gfx_unload_csg()
 {
+    gfx_invalidate_zoomed_sprites();
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
+    _csgLoaded = false;
+    gfx_rebuild_element_lookup();
 }
 
 bool gfx_load_g2()
@@ -287,6 +348,7 @@ bool gfx_load_g2()
         {
             _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
         }
+        gfx_rebuild_element_lookup();
         return true;
     }
     catch (const std::exception&)
@@ -350,6 +412,7 @@ bool gfx_load_csg()
             }
         }
         _csgLoaded = true;
+        gfx_rebuild_element_lookup();
         return true;
     }
     catch (const std::exception&)
@@ -387,6 +450,17 @@ std::optional<rct_gx> GfxLoadGx(const std::vector<uint8_t>& buffer)
     return std::nullopt;
 }
 
+// Fully resolved palette maps for sprites with two or three remap colours, keyed by the colours. Each drawing thread
+// keeps its own, as the maps are built in thread local palettes.
+struct RemapPaletteCacheEntry
+{
+    uint32_t Key;
+    uint32_t Generation;
+    uint8_t Map[256];
+};
+static constexpr size_t RemapPaletteCacheSize = 64;
+static thread_local std::array<RemapPaletteCacheEntry, RemapPaletteCacheSize> _remapPaletteCache;
+
 static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId imageId)
 {
     if (!imageId.HasSecondary())
@@ -399,6 +473,18 @@ static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId im
         return GetPaletteMapForColour(paletteId);
     }
 
+    uint32_t key = imageId.GetPrimary() | (imageId.GetSecondary() << 8);
+    if (imageId.HasTertiary())
+    {
+        key |= (imageId.GetTertiary() << 16) | (1u << 24);
+    }
+    auto& entry = _remapPaletteCache[(key * 0x9E3779B1u) >> 26];
+    static_assert(RemapPaletteCacheSize == 1 << (32 - 26));
+    if (entry.Key == key && entry.Generation == _elementLookupGeneration)
+    {
+        return PaletteMap(entry.Map);
+    }
+
     auto paletteMap = PaletteMap(gPeepPalette);
     if (imageId.HasTertiary())
     {
@@ -425,7 +511,10 @@ static std::optional<PaletteMap> FASTCALL gfx_draw_sprite_get_palette(ImageId im
             PALETTE_OFFSET_REMAP_SECONDARY, secondaryPaletteMap.value(), PALETTE_OFFSET_REMAP_PRIMARY, PALETTE_LENGTH_REMAP);
     }
 
-    return paletteMap;
+    entry.Key = key;
+    entry.Generation = _elementLookupGeneration;
+    PaletteMap(entry.Map).Copy(0, paletteMap, 0, std::size(entry.Map));
+    return PaletteMap(entry.Map);
 }
 
 void FASTCALL gfx_draw_sprite_software(rct_drawpixelinfo* dpi, ImageId imageId, const ScreenCoordsXY& spriteCoords)
@@ -441,6 +530,13 @@ void FASTCALL gfx_draw_sprite_software(rct_drawpixelinfo* dpi, ImageId imageId,
     }
 }
 
+static void FASTCALL gfx_draw_sprite_element_software(
+    rct_drawpixelinfo* dpi, ImageId imageId, const rct_g1_element* g1, const ScreenCoordsXY& coords,
+    const PaletteMap& paletteMap);
+
+// Sprites drawn at this zoom level or further out are drawn from a downscaled copy.
+static constexpr ZoomLevel ZoomedSpriteMinZoom{ 2 };
+
 /*
  * rct: 0x0067A46E
  * image_id (ebx) and also (0x00EDF81C)
@@ -484,6 +580,37 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
         return;
     }
 
+    if (dpi->zoom_level >= ZoomedSpriteMinZoom && (g1->flags & G1_FLAG_RLE_COMPRESSION))
+    {
+        // Skipping through the full size RLE data is slower than drawing a cached downscaled copy at zoom level 0.
+        const auto* zoomedG1 = gfx_get_zoomed_sprite(imageId.GetIndex(), *g1, dpi->zoom_level);
+        if (zoomedG1 != nullptr)
+        {
+            const auto& zoom = dpi->zoom_level;
+            rct_drawpixelinfo zoomed_dpi = *dpi;
+            zoomed_dpi.x = zoom.ApplyInversedTo(dpi->x);
+            zoomed_dpi.y = zoom.ApplyInversedTo(dpi->y);
+            zoomed_dpi.width = zoom.ApplyInversedTo(dpi->width);
+            zoomed_dpi.height = zoom.ApplyInversedTo(dpi->height);
+            zoomed_dpi.zoom_level = ZoomLevel{ 0 };
+
+            const auto spriteCoords = ScreenCoordsXY{ zoom.ApplyInversedTo(x + g1->x_offset),
+                                                      zoom.ApplyInversedTo(y + g1->y_offset) };
+            gfx_draw_sprite_element_software(&zoomed_dpi, imageId, zoomedG1, spriteCoords, paletteMap);
+            return;
+        }
+    }
+
+    gfx_draw_sprite_element_software(dpi, imageId, g1, coords, paletteMap);
+}
+
+static void FASTCALL gfx_draw_sprite_element_software(
+    rct_drawpixelinfo* dpi, ImageId imageId, const rct_g1_element* g1, const ScreenCoordsXY& coords,
+    const PaletteMap& paletteMap)
+{
+    int32_t x = coords.x;
+    int32_t y = coords.y;
+
     // Its used super often so we will define it to a separate variable.
     const auto zoom_level = dpi->zoom_level;
     const int32_t zoom_mask = zoom_level > ZoomLevel{ 0 } ? zoom_level.ApplyTo(0xFFFFFFFF) : 0xFFFFFFFF;
@@ -691,6 +818,11 @@ const rct_g1_element* gfx_get_g1_element(ImageIndex image_id)
         return nullptr;
     }
 
+    if (offset < _elementLookup.size() && _elementLookup[offset] != nullptr)
+    {
+        return _elementLookup[offset];
+    }
+
     if (offset == SPR_TEMP)
     {
         return &_g1Temp;
@@ -765,6 +897,12 @@ void gfx_set_g1_element(ImageIndex imageId, const rct_g1_element* g1)
         }
         else if (isValid)
         {
+            if (imageId < SPR_SCROLLING_TEXT_START || imageId >= SPR_SCROLLING_TEXT_END)
+            {
+                // Scrolling text is not RLE compressed and never cached, everything else might be.
+                gfx_invalidate_zoomed_sprites();
+            }
+
             if (imageId < SPR_RCTC_G1_END)
             {
                 if (imageId < static_cast<ImageIndex>(_g1.elements.size()))
@@ -784,9 +922,13 @@ void gfx_set_g1_element(ImageIndex imageId, const rct_g1_element* g1)
             {
                 size_t idx = static_cast<size_t>(imageId) - SPR_IMAGE_LIST_BEGIN;
                 // Grow the element buffer if necessary
-                while (idx >= _imageListElements.size())
+                if (idx >= _imageListElements.size())
                 {
-                    _imageListElements.resize(std::max<size_t>(256, _imageListElements.size() * 2));
+                    while (idx >= _imageListElements.size())
+                    {
+                        _imageListElements.resize(std::max<size_t>(256, _imageListElements.size() * 2));
+                    }
+                    gfx_rebuild_element_lookup();
                 }
                 _imageListElements[idx] = *g1;
             }
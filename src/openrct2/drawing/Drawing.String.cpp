@@ -25,6 +25,8 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 
 using namespace OpenRCT2;
 
@@ -42,11 +44,74 @@ enum : uint32_t
 
 static int32_t ttf_get_string_width(std::string_view text, FontSpriteBase fontSpriteBase, bool noFormatting);
 
+enum class TextLayoutKind : uint8_t
+{
+    Wrap,
+    Clip,
+    NewLinedWidth,
+};
+
 /**
- *
- *  rct2: 0x006C23B1
+ * The result of laying out a string for a given width and font. Windows lay out the same strings every frame, so the
+ * line breaks and widths are kept in a small direct mapped cache per thread.
  */
-int32_t gfx_get_string_width_new_lined(std::string_view text, FontSpriteBase fontSpriteBase)
+struct TextLayoutCacheEntry
+{
+    uint32_t Generation{};
+    TextLayoutKind Kind{};
+    FontSpriteBase Font{};
+    int32_t MaxWidth{};
+    std::string Text;
+    // The text as rewritten by the layout, including any inserted line breaks or ellipsis.
+    std::string Result;
+    int32_t Width{};
+    int32_t NumLines{};
+};
+
+static constexpr size_t TextLayoutCacheSize = 256;
+
+// Bumped when the language or fonts change, which invalidates the entries of every thread.
+static std::atomic<uint32_t> _textLayoutGeneration{ 1 };
+
+/**
+ * Returns the cache slot for the given layout. On a miss the slot is claimed for the layout and the caller has to fill
+ * in the result.
+ */
+static TextLayoutCacheEntry& text_layout_cache_get(
+    TextLayoutKind kind, std::string_view text, int32_t maxWidth, FontSpriteBase fontSpriteBase, bool& hit)
+{
+    thread_local std::array<TextLayoutCacheEntry, TextLayoutCacheSize> cache;
+
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (auto c : text)
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    hash = (hash ^ static_cast<uint32_t>(maxWidth)) * 16777619u;
+    hash = (hash ^ (static_cast<uint32_t>(kind) << 16 | static_cast<uint16_t>(fontSpriteBase))) * 16777619u;
+
+    auto& entry = cache[hash % TextLayoutCacheSize];
+    auto generation = _textLayoutGeneration.load(std::memory_order_relaxed);
+    hit = entry.Generation == generation && entry.Kind == kind && entry.Font == fontSpriteBase && entry.MaxWidth == maxWidth
+        && entry.Text == text;
+    if (!hit)
+    {
+        entry.Generation = generation;
+        entry.Kind = kind;
+        entry.Font = fontSpriteBase;
+        entry.MaxWidth = maxWidth;
+        entry.Text = text;
+    }
+    return entry;
+}
+
+void gfx_text_layout_cache_invalidate()
+{
+    _textLayoutGeneration++;
+}
+
+static int32_t gfx_get_string_width_new_lined_uncached(std::string_view text, FontSpriteBase fontSpriteBase)
 {
     thread_local std::string buffer;
     buffer.clear();
@@ -76,6 +141,21 @@ int32_t gfx_get_string_width_new_lined(std::string_view text, FontSpriteBase fon
     return maxWidth.value();
 }
 
+/**
+ *
+ *  rct2: 0x006C23B1
+ */
+int32_t gfx_get_string_width_new_lined(std::string_view text, FontSpriteBase fontSpriteBase)
+{
+    bool hit;
+    auto& entry = text_layout_cache_get(TextLayoutKind::NewLinedWidth, text, 0, fontSpriteBase, hit);
+    if (!hit)
+    {
+        entry.Width = gfx_get_string_width_new_lined_uncached(text, fontSpriteBase);
+    }
+    return entry.Width;
+}
+
 /**
  * Return the width of the string in buffer
  *
@@ -92,21 +172,8 @@ int32_t gfx_get_string_width_no_formatting(std::string_view text, FontSpriteBase
     return ttf_get_string_width(text, fontSpriteBase, true);
 }
 
-/**
- * Clip the text in buffer to width, add ellipsis and return the new width of the clipped string
- *
- *  rct2: 0x006C2460
- * buffer (esi)
- * width (edi)
- */
-int32_t gfx_clip_string(utf8* text, int32_t width, FontSpriteBase fontSpriteBase)
+static int32_t gfx_clip_string_uncached(utf8* text, int32_t width, FontSpriteBase fontSpriteBase)
 {
-    if (width < 6)
-    {
-        *text = 0;
-        return 0;
-    }
-
     // If width of the full string is less than allowed width then we don't need to clip
     auto clippedWidth = gfx_get_string_width(text, fontSpriteBase);
     if (clippedWidth <= width)
@@ -162,22 +229,41 @@ int32_t gfx_clip_string(utf8* text, int32_t width, FontSpriteBase fontSpriteBase
 }
 
 /**
- * Wrap the text in buffer to width, returns width of longest line.
- *
- * Inserts NULL where line should break (as \n is used for something else),
- * so the number of lines is returned in num_lines. font_height seems to be
- * a control character for line height.
+ * Clip the text in buffer to width, add ellipsis and return the new width of the clipped string
  *
- *  rct2: 0x006C21E2
+ *  rct2: 0x006C2460
  * buffer (esi)
- * width (edi) - in
- * num_lines (edi) - out
- * font_height (ebx) - out
+ * width (edi)
  */
-int32_t gfx_wrap_string(utf8* text, int32_t width, FontSpriteBase fontSpriteBase, int32_t* outNumLines)
+int32_t gfx_clip_string(utf8* text, int32_t width, FontSpriteBase fontSpriteBase)
+{
+    if (width < 6)
+    {
+        *text = 0;
+        return 0;
+    }
+
+    bool hit;
+    auto& entry = text_layout_cache_get(TextLayoutKind::Clip, text, width, fontSpriteBase, hit);
+    if (hit)
+    {
+        std::strcpy(text, entry.Result.c_str());
+    }
+    else
+    {
+        entry.Width = gfx_clip_string_uncached(text, width, fontSpriteBase);
+        entry.Result = text;
+    }
+    return entry.Width;
+}
+
+/**
+ * Wraps text to width into buffer, which receives the lines separated by NULL. Returns the width of the longest line.
+ */
+static int32_t gfx_wrap_string_uncached(
+    std::string_view text, int32_t width, FontSpriteBase fontSpriteBase, std::string& buffer, int32_t* outNumLines)
 {
     constexpr size_t NULL_INDEX = std::numeric_limits<size_t>::max();
-    thread_local std::string buffer;
     buffer.resize(0);
 
     size_t currentLineIndex = 0;
@@ -186,7 +272,7 @@ int32_t gfx_wrap_string(utf8* text, int32_t width, FontSpriteBase fontSpriteBase
     size_t numLines = 0;
     int32_t maxWidth = 0;
 
-    FmtString fmt = text;
+    FmtString fmt(text);
     for (const auto& token : fmt)
     {
         if (token.IsLiteral())
@@ -261,11 +347,36 @@ int32_t gfx_wrap_string(utf8* text, int32_t width, FontSpriteBase fontSpriteBase
         maxWidth = std::max(maxWidth, lineWidth);
     }
 
-    std::memcpy(text, buffer.data(), buffer.size() + 1);
     *outNumLines = static_cast<int32_t>(numLines);
     return maxWidth;
 }
 
+/**
+ * Wrap the text in buffer to width, returns width of longest line.
+ *
+ * Inserts NULL where line should break (as \n is used for something else),
+ * so the number of lines is returned in num_lines. font_height seems to be
+ * a control character for line height.
+ *
+ *  rct2: 0x006C21E2
+ * buffer (esi)
+ * width (edi) - in
+ * num_lines (edi) - out
+ * font_height (ebx) - out
+ */
+int32_t gfx_wrap_string(utf8* text, int32_t width, FontSpriteBase fontSpriteBase, int32_t* outNumLines)
+{
+    bool hit;
+    auto& entry = text_layout_cache_get(TextLayoutKind::Wrap, text, width, fontSpriteBase, hit);
+    if (!hit)
+    {
+        entry.Width = gfx_wrap_string_uncached(text, width, fontSpriteBase, entry.Result, &entry.NumLines);
+    }
+    std::memcpy(text, entry.Result.data(), entry.Result.size() + 1);
+    *outNumLines = entry.NumLines;
+    return entry.Width;
+}
+
 /**
  * Draws text that is left aligned and vertically centred.
  */
@@ -531,66 +642,18 @@ static void ttf_draw_string_raw_sprite(rct_drawpixelinfo* dpi, std::string_view
 
 #ifndef NO_TTF
 
-static int _ttfGlId = 0;
-static void ttf_draw_string_raw_ttf(rct_drawpixelinfo* dpi, std::string_view text, text_draw_info* info)
-{
-    if (!ttf_initialise())
-        return;
-
-    TTFFontDescriptor* fontDesc = ttf_get_font_from_sprite_base(info->font_sprite_base);
-    if (fontDesc->font == nullptr)
-    {
-        ttf_draw_string_raw_sprite(dpi, text, info);
-        return;
-    }
-
-    if (info->flags & TEXT_DRAW_FLAG_NO_DRAW)
-    {
-        info->x += ttf_getwidth_cache_get_or_add(fontDesc->font, text);
-        return;
-    }
-
-    uint8_t colour = info->palette[1];
-    TTFSurface* surface = ttf_surface_cache_get_or_add(fontDesc->font, text);
-    if (surface == nullptr)
-        return;
+static constexpr uint32_t TTFGlyphImageBase = 0x7FFFF - TTF_GLYPH_CACHE_SIZE;
 
-    int32_t drawX = info->x + fontDesc->offset_x;
-    int32_t drawY = info->y + fontDesc->offset_y;
+/**
+ * Draws a rendered glyph at the given position, or only its outline.
+ */
+static void ttf_draw_surface(
+    rct_drawpixelinfo* dpi, const TTFSurface* surface, int32_t drawX, int32_t drawY, const text_draw_info* info,
+    const TTFFontDescriptor* fontDesc, bool outline)
+{
     int32_t width = surface->w;
     int32_t height = surface->h;
 
-    if (OpenRCT2::GetContext()->GetDrawingEngineType() == DrawingEngine::OpenGL)
-    {
-        auto pixels = reinterpret_cast<uint8_t*>(const_cast<void*>(surface->pixels));
-        auto pixelsLen = static_cast<size_t>(surface->pitch) * surface->h;
-        for (size_t pp = 0; pp < pixelsLen; pp++)
-        {
-            if (pixels[pp] != 0)
-            {
-                pixels[pp] = colour;
-            }
-            else
-            {
-                pixels[pp] = PALETTE_INDEX_0;
-            }
-        }
-
-        auto baseId = uint32_t(0x7FFFF) - 1024;
-        auto imageId = baseId + _ttfGlId;
-        auto drawingEngine = dpi->DrawingEngine;
-        auto drawingContext = drawingEngine->GetDrawingContext();
-        drawingEngine->InvalidateImage(imageId);
-        drawingContext->DrawBitmap(dpi, imageId, surface->pixels, surface->pitch, surface->h, drawX, drawY);
-
-        _ttfGlId++;
-        if (_ttfGlId >= 1023)
-        {
-            _ttfGlId = 0;
-        }
-        return;
-    }
-
     int32_t overflowX = (dpi->x + dpi->width) - (drawX + width);
     int32_t overflowY = (dpi->y + dpi->height) - (drawY + height);
     if (overflowX < 0)
@@ -599,7 +662,6 @@ static void ttf_draw_string_raw_ttf(rct_drawpixelinfo* dpi, std::string_view tex
         height += overflowY;
     int32_t skipX = drawX - dpi->x;
     int32_t skipY = drawY - dpi->y;
-    info->x += width;
 
     auto src = static_cast<const uint8_t*>(surface->pixels);
     uint8_t* dst = dpi->bits;
@@ -622,11 +684,9 @@ static void ttf_draw_string_raw_ttf(rct_drawpixelinfo* dpi, std::string_view tex
 
     int32_t srcScanSkip = surface->pitch - width;
     int32_t dstScanSkip = dpi->width + dpi->pitch - width;
-    uint8_t* dst_orig = dst;
-    const uint8_t* src_orig = src;
 
     // Draw shadow/outline
-    if (info->flags & TEXT_DRAW_FLAG_OUTLINE)
+    if (outline)
     {
         for (int32_t yy = 0; yy < height - 0; yy++)
         {
@@ -662,10 +722,10 @@ static void ttf_draw_string_raw_ttf(rct_drawpixelinfo* dpi, std::string_view tex
             src += srcScanSkip;
             dst += dstScanSkip;
         }
+        return;
     }
 
-    dst = dst_orig;
-    src = src_orig;
+    uint8_t colour = info->palette[1];
     bool use_hinting = gConfigFonts.enable_hinting && fontDesc->hinting_threshold > 0;
     for (int32_t yy = 0; yy < height; yy++)
     {
@@ -706,6 +766,67 @@ static void ttf_draw_string_raw_ttf(rct_drawpixelinfo* dpi, std::string_view tex
     }
 }
 
+static void ttf_draw_string_raw_ttf(rct_drawpixelinfo* dpi, std::string_view text, text_draw_info* info)
+{
+    if (!ttf_initialise())
+        return;
+
+    TTFFontDescriptor* fontDesc = ttf_get_font_from_sprite_base(info->font_sprite_base);
+    if (fontDesc->font == nullptr)
+    {
+        ttf_draw_string_raw_sprite(dpi, text, info);
+        return;
+    }
+
+    if (info->flags & TEXT_DRAW_FLAG_NO_DRAW)
+    {
+        info->x += ttf_layout(fontDesc->font, text, [](const TTFGlyph&, int32_t) {});
+        return;
+    }
+
+    int32_t drawX = info->x + fontDesc->offset_x;
+    int32_t drawY = info->y + fontDesc->offset_y;
+
+    if (OpenRCT2::GetContext()->GetDrawingEngineType() == DrawingEngine::OpenGL)
+    {
+        // Every cached glyph keeps its own image, so only glyphs that are new to the cache are uploaded.
+        uint8_t colour = info->palette[1];
+        auto drawingEngine = dpi->DrawingEngine;
+        auto drawingContext = drawingEngine->GetDrawingContext();
+        info->x += ttf_layout(fontDesc->font, text, [&](TTFGlyph& glyph, int32_t x) {
+            if (glyph.surface == nullptr)
+                return;
+
+            auto imageId = TTFGlyphImageBase + glyph.slot;
+            if (glyph.replaced)
+            {
+                drawingEngine->InvalidateImage(imageId);
+                glyph.replaced = false;
+            }
+            drawingContext->DrawBitmap(
+                dpi, imageId, glyph.surface->pixels, glyph.surface->pitch, glyph.surface->h, drawX + x, drawY, colour);
+        });
+        return;
+    }
+
+    // Outlines go below the text of all glyphs, not just the glyph they belong to.
+    if (info->flags & TEXT_DRAW_FLAG_OUTLINE)
+    {
+        ttf_layout(fontDesc->font, text, [&](const TTFGlyph& glyph, int32_t x) {
+            if (glyph.surface != nullptr)
+            {
+                ttf_draw_surface(dpi, glyph.surface, drawX + x, drawY, info, fontDesc, true);
+            }
+        });
+    }
+    info->x += ttf_layout(fontDesc->font, text, [&](const TTFGlyph& glyph, int32_t x) {
+        if (glyph.surface != nullptr)
+        {
+            ttf_draw_surface(dpi, glyph.surface, drawX + x, drawY, info, fontDesc, false);
+        }
+    });
+}
+
 #endif // NO_TTF
 
 static void ttf_process_format_code(rct_drawpixelinfo* dpi, const FmtString::token& token, text_draw_info* info)
@@ -577,6 +577,126 @@ void mask_init()
     }
 }
 
+void (*remap_run_fn)(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+    = remap_run_scalar;
+
+void remap_run_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 remap run function");
+        remap_run_fn = remap_run_avx2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 remap run function");
+        remap_run_fn = remap_run_sse4_1;
+    }
+    else if (neon_available())
+    {
+        log_verbose("registering NEON remap run function");
+        remap_run_fn = remap_run_neon;
+    }
+    else
+    {
+        log_verbose("registering scalar remap run function");
+        remap_run_fn = remap_run_scalar;
+    }
+}
+
+void light_blend_run_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+{
+    const uint32_t scale = intensity + 1;
+    for (int32_t i = 0; i < count; i++)
+    {
+        dst[i] = static_cast<uint8_t>(std::min<uint32_t>(0xFF, dst[i] + ((src[i] * scale) >> 8)));
+    }
+}
+
+void (*light_blend_run_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+    = light_blend_run_scalar;
+
+void light_blend_run_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 light blend function");
+        light_blend_run_fn = light_blend_run_avx2;
+    }
+    else if (sse41_available())
+    {
+        log_verbose("registering SSE4.1 light blend function");
+        light_blend_run_fn = light_blend_run_sse4_1;
+    }
+    else if (neon_available())
+    {
+        log_verbose("registering NEON light blend function");
+        light_blend_run_fn = light_blend_run_neon;
+    }
+    else
+    {
+        log_verbose("registering scalar light blend function");
+        light_blend_run_fn = light_blend_run_scalar;
+    }
+}
+
+void filter_run_scalar(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        dst[i] = map[dst[i]];
+    }
+}
+
+void (*filter_run_fn)(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count) = filter_run_scalar;
+
+void filter_run_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 filter run function");
+        filter_run_fn = filter_run_avx2;
+    }
+    else if (neon_available())
+    {
+        log_verbose("registering NEON filter run function");
+        filter_run_fn = filter_run_neon;
+    }
+    else
+    {
+        log_verbose("registering scalar filter run function");
+        filter_run_fn = filter_run_scalar;
+    }
+}
+
+void palette_convert_run_scalar(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        dst[i] = palette[src[i]];
+    }
+}
+
+void (*palette_convert_run_fn)(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t count)
+    = palette_convert_run_scalar;
+
+void palette_convert_run_init()
+{
+    if (avx2_available())
+    {
+        log_verbose("registering AVX2 palette convert function");
+        palette_convert_run_fn = palette_convert_run_avx2;
+    }
+    else
+    {
+        log_verbose("registering scalar palette convert function");
+        palette_convert_run_fn = palette_convert_run_scalar;
+    }
+}
+
 void gfx_filter_pixel(rct_drawpixelinfo* dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     gfx_filter_rect(dpi, { coords, coords }, palette);
@@ -359,6 +359,15 @@ public:
 
     uint8_t& operator[](size_t index);
     uint8_t operator[](size_t index) const;
+
+    /**
+     * Returns the map data if it covers every palette index, so that it can be indexed by any pixel without bounds
+     * checks. Returns nullptr otherwise.
+     */
+    const uint8_t* GetFullMap() const
+    {
+        return _dataLength >= 256 ? _data : nullptr;
+    }
     uint8_t Blend(uint8_t src, uint8_t dst) const;
     void Copy(size_t dstIndex, const PaletteMap& src, size_t srcIndex, size_t length);
 };
@@ -526,6 +535,14 @@ void gfx_unload_csg();
 const rct_g1_element* gfx_get_g1_element(ImageId imageId);
 const rct_g1_element* gfx_get_g1_element(ImageIndex image_id);
 void gfx_set_g1_element(ImageIndex imageId, const rct_g1_element* g1);
+
+/**
+ * Returns a downscaled copy of the RLE sprite g1 for drawing at zoom level 0 in place of drawing g1 at the given zoom
+ * level, or nullptr if the cache is full. The copies are built on first use and can be requested from any thread, they
+ * stay valid until gfx_invalidate_zoomed_sprites is called, which happens whenever images are replaced.
+ */
+const rct_g1_element* gfx_get_zoomed_sprite(ImageIndex imageIndex, const rct_g1_element& g1, ZoomLevel zoom);
+void gfx_invalidate_zoomed_sprites();
 std::optional<rct_gx> GfxLoadGx(const std::vector<uint8_t>& buffer);
 bool is_csg_loaded();
 void FASTCALL gfx_sprite_to_buffer(rct_drawpixelinfo& dpi, const DrawSpriteArgs& args);
@@ -567,6 +584,7 @@ int32_t gfx_get_string_width_new_lined(std::string_view text, FontSpriteBase fon
 int32_t gfx_get_string_width_no_formatting(std::string_view text, FontSpriteBase fontSpriteBase);
 int32_t string_get_height_raw(std::string_view text, FontSpriteBase fontBase);
 int32_t gfx_clip_string(char* buffer, int32_t width, FontSpriteBase fontSpriteBase);
+void gfx_text_layout_cache_invalidate();
 void shorten_path(utf8* buffer, size_t bufferSize, const utf8* path, int32_t availableWidth, FontSpriteBase fontSpriteBase);
 void ttf_draw_string(
     rct_drawpixelinfo* dpi, const_utf8string text, int32_t colour, const ScreenCoordsXY& coords, bool noFormatting,
@@ -600,6 +618,60 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+/**
+ * Draws a run of count pixels through a full 256 entry palette map. The source pixel is remapped, or the destination
+ * pixel if remapDst is set. Pixels where the source or the remapped value is 0 are left untouched, which matches
+ * BlitPixel with BLEND_TRANSPARENT and either BLEND_SRC or BLEND_DST.
+ */
+void remap_run_scalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst);
+void remap_run_sse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst);
+void remap_run_avx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst);
+void remap_run_neon(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst);
+void remap_run_init();
+
+extern void (*remap_run_fn)(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst);
+
+/**
+ * Adds a run of count light intensities from src onto dst, scaled by (intensity + 1) / 256 and saturating at 0xFF.
+ */
+void light_blend_run_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity);
+void light_blend_run_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity);
+void light_blend_run_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity);
+void light_blend_run_neon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity);
+void light_blend_run_init();
+
+extern void (*light_blend_run_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity);
+
+/**
+ * Replaces each of count pixels in place with its entry in a full 256 entry palette map, as done by FilterRect for
+ * translucent window backgrounds and overlays. There is no SSE4.1 version, looking up 16 bytes through 16 shuffles is
+ * slower than the scalar loop.
+ */
+void filter_run_scalar(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count);
+void filter_run_avx2(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count);
+void filter_run_neon(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count);
+void filter_run_init();
+
+extern void (*filter_run_fn)(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count);
+
+/**
+ * Converts a run of count palette indices to the 32 bit colours of a 256 entry palette, as done for every pixel of
+ * the screen when it is presented. Only AVX2 has a gather, other CPUs use the scalar loop.
+ */
+void palette_convert_run_scalar(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t count);
+void palette_convert_run_avx2(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t count);
+void palette_convert_run_init();
+
+extern void (*palette_convert_run_fn)(
+    const uint8_t* RESTRICT src, uint32_t* RESTRICT dst, const uint32_t* RESTRICT palette, int32_t count);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(const uint8_t* colours, int32_t start_index, int32_t num_colours);
@@ -32,9 +32,13 @@ namespace OpenRCT2::Drawing
         virtual void DrawSpriteSolid(rct_drawpixelinfo* dpi, ImageId image, int32_t x, int32_t y, uint8_t colour) abstract;
         virtual void DrawGlyph(
             rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, const PaletteMap& palette) abstract;
+        /**
+         * Draws the non-zero pixels of the bitmap in the given colour. The engine may keep a copy of the bitmap keyed by
+         * image until it is invalidated.
+         */
         virtual void DrawBitmap(
-            rct_drawpixelinfo* dpi, uint32_t image, const void* pixels, int32_t width, int32_t height, int32_t x,
-            int32_t y) abstract;
+            rct_drawpixelinfo* dpi, uint32_t image, const void* pixels, int32_t width, int32_t height, int32_t x, int32_t y,
+            uint8_t colour) abstract;
     };
 
 } // namespace OpenRCT2::Drawing
@@ -14,6 +14,7 @@
 #    include "../Game.h"
 #    include "../common.h"
 #    include "../config/Config.h"
+#    include "../core/JobPool.h"
 #    include "../entity/EntityRegistry.h"
 #    include "../interface/Viewport.h"
 #    include "../interface/Window.h"
@@ -29,6 +30,8 @@
 #    include <algorithm>
 #    include <cmath>
 #    include <cstring>
+#    include <mutex>
+#    include <vector>
 
 static uint8_t _bakedLightTexture_lantern_0[32 * 32];
 static uint8_t _bakedLightTexture_lantern_1[64 * 64];
@@ -86,6 +89,13 @@ static ZoomLevel _current_view_zoom_back_delay{ 0 };
 
 static GamePalette gPalette_light;
 
+// The occlusion tests paint from the worker threads, which add lights and allocate paint sessions as they go.
+static std::mutex _lightListMutex;
+static std::mutex _paintSessionMutex;
+
+// Lights are composited in bands of this many rows, each band is blended by one worker.
+constexpr int32_t LightCompositeBandHeight = 32;
+
 static uint8_t calc_light_intensity_lantern(int32_t x, int32_t y)
 {
     double distance = static_cast<double>(x * x + y * y);
@@ -190,217 +200,237 @@ void lightfx_update_buffers(rct_drawpixelinfo* info)
 
 extern void viewport_paint_setup();
 
-void lightfx_prepare_light_list()
+static void lightfx_prepare_light(LightListEntry* entry, const rct_window* w)
 {
-    for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+    if (entry->Position.z == 0x7FFF)
     {
-        LightListEntry* entry = &_LightListFront[light];
+        entry->LightIntensity = 0xFF;
+        return;
+    }
 
-        if (entry->Position.z == 0x7FFF)
-        {
-            entry->LightIntensity = 0xFF;
-            continue;
-        }
+    int32_t posOnScreenX = entry->ViewCoords.x - _current_view_x_front;
+    int32_t posOnScreenY = entry->ViewCoords.y - _current_view_y_front;
 
-        int32_t posOnScreenX = entry->ViewCoords.x - _current_view_x_front;
-        int32_t posOnScreenY = entry->ViewCoords.y - _current_view_y_front;
+    posOnScreenX = _current_view_zoom_front.ApplyInversedTo(posOnScreenX);
+    posOnScreenY = _current_view_zoom_front.ApplyInversedTo(posOnScreenY);
 
-        posOnScreenX = _current_view_zoom_front.ApplyInversedTo(posOnScreenX);
-        posOnScreenY = _current_view_zoom_front.ApplyInversedTo(posOnScreenY);
+    if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
+        || (posOnScreenY > _pixelInfo.height + 128))
+    {
+        entry->Type = LightType::None;
+        return;
+    }
 
-        if ((posOnScreenX < -128) || (posOnScreenY < -128) || (posOnScreenX > _pixelInfo.width + 128)
-            || (posOnScreenY > _pixelInfo.height + 128))
-        {
-            entry->Type = LightType::None;
-            continue;
-        }
+    uint32_t lightIntensityOccluded = 0x0;
 
-        uint32_t lightIntensityOccluded = 0x0;
+    int32_t dirVecX = 707;
+    int32_t dirVecY = 707;
 
-        int32_t dirVecX = 707;
-        int32_t dirVecY = 707;
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            dirVecX = 707;
+            dirVecY = 707;
+            break;
+        case 1:
+            dirVecX = -707;
+            dirVecY = 707;
+            break;
+        case 2:
+            dirVecX = -707;
+            dirVecY = -707;
+            break;
+        case 3:
+            dirVecX = 707;
+            dirVecY = -707;
+            break;
+        default:
+            dirVecX = 0;
+            dirVecY = 0;
+            break;
+    }
 
-        switch (_current_view_rotation_front)
-        {
-            case 0:
-                dirVecX = 707;
-                dirVecY = 707;
-                break;
-            case 1:
-                dirVecX = -707;
-                dirVecY = 707;
-                break;
-            case 2:
-                dirVecX = -707;
-                dirVecY = -707;
-                break;
-            case 3:
-                dirVecX = 707;
-                dirVecY = -707;
-                break;
-            default:
-                dirVecX = 0;
-                dirVecY = 0;
-                break;
-        }
+    int32_t tileOffsetX = 0;
+    int32_t tileOffsetY = 0;
+    switch (_current_view_rotation_front)
+    {
+        case 0:
+            tileOffsetX = 0;
+            tileOffsetY = 0;
+            break;
+        case 1:
+            tileOffsetX = 16;
+            tileOffsetY = 0;
+            break;
+        case 2:
+            tileOffsetX = 32;
+            tileOffsetY = 32;
+            break;
+        case 3:
+            tileOffsetX = 0;
+            tileOffsetY = 16;
+            break;
+    }
 
-        int32_t tileOffsetX = 0;
-        int32_t tileOffsetY = 0;
-        switch (_current_view_rotation_front)
-        {
-            case 0:
-                tileOffsetX = 0;
-                tileOffsetY = 0;
-                break;
-            case 1:
-                tileOffsetX = 16;
-                tileOffsetY = 0;
-                break;
-            case 2:
-                tileOffsetX = 32;
-                tileOffsetY = 32;
-                break;
-            case 3:
-                tileOffsetX = 0;
-                tileOffsetY = 16;
-                break;
-        }
+    int32_t mapFrontDiv = _current_view_zoom_front.ApplyTo(1);
 
-        int32_t mapFrontDiv = _current_view_zoom_front.ApplyTo(1);
+    // clang-format off
+    static int16_t offsetPattern[26] = {
+        0, 0,
+        -4, 0, 0, -3, 4, 0, 0, 3,
+        -2, -1, -1, -1, 2, 1, 1, 1,
+        -3, -2, -3, 2, 3, -2, 3, 2,
+    };
+    // clang-format on
 
-        // clang-format off
-        static int16_t offsetPattern[26] = {
-            0, 0,
-            -4, 0, 0, -3, 4, 0, 0, 3,
-            -2, -1, -1, -1, 2, 1, 1, 1,
-            -3, -2, -3, 2, 3, -2, 3, 2,
-        };
-        // clang-format on
+    // Light occlusion code
+    if (true)
+    {
+        int32_t totalSamplePoints = 5;
+        int32_t startSamplePoint = 1;
 
-        // Light occlusion code
-        if (true)
+        if (entry->Qualifier == LightFXQualifier::Map)
         {
-            int32_t totalSamplePoints = 5;
-            int32_t startSamplePoint = 1;
-
-            if (entry->Qualifier == LightFXQualifier::Map)
-            {
-                startSamplePoint = 0;
-                totalSamplePoints = 1;
-            }
+            startSamplePoint = 0;
+            totalSamplePoints = 1;
+        }
 
-            for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
-            {
-                CoordsXY mapCoord{};
+        for (int32_t pat = startSamplePoint; pat < totalSamplePoints; pat++)
+        {
+            CoordsXY mapCoord{};
 
-                TileElement* tileElement = nullptr;
+            TileElement* tileElement = nullptr;
 
-                ViewportInteractionItem interactionType = ViewportInteractionItem::None;
+            ViewportInteractionItem interactionType = ViewportInteractionItem::None;
 
-                auto* w = window_get_main();
-                if (w != nullptr)
+            if (w != nullptr)
+            {
+                // based on get_map_coordinates_from_pos_window
+                rct_drawpixelinfo dpi;
+                dpi.x = entry->ViewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv;
+                dpi.y = entry->ViewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv;
+                dpi.height = 1;
+                dpi.zoom_level = _current_view_zoom_front;
+                dpi.width = 1;
+
+                paint_session* session;
+                {
+                    std::lock_guard<std::mutex> lock(_paintSessionMutex);
+                    session = PaintSessionAlloc(&dpi, w->viewport->flags);
+                }
+                PaintSessionGenerate(*session);
+                PaintSessionArrange(*session);
+                auto info = set_interaction_info_from_paint_session(
+                    session, w->viewport->flags, ViewportInteractionItemAll);
                 {
-                    // based on get_map_coordinates_from_pos_window
-                    rct_drawpixelinfo dpi;
-                    dpi.x = entry->ViewCoords.x + offsetPattern[0 + pat * 2] / mapFrontDiv;
-                    dpi.y = entry->ViewCoords.y + offsetPattern[1 + pat * 2] / mapFrontDiv;
-                    dpi.height = 1;
-                    dpi.zoom_level = _current_view_zoom_front;
-                    dpi.width = 1;
-
-                    paint_session* session = PaintSessionAlloc(&dpi, w->viewport->flags);
-                    PaintSessionGenerate(*session);
-                    PaintSessionArrange(*session);
-                    auto info = set_interaction_info_from_paint_session(
-                        session, w->viewport->flags, ViewportInteractionItemAll);
+                    std::lock_guard<std::mutex> lock(_paintSessionMutex);
                     PaintSessionFree(session);
-
-                    //  log_warning("[%i, %i]", dpi->x, dpi->y);
-
-                    mapCoord = info.Loc;
-                    mapCoord.x += tileOffsetX;
-                    mapCoord.y += tileOffsetY;
-                    interactionType = info.SpriteType;
-                    tileElement = info.Element;
                 }
 
-                int32_t minDist = 0;
-                int32_t baseHeight = (-999) * COORDS_Z_STEP;
+                //  log_warning("[%i, %i]", dpi->x, dpi->y);
 
-                if (interactionType != ViewportInteractionItem::Entity && tileElement != nullptr)
-                {
-                    baseHeight = tileElement->GetBaseZ();
-                }
+                mapCoord = info.Loc;
+                mapCoord.x += tileOffsetX;
+                mapCoord.y += tileOffsetY;
+                interactionType = info.SpriteType;
+                tileElement = info.Element;
+            }
 
-                minDist = (baseHeight - entry->Position.z) / 2;
+            int32_t minDist = 0;
+            int32_t baseHeight = (-999) * COORDS_Z_STEP;
 
-                int32_t deltaX = mapCoord.x - entry->Position.x;
-                int32_t deltaY = mapCoord.y - entry->Position.y;
+            if (interactionType != ViewportInteractionItem::Entity && tileElement != nullptr)
+            {
+                baseHeight = tileElement->GetBaseZ();
+            }
 
-                int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
+            minDist = (baseHeight - entry->Position.z) / 2;
 
-                projDot = std::max(minDist, projDot);
+            int32_t deltaX = mapCoord.x - entry->Position.x;
+            int32_t deltaY = mapCoord.y - entry->Position.y;
 
-                if (projDot < 5)
-                {
-                    lightIntensityOccluded += 100;
-                }
-                else
-                {
-                    lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
-                }
+            int32_t projDot = (dirVecX * deltaX + dirVecY * deltaY) / 1000;
 
-                //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
-                //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
+            projDot = std::max(minDist, projDot);
 
-                if (pat == 0)
-                {
-                    if (lightIntensityOccluded == 100)
-                        break;
-                    if (_current_view_zoom_front > ZoomLevel{ 2 })
-                        break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 4)
-                {
-                    if (_current_view_zoom_front > ZoomLevel{ 1 })
-                        break;
-                    if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
-                        break;
-                    // lastSampleCount = lightIntensityOccluded / 500;
-                    //  break;
-                    totalSamplePoints += 4;
-                }
-                else if (pat == 8)
-                {
-                    break;
-                }
+            if (projDot < 5)
+            {
+                lightIntensityOccluded += 100;
+            }
+            else
+            {
+                lightIntensityOccluded += std::max(0, 200 - (projDot * 20));
             }
 
-            totalSamplePoints -= startSamplePoint;
+            //  log_warning("light %i [%i, %i, %i], [%i, %i] minDist to %i: %i; projdot: %i", light, coord_3d.x, coord_3d.y,
+            //  coord_3d.z, mapCoord.x, mapCoord.y, baseHeight, minDist, projDot);
 
-            if (lightIntensityOccluded == 0)
+            if (pat == 0)
             {
-                entry->Type = LightType::None;
-                continue;
+                if (lightIntensityOccluded == 100)
+                    break;
+                if (_current_view_zoom_front > ZoomLevel{ 2 })
+                    break;
+                totalSamplePoints += 4;
+            }
+            else if (pat == 4)
+            {
+                if (_current_view_zoom_front > ZoomLevel{ 1 })
+                    break;
+                if (lightIntensityOccluded == 0 || lightIntensityOccluded == 500)
+                    break;
+                // lastSampleCount = lightIntensityOccluded / 500;
+                //  break;
+                totalSamplePoints += 4;
             }
+            else if (pat == 8)
+            {
+                break;
+            }
+        }
+
+        totalSamplePoints -= startSamplePoint;
 
-            entry->LightIntensity = std::min<uint32_t>(
-                0xFF, (entry->LightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+        if (lightIntensityOccluded == 0)
+        {
+            entry->Type = LightType::None;
+            return;
         }
-        entry->LightIntensity = std::max<uint32_t>(
-            0x00, entry->LightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
 
-        if (_current_view_zoom_front > ZoomLevel{ 0 })
+        entry->LightIntensity = std::min<uint32_t>(
+            0xFF, (entry->LightIntensity * lightIntensityOccluded) / (totalSamplePoints * 100));
+    }
+    entry->LightIntensity = std::max<uint32_t>(
+        0x00, entry->LightIntensity - static_cast<int8_t>(_current_view_zoom_front) * 5);
+
+    if (_current_view_zoom_front > ZoomLevel{ 0 })
+    {
+        if (GetLightTypeSize(entry->Type) < static_cast<int8_t>(_current_view_zoom_front))
         {
-            if (GetLightTypeSize(entry->Type) < static_cast<int8_t>(_current_view_zoom_front))
-            {
-                entry->Type = LightType::None;
-                continue;
-            }
+            entry->Type = LightType::None;
+            return;
+        }
+
+        entry->Type = SetLightTypeSize(
+            entry->Type, GetLightTypeSize(entry->Type) - static_cast<int8_t>(_current_view_zoom_front));
+    }
+
+}
 
-            entry->Type = SetLightTypeSize(
-                entry->Type, GetLightTypeSize(entry->Type) - static_cast<int8_t>(_current_view_zoom_front));
+void lightfx_prepare_light_list()
+{
+    // Each light runs its own occlusion test paints, which is by far the most expensive part of the lighting.
+    const auto* w = window_get_main();
+    auto prepareLight = [w](size_t light) { lightfx_prepare_light(&_LightListFront[light], w); };
+    if (gConfigGeneral.multithreading)
+    {
+        JobPool::ParallelFor(0, LightListCurrentCountFront, 8, prepareLight);
+    }
+    else
+    {
+        for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+        {
+            prepareLight(light);
         }
     }
 }
@@ -446,6 +476,33 @@ void lightfx_update_viewport_settings()
     }
 }
 
+struct LightCompositeRect
+{
+    const uint8_t* ReadBase;
+    int32_t ReadWidth;
+    int32_t WriteX;
+    int32_t WriteY;
+    int32_t WriteWidth;
+    int32_t WriteHeight;
+    uint8_t Intensity;
+};
+
+static void lightfx_composite_band(const std::vector<LightCompositeRect>& rects, int32_t bandTop, int32_t bandBottom)
+{
+    auto* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front);
+    for (const auto& rect : rects)
+    {
+        auto top = std::max(rect.WriteY, bandTop);
+        auto bottom = std::min(rect.WriteY + rect.WriteHeight, bandBottom);
+        for (int32_t y = top; y < bottom; y++)
+        {
+            light_blend_run_fn(
+                rect.ReadBase + (y - rect.WriteY) * rect.ReadWidth, bufWriteBase + y * _pixelInfo.width + rect.WriteX,
+                rect.WriteWidth, rect.Intensity);
+        }
+    }
+}
+
 void lightfx_render_lights_to_frontbuffer()
 {
     if (_light_rendered_buffer_front == nullptr)
@@ -459,14 +516,15 @@ void lightfx_render_lights_to_frontbuffer()
 
     //  log_warning("%i lights", LightListCurrentCountFront);
 
+    // Clip all lights to the buffer first, so the blending can be split up into bands of rows.
+    thread_local std::vector<LightCompositeRect> rects;
+    rects.clear();
     for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
     {
         const uint8_t* bufReadBase = nullptr;
-        uint8_t* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front);
         uint32_t bufReadWidth, bufReadHeight;
         int32_t bufWriteX, bufWriteY;
         int32_t bufWriteWidth, bufWriteHeight;
-        uint32_t bufReadSkip, bufWriteSkip;
 
         LightListEntry* entry = &_LightListFront[light];
 
@@ -541,10 +599,7 @@ void lightfx_render_lights_to_frontbuffer()
         {
             bufReadBase += -bufWriteX;
             bufWriteWidth += bufWriteX;
-        }
-        else
-        {
-            bufWriteBase += bufWriteX;
+            bufWriteX = 0;
         }
 
         if (bufWriteWidth <= 0)
@@ -554,10 +609,7 @@ void lightfx_render_lights_to_frontbuffer()
         {
             bufReadBase += -bufWriteY * bufReadWidth;
             bufWriteHeight += bufWriteY;
-        }
-        else
-        {
-            bufWriteBase += bufWriteY * _pixelInfo.width;
+            bufWriteY = 0;
         }
 
         if (bufWriteHeight <= 0)
@@ -582,38 +634,26 @@ void lightfx_render_lights_to_frontbuffer()
 
         _lightPolution_back += (bufWriteWidth * bufWriteHeight) / 256;
 
-        bufReadSkip = bufReadWidth - bufWriteWidth;
-        bufWriteSkip = _pixelInfo.width - bufWriteWidth;
-
-        if (entry->LightIntensity == 0xFF)
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
+        rects.push_back({ bufReadBase, static_cast<int32_t>(bufReadWidth), bufWriteX, bufWriteY, bufWriteWidth,
+                          bufWriteHeight, entry->LightIntensity });
+    }
 
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
-        }
-        else
+    const auto bandCount = (_pixelInfo.height + LightCompositeBandHeight - 1) / LightCompositeBandHeight;
+    // rects is thread local, the workers have to refer to this thread's instance.
+    const auto& lightRects = rects;
+    auto compositeBand = [&lightRects](size_t band) {
+        auto bandTop = static_cast<int32_t>(band) * LightCompositeBandHeight;
+        lightfx_composite_band(lightRects, bandTop, std::min(bandTop + LightCompositeBandHeight, _pixelInfo.height));
+    };
+    if (gConfigGeneral.multithreading)
+    {
+        JobPool::ParallelFor(0, bandCount, 1, compositeBand);
+    }
+    else
+    {
+        for (int32_t band = 0; band < bandCount; band++)
         {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry->LightIntensity)) >> 8));
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
+            compositeBand(band);
         }
     }
 }
@@ -632,6 +672,8 @@ static void LightfxAdd3DLight(
     const uint32_t lightHash, const LightFXQualifier qualifier, const uint8_t id, const CoordsXYZ& loc,
     const LightType lightType)
 {
+    std::lock_guard<std::mutex> lock(_lightListMutex);
+
     if (LightListCurrentCountBack == 15999)
     {
         return;
@@ -1047,26 +1089,27 @@ void lightfx_render_to_texture(
     {
         uintptr_t dstOffset = static_cast<uintptr_t>(y * dstPitch);
         uint32_t* dst = reinterpret_cast<uint32_t*>(reinterpret_cast<uintptr_t>(dstPixels) + dstOffset);
+        const uint8_t* src = &bits[y * width];
+        const uint8_t* light = &lightBits[y * width];
+
+        // Most pixels are unlit, convert the whole row first and only mix the lit ones afterwards.
+        palette_convert_run_fn(src, dst, palette, static_cast<int32_t>(width));
         for (uint32_t x = 0; x < width; x++)
         {
-            uint8_t* src = &bits[y * width + x];
-            uint32_t darkColour = palette[*src];
-            uint32_t lightColour = lightPalette[*src];
-            uint8_t lightIntensity = lightBits[y * width + x];
-
-            uint32_t colour = 0;
+            uint8_t lightIntensity = light[x];
             if (lightIntensity == 0)
             {
-                colour = darkColour;
-            }
-            else
-            {
-                colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
-                colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
-                colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
-                colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+                continue;
             }
-            *dst++ = colour;
+
+            uint32_t darkColour = dst[x];
+            uint32_t lightColour = lightPalette[src[x]];
+            uint32_t colour = 0;
+            colour |= mix_light((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
+            colour |= mix_light((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
+            colour |= mix_light((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
+            colour |= mix_light((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+            dst[x] = colour;
         }
     }
 }
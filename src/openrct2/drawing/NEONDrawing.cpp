@@ -0,0 +1,120 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../common.h"
+#include "../core/Guard.hpp"
+#include "Drawing.h"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+
+#    include <arm_neon.h>
+
+void remap_run_neon(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+{
+    int32_t i = 0;
+    if (count >= 16)
+    {
+        // The table lookups cover 64 entries each, out of range indices leave the result of the previous one.
+        uint8x16x4_t table[4];
+        for (int32_t part = 0; part < 4; part++)
+        {
+            for (int32_t row = 0; row < 4; row++)
+            {
+                table[part].val[row] = vld1q_u8(map + part * 64 + row * 16);
+            }
+        }
+
+        const uint8x16_t zero = vdupq_n_u8(0);
+        const uint8x16_t partSize = vdupq_n_u8(64);
+        for (; i + 16 <= count; i += 16)
+        {
+            const uint8x16_t source = vld1q_u8(src + i);
+            const uint8x16_t dest = vld1q_u8(dst + i);
+            uint8x16_t indices = remapDst ? dest : source;
+            uint8x16_t pixel = vqtbl4q_u8(table[0], indices);
+            for (int32_t part = 1; part < 4; part++)
+            {
+                indices = vsubq_u8(indices, partSize);
+                pixel = vqtbx4q_u8(pixel, table[part], indices);
+            }
+            // Keep the destination where the source is transparent or remaps to transparent.
+            const uint8x16_t keep = vorrq_u8(vceqq_u8(source, zero), vceqq_u8(pixel, zero));
+            vst1q_u8(dst + i, vbslq_u8(keep, dest, pixel));
+        }
+    }
+    remap_run_scalar(src + i, dst + i, map, count - i, remapDst);
+}
+
+void light_blend_run_neon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+{
+    int32_t i = 0;
+    const uint8x8_t scale = vdup_n_u8(static_cast<uint8_t>(intensity));
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t source = vld1q_u8(src + i);
+        const uint8x16_t dest = vld1q_u8(dst + i);
+        // source * (intensity + 1) computed as source * intensity + source, which fits in 16 bits.
+        const uint16x8_t lo = vaddw_u8(vmull_u8(vget_low_u8(source), scale), vget_low_u8(source));
+        const uint16x8_t hi = vaddw_u8(vmull_u8(vget_high_u8(source), scale), vget_high_u8(source));
+        const uint8x16_t scaled = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+        vst1q_u8(dst + i, vqaddq_u8(dest, scaled));
+    }
+    light_blend_run_scalar(src + i, dst + i, count - i, intensity);
+}
+
+void filter_run_neon(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count)
+{
+    int32_t i = 0;
+    if (count >= 16)
+    {
+        uint8x16x4_t table[4];
+        for (int32_t part = 0; part < 4; part++)
+        {
+            for (int32_t row = 0; row < 4; row++)
+            {
+                table[part].val[row] = vld1q_u8(map + part * 64 + row * 16);
+            }
+        }
+
+        const uint8x16_t partSize = vdupq_n_u8(64);
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16_t indices = vld1q_u8(dst + i);
+            uint8x16_t pixel = vqtbl4q_u8(table[0], indices);
+            for (int32_t part = 1; part < 4; part++)
+            {
+                indices = vsubq_u8(indices, partSize);
+                pixel = vqtbx4q_u8(pixel, table[part], indices);
+            }
+            vst1q_u8(dst + i, pixel);
+        }
+    }
+    filter_run_scalar(dst + i, map, count - i);
+}
+
+#else
+
+void remap_run_neon(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+{
+    openrct2_assert(false, "NEON function called on a CPU that doesn't support NEON");
+}
+
+void light_blend_run_neon(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+{
+    openrct2_assert(false, "NEON function called on a CPU that doesn't support NEON");
+}
+
+void filter_run_neon(uint8_t* dst, const uint8_t* RESTRICT map, int32_t count)
+{
+    openrct2_assert(false, "NEON function called on a CPU that doesn't support NEON");
+}
+
+#endif // __aarch64__ && __ARM_NEON
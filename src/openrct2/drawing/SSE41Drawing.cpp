@@ -56,6 +56,64 @@ void mask_sse4_1(
     }
 }
 
+// Looks up every byte of indices in a 256 entry table split into 16 rows of 16 entries.
+static __m128i remap_lookup_sse4_1(const __m128i (&table)[16], __m128i indices)
+{
+    const __m128i lowMask = _mm_set1_epi8(0x0F);
+    const __m128i low = _mm_and_si128(indices, lowMask);
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(indices, 4), lowMask);
+    __m128i result = _mm_setzero_si128();
+    for (int32_t row = 0; row < 16; row++)
+    {
+        const __m128i select = _mm_cmpeq_epi8(high, _mm_set1_epi8(static_cast<char>(row)));
+        result = _mm_or_si128(result, _mm_and_si128(_mm_shuffle_epi8(table[row], low), select));
+    }
+    return result;
+}
+
+void remap_run_sse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+{
+    int32_t i = 0;
+    if (count >= 16)
+    {
+        __m128i table[16];
+        for (int32_t row = 0; row < 16; row++)
+        {
+            table[row] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(map + row * 16));
+        }
+
+        const __m128i zero128 = {};
+        for (; i + 16 <= count; i += 16)
+        {
+            const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const __m128i pixel = remap_lookup_sse4_1(table, remapDst ? dest : source);
+            // Keep the destination where the source is transparent or remaps to transparent.
+            const __m128i keep = _mm_or_si128(_mm_cmpeq_epi8(source, zero128), _mm_cmpeq_epi8(pixel, zero128));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_blendv_epi8(pixel, dest, keep));
+        }
+    }
+    remap_run_scalar(src + i, dst + i, map, count - i, remapDst);
+}
+
+void light_blend_run_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+{
+    int32_t i = 0;
+    const __m128i zero128 = {};
+    const __m128i scale = _mm_set1_epi16(static_cast<int16_t>(intensity + 1));
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i dest = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        // Scale in 16 bits, the results fit in 8 bits again so the pack does not saturate.
+        const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(source, zero128), scale), 8);
+        const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(source, zero128), scale), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_adds_epu8(dest, _mm_packus_epi16(lo, hi)));
+    }
+    light_blend_run_scalar(src + i, dst + i, count - i, intensity);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +127,15 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void remap_run_sse4_1(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map, int32_t count, bool remapDst)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void light_blend_run_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, uint8_t intensity)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
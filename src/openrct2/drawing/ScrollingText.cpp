@@ -9,6 +9,7 @@
 
 #include "ScrollingText.h"
 
+#include "../OpenRCT2.h"
 #include "../config/Config.h"
 #include "../core/String.hpp"
 #include "../interface/Colour.h"
@@ -22,10 +23,16 @@
 #include "TTF.h"
 
 #include <algorithm>
+#include <array>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 using namespace OpenRCT2;
 
+constexpr int16_t ScrollingTextNullIndex = -1;
+constexpr size_t ScrollingTextHashBuckets = 1024;
+
 struct rct_draw_scroll_text
 {
     rct_string_id string_id;
@@ -33,19 +40,30 @@ struct rct_draw_scroll_text
     colour_t colour;
     uint16_t position;
     uint16_t mode;
-    uint32_t id;
+    uint32_t hash;
+    // The draw count of the frame the entry was last used in, entries used by the current frame are never replaced.
+    uint32_t last_used;
+    bool in_use;
+    // Links of the hash bucket chain and the least recently used list, as indices into _drawScrollTextList.
+    int16_t next_in_bucket;
+    int16_t lru_prev;
+    int16_t lru_next;
     uint8_t bitmap[64 * 40];
 };
 
-static rct_draw_scroll_text _drawScrollTextList[OpenRCT2::MaxScrollingTextEntries];
+// The entries are only allocated as needed, so the cache grows with the number of signs that are visible at once.
+static std::vector<std::unique_ptr<rct_draw_scroll_text>> _drawScrollTextList;
+static std::array<int16_t, ScrollingTextHashBuckets> _drawScrollTextBuckets;
+static int16_t _drawScrollTextLruHead = ScrollingTextNullIndex;
+static int16_t _drawScrollTextLruTail = ScrollingTextNullIndex;
 static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8];
-static uint32_t _drawSCrollNextIndex = 0;
 static std::mutex _scrollingTextMutex;
 
 static void scrolling_text_set_bitmap_for_sprite(
     std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
 static void scrolling_text_set_bitmap_for_ttf(
     std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
+static void scrolling_text_initialise_sprite(size_t index);
 
 void scrolling_text_initialise_bitmaps()
 {
@@ -99,29 +117,34 @@ void scrolling_text_initialise_bitmaps()
         }
     }
 
-    for (int32_t i = 0; i < OpenRCT2::MaxScrollingTextEntries; i++)
+    for (size_t i = 0; i < _drawScrollTextList.size(); i++)
     {
-        const int32_t imageId = SPR_SCROLLING_TEXT_START + i;
-
-        // Initialize the scrolling text sprite.
-        rct_g1_element g1{};
-        g1.offset = _drawScrollTextList[i].bitmap;
-        g1.x_offset = -32;
-        g1.y_offset = 0;
-        g1.flags = G1_FLAG_BMP;
-        g1.width = 64;
-        g1.height = 40;
-        g1.offset[0] = 0xFF;
-        g1.offset[1] = 0xFF;
-        g1.offset[14] = 0;
-        g1.offset[15] = 0;
-        g1.offset[16] = 0;
-        g1.offset[17] = 0;
-
-        gfx_set_g1_element(imageId, &g1);
+        scrolling_text_initialise_sprite(i);
     }
 }
 
+static void scrolling_text_initialise_sprite(size_t index)
+{
+    const int32_t imageId = SPR_SCROLLING_TEXT_START + static_cast<int32_t>(index);
+
+    // Initialize the scrolling text sprite.
+    rct_g1_element g1{};
+    g1.offset = _drawScrollTextList[index]->bitmap;
+    g1.x_offset = -32;
+    g1.y_offset = 0;
+    g1.flags = G1_FLAG_BMP;
+    g1.width = 64;
+    g1.height = 40;
+    g1.offset[0] = 0xFF;
+    g1.offset[1] = 0xFF;
+    g1.offset[14] = 0;
+    g1.offset[15] = 0;
+    g1.offset[16] = 0;
+    g1.offset[17] = 0;
+
+    gfx_set_g1_element(imageId, &g1);
+}
+
 static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
 {
     auto offset = font_sprite_get_codepoint_offset(codepoint);
@@ -133,30 +156,127 @@ static uint8_t* font_sprite_get_codepoint_bitmap(int32_t codepoint)
     return _characterBitmaps[offset];
 }
 
-static int32_t scrolling_text_get_matching_or_oldest(
-    rct_string_id stringId, Formatter& ft, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+static uint32_t scrolling_text_hash(
+    rct_string_id stringId, const uint8_t* args, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    auto add = [&hash](uint32_t value) { hash = (hash ^ value) * 16777619u; };
+    add(stringId);
+    for (size_t i = 0; i < sizeof(rct_draw_scroll_text::string_args); i++)
+    {
+        add(args[i]);
+    }
+    add(scroll);
+    add(scrollingMode);
+    add(colour);
+    return hash;
+}
+
+static void scrolling_text_lru_unlink(int16_t index)
+{
+    auto& scrollText = *_drawScrollTextList[index];
+    if (scrollText.lru_prev != ScrollingTextNullIndex)
+        _drawScrollTextList[scrollText.lru_prev]->lru_next = scrollText.lru_next;
+    else
+        _drawScrollTextLruHead = scrollText.lru_next;
+    if (scrollText.lru_next != ScrollingTextNullIndex)
+        _drawScrollTextList[scrollText.lru_next]->lru_prev = scrollText.lru_prev;
+    else
+        _drawScrollTextLruTail = scrollText.lru_prev;
+}
+
+static void scrolling_text_lru_push_front(int16_t index)
+{
+    auto& scrollText = *_drawScrollTextList[index];
+    scrollText.lru_prev = ScrollingTextNullIndex;
+    scrollText.lru_next = _drawScrollTextLruHead;
+    if (_drawScrollTextLruHead != ScrollingTextNullIndex)
+        _drawScrollTextList[_drawScrollTextLruHead]->lru_prev = index;
+    else
+        _drawScrollTextLruTail = index;
+    _drawScrollTextLruHead = index;
+}
+
+static void scrolling_text_mark_used(int16_t index)
+{
+    _drawScrollTextList[index]->last_used = gCurrentDrawCount;
+    if (_drawScrollTextLruHead != index)
+    {
+        scrolling_text_lru_unlink(index);
+        scrolling_text_lru_push_front(index);
+    }
+}
+
+static void scrolling_text_bucket_remove(int16_t index)
 {
-    uint32_t oldestId = 0xFFFFFFFF;
-    int32_t scrollIndex = -1;
-    for (size_t i = 0; i < std::size(_drawScrollTextList); i++)
+    auto& scrollText = *_drawScrollTextList[index];
+    auto* link = &_drawScrollTextBuckets[scrollText.hash % ScrollingTextHashBuckets];
+    while (*link != ScrollingTextNullIndex)
     {
-        rct_draw_scroll_text* scrollText = &_drawScrollTextList[i];
-        if (oldestId >= scrollText->id)
+        if (*link == index)
         {
-            oldestId = scrollText->id;
-            scrollIndex = static_cast<int32_t>(i);
+            *link = scrollText.next_in_bucket;
+            break;
         }
+        link = &_drawScrollTextList[*link]->next_in_bucket;
+    }
+    scrollText.in_use = false;
+}
+
+static int16_t scrolling_text_find(
+    uint32_t hash, rct_string_id stringId, const uint8_t* args, uint16_t scroll, uint16_t scrollingMode, colour_t colour)
+{
+    if (_drawScrollTextList.empty())
+        return ScrollingTextNullIndex;
 
-        // If exact match return the matching index
-        if (scrollText->string_id == stringId
-            && std::memcmp(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args)) == 0
-            && scrollText->colour == colour && scrollText->position == scroll && scrollText->mode == scrollingMode)
+    auto index = _drawScrollTextBuckets[hash % ScrollingTextHashBuckets];
+    while (index != ScrollingTextNullIndex)
+    {
+        const auto& scrollText = *_drawScrollTextList[index];
+        if (scrollText.hash == hash && scrollText.string_id == stringId
+            && std::memcmp(scrollText.string_args, args, sizeof(scrollText.string_args)) == 0
+            && scrollText.colour == colour && scrollText.position == scroll && scrollText.mode == scrollingMode)
         {
-            scrollText->id = _drawSCrollNextIndex;
-            return static_cast<int32_t>(i + SPR_SCROLLING_TEXT_START);
+            return index;
         }
+        index = scrollText.next_in_bucket;
     }
-    return scrollIndex;
+    return ScrollingTextNullIndex;
+}
+
+/**
+ * Returns the least recently used entry if it is not needed by the current frame, otherwise adds a new entry. Returns
+ * ScrollingTextNullIndex if every entry is used by the current frame already.
+ */
+static int16_t scrolling_text_allocate()
+{
+    if (_drawScrollTextList.empty())
+    {
+        _drawScrollTextBuckets.fill(ScrollingTextNullIndex);
+    }
+
+    auto index = _drawScrollTextLruTail;
+    if (index != ScrollingTextNullIndex && _drawScrollTextList[index]->last_used != gCurrentDrawCount)
+    {
+        if (_drawScrollTextList[index]->in_use)
+        {
+            scrolling_text_bucket_remove(index);
+        }
+        return index;
+    }
+
+    if (_drawScrollTextList.size() >= static_cast<size_t>(MaxScrollingTextEntries))
+    {
+        return ScrollingTextNullIndex;
+    }
+
+    index = static_cast<int16_t>(_drawScrollTextList.size());
+    _drawScrollTextList.push_back(std::make_unique<rct_draw_scroll_text>());
+    _drawScrollTextList[index]->in_use = false;
+    scrolling_text_lru_push_front(index);
+    scrolling_text_initialise_sprite(index);
+    return index;
 }
 
 static void scrolling_text_format(utf8* dst, size_t size, rct_draw_scroll_text* scrollText)
@@ -1439,11 +1559,14 @@ static constexpr const int16_t* _scrollPositions[MAX_SCROLLING_TEXT_MODES] = {
 
 void scrolling_text_invalidate()
 {
+    std::scoped_lock<std::mutex> lock(_scrollingTextMutex);
+
+    // The entries stay allocated and are reused once no longer needed by the current frame.
     for (auto& scrollText : _drawScrollTextList)
     {
-        scrollText.string_id = 0;
-        std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
+        scrollText->in_use = false;
     }
+    _drawScrollTextBuckets.fill(ScrollingTextNullIndex);
 }
 
 int32_t scrolling_text_setup(
@@ -1458,20 +1581,34 @@ int32_t scrolling_text_setup(
     if (dpi->zoom_level > ZoomLevel{ 0 })
         return SPR_SCROLLING_TEXT_DEFAULT;
 
-    _drawSCrollNextIndex++;
     ft.Rewind();
-    int32_t scrollIndex = scrolling_text_get_matching_or_oldest(stringId, ft, scroll, scrollingMode, colour);
-    if (scrollIndex >= SPR_SCROLLING_TEXT_START)
-        return scrollIndex;
+    auto args = ft.Buf();
+    auto hash = scrolling_text_hash(stringId, args, scroll, scrollingMode, colour);
+    auto scrollIndex = scrolling_text_find(hash, stringId, args, scroll, scrollingMode, colour);
+    if (scrollIndex != ScrollingTextNullIndex)
+    {
+        // Already rendered, by this or a previous frame.
+        scrolling_text_mark_used(scrollIndex);
+        return SPR_SCROLLING_TEXT_START + scrollIndex;
+    }
+
+    scrollIndex = scrolling_text_allocate();
+    if (scrollIndex == ScrollingTextNullIndex)
+        return SPR_SCROLLING_TEXT_DEFAULT;
 
     // Setup scrolling text
-    auto scrollText = &_drawScrollTextList[scrollIndex];
+    auto scrollText = _drawScrollTextList[scrollIndex].get();
     scrollText->string_id = stringId;
-    std::memcpy(scrollText->string_args, ft.Buf(), sizeof(scrollText->string_args));
+    std::memcpy(scrollText->string_args, args, sizeof(scrollText->string_args));
     scrollText->colour = colour;
     scrollText->position = scroll;
     scrollText->mode = scrollingMode;
-    scrollText->id = _drawSCrollNextIndex;
+    scrollText->hash = hash;
+    scrollText->in_use = true;
+    auto& bucket = _drawScrollTextBuckets[hash % ScrollingTextHashBuckets];
+    scrollText->next_in_bucket = bucket;
+    bucket = scrollIndex;
+    scrolling_text_mark_used(scrollIndex);
 
     // Create the string to draw
     utf8 scrollString[256];
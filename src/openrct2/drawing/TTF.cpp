@@ -29,7 +29,6 @@
 static bool _ttfInitialised = false;
 
 #    define TTF_SURFACE_CACHE_SIZE 256
-#    define TTF_GETWIDTH_CACHE_SIZE 1024
 
 struct ttf_cache_entry
 {
@@ -39,11 +38,11 @@ struct ttf_cache_entry
     uint32_t lastUseTick;
 };
 
-struct ttf_getwidth_cache_entry
+struct ttf_glyph_cache_entry
 {
-    uint32_t width;
+    TTFGlyph glyph;
     TTF_Font* font;
-    utf8* text;
+    codepoint_t codepoint;
     uint32_t lastUseTick;
 };
 
@@ -52,10 +51,8 @@ static int32_t _ttfSurfaceCacheCount = 0;
 static int32_t _ttfSurfaceCacheHitCount = 0;
 static int32_t _ttfSurfaceCacheMissCount = 0;
 
-static ttf_getwidth_cache_entry _ttfGetWidthCache[TTF_GETWIDTH_CACHE_SIZE] = {};
-static int32_t _ttfGetWidthCacheCount = 0;
-static int32_t _ttfGetWidthCacheHitCount = 0;
-static int32_t _ttfGetWidthCacheMissCount = 0;
+static ttf_glyph_cache_entry _ttfGlyphCache[TTF_GLYPH_CACHE_SIZE] = {};
+static int32_t _ttfGlyphCacheCount = 0;
 
 static std::mutex _mutex;
 
@@ -63,8 +60,7 @@ static TTF_Font* ttf_open_font(const utf8* fontPath, int32_t ptSize);
 static void ttf_close_font(TTF_Font* font);
 static void ttf_surface_cache_dispose(ttf_cache_entry* entry);
 static void ttf_surface_cache_dispose_all();
-static void ttf_getwidth_cache_dispose_all();
-static bool ttf_get_size(TTF_Font* font, std::string_view text, int32_t* outWidth, int32_t* outHeight);
+static void ttf_glyph_cache_dispose_all();
 static void ttf_toggle_hinting(bool);
 static TTFSurface* ttf_render(TTF_Font* font, std::string_view text);
 
@@ -106,6 +102,11 @@ static void ttf_toggle_hinting(bool)
     {
         ttf_surface_cache_dispose_all();
     }
+    if (_ttfGlyphCacheCount)
+    {
+        ttf_glyph_cache_dispose_all();
+    }
+    gfx_text_layout_cache_invalidate();
 }
 
 bool ttf_initialise()
@@ -155,7 +156,7 @@ void ttf_dispose()
         return;
 
     ttf_surface_cache_dispose_all();
-    ttf_getwidth_cache_dispose_all();
+    ttf_glyph_cache_dispose_all();
 
     for (int32_t i = 0; i < FONT_SIZE_COUNT; i++)
     {
@@ -275,48 +276,51 @@ TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, std::string_view text)
     return entry->surface;
 }
 
-static void ttf_getwidth_cache_dispose(ttf_getwidth_cache_entry* entry)
+static void ttf_glyph_cache_dispose(ttf_glyph_cache_entry* entry)
 {
-    if (entry->text != nullptr)
+    if (entry->font != nullptr)
     {
-        free(entry->text);
+        if (entry->glyph.surface != nullptr)
+        {
+            ttf_free_surface(entry->glyph.surface);
+        }
 
-        entry->width = 0;
+        entry->glyph = {};
         entry->font = nullptr;
-        entry->text = nullptr;
+        entry->codepoint = 0;
+        _ttfGlyphCacheCount--;
     }
 }
 
-static void ttf_getwidth_cache_dispose_all()
+static void ttf_glyph_cache_dispose_all()
 {
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+    for (int32_t i = 0; i < TTF_GLYPH_CACHE_SIZE; i++)
     {
-        ttf_getwidth_cache_dispose(&_ttfGetWidthCache[i]);
-        _ttfGetWidthCacheCount--;
+        ttf_glyph_cache_dispose(&_ttfGlyphCache[i]);
     }
 }
 
-uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, std::string_view text)
+TTFGlyph* ttf_glyph_cache_get_or_add(TTF_Font* font, codepoint_t codepoint)
 {
-    ttf_getwidth_cache_entry* entry;
+    ttf_glyph_cache_entry* entry;
 
-    uint32_t hash = ttf_surface_cache_hash(font, text);
-    int32_t index = hash % TTF_GETWIDTH_CACHE_SIZE;
+    uint32_t hash = static_cast<uint32_t>(((reinterpret_cast<uintptr_t>(font) * 23) ^ 0xAAAAAAAA) & 0xFFFFFFFF);
+    hash = Numerics::ror32(hash, 3) ^ (codepoint * 2654435761u);
+    int32_t index = (hash >> 16) % TTF_GLYPH_CACHE_SIZE;
 
     FontLockHelper<std::mutex> lock(_mutex);
 
-    for (int32_t i = 0; i < TTF_GETWIDTH_CACHE_SIZE; i++)
+    for (int32_t i = 0; i < TTF_GLYPH_CACHE_SIZE; i++)
     {
-        entry = &_ttfGetWidthCache[index];
+        entry = &_ttfGlyphCache[index];
 
         // Check if entry is a hit
-        if (entry->text == nullptr)
+        if (entry->font == nullptr)
             break;
-        if (entry->font == font && String::Equals(entry->text, text))
+        if (entry->font == font && entry->codepoint == codepoint)
         {
-            _ttfGetWidthCacheHitCount++;
             entry->lastUseTick = gCurrentDrawCount;
-            return entry->width;
+            return &entry->glyph;
         }
 
         // If entry hasn't been used for a while, replace it
@@ -326,25 +330,39 @@ uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, std::string_view text)
         }
 
         // Check if next entry is a hit
-        if (++index >= TTF_GETWIDTH_CACHE_SIZE)
+        if (++index >= TTF_GLYPH_CACHE_SIZE)
             index = 0;
     }
 
-    // Cache miss, replace entry with new width
-    entry = &_ttfGetWidthCache[index];
-    ttf_getwidth_cache_dispose(entry);
+    // Cache miss, replace entry with the new glyph
+    entry = &_ttfGlyphCache[index];
+    ttf_glyph_cache_dispose(entry);
 
-    int32_t width, height;
-    ttf_get_size(font, text, &width, &height);
+    TTFGlyph glyph{};
+    if (TTF_GlyphMetrics(font, codepoint, &glyph.minx, &glyph.maxx, nullptr, nullptr, &glyph.advance) != 0)
+    {
+        return nullptr;
+    }
 
-    _ttfGetWidthCacheMissCount++;
+    // Render the glyph as a one character string so its pixels line up with those of a whole string surface.
+    utf8 buffer[8]{};
+    utf8_write_codepoint(buffer, codepoint);
+    glyph.surface = ttf_render(font, buffer);
+    glyph.slot = static_cast<uint32_t>(index);
+    glyph.replaced = true;
 
-    _ttfGetWidthCacheCount++;
-    entry->width = width;
+    _ttfGlyphCacheCount++;
+    entry->glyph = glyph;
     entry->font = font;
-    entry->text = strndup(text.data(), text.size());
+    entry->codepoint = codepoint;
     entry->lastUseTick = gCurrentDrawCount;
-    return entry->width;
+    return &entry->glyph;
+}
+
+int32_t ttf_get_kerning(TTF_Font* font, codepoint_t previous, codepoint_t codepoint)
+{
+    FontLockHelper<std::mutex> lock(_mutex);
+    return TTF_GetFontKerningSizeGlyphs(font, previous, codepoint);
 }
 
 TTFFontDescriptor* ttf_get_font_from_sprite_base(FontSpriteBase spriteBase)
@@ -358,13 +376,6 @@ bool ttf_provides_glyph(const TTF_Font* font, codepoint_t codepoint)
     return TTF_GlyphIsProvided(font, codepoint);
 }
 
-static bool ttf_get_size(TTF_Font* font, std::string_view text, int32_t* outWidth, int32_t* outHeight)
-{
-    thread_local std::string buffer;
-    buffer.assign(text);
-    return TTF_SizeUTF8(font, buffer.c_str(), outWidth, outHeight);
-}
-
 static TTFSurface* ttf_render(TTF_Font* font, std::string_view text)
 {
     thread_local std::string buffer;
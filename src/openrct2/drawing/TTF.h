@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include "../core/String.hpp"
 #include "Font.h"
 
+#include <algorithm>
 #include <string_view>
 
 bool ttf_initialise();
@@ -26,17 +28,82 @@ struct TTFSurface
     int32_t pitch;
 };
 
+#    define TTF_GLYPH_CACHE_SIZE 1024
+
+struct TTFGlyph
+{
+    // Rendered like a string of just this glyph, nullptr if the glyph has no width.
+    TTFSurface* surface;
+    int32_t minx;
+    int32_t maxx;
+    int32_t advance;
+    // Index of the glyph in the cache, below TTF_GLYPH_CACHE_SIZE. Drawing engines can key uploaded copies of the
+    // surface by it.
+    uint32_t slot;
+    // Set whenever the slot gets a new glyph, cleared by the drawing engine once it dropped its copy of the old one.
+    bool replaced;
+};
+
 TTFFontDescriptor* ttf_get_font_from_sprite_base(FontSpriteBase spriteBase);
 void ttf_toggle_hinting();
 TTFSurface* ttf_surface_cache_get_or_add(TTF_Font* font, std::string_view text);
-uint32_t ttf_getwidth_cache_get_or_add(TTF_Font* font, std::string_view text);
+TTFGlyph* ttf_glyph_cache_get_or_add(TTF_Font* font, codepoint_t codepoint);
+int32_t ttf_get_kerning(TTF_Font* font, codepoint_t previous, codepoint_t codepoint);
 bool ttf_provides_glyph(const TTF_Font* font, codepoint_t codepoint);
 void ttf_free_surface(TTFSurface* surface);
 
+/**
+ * Lays text out from its cached glyphs. Calls fn(glyph, x) for every glyph, where x is where the left of the glyph's
+ * surface goes relative to the start of the text, and returns the width the text would have as a single surface.
+ */
+template<typename TFn> int32_t ttf_layout(TTF_Font* font, std::string_view text, TFn&& fn)
+{
+    int32_t x = 0;
+    int32_t minx = 0;
+    int32_t maxx = 0;
+    // A string surface is shifted right when its first glyph starts left of the pen.
+    int32_t shift = 0;
+    codepoint_t previous = 0;
+    bool first = true;
+    for (auto codepoint : CodepointView(text))
+    {
+        // Byte order marks.
+        if (codepoint == 0xFEFF || codepoint == 0xFFFE)
+        {
+            continue;
+        }
+
+        auto* glyph = ttf_glyph_cache_get_or_add(font, codepoint);
+        if (glyph == nullptr)
+        {
+            break;
+        }
+        if (previous != 0)
+        {
+            x += ttf_get_kerning(font, previous, codepoint);
+        }
+
+        if (first)
+        {
+            shift = -std::min(glyph->minx, 0);
+            first = false;
+        }
+        fn(*glyph, shift + x + std::min(glyph->minx, 0));
+
+        minx = std::min(minx, x + glyph->minx);
+        maxx = std::max(maxx, x + std::max(glyph->advance, glyph->maxx));
+        x += glyph->advance;
+        previous = codepoint;
+    }
+    return maxx - minx;
+}
+
 // TTF_SDLPORT
 int TTF_Init(void);
 TTF_Font* TTF_OpenFont(const char* file, int ptsize);
 int TTF_GlyphIsProvided(const TTF_Font* font, codepoint_t ch);
+int TTF_GlyphMetrics(TTF_Font* font, codepoint_t ch, int* minx, int* maxx, int* miny, int* maxy, int* advance);
+int TTF_GetFontKerningSizeGlyphs(TTF_Font* font, codepoint_t previous_ch, codepoint_t ch);
 int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h);
 TTFSurface* TTF_RenderUTF8_Solid(TTF_Font* font, const char* text, uint32_t colour);
 TTFSurface* TTF_RenderUTF8_Shaded(TTF_Font* font, const char* text, uint32_t fg, uint32_t bg);
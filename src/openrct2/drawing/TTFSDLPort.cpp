@@ -1126,6 +1126,66 @@ int TTF_GlyphIsProvided(const TTF_Font* font, codepoint_t ch)
     return (FT_Get_Char_Index(font->face, ch));
 }
 
+int TTF_GlyphMetrics(TTF_Font* font, codepoint_t ch, int* minx, int* maxx, int* miny, int* maxy, int* advance)
+{
+    FT_Error error = Find_Glyph(font, static_cast<uint16_t>(ch), CACHED_METRICS);
+    if (error)
+    {
+        TTF_SetFTError("Couldn't find glyph", error);
+        return -1;
+    }
+
+    c_glyph* glyph = font->current;
+    if (minx != nullptr)
+    {
+        *minx = glyph->minx;
+    }
+    if (maxx != nullptr)
+    {
+        *maxx = glyph->maxx;
+        if (TTF_HANDLE_STYLE_BOLD(font))
+        {
+            *maxx += font->glyph_overhang;
+        }
+    }
+    if (miny != nullptr)
+    {
+        *miny = glyph->miny;
+    }
+    if (maxy != nullptr)
+    {
+        *maxy = glyph->maxy;
+    }
+    if (advance != nullptr)
+    {
+        *advance = glyph->advance;
+        if (TTF_HANDLE_STYLE_BOLD(font))
+        {
+            *advance += font->glyph_overhang;
+        }
+    }
+    return 0;
+}
+
+int TTF_GetFontKerningSizeGlyphs(TTF_Font* font, codepoint_t previous_ch, codepoint_t ch)
+{
+    if (!FT_HAS_KERNING(font->face) || !font->kerning)
+    {
+        return 0;
+    }
+
+    FT_UInt prev_index = FT_Get_Char_Index(font->face, static_cast<uint16_t>(previous_ch));
+    FT_UInt index = FT_Get_Char_Index(font->face, static_cast<uint16_t>(ch));
+    if (!prev_index || !index)
+    {
+        return 0;
+    }
+
+    FT_Vector delta;
+    FT_Get_Kerning(font->face, prev_index, index, ft_kerning_default, &delta);
+    return delta.x >> 6;
+}
+
 int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h)
 {
     int status;
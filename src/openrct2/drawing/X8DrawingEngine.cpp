@@ -98,16 +98,15 @@ void X8WeatherDrawer::Restore(rct_drawpixelinfo* dpi)
     {
         uint32_t numPixels = (dpi->width + dpi->pitch) * dpi->height;
         uint8_t* bits = dpi->bits;
-        for (uint32_t i = 0; i < _weatherPixelsCount; i++)
+        // The patterns of one weather type overlap, so a pixel may have been saved again after it was drawn over.
+        // Restoring in reverse leaves the colour that was saved first.
+        for (uint32_t i = _weatherPixelsCount; i-- > 0;)
         {
             WeatherPixel weatherPixel = _weatherPixels[i];
-            if (weatherPixel.Position >= numPixels)
+            if (weatherPixel.Position < numPixels)
             {
-                // Pixel out of bounds, bail
-                break;
+                bits[weatherPixel.Position] = weatherPixel.Colour;
             }
-
-            bits[weatherPixel.Position] = weatherPixel.Colour;
         }
         _weatherPixelsCount = 0;
     }
@@ -166,6 +165,8 @@ void X8DrawingEngine::Invalidate(int32_t left, int32_t top, int32_t right, int32
     if (top >= bottom)
         return;
 
+    _dirtyStats.Invalidations++;
+
     right--;
     bottom--;
 
@@ -214,6 +215,9 @@ void X8DrawingEngine::PaintWindows()
     DrawAllDirtyBlocks();
     window_update_all_viewports();
     DrawAllDirtyBlocks();
+
+    _lastDirtyStats = _dirtyStats;
+    _dirtyStats = {};
 }
 
 void X8DrawingEngine::PaintWeather()
@@ -357,19 +361,22 @@ void X8DrawingEngine::OnDrawDirtyBlock(
 
 void X8DrawingEngine::ConfigureDirtyGrid()
 {
-    _dirtyGrid.BlockShiftX = 7;
-    _dirtyGrid.BlockShiftY = 6;
+    // Small blocks keep the redrawn area close to what has actually changed, CoalesceDirtyRects merges them back into
+    // larger regions where the per region overhead outweighs redrawing a few more pixels.
+    _dirtyGrid.BlockShiftX = 5;
+    _dirtyGrid.BlockShiftY = 4;
     _dirtyGrid.BlockWidth = 1 << _dirtyGrid.BlockShiftX;
     _dirtyGrid.BlockHeight = 1 << _dirtyGrid.BlockShiftY;
     _dirtyGrid.BlockColumns = (_width >> _dirtyGrid.BlockShiftX) + 1;
     _dirtyGrid.BlockRows = (_height >> _dirtyGrid.BlockShiftY) + 1;
 
     delete[] _dirtyGrid.Blocks;
-    _dirtyGrid.Blocks = new uint8_t[_dirtyGrid.BlockColumns * _dirtyGrid.BlockRows];
+    _dirtyGrid.Blocks = new uint8_t[_dirtyGrid.BlockColumns * _dirtyGrid.BlockRows]{};
 }
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
+    _dirtyRects.clear();
     for (uint32_t x = 0; x < _dirtyGrid.BlockColumns; x++)
     {
         for (uint32_t y = 0; y < _dirtyGrid.BlockRows; y++)
@@ -393,9 +400,18 @@ void X8DrawingEngine::DrawAllDirtyBlocks()
             // Check rows
             uint32_t columns = xx - x;
             auto rows = GetNumDirtyRows(x, y, columns);
-            DrawDirtyBlocks(x, y, columns, rows);
+
+            const DirtyRect rect = { x, y, columns, rows };
+            ClearDirtyBlocks(rect);
+            _dirtyRects.push_back(rect);
         }
     }
+
+    CoalesceDirtyRects();
+    for (const auto& rect : _dirtyRects)
+    {
+        DrawDirtyBlocks(rect);
+    }
 }
 
 uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns)
@@ -416,33 +432,77 @@ uint32_t X8DrawingEngine::GetNumDirtyRows(const uint32_t x, const uint32_t y, co
     return yy - y;
 }
 
-void X8DrawingEngine::DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows)
+void X8DrawingEngine::ClearDirtyBlocks(const DirtyRect& rect)
 {
     uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
     uint8_t* screenDirtyBlocks = _dirtyGrid.Blocks;
 
-    // Unset dirty blocks
-    for (uint32_t top = y; top < y + rows; top++)
+    for (uint32_t top = rect.Y; top < rect.Y + rect.Rows; top++)
     {
         uint32_t topOffset = top * dirtyBlockColumns;
-        for (uint32_t left = x; left < x + columns; left++)
+        for (uint32_t left = rect.X; left < rect.X + rect.Columns; left++)
         {
             screenDirtyBlocks[topOffset + left] = 0;
         }
     }
+}
+
+// Drawing a region has a fixed cost on top of the pixels, for visiting the windows and setting up the viewport paint.
+// Two regions are drawn as one when that redraws no more than this many blocks which are not dirty.
+constexpr uint32_t DIRTY_RECT_MERGE_SLACK_BLOCKS = 8;
+
+// Merging is quadratic in the number of regions, past this many the screen is mostly dirty anyway.
+constexpr size_t DIRTY_RECT_MERGE_LIMIT = 256;
+
+void X8DrawingEngine::CoalesceDirtyRects()
+{
+    if (_dirtyRects.size() > DIRTY_RECT_MERGE_LIMIT)
+    {
+        return;
+    }
+
+    const auto area = [](const DirtyRect& r) { return r.Columns * r.Rows; };
+    for (size_t i = 0; i < _dirtyRects.size(); i++)
+    {
+        for (size_t j = i + 1; j < _dirtyRects.size(); j++)
+        {
+            const auto& a = _dirtyRects[i];
+            const auto& b = _dirtyRects[j];
+            const auto left = std::min(a.X, b.X);
+            const auto top = std::min(a.Y, b.Y);
+            const auto right = std::max(a.X + a.Columns, b.X + b.Columns);
+            const auto bottom = std::max(a.Y + a.Rows, b.Y + b.Rows);
+            const DirtyRect merged = { left, top, right - left, bottom - top };
+            if (area(merged) > area(a) + area(b) + DIRTY_RECT_MERGE_SLACK_BLOCKS)
+            {
+                continue;
+            }
+
+            // The merged region may now be close to regions that have already been checked against it.
+            _dirtyRects[i] = merged;
+            _dirtyRects.erase(_dirtyRects.begin() + j);
+            j = i;
+        }
+    }
+}
 
+void X8DrawingEngine::DrawDirtyBlocks(const DirtyRect& rect)
+{
     // Determine region in pixels
-    uint32_t left = std::max<uint32_t>(0, x * _dirtyGrid.BlockWidth);
-    uint32_t top = std::max<uint32_t>(0, y * _dirtyGrid.BlockHeight);
-    uint32_t right = std::min(_width, left + (columns * _dirtyGrid.BlockWidth));
-    uint32_t bottom = std::min(_height, top + (rows * _dirtyGrid.BlockHeight));
+    uint32_t left = std::max<uint32_t>(0, rect.X * _dirtyGrid.BlockWidth);
+    uint32_t top = std::max<uint32_t>(0, rect.Y * _dirtyGrid.BlockHeight);
+    uint32_t right = std::min(_width, left + (rect.Columns * _dirtyGrid.BlockWidth));
+    uint32_t bottom = std::min(_height, top + (rect.Rows * _dirtyGrid.BlockHeight));
     if (right <= left || bottom <= top)
     {
         return;
     }
 
+    _dirtyStats.Rects++;
+    _dirtyStats.Pixels += static_cast<uint64_t>(right - left) * (bottom - top);
+
     // Draw region
-    OnDrawDirtyBlock(x, y, columns, rows);
+    OnDrawDirtyBlock(rect.X, rect.Y, rect.Columns, rect.Rows);
     window_draw_all(&_bitsDPI, left, top, right, bottom);
 }
 
@@ -697,9 +757,15 @@ void X8DrawingContext::FilterRect(
 
         // Fill the rectangle with the colours from the colour table
         auto c = dpi->zoom_level.ApplyInversedTo(height);
+        auto map = paletteEntries.GetFullMap();
         for (int32_t i = 0; i < c; i++)
         {
             uint8_t* nextdst = dst + step * i;
+            if (map != nullptr)
+            {
+                filter_run_fn(nextdst, map, scaled_width);
+                continue;
+            }
             for (int32_t j = 0; j < scaled_width; j++)
             {
                 auto index = *(nextdst + j);
@@ -13,6 +13,8 @@
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
 
+#include <vector>
+
 namespace OpenRCT2
 {
     namespace Ui
@@ -35,6 +37,14 @@ namespace OpenRCT2
             uint8_t* Blocks;
         };
 
+        // Counters for how much of the screen gets redrawn, see X8DrawingEngine::GetDirtyStats.
+        struct DirtyStats
+        {
+            uint32_t Invalidations;
+            uint32_t Rects;
+            uint64_t Pixels;
+        };
+
         class X8WeatherDrawer final : public IWeatherDrawer
         {
         private:
@@ -74,6 +84,22 @@ namespace OpenRCT2
 
             DirtyGrid _dirtyGrid = {};
 
+        private:
+            // A region of dirty blocks, in blocks.
+            struct DirtyRect
+            {
+                uint32_t X;
+                uint32_t Y;
+                uint32_t Columns;
+                uint32_t Rows;
+            };
+
+            std::vector<DirtyRect> _dirtyRects;
+            DirtyStats _dirtyStats = {};
+            DirtyStats _lastDirtyStats = {};
+
+        protected:
+
             rct_drawpixelinfo _bitsDPI = {};
 
 #ifdef __ENABLE_LIGHTFX__
@@ -114,6 +140,14 @@ namespace OpenRCT2
 
             rct_drawpixelinfo* GetDPI();
 
+            /**
+             * Returns the invalidations and the redrawn regions of the last PaintWindows call.
+             */
+            const DirtyStats& GetDirtyStats() const
+            {
+                return _lastDirtyStats;
+            }
+
         protected:
             void ConfigureBits(uint32_t width, uint32_t height, uint32_t pitch);
             virtual void OnDrawDirtyBlock(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
@@ -123,7 +157,9 @@ namespace OpenRCT2
             static void ResetWindowVisbilities();
             void DrawAllDirtyBlocks();
             uint32_t GetNumDirtyRows(const uint32_t x, const uint32_t y, const uint32_t columns);
-            void DrawDirtyBlocks(uint32_t x, uint32_t y, uint32_t columns, uint32_t rows);
+            void ClearDirtyBlocks(const DirtyRect& rect);
+            void CoalesceDirtyRects();
+            void DrawDirtyBlocks(const DirtyRect& rect);
         };
 #ifdef __WARN_SUGGEST_FINAL_TYPES__
 #    pragma GCC diagnostic pop
@@ -150,7 +186,7 @@ namespace OpenRCT2
             void DrawGlyph(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, const PaletteMap& paletteMap) override;
             void DrawBitmap(
                 rct_drawpixelinfo* dpi, uint32_t image, const void* pixels, int32_t width, int32_t height, int32_t x,
-                int32_t y) override
+                int32_t y, uint8_t colour) override
             {
             }
         };
@@ -0,0 +1,188 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "../core/Numerics.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+/**
+ * A set of entity ids stored as a bitset over all entity slots, with a summary level to skip empty blocks.
+ * Iteration is always in ascending id order. Iterators read the live bits, so ids can be inserted or erased while
+ * iterating: erased ids are not visited and inserted ids are visited if they lie ahead of the iterator.
+ */
+class EntityIdSet
+{
+public:
+    static constexpr size_t Capacity = std::numeric_limits<EntityId::UnderlyingType>::max();
+
+private:
+    using Block = uint64_t;
+    static constexpr size_t BlockBits = std::numeric_limits<Block>::digits;
+    static constexpr size_t BlockCount = (Capacity + BlockBits - 1) / BlockBits;
+    static constexpr size_t SummaryCount = (BlockCount + BlockBits - 1) / BlockBits;
+
+    std::array<Block, BlockCount> _blocks{};
+    // Bit n is set when _blocks[n] is not empty.
+    std::array<Block, SummaryCount> _summary{};
+    size_t _count{};
+
+public:
+    class const_iterator
+    {
+    private:
+        const EntityIdSet* _set;
+        size_t _index;
+
+    public:
+        const_iterator(const EntityIdSet* set, size_t index)
+            : _set(set)
+            , _index(index)
+        {
+        }
+        const_iterator& operator++()
+        {
+            _index = _set->FindNext(_index + 1);
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator retval = *this;
+            ++(*this);
+            return retval;
+        }
+        bool operator==(const const_iterator& other) const
+        {
+            return _index == other._index;
+        }
+        bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+        EntityId operator*() const
+        {
+            return EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(_index));
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = EntityId;
+        using pointer = const EntityId*;
+        using reference = EntityId;
+        using iterator_category = std::forward_iterator_tag;
+    };
+
+    bool contains(EntityId id) const
+    {
+        const auto index = id.ToUnderlying();
+        return index < Capacity && (_blocks[index / BlockBits] & (Block{ 1 } << (index % BlockBits))) != 0;
+    }
+
+    bool insert(EntityId id)
+    {
+        if (id.IsNull() || contains(id))
+        {
+            return false;
+        }
+        const auto index = id.ToUnderlying();
+        const auto block = index / BlockBits;
+        _blocks[block] |= Block{ 1 } << (index % BlockBits);
+        _summary[block / BlockBits] |= Block{ 1 } << (block % BlockBits);
+        _count++;
+        return true;
+    }
+
+    bool erase(EntityId id)
+    {
+        if (!contains(id))
+        {
+            return false;
+        }
+        const auto index = id.ToUnderlying();
+        const auto block = index / BlockBits;
+        _blocks[block] &= ~(Block{ 1 } << (index % BlockBits));
+        if (_blocks[block] == 0)
+        {
+            _summary[block / BlockBits] &= ~(Block{ 1 } << (block % BlockBits));
+        }
+        _count--;
+        return true;
+    }
+
+    void clear()
+    {
+        _blocks.fill(0);
+        _summary.fill(0);
+        _count = 0;
+    }
+
+    size_t size() const
+    {
+        return _count;
+    }
+
+    bool empty() const
+    {
+        return _count == 0;
+    }
+
+    /**
+     * Returns the lowest id in the set that is not below index, or Capacity if there is none.
+     */
+    size_t FindNext(size_t index) const
+    {
+        if (index >= Capacity)
+        {
+            return Capacity;
+        }
+
+        // Remaining bits of the block index falls into.
+        auto block = index / BlockBits;
+        auto bits = _blocks[block] & (~Block{ 0 } << (index % BlockBits));
+        if (bits != 0)
+        {
+            return block * BlockBits + Numerics::ctz64(bits);
+        }
+
+        // Find the next non-empty block from the summary.
+        block++;
+        auto summaryIndex = block / BlockBits;
+        if (summaryIndex >= SummaryCount)
+        {
+            return Capacity;
+        }
+        auto summaryBits = _summary[summaryIndex] & (~Block{ 0 } << (block % BlockBits));
+        while (summaryBits == 0)
+        {
+            summaryIndex++;
+            if (summaryIndex >= SummaryCount)
+            {
+                return Capacity;
+            }
+            summaryBits = _summary[summaryIndex];
+        }
+        block = summaryIndex * BlockBits + Numerics::ctz64(summaryBits);
+        return block * BlockBits + Numerics::ctz64(_blocks[block]);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, FindNext(0));
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, Capacity);
+    }
+};
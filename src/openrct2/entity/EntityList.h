@@ -12,19 +12,31 @@
 #include "../common.h"
 #include "../rct12/RCT12.h"
 #include "../world/Location.hpp"
+#include "../world/Map.h"
 #include "EntityBase.h"
+#include "EntityIdSet.h"
 #include "EntityRegistry.h"
 
-#include <list>
+#include <algorithm>
 #include <vector>
 
-const std::list<EntityId>& GetEntityList(const EntityType id);
+const EntityIdSet& GetEntityList(const EntityType id);
+// Changes whenever an entity is added to or removed from the list.
+uint32_t GetEntityListGeneration(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
 
+// Size of the square chunks all entities are additionally indexed by, see EntityRangeQuery.
+constexpr int32_t ENTITY_CHUNK_SIZE = 8 * COORDS_XY_STEP;
+const std::vector<EntityId>& GetEntityChunkList(const CoordsXY& chunkPos);
+
+// Litter is also indexed on its own by chunks, see Litter::ForEachNear.
+constexpr int32_t LITTER_BUCKET_SIZE = ENTITY_CHUNK_SIZE;
+const std::vector<EntityId>& GetLitterBucketList(const CoordsXY& bucketPos);
+
 template<typename T> class EntityTileIterator
 {
 private:
@@ -97,15 +109,133 @@ public:
     }
 };
 
+/**
+ * Iterates over the entities of type T whose location lies within the given range, bounds included. The entities
+ * are visited chunk by chunk and in ascending id order within each chunk, not in global id order.
+ */
+template<typename T = EntityBase> class EntityRangeQuery
+{
+private:
+    MapRange range;
+    int32_t chunkStartY;
+    int32_t chunkEndX;
+    int32_t chunkEndY;
+
+public:
+    class Iterator
+    {
+    private:
+        const EntityRangeQuery* query = nullptr;
+        int32_t chunkX = 0;
+        int32_t chunkY = 0;
+        std::vector<EntityId>::const_iterator iter;
+        std::vector<EntityId>::const_iterator end;
+        T* Entity = nullptr;
+
+    public:
+        Iterator() = default;
+        Iterator(const EntityRangeQuery* _query, int32_t _chunkX, int32_t _chunkY)
+            : query(_query)
+            , chunkX(_chunkX)
+            , chunkY(_chunkY)
+        {
+            const auto& vec = GetEntityChunkList({ chunkX, chunkY });
+            iter = std::begin(vec);
+            end = std::end(vec);
+            ++(*this);
+        }
+        Iterator& operator++()
+        {
+            Entity = nullptr;
+            while (query != nullptr)
+            {
+                while (iter != end)
+                {
+                    auto* entity = GetEntity<T>(*iter++);
+                    if (entity != nullptr && entity->x >= query->range.GetLeft() && entity->x <= query->range.GetRight()
+                        && entity->y >= query->range.GetTop() && entity->y <= query->range.GetBottom())
+                    {
+                        Entity = entity;
+                        return *this;
+                    }
+                }
+
+                chunkY += ENTITY_CHUNK_SIZE;
+                if (chunkY > query->chunkEndY)
+                {
+                    chunkY = query->chunkStartY;
+                    chunkX += ENTITY_CHUNK_SIZE;
+                    if (chunkX > query->chunkEndX)
+                    {
+                        query = nullptr;
+                        break;
+                    }
+                }
+                const auto& vec = GetEntityChunkList({ chunkX, chunkY });
+                iter = std::begin(vec);
+                end = std::end(vec);
+            }
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return Entity == other.Entity;
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+        T* operator*()
+        {
+            return Entity;
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = const T*;
+        using reference = const T&;
+        using iterator_category = std::forward_iterator_tag;
+    };
+
+    EntityRangeQuery(const MapRange& _range)
+        : range(_range.Normalise())
+    {
+        const auto chunkStart = [](int32_t coord) { return std::max(coord, 0) / ENTITY_CHUNK_SIZE * ENTITY_CHUNK_SIZE; };
+        chunkStartY = chunkStart(range.GetTop());
+        chunkEndX = std::min(range.GetRight(), MAXIMUM_MAP_SIZE_BIG - 1);
+        chunkEndY = std::min(range.GetBottom(), MAXIMUM_MAP_SIZE_BIG - 1);
+    }
+
+    EntityRangeQuery(const CoordsXY& centre, int32_t radius)
+        : EntityRangeQuery(MapRange(centre.x - radius, centre.y - radius, centre.x + radius, centre.y + radius))
+    {
+    }
+
+    Iterator begin() const
+    {
+        const auto chunkStartX = std::max(range.GetLeft(), 0) / ENTITY_CHUNK_SIZE * ENTITY_CHUNK_SIZE;
+        if (chunkStartX > chunkEndX || chunkStartY > chunkEndY)
+        {
+            return end();
+        }
+        return Iterator(this, chunkStartX, chunkStartY);
+    }
+    Iterator end() const
+    {
+        return Iterator();
+    }
+};
+
 template<typename T> class EntityListIterator
 {
 private:
-    std::list<EntityId>::const_iterator iter;
-    std::list<EntityId>::const_iterator end;
+    EntityIdSet::const_iterator iter;
+    EntityIdSet::const_iterator end;
     T* Entity = nullptr;
 
 public:
-    EntityListIterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
+    EntityListIterator(EntityIdSet::const_iterator _iter, EntityIdSet::const_iterator _end)
         : iter(_iter)
         , end(_end)
     {
@@ -152,7 +282,7 @@ template<typename T = EntityBase> class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<EntityId>& vec;
+    const EntityIdSet& vec;
 
 public:
     EntityList()
@@ -27,12 +27,14 @@
 #include "Duck.h"
 #include "EntityTweener.h"
 #include "Fountain.h"
+#include "GuestHotState.h"
 #include "MoneyEffect.h"
 #include "Particle.h"
 
 #include <algorithm>
 #include <cmath>
 #include <iterator>
+#include <memory>
 #include <numeric>
 #include <vector>
 
@@ -46,8 +48,14 @@ union Entity
     }
 };
 
-static Entity _entities[MAX_ENTITIES]{};
-static std::array<std::list<EntityId>, EnumValue(EntityType::Count)> gEntityLists;
+// Entity slots are allocated in blocks when the first entity of a block is created, so a park only pays for the slots
+// it has used. Free ids are handed out lowest first which keeps the used slots in as few blocks as possible.
+static constexpr size_t EntityBlockSize = 256;
+static constexpr size_t EntityBlockCount = (MAX_ENTITIES + EntityBlockSize - 1) / EntityBlockSize;
+static std::array<std::unique_ptr<Entity[]>, EntityBlockCount> _entityBlocks;
+static std::array<EntityIdSet, EnumValue(EntityType::Count)> gEntityLists;
+static std::array<uint32_t, EnumValue(EntityType::Count)> gEntityListGenerations;
+static_assert(MAX_ENTITIES <= EntityIdSet::Capacity);
 static std::vector<EntityId> _freeIdList;
 
 static bool _entityFlashingList[MAX_ENTITIES];
@@ -55,7 +63,82 @@ static bool _entityFlashingList[MAX_ENTITIES];
 constexpr const uint32_t SPATIAL_INDEX_SIZE = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL) + 1;
 constexpr const uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
-static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
+/**
+ * The entities on each tile. The lists are grouped in square chunks that are only allocated once an entity enters them,
+ * so the memory follows the area the entities are in rather than the maximum map size.
+ */
+class EntitySpatialIndex
+{
+    static constexpr size_t ChunkTiles = 32;
+    static constexpr size_t ChunkStride = (MAXIMUM_MAP_SIZE_TECHNICAL + ChunkTiles - 1) / ChunkTiles;
+    using Chunk = std::array<std::vector<EntityId>, ChunkTiles * ChunkTiles>;
+
+    std::array<std::unique_ptr<Chunk>, ChunkStride * ChunkStride> _chunks;
+    // Entities with a null location.
+    std::vector<EntityId> _nullList;
+    static inline const std::vector<EntityId> _emptyList;
+
+public:
+    const std::vector<EntityId>& Find(size_t offset) const
+    {
+        if (offset == SPATIAL_INDEX_LOCATION_NULL)
+        {
+            return _nullList;
+        }
+        const auto& chunk = _chunks[GetChunkIndex(offset)];
+        return chunk == nullptr ? _emptyList : (*chunk)[GetListIndex(offset)];
+    }
+
+    std::vector<EntityId>& Get(size_t offset)
+    {
+        if (offset == SPATIAL_INDEX_LOCATION_NULL)
+        {
+            return _nullList;
+        }
+        auto& chunk = _chunks[GetChunkIndex(offset)];
+        if (chunk == nullptr)
+        {
+            chunk = std::make_unique<Chunk>();
+        }
+        return (*chunk)[GetListIndex(offset)];
+    }
+
+    void Clear()
+    {
+        for (auto& chunk : _chunks)
+        {
+            chunk.reset();
+        }
+        _nullList.clear();
+    }
+
+private:
+    static size_t GetChunkIndex(size_t offset)
+    {
+        const auto tileX = offset / MAXIMUM_MAP_SIZE_TECHNICAL;
+        const auto tileY = offset % MAXIMUM_MAP_SIZE_TECHNICAL;
+        return (tileX / ChunkTiles) * ChunkStride + tileY / ChunkTiles;
+    }
+
+    static size_t GetListIndex(size_t offset)
+    {
+        const auto tileX = offset / MAXIMUM_MAP_SIZE_TECHNICAL;
+        const auto tileY = offset % MAXIMUM_MAP_SIZE_TECHNICAL;
+        return (tileX % ChunkTiles) * ChunkTiles + tileY % ChunkTiles;
+    }
+};
+
+static EntitySpatialIndex gEntitySpatialIndex;
+
+constexpr const uint32_t CHUNK_INDEX_STRIDE = (MAXIMUM_MAP_SIZE_BIG + ENTITY_CHUNK_SIZE - 1) / ENTITY_CHUNK_SIZE;
+constexpr const uint32_t CHUNK_INDEX_SIZE = (CHUNK_INDEX_STRIDE * CHUNK_INDEX_STRIDE) + 1;
+constexpr const uint32_t CHUNK_INDEX_LOCATION_NULL = CHUNK_INDEX_SIZE - 1;
+
+// All entities by chunks of ENTITY_CHUNK_SIZE, so range queries only visit a few lists instead of every tile.
+static std::array<std::vector<EntityId>, CHUNK_INDEX_SIZE> gEntityChunkIndex;
+
+// Litter only, by buckets of LITTER_BUCKET_SIZE so nearby litter can be found without visiting every tile.
+static std::array<std::vector<EntityId>, CHUNK_INDEX_SIZE> gLitterSpatialIndex;
 
 static void FreeEntity(EntityBase& entity);
 
@@ -74,6 +157,18 @@ static constexpr size_t GetSpatialIndexOffset(const CoordsXY& loc)
     return tileX * MAXIMUM_MAP_SIZE_TECHNICAL + tileY;
 }
 
+static constexpr size_t GetChunkIndexOffset(const CoordsXY& loc)
+{
+    const auto offset = GetSpatialIndexOffset(loc);
+    if (offset == SPATIAL_INDEX_LOCATION_NULL)
+        return CHUNK_INDEX_LOCATION_NULL;
+
+    constexpr auto chunkTiles = ENTITY_CHUNK_SIZE / COORDS_XY_STEP;
+    const auto tileX = offset / MAXIMUM_MAP_SIZE_TECHNICAL;
+    const auto tileY = offset % MAXIMUM_MAP_SIZE_TECHNICAL;
+    return (tileX / chunkTiles) * CHUNK_INDEX_STRIDE + tileY / chunkTiles;
+}
+
 constexpr bool EntityTypeIsMiscEntity(const EntityType type)
 {
     switch (type)
@@ -121,7 +216,35 @@ std::string EntitiesChecksum::ToString() const
 EntityBase* TryGetEntity(EntityId entityIndex)
 {
     const auto idx = entityIndex.ToUnderlying();
-    return idx >= MAX_ENTITIES ? nullptr : &_entities[idx].base;
+    if (idx >= MAX_ENTITIES)
+    {
+        return nullptr;
+    }
+    const auto& block = _entityBlocks[idx / EntityBlockSize];
+    return block == nullptr ? nullptr : &block[idx % EntityBlockSize].base;
+}
+
+static EntityBase* GetOrAllocateEntity(EntityId entityIndex)
+{
+    const auto idx = entityIndex.ToUnderlying();
+    if (idx >= MAX_ENTITIES)
+    {
+        return nullptr;
+    }
+
+    auto& block = _entityBlocks[idx / EntityBlockSize];
+    if (block == nullptr)
+    {
+        block = std::make_unique<Entity[]>(EntityBlockSize);
+        const auto firstIndex = idx - idx % EntityBlockSize;
+        for (size_t i = 0; i < EntityBlockSize; i++)
+        {
+            auto& entity = block[i].base;
+            entity.Type = EntityType::Null;
+            entity.sprite_index = EntityId::FromUnderlying(static_cast<EntityId::UnderlyingType>(firstIndex + i));
+        }
+    }
+    return &block[idx % EntityBlockSize].base;
 }
 
 EntityBase* GetEntity(EntityId entityIndex)
@@ -136,7 +259,17 @@ EntityBase* GetEntity(EntityId entityIndex)
 
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
 {
-    return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
+    return gEntitySpatialIndex.Find(GetSpatialIndexOffset(spritePos));
+}
+
+const std::vector<EntityId>& GetEntityChunkList(const CoordsXY& chunkPos)
+{
+    return gEntityChunkIndex[GetChunkIndexOffset(chunkPos)];
+}
+
+const std::vector<EntityId>& GetLitterBucketList(const CoordsXY& bucketPos)
+{
+    return gLitterSpatialIndex[GetChunkIndexOffset(bucketPos)];
 }
 
 static void ResetEntityLists()
@@ -145,6 +278,10 @@ static void ResetEntityLists()
     {
         list.clear();
     }
+    for (auto& generation : gEntityListGenerations)
+    {
+        generation++;
+    }
 }
 
 static void ResetFreeIds()
@@ -160,11 +297,16 @@ static void ResetFreeIds()
     });
 }
 
-const std::list<EntityId>& GetEntityList(const EntityType id)
+const EntityIdSet& GetEntityList(const EntityType id)
 {
     return gEntityLists[EnumValue(id)];
 }
 
+uint32_t GetEntityListGeneration(const EntityType id)
+{
+    return gEntityListGenerations[EnumValue(id)];
+}
+
 /**
  *
  *  rct2: 0x0069EB13
@@ -184,24 +326,17 @@ void ResetAllEntities()
         FreeEntity(*spr);
     }
 
-    std::fill(std::begin(_entities), std::end(_entities), Entity());
-    OpenRCT2::RideUse::GetHistory().Clear();
-    OpenRCT2::RideUse::GetTypeHistory().Clear();
-    for (int32_t i = 0; i < MAX_ENTITIES; ++i)
+    for (auto& block : _entityBlocks)
     {
-        auto* spr = GetEntity(EntityId::FromUnderlying(i));
-        if (spr == nullptr)
-        {
-            continue;
-        }
-        spr->Type = EntityType::Null;
-        spr->sprite_index = EntityId::FromUnderlying(i);
-
-        _entityFlashingList[i] = false;
+        block.reset();
     }
+    OpenRCT2::RideUse::GetHistory().Clear();
+    OpenRCT2::RideUse::GetTypeHistory().Clear();
+    std::fill(std::begin(_entityFlashingList), std::end(_entityFlashingList), false);
     ResetEntityLists();
     ResetFreeIds();
     ResetEntitySpatialIndices();
+    GuestHotState::Get().Reset();
 }
 
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
@@ -214,7 +349,12 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
  */
 void ResetEntitySpatialIndices()
 {
-    for (auto& vec : gEntitySpatialIndex)
+    gEntitySpatialIndex.Clear();
+    for (auto& vec : gEntityChunkIndex)
+    {
+        vec.clear();
+    }
+    for (auto& vec : gLitterSpatialIndex)
     {
         vec.clear();
     }
@@ -278,9 +418,9 @@ static void EntityReset(EntityBase* entity)
 static constexpr uint16_t MAX_MISC_SPRITES = 300;
 static void AddToEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    // Entity list must be in sprite_index order to prevent desync issues
-    list.insert(std::lower_bound(std::begin(list), std::end(list), entity->sprite_index), entity->sprite_index);
+    // Entity lists are iterated in sprite_index order to prevent desync issues
+    gEntityLists[EnumValue(entity->Type)].insert(entity->sprite_index);
+    gEntityListGenerations[EnumValue(entity->Type)]++;
 }
 
 static void AddToFreeList(EntityId index)
@@ -291,12 +431,8 @@ static void AddToFreeList(EntityId index)
 
 static void RemoveFromEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    auto ptr = binary_find(std::begin(list), std::end(list), entity->sprite_index);
-    if (ptr != std::end(list))
-    {
-        list.erase(ptr);
-    }
+    gEntityLists[EnumValue(entity->Type)].erase(entity->sprite_index);
+    gEntityListGenerations[EnumValue(entity->Type)]++;
 }
 
 uint16_t GetMiscEntityCount()
@@ -319,6 +455,10 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
 
     base->Type = type;
     AddToEntityList(base);
+    if (type == EntityType::Guest)
+    {
+        GuestHotState::Get().Invalidate();
+    }
 
     base->x = LOCATION_NULL;
     base->y = LOCATION_NULL;
@@ -351,7 +491,7 @@ EntityBase* CreateEntity(EntityType type)
         }
     }
 
-    auto* entity = GetEntity(_freeIdList.back());
+    auto* entity = GetOrAllocateEntity(_freeIdList.back());
     if (entity == nullptr)
     {
         return nullptr;
@@ -371,7 +511,7 @@ EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
         return nullptr;
     }
 
-    auto* entity = GetEntity(index);
+    auto* entity = GetOrAllocateEntity(index);
     if (entity == nullptr)
     {
         return nullptr;
@@ -413,15 +553,27 @@ void UpdateAllMiscEntities()
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
 {
     size_t newIndex = GetSpatialIndexOffset(newLoc);
-    auto& spatialVector = gEntitySpatialIndex[newIndex];
+    auto& spatialVector = gEntitySpatialIndex.Get(newIndex);
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->sprite_index);
     spatialVector.insert(index, entity->sprite_index);
+
+    const auto chunkIndex = GetChunkIndexOffset(newLoc);
+    auto& chunkVector = gEntityChunkIndex[chunkIndex];
+    auto chunkListIndex = std::lower_bound(std::begin(chunkVector), std::end(chunkVector), entity->sprite_index);
+    chunkVector.insert(chunkListIndex, entity->sprite_index);
+
+    if (entity->Type == EntityType::Litter)
+    {
+        auto& litterVector = gLitterSpatialIndex[chunkIndex];
+        auto litterIndex = std::lower_bound(std::begin(litterVector), std::end(litterVector), entity->sprite_index);
+        litterVector.insert(litterIndex, entity->sprite_index);
+    }
 }
 
 static void EntitySpatialRemove(EntityBase* entity)
 {
     size_t currentIndex = GetSpatialIndexOffset({ entity->x, entity->y });
-    auto& spatialVector = gEntitySpatialIndex[currentIndex];
+    auto& spatialVector = gEntitySpatialIndex.Get(currentIndex);
     auto index = binary_find(std::begin(spatialVector), std::end(spatialVector), entity->sprite_index);
     if (index != std::end(spatialVector))
     {
@@ -431,6 +583,25 @@ static void EntitySpatialRemove(EntityBase* entity)
     {
         log_warning("Bad sprite spatial index. Rebuilding the spatial index...");
         ResetEntitySpatialIndices();
+        return;
+    }
+
+    const auto chunkIndex = GetChunkIndexOffset({ entity->x, entity->y });
+    auto& chunkVector = gEntityChunkIndex[chunkIndex];
+    auto chunkListIndex = binary_find(std::begin(chunkVector), std::end(chunkVector), entity->sprite_index);
+    if (chunkListIndex != std::end(chunkVector))
+    {
+        chunkVector.erase(chunkListIndex, chunkListIndex + 1);
+    }
+
+    if (entity->Type == EntityType::Litter)
+    {
+        auto& litterVector = gLitterSpatialIndex[chunkIndex];
+        auto litterIndex = binary_find(std::begin(litterVector), std::end(litterVector), entity->sprite_index);
+        if (litterIndex != std::end(litterVector))
+        {
+            litterVector.erase(litterIndex, litterIndex + 1);
+        }
     }
 }
 
@@ -501,6 +672,11 @@ static void FreeEntity(EntityBase& entity)
         guest->SetName({});
         OpenRCT2::RideUse::GetHistory().RemoveHandle(guest->sprite_index);
         OpenRCT2::RideUse::GetTypeHistory().RemoveHandle(guest->sprite_index);
+        GuestHotState::Get().Remove(guest->sprite_index);
+    }
+    else if (entity.Is<Litter>())
+    {
+        guest_surroundings_invalidate({ entity.x, entity.y });
     }
 }
 
@@ -15,22 +15,30 @@
 #include "EntityRegistry.h"
 
 #include <cmath>
+void EntityTweener::AddEntity(EntityBase* entity)
+{
+    const auto index = entity->sprite_index.ToUnderlying();
+    if (index < SlotIndex.size())
+    {
+        SlotIndex[index] = static_cast<uint32_t>(Entities.size());
+    }
+    Entities.push_back(entity);
+    PrePos.emplace_back(entity->GetLocation());
+}
+
 void EntityTweener::PopulateEntities()
 {
     for (auto ent : EntityList<Guest>())
     {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->GetLocation());
+        AddEntity(ent);
     }
     for (auto ent : EntityList<Staff>())
     {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->GetLocation());
+        AddEntity(ent);
     }
     for (auto ent : EntityList<Vehicle>())
     {
-        Entities.push_back(ent);
-        PrePos.emplace_back(ent->GetLocation());
+        AddEntity(ent);
     }
 }
 
@@ -43,8 +51,9 @@ void EntityTweener::PreTick()
 
 void EntityTweener::PostTick()
 {
-    for (auto* ent : Entities)
+    for (size_t i = 0; i < Entities.size(); ++i)
     {
+        auto* ent = Entities[i];
         if (ent == nullptr)
         {
             // Sprite was removed, add a dummy position to keep the index aligned.
@@ -53,6 +62,10 @@ void EntityTweener::PostTick()
         else
         {
             PostPos.emplace_back(ent->GetLocation());
+            if (PostPos[i] != PrePos[i])
+            {
+                Moving.push_back(static_cast<uint32_t>(i));
+            }
         }
     }
 }
@@ -65,15 +78,19 @@ void EntityTweener::RemoveEntity(EntityBase* entity)
         return;
     }
 
-    auto it = std::find(Entities.begin(), Entities.end(), entity);
-    if (it != Entities.end())
-        *it = nullptr;
+    const auto index = entity->sprite_index.ToUnderlying();
+    if (index >= SlotIndex.size())
+        return;
+
+    const auto entityIndex = SlotIndex[index];
+    if (entityIndex < Entities.size() && Entities[entityIndex] == entity)
+        Entities[entityIndex] = nullptr;
 }
 
 void EntityTweener::Tween(float alpha)
 {
     const float inv = (1.0f - alpha);
-    for (size_t i = 0; i < Entities.size(); ++i)
+    for (auto i : Moving)
     {
         auto* ent = Entities[i];
         if (ent == nullptr)
@@ -82,21 +99,21 @@ void EntityTweener::Tween(float alpha)
         auto& posA = PrePos[i];
         auto& posB = PostPos[i];
 
-        if (posA == posB)
+        const CoordsXYZ newPos = { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
+                                   static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
+                                   static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) };
+        if (newPos == ent->GetLocation())
             continue;
 
-        EntitySetCoordinates(
-            { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
-              static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
-              static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) },
-            ent);
+        EntitySetCoordinates(newPos, ent);
         ent->Invalidate();
     }
 }
 
 void EntityTweener::Restore()
 {
-    for (size_t i = 0; i < Entities.size(); ++i)
+    // Entities that did not move during the tick are never tweened, so they are still at their post tick position.
+    for (auto i : Moving)
     {
         auto* ent = Entities[i];
         if (ent == nullptr)
@@ -112,6 +129,7 @@ void EntityTweener::Reset()
     Entities.clear();
     PrePos.clear();
     PostPos.clear();
+    Moving.clear();
 }
 
 static EntityTweener tweener;
@@ -10,7 +10,9 @@
 #pragma once
 
 #include "EntityBase.h"
+#include "EntityRegistry.h"
 
+#include <array>
 #include <vector>
 
 class EntityTweener
@@ -18,9 +20,14 @@ class EntityTweener
     std::vector<EntityBase*> Entities;
     std::vector<CoordsXYZ> PrePos;
     std::vector<CoordsXYZ> PostPos;
+    // Indices into Entities of the entities that moved during the tick, only those need to be tweened and restored.
+    std::vector<uint32_t> Moving;
+    // Index into Entities by entity slot, only valid if the entity at that index matches.
+    std::array<uint32_t, MAX_ENTITIES> SlotIndex{};
 
 private:
     void PopulateEntities();
+    void AddEntity(EntityBase* entity);
 
 public:
     static EntityTweener& Get();
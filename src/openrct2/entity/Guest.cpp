@@ -16,9 +16,11 @@
 #include "../config/Config.h"
 #include "../core/DataSerialiser.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../core/Numerics.hpp"
 #include "../entity/Balloon.h"
 #include "../entity/EntityRegistry.h"
+#include "../entity/Litter.h"
 #include "../entity/MoneyEffect.h"
 #include "../entity/Particle.h"
 #include "../interface/Window_internal.h"
@@ -434,6 +436,7 @@ static bool peep_should_go_on_ride_again(Guest* peep, Ride* ride);
 static bool peep_should_preferred_intensity_increase(Guest* peep);
 static bool peep_really_liked_ride(Guest* peep, Ride* ride);
 static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre_y, int16_t centre_z);
+static PeepThoughtType GetSurroundingsThought(const Guest& guest);
 static void peep_update_hunger(Guest* peep);
 static void peep_decide_whether_to_leave_park(Guest* peep);
 static void peep_leave_park(Guest* peep);
@@ -821,71 +824,34 @@ void Guest::loc_68FA89()
         }
     }
 
-    uint8_t newEnergy = Energy;
-    uint8_t newTargetEnergy = EnergyTarget;
-    if (newEnergy >= newTargetEnergy)
-    {
-        newEnergy -= 2;
-        if (newEnergy < newTargetEnergy)
-            newEnergy = newTargetEnergy;
-    }
-    else
-    {
-        newEnergy = std::min(PEEP_MAX_ENERGY_TARGET, newEnergy + 4);
-        if (newEnergy > newTargetEnergy)
-            newEnergy = newTargetEnergy;
-    }
+    UpdateStatsTowardsTargets();
+}
 
-    if (newEnergy < PEEP_MIN_ENERGY)
-        newEnergy = PEEP_MIN_ENERGY;
+/**
+ * Moves value towards target, by at most fall when it is above the target and by at most rise when below.
+ */
+static uint8_t peep_stat_towards_target(uint8_t value, uint8_t target, uint8_t fall, uint8_t rise)
+{
+    const auto lowered = std::max<int32_t>(value - fall, target);
+    const auto raised = std::min<int32_t>(value + rise, target);
+    return static_cast<uint8_t>(value >= target ? lowered : raised);
+}
 
-    /* Previous code here suggested maximum energy is 128. */
-    newEnergy = std::min(static_cast<uint8_t>(PEEP_MAX_ENERGY), newEnergy);
+/**
+ * Lets energy, happiness and nausea follow their targets. Only reads and writes the guest's own stats and leaves
+ * thoughts and movement alone.
+ */
+void Guest::UpdateStatsTowardsTargets()
+{
+    uint8_t newEnergy = peep_stat_towards_target(Energy, EnergyTarget, 2, 4);
+    newEnergy = std::clamp<uint8_t>(newEnergy, PEEP_MIN_ENERGY, PEEP_MAX_ENERGY);
+    const uint8_t newHappiness = peep_stat_towards_target(Happiness, HappinessTarget, 4, 4);
+    const uint8_t newNausea = peep_stat_towards_target(Nausea, NauseaTarget, 4, 4);
 
-    if (newEnergy != Energy)
+    if (newEnergy != Energy || newHappiness != Happiness || newNausea != Nausea)
     {
         Energy = newEnergy;
-        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
-    }
-
-    uint8_t newHappiness = Happiness;
-    uint8_t newHappinessGrowth = HappinessTarget;
-    if (newHappiness >= newHappinessGrowth)
-    {
-        newHappiness = std::max(newHappiness - 4, 0);
-        if (newHappiness < newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-    else
-    {
-        newHappiness = std::min(255, newHappiness + 4);
-        if (newHappiness > newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-
-    if (newHappiness != Happiness)
-    {
         Happiness = newHappiness;
-        WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
-    }
-
-    uint8_t newNausea = Nausea;
-    uint8_t newNauseaGrowth = NauseaTarget;
-    if (newNausea >= newNauseaGrowth)
-    {
-        newNausea = std::max(newNausea - 4, 0);
-        if (newNausea < newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-    else
-    {
-        newNausea = std::min(255, newNausea + 4);
-        if (newNausea > newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-
-    if (newNausea != Nausea)
-    {
         Nausea = newNausea;
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
@@ -959,7 +925,7 @@ void Guest::Tick128UpdateGuest(int32_t index)
                 SurroundingsThoughtTimeout = 0;
                 if (x != LOCATION_NULL)
                 {
-                    PeepThoughtType thought_type = peep_assess_surroundings(x & 0xFFE0, y & 0xFFE0, z);
+                    PeepThoughtType thought_type = GetSurroundingsThought(*this);
 
                     if (thought_type != PeepThoughtType::None)
                     {
@@ -1885,7 +1851,7 @@ BitSet<OpenRCT2::Limits::MaxRidesInPark> Guest::FindRidesToGoOn()
             for (int32_t tileY = cy - radius; tileY <= cy + radius; tileY += COORDS_XY_STEP)
             {
                 auto location = CoordsXY{ tileX, tileY };
-                if (!map_is_location_valid(location))
+                if (!map_is_location_valid(location) || !map_tile_may_have_track(location))
                     continue;
 
                 for (auto* trackElement : TileElementsView<TrackElement>(location))
@@ -2981,15 +2947,14 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
         }
     }
 
-    for (auto litter : EntityList<Litter>())
-    {
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
+    Litter::ForEachNear({ centre_x, centre_y }, 160, [&](const Litter& litter) {
+        int16_t dist_x = abs(litter.x - centre_x);
+        int16_t dist_y = abs(litter.y - centre_y);
         if (std::max(dist_x, dist_y) <= 160)
         {
             num_rubbish++;
         }
-    }
+    });
 
     if (num_fountains >= 5 && num_rubbish < 20)
         return PeepThoughtType::Fountains;
@@ -3007,6 +2972,94 @@ static PeepThoughtType peep_assess_surroundings(int16_t centre_x, int16_t centre
     return PeepThoughtType::None;
 }
 
+struct SurroundingsDecision
+{
+    EntityId Id;
+    CoordsXYZ Centre;
+    PeepThoughtType Thought;
+};
+
+// Changes further away than this from the centre can not affect peep_assess_surroundings, with a tile of slack.
+static constexpr int32_t SurroundingsChangeRange = 160 + COORDS_XY_STEP;
+
+// Surroundings assessed ahead of the guest loop, in ascending guest id order.
+static std::vector<SurroundingsDecision> _surroundingsDecisions;
+// Litter and vandalism changes made during the guest loop that may make an assessment stale.
+static std::vector<CoordsXY> _surroundingsChanges;
+static bool _surroundingsDecisionsActive;
+
+static CoordsXYZ GetSurroundingsCentre(const Guest& guest)
+{
+    return { guest.x & 0xFFE0, guest.y & 0xFFE0, guest.z };
+}
+
+/**
+ * Assesses the surroundings of the guests that are due to do so this tick on the worker threads. The assessment only
+ * reads the map, rides and litter, so it can run ahead of the serial guest loop. Guests that were not predicted or
+ * whose result may have been changed by an earlier guest in the loop assess their surroundings serially as before.
+ */
+void guest_surroundings_prepare()
+{
+    _surroundingsDecisions.clear();
+    _surroundingsChanges.clear();
+
+    // Same conditions as Tick128UpdateGuest, the index is the position in the guest loop of peep_update_all.
+    uint32_t index = 0;
+    for (auto* guest : EntityList<Guest>())
+    {
+        if ((index & 0x1FF) == (gCurrentTicks & 0x1FF) && guest->x != LOCATION_NULL
+            && (guest->State == PeepState::Walking || guest->State == PeepState::Sitting)
+            && guest->SurroundingsThoughtTimeout + 1 >= 18)
+        {
+            _surroundingsDecisions.push_back({ guest->sprite_index, GetSurroundingsCentre(*guest), PeepThoughtType::None });
+        }
+        index++;
+    }
+
+    JobPool::ParallelFor(0, _surroundingsDecisions.size(), 1, [](size_t i) {
+        auto& decision = _surroundingsDecisions[i];
+        decision.Thought = peep_assess_surroundings(decision.Centre.x, decision.Centre.y, decision.Centre.z);
+    });
+    _surroundingsDecisionsActive = true;
+}
+
+void guest_surroundings_clear()
+{
+    _surroundingsDecisionsActive = false;
+    _surroundingsDecisions.clear();
+    _surroundingsChanges.clear();
+}
+
+void guest_surroundings_invalidate(const CoordsXY& loc)
+{
+    if (_surroundingsDecisionsActive)
+    {
+        _surroundingsChanges.push_back(loc);
+    }
+}
+
+static PeepThoughtType GetSurroundingsThought(const Guest& guest)
+{
+    const auto centre = GetSurroundingsCentre(guest);
+    if (_surroundingsDecisionsActive)
+    {
+        auto it = std::lower_bound(
+            _surroundingsDecisions.begin(), _surroundingsDecisions.end(), guest.sprite_index,
+            [](const SurroundingsDecision& decision, EntityId id) { return decision.Id.ToUnderlying() < id.ToUnderlying(); });
+        if (it != _surroundingsDecisions.end() && it->Id == guest.sprite_index && it->Centre == centre)
+        {
+            bool isStale = std::any_of(_surroundingsChanges.begin(), _surroundingsChanges.end(), [&centre](const CoordsXY& loc) {
+                return std::max(abs(loc.x - centre.x), abs(loc.y - centre.y)) <= SurroundingsChangeRange;
+            });
+            if (!isStale)
+            {
+                return it->Thought;
+            }
+        }
+    }
+    return peep_assess_surroundings(centre.x, centre.y, centre.z);
+}
+
 /**
  *
  *  rct2: 0x0068F9A9
@@ -3147,7 +3200,7 @@ template<typename T> static void peep_head_for_nearest_ride(Guest* peep, bool co
             for (auto y = cy - searchRadius; y <= cy + searchRadius; y += COORDS_XY_STEP)
             {
                 auto location = CoordsXY{ x, y };
-                if (!map_is_location_valid(location))
+                if (!map_is_location_valid(location) || !map_tile_may_have_track(location))
                     continue;
 
                 for (auto* trackElement : TileElementsView<TrackElement>(location))
@@ -6152,6 +6205,7 @@ static void peep_update_walking_break_scenery(Guest* peep)
     }
 
     tileElement->SetIsBroken(true);
+    guest_surroundings_invalidate(peep->NextLoc);
 
     map_invalidate_tile_zoom1({ peep->NextLoc, tileElement->GetBaseZ(), tileElement->GetBaseZ() + 32 });
 
@@ -7345,34 +7399,7 @@ void Guest::RemoveFromQueue()
     if (ride == nullptr)
         return;
 
-    auto& station = ride->GetStation(CurrentRideStation);
-    // Make sure we don't underflow, building while paused might reset it to 0 where peeps have
-    // not yet left the queue.
-    if (station.QueueLength > 0)
-    {
-        station.QueueLength--;
-    }
-
-    if (sprite_index == station.LastPeepInQueue)
-    {
-        station.LastPeepInQueue = GuestNextInQueue;
-        return;
-    }
-
-    auto* otherGuest = GetEntity<Guest>(station.LastPeepInQueue);
-    if (otherGuest == nullptr)
-    {
-        log_error("Invalid Guest Queue list!");
-        return;
-    }
-    for (; otherGuest != nullptr; otherGuest = GetEntity<Guest>(otherGuest->GuestNextInQueue))
-    {
-        if (sprite_index == otherGuest->GuestNextInQueue)
-        {
-            otherGuest->GuestNextInQueue = GuestNextInQueue;
-            return;
-        }
-    }
+    ride->QueueRemoveGuest(CurrentRideStation, this);
 }
 
 uint64_t Guest::GetItemFlags() const
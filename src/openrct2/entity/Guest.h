@@ -262,7 +262,10 @@ struct Guest : Peep
 
 public:
     uint8_t GuestNumRides;
+    // The guest ahead in the queue.
     EntityId GuestNextInQueue;
+    // The guest behind in the queue. Not saved, rebuilt from GuestNextInQueue when a park is loaded.
+    EntityId GuestPrevInQueue;
     int32_t ParkEntryTime;
     RideId GuestHeadingToRideId;
     uint8_t GuestIsLostCountdown;
@@ -378,6 +381,9 @@ public:
     // the history, thoughts, etc.
     void RemoveRideFromMemory(RideId rideId);
 
+    // Rides the guest would consider going on, public for the benchmarks.
+    OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> FindRidesToGoOn();
+
 private:
     void UpdateRide();
     void UpdateOnRide(){}; // TODO
@@ -413,6 +419,7 @@ private:
     void UpdateRidePrepareForExit();
     void loc_68F9F3();
     void loc_68FA89();
+    void UpdateStatsTowardsTargets();
     int32_t CheckEasterEggName(int32_t index) const;
     bool GuestHasValidXY() const;
     void GivePassingPeepsPurpleClothes(Guest* passingPeep);
@@ -420,7 +427,6 @@ private:
     void MakePassingPeepsSick(Guest* passingPeep);
     void GivePassingPeepsIceCream(Guest* passingPeep);
     Ride* FindBestRideToGoOn();
-    OpenRCT2::BitSet<OpenRCT2::Limits::MaxRidesInPark> FindRidesToGoOn();
     bool FindVehicleToEnter(Ride* ride, std::vector<uint8_t>& car_array);
     void GoToRideEntrance(Ride* ride);
 };
@@ -469,6 +475,10 @@ extern uint32_t gNextGuestNumber;
 
 void guest_set_name(EntityId spriteIndex, const char* name);
 
+void guest_surroundings_prepare();
+void guest_surroundings_clear();
+void guest_surroundings_invalidate(const CoordsXY& loc);
+
 void peep_thought_set_format_args(const PeepThought* thought, Formatter& ft);
 
 void increment_guests_in_park();
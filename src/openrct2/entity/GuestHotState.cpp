@@ -0,0 +1,106 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "GuestHotState.h"
+
+#include "../Game.h"
+#include "EntityList.h"
+#include "Guest.h"
+
+#include <algorithm>
+
+GuestHotState& GuestHotState::Get()
+{
+    static GuestHotState instance;
+    return instance;
+}
+
+void GuestHotState::Sync(const Guest& guest)
+{
+    const auto index = guest.sprite_index.ToUnderlying();
+    X[index] = guest.x;
+    Y[index] = guest.y;
+    Z[index] = guest.z;
+    State[index] = guest.State;
+    Energy[index] = guest.Energy;
+    Happiness[index] = guest.Happiness;
+    Nausea[index] = guest.Nausea;
+    Hunger[index] = guest.Hunger;
+    Thirst[index] = guest.Thirst;
+    Toilet[index] = guest.Toilet;
+
+    uint8_t flags = Valid;
+    if (guest.OutsideOfPark)
+    {
+        flags |= OutsideOfPark;
+    }
+    if ((guest.PeepFlags & PEEP_FLAGS_LEAVING_PARK) && guest.GuestIsLostCountdown < 90)
+    {
+        flags |= Lost;
+    }
+    GuestFlags[index] = flags;
+
+    _end = std::max<size_t>(_end, index + 1);
+}
+
+void GuestHotState::Remove(EntityId id)
+{
+    const auto index = id.ToUnderlying();
+    if (index < _end)
+    {
+        GuestFlags[index] = 0;
+    }
+}
+
+void GuestHotState::Reset()
+{
+    std::fill_n(GuestFlags.begin(), _end, 0);
+    _end = 0;
+    _synced = false;
+}
+
+void GuestHotState::Invalidate()
+{
+    _synced = false;
+}
+
+void GuestHotState::MarkSynced()
+{
+    _synced = true;
+    _syncedTick = gCurrentTicks;
+}
+
+void GuestHotState::EnsureSynced()
+{
+    if (_synced && _syncedTick == gCurrentTicks)
+    {
+        return;
+    }
+
+    Reset();
+    for (auto* guest : EntityList<Guest>())
+    {
+        Sync(*guest);
+    }
+    MarkSynced();
+}
+
+GuestHotState::ParkRatingCounts GuestHotState::CountForParkRating(uint8_t happyThreshold) const
+{
+    // Branch free so the compiler can vectorise the sweep.
+    uint32_t happy = 0;
+    uint32_t lost = 0;
+    for (size_t i = 0; i < _end; i++)
+    {
+        const uint32_t inPark = (GuestFlags[i] & (Valid | OutsideOfPark)) == Valid;
+        happy += inPark & (Happiness[i] > happyThreshold);
+        lost += inPark & ((GuestFlags[i] & Lost) != 0);
+    }
+    return { happy, lost };
+}
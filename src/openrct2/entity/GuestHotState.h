@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "EntityRegistry.h"
+
+#include <array>
+#include <cstdint>
+
+struct Guest;
+enum class PeepState : uint8_t;
+
+/**
+ * Copies of the frequently read guest fields in structure-of-arrays form, indexed by entity slot. The guest entities
+ * stay authoritative, each slot is refreshed when its guest finishes its update in peep_update_all. Passes that run
+ * later in the same tick can sweep these arrays linearly instead of visiting every guest entity.
+ */
+class GuestHotState
+{
+public:
+    enum Flags : uint8_t
+    {
+        Valid = 1 << 0,
+        OutsideOfPark = 1 << 1,
+        // Leaving the park but unable to find the exit, as counted by the park rating.
+        Lost = 1 << 2,
+    };
+
+    std::array<int32_t, MAX_ENTITIES> X;
+    std::array<int32_t, MAX_ENTITIES> Y;
+    std::array<int32_t, MAX_ENTITIES> Z;
+    std::array<PeepState, MAX_ENTITIES> State;
+    std::array<uint8_t, MAX_ENTITIES> Energy;
+    std::array<uint8_t, MAX_ENTITIES> Happiness;
+    std::array<uint8_t, MAX_ENTITIES> Nausea;
+    std::array<uint8_t, MAX_ENTITIES> Hunger;
+    std::array<uint8_t, MAX_ENTITIES> Thirst;
+    std::array<uint8_t, MAX_ENTITIES> Toilet;
+    std::array<uint8_t, MAX_ENTITIES> GuestFlags;
+
+private:
+    // One past the highest slot that has ever been valid since the last reset, bounds the sweeps.
+    size_t _end{};
+    uint32_t _syncedTick{};
+    bool _synced{};
+
+public:
+    static GuestHotState& Get();
+
+    void Sync(const Guest& guest);
+    void Remove(EntityId id);
+    void Reset();
+    // Called when guests are added outside of peep_update_all.
+    void Invalidate();
+
+    /**
+     * Rebuilds every slot from the guest entities unless all guests have been synced during the current tick.
+     */
+    void EnsureSynced();
+    void MarkSynced();
+
+    size_t GetEnd() const
+    {
+        return _end;
+    }
+
+    struct ParkRatingCounts
+    {
+        uint32_t Happy;
+        uint32_t Lost;
+    };
+    ParkRatingCounts CountForParkRating(uint8_t happyThreshold) const;
+};
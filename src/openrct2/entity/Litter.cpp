@@ -10,12 +10,53 @@
 #include "../world/Map.h"
 #include "EntityList.h"
 #include "EntityRegistry.h"
+#include "Guest.h"
 
 template<> bool EntityBase::Is<Litter>() const
 {
     return Type == EntityType::Litter;
 }
 
+// The litter that is removed to make room once the limit is reached, valid while the litter list generation matches.
+// Litter is only created at the current tick, so new litter can update it without searching all of it again.
+static EntityId _newestLitter = EntityId::GetNull();
+static uint32_t _newestLitterGeneration;
+static bool _newestLitterValid;
+
+static bool IsNewerLitter(const Litter& litter, const Litter& other)
+{
+    // The search visited litter by index and took the last one with the highest tick.
+    if (litter.creationTick != other.creationTick)
+    {
+        return litter.creationTick > other.creationTick;
+    }
+    return litter.sprite_index.ToUnderlying() > other.sprite_index.ToUnderlying();
+}
+
+static Litter* FindNewestLitter()
+{
+    if (_newestLitterValid && _newestLitterGeneration == GetEntityListGeneration(EntityType::Litter))
+    {
+        return GetEntity<Litter>(_newestLitter);
+    }
+
+    Litter* newestLitter = nullptr;
+    uint32_t newestLitterCreationTick = 0;
+    for (auto litter : EntityList<Litter>())
+    {
+        if (newestLitterCreationTick <= litter->creationTick)
+        {
+            newestLitterCreationTick = litter->creationTick;
+            newestLitter = litter;
+        }
+    }
+
+    _newestLitter = newestLitter != nullptr ? newestLitter->sprite_index : EntityId::GetNull();
+    _newestLitterGeneration = GetEntityListGeneration(EntityType::Litter);
+    _newestLitterValid = true;
+    return newestLitter;
+}
+
 static bool isLocationLitterable(const CoordsXYZ& mapPos)
 {
     TileElement* tileElement;
@@ -56,21 +97,19 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
     if (!isLocationLitterable(offsetLitterPos))
         return;
 
+    // Whether the newest litter will still be known once the new litter has been added.
+    bool newestLitterKnown = _newestLitterValid && _newestLitterGeneration == GetEntityListGeneration(EntityType::Litter);
+    Litter* previousNewestLitter = newestLitterKnown ? GetEntity<Litter>(_newestLitter) : nullptr;
+
     if (GetEntityListCount(EntityType::Litter) >= 500)
     {
-        Litter* newestLitter = nullptr;
-        uint32_t newestLitterCreationTick = 0;
-        for (auto litter : EntityList<Litter>())
-        {
-            if (newestLitterCreationTick <= litter->creationTick)
-            {
-                newestLitterCreationTick = litter->creationTick;
-                newestLitter = litter;
-            }
-        }
-
+        auto* newestLitter = FindNewestLitter();
         if (newestLitter != nullptr)
         {
+            // The remaining litter is no newer than this one, so litter from a later tick is the newest.
+            newestLitterKnown = newestLitter->creationTick < gCurrentTicks;
+            previousNewestLitter = nullptr;
+
             newestLitter->Invalidate();
             EntityRemove(newestLitter);
         }
@@ -87,6 +126,21 @@ void Litter::Create(const CoordsXYZD& litterPos, Type type)
     litter->SubType = type;
     litter->MoveTo(offsetLitterPos);
     litter->creationTick = gCurrentTicks;
+    guest_surroundings_invalidate({ litter->x, litter->y });
+
+    if (newestLitterKnown)
+    {
+        if (previousNewestLitter == nullptr || IsNewerLitter(*litter, *previousNewestLitter))
+        {
+            _newestLitter = litter->sprite_index;
+        }
+        _newestLitterGeneration = GetEntityListGeneration(EntityType::Litter);
+        _newestLitterValid = true;
+    }
+    else
+    {
+        _newestLitterValid = false;
+    }
 }
 
 /**
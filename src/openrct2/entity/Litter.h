@@ -9,7 +9,11 @@
 
 #pragma once
 
+#include "../world/Map.h"
 #include "EntityBase.h"
+#include "EntityList.h"
+
+#include <algorithm>
 
 class DataSerialiser;
 struct CoordsXYZ;
@@ -43,4 +47,29 @@ struct Litter : EntityBase
     rct_string_id GetName() const;
     uint32_t GetAge() const;
     void Paint(paint_session& session, int32_t imageDirection) const;
+
+    /**
+     * Calls fn with every litter in the buckets that overlap the square of the given radius around centre. This
+     * includes litter that is further away, callers still have to check the distance.
+     */
+    template<typename TFn> static void ForEachNear(const CoordsXY& centre, int32_t radius, TFn&& fn)
+    {
+        const auto bucketStart = [](int32_t coord) { return std::max(coord, 0) / LITTER_BUCKET_SIZE * LITTER_BUCKET_SIZE; };
+        const auto endX = std::min(centre.x + radius, MAXIMUM_MAP_SIZE_BIG - 1);
+        const auto endY = std::min(centre.y + radius, MAXIMUM_MAP_SIZE_BIG - 1);
+        for (auto bucketX = bucketStart(centre.x - radius); bucketX <= endX; bucketX += LITTER_BUCKET_SIZE)
+        {
+            for (auto bucketY = bucketStart(centre.y - radius); bucketY <= endY; bucketY += LITTER_BUCKET_SIZE)
+            {
+                for (auto id : GetLitterBucketList({ bucketX, bucketY }))
+                {
+                    auto* litter = GetEntity<Litter>(id);
+                    if (litter != nullptr)
+                    {
+                        fn(*litter);
+                    }
+                }
+            }
+        }
+    }
 };
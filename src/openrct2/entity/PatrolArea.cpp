@@ -9,10 +9,11 @@
 
 #include "PatrolArea.h"
 
-#include "../core/Algorithm.hpp"
 #include "EntityList.h"
 #include "Staff.h"
 
+#include <algorithm>
+
 static PatrolArea _consolidatedPatrolArea[EnumValue(StaffType::Count)];
 static std::variant<StaffType, EntityId> _patrolAreaToRender;
 
@@ -48,18 +49,19 @@ void PatrolArea::Clear()
     for (auto& area : Areas)
     {
         area.SortedTiles.clear();
+        area.Bits.clear();
     }
+    TileCount = 0;
 }
 
 bool PatrolArea::Get(const TileCoordsXY& pos) const
 {
     auto* area = GetCell(pos);
-    if (area == nullptr)
+    if (area == nullptr || area->Bits.empty())
         return false;
 
-    auto it = binary_find(area->SortedTiles.begin(), area->SortedTiles.end(), pos, CompareTileCoordsXY);
-    auto found = it != area->SortedTiles.end();
-    return found;
+    auto index = Cell::GetBitIndex(pos);
+    return (area->Bits[index / 64] >> (index % 64)) & 1;
 }
 
 bool PatrolArea::Get(const CoordsXY& pos) const
@@ -76,14 +78,21 @@ void PatrolArea::Set(const TileCoordsXY& pos, bool value)
     auto it = std::lower_bound(area->SortedTiles.begin(), area->SortedTiles.end(), pos, CompareTileCoordsXY);
     auto found = it != area->SortedTiles.end() && *it == pos;
 
+    auto index = Cell::GetBitIndex(pos);
     if (!found && value)
     {
         area->SortedTiles.insert(it, pos);
+        area->Bits.resize(Cell::NumTiles / 64);
+        area->Bits[index / 64] |= uint64_t{ 1 } << (index % 64);
         TileCount++;
     }
     else if (found && !value)
     {
         area->SortedTiles.erase(it);
+        if (area->SortedTiles.empty())
+            area->Bits.clear();
+        else
+            area->Bits[index / 64] &= ~(uint64_t{ 1 } << (index % 64));
         assert(TileCount != 0);
         TileCount--;
     }
@@ -12,7 +12,9 @@
 #include "../world/Map.h"
 #include "Peep.h"
 
+#include <cstdint>
 #include <variant>
+#include <vector>
 
 // The number of elements in the gStaffPatrolAreas array per staff member. Every bit in the array represents a 4x4 square.
 // Right now, it's a 32-bit array like in RCT2. 32 * 128 = 4096 bits, which is also the number of 4x4 squares on a 256x256 map.
@@ -29,6 +31,13 @@ private:
         static constexpr auto NumTiles = Width * Height;
 
         std::vector<TileCoordsXY> SortedTiles;
+        // One bit per tile of the cell for constant time lookups, only allocated while the cell has tiles.
+        std::vector<uint64_t> Bits;
+
+        static size_t GetBitIndex(const TileCoordsXY& pos)
+        {
+            return (pos.y % Height) * Width + (pos.x % Width);
+        }
     };
 
     static constexpr auto CellColumns = (MAXIMUM_MAP_SIZE_TECHNICAL + (Cell::Width - 1)) / Cell::Width;
@@ -21,8 +21,11 @@
 #include "../core/Guard.hpp"
 #include "../drawing/LightFX.h"
 #include "../entity/Balloon.h"
+#include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
+#include "../entity/GuestHotState.h"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Formatter.h"
 #include "../localisation/Localisation.h"
@@ -204,6 +207,9 @@ void peep_update_all()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    guest_surroundings_prepare();
+
+    auto& hotState = GuestHotState::Get();
     int32_t i = 0;
     // Warning this loop can delete peeps
     for (auto peep : EntityList<Guest>())
@@ -221,9 +227,15 @@ void peep_update_all()
                 peep->Update();
             }
         }
+        if (peep->Type == EntityType::Guest)
+        {
+            hotState.Sync(*peep);
+        }
 
         i++;
     }
+    hotState.MarkSynced();
+    guest_surroundings_clear();
 
     for (auto staff : EntityList<Staff>())
     {
@@ -445,28 +457,27 @@ std::optional<CoordsXY> Peep::UpdateAction(int16_t& xy_distance)
         CoordsXY loc = { x, y };
         loc += word_981D7C[nextDirection / 8];
         WalkingFrameNum++;
-        const rct_peep_animation* peepAnimation = &GetPeepAnimation(SpriteType);
-        const uint8_t* imageOffset = peepAnimation[EnumValue(ActionSpriteType)].frame_offsets;
-        if (WalkingFrameNum >= peepAnimation[EnumValue(ActionSpriteType)].num_frames)
+        const auto& peepAnimation = GetPackedPeepAnimation(SpriteType, ActionSpriteType);
+        if (WalkingFrameNum >= peepAnimation.NumFrames)
         {
             WalkingFrameNum = 0;
         }
-        ActionSpriteImageOffset = imageOffset[WalkingFrameNum];
+        ActionSpriteImageOffset = GetPeepAnimationFrame(peepAnimation, WalkingFrameNum);
         return loc;
     }
 
-    const rct_peep_animation* peepAnimation = &GetPeepAnimation(SpriteType);
+    const auto& peepAnimation = GetPackedPeepAnimation(SpriteType, ActionSpriteType);
     ActionFrame++;
 
     // If last frame of action
-    if (ActionFrame >= peepAnimation[EnumValue(ActionSpriteType)].num_frames)
+    if (ActionFrame >= peepAnimation.NumFrames)
     {
         ActionSpriteImageOffset = 0;
         Action = PeepActionType::Walking;
         UpdateCurrentActionSpriteType();
         return { { x, y } };
     }
-    ActionSpriteImageOffset = peepAnimation[EnumValue(ActionSpriteType)].frame_offsets[ActionFrame];
+    ActionSpriteImageOffset = GetPeepAnimationFrame(peepAnimation, ActionFrame);
 
     auto* guest = As<Guest>();
     // If not throwing up and not at the frame where sick appears.
@@ -1227,13 +1238,13 @@ void peep_update_crowd_noise()
     if (viewport == nullptr)
         return;
 
-    // Count the number of peeps visible
+    // Count the number of peeps visible, only looking at the guests around the viewport
     auto visiblePeeps = 0;
 
-    for (auto peep : EntityList<Guest>())
+    const auto viewRect = ScreenRect(
+        viewport->viewPos, viewport->viewPos + ScreenCoordsXY{ viewport->view_width, viewport->view_height });
+    for (auto peep : EntityRangeQuery<Guest>(viewport_rect_to_entity_map_range(viewRect)))
     {
-        if (peep->x == LOCATION_NULL)
-            continue;
         if (viewport->viewPos.x > peep->SpriteRect.GetRight())
             continue;
         if (viewport->viewPos.x + viewport->view_width < peep->SpriteRect.GetLeft())
@@ -1742,11 +1753,7 @@ static bool peep_interact_with_entrance(Peep* peep, const CoordsXYE& coords, uin
         guest->ActionSpriteImageOffset = _unk_F1AEF0;
         guest->InteractionRideIndex = rideIndex;
 
-        auto& station = ride->GetStation(stationNum);
-        auto previous_last = station.LastPeepInQueue;
-        station.LastPeepInQueue = guest->sprite_index;
-        guest->GuestNextInQueue = previous_last;
-        station.QueueLength++;
+        ride->QueueAddGuest(stationNum, guest);
 
         guest->CurrentRide = rideIndex;
         guest->CurrentRideStation = stationNum;
@@ -1942,7 +1949,6 @@ static bool peep_interact_with_entrance(Peep* peep, const CoordsXYE& coords, uin
         }
 
         gTotalAdmissions++;
-        window_invalidate_by_number(WC_PARK_INFORMATION, 0);
 
         guest->Var37 = 1;
         auto destination = guest->GetDestination();
@@ -2168,11 +2174,7 @@ static void peep_interact_with_path(Peep* peep, const CoordsXYE& coords)
                     guest->InteractionRideIndex = rideIndex;
 
                     // Add the peep to the ride queue.
-                    auto& station = ride->GetStation(stationNum);
-                    auto old_last_peep = station.LastPeepInQueue;
-                    station.LastPeepInQueue = guest->sprite_index;
-                    guest->GuestNextInQueue = old_last_peep;
-                    station.QueueLength++;
+                    ride->QueueAddGuest(stationNum, guest);
 
                     peep_decrement_num_riders(guest);
                     guest->CurrentRide = rideIndex;
@@ -2782,7 +2784,8 @@ void Peep::Paint(paint_session& session, int32_t imageDirection) const
 
     // In the following 4 calls to PaintAddImageAsParent/PaintAddImageAsChild, we add 5 (instead of 3) to the
     //  bound_box_offset_z to make sure peeps are drawn on top of railways
-    uint32_t baseImageId = (imageDirection >> 3) + GetPeepAnimation(SpriteType, actionSpriteType).base_image + imageOffset * 4;
+    const auto& peepAnimation = GetPackedPeepAnimation(SpriteType, actionSpriteType);
+    uint32_t baseImageId = (imageDirection >> 3) + peepAnimation.BaseImage + imageOffset * 4;
     uint32_t imageId = baseImageId | TshirtColour << 19 | TrousersColour << 24 | IMAGE_TYPE_REMAP | IMAGE_TYPE_REMAP_2_PLUS;
     PaintAddImageAsParent(session, imageId, { 0, 0, z }, { 1, 1, 11 }, { 0, 0, z + 5 });
 
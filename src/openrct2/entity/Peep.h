@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <array>
 #include <optional>
+#include <vector>
 
 #define PEEP_MIN_ENERGY 32
 #define PEEP_MAX_ENERGY 128
@@ -454,6 +455,29 @@ enum
 
 // rct2: 0x00982708
 extern const rct_peep_animation_entry g_peep_animation_entries[EnumValue(PeepSpriteType::Count)];
+
+constexpr size_t PeepActionSpriteTypeCount = EnumValue(PeepActionSpriteType::WithdrawMoney) + 1;
+
+/**
+ * g_peep_animation_entries packed for the animation updates and painting of every peep. Each animation is 12 bytes
+ * including its bounds, all animations are in one array and identical frame sequences are only stored once.
+ */
+struct PeepAnimationTable
+{
+    struct Animation
+    {
+        uint32_t BaseImage;
+        uint16_t FirstFrame;
+        uint16_t NumFrames;
+        rct_sprite_bounds Bounds;
+    };
+
+    std::array<Animation, EnumValue(PeepSpriteType::Count) * PeepActionSpriteTypeCount> Animations;
+    std::vector<uint8_t> Frames;
+
+    static PeepAnimationTable Build();
+};
+extern const PeepAnimationTable gPeepAnimationTable;
 extern const bool gSpriteTypeToSlowWalkMap[48];
 
 extern uint8_t gPeepWarningThrottle[16];
@@ -485,8 +509,19 @@ inline const rct_peep_animation& GetPeepAnimation(
     return g_peep_animation_entries[EnumValue(spriteType)].sprite_animation[EnumValue(actionSpriteType)];
 };
 
+inline const PeepAnimationTable::Animation& GetPackedPeepAnimation(
+    PeepSpriteType spriteType, PeepActionSpriteType actionSpriteType = PeepActionSpriteType::None)
+{
+    return gPeepAnimationTable.Animations[EnumValue(spriteType) * PeepActionSpriteTypeCount + EnumValue(actionSpriteType)];
+}
+
+inline uint8_t GetPeepAnimationFrame(const PeepAnimationTable::Animation& animation, size_t frame)
+{
+    return gPeepAnimationTable.Frames[animation.FirstFrame + frame];
+}
+
 inline const rct_sprite_bounds& GetSpriteBounds(
     PeepSpriteType spriteType, PeepActionSpriteType actionSpriteType = PeepActionSpriteType::None)
 {
-    return g_peep_animation_entries[EnumValue(spriteType)].sprite_bounds[EnumValue(actionSpriteType)];
+    return GetPackedPeepAnimation(spriteType, actionSpriteType).Bounds;
 };
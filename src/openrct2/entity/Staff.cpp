@@ -40,11 +40,13 @@
 #include "../world/Scenery.h"
 #include "../world/SmallScenery.h"
 #include "../world/Surface.h"
+#include "Litter.h"
 #include "PatrolArea.h"
 #include "Peep.h"
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 // clang-format off
 const rct_string_id StaffCostumeNames[] = {
@@ -331,16 +333,31 @@ Direction Staff::HandymanDirectionToNearestLitter() const
 {
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
-    {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
+    auto considerLitter = [&](Litter& litter) {
+        uint16_t distance = abs(litter.x - x) + abs(litter.y - y) + abs(litter.z - z) * 4;
 
-        if (distance < nearestLitterDist)
+        // Ties go to the lowest id, as when visiting all litter in order.
+        if (distance < nearestLitterDist
+            || (distance == nearestLitterDist && nearestLitter != nullptr && litter.sprite_index < nearestLitter->sprite_index))
         {
             nearestLitterDist = distance;
-            nearestLitter = litter;
+            nearestLitter = &litter;
+        }
+    };
+
+    // The distance is truncated to 16 bits, on big enough maps far away litter can therefore appear to be close.
+    constexpr int32_t maxZDistance = 255 * COORDS_Z_STEP * 4;
+    if ((gMapSize.x + gMapSize.y) * COORDS_XY_STEP + maxZDistance > std::numeric_limits<uint16_t>::max())
+    {
+        for (auto litter : EntityList<Litter>())
+        {
+            considerLitter(*litter);
         }
     }
+    else
+    {
+        Litter::ForEachNear({ x, y }, MAX_LITTER_DISTANCE, considerLitter);
+    }
 
     if (nearestLitterDist > MAX_LITTER_DISTANCE)
     {
@@ -868,24 +885,13 @@ bool Staff::DoMiscPathFinding()
  */
 void Staff::EntertainerUpdateNearbyPeeps() const
 {
-    for (auto guest : EntityList<Guest>())
+    // Each guest is affected independently, so visiting them by chunk rather than in id order is fine.
+    for (auto guest : EntityRangeQuery<Guest>({ x, y }, 96))
     {
-        if (guest->x == LOCATION_NULL)
-            continue;
-
         int16_t z_dist = abs(z - guest->z);
         if (z_dist > 48)
             continue;
 
-        int16_t x_dist = abs(x - guest->x);
-        int16_t y_dist = abs(y - guest->y);
-
-        if (x_dist > 96)
-            continue;
-
-        if (y_dist > 96)
-            continue;
-
         if (guest->State == PeepState::Walking)
         {
             guest->HappinessTarget = std::min(guest->HappinessTarget + 4, PEEP_MAX_HAPPINESS);
@@ -1008,9 +1014,10 @@ bool staff_set_colour(StaffType staffType, colour_t value)
 uint32_t staff_get_available_entertainer_costumes()
 {
     uint32_t entertainerCostumes = 0;
+    const auto inventedGroups = scenery_get_invented_groups();
     for (int32_t i = 0; i < MAX_SCENERY_GROUP_OBJECTS; i++)
     {
-        if (scenery_group_is_invented(i))
+        if (inventedGroups[i])
         {
             const auto sgEntry = get_scenery_group_entry(i);
             entertainerCostumes |= sgEntry->entertainer_costumes;
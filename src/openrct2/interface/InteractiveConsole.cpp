@@ -31,6 +31,7 @@
 #include "../drawing/Drawing.h"
 #include "../drawing/Font.h"
 #include "../drawing/Image.h"
+#include "../drawing/X8DrawingEngine.h"
 #include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/Staff.h"
@@ -56,6 +57,7 @@
 #include "../world/Climate.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
+#include "../world/TileElementsView.h"
 #include "Viewport.h"
 
 #include <algorithm>
@@ -72,6 +74,12 @@
 #    include "../drawing/TTF.h"
 #endif
 
+#ifdef ENABLE_SCRIPTING
+#    include "../scripting/HookEngine.h"
+#    include "../scripting/Plugin.h"
+#    include "../scripting/ScriptEngine.h"
+#endif
+
 using arguments_t = std::vector<std::string>;
 
 static constexpr const char* ClimateNames[] = {
@@ -1375,16 +1383,9 @@ static int32_t cc_remove_floating_objects(InteractiveConsole& console, const arg
 
 static int32_t cc_remove_park_fences(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() == TileElementType::Surface)
-        {
-            // Remove all park fence flags
-            it.element->AsSurface()->SetParkFences(0);
-        }
-    } while (tile_element_iterator_next(&it));
+    // Remove all park fence flags
+    OpenRCT2::ForEachMapElement<SurfaceElement>(
+        [](const TileCoordsXY&, SurfaceElement& surfaceElement) { surfaceElement.SetParkFences(0); });
 
     gfx_invalidate_screen();
 
@@ -1414,6 +1415,26 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     return 0;
 }
 
+static int32_t cc_dirty_stats(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    auto* engine = dynamic_cast<OpenRCT2::Drawing::X8DrawingEngine*>(OpenRCT2::GetContext()->GetDrawingEngine());
+    if (engine == nullptr)
+    {
+        console.WriteLineError("Only the software drawing engines track dirty regions.");
+        return 1;
+    }
+
+    const auto& stats = engine->GetDirtyStats();
+    const auto* dpi = engine->GetDrawingPixelInfo();
+    const auto screenPixels = std::max<uint64_t>(static_cast<uint64_t>(dpi->width) * dpi->height, 1);
+    console.WriteFormatLine("Invalidations: %u", stats.Invalidations);
+    console.WriteFormatLine("Regions redrawn: %u", stats.Rects);
+    console.WriteFormatLine(
+        "Pixels redrawn: %llu (%.1f%% of the screen)", static_cast<unsigned long long>(stats.Pixels),
+        100.0 * stats.Pixels / screenPixels);
+    return 0;
+}
+
 static int32_t cc_for_date([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     int32_t year = 0;
@@ -1631,14 +1652,21 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
 
     if (argv.size() < 1)
     {
-        console.WriteFormatLine("Parameters required <replay_name>");
+        console.WriteFormatLine("Parameters required <replay_name> [<seek_ticks = 0>]");
         return 0;
     }
 
     std::string name = argv[0];
 
+    // Ticks into the replay to start playing at.
+    uint32_t seekTicks = 0;
+    if (argv.size() >= 2)
+    {
+        seekTicks = atol(argv[1].c_str());
+    }
+
     auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
-    if (replayManager->StartPlayback(name))
+    if (replayManager->StartPlayback(name, seekTicks))
     {
         OpenRCT2::ReplayRecordInfo info;
         replayManager->GetCurrentReplayInfo(info);
@@ -1652,10 +1680,13 @@ static int32_t cc_replay_start(InteractiveConsole& console, const arguments_t& a
                              "  Date Recorded: %s\n"
                              "  Ticks: %u\n"
                              "  Commands: %u\n"
-                             "  Checksums: %u";
+                             "  Checksums: %u\n"
+                             "  Keyframes: %u";
 
-        console.WriteFormatLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
-        Console::WriteLine(logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums);
+        console.WriteFormatLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums, info.NumKeyframes);
+        Console::WriteLine(
+            logFmt, info.FilePath.c_str(), recordingDate, info.Ticks, info.NumCommands, info.NumChecksums, info.NumKeyframes);
 
         return 1;
     }
@@ -1883,6 +1914,44 @@ static int32_t cc_profiler_exportcsv([[maybe_unused]] InteractiveConsole& consol
     return 0;
 }
 
+static int32_t cc_profiler_exporttrace([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return 1;
+    }
+
+    const auto& filePath = argv[0];
+    if (!OpenRCT2::Profiling::ExportChromeTrace(filePath))
+    {
+        console.WriteFormatLine("Unable to export trace to %s", filePath.c_str());
+        return 1;
+    }
+
+    console.WriteFormatLine("Wrote trace: \"%s\"", filePath.c_str());
+    return 0;
+}
+
+static int32_t cc_profiler_exportframes([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return 1;
+    }
+
+    const auto& filePath = argv[0];
+    if (!OpenRCT2::Profiling::ExportFrameLog(filePath))
+    {
+        console.WriteFormatLine("Unable to export frame log to %s", filePath.c_str());
+        return 1;
+    }
+
+    console.WriteFormatLine("Wrote frame log: \"%s\"", filePath.c_str());
+    return 0;
+}
+
 static int32_t cc_profiler_stop([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     if (OpenRCT2::Profiling::IsEnabled())
@@ -1898,6 +1967,43 @@ static int32_t cc_profiler_stop([[maybe_unused]] InteractiveConsole& console, [[
     return 0;
 }
 
+static int32_t cc_plugin_timings(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& plugins = OpenRCT2::GetContext()->GetScriptEngine().GetPlugins();
+    if (!argv.empty() && argv[0] == "reset")
+    {
+        for (const auto& plugin : plugins)
+        {
+            plugin->ResetHookTimings();
+        }
+        console.WriteLine("Reset plugin timings");
+        return 0;
+    }
+
+    using namespace OpenRCT2::Scripting;
+    console.WriteFormatLine("%-24s %-24s %10s %12s %10s %10s", "Plugin", "Hook", "Calls", "Total (ms)", "Max (ms)", "Over");
+    for (const auto& plugin : plugins)
+    {
+        for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
+        {
+            auto type = static_cast<HOOK_TYPE>(i);
+            const auto& timings = plugin->GetHookTimings(type);
+            if (timings.CallCount == 0)
+                continue;
+
+            console.WriteFormatLine(
+                "%-24s %-24s %10u %12.2f %10.2f %10u", plugin->GetMetadata().Name.c_str(),
+                std::string(GetHookName(type)).c_str(), timings.CallCount, timings.TotalTime / 1000.0,
+                timings.MaxTime / 1000.0, timings.OverBudgetCount);
+        }
+    }
+#else
+    console.WriteLineError("Scripting is not enabled in this build.");
+#endif
+    return 0;
+}
+
 using console_command_func = int32_t (*)(InteractiveConsole& console, const arguments_t& argv);
 struct console_command
 {
@@ -1966,6 +2072,7 @@ static constexpr const console_command console_command_table[] = {
     { "close", cc_close, "Closes the console.", "close" },
     { "date", cc_for_date, "Sets the date to a given date.", "Format <year>[ <month>[ <day>]]." },
     { "dereference", cc_dereference, "Dereferences a nullptr, for testing purposes only", "dereference" },
+    { "dirty_stats", cc_dirty_stats, "Shows how much of the screen was redrawn in the last frame.", "dirty_stats" },
     { "echo", cc_echo, "Echoes the text to the console.", "echo <text>" },
     { "exit", cc_close, "Closes the console.", "exit" },
     { "get", cc_get, "Gets the value of the specified variable.", "get <variable>" },
@@ -1996,7 +2103,7 @@ static constexpr const console_command console_command_table[] = {
     { "windows", cc_windows, "Lists all the windows that can be opened.", "windows" },
     { "replay_startrecord", cc_replay_startrecord, "Starts recording a new replay.", "replay_startrecord <name> [max_ticks]" },
     { "replay_stoprecord", cc_replay_stoprecord, "Stops recording a new replay.", "replay_stoprecord" },
-    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name>" },
+    { "replay_start", cc_replay_start, "Starts a replay", "replay_start <name> [seek_ticks]" },
     { "replay_stop", cc_replay_stop, "Stops the replay", "replay_stop" },
     { "replay_normalise", cc_replay_normalise, "Normalises the replay to remove all gaps",
       "replay_normalise <input file> <output file>" },
@@ -2006,6 +2113,11 @@ static constexpr const console_command console_command_table[] = {
     { "profiler_start", cc_profiler_start, "Starts the profiler.", "profiler_start" },
     { "profiler_stop", cc_profiler_stop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", cc_profiler_exportcsv, "Exports the current profiler data.", "profiler_exportcsv <output file>" },
+    { "profiler_exportframes", cc_profiler_exportframes, "Exports the frame time statistics and recorded frames.",
+      "profiler_exportframes <output file>" },
+    { "profiler_exporttrace", cc_profiler_exporttrace, "Exports the recent calls of each thread as a Chrome trace.",
+      "profiler_exporttrace <output file>" },
+    { "plugin_timings", cc_plugin_timings, "Lists the time each plugin has spent in its hooks.", "plugin_timings [reset]" },
 };
 
 static int32_t cc_windows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
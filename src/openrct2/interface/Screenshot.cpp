@@ -20,7 +20,10 @@
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/Imaging.h"
+#include "../core/Json.hpp"
+#include "../core/JobPool.h"
 #include "../core/Path.hpp"
+#include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/X8DrawingEngine.h"
 #include "../localisation/Formatter.h"
@@ -33,9 +36,11 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <exception>
 #include <memory>
 #include <optional>
 #include <string>
@@ -46,6 +51,9 @@ using namespace OpenRCT2::Drawing;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Large captures are rendered and written in bands of rows, so that only two bands are held in memory at a time.
+constexpr int32_t CaptureBandBytes = 32 * 1024 * 1024;
+
 static bool WriteDpiToFile(std::string_view path, const rct_drawpixelinfo* dpi, const GamePalette& palette)
 {
     auto const pixels8 = dpi->bits;
@@ -380,9 +388,73 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const rct_viewport& vi
     viewport_render(&dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
 }
 
+/**
+ * Renders the viewport band by band straight into a png. While a band renders, the previous one is compressed and
+ * written on a worker.
+ */
+static void RenderViewportToFile(const rct_viewport& viewport, std::string_view path)
+{
+    const auto width = viewport.width;
+    const auto height = viewport.height;
+    const auto bandHeight = std::clamp(CaptureBandBytes / std::max(width, 1), 1, std::max(height, 1));
+
+    Imaging::PngStreamWriter writer(path, width, height, gPalette);
+    X8DrawingEngine drawingEngine(GetContext()->GetUiContext());
+
+    // Ensure sprites appear regardless of rotation
+    reset_all_sprite_quadrant_placements();
+
+    std::vector<uint8_t> bands[2];
+    std::exception_ptr writeError;
+    JobPool writeJob;
+    for (int32_t bandTop = 0, bandIndex = 0; bandTop < height; bandTop += bandHeight, bandIndex ^= 1)
+    {
+        const auto rowCount = std::min(bandHeight, height - bandTop);
+
+        // The band written on the worker right now is always the other one.
+        auto& band = bands[bandIndex];
+        band.resize(static_cast<size_t>(width) * rowCount);
+        if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+        {
+            std::fill(band.begin(), band.end(), PALETTE_INDEX_0);
+        }
+
+        rct_drawpixelinfo dpi;
+        dpi.DrawingEngine = &drawingEngine;
+        dpi.bits = band.data();
+        dpi.x = 0;
+        dpi.y = bandTop;
+        dpi.width = width;
+        dpi.height = rowCount;
+        viewport_render(&dpi, &viewport, { { 0, bandTop }, { width, bandTop + rowCount } });
+
+        writeJob.Join();
+        if (writeError)
+        {
+            std::rethrow_exception(writeError);
+        }
+        writeJob.AddTask([&writer, &band, &writeError, rowCount, width]() {
+            try
+            {
+                writer.WriteRows(band.data(), rowCount, width);
+            }
+            catch (const std::exception&)
+            {
+                writeError = std::current_exception();
+            }
+        });
+    }
+
+    writeJob.Join();
+    if (writeError)
+    {
+        std::rethrow_exception(writeError);
+    }
+    writer.Finish();
+}
+
 void screenshot_giant()
 {
-    rct_drawpixelinfo dpi{};
     try
     {
         auto path = screenshot_get_next_path();
@@ -410,10 +482,7 @@ void screenshot_giant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), &dpi, gPalette);
+        RenderViewportToFile(viewport, path.value());
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -427,8 +496,6 @@ void screenshot_giant()
         log_error("%s", e.what());
         context_show_error(STR_SCREENSHOT_FAILED, STR_NONE, {});
     }
-
-    ReleaseDPI(dpi);
 }
 
 // TODO: Move this at some point into a more appropriate place.
@@ -440,7 +507,26 @@ template<typename FN> static inline double MeasureFunctionTime(const FN& fn)
     return std::chrono::duration<double>(endTime - startTime).count();
 }
 
-static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount)
+/**
+ * The viewport of the given size centred on the map, or the whole map if the size is empty.
+ */
+static rct_viewport GetBenchViewport(int32_t rotation, ZoomLevel zoom, const ScreenSize& resolution)
+{
+    auto viewport = GetGiantViewport(gMapSize, rotation, zoom);
+    if (resolution.width > 0 && resolution.height > 0)
+    {
+        const auto centre = viewport.viewPos + ScreenCoordsXY{ viewport.view_width / 2, viewport.view_height / 2 };
+        viewport.width = resolution.width;
+        viewport.height = resolution.height;
+        viewport.view_width = zoom.ApplyTo(resolution.width);
+        viewport.view_height = zoom.ApplyTo(resolution.height);
+        viewport.viewPos = centre - ScreenCoordsXY{ viewport.view_width / 2, viewport.view_height / 2 };
+    }
+    return viewport;
+}
+
+static void benchgfx_render_screenshots(
+    const char* inputPath, std::unique_ptr<IContext>& context, uint32_t iterationCount, const GfxBenchOptions& options)
 {
     if (!context->LoadParkFromFile(inputPath))
     {
@@ -450,80 +536,104 @@ static void benchgfx_render_screenshots(const char* inputPath, std::unique_ptr<I
     gIntroState = IntroState::None;
     gScreenFlags = SCREEN_FLAGS_PLAYING;
 
-    // Create Viewport and DPI for every rotation and zoom.
-    // We iterate from the default zoom level to the max zoomed out zoom level, then run GetGiantViewport once for each
-    // rotation.
-    constexpr int32_t NUM_ROTATIONS = 4;
-    constexpr auto NUM_ZOOM_LEVELS = static_cast<int8_t>(ZoomLevel::max());
-    std::array<rct_drawpixelinfo, NUM_ROTATIONS * NUM_ZOOM_LEVELS> dpis;
-    std::array<rct_viewport, NUM_ROTATIONS * NUM_ZOOM_LEVELS> viewports;
-
-    for (ZoomLevel zoom{ 0 }; zoom < ZoomLevel::max(); zoom++)
+    auto zooms = options.Zooms;
+    if (zooms.empty())
     {
-        int32_t zoomIndex{ static_cast<int8_t>(zoom) };
-        for (int32_t rotation = 0; rotation < NUM_ROTATIONS; rotation++)
+        for (ZoomLevel zoom{ 0 }; zoom < ZoomLevel::max(); zoom++)
         {
-            auto& viewport = viewports[zoomIndex * NUM_ZOOM_LEVELS + rotation];
-            auto& dpi = dpis[zoomIndex * NUM_ZOOM_LEVELS + rotation];
-            viewport = GetGiantViewport(gMapSize, rotation, zoom);
-            dpi = CreateDPI(viewport);
+            zooms.push_back(zoom);
         }
     }
+    const auto resolutions = options.Resolutions.empty() ? std::vector<ScreenSize>{ {} } : options.Resolutions;
+    const auto threadCounts = options.Threads.empty() ? std::vector<int32_t>{ 0 } : options.Threads;
 
-    const uint32_t totalRenderCount = iterationCount * NUM_ROTATIONS * NUM_ZOOM_LEVELS;
+    constexpr int32_t NUM_ROTATIONS = 4;
+    const auto savedRotation = gCurrentRotation;
+    const auto savedMultithreading = gConfigGeneral.multithreading;
+    const auto engineStringId = DrawingEngineStringIds[EnumValue(DrawingEngine::Software)];
+    const auto engineName = format_string(engineStringId, nullptr);
+    std::printf("Engine: %s\n", engineName.c_str());
 
+    json_t results = json_t::array();
     try
     {
-        double totalTime = 0.0;
-
-        std::array<double, NUM_ZOOM_LEVELS> zoomAverages;
-
-        // Render at every zoom.
-        for (int32_t zoom = 0; zoom < NUM_ZOOM_LEVELS; zoom++)
+        for (auto threads : threadCounts)
         {
-            double zoomLevelTime = 0.0;
+            // A single thread takes the serial paths rather than a parallel loop that happens to run on one thread.
+            gConfigGeneral.multithreading = threads == 0 ? savedMultithreading : threads > 1;
+            JobPool::SetMaxParallelism(std::max(threads, 0));
 
-            // Render at every rotation.
-            for (int32_t rotation = 0; rotation < NUM_ROTATIONS; rotation++)
+            for (auto zoom : zooms)
             {
-                // N iterations.
-                for (uint32_t i = 0; i < iterationCount; i++)
+                for (const auto& resolution : resolutions)
                 {
-                    auto& dpi = dpis[zoom * NUM_ZOOM_LEVELS + rotation];
-                    auto& viewport = viewports[zoom * NUM_ZOOM_LEVELS + rotation];
-                    double elapsed = MeasureFunctionTime([&viewport, &dpi]() { RenderViewport(nullptr, viewport, dpi); });
-                    totalTime += elapsed;
-                    zoomLevelTime += elapsed;
+                    ViewportPaintTimings timings;
+                    viewport_set_paint_timings(&timings);
+
+                    double totalTime = 0.0;
+                    ScreenSize size;
+                    for (int32_t rotation = 0; rotation < NUM_ROTATIONS; rotation++)
+                    {
+                        gCurrentRotation = rotation;
+                        auto viewport = GetBenchViewport(rotation, zoom, resolution);
+                        auto dpi = CreateDPI(viewport);
+                        size = { viewport.width, viewport.height };
+                        for (uint32_t i = 0; i < iterationCount; i++)
+                        {
+                            totalTime += MeasureFunctionTime([&viewport, &dpi]() { RenderViewport(nullptr, viewport, dpi); });
+                        }
+                        ReleaseDPI(dpi);
+                    }
+                    viewport_set_paint_timings(nullptr);
+
+                    const auto renderCount = static_cast<double>(NUM_ROTATIONS * iterationCount);
+                    const auto toAverageMs = [renderCount](const std::atomic<uint64_t>& ns) {
+                        return static_cast<double>(ns) / 1000000.0 / renderCount;
+                    };
+                    const double average = totalTime / renderCount;
+                    const auto zoomIndex = static_cast<int8_t>(zoom);
+                    std::printf(
+                        "Zoom[%d] %s, %d threads: %.06fs, %.f FPS (generate %.03fms, arrange %.03fms, draw %.03fms)\n",
+                        zoomIndex, resolution.width > 0 ? String::StdFormat("%dx%d", size.width, size.height).c_str() : "map",
+                        threads, average, 1.0 / average, toAverageMs(timings.GenerateNs), toAverageMs(timings.ArrangeNs),
+                        toAverageMs(timings.DrawNs));
+
+                    // The phases are summed over all threads, with multithreading they can add up to more than the
+                    // render time.
+                    results.push_back({
+                        { "zoom", zoomIndex },
+                        { "width", size.width },
+                        { "height", size.height },
+                        { "whole_map", resolution.width <= 0 || resolution.height <= 0 },
+                        { "threads", threads },
+                        { "renders", NUM_ROTATIONS * iterationCount },
+                        { "render_ms", average * 1000.0 },
+                        { "generate_ms", toAverageMs(timings.GenerateNs) },
+                        { "arrange_ms", toAverageMs(timings.ArrangeNs) },
+                        { "draw_ms", toAverageMs(timings.DrawNs) },
+                    });
                 }
             }
-
-            zoomAverages[zoom] = zoomLevelTime / static_cast<double>(NUM_ROTATIONS * iterationCount);
-        }
-
-        const double average = totalTime / static_cast<double>(totalRenderCount);
-        const auto engineStringId = DrawingEngineStringIds[EnumValue(DrawingEngine::Software)];
-        const auto engineName = format_string(engineStringId, nullptr);
-        std::printf("Engine: %s\n", engineName.c_str());
-        std::printf("Render Count: %u\n", totalRenderCount);
-        for (ZoomLevel zoom{ 0 }; zoom < ZoomLevel::max(); zoom++)
-        {
-            int32_t zoomIndex{ static_cast<int8_t>(zoom) };
-            const auto zoomAverage = zoomAverages[zoomIndex];
-            std::printf("Zoom[%d] average: %.06fs, %.f FPS\n", zoomIndex, zoomAverage, 1.0 / zoomAverage);
         }
-        std::printf("Total average: %.06fs, %.f FPS\n", average, 1.0 / average);
-        std::printf("Time: %.05fs\n", totalTime);
     }
     catch (const std::exception& e)
     {
+        viewport_set_paint_timings(nullptr);
         Console::Error::WriteLine("%s", e.what());
     }
 
-    for (auto& dpi : dpis)
-        ReleaseDPI(dpi);
+    gCurrentRotation = savedRotation;
+    gConfigGeneral.multithreading = savedMultithreading;
+    JobPool::SetMaxParallelism(0);
+
+    if (!options.OutputPath.empty())
+    {
+        const json_t report = { { "park", Path::GetFileName(inputPath) }, { "engine", engineName }, { "results", results } };
+        Json::WriteToFile(options.OutputPath, report);
+    }
 }
 
-int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
+int32_t cmdline_for_gfxbench(const char** argv, int32_t argc, const GfxBenchOptions& options)
 {
     if (argc != 1 && argc != 2)
     {
@@ -547,7 +657,7 @@ int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
     {
         drawing_engine_init();
 
-        benchgfx_render_screenshots(inputPath, context, iterationCount);
+        benchgfx_render_screenshots(inputPath, context, iterationCount, options);
 
         drawing_engine_dispose();
     }
@@ -555,13 +665,64 @@ int32_t cmdline_for_gfxbench(const char** argv, int32_t argc)
     return 1;
 }
 
-static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewport)
+struct ScreenshotLocation
 {
-    if (options->weather != WeatherType::Sunny && options->weather != WeatherType::Count)
+    // The centre of the map is used for the coordinates that are not set.
+    std::optional<int32_t> X;
+    std::optional<int32_t> Y;
+    int32_t Zoom{};
+    int32_t Rotation{};
+};
+
+/**
+ * Returns the viewport of the given size looking at location, or at the park's saved view without a location. A size of
+ * 0 covers the whole map. Sets the current rotation to the viewport's.
+ */
+static rct_viewport GetScreenshotViewport(
+    int32_t resolutionWidth, int32_t resolutionHeight, const std::optional<ScreenshotLocation>& location)
+{
+    const auto& mapSize = gMapSize;
+    const int32_t customZoom = location.has_value() ? location->Zoom : 0;
+    if (resolutionWidth == 0 || resolutionHeight == 0)
     {
-        climate_force_weather(WeatherType{ static_cast<uint8_t>(EnumValue(options->weather) - 1) });
+        resolutionWidth = (mapSize.x * COORDS_XY_STEP * 2) >> customZoom;
+        resolutionHeight = (mapSize.y * COORDS_XY_STEP * 1) >> customZoom;
+
+        resolutionWidth += 8;
+        resolutionHeight += 128;
+    }
+
+    rct_viewport viewport{};
+    viewport.width = resolutionWidth;
+    viewport.height = resolutionHeight;
+    viewport.view_width = viewport.width;
+    viewport.view_height = viewport.height;
+    if (location.has_value())
+    {
+        const int32_t customX = location->X.value_or((mapSize.x / 2) * 32 + 16);
+        const int32_t customY = location->Y.value_or((mapSize.y / 2) * 32 + 16);
+
+        int32_t z = tile_element_height({ customX, customY });
+        CoordsXYZ coords3d = { customX, customY, z };
+
+        auto coords2d = translate_3d_to_2d_with_z(location->Rotation, coords3d);
+
+        viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
+                             coords2d.y - ((viewport.view_height << customZoom) / 2) };
+        viewport.zoom = ZoomLevel{ static_cast<int8_t>(customZoom) };
+        gCurrentRotation = location->Rotation;
+    }
+    else
+    {
+        viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
+        viewport.zoom = gSavedViewZoom;
+        gCurrentRotation = gSavedViewRotation;
     }
+    return viewport;
+}
 
+static void ApplyViewportOptions(const ScreenshotOptions* options, rct_viewport& viewport)
+{
     if (options->hide_guests)
     {
         viewport.flags |= VIEWPORT_FLAG_HIDE_GUESTS | VIEWPORT_FLAG_HIDE_STAFF;
@@ -572,6 +733,20 @@ static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewpor
         viewport.flags |= VIEWPORT_FLAG_HIDE_ENTITIES;
     }
 
+    if (options->transparent || gConfigGeneral.transparent_screenshot)
+    {
+        viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
+    }
+}
+
+// Changes the loaded park, so only has to be applied once per park.
+static void ApplyParkOptions(const ScreenshotOptions* options)
+{
+    if (options->weather != WeatherType::Sunny && options->weather != WeatherType::Count)
+    {
+        climate_force_weather(WeatherType{ static_cast<uint8_t>(EnumValue(options->weather) - 1) });
+    }
+
     if (options->mowed_grass)
     {
         CheatsSet(CheatType::SetGrassLength, GRASS_LENGTH_MOWED);
@@ -596,11 +771,12 @@ static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewpor
     {
         CheatsSet(CheatType::RemoveLitter);
     }
+}
 
-    if (options->transparent || gConfigGeneral.transparent_screenshot)
-    {
-        viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
-    }
+static void ApplyOptions(const ScreenshotOptions* options, rct_viewport& viewport)
+{
+    ApplyParkOptions(options);
+    ApplyViewportOptions(options, viewport);
 }
 
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options)
@@ -625,13 +801,9 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
     }
 
     int32_t exitCode = 1;
-    rct_drawpixelinfo dpi;
     try
     {
         Platform::CoreInit();
-        bool customLocation = false;
-        bool centreMapX = false;
-        bool centreMapY = false;
 
         const char* inputPath = argv[0];
         const char* outputPath = argv[1];
@@ -664,84 +836,171 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
         }
         else
         {
-            int32_t resolutionWidth = std::atoi(argv[2]);
-            int32_t resolutionHeight = std::atoi(argv[3]);
-            int32_t customX = 0;
-            int32_t customY = 0;
-            int32_t customZoom = 0;
-            int32_t customRotation = 0;
+            std::optional<ScreenshotLocation> location;
             if (argc == 8)
             {
-                customLocation = true;
-                if (argv[4][0] == 'c')
-                    centreMapX = true;
-                else
-                    customX = std::atoi(argv[4]);
+                location.emplace();
+                if (argv[4][0] != 'c')
+                    location->X = std::atoi(argv[4]);
+                if (argv[5][0] != 'c')
+                    location->Y = std::atoi(argv[5]);
+                location->Zoom = std::atoi(argv[6]);
+                location->Rotation = std::atoi(argv[7]) & 3;
+            }
+            viewport = GetScreenshotViewport(std::atoi(argv[2]), std::atoi(argv[3]), location);
+        }
 
-                if (argv[5][0] == 'c')
-                    centreMapY = true;
-                else
-                    customY = std::atoi(argv[5]);
+        ApplyOptions(options, viewport);
 
-                customZoom = std::atoi(argv[6]);
-                customRotation = std::atoi(argv[7]) & 3;
-            }
+        RenderViewportToFile(viewport, outputPath);
+    }
+    catch (const std::exception& e)
+    {
+        std::printf("%s\n", e.what());
+        exitCode = -1;
+    }
 
-            const auto& mapSize = gMapSize;
-            if (resolutionWidth == 0 || resolutionHeight == 0)
-            {
-                resolutionWidth = (mapSize.x * COORDS_XY_STEP * 2) >> customZoom;
-                resolutionHeight = (mapSize.y * COORDS_XY_STEP * 1) >> customZoom;
+    drawing_engine_dispose();
 
-                resolutionWidth += 8;
-                resolutionHeight += 128;
-            }
+    return exitCode;
+}
 
-            viewport.width = resolutionWidth;
-            viewport.height = resolutionHeight;
-            viewport.view_width = viewport.width;
-            viewport.view_height = viewport.height;
-            if (customLocation)
-            {
-                if (centreMapX)
-                    customX = (mapSize.x / 2) * 32 + 16;
-                if (centreMapY)
-                    customY = (mapSize.y / 2) * 32 + 16;
+/**
+ * Renders the viewport and leaves encoding and writing the png to writeJobs. Views larger than a band are rendered and
+ * written band by band instead.
+ */
+static void RenderViewportToFileAsync(
+    const rct_viewport& viewport, const std::string& path, JobPool& writeJobs, std::atomic<size_t>& failures)
+{
+    if (static_cast<int64_t>(viewport.width) * viewport.height > CaptureBandBytes)
+    {
+        RenderViewportToFile(viewport, path);
+        return;
+    }
 
-                int32_t z = tile_element_height({ customX, customY });
-                CoordsXYZ coords3d = { customX, customY, z };
+    auto image = std::make_shared<Image>();
+    image->Width = viewport.width;
+    image->Height = viewport.height;
+    image->Depth = 8;
+    image->Stride = viewport.width;
+    image->Palette = std::make_unique<GamePalette>(gPalette);
+    image->Pixels.resize(static_cast<size_t>(viewport.width) * viewport.height);
+    if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+    {
+        std::fill(image->Pixels.begin(), image->Pixels.end(), PALETTE_INDEX_0);
+    }
 
-                auto coords2d = translate_3d_to_2d_with_z(customRotation, coords3d);
+    rct_drawpixelinfo dpi;
+    dpi.bits = image->Pixels.data();
+    dpi.width = viewport.width;
+    dpi.height = viewport.height;
+    RenderViewport(nullptr, viewport, dpi);
 
-                viewport.viewPos = { coords2d.x - ((viewport.view_width << customZoom) / 2),
-                                     coords2d.y - ((viewport.view_height << customZoom) / 2) };
-                viewport.zoom = ZoomLevel{ static_cast<int8_t>(customZoom) };
-                gCurrentRotation = customRotation;
-            }
-            else
+    // Bound the number of rendered images waiting for a worker.
+    if (writeJobs.CountPending() > JobPool::GetWorkerCount() * 2)
+    {
+        writeJobs.Join();
+    }
+    writeJobs.AddTask([image, path, &failures]() {
+        try
+        {
+            Imaging::WriteToFile(path, *image, IMAGE_FORMAT::PNG);
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Unable to write %s: %s", path.c_str(), e.what());
+            failures++;
+        }
+    });
+}
+
+static std::optional<int32_t> GetManifestCoordinate(const json_t& value)
+{
+    return value.is_number() ? std::make_optional(Json::GetNumber<int32_t>(value)) : std::nullopt;
+}
+
+int32_t cmdline_for_screenshot_batch(const char* manifestPath, ScreenshotOptions* options)
+{
+    int32_t exitCode = 1;
+    std::atomic<size_t> failures{};
+    JobPool writeJobs;
+    try
+    {
+        const auto manifest = Json::ReadFromFile(manifestPath);
+        if (!manifest.is_array())
+        {
+            throw std::runtime_error("Expected an array of parks in the manifest.");
+        }
+        const auto directoryPath = Path::GetDirectory(manifestPath);
+
+        Platform::CoreInit();
+        gOpenRCT2Headless = true;
+        auto context = CreateContext();
+        if (!context->Initialise())
+        {
+            throw std::runtime_error("Failed to initialize context.");
+        }
+
+        drawing_engine_init();
+
+        for (const auto& park : manifest)
+        {
+            const auto parkPath = Path::GetAbsolute(Path::Combine(directoryPath, Json::GetString(park["park"])));
+            if (!context->LoadParkFromFile(parkPath))
             {
-                viewport.viewPos = { gSavedView - ScreenCoordsXY{ (viewport.view_width / 2), (viewport.view_height / 2) } };
-                viewport.zoom = gSavedViewZoom;
-                gCurrentRotation = gSavedViewRotation;
+                log_error("Failed to load park: %s", parkPath.c_str());
+                failures++;
+                continue;
             }
-        }
 
-        ApplyOptions(options, viewport);
+            gIntroState = IntroState::None;
+            gScreenFlags = SCREEN_FLAGS_PLAYING;
+            ApplyParkOptions(options);
 
-        dpi = CreateDPI(viewport);
+            for (const auto& view : park.value("views", json_t::array()))
+            {
+                const auto outputPath = Path::GetAbsolute(Path::Combine(directoryPath, Json::GetString(view["output"])));
+                const auto zoom = Json::GetNumber<int32_t>(view["zoom"]);
+                const auto rotation = Json::GetNumber<int32_t>(view["rotation"]) & 3;
 
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, &dpi, gPalette);
+                rct_viewport viewport{};
+                if (Json::GetBoolean(view["giant"]))
+                {
+                    viewport = GetGiantViewport(gMapSize, rotation, ZoomLevel{ static_cast<int8_t>(zoom) });
+                    gCurrentRotation = rotation;
+                }
+                else
+                {
+                    // Views without a location show the park's saved view, like the command line does.
+                    std::optional<ScreenshotLocation> location;
+                    if (view.contains("x") || view.contains("y"))
+                    {
+                        location = ScreenshotLocation{ GetManifestCoordinate(view["x"]), GetManifestCoordinate(view["y"]),
+                                                       zoom, rotation };
+                    }
+                    viewport = GetScreenshotViewport(
+                        Json::GetNumber<int32_t>(view["width"]), Json::GetNumber<int32_t>(view["height"]), location);
+                }
+
+                ApplyViewportOptions(options, viewport);
+                RenderViewportToFileAsync(viewport, outputPath, writeJobs, failures);
+            }
+        }
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
+    writeJobs.Join();
     drawing_engine_dispose();
 
+    if (failures > 0)
+    {
+        std::printf("%zu screenshots failed.\n", failures.load());
+        exitCode = -1;
+    }
     return exitCode;
 }
 
@@ -825,10 +1084,7 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, &dpi, gPalette);
-    ReleaseDPI(dpi);
+    RenderViewportToFile(viewport, outputPath);
 
     gCurrentRotation = backupRotation;
 }
@@ -17,6 +17,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 struct rct_drawpixelinfo;
 
@@ -36,6 +37,18 @@ struct ScreenshotOptions
     bool transparent = false;
 };
 
+struct GfxBenchOptions
+{
+    // Zoom levels to render at, all of them if empty.
+    std::vector<ZoomLevel> Zooms;
+    // Sizes of the viewports to render, centred on the map. An empty size renders the whole map.
+    std::vector<ScreenSize> Resolutions;
+    // Numbers of threads to render with, 0 for the multithreading setting.
+    std::vector<int32_t> Threads;
+    // File to write a JSON report to.
+    std::string OutputPath;
+};
+
 struct CaptureView
 {
     int32_t Width{};
@@ -59,6 +72,7 @@ std::string screenshot_dump_png_32bpp(int32_t width, int32_t height, const void*
 
 void screenshot_giant();
 int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOptions* options);
-int32_t cmdline_for_gfxbench(const char** argv, int32_t argc);
+int32_t cmdline_for_screenshot_batch(const char* manifestPath, ScreenshotOptions* options);
+int32_t cmdline_for_gfxbench(const char** argv, int32_t argc, const GfxBenchOptions& options);
 
 void CaptureImage(const CaptureOptions& options);
@@ -38,6 +38,8 @@
 #include "Window_internal.h"
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstring>
 #include <list>
 #include <unordered_map>
@@ -50,10 +52,50 @@ uint8_t gShowLandRightsRefCount;
 uint8_t gShowConstuctionRightsRefCount;
 
 static std::list<rct_viewport> _viewports;
+static ViewportPaintTimings* _paintTimings;
 rct_viewport* g_music_tracking_viewport;
 
-static std::unique_ptr<JobPool> _paintJobs;
-static std::vector<paint_session*> _paintColumns;
+struct PaintColumn
+{
+    paint_session* Session;
+    // The part of the viewport the column is drawn to, within the area the session has been generated for.
+    rct_drawpixelinfo DPI;
+    bool Generate;
+};
+static std::vector<PaintColumn> _paintColumns;
+
+// Columns generated during the current frame are kept until the next one, so that viewports showing the same area at
+// the same zoom and with the same view flags can draw them instead of generating and arranging their own.
+struct SharedPaintColumnsKey
+{
+    uint32_t DrawCount{};
+    uint32_t Ticks{};
+    uint32_t ElementsRevision{};
+    uint8_t Rotation{};
+
+    bool operator==(const SharedPaintColumnsKey& other) const
+    {
+        return DrawCount == other.DrawCount && Ticks == other.Ticks && ElementsRevision == other.ElementsRevision
+            && Rotation == other.Rotation;
+    }
+};
+static SharedPaintColumnsKey _sharedPaintColumnsKey;
+static std::vector<paint_session*> _sharedPaintColumns;
+static constexpr size_t MaxSharedPaintColumns = 1024;
+
+// Number of paint structs the column at a given view x produced the last time it was painted, used to start the most
+// expensive columns first.
+static std::unordered_map<int32_t, uint32_t> _paintColumnCosts;
+static constexpr size_t MaxPaintColumnCosts = 4096;
+
+struct PaintColumnBand
+{
+    paint_session* Session;
+    rct_drawpixelinfo DPI;
+    uint32_t Cost;
+};
+static std::vector<size_t> _paintColumnOrder;
+static std::vector<PaintColumnBand> _paintColumnBands;
 
 ScreenCoordsXY gSavedView;
 ZoomLevel gSavedViewZoom;
@@ -63,6 +105,26 @@ paint_entry* gNextFreePaintStruct;
 uint8_t gCurrentRotation;
 
 static uint32_t _currentImageType;
+
+// Results of the recent queries for what is under a screen position. The UI asks several times per frame for the same
+// position, e.g. tooltips, tool hover and tools that try more than one filter, each would paint the pixel again.
+struct InteractionQuery
+{
+    const rct_viewport* Viewport{};
+    ScreenCoordsXY ViewPos;
+    ScreenCoordsXY ViewLoc;
+    ZoomLevel Zoom;
+    uint32_t ViewFlags{};
+    uint16_t Filter{};
+    uint32_t DrawCount{};
+    uint32_t Ticks{};
+    uint32_t ElementsRevision{};
+    InteractionInfo Info;
+};
+static constexpr size_t MaxInteractionQueries = 4;
+static std::array<InteractionQuery, MaxInteractionQueries> _interactionQueries;
+static size_t _nextInteractionQuery;
+
 InteractionInfo::InteractionInfo(const paint_struct* ps)
     : Loc(ps->map_x, ps->map_y)
     , Element(ps->tileElement)
@@ -220,6 +282,15 @@ void viewport_remove(rct_viewport* viewport)
         return;
     }
     _viewports.erase(it);
+
+    // The address may be reused by the next viewport.
+    for (auto& query : _interactionQueries)
+    {
+        if (query.Viewport == viewport)
+        {
+            query.Viewport = nullptr;
+        }
+    }
 }
 
 void viewports_invalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
@@ -459,6 +530,13 @@ static void viewport_move(const ScreenCoordsXY& coords, rct_window* w, rct_viewp
     if ((!x_diff) && (!y_diff))
         return;
 
+    // Engines without dirty optimisations draw all windows again once anything has been invalidated.
+    if (!drawing_engine_has_dirty_optimisations())
+    {
+        w->Invalidate();
+        return;
+    }
+
     if (w->flags & WF_7)
     {
         int32_t left = std::max<int32_t>(viewport->pos.x, 0);
@@ -901,20 +979,124 @@ static void record_session(
     }
 }
 
+void viewport_set_paint_timings(ViewportPaintTimings* timings)
+{
+    _paintTimings = timings;
+}
+
+template<typename TFn> static void viewport_measure_phase(std::atomic<uint64_t> ViewportPaintTimings::*phase, TFn&& fn)
+{
+    if (_paintTimings == nullptr)
+    {
+        fn();
+        return;
+    }
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
+    fn();
+    const auto elapsed = std::chrono::high_resolution_clock::now() - startTime;
+    (_paintTimings->*phase) += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
 static void viewport_fill_column(
     paint_session& session, std::vector<RecordedPaintSession>* recorded_sessions, size_t record_index)
 {
     PROFILED_FUNCTION();
 
-    PaintSessionGenerate(session);
+    viewport_measure_phase(&ViewportPaintTimings::GenerateNs, [&session]() { PaintSessionGenerate(session); });
     if (recorded_sessions != nullptr)
     {
         record_session(session, recorded_sessions, record_index);
     }
-    PaintSessionArrange(session);
+    viewport_measure_phase(&ViewportPaintTimings::ArrangeNs, [&session]() { PaintSessionArrange(session); });
+}
+
+static uint32_t viewport_count_paint_structs(const paint_session& session)
+{
+    uint32_t count = 0;
+    for (auto* ps = session.PaintHead.next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+    {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Splits the arranged columns into horizontal bands that can be drawn independently. Columns holding more than their
+ * share of the paint structs are cut into several bands, so a single crowded column does not hold up the frame.
+ */
+static void viewport_split_paint_columns(const std::vector<uint32_t>& columnCosts)
+{
+    _paintColumnBands.clear();
+
+    uint64_t totalCost = 0;
+    for (auto cost : columnCosts)
+    {
+        totalCost += cost;
+    }
+    // Aim for a few bands per thread so that the threads finishing early can pick up more work.
+    const auto threadCount = JobPool::GetWorkerCount() + 1;
+    const auto targetCost = std::max<uint64_t>(totalCost / (threadCount * 4), 1);
+
+    for (size_t i = 0; i < _paintColumns.size(); i++)
+    {
+        auto* session = _paintColumns[i].Session;
+        const auto& dpi = _paintColumns[i].DPI;
+
+        // Bands are cut at multiples of 32 units like the columns. Zoomed in views are not split so that every band
+        // starts on a whole pixel.
+        auto bandCount = static_cast<int32_t>((columnCosts[i] + targetCost - 1) / targetCost);
+        bandCount = std::clamp(bandCount, 1, std::max((dpi.height + 31) / 32, 1));
+        if (dpi.zoom_level < ZoomLevel{ 0 } || dpi.remY != 0)
+        {
+            bandCount = 1;
+        }
+
+        const auto bandHeight = ((dpi.height / bandCount) + 31) & ~31;
+        const auto stride = dpi.zoom_level.ApplyInversedTo(dpi.width) + dpi.pitch;
+        for (int32_t top = 0; top < dpi.height; top += bandHeight)
+        {
+            PaintColumnBand band{ session, dpi, columnCosts[i] / bandCount };
+            band.DPI.y = dpi.y + top;
+            band.DPI.height = std::min(bandHeight, dpi.height - top);
+            band.DPI.bits = dpi.bits + dpi.zoom_level.ApplyInversedTo(top) * stride;
+            _paintColumnBands.push_back(band);
+        }
+    }
+
+    std::stable_sort(_paintColumnBands.begin(), _paintColumnBands.end(), [](const auto& a, const auto& b) {
+        return a.Cost > b.Cost;
+    });
+}
+
+static void viewport_release_shared_paint_columns()
+{
+    for (auto* session : _sharedPaintColumns)
+    {
+        PaintSessionFree(session);
+    }
+    _sharedPaintColumns.clear();
+}
+
+/**
+ * Returns a column generated earlier in the frame that covers the given area with the same view flags, if any.
+ */
+static paint_session* viewport_find_shared_paint_column(const rct_drawpixelinfo& dpi, uint32_t viewFlags)
+{
+    for (auto* session : _sharedPaintColumns)
+    {
+        const auto& sessionDPI = session->DPI;
+        if (session->ViewFlags == viewFlags && sessionDPI.zoom_level == dpi.zoom_level && sessionDPI.x <= dpi.x
+            && sessionDPI.y <= dpi.y && sessionDPI.x + sessionDPI.width >= dpi.x + dpi.width
+            && sessionDPI.y + sessionDPI.height >= dpi.y + dpi.height)
+        {
+            return session;
+        }
+    }
+    return nullptr;
 }
 
-static void viewport_paint_column(paint_session& session)
+static void viewport_paint_column(paint_session& session, rct_drawpixelinfo* dpi)
 {
     PROFILED_FUNCTION();
 
@@ -928,20 +1110,20 @@ static void viewport_paint_column(paint_session& session)
         {
             colour = COLOUR_BLACK;
         }
-        gfx_clear(&session.DPI, colour);
+        gfx_clear(dpi, colour);
     }
 
-    PaintDrawStructs(session);
+    viewport_measure_phase(&ViewportPaintTimings::DrawNs, [&session, dpi]() { PaintDrawStructs(session, dpi); });
 
     if (gConfigGeneral.render_weather_gloom && !gTrackDesignSaveMode && !(session.ViewFlags & VIEWPORT_FLAG_HIDE_ENTITIES)
         && !(session.ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
     {
-        viewport_paint_weather_gloom(&session.DPI);
+        viewport_paint_weather_gloom(dpi);
     }
 
     if (session.PSStringHead != nullptr)
     {
-        PaintDrawMoneyStructs(&session.DPI, session.PSStringHead);
+        PaintDrawMoneyStructs(dpi, session.PSStringHead);
     }
 }
 
@@ -999,16 +1181,20 @@ void viewport_paint(
 
     _paintColumns.clear();
 
-    bool useMultithreading = gConfigGeneral.multithreading;
-    if (useMultithreading && _paintJobs == nullptr)
-    {
-        _paintJobs = std::make_unique<JobPool>();
-    }
-    else if (useMultithreading == false && _paintJobs != nullptr)
+    // Sessions hold element and entity positions, they can only be shared while neither have changed.
+    const SharedPaintColumnsKey sharedKey{ gCurrentDrawCount, gCurrentTicks, map_get_elements_revision(),
+                                           get_current_rotation() };
+    if (!(sharedKey == _sharedPaintColumnsKey))
     {
-        _paintJobs.reset();
+        viewport_release_shared_paint_columns();
+        _sharedPaintColumnsKey = sharedKey;
     }
+    // Recorded sessions must be generated for the columns being recorded. Viewports that do not belong to a window, such
+    // as the track design preview, may paint the map while it is temporarily changed.
+    const bool shareColumns = recorded_sessions == nullptr
+        && std::any_of(_viewports.begin(), _viewports.end(), [viewport](const auto& vp) { return &vp == viewport; });
 
+    bool useMultithreading = gConfigGeneral.multithreading;
     bool useParallelDrawing = false;
     if (useMultithreading && (dpi->DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING))
     {
@@ -1027,10 +1213,7 @@ void viewport_paint(
     // Generate and sort columns.
     for (x = alignedX; x < rightBorder; x += 32, index++)
     {
-        paint_session* session = PaintSessionAlloc(&dpi1, viewFlags);
-        _paintColumns.push_back(session);
-
-        rct_drawpixelinfo& dpi2 = session->DPI;
+        rct_drawpixelinfo dpi2 = dpi1;
         if (x >= dpi2.x)
         {
             auto leftPitch = x - dpi2.x;
@@ -1049,12 +1232,16 @@ void viewport_paint(
         }
         dpi2.width = paintRight - dpi2.x;
 
-        if (useMultithreading)
+        paint_session* session = shareColumns ? viewport_find_shared_paint_column(dpi2, viewFlags) : nullptr;
+        if (session != nullptr)
         {
-            _paintJobs->AddTask(
-                [session, recorded_sessions, index]() -> void { viewport_fill_column(*session, recorded_sessions, index); });
+            _paintColumns.push_back({ session, dpi2, false });
+            continue;
         }
-        else
+
+        session = PaintSessionAlloc(&dpi2, viewFlags);
+        _paintColumns.push_back({ session, dpi2, true });
+        if (!useMultithreading)
         {
             viewport_fill_column(*session, recorded_sessions, index);
         }
@@ -1062,30 +1249,76 @@ void viewport_paint(
 
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        // The columns are the unit the paint structs are arranged in and cannot be split further without changing the
+        // draw order. Start with the ones that were the most expensive last time so that they do not finish last.
+        _paintColumnOrder.clear();
+        std::vector<uint32_t> expectedCosts(_paintColumns.size());
+        for (size_t i = 0; i < _paintColumns.size(); i++)
+        {
+            if (!_paintColumns[i].Generate)
+            {
+                continue;
+            }
+            _paintColumnOrder.push_back(i);
+            auto it = _paintColumnCosts.find(_paintColumns[i].DPI.x);
+            expectedCosts[i] = it != _paintColumnCosts.end() ? it->second : 0;
+        }
+        std::stable_sort(_paintColumnOrder.begin(), _paintColumnOrder.end(), [&expectedCosts](size_t a, size_t b) {
+            return expectedCosts[a] > expectedCosts[b];
+        });
+
+        JobPool::ParallelFor(0, _paintColumnOrder.size(), 1, [recorded_sessions](size_t i) {
+            auto index = _paintColumnOrder[i];
+            viewport_fill_column(*_paintColumns[index].Session, recorded_sessions, index);
+        });
     }
 
-    // Paint columns.
-    for (auto* session : _paintColumns)
+    std::vector<uint32_t> columnCosts(_paintColumns.size());
+    if (useMultithreading)
     {
-        if (useParallelDrawing)
+        if (_paintColumnCosts.size() > MaxPaintColumnCosts)
         {
-            _paintJobs->AddTask([session]() -> void { viewport_paint_column(*session); });
+            _paintColumnCosts.clear();
         }
-        else
+        for (size_t i = 0; i < _paintColumns.size(); i++)
         {
-            viewport_paint_column(*session);
+            columnCosts[i] = viewport_count_paint_structs(*_paintColumns[i].Session);
+            _paintColumnCosts[_paintColumns[i].DPI.x] = columnCosts[i];
         }
     }
+
+    // Paint columns.
     if (useParallelDrawing)
     {
-        _paintJobs->Join();
+        viewport_split_paint_columns(columnCosts);
+        JobPool::ParallelFor(0, _paintColumnBands.size(), 1, [](size_t i) {
+            auto& band = _paintColumnBands[i];
+            viewport_paint_column(*band.Session, &band.DPI);
+        });
+    }
+    else
+    {
+        for (auto& column : _paintColumns)
+        {
+            viewport_paint_column(*column.Session, &column.DPI);
+        }
     }
 
-    // Release resources.
-    for (auto* session : _paintColumns)
+    // Release resources, or keep the new columns for the other viewports.
+    for (auto& column : _paintColumns)
     {
-        PaintSessionFree(session);
+        if (!column.Generate)
+        {
+            continue;
+        }
+        if (shareColumns && _sharedPaintColumns.size() < MaxSharedPaintColumns)
+        {
+            _sharedPaintColumns.push_back(column.Session);
+        }
+        else
+        {
+            PaintSessionFree(column.Session);
+        }
     }
 }
 
@@ -1175,6 +1408,37 @@ CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z)
     return ret.Rotate(inverseRotation);
 }
 
+MapRange viewport_rect_to_entity_map_range(const ScreenRect& viewRect)
+{
+    // Sprites extend at most 255 pixels from their position in each direction.
+    constexpr int32_t spriteMargin = 256;
+    constexpr int32_t maxEntityZ = (MAX_ELEMENT_HEIGHT + 1) * COORDS_Z_STEP;
+    const ScreenCoordsXY corners[] = {
+        { viewRect.GetLeft() - spriteMargin, viewRect.GetTop() - spriteMargin },
+        { viewRect.GetRight() + spriteMargin, viewRect.GetTop() - spriteMargin },
+        { viewRect.GetLeft() - spriteMargin, viewRect.GetBottom() + spriteMargin },
+        { viewRect.GetRight() + spriteMargin, viewRect.GetBottom() + spriteMargin },
+    };
+
+    auto left = std::numeric_limits<int32_t>::max();
+    auto top = std::numeric_limits<int32_t>::max();
+    auto right = std::numeric_limits<int32_t>::min();
+    auto bottom = std::numeric_limits<int32_t>::min();
+    for (const auto& corner : corners)
+    {
+        for (auto z : { 0, maxEntityZ })
+        {
+            const auto pos = viewport_coord_to_map_coord(corner, z);
+            left = std::min(left, pos.x);
+            top = std::min(top, pos.y);
+            right = std::max(right, pos.x);
+            bottom = std::max(bottom, pos.y);
+        }
+    }
+    // Allow for the rounding of the screen coordinates.
+    return MapRange(left - COORDS_XY_STEP, top - COORDS_XY_STEP, right + COORDS_XY_STEP, bottom + COORDS_XY_STEP);
+}
+
 /**
  *
  *  rct2: 0x00664689
@@ -1887,6 +2151,28 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
             viewLoc.x &= myviewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
             viewLoc.y &= myviewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
         }
+
+        // Element pointers and entity positions may only be reused while neither the map nor the entities have changed.
+        InteractionQuery query;
+        query.Viewport = myviewport;
+        query.ViewPos = myviewport->viewPos;
+        query.ViewLoc = viewLoc;
+        query.Zoom = myviewport->zoom;
+        query.ViewFlags = myviewport->flags;
+        query.Filter = flags & 0xFFFF;
+        query.DrawCount = gCurrentDrawCount;
+        query.Ticks = gCurrentTicks;
+        query.ElementsRevision = map_get_elements_revision();
+        auto it = std::find_if(_interactionQueries.begin(), _interactionQueries.end(), [&query](const InteractionQuery& q) {
+            return q.Viewport == query.Viewport && q.ViewPos == query.ViewPos && q.ViewLoc == query.ViewLoc
+                && q.Zoom == query.Zoom && q.ViewFlags == query.ViewFlags && q.Filter == query.Filter
+                && q.DrawCount == query.DrawCount && q.Ticks == query.Ticks && q.ElementsRevision == query.ElementsRevision;
+        });
+        if (it != _interactionQueries.end())
+        {
+            return it->Info;
+        }
+
         rct_drawpixelinfo dpi;
         dpi.x = viewLoc.x;
         dpi.y = viewLoc.y;
@@ -1897,8 +2183,12 @@ InteractionInfo get_map_coordinates_from_pos_window(rct_window* window, const Sc
         paint_session* session = PaintSessionAlloc(&dpi, myviewport->flags);
         PaintSessionGenerate(*session);
         PaintSessionArrange(*session);
-        info = set_interaction_info_from_paint_session(session, myviewport->flags, flags & 0xFFFF);
+        info = set_interaction_info_from_paint_session(session, myviewport->flags, query.Filter);
         PaintSessionFree(session);
+
+        query.Info = info;
+        _interactionQueries[_nextInteractionQuery] = query;
+        _nextInteractionQuery = (_nextInteractionQuery + 1) % MaxInteractionQueries;
     }
     return info;
 }
@@ -12,6 +12,7 @@
 #include "../world/Location.hpp"
 #include "Window.h"
 
+#include <atomic>
 #include <limits>
 #include <optional>
 #include <vector>
@@ -138,9 +139,29 @@ void viewport_paint(
     const rct_viewport* viewport, rct_drawpixelinfo* dpi, const ScreenRect& screenRect,
     std::vector<RecordedPaintSession>* sessions = nullptr);
 
+/**
+ * Time spent in each phase of painting, summed over all columns and threads.
+ */
+struct ViewportPaintTimings
+{
+    std::atomic<uint64_t> GenerateNs{};
+    std::atomic<uint64_t> ArrangeNs{};
+    std::atomic<uint64_t> DrawNs{};
+};
+
+/**
+ * Makes viewport_paint add the time of each phase to timings, or stops measuring if timings is nullptr.
+ */
+void viewport_set_paint_timings(ViewportPaintTimings* timings);
+
 CoordsXYZ viewport_adjust_for_map_height(const ScreenCoordsXY& startCoords);
 
 CoordsXY viewport_coord_to_map_coord(const ScreenCoordsXY& coords, int32_t z);
+/**
+ * Returns a map range that contains every entity whose sprite may overlap the given rectangle in viewport coordinates,
+ * at any height in the current rotation. Use it with EntityRangeQuery to skip entities that are far off screen.
+ */
+MapRange viewport_rect_to_entity_map_range(const ScreenRect& viewRect);
 std::optional<CoordsXY> screen_pos_to_map_pos(const ScreenCoordsXY& screenCoords, int32_t* direction);
 
 void show_gridlines();
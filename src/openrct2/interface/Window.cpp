@@ -17,6 +17,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/Timer.hpp"
 #include "../drawing/Drawing.h"
 #include "../interface/Cursors.h"
 #include "../localisation/Localisation.h"
@@ -51,6 +52,7 @@ TextInputSession* gTextInput;
 uint16_t gWindowUpdateTicks;
 uint16_t gWindowMapFlashingFlags;
 colour_t gCurrentWindowColours[4];
+bool gShowWindowDrawTimes;
 
 // converted from uint16_t values at 0x009A41EC - 0x009A4230
 // these are percentage coordinates of the viewport to centre to, if a window is obscuring a location, the next is tried
@@ -517,6 +519,19 @@ void window_invalidate_all()
     window_visit_each([](rct_window* w) { w->Invalidate(); });
 }
 
+/**
+ * Stores the hash of the data the window shows and returns whether it differs from the previously stored one. The
+ * caller decides which part of the window to invalidate.
+ */
+bool window_update_data_hash(rct_window* w, const WindowDataHash& hash)
+{
+    if (w->dataHash == hash.Value)
+        return false;
+
+    w->dataHash = hash.Value;
+    return true;
+}
+
 /**
  * Invalidates the specified widget of a window.
  *  rct2: 0x006EC402
@@ -1248,6 +1263,8 @@ static void window_draw_single(rct_drawpixelinfo* dpi, rct_window* w, int32_t le
             return;
     }
 
+    OpenRCT2::Timer timer;
+
     // Invalidate modifies the window colours so first get the correct
     // colour before setting the global variables for the string painting
     window_event_invalidate_call(w);
@@ -1259,6 +1276,11 @@ static void window_draw_single(rct_drawpixelinfo* dpi, rct_window* w, int32_t le
     gCurrentWindowColours[3] = NOT_TRANSLUCENT(w->colours[3]);
 
     window_event_paint_call(w, dpi);
+
+    if (gShowWindowDrawTimes)
+    {
+        w->drawTime += std::chrono::duration<float, std::milli>(timer.GetElapsedTime()).count();
+    }
 }
 
 /**
@@ -21,6 +21,7 @@
 #include <limits>
 #include <list>
 #include <memory>
+#include <type_traits>
 #include <variant>
 
 struct rct_drawpixelinfo;
@@ -658,6 +659,29 @@ extern colour_t gCurrentWindowColours[4];
 
 extern bool gDisableErrorWindowSound;
 
+// Draws the time each window took to draw on top of its title bar.
+extern bool gShowWindowDrawTimes;
+
+/**
+ * FNV-1a hash over the values shown by a window page. Windows compare it between updates so they only invalidate
+ * themselves when something they show has changed.
+ */
+struct WindowDataHash
+{
+    uint64_t Value = 14695981039346656037ULL;
+
+    template<typename T> WindowDataHash& Add(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            Value = (Value ^ bytes[i]) * 1099511628211ULL;
+        }
+        return *this;
+    }
+};
+
 std::list<std::shared_ptr<rct_window>>::iterator window_get_iterator(const rct_window* w);
 void window_visit_each(std::function<void(rct_window*)> func);
 
@@ -730,6 +754,7 @@ void window_invalidate_by_class(rct_windowclass cls);
 void window_invalidate_by_number(rct_windowclass cls, rct_windownumber number);
 void window_invalidate_by_number(rct_windowclass cls, EntityId id);
 void window_invalidate_all();
+bool window_update_data_hash(rct_window* w, const WindowDataHash& hash);
 void widget_invalidate(rct_window* w, rct_widgetindex widgetIndex);
 void widget_invalidate_by_class(rct_windowclass cls, rct_widgetindex widgetIndex);
 void widget_invalidate_by_number(rct_windowclass cls, rct_windownumber number, rct_widgetindex widgetIndex);
@@ -102,6 +102,9 @@ struct rct_window
     colour_t colours[6]{};
     VisibilityCache visibility{};
     EntityId viewport_smart_follow_sprite{ EntityId::GetNull() }; // Handles setting viewport target sprite etc
+    uint64_t dataHash{};        // Hash of the data shown by the current page, see window_update_data_hash
+    float drawTime{};           // Milliseconds spent drawing the window during the current second
+    float drawTimeLastSecond{}; // Milliseconds spent drawing the window during the previous second
 
     void SetLocation(const CoordsXYZ& coords);
     void ScrollToViewport();
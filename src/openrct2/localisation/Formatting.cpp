@@ -9,10 +9,12 @@
 
 #include "Formatting.h"
 
+#include "../Context.h"
 #include "../config/Config.h"
 #include "../util/Util.h"
 #include "Formatter.h"
 #include "Localisation.h"
+#include "LocalisationService.h"
 #include "StringIds.h"
 
 #include <cmath>
@@ -80,9 +82,10 @@ namespace OpenRCT2
         return 0;
     }
 
-    FmtString::iterator::iterator(std::string_view s, size_t i)
+    FmtString::iterator::iterator(std::string_view s, size_t i, const token* t)
         : str(s)
         , index(i)
+        , tokens(t)
     {
         update();
     }
@@ -96,6 +99,12 @@ namespace OpenRCT2
             return;
         }
 
+        if (tokens != nullptr)
+        {
+            current = tokens[tokenIndex];
+            return;
+        }
+
         if (str[i] == '\n' || str[i] == '\r')
         {
             i++;
@@ -207,6 +216,7 @@ namespace OpenRCT2
         if (index < str.size())
         {
             index += current.text.size();
+            tokenIndex++;
             update();
         }
         return *this;
@@ -218,6 +228,7 @@ namespace OpenRCT2
         if (index < str.size())
         {
             index += current.text.size();
+            tokenIndex++;
             update();
         }
         return result;
@@ -244,9 +255,15 @@ namespace OpenRCT2
     {
     }
 
+    FmtString::FmtString(std::string_view s, const token* tokens)
+        : _str(s)
+        , _tokens(tokens)
+    {
+    }
+
     FmtString::iterator FmtString::begin() const
     {
-        return iterator(_str, 0);
+        return iterator(_str, 0, _tokens);
     }
 
     FmtString::iterator FmtString::end() const
@@ -254,6 +271,14 @@ namespace OpenRCT2
         return iterator(_str, _str.size());
     }
 
+    void FmtString::Tokenise(std::string_view s, std::vector<token>& tokens)
+    {
+        for (const auto& t : FmtString(s))
+        {
+            tokens.push_back(t);
+        }
+    }
+
     std::string FmtString::WithoutFormatTokens() const
     {
         std::string result;
@@ -629,8 +654,8 @@ namespace OpenRCT2
 
     FmtString GetFmtStringById(rct_string_id id)
     {
-        auto fmtc = language_get_string(id);
-        return FmtString(fmtc);
+        auto& localisationService = GetContext()->GetLocalisationService();
+        return localisationService.GetFmtString(id);
     }
 
     FormatBuffer& GetThreadFormatStream()
@@ -13,9 +13,9 @@
 #include "FormatCodes.h"
 #include "Language.h"
 
+#include <array>
 #include <cstring>
 #include <sstream>
-#include <stack>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -171,13 +171,17 @@ namespace OpenRCT2
         {
         private:
             std::string_view str;
-            size_t index;
+            size_t index{};
             token current;
+            // The tokens of str when it has been tokenised in advance, which saves parsing it again.
+            const token* tokens{};
+            size_t tokenIndex{};
 
             void update();
 
         public:
-            iterator(std::string_view s, size_t i);
+            iterator() = default;
+            iterator(std::string_view s, size_t i, const token* t = nullptr);
             bool operator==(iterator& rhs);
             bool operator!=(iterator& rhs);
             token CreateToken(size_t len);
@@ -188,14 +192,56 @@ namespace OpenRCT2
             bool eol() const;
         };
 
+    private:
+        const token* _tokens{};
+
+    public:
+
         FmtString() = default;
         FmtString(std::string&& s);
         FmtString(std::string_view s);
         FmtString(const char* s);
+        // tokens must hold the tokens of s in order, as produced by Tokenise.
+        FmtString(std::string_view s, const token* tokens);
         iterator begin() const;
         iterator end() const;
 
         std::string WithoutFormatTokens() const;
+
+        static void Tokenise(std::string_view s, std::vector<token>& tokens);
+    };
+
+    /**
+     * The nested string ids that are being formatted, the innermost on top. Formatting happens thousands of times per
+     * frame so this does not allocate, string ids are only ever nested a few levels deep.
+     */
+    class FmtStringStack
+    {
+    private:
+        static constexpr size_t Capacity = 16;
+        std::array<FmtString::iterator, Capacity> _items;
+        size_t _size{};
+
+    public:
+        bool empty() const
+        {
+            return _size == 0;
+        }
+        FmtString::iterator& top()
+        {
+            return _items[_size - 1];
+        }
+        void push(const FmtString::iterator& it)
+        {
+            if (_size < Capacity)
+            {
+                _items[_size++] = it;
+            }
+        }
+        void pop()
+        {
+            _size--;
+        }
     };
 
     template<typename T> void FormatArgument(FormatBuffer& ss, FormatToken token, T arg);
@@ -206,7 +252,7 @@ namespace OpenRCT2
     FormatBuffer& GetThreadFormatStream();
     size_t CopyStringStreamToBuffer(char* buffer, size_t bufferLen, FormatBuffer& ss);
 
-    inline void FormatString(FormatBuffer& ss, std::stack<FmtString::iterator>& stack)
+    inline void FormatString(FormatBuffer& ss, FmtStringStack& stack)
     {
         while (!stack.empty())
         {
@@ -225,7 +271,7 @@ namespace OpenRCT2
     }
 
     template<typename TArg0, typename... TArgs>
-    static void FormatString(FormatBuffer& ss, std::stack<FmtString::iterator>& stack, TArg0 arg0, TArgs&&... argN)
+    static void FormatString(FormatBuffer& ss, FmtStringStack& stack, TArg0 arg0, TArgs&&... argN)
     {
         while (!stack.empty())
         {
@@ -264,7 +310,7 @@ namespace OpenRCT2
 
     template<typename... TArgs> static void FormatString(FormatBuffer& ss, const FmtString& fmt, TArgs&&... argN)
     {
-        std::stack<FmtString::iterator> stack;
+        FmtStringStack stack;
         stack.push(fmt.begin());
         FormatString(ss, stack, argN...);
     }
@@ -9,18 +9,24 @@
 
 #include "LanguagePack.h"
 
+#include "../Version.h"
 #include "../common.h"
+#include "../core/DataSerialiser.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/Memory.hpp"
+#include "../core/Path.hpp"
 #include "../core/RTL.h"
 #include "../core/String.hpp"
 #include "../core/StringBuilder.h"
 #include "../core/StringReader.h"
+#include "Formatting.h"
 #include "Language.h"
 #include "Localisation.h"
 
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -35,6 +41,10 @@ constexpr int32_t ObjectOverrideMaxStringCount = 3;
 constexpr rct_string_id ScenarioOverrideBase = 0x7000;
 constexpr int32_t ScenarioOverrideMaxStringCount = 3;
 
+constexpr uint32_t LanguageCacheMagicNumber = 0x434E4C4F; // OLNC
+// Increment this when the parsing or the layout below changes, to discard the existing caches.
+constexpr uint32_t LanguageCacheVersion = 1;
+
 struct ObjectOverride
 {
     char name[8] = { 0 };
@@ -52,6 +62,9 @@ class LanguagePack final : public ILanguagePack
 private:
     uint16_t const _id;
     std::vector<std::string> _strings;
+    // The strings are tokenised once when the pack is loaded, _tokenOffsets holds the index of each string's first token.
+    std::vector<OpenRCT2::FmtString::token> _tokens;
+    std::vector<uint32_t> _tokenOffsets;
     std::vector<ObjectOverride> _objectOverrides;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
@@ -102,6 +115,30 @@ public:
         return std::make_unique<LanguagePack>(id, text);
     }
 
+    static std::unique_ptr<LanguagePack> FromFile(uint16_t id, const utf8* path, const std::string& cachePath)
+    {
+        Guard::ArgumentNotNull(path);
+
+        auto sourceSize = File::GetSize(path);
+        auto sourceLastModified = File::GetLastModified(path);
+        auto result = FromCache(id, cachePath, sourceSize, sourceLastModified);
+        if (result == nullptr)
+        {
+            // The cache is written before any string is replaced, so the tokens of each string follow each other.
+            result = FromFile(id, path);
+            if (result != nullptr)
+            {
+                result->WriteCache(cachePath, sourceSize, sourceLastModified);
+            }
+        }
+        return result;
+    }
+
+    explicit LanguagePack(uint16_t id)
+        : _id(id)
+    {
+    }
+
     LanguagePack(uint16_t id, const utf8* text)
         : _id(id)
     {
@@ -117,6 +154,13 @@ public:
         _currentGroup = std::string();
         _currentObjectOverride = nullptr;
         _currentScenarioOverride = nullptr;
+
+        // The tokens refer to the strings, which must not move from here on.
+        _tokenOffsets.resize(_strings.size());
+        for (size_t i = 0; i < _strings.size(); i++)
+        {
+            TokeniseString(i);
+        }
     }
 
     uint16_t GetId() const override
@@ -134,6 +178,7 @@ public:
         if (_strings.size() > static_cast<size_t>(stringId))
         {
             _strings[stringId] = std::string();
+            TokeniseString(stringId);
         }
     }
 
@@ -142,6 +187,7 @@ public:
         if (_strings.size() > static_cast<size_t>(stringId))
         {
             _strings[stringId] = str;
+            TokeniseString(stringId);
         }
     }
 
@@ -185,6 +231,15 @@ public:
         return nullptr;
     }
 
+    const OpenRCT2::FmtString::token* GetStringTokens(rct_string_id stringId) const override
+    {
+        if (stringId < ObjectOverrideBase && _strings.size() > static_cast<size_t>(stringId) && !_strings[stringId].empty())
+        {
+            return &_tokens[_tokenOffsets[stringId]];
+        }
+        return nullptr;
+    }
+
     rct_string_id GetObjectOverrideStringId(std::string_view legacyIdentifier, uint8_t index) override
     {
         Guard::Assert(index < ObjectOverrideMaxStringCount);
@@ -229,6 +284,180 @@ public:
     }
 
 private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Cache
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The parsed strings, overrides and string tokens are written to a binary cache next to the other indexes. Loading it
+    // skips parsing and tokenising, the cache is discarded when the language file or the game version changes.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static bool SerialiseCacheHeader(DataSerialiser& ds, uint16_t id, uint64_t sourceSize, uint64_t sourceLastModified)
+    {
+        uint32_t magicNumber = LanguageCacheMagicNumber;
+        uint32_t version = LanguageCacheVersion;
+        std::string gameVersion = gVersionInfoFull;
+        uint16_t languageId = id;
+        uint64_t size = sourceSize;
+        uint64_t lastModified = sourceLastModified;
+        ds << magicNumber;
+        ds << version;
+        ds << gameVersion;
+        ds << languageId;
+        ds << size;
+        ds << lastModified;
+        return magicNumber == LanguageCacheMagicNumber && version == LanguageCacheVersion && gameVersion == gVersionInfoFull
+            && languageId == id && size == sourceSize && lastModified == sourceLastModified;
+    }
+
+    static std::unique_ptr<LanguagePack> FromCache(
+        uint16_t id, const std::string& cachePath, uint64_t sourceSize, uint64_t sourceLastModified)
+    {
+        if (cachePath.empty() || !File::Exists(cachePath))
+        {
+            return nullptr;
+        }
+
+        try
+        {
+            OpenRCT2::FileStream fs(cachePath, OpenRCT2::FILE_MODE_OPEN);
+            DataSerialiser ds(false, fs);
+            if (!SerialiseCacheHeader(ds, id, sourceSize, sourceLastModified))
+            {
+                log_verbose("Language cache '%s' is out of date", cachePath.c_str());
+                return nullptr;
+            }
+
+            auto result = std::make_unique<LanguagePack>(id);
+            result->SerialiseCache(ds);
+            return result;
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("Unable to load language cache '%s': %s", cachePath.c_str(), e.what());
+            return nullptr;
+        }
+    }
+
+    void WriteCache(const std::string& cachePath, uint64_t sourceSize, uint64_t sourceLastModified)
+    {
+        if (cachePath.empty())
+        {
+            return;
+        }
+
+        // Several instances can share the cache directory, so write to a file of our own and move it into place.
+        auto tempPath = cachePath + "." + std::to_string(std::random_device{}()) + ".tmp";
+        try
+        {
+            Path::CreateDirectory(Path::GetDirectory(cachePath));
+            {
+                OpenRCT2::FileStream fs(tempPath, OpenRCT2::FILE_MODE_WRITE);
+                DataSerialiser ds(true, fs);
+                SerialiseCacheHeader(ds, _id, sourceSize, sourceLastModified);
+                SerialiseCache(ds);
+            }
+            if (!File::Move(tempPath, cachePath))
+            {
+                throw std::runtime_error("Unable to move the cache into place.");
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log_warning("Unable to save language cache '%s': %s", cachePath.c_str(), e.what());
+            File::Delete(tempPath);
+        }
+    }
+
+    void SerialiseCache(DataSerialiser& ds)
+    {
+        ds << _strings;
+
+        uint32_t objectOverrideCount = static_cast<uint32_t>(_objectOverrides.size());
+        ds << objectOverrideCount;
+        _objectOverrides.resize(objectOverrideCount);
+        for (auto& objectOverride : _objectOverrides)
+        {
+            auto name = std::string(objectOverride.name, std::size(objectOverride.name));
+            ds << name;
+            std::copy_n(name.c_str(), std::min(name.size(), std::size(objectOverride.name)), objectOverride.name);
+            for (auto& str : objectOverride.strings)
+            {
+                ds << str;
+            }
+        }
+
+        uint32_t scenarioOverrideCount = static_cast<uint32_t>(_scenarioOverrides.size());
+        ds << scenarioOverrideCount;
+        _scenarioOverrides.resize(scenarioOverrideCount);
+        for (auto& scenarioOverride : _scenarioOverrides)
+        {
+            ds << scenarioOverride.filename;
+            for (auto& str : scenarioOverride.strings)
+            {
+                ds << str;
+            }
+        }
+
+        // Each token is stored as its kind, length and parameter, the text is the next part of the string.
+        std::vector<uint32_t> tokenCounts;
+        std::vector<uint8_t> tokenKinds;
+        std::vector<uint32_t> tokenLengths;
+        std::vector<uint32_t> tokenParameters;
+        if (ds.IsSaving())
+        {
+            for (size_t i = 0; i < _strings.size(); i++)
+            {
+                auto end = i + 1 < _strings.size() ? _tokenOffsets[i + 1] : _tokens.size();
+                tokenCounts.push_back(static_cast<uint32_t>(end - _tokenOffsets[i]));
+            }
+            for (const auto& token : _tokens)
+            {
+                tokenKinds.push_back(static_cast<uint8_t>(token.kind));
+                tokenLengths.push_back(static_cast<uint32_t>(token.text.size()));
+                tokenParameters.push_back(token.parameter);
+            }
+        }
+        ds << tokenCounts;
+        ds << tokenKinds;
+        ds << tokenLengths;
+        ds << tokenParameters;
+
+        if (ds.IsLoading())
+        {
+            if (tokenCounts.size() != _strings.size() || tokenLengths.size() != tokenKinds.size()
+                || tokenParameters.size() != tokenKinds.size())
+            {
+                throw std::runtime_error("Malformed string tokens.");
+            }
+
+            _tokens.reserve(tokenKinds.size());
+            _tokenOffsets.resize(_strings.size());
+            size_t tokenIndex = 0;
+            for (size_t i = 0; i < _strings.size(); i++)
+            {
+                const std::string_view str = _strings[i];
+                if (tokenIndex + tokenCounts[i] > tokenKinds.size())
+                {
+                    throw std::runtime_error("Malformed string tokens.");
+                }
+
+                _tokenOffsets[i] = static_cast<uint32_t>(_tokens.size());
+                size_t position = 0;
+                for (uint32_t n = 0; n < tokenCounts[i]; n++, tokenIndex++)
+                {
+                    auto text = str.substr(position, tokenLengths[tokenIndex]);
+                    position += text.size();
+                    _tokens.emplace_back(
+                        static_cast<FormatToken>(tokenKinds[tokenIndex]), text, tokenParameters[tokenIndex]);
+                }
+                if (position != str.size())
+                {
+                    throw std::runtime_error("Malformed string tokens.");
+                }
+            }
+        }
+    }
+
     ObjectOverride* GetObjectOverride(const std::string& objectIdentifier)
     {
         for (auto& oo : _objectOverrides)
@@ -326,6 +555,13 @@ private:
         }
     }
 
+    void TokeniseString(size_t index)
+    {
+        // Replaced strings leave their old tokens behind, which is fine as strings are rarely replaced.
+        _tokenOffsets[index] = static_cast<uint32_t>(_tokens.size());
+        OpenRCT2::FmtString::Tokenise(_strings[index], _tokens);
+    }
+
     void ParseLine(IStringReader* reader)
     {
         SkipWhitespace(reader);
@@ -580,6 +816,12 @@ namespace LanguagePackFactory
         return languagePack;
     }
 
+    std::unique_ptr<ILanguagePack> FromFile(uint16_t id, const utf8* path, const std::string& cachePath)
+    {
+        auto languagePack = LanguagePack::FromFile(id, path, cachePath);
+        return languagePack;
+    }
+
     std::unique_ptr<ILanguagePack> FromText(uint16_t id, const utf8* text)
     {
         auto languagePack = LanguagePack::FromText(id, text);
@@ -11,6 +11,7 @@
 
 #include "../common.h"
 #include "../core/String.hpp"
+#include "Formatting.h"
 
 #include <memory>
 #include <string>
@@ -26,6 +27,8 @@ struct ILanguagePack
     virtual void RemoveString(rct_string_id stringId) abstract;
     virtual void SetString(rct_string_id stringId, const std::string& str) abstract;
     virtual const utf8* GetString(rct_string_id stringId) const abstract;
+    // Returns the pre-parsed tokens of the string, or nullptr if the string has not been tokenised.
+    virtual const OpenRCT2::FmtString::token* GetStringTokens(rct_string_id stringId) const abstract;
     virtual rct_string_id GetObjectOverrideStringId(std::string_view legacyIdentifier, uint8_t index) abstract;
     virtual rct_string_id GetScenarioOverrideStringId(const utf8* scenarioFilename, uint8_t index) abstract;
 };
@@ -33,5 +36,10 @@ struct ILanguagePack
 namespace LanguagePackFactory
 {
     std::unique_ptr<ILanguagePack> FromFile(uint16_t id, const utf8* path);
+    /**
+     * Loads the language from its compiled cache if it is up to date with the file, otherwise parses the file and
+     * writes the cache for the next time.
+     */
+    std::unique_ptr<ILanguagePack> FromFile(uint16_t id, const utf8* path, const std::string& cachePath);
     std::unique_ptr<ILanguagePack> FromText(uint16_t id, const utf8* text);
 } // namespace LanguagePackFactory
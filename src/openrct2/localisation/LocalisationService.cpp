@@ -76,6 +76,27 @@ const char* LocalisationService::GetString(rct_string_id id) const
     return result;
 }
 
+FmtString LocalisationService::GetFmtString(rct_string_id id) const
+{
+    // Language strings come with their tokens, everything else is parsed as it is formatted.
+    auto isObjectString = id >= BASE_OBJECT_STRING_ID && id < BASE_OBJECT_STRING_ID + MAX_OBJECT_CACHED_STRINGS;
+    if (id != STR_EMPTY && id != STR_NONE && !isObjectString)
+    {
+        for (const auto* languagePack : { _languageCurrent.get(), _languageFallback.get() })
+        {
+            if (languagePack != nullptr)
+            {
+                auto str = languagePack->GetString(id);
+                if (str != nullptr)
+                {
+                    return FmtString(str, languagePack->GetStringTokens(id));
+                }
+            }
+        }
+    }
+    return FmtString(GetString(id));
+}
+
 std::string LocalisationService::GetLanguagePath(uint32_t languageId) const
 {
     auto locale = std::string(LanguagesDescriptors[languageId].locale);
@@ -84,6 +105,17 @@ std::string LocalisationService::GetLanguagePath(uint32_t languageId) const
     return languagePath;
 }
 
+std::string LocalisationService::GetLanguageCachePath(uint32_t languageId) const
+{
+    auto cacheDirectory = _env->GetDirectoryPath(DIRBASE::CACHE);
+    if (cacheDirectory.empty())
+    {
+        return {};
+    }
+    auto locale = std::string(LanguagesDescriptors[languageId].locale);
+    return Path::Combine(cacheDirectory, u8"languages", locale + u8".bin");
+}
+
 void LocalisationService::OpenLanguage(int32_t id)
 {
     CloseLanguages();
@@ -96,11 +128,12 @@ void LocalisationService::OpenLanguage(int32_t id)
     if (id != LANGUAGE_ENGLISH_UK)
     {
         filename = GetLanguagePath(LANGUAGE_ENGLISH_UK);
-        _languageFallback = LanguagePackFactory::FromFile(LANGUAGE_ENGLISH_UK, filename.c_str());
+        _languageFallback = LanguagePackFactory::FromFile(
+            LANGUAGE_ENGLISH_UK, filename.c_str(), GetLanguageCachePath(LANGUAGE_ENGLISH_UK));
     }
 
     filename = GetLanguagePath(id);
-    _languageCurrent = LanguagePackFactory::FromFile(id, filename.c_str());
+    _languageCurrent = LanguagePackFactory::FromFile(id, filename.c_str(), GetLanguageCachePath(id));
     if (_languageCurrent != nullptr)
     {
         _currentLanguage = id;
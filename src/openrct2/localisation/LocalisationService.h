@@ -10,6 +10,7 @@
 #pragma once
 
 #include "../common.h"
+#include "Formatting.h"
 
 #include <memory>
 #include <stack>
@@ -57,10 +58,12 @@ namespace OpenRCT2::Localisation
         ~LocalisationService();
 
         const char* GetString(rct_string_id id) const;
+        FmtString GetFmtString(rct_string_id id) const;
         std::tuple<rct_string_id, rct_string_id, rct_string_id> GetLocalisedScenarioStrings(
             const std::string& scenarioFilename) const;
         rct_string_id GetObjectOverrideStringId(std::string_view legacyIdentifier, uint8_t index) const;
         std::string GetLanguagePath(uint32_t languageId) const;
+        std::string GetLanguageCachePath(uint32_t languageId) const;
 
         void OpenLanguage(int32_t id);
         void CloseLanguages();
@@ -633,6 +633,32 @@ bool scenery_group_is_invented(int32_t sgIndex)
         });
 }
 
+std::bitset<MAX_SCENERY_GROUP_OBJECTS> scenery_get_invented_groups()
+{
+    std::bitset<MAX_SCENERY_GROUP_OBJECTS> uninvented;
+    if (!(gScreenFlags & SCREEN_FLAGS_EDITOR) && !gCheatsIgnoreResearchStatus)
+    {
+        for (const auto& item : gResearchItemsUninvented)
+        {
+            if (item.type == Research::EntryType::Scenery && item.entryIndex < MAX_SCENERY_GROUP_OBJECTS)
+            {
+                uninvented.set(item.entryIndex);
+            }
+        }
+    }
+
+    std::bitset<MAX_SCENERY_GROUP_OBJECTS> invented;
+    for (ObjectEntryIndex i = 0; i < MAX_SCENERY_GROUP_OBJECTS; i++)
+    {
+        const auto sgEntry = get_scenery_group_entry(i);
+        if (sgEntry != nullptr && !sgEntry->SceneryEntries.empty() && !uninvented[i])
+        {
+            invented.set(i);
+        }
+    }
+    return invented;
+}
+
 void scenery_group_set_invented(int32_t sgIndex)
 {
     const auto sgEntry = get_scenery_group_entry(sgIndex);
@@ -14,6 +14,7 @@
 #include "../object/ObjectLimits.h"
 #include "../util/Util.h"
 
+#include <bitset>
 #include <optional>
 
 struct rct_ride_entry;
@@ -144,6 +145,8 @@ void scenery_set_not_invented(const ScenerySelection& sceneryItem);
 bool ride_type_is_invented(uint32_t rideType);
 bool ride_entry_is_invented(ObjectEntryIndex rideEntryIndex);
 bool scenery_group_is_invented(int32_t sgIndex);
+// Same as scenery_group_is_invented for every scenery group, with a single pass over the research list.
+std::bitset<MAX_SCENERY_GROUP_OBJECTS> scenery_get_invented_groups();
 void scenery_group_set_invented(int32_t sgIndex);
 bool scenery_is_invented(const ScenerySelection& sceneryItem);
 void set_all_scenery_items_invented();
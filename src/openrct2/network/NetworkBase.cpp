@@ -42,7 +42,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "24"
+#define NETWORK_STREAM_VERSION "30"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static Peep* _pickup_peep = nullptr;
@@ -58,13 +58,26 @@ static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t MaxPacketsPerUpdate = 100;
 
+// How often the server metrics file is rewritten, in milliseconds.
+static constexpr uint32_t NetworkMetricsInterval = 10000;
+
+// How many ticks the server keeps for reconnecting clients to catch up with, 30 seconds.
+static constexpr uint32_t CatchUpHistoryTicks = GAME_UPDATE_FPS * 30;
+
+// Ping lists only carry the pings that changed by at least this many milliseconds, except for every
+// PingListFullRefreshInterval-th one which carries all of them.
+static constexpr uint16_t PingListMinChange = 10;
+static constexpr uint32_t PingListFullRefreshInterval = 10;
+
 #    include "../Cheats.h"
+#    include "../GameState.h"
 #    include "../ParkImporter.h"
 #    include "../Version.h"
 #    include "../actions/GameAction.h"
 #    include "../config/Config.h"
 #    include "../core/Console.hpp"
 #    include "../core/FileStream.h"
+#    include "../core/JobPool.h"
 #    include "../core/MemoryStream.h"
 #    include "../core/Path.hpp"
 #    include "../core/String.hpp"
@@ -74,9 +87,11 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 #    include "../localisation/Localisation.h"
 #    include "../object/ObjectManager.h"
 #    include "../object/ObjectRepository.h"
+#    include "../profiling/Profiling.h"
 #    include "../scenario/Scenario.h"
 #    include "../util/Util.h"
 #    include "../world/Park.h"
+#    include "../world/Scenery.h"
 #    include "NetworkAction.h"
 #    include "NetworkConnection.h"
 #    include "NetworkGroup.h"
@@ -135,6 +150,8 @@ NetworkBase::NetworkBase(OpenRCT2::IContext& context)
     client_command_handlers[NetworkCommand::ObjectsList] = &NetworkBase::Client_Handle_OBJECTS_LIST;
     client_command_handlers[NetworkCommand::Scripts] = &NetworkBase::Client_Handle_SCRIPTS;
     client_command_handlers[NetworkCommand::GameState] = &NetworkBase::Client_Handle_GAMESTATE;
+    client_command_handlers[NetworkCommand::CatchUp] = &NetworkBase::Client_Handle_CATCHUP;
+    client_command_handlers[NetworkCommand::PlayerListUpdate] = &NetworkBase::Client_Handle_PLAYERLISTUPDATE;
 
     server_command_handlers[NetworkCommand::Auth] = &NetworkBase::Server_Handle_AUTH;
     server_command_handlers[NetworkCommand::Chat] = &NetworkBase::Server_Handle_CHAT;
@@ -174,7 +191,16 @@ void NetworkBase::Reconnect()
         _requireReconnect = true;
         return;
     }
+
+    auto catchUpState = std::move(_catchUpState);
     BeginClient(_host, _port);
+
+    // Only a park that has not been updated since the connection was lost can catch up with the server.
+    if (catchUpState.has_value() && catchUpState->tick == gCurrentTicks
+        && catchUpState->srand0 == scenario_rand_state().s0)
+    {
+        _catchUpState = std::move(catchUpState);
+    }
 }
 
 void NetworkBase::Close()
@@ -197,11 +223,20 @@ void NetworkBase::Close()
         client_connection_list.clear();
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
+        scenery_clear_speculative_placements(true);
         player_list.clear();
         group_list.clear();
         _serverTickData.clear();
         _pendingPlayerLists.clear();
         _pendingPlayerInfo.clear();
+        _gameActionBatch.Clear();
+        _gameActionBatchCount = 0;
+        _catchUpTicks.clear();
+        _catchUpPackets.clear();
+        _catchUpPlayerLists.clear();
+        _addedPlayerIds.clear();
+        _removedPlayerIds.clear();
+        _sentPings.fill(0);
 
 #    ifdef ENABLE_SCRIPTING
         auto& scriptEngine = GetContext().GetScriptEngine();
@@ -272,6 +307,8 @@ bool NetworkBase::BeginClient(const std::string& host, uint16_t port)
     _lastConnectStatus = SocketStatus::Closed;
     _clientMapLoaded = false;
     _serverTickData.clear();
+    _catchUpState.reset();
+    _verifiedSpriteHash.clear();
 
     BeginChatLog();
     BeginServerLog();
@@ -492,6 +529,8 @@ void NetworkBase::Update()
 
 void NetworkBase::Flush()
 {
+    SendGameActionBatch();
+
     if (GetMode() == NETWORK_MODE_CLIENT)
     {
         _serverConnection->SendQueuedPackets();
@@ -505,24 +544,93 @@ void NetworkBase::Flush()
     }
 }
 
+void NetworkBase::AddToGameActionBatch(const GameAction& action)
+{
+    // Each batch carries the actions of one tick.
+    if (_gameActionBatchCount != 0 && _gameActionBatchTick != gCurrentTicks)
+    {
+        SendGameActionBatch();
+    }
+
+    DataSerialiser stream(true);
+    action.Serialise(stream);
+
+    _gameActionBatchTick = gCurrentTicks;
+    _gameActionBatchCount++;
+    _gameActionBatch << action.GetType() << static_cast<uint32_t>(stream.GetStream().GetLength()) << stream;
+}
+
+void NetworkBase::SendGameActionBatch()
+{
+    if (_gameActionBatchCount == 0)
+    {
+        return;
+    }
+
+    NetworkPacket packet(NetworkCommand::GameAction);
+    packet << _gameActionBatchTick << _gameActionBatchCount;
+    packet.Write(_gameActionBatch.GetData(), _gameActionBatch.Data.size());
+
+    _gameActionBatch.Clear();
+    _gameActionBatchCount = 0;
+
+    if (GetMode() == NETWORK_MODE_CLIENT)
+    {
+        _serverConnection->QueuePacket(std::move(packet));
+    }
+    else
+    {
+        const NetworkOutboundPacket outboundPacket(packet);
+        RecordCatchUpPacket(_gameActionBatchTick, outboundPacket);
+        SendPacketToClients(outboundPacket);
+    }
+}
+
 void NetworkBase::UpdateServer()
 {
+    // Find the sockets that have anything to read up front, rather than trying to read from every connection.
+    std::vector<const ITcpSocket*> sockets;
+    sockets.reserve(client_connection_list.size() + 1);
     for (auto& connection : client_connection_list)
     {
+        sockets.push_back(connection->Socket.get());
+    }
+    sockets.push_back(_listenSocket.get());
+    const auto readySockets = GetReadyTcpSockets(sockets);
+
+    // The game state does not advance while the connections are processed, so clients joining together can share the
+    // same map export.
+    _shareMapExports = true;
+
+    size_t connectionIndex = 0;
+    for (auto& connection : client_connection_list)
+    {
+        const bool hasData = readySockets[connectionIndex++];
+
         // This can be called multiple times before the connection is removed.
         if (!connection->IsValid())
             continue;
 
-        if (!ProcessConnection(*connection))
+        if (!ProcessConnection(*connection, hasData))
         {
             connection->Disconnect();
         }
         else
         {
+            Server_Process_PendingAuth(*connection);
             DecayCooldown(connection->Player);
         }
     }
 
+    // Releases the finished verification tasks, the pool does not reuse them until it is joined.
+    if (_authJobs.CountPending() == 0)
+    {
+        _authJobs.Join();
+    }
+
+    _shareMapExports = false;
+    _mapExports.clear();
+
     uint32_t ticks = Platform::GetTicks();
     if (ticks > last_ping_sent_time + 3000)
     {
@@ -530,15 +638,24 @@ void NetworkBase::UpdateServer()
         Server_Send_PINGLIST();
     }
 
+    if (gConfigNetwork.log_server_metrics && ticks - _lastMetricsTime >= NetworkMetricsInterval)
+    {
+        _lastMetricsTime = ticks;
+        WriteServerMetrics();
+    }
+
     if (_advertiser != nullptr)
     {
         _advertiser->Update();
     }
 
-    std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
-    if (tcpSocket != nullptr)
+    if (readySockets.back())
     {
-        AddClient(std::move(tcpSocket));
+        std::unique_ptr<ITcpSocket> tcpSocket = _listenSocket->Accept();
+        if (tcpSocket != nullptr)
+        {
+            AddClient(std::move(tcpSocket));
+        }
     }
 }
 
@@ -641,6 +758,19 @@ void NetworkBase::UpdateClient()
                     intent.putExtra(INTENT_EXTRA_MESSAGE, std::string{ str_disconnected });
                     context_open_intent(&intent);
                 }
+                // Keep what the server needs to let the park catch up on reconnect. The park is paused so that it
+                // stays at the tick the connection was lost at.
+                if (_clientMapLoaded && !IsDesynchronised() && !_verifiedSpriteHash.empty())
+                {
+                    const bool pausePark = (gGamePaused & GAME_PAUSED_NORMAL) == 0;
+                    if (pausePark)
+                    {
+                        pause_toggle();
+                    }
+                    _catchUpState = CatchUpState{
+                        gCurrentTicks, scenario_rand_state().s0, _verifiedTick, _verifiedSpriteHash, pausePark,
+                    };
+                }
                 window_close_by_class(WC_MULTIPLAYER);
                 Close();
             }
@@ -709,6 +839,12 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromplayer, const char* text)
 }
 
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd) const
+{
+    // Serialise the packet once, all send queues share its buffer.
+    SendPacketToClients(NetworkOutboundPacket(packet), front, gameCmd);
+}
+
+void NetworkBase::SendPacketToClients(const NetworkOutboundPacket& outboundPacket, bool front, bool gameCmd) const
 {
     for (auto& client_connection : client_connection_list)
     {
@@ -723,7 +859,7 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
                 continue;
             }
         }
-        client_connection->QueuePacket(packet, front);
+        client_connection->QueuePacket(outboundPacket, front);
     }
 }
 
@@ -755,6 +891,8 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
             log_info("Sprite hash mismatch, client = %s, server = %s", clientSpriteHash.c_str(), storedTick.spriteHash.c_str());
             return false;
         }
+        _verifiedTick = tick;
+        _verifiedSpriteHash = std::move(clientSpriteHash);
     }
 
     return true;
@@ -1161,6 +1299,202 @@ void NetworkBase::CloseServerLog()
     _server_log_fs.close();
 }
 
+static void AppendMetric(std::string& out, const char* name, std::string_view labels, double value)
+{
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), " %.17g\n", value);
+    out += name;
+    out += labels;
+    out += buffer;
+}
+
+static void AppendMetricHeader(std::string& out, const char* name, const char* type, const char* help)
+{
+    out += "# HELP ";
+    out += name;
+    out += ' ';
+    out += help;
+    out += "\n# TYPE ";
+    out += name;
+    out += ' ';
+    out += type;
+    out += '\n';
+}
+
+static void AppendMetricHistogram(
+    std::string& out, const char* name, const char* help, const TickScheduleStats::Histogram& histogram, double sum)
+{
+    AppendMetricHeader(out, name, "histogram", help);
+    const std::string bucketName = std::string(name) + "_bucket";
+    uint64_t count = 0;
+    for (size_t i = 0; i < histogram.size(); i++)
+    {
+        count += histogram[i];
+        char bound[32];
+        if (i < TickScheduleStats::BucketBounds.size())
+        {
+            snprintf(bound, sizeof(bound), "{le=\"%g\"}", TickScheduleStats::BucketBounds[i]);
+        }
+        else
+        {
+            snprintf(bound, sizeof(bound), "{le=\"+Inf\"}");
+        }
+        AppendMetric(out, bucketName.c_str(), bound, static_cast<double>(count));
+    }
+    AppendMetric(out, (std::string(name) + "_sum").c_str(), {}, sum);
+    AppendMetric(out, (std::string(name) + "_count").c_str(), {}, static_cast<double>(count));
+}
+
+static std::string GetMetricLabel(const char* label, std::string_view value)
+{
+    std::string result = "{";
+    result += label;
+    result += "=\"";
+    for (auto ch : value)
+    {
+        if (ch == '\\' || ch == '"')
+        {
+            result += '\\';
+        }
+        result += ch;
+    }
+    result += "\"}";
+    return result;
+}
+
+/**
+ * Writes the server metrics in the Prometheus text format to metrics.prom in the server log directory. The file is
+ * replaced as a whole so it can be picked up by a textfile collector at any time.
+ */
+void NetworkBase::WriteServerMetrics()
+{
+    static constexpr const char* EntityTypeNames[] = {
+        "vehicle",
+        "guest",
+        "staff",
+        "litter",
+        "steam_particle",
+        "money_effect",
+        "crashed_vehicle_particle",
+        "explosion_cloud",
+        "crash_splash",
+        "explosion_flare",
+        "jumping_fountain",
+        "balloon",
+        "duck",
+    };
+    static_assert(std::size(EntityTypeNames) == EnumValue(EntityType::Count));
+    static constexpr const char* StatisticsGroupNames[] = { "total", "base", "commands", "map_data" };
+    static_assert(std::size(StatisticsGroupNames) == EnumValue(NetworkStatisticsGroup::Max));
+
+    std::string out;
+
+    const auto& timings = GetContext().GetGameState()->GetLogicTimings();
+    const auto samples = static_cast<size_t>(std::min<uint64_t>(timings.Ticks, LOGIC_UPDATE_MEASUREMENTS_COUNT));
+    AppendMetricHeader(
+        out, "openrct2_tick_phase_seconds", "gauge", "Average time spent in each phase of the most recent game ticks.");
+    for (const auto& [part, partName] : LogicTimePartNames)
+    {
+        if (timings.TimingInfo.find(part) == timings.TimingInfo.end() || samples == 0)
+        {
+            continue;
+        }
+        double total = 0;
+        for (size_t i = 0; i < samples; i++)
+        {
+            total += timings.GetPartTime(part, i).count();
+        }
+        AppendMetric(out, "openrct2_tick_phase_seconds", GetMetricLabel("phase", partName), total / samples);
+    }
+    AppendMetricHeader(out, "openrct2_ticks_total", "counter", "Game ticks run since the server started.");
+    AppendMetric(out, "openrct2_ticks_total", {}, static_cast<double>(timings.Ticks));
+    AppendMetricHeader(out, "openrct2_tick_overruns_total", "counter", "Game ticks that took longer than a tick interval.");
+    AppendMetric(out, "openrct2_tick_overruns_total", {}, static_cast<double>(timings.Overruns));
+
+    const auto& schedule = GetContext().GetTickScheduleStats();
+    AppendMetricHistogram(
+        out, "openrct2_tick_latency_seconds", "How long after their scheduled time the game ticks started.",
+        schedule.Latency, schedule.LatencySum);
+    AppendMetricHistogram(
+        out, "openrct2_tick_jitter_seconds", "Deviation of the time between two tick starts from the update interval.",
+        schedule.Jitter, schedule.JitterSum);
+    AppendMetricHeader(
+        out, "openrct2_ticks_dropped_total", "counter", "Game ticks given up because the server fell too far behind.");
+    AppendMetric(out, "openrct2_ticks_dropped_total", {}, static_cast<double>(schedule.DroppedTicks));
+
+    AppendMetricHeader(out, "openrct2_entities", "gauge", "Number of entities of each type.");
+    for (size_t i = 0; i < std::size(EntityTypeNames); i++)
+    {
+        auto count = GetEntityListCount(static_cast<EntityType>(i));
+        AppendMetric(out, "openrct2_entities", GetMetricLabel("type", EntityTypeNames[i]), count);
+    }
+
+    AppendMetricHeader(out, "openrct2_players", "gauge", "Number of players including the host.");
+    AppendMetric(out, "openrct2_players", {}, static_cast<double>(player_list.size()));
+    AppendMetricHeader(out, "openrct2_game_actions_queued", "gauge", "Game actions waiting to be executed.");
+    AppendMetric(out, "openrct2_game_actions_queued", {}, static_cast<double>(GameActions::GetQueueSize()));
+
+    const auto workerStats = JobPool::GetWorkerStats();
+    AppendMetricHeader(out, "openrct2_worker_threads", "gauge", "Number of shared worker threads.");
+    AppendMetric(out, "openrct2_worker_threads", {}, static_cast<double>(workerStats.Workers));
+    AppendMetricHeader(out, "openrct2_worker_jobs_total", "counter", "Jobs run by the shared worker threads.");
+    AppendMetric(out, "openrct2_worker_jobs_total", {}, static_cast<double>(workerStats.JobsRun));
+    AppendMetricHeader(
+        out, "openrct2_worker_busy_seconds_total", "counter", "Time the shared worker threads spent running jobs.");
+    AppendMetric(out, "openrct2_worker_busy_seconds_total", {}, workerStats.BusySeconds);
+
+    const auto stats = GetStats();
+    AppendMetricHeader(out, "openrct2_network_received_bytes_total", "counter", "Bytes received from the connected clients.");
+    for (size_t i = 0; i < std::size(StatisticsGroupNames); i++)
+    {
+        auto label = GetMetricLabel("group", StatisticsGroupNames[i]);
+        AppendMetric(out, "openrct2_network_received_bytes_total", label, static_cast<double>(stats.bytesReceived[i]));
+    }
+    AppendMetricHeader(out, "openrct2_network_sent_bytes_total", "counter", "Bytes sent to the connected clients.");
+    for (size_t i = 0; i < std::size(StatisticsGroupNames); i++)
+    {
+        auto label = GetMetricLabel("group", StatisticsGroupNames[i]);
+        AppendMetric(out, "openrct2_network_sent_bytes_total", label, static_cast<double>(stats.bytesSent[i]));
+    }
+    AppendMetricHeader(out, "openrct2_network_send_calls_total", "counter", "Socket writes to the connected clients.");
+    AppendMetric(out, "openrct2_network_send_calls_total", {}, static_cast<double>(stats.sendCalls));
+
+    if (Profiling::IsEnabled())
+    {
+        const auto& functions = Profiling::GetData();
+        AppendMetricHeader(out, "openrct2_function_calls_total", "counter", "Calls of each profiled function.");
+        for (const auto* function : functions)
+        {
+            auto label = GetMetricLabel("function", function->GetName());
+            AppendMetric(out, "openrct2_function_calls_total", label, static_cast<double>(function->GetCallCount()));
+        }
+        AppendMetricHeader(out, "openrct2_function_seconds_total", "counter", "Time spent in each profiled function.");
+        for (const auto* function : functions)
+        {
+            auto label = GetMetricLabel("function", function->GetName());
+            AppendMetric(out, "openrct2_function_seconds_total", label, function->GetTotalTime() / 1000000.0);
+        }
+    }
+
+    try
+    {
+        auto env = GetContext().GetPlatformEnvironment();
+        auto directory = env->GetDirectoryPath(DIRBASE::USER, DIRID::LOG_SERVER);
+        Platform::EnsureDirectoryExists(directory.c_str());
+        auto path = Path::Combine(directory, u8"metrics.prom");
+        auto tempPath = path + u8".tmp";
+        File::WriteAllBytes(tempPath, out.data(), out.size());
+        if (!File::Move(tempPath, path))
+        {
+            log_warning("Unable to replace '%s'", path.c_str());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to write server metrics: %s", e.what());
+    }
+}
+
 void NetworkBase::Client_Send_RequestGameState(uint32_t tick)
 {
     if (_serverState.gamestateSnapshotsEnabled == false)
@@ -1219,6 +1553,14 @@ void NetworkBase::Client_Send_MAPREQUEST(const std::vector<ObjectEntryDescriptor
             packet.WriteString(name);
         }
     }
+
+    // Offer the park the connection was lost with, the server replays the ticks since then if it still has them.
+    packet << static_cast<uint8_t>(_catchUpState.has_value());
+    if (_catchUpState.has_value())
+    {
+        packet << _catchUpState->tick << _catchUpState->srand0 << _catchUpState->verifiedTick;
+        packet.WriteString(_catchUpState->verifiedSpriteHash);
+    }
     _serverConnection->QueuePacket(std::move(packet));
 }
 
@@ -1331,6 +1673,7 @@ NetworkStats_t NetworkBase::GetStats() const
                 stats.bytesReceived[n] += connection->Stats.bytesReceived[n];
                 stats.bytesSent[n] += connection->Stats.bytesSent[n];
             }
+            stats.sendCalls += connection->Stats.sendCalls;
         }
     }
     return stats;
@@ -1358,10 +1701,27 @@ void NetworkBase::Server_Send_AUTH(NetworkConnection& connection)
 
 void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
 {
+    // Actions that are already part of the map must reach the other clients before it.
+    SendGameActionBatch();
+
     std::vector<const ObjectRepositoryItem*> objects;
     if (connection != nullptr)
     {
         objects = connection->RequestedObjects;
+
+        if (_shareMapExports)
+        {
+            auto it = std::find_if(
+                _mapExports.begin(), _mapExports.end(), [&objects](const MapExport& e) { return e.Objects == objects; });
+            if (it != _mapExports.end())
+            {
+                for (const auto& chunk : it->Chunks)
+                {
+                    connection->QueuePacket(chunk);
+                }
+                return;
+            }
+        }
     }
     else
     {
@@ -1370,6 +1730,12 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         auto& context = GetContext();
         auto& objManager = context.GetObjectManager();
         objects = objManager.GetPackableObjects();
+
+        // A new map is being sent, earlier exports and the catch up history are out of date.
+        _mapExports.clear();
+        _catchUpTicks.clear();
+        _catchUpPackets.clear();
+        _catchUpPlayerLists.clear();
     }
 
     auto header = save_for_network(objects);
@@ -1382,6 +1748,9 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         }
         return;
     }
+
+    // Serialise every chunk once, the send queues of all receiving connections share them.
+    std::vector<NetworkOutboundPacket> chunks;
     size_t chunksize = CHUNK_SIZE;
     for (size_t i = 0; i < header.size(); i += chunksize)
     {
@@ -1389,21 +1758,136 @@ void NetworkBase::Server_Send_MAP(NetworkConnection* connection)
         NetworkPacket packet(NetworkCommand::Map);
         packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
         packet.Write(&header[i], datasize);
+        chunks.emplace_back(packet);
+    }
+
+    for (const auto& chunk : chunks)
+    {
         if (connection != nullptr)
         {
-            connection->QueuePacket(std::move(packet));
+            connection->QueuePacket(chunk);
         }
         else
         {
-            SendPacketToClients(packet);
+            for (auto& clientConnection : client_connection_list)
+            {
+                clientConnection->QueuePacket(chunk);
+            }
+        }
+    }
+
+    if (connection != nullptr && _shareMapExports)
+    {
+        _mapExports.push_back({ std::move(objects), std::move(chunks) });
+    }
+}
+
+bool NetworkBase::RecordCatchUpTick(uint32_t tick, uint32_t srand0, const std::string& spriteHash)
+{
+    if (!_catchUpTicks.empty())
+    {
+        auto& lastTick = _catchUpTicks.back();
+        if (lastTick.Tick == tick)
+        {
+            // The tick is sent repeatedly while the game is paused.
+            if (lastTick.SpriteHash.empty())
+            {
+                lastTick.SpriteHash = spriteHash;
+            }
+            return false;
         }
+        if (lastTick.Tick > tick)
+        {
+            _catchUpTicks.clear();
+            _catchUpPackets.clear();
+            _catchUpPlayerLists.clear();
+        }
+    }
+
+    _catchUpTicks.push_back({ tick, srand0, spriteHash });
+    if (_catchUpPlayerLists.empty())
+    {
+        _catchUpPlayerLists.push_back({ tick, NetworkOutboundPacket(MakePlayerListPacket()) });
+    }
+
+    while (_catchUpTicks.front().Tick + CatchUpHistoryTicks <= tick)
+    {
+        _catchUpTicks.pop_front();
+    }
+    const auto firstTick = _catchUpTicks.front().Tick;
+    while (!_catchUpPackets.empty() && _catchUpPackets.front().Tick < firstTick)
+    {
+        _catchUpPackets.pop_front();
     }
+    // Keep the last list from before the first tick, it is the one the first tick starts with.
+    while (_catchUpPlayerLists.size() > 1 && _catchUpPlayerLists[1].Tick <= firstTick)
+    {
+        _catchUpPlayerLists.pop_front();
+    }
+    return true;
+}
+
+void NetworkBase::RecordCatchUpPacket(uint32_t tick, const NetworkOutboundPacket& packet)
+{
+    _catchUpPackets.push_back({ tick, packet });
+}
+
+bool NetworkBase::Server_Send_CATCHUP(
+    NetworkConnection& connection, uint32_t tick, uint32_t srand0, uint32_t verifiedTick,
+    const std::string& verifiedSpriteHash)
+{
+    // Actions that are already part of the park must be in the history, as they are for the map.
+    SendGameActionBatch();
+
+    auto findTick = [this](uint32_t value) -> const CatchUpTick* {
+        auto it = std::lower_bound(
+            _catchUpTicks.begin(), _catchUpTicks.end(), value,
+            [](const CatchUpTick& catchUpTick, uint32_t t) { return catchUpTick.Tick < t; });
+        return it != _catchUpTicks.end() && it->Tick == value ? &*it : nullptr;
+    };
+
+    // The park has to be at a tick the history still covers with the same random state, and its sprites must have
+    // matched at an earlier checksum.
+    const auto* resumeTick = findTick(tick);
+    const auto* checkedTick = findTick(verifiedTick);
+    if (resumeTick == nullptr || resumeTick->Srand0 != srand0 || checkedTick == nullptr || verifiedTick > tick
+        || checkedTick->SpriteHash.empty() || checkedTick->SpriteHash != verifiedSpriteHash)
+    {
+        log_verbose("Client can not catch up from tick %u, sending the map.", tick);
+        return false;
+    }
+
+    auto playerList = std::find_if(_catchUpPlayerLists.rbegin(), _catchUpPlayerLists.rend(), [tick](const CatchUpPacket& p) {
+        return p.Tick <= tick;
+    });
+    if (playerList == _catchUpPlayerLists.rend())
+    {
+        log_verbose("Client can not catch up from tick %u, sending the map.", tick);
+        return false;
+    }
+
+    NetworkPacket packet(NetworkCommand::CatchUp);
+    packet << tick;
+    connection.QueuePacket(std::move(packet));
+    connection.QueuePacket(playerList->Packet);
+
+    size_t numPackets = 0;
+    for (const auto& catchUpPacket : _catchUpPackets)
+    {
+        if (catchUpPacket.Tick >= tick)
+        {
+            connection.QueuePacket(catchUpPacket.Packet);
+            numPackets++;
+        }
+    }
+    log_verbose("Client catches up from tick %u with %zu packets.", tick, numPackets);
+    return true;
 }
 
 std::vector<uint8_t> NetworkBase::save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const
 {
     std::vector<uint8_t> result;
-    auto ms = OpenRCT2::MemoryStream();
+    auto ms = OpenRCT2::MemoryStream::CreatePooled(OpenRCT2::MemoryStreamUsage::MapSend);
     if (SaveMap(&ms, objects))
     {
         result.resize(ms.GetLength());
@@ -1435,12 +1919,13 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
     }
     else
     {
+        const NetworkOutboundPacket outboundPacket(packet);
         for (auto playerId : playerIds)
         {
             auto conn = GetPlayerConnection(playerId);
             if (conn != nullptr)
             {
-                conn->QueuePacket(packet);
+                conn->QueuePacket(outboundPacket);
             }
         }
     }
@@ -1448,8 +1933,6 @@ void NetworkBase::Server_Send_CHAT(const char* text, const std::vector<uint8_t>&
 
 void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
-
     uint32_t networkId = 0;
     networkId = ++_actionId;
 
@@ -1460,27 +1943,19 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
         _gameActionCallbacks.insert(std::make_pair(networkId, action->GetCallback()));
     }
 
-    DataSerialiser stream(true);
-    action->Serialise(stream);
-
-    packet << gCurrentTicks << action->GetType() << stream;
-    _serverConnection->QueuePacket(std::move(packet));
+    AddToGameActionBatch(*action);
 }
 
 void NetworkBase::Server_Send_GAME_ACTION(const GameAction* action)
 {
-    NetworkPacket packet(NetworkCommand::GameAction);
-
-    DataSerialiser stream(true);
-    action->Serialise(stream);
-
-    packet << gCurrentTicks << action->GetType() << stream;
-
-    SendPacketToClients(packet);
+    AddToGameActionBatch(*action);
 }
 
 void NetworkBase::Server_Send_TICK()
 {
+    // The actions of the previous tick have to arrive before the tick that lets the clients execute them.
+    SendGameActionBatch();
+
     NetworkPacket packet(NetworkCommand::Tick);
     packet << gCurrentTicks << scenario_rand_state().s0;
     uint32_t flags = 0;
@@ -1497,13 +1972,19 @@ void NetworkBase::Server_Send_TICK()
     // Send flags always, so we can understand packet structure on the other end,
     // and allow for some expansion.
     packet << flags;
+    std::string spriteHash;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
-        packet.WriteString(checksum.ToString());
+        spriteHash = GetAllEntitiesChecksum().ToString();
+        packet.WriteString(spriteHash);
     }
 
-    SendPacketToClients(packet);
+    const NetworkOutboundPacket outboundPacket(packet);
+    if (RecordCatchUpTick(gCurrentTicks, scenario_rand_state().s0, spriteHash))
+    {
+        RecordCatchUpPacket(gCurrentTicks, outboundPacket);
+    }
+    SendPacketToClients(outboundPacket);
 }
 
 void NetworkBase::Server_Send_PLAYERINFO(int32_t playerId)
@@ -1516,10 +1997,13 @@ void NetworkBase::Server_Send_PLAYERINFO(int32_t playerId)
         return;
 
     player->Write(packet);
-    SendPacketToClients(packet);
+
+    const NetworkOutboundPacket outboundPacket(packet);
+    RecordCatchUpPacket(gCurrentTicks, outboundPacket);
+    SendPacketToClients(outboundPacket);
 }
 
-void NetworkBase::Server_Send_PLAYERLIST()
+NetworkPacket NetworkBase::MakePlayerListPacket() const
 {
     NetworkPacket packet(NetworkCommand::PlayerList);
     packet << gCurrentTicks << static_cast<uint8_t>(player_list.size());
@@ -1527,7 +2011,49 @@ void NetworkBase::Server_Send_PLAYERLIST()
     {
         player->Write(packet);
     }
-    SendPacketToClients(packet);
+    return packet;
+}
+
+void NetworkBase::Server_Send_PLAYERLIST()
+{
+    const NetworkOutboundPacket fullList(MakePlayerListPacket());
+    _catchUpPlayerLists.push_back({ gCurrentTicks, fullList });
+
+    std::vector<NetworkPlayer*> addedPlayers;
+    for (auto id : _addedPlayerIds)
+    {
+        auto* player = GetPlayerByID(id);
+        if (player != nullptr)
+        {
+            addedPlayers.push_back(player);
+        }
+    }
+
+    NetworkPacket packet(NetworkCommand::PlayerListUpdate);
+    packet << gCurrentTicks << static_cast<uint8_t>(addedPlayers.size());
+    for (auto* player : addedPlayers)
+    {
+        player->Write(packet);
+    }
+    packet << static_cast<uint8_t>(_removedPlayerIds.size());
+    for (auto id : _removedPlayerIds)
+    {
+        packet << id;
+    }
+    const NetworkOutboundPacket update(packet);
+    RecordCatchUpPacket(gCurrentTicks, update);
+
+    // Players that just joined get the whole list, everyone else only the changes.
+    for (auto& connection : client_connection_list)
+    {
+        const auto* player = connection->Player;
+        const bool joined = player != nullptr
+            && std::find(_addedPlayerIds.begin(), _addedPlayerIds.end(), player->Id) != _addedPlayerIds.end();
+        connection->QueuePacket(joined ? fullList : update);
+    }
+
+    _addedPlayerIds.clear();
+    _removedPlayerIds.clear();
 }
 
 void NetworkBase::Client_Send_PING()
@@ -1549,9 +2075,26 @@ void NetworkBase::Server_Send_PING()
 
 void NetworkBase::Server_Send_PINGLIST()
 {
-    NetworkPacket packet(NetworkCommand::PingList);
-    packet << static_cast<uint8_t>(player_list.size());
+    const bool fullRefresh = _pingListCounter++ % PingListFullRefreshInterval == 0;
+
+    std::vector<const NetworkPlayer*> players;
     for (auto& player : player_list)
+    {
+        auto& sentPing = _sentPings[player->Id];
+        if (fullRefresh || std::abs(player->Ping - sentPing) >= PingListMinChange)
+        {
+            sentPing = player->Ping;
+            players.push_back(player.get());
+        }
+    }
+    if (players.empty())
+    {
+        return;
+    }
+
+    NetworkPacket packet(NetworkCommand::PingList);
+    packet << static_cast<uint8_t>(players.size());
+    for (const auto* player : players)
     {
         packet << player->Id << player->Ping;
     }
@@ -1633,12 +2176,12 @@ void NetworkBase::Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName,
     SendPacketToClients(packet);
 }
 
-bool NetworkBase::ProcessConnection(NetworkConnection& connection)
+bool NetworkBase::ProcessConnection(NetworkConnection& connection, bool hasData)
 {
     NetworkReadPacket packetStatus;
 
     uint32_t countProcessed = 0;
-    do
+    while (hasData)
     {
         countProcessed++;
         packetStatus = connection.ReadPacket();
@@ -1666,7 +2209,11 @@ bool NetworkBase::ProcessConnection(NetworkConnection& connection)
                 // could not read anything from socket
                 break;
         }
-    } while (packetStatus == NetworkReadPacket::Success && countProcessed < MaxPacketsPerUpdate);
+        if (packetStatus != NetworkReadPacket::Success || countProcessed >= MaxPacketsPerUpdate)
+        {
+            break;
+        }
+    }
 
     if (!connection.ReceivedPacketRecently())
     {
@@ -1796,11 +2343,9 @@ void NetworkBase::ProcessPlayerList()
 {
     if (GetMode() == NETWORK_MODE_SERVER)
     {
-        // Avoid sending multiple times the player list, we mark the list invalidated on modifications
-        // and then send at the end of the tick the final player list.
-        if (_playerListInvalidated)
+        // Avoid sending the player list multiple times, the changes are gathered and sent at the end of the tick.
+        if (!_addedPlayerIds.empty() || !_removedPlayerIds.empty())
         {
-            _playerListInvalidated = false;
             Server_Send_PLAYERLIST();
         }
     }
@@ -1814,12 +2359,14 @@ void NetworkBase::ProcessPlayerList()
             if (itPending->first > gCurrentTicks)
                 break;
 
+            const auto& update = itPending->second;
+
             // List of active players found in the list.
             std::vector<uint8_t> activePlayerIds;
             std::vector<uint8_t> newPlayers;
             std::vector<uint8_t> removedPlayers;
 
-            for (const auto& pendingPlayer : itPending->second.players)
+            for (const auto& pendingPlayer : update.players)
             {
                 activePlayerIds.push_back(pendingPlayer.Id);
 
@@ -1845,10 +2392,14 @@ void NetworkBase::ProcessPlayerList()
                 }
             }
 
-            // Remove any players that are not in newly received list
+            // Remove any players that are not in newly received list, or the ones an update has removed.
             for (const auto& player : player_list)
             {
-                if (std::find(activePlayerIds.begin(), activePlayerIds.end(), player->Id) == activePlayerIds.end())
+                const bool removed = update.full
+                    ? std::find(activePlayerIds.begin(), activePlayerIds.end(), player->Id) == activePlayerIds.end()
+                    : std::find(update.removedPlayers.begin(), update.removedPlayers.end(), player->Id)
+                        != update.removedPlayers.end();
+                if (removed)
                 {
                     removedPlayers.push_back(player->Id);
                 }
@@ -1990,7 +2541,9 @@ void NetworkBase::RemovePlayer(std::unique_ptr<NetworkConnection>& connection)
         player_list.end());
 
     // Send new player list.
-    _playerListInvalidated = true;
+    _addedPlayerIds.erase(
+        std::remove(_addedPlayerIds.begin(), _addedPlayerIds.end(), connection_player->Id), _addedPlayerIds.end());
+    _removedPlayerIds.push_back(connection_player->Id);
 }
 
 NetworkPlayer* NetworkBase::AddPlayer(const std::string& name, const std::string& keyhash)
@@ -2045,7 +2598,9 @@ NetworkPlayer* NetworkBase::AddPlayer(const std::string& name, const std::string
             }
 
             // Send new player list.
-            _playerListInvalidated = true;
+            _removedPlayerIds.erase(
+                std::remove(_removedPlayerIds.begin(), _removedPlayerIds.end(), player->Id), _removedPlayerIds.end());
+            _addedPlayerIds.push_back(player->Id);
         }
         else
         {
@@ -2165,24 +2720,27 @@ void NetworkBase::Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection,
     const GameStateSnapshot_t* snapshot = snapshots->GetLinkedSnapshot(tick);
     if (snapshot != nullptr)
     {
-        MemoryStream snapshotMemory;
+        auto snapshotMemory = MemoryStream::CreatePooled(MemoryStreamUsage::Snapshot);
         DataSerialiser ds(true, snapshotMemory);
 
         snapshots->SerialiseSnapshot(const_cast<GameStateSnapshot_t&>(*snapshot), ds);
 
+        // The entity data compresses well, send it compressed to keep the transfer short for large parks.
+        auto compressed = Gzip(snapshotMemory.GetData(), snapshotMemory.GetLength());
+
         uint32_t bytesSent = 0;
-        uint32_t length = static_cast<uint32_t>(snapshotMemory.GetLength());
+        uint32_t length = static_cast<uint32_t>(compressed.size());
         while (bytesSent < length)
         {
             uint32_t dataSize = CHUNK_SIZE;
-            if (bytesSent + dataSize > snapshotMemory.GetLength())
+            if (bytesSent + dataSize > length)
             {
-                dataSize = snapshotMemory.GetLength() - bytesSent;
+                dataSize = length - bytesSent;
             }
 
             NetworkPacket packetGameStateChunk(NetworkCommand::GameState);
             packetGameStateChunk << tick << length << bytesSent << dataSize;
-            packetGameStateChunk.Write(static_cast<const uint8_t*>(snapshotMemory.GetData()) + bytesSent, dataSize);
+            packetGameStateChunk.Write(compressed.data() + bytesSent, dataSize);
 
             connection.QueuePacket(std::move(packetGameStateChunk));
 
@@ -2418,8 +2976,18 @@ void NetworkBase::Client_Handle_GAMESTATE(NetworkConnection& connection, Network
 
     if (_serverGameState.GetLength() == totalSize)
     {
-        _serverGameState.SetPosition(0);
-        DataSerialiser ds(false, _serverGameState);
+        std::vector<uint8_t> stateData;
+        try
+        {
+            stateData = Ungzip(_serverGameState.GetData(), _serverGameState.GetLength());
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Failed to decompress game state: %s", e.what());
+            return;
+        }
+        MemoryStream stateStream(std::move(stateData));
+        DataSerialiser ds(false, stateStream);
 
         IGameStateSnapshots* snapshots = GetContext().GetGameStateSnapshots();
 
@@ -2511,137 +3079,196 @@ void NetworkBase::Server_Handle_MAPREQUEST(NetworkConnection& connection, Networ
         }
     }
 
+    uint8_t hasCatchUpState{};
+    packet >> hasCatchUpState;
+    bool caughtUp = false;
+    if (hasCatchUpState != 0)
+    {
+        uint32_t tick{};
+        uint32_t srand0{};
+        uint32_t verifiedTick{};
+        packet >> tick >> srand0 >> verifiedTick;
+        auto verifiedSpriteHash = std::string(packet.ReadString());
+
+        // Objects the client is missing are only sent with the map.
+        caughtUp = connection.RequestedObjects.empty()
+            && Server_Send_CATCHUP(connection, tick, srand0, verifiedTick, verifiedSpriteHash);
+    }
+
     auto player_name = connection.Player->Name.c_str();
-    Server_Send_MAP(&connection);
+    if (!caughtUp)
+    {
+        Server_Send_MAP(&connection);
+    }
     Server_Send_EVENT_PLAYER_JOINED(player_name);
     Server_Send_GROUPLIST(connection);
 }
 
 void NetworkBase::Server_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet)
 {
-    if (connection.AuthStatus != NetworkAuth::Ok)
+    // Repeated requests are ignored while the signature of the first one is being verified.
+    if (connection.AuthStatus == NetworkAuth::Ok || connection.PendingAuth != nullptr)
     {
-        auto* hostName = connection.Socket->GetHostName();
-        auto gameversion = packet.ReadString();
-        auto name = packet.ReadString();
-        auto password = packet.ReadString();
-        auto pubkey = packet.ReadString();
-        uint32_t sigsize;
-        packet >> sigsize;
-        if (pubkey.empty())
-        {
-            connection.AuthStatus = NetworkAuth::VerificationFailure;
-        }
-        else
-        {
-            try
-            {
-                // RSA technically supports keys up to 65536 bits, so this is the
-                // maximum signature size for now.
-                constexpr auto MaxRSASignatureSizeInBytes = 8192;
+        return;
+    }
 
-                if (sigsize == 0 || sigsize > MaxRSASignatureSizeInBytes)
-                {
-                    throw std::runtime_error("Invalid signature size");
-                }
+    auto* hostName = connection.Socket->GetHostName();
+    auto auth = std::make_shared<NetworkPendingAuth>();
+    auth->GameVersion = packet.ReadString();
+    auth->Name = packet.ReadString();
+    auth->Password = packet.ReadString();
+    auth->PublicKey = packet.ReadString();
+    uint32_t sigsize;
+    packet >> sigsize;
+    if (auth->PublicKey.empty())
+    {
+        connection.AuthStatus = NetworkAuth::VerificationFailure;
+        Server_Finish_AUTH(connection, *auth);
+        return;
+    }
 
-                std::vector<uint8_t> signature;
-                signature.resize(sigsize);
+    try
+    {
+        // RSA technically supports keys up to 65536 bits, so this is the
+        // maximum signature size for now.
+        constexpr auto MaxRSASignatureSizeInBytes = 8192;
 
-                const uint8_t* signatureData = packet.Read(sigsize);
-                if (signatureData == nullptr)
-                {
-                    throw std::runtime_error("Failed to read packet.");
-                }
+        if (sigsize == 0 || sigsize > MaxRSASignatureSizeInBytes)
+        {
+            throw std::runtime_error("Invalid signature size");
+        }
 
-                std::memcpy(signature.data(), signatureData, sigsize);
+        const uint8_t* signatureData = packet.Read(sigsize);
+        if (signatureData == nullptr)
+        {
+            throw std::runtime_error("Failed to read packet.");
+        }
 
-                auto ms = MemoryStream(pubkey.data(), pubkey.size());
-                if (!connection.Key.LoadPublic(&ms))
-                {
-                    throw std::runtime_error("Failed to load public key.");
-                }
+        auth->Signature.assign(signatureData, signatureData + sigsize);
+    }
+    catch (const std::exception&)
+    {
+        connection.AuthStatus = NetworkAuth::VerificationFailure;
+        log_verbose("Connection %s: Signature verification failed, invalid data!", hostName);
+        Server_Finish_AUTH(connection, *auth);
+        return;
+    }
 
-                bool verified = connection.Key.Verify(connection.Challenge.data(), connection.Challenge.size(), signature);
-                const std::string hash = connection.Key.PublicKeyHash();
-                if (verified)
-                {
-                    log_verbose("Connection %s: Signature verification ok. Hash %s", hostName, hash.c_str());
-                    if (gConfigNetwork.known_keys_only && _userManager.GetUserByHash(hash) == nullptr)
-                    {
-                        log_verbose("Connection %s: Hash %s, not known", hostName, hash.c_str());
-                        connection.AuthStatus = NetworkAuth::UnknownKeyDisallowed;
-                    }
-                    else
-                    {
-                        connection.AuthStatus = NetworkAuth::Verified;
-                    }
-                }
-                else
-                {
-                    connection.AuthStatus = NetworkAuth::VerificationFailure;
-                    log_verbose("Connection %s: Signature verification failed!", hostName);
-                }
-            }
-            catch (const std::exception&)
+    // Verifying the signature is slow, a worker does it so that players joining together do not stall the server.
+    auth->Challenge = connection.Challenge;
+    connection.PendingAuth = auth;
+    _authJobs.AddTask([auth]() {
+        try
+        {
+            auto ms = MemoryStream(auth->PublicKey.data(), auth->PublicKey.size());
+            if (!auth->Key.LoadPublic(&ms))
             {
-                connection.AuthStatus = NetworkAuth::VerificationFailure;
-                log_verbose("Connection %s: Signature verification failed, invalid data!", hostName);
+                throw std::runtime_error("Failed to load public key.");
             }
+            auth->Verified = auth->Key.Verify(auth->Challenge.data(), auth->Challenge.size(), auth->Signature);
+            auth->KeyHash = auth->Key.PublicKeyHash();
         }
+        catch (const std::exception&)
+        {
+            auth->InvalidData = true;
+        }
+        auth->Done = true;
+    });
+}
 
-        bool passwordless = false;
-        if (connection.AuthStatus == NetworkAuth::Verified)
+void NetworkBase::Server_Process_PendingAuth(NetworkConnection& connection)
+{
+    auto auth = connection.PendingAuth;
+    if (auth == nullptr || !auth->Done)
+    {
+        return;
+    }
+    connection.PendingAuth = nullptr;
+
+    auto* hostName = connection.Socket->GetHostName();
+    connection.Key = std::move(auth->Key);
+    if (auth->InvalidData)
+    {
+        connection.AuthStatus = NetworkAuth::VerificationFailure;
+        log_verbose("Connection %s: Signature verification failed, invalid data!", hostName);
+    }
+    else if (auth->Verified)
+    {
+        const auto& hash = auth->KeyHash;
+        log_verbose("Connection %s: Signature verification ok. Hash %s", hostName, hash.c_str());
+        if (gConfigNetwork.known_keys_only && _userManager.GetUserByHash(hash) == nullptr)
         {
-            const NetworkGroup* group = GetGroupByID(GetGroupIDByHash(connection.Key.PublicKeyHash()));
-            passwordless = group->CanPerformAction(NetworkPermission::PasswordlessLogin);
+            log_verbose("Connection %s: Hash %s, not known", hostName, hash.c_str());
+            connection.AuthStatus = NetworkAuth::UnknownKeyDisallowed;
         }
-        if (gameversion != network_get_version())
+        else
         {
-            connection.AuthStatus = NetworkAuth::BadVersion;
-            log_info("Connection %s: Bad version.", hostName);
+            connection.AuthStatus = NetworkAuth::Verified;
         }
-        else if (name.empty())
+    }
+    else
+    {
+        connection.AuthStatus = NetworkAuth::VerificationFailure;
+        log_verbose("Connection %s: Signature verification failed!", hostName);
+    }
+
+    Server_Finish_AUTH(connection, *auth);
+}
+
+void NetworkBase::Server_Finish_AUTH(NetworkConnection& connection, const NetworkPendingAuth& auth)
+{
+    auto* hostName = connection.Socket->GetHostName();
+    bool passwordless = false;
+    if (connection.AuthStatus == NetworkAuth::Verified)
+    {
+        const NetworkGroup* group = GetGroupByID(GetGroupIDByHash(connection.Key.PublicKeyHash()));
+        passwordless = group->CanPerformAction(NetworkPermission::PasswordlessLogin);
+    }
+    if (auth.GameVersion != network_get_version())
+    {
+        connection.AuthStatus = NetworkAuth::BadVersion;
+        log_info("Connection %s: Bad version.", hostName);
+    }
+    else if (auth.Name.empty())
+    {
+        connection.AuthStatus = NetworkAuth::BadName;
+        log_info("Connection %s: Bad name.", connection.Socket->GetHostName());
+    }
+    else if (!passwordless)
+    {
+        if (auth.Password.empty() && !_password.empty())
         {
-            connection.AuthStatus = NetworkAuth::BadName;
-            log_info("Connection %s: Bad name.", connection.Socket->GetHostName());
+            connection.AuthStatus = NetworkAuth::RequirePassword;
+            log_info("Connection %s: Requires password.", hostName);
         }
-        else if (!passwordless)
+        else if (!auth.Password.empty() && _password != auth.Password)
         {
-            if (password.empty() && !_password.empty())
-            {
-                connection.AuthStatus = NetworkAuth::RequirePassword;
-                log_info("Connection %s: Requires password.", hostName);
-            }
-            else if (!password.empty() && _password != password)
-            {
-                connection.AuthStatus = NetworkAuth::BadPassword;
-                log_info("Connection %s: Bad password.", hostName);
-            }
+            connection.AuthStatus = NetworkAuth::BadPassword;
+            log_info("Connection %s: Bad password.", hostName);
         }
+    }
 
-        if (static_cast<size_t>(gConfigNetwork.maxplayers) <= player_list.size())
+    if (static_cast<size_t>(gConfigNetwork.maxplayers) <= player_list.size())
+    {
+        connection.AuthStatus = NetworkAuth::Full;
+        log_info("Connection %s: Server is full.", hostName);
+    }
+    else if (connection.AuthStatus == NetworkAuth::Verified)
+    {
+        const std::string hash = connection.Key.PublicKeyHash();
+        if (ProcessPlayerAuthenticatePluginHooks(connection, auth.Name, hash))
         {
-            connection.AuthStatus = NetworkAuth::Full;
-            log_info("Connection %s: Server is full.", hostName);
+            connection.AuthStatus = NetworkAuth::Ok;
+            Server_Client_Joined(auth.Name, hash, connection);
         }
-        else if (connection.AuthStatus == NetworkAuth::Verified)
+        else
         {
-            const std::string hash = connection.Key.PublicKeyHash();
-            if (ProcessPlayerAuthenticatePluginHooks(connection, name, hash))
-            {
-                connection.AuthStatus = NetworkAuth::Ok;
-                Server_Client_Joined(name, hash, connection);
-            }
-            else
-            {
-                connection.AuthStatus = NetworkAuth::VerificationFailure;
-                log_info("Connection %s: Denied by plugin.", hostName);
-            }
+            connection.AuthStatus = NetworkAuth::VerificationFailure;
+            log_info("Connection %s: Denied by plugin.", hostName);
         }
-
-        Server_Send_AUTH(connection);
     }
+
+    Server_Send_AUTH(connection);
 }
 
 void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
@@ -2662,6 +3289,14 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
 
         _serverTickData.clear();
         _clientMapLoaded = false;
+        scenery_clear_speculative_placements(false);
+
+        // The server could not let the park catch up, the map replaces it.
+        if (_catchUpState.has_value() && _catchUpState->paused)
+        {
+            pause_toggle();
+        }
+        _catchUpState.reset();
     }
     if (size > chunk_buffer.size())
     {
@@ -2728,6 +3363,45 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
     }
 }
 
+void NetworkBase::Client_Handle_CATCHUP(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t tick;
+    packet >> tick;
+    if (!_catchUpState.has_value() || _catchUpState->tick != tick || gCurrentTicks != tick)
+    {
+        log_warning("Server sent a catch up for tick %u, park is at tick %u.", tick, gCurrentTicks);
+        connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+        connection.Disconnect();
+        return;
+    }
+
+    // Everything received so far is replayed by the server, starting from the tick the park is at.
+    GameActions::ClearQueue();
+    GameActions::ResumeQueue();
+    _serverTickData.clear();
+    _pendingPlayerLists.clear();
+    _pendingPlayerInfo.clear();
+
+    if (_catchUpState->paused)
+    {
+        pause_toggle();
+    }
+    _catchUpState.reset();
+
+    context_force_close_window_by_class(WC_NETWORK_STATUS);
+
+    // The network plugins have been sent again, start them as after loading the map.
+    game_unload_scripts();
+    game_load_scripts();
+
+    _serverState.tick = gCurrentTicks;
+    _serverState.state = NetworkServerState::Ok;
+    _clientMapLoaded = true;
+    log_verbose("Catching up with the server from tick %u", tick);
+
+    network_chat_show_connected_message();
+}
+
 bool NetworkBase::LoadMap(IStream* stream)
 {
     bool result = false;
@@ -2849,56 +3523,96 @@ void NetworkBase::Server_Handle_CHAT(NetworkConnection& connection, NetworkPacke
 void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
 {
     uint32_t tick;
-    GameCommand actionType;
-    packet >> tick >> actionType;
+    uint32_t count;
+    packet >> tick >> count;
 
-    MemoryStream stream;
-    const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.WriteArray(packet.Read(size), size);
-    stream.SetPosition(0);
+    std::vector<GameAction::Ptr> actions;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        GameCommand actionType;
+        uint32_t size;
+        packet >> actionType >> size;
+        const uint8_t* data = packet.Read(size);
+        if (data == nullptr)
+        {
+            log_error("Received malformed game action packet");
+            break;
+        }
 
-    DataSerialiser ds(false, stream);
+        GameAction::Ptr action = GameActions::Create(actionType);
+        if (action == nullptr)
+        {
+            log_error("Received unregistered game action type: 0x%08X", actionType);
+            continue;
+        }
 
-    GameAction::Ptr action = GameActions::Create(actionType);
-    if (action == nullptr)
-    {
-        log_error("Received unregistered game action type: 0x%08X", actionType);
-        return;
-    }
-    action->Serialise(ds);
+        MemoryStream stream(data, size);
+        DataSerialiser ds(false, stream);
+        action->Serialise(ds);
 
-    if (player_id == action->GetPlayer().id)
-    {
-        // Only execute callbacks that belong to us,
-        // clients can have identical network ids assigned.
-        auto itr = _gameActionCallbacks.find(action->GetNetworkId());
-        if (itr != _gameActionCallbacks.end())
+        if (player_id == action->GetPlayer().id)
         {
-            action->SetCallback(itr->second);
-            _gameActionCallbacks.erase(itr);
+            // Only execute callbacks that belong to us,
+            // clients can have identical network ids assigned.
+            auto itr = _gameActionCallbacks.find(action->GetNetworkId());
+            if (itr != _gameActionCallbacks.end())
+            {
+                action->SetCallback(itr->second);
+                _gameActionCallbacks.erase(itr);
+            }
         }
+
+        actions.push_back(std::move(action));
     }
 
-    GameActions::Enqueue(std::move(action), tick);
+    GameActions::Enqueue(std::move(actions), tick);
 }
 
 void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet)
 {
+    if (connection.Player == nullptr)
+    {
+        return;
+    }
+
     uint32_t tick;
-    GameCommand actionType;
+    uint32_t count;
+    packet >> tick >> count;
 
-    NetworkPlayer* player = connection.Player;
-    if (player == nullptr)
+    std::vector<GameAction::Ptr> actions;
+    for (uint32_t i = 0; i < count; i++)
     {
-        return;
+        GameCommand actionType;
+        uint32_t size;
+        packet >> actionType >> size;
+        const uint8_t* data = packet.Read(size);
+        if (data == nullptr)
+        {
+            log_error(
+                "Received malformed game action packet from player: (%d) %s", connection.Player->Id,
+                connection.Player->Name.c_str());
+            break;
+        }
+
+        auto ga = Server_Read_GAME_ACTION(connection, actionType, data, size);
+        if (ga != nullptr)
+        {
+            actions.push_back(std::move(ga));
+        }
     }
 
-    packet >> tick >> actionType;
+    GameActions::Enqueue(std::move(actions), tick);
+}
+
+GameAction::Ptr NetworkBase::Server_Read_GAME_ACTION(
+    NetworkConnection& connection, GameCommand actionType, const uint8_t* data, size_t dataSize)
+{
+    NetworkPlayer* player = connection.Player;
 
     // Don't let clients send pause or quit
     if (actionType == GameCommand::TogglePause || actionType == GameCommand::LoadOrQuit)
     {
-        return;
+        return nullptr;
     }
 
     if (actionType != GameCommand::Custom)
@@ -2908,7 +3622,7 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         if (group == nullptr || group->CanPerformCommand(actionType) == false)
         {
             Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_PERMISSION_DENIED);
-            return;
+            return nullptr;
         }
     }
 
@@ -2919,7 +3633,7 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         log_error(
             "Received unregistered game action type: 0x%08X from player: (%d) %s", actionType, connection.Player->Id,
             connection.Player->Name.c_str());
-        return;
+        return nullptr;
     }
 
     // Player who is hosting is not affected by cooldowns.
@@ -2931,7 +3645,7 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
             if (cooldownIt->second > 0)
             {
                 Server_Send_SHOWERROR(connection, STR_CANT_DO_THIS, STR_NETWORK_ACTION_RATE_LIMIT_MESSAGE);
-                return;
+                return nullptr;
             }
         }
 
@@ -2942,16 +3656,13 @@ void NetworkBase::Server_Handle_GAME_ACTION(NetworkConnection& connection, Netwo
         }
     }
 
-    DataSerialiser stream(false);
-    const size_t size = packet.Header.Size - packet.BytesRead;
-    stream.GetStream().WriteArray(packet.Read(size), size);
-    stream.GetStream().SetPosition(0);
-
-    ga->Serialise(stream);
+    MemoryStream stream(data, dataSize);
+    DataSerialiser ds(false, stream);
+    ga->Serialise(ds);
     // Set player to sender, should be 0 if sent from client.
     ga->SetPlayer(NetworkPlayerId_t{ connection.Player->Id });
 
-    GameActions::Enqueue(std::move(ga), tick);
+    return ga;
 }
 
 void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
@@ -3002,9 +3713,8 @@ void NetworkBase::Client_Handle_PLAYERLIST([[maybe_unused]] NetworkConnection& c
     uint8_t size;
     packet >> tick >> size;
 
-    auto& pending = _pendingPlayerLists[tick];
-    pending.players.clear();
-
+    PlayerListUpdate pending{};
+    pending.full = true;
     for (uint32_t i = 0; i < size; i++)
     {
         NetworkPlayer tempplayer;
@@ -3012,6 +3722,33 @@ void NetworkBase::Client_Handle_PLAYERLIST([[maybe_unused]] NetworkConnection& c
 
         pending.players.push_back(std::move(tempplayer));
     }
+    _pendingPlayerLists.emplace(tick, std::move(pending));
+}
+
+void NetworkBase::Client_Handle_PLAYERLISTUPDATE([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t tick;
+    uint8_t numAdded;
+    packet >> tick >> numAdded;
+
+    PlayerListUpdate pending{};
+    for (uint32_t i = 0; i < numAdded; i++)
+    {
+        NetworkPlayer tempplayer;
+        tempplayer.Read(packet);
+
+        pending.players.push_back(std::move(tempplayer));
+    }
+
+    uint8_t numRemoved;
+    packet >> numRemoved;
+    for (uint32_t i = 0; i < numRemoved; i++)
+    {
+        uint8_t id;
+        packet >> id;
+        pending.removedPlayers.push_back(id);
+    }
+    _pendingPlayerLists.emplace(tick, std::move(pending));
 }
 
 void NetworkBase::Client_Handle_PING([[maybe_unused]] NetworkConnection& connection, [[maybe_unused]] NetworkPacket& packet)
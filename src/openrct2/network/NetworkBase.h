@@ -2,6 +2,7 @@
 
 #include "../System.hpp"
 #include "../actions/GameAction.h"
+#include "../core/JobPool.h"
 #include "../object/Object.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
@@ -10,7 +11,10 @@
 #include "NetworkTypes.h"
 #include "NetworkUser.h"
 
+#include <array>
+#include <deque>
 #include <fstream>
+#include <optional>
 
 #ifndef DISABLE_NETWORK
 
@@ -35,6 +39,8 @@ public: // Common
     // FIXME: This is currently the wrong function to override in System, will be refactored later.
     void Update() override final;
     void Flush();
+    void AddToGameActionBatch(const GameAction& action);
+    void SendGameActionBatch();
     void ProcessPending();
     void ProcessPlayerList();
     auto GetPlayerIteratorByID(uint8_t id) const;
@@ -50,7 +56,7 @@ public: // Common
     void CloseChatLog();
     NetworkStats_t GetStats() const;
     json_t GetServerInfoAsJson() const;
-    bool ProcessConnection(NetworkConnection& connection);
+    bool ProcessConnection(NetworkConnection& connection, bool hasData = true);
     void CloseConnection();
     NetworkPlayer* AddPlayer(const std::string& name, const std::string& keyhash);
     void ProcessPacket(NetworkConnection& connection, NetworkPacket& packet);
@@ -67,6 +73,7 @@ public: // Server
     void BeginServerLog();
     void AppendServerLog(const std::string& s);
     void CloseServerLog();
+    void WriteServerMetrics();
     void DecayCooldown(NetworkPlayer* player);
     void AddClient(std::unique_ptr<ITcpSocket>&& socket);
     std::string GetMasterServerUrl();
@@ -78,6 +85,8 @@ public: // Server
     bool SaveMap(OpenRCT2::IStream* stream, const std::vector<const ObjectRepositoryItem*>& objects) const;
     std::vector<uint8_t> save_for_network(const std::vector<const ObjectRepositoryItem*>& objects) const;
     std::string MakePlayerNameUnique(const std::string& name);
+    bool RecordCatchUpTick(uint32_t tick, uint32_t srand0, const std::string& spriteHash);
+    void RecordCatchUpPacket(uint32_t tick, const NetworkOutboundPacket& packet);
 
     // Packet dispatchers.
     void Server_Send_AUTH(NetworkConnection& connection);
@@ -88,6 +97,7 @@ public: // Server
     void Server_Send_TICK();
     void Server_Send_PLAYERINFO(int32_t playerId);
     void Server_Send_PLAYERLIST();
+    NetworkPacket MakePlayerListPacket() const;
     void Server_Send_PING();
     void Server_Send_PINGLIST();
     void Server_Send_SETDISCONNECTMSG(NetworkConnection& connection, const char* msg);
@@ -98,14 +108,21 @@ public: // Server
     void Server_Send_EVENT_PLAYER_DISCONNECTED(const char* playerName, const char* reason);
     void Server_Send_OBJECTS_LIST(NetworkConnection& connection, const std::vector<const ObjectRepositoryItem*>& objects) const;
     void Server_Send_SCRIPTS(NetworkConnection& connection);
+    bool Server_Send_CATCHUP(
+        NetworkConnection& connection, uint32_t tick, uint32_t srand0, uint32_t verifiedTick,
+        const std::string& verifiedSpriteHash);
 
     // Handlers
     void Server_Handle_REQUEST_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_HEARTBEAT(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
+    void Server_Process_PendingAuth(NetworkConnection& connection);
+    void Server_Finish_AUTH(NetworkConnection& connection, const NetworkPendingAuth& auth);
     void Server_Client_Joined(std::string_view name, const std::string& keyhash, NetworkConnection& connection);
     void Server_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
+    GameAction::Ptr Server_Read_GAME_ACTION(
+        NetworkConnection& connection, GameCommand actionType, const uint8_t* data, size_t dataSize);
     void Server_Handle_PING(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_GAMEINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_TOKEN(NetworkConnection& connection, NetworkPacket& packet);
@@ -121,6 +138,7 @@ public: // Client
     void ProcessDisconnectedClients();
     static const char* FormatChat(NetworkPlayer* fromplayer, const char* text);
     void SendPacketToClients(const NetworkPacket& packet, bool front = false, bool gameCmd = false) const;
+    void SendPacketToClients(const NetworkOutboundPacket& packet, bool front = false, bool gameCmd = false) const;
     bool CheckSRAND(uint32_t tick, uint32_t srand0);
     bool CheckDesynchronizaton();
     void RequestStateSnapshot();
@@ -150,6 +168,7 @@ public: // Client
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERINFO(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PLAYERLIST(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_PLAYERLISTUPDATE(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PING(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_PINGLIST(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_SETDISCONNECTMSG(NetworkConnection& connection, NetworkPacket& packet);
@@ -161,9 +180,14 @@ public: // Client
     void Client_Handle_OBJECTS_LIST(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_SCRIPTS(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_CATCHUP(NetworkConnection& connection, NetworkPacket& packet);
 
     std::vector<uint8_t> _challenge;
     std::map<uint32_t, GameAction::Callback_t> _gameActionCallbacks;
+    // Game actions sent during a tick are gathered here and sent as one packet by SendGameActionBatch.
+    NetworkPacket _gameActionBatch;
+    uint32_t _gameActionBatchTick = 0;
+    uint32_t _gameActionBatchCount = 0;
     NetworkKey _key;
     NetworkUserManager _userManager;
 
@@ -198,13 +222,49 @@ private: // Server Data
     std::string _serverLogPath;
     std::string _serverLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
     std::ofstream _server_log_fs;
+    // Map exports made while the connections are processed, shared by the clients requesting the same objects.
+    struct MapExport
+    {
+        std::vector<const ObjectRepositoryItem*> Objects;
+        std::vector<NetworkOutboundPacket> Chunks;
+    };
+    std::vector<MapExport> _mapExports;
+    bool _shareMapExports = false;
+    // The tick data and the tick scheduled packets of the recent ticks. A reconnecting client whose park is still at
+    // one of these ticks gets the packets since then replayed instead of downloading the map.
+    struct CatchUpTick
+    {
+        uint32_t Tick;
+        uint32_t Srand0;
+        std::string SpriteHash;
+    };
+    struct CatchUpPacket
+    {
+        uint32_t Tick;
+        NetworkOutboundPacket Packet;
+    };
+    std::deque<CatchUpTick> _catchUpTicks;
+    std::deque<CatchUpPacket> _catchUpPackets;
+    // Full player lists, one for each change of the players, as the replayed packets only carry the changes.
+    std::deque<CatchUpPacket> _catchUpPlayerLists;
+    // Verifies the signatures of authenticating players.
+    JobPool _authJobs;
+    uint32_t _lastMetricsTime = 0;
     uint16_t listening_port = 0;
-    bool _playerListInvalidated = false;
+    // Players added and removed since the player list was last sent.
+    std::vector<uint8_t> _addedPlayerIds;
+    std::vector<uint8_t> _removedPlayerIds;
+    // The pings the clients have last been sent, by player id.
+    std::array<uint16_t, 256> _sentPings{};
+    uint32_t _pingListCounter = 0;
 
 private: // Client Data
     struct PlayerListUpdate
     {
+        // Players that are added or updated, all players if full is set.
         std::vector<NetworkPlayer> players;
+        std::vector<uint8_t> removedPlayers;
+        bool full;
     };
 
     struct ServerTickData_t
@@ -216,9 +276,23 @@ private: // Client Data
 
     std::unordered_map<NetworkCommand, CommandHandler> client_command_handlers;
     std::unique_ptr<NetworkConnection> _serverConnection;
-    std::map<uint32_t, PlayerListUpdate> _pendingPlayerLists;
+    std::multimap<uint32_t, PlayerListUpdate> _pendingPlayerLists;
     std::multimap<uint32_t, NetworkPlayer> _pendingPlayerInfo;
     std::map<uint32_t, ServerTickData_t> _serverTickData;
+    // The park as it was when the connection was lost, offered to the server on reconnect to catch up with it.
+    struct CatchUpState
+    {
+        uint32_t tick;
+        uint32_t srand0;
+        uint32_t verifiedTick;
+        std::string verifiedSpriteHash;
+        // Set when the park was paused for the catch up, it is resumed once the client is back.
+        bool paused;
+    };
+    std::optional<CatchUpState> _catchUpState;
+    // The last tick whose sprite hash matched the one of the server.
+    uint32_t _verifiedTick = 0;
+    std::string _verifiedSpriteHash;
     std::vector<ObjectEntryDescriptor> _missingObjects;
     std::string _host;
     std::string _chatLogPath;
@@ -19,6 +19,8 @@
 
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
+// Queued packets are gathered into writes of up to this many bytes.
+constexpr size_t NetworkSendCoalesceSize = 1024 * 64;
 
 NetworkConnection::NetworkConnection() noexcept
 {
@@ -64,28 +66,29 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     // Read packet body.
     {
         // NOTE: BytesTransfered includes the header length, this will not underflow.
-        const size_t missingLength = header.Size - (InboundPacket.BytesTransferred - sizeof(header));
-
-        uint8_t buffer[NetworkBufferSize];
+        const size_t bodyBytesRead = InboundPacket.BytesTransferred - sizeof(header);
+        const size_t missingLength = header.Size - bodyBytesRead;
 
         if (missingLength > 0)
         {
-            NetworkReadPacket status = Socket->ReceiveData(buffer, std::min(missingLength, NetworkBufferSize), &bytesRead);
+            // Receive straight into the packet data.
+            InboundPacket.Data.resize(header.Size);
+            NetworkReadPacket status = Socket->ReceiveData(
+                InboundPacket.Data.data() + bodyBytesRead, std::min(missingLength, NetworkBufferSize), &bytesRead);
             if (status != NetworkReadPacket::Success)
             {
                 return status;
             }
 
             InboundPacket.BytesTransferred += bytesRead;
-            InboundPacket.Write(buffer, bytesRead);
         }
 
-        if (InboundPacket.Data.size() == header.Size)
+        if (InboundPacket.BytesTransferred == sizeof(header) + header.Size)
         {
             // Received complete packet.
             _lastPacketTime = Platform::GetTicks();
 
-            RecordPacketStats(InboundPacket, false);
+            RecordPacketStats(InboundPacket.GetCommand(), InboundPacket.BytesTransferred, false);
 
             return NetworkReadPacket::Success;
         }
@@ -94,12 +97,11 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+NetworkOutboundPacket::NetworkOutboundPacket(const NetworkPacket& packet)
+    : Id(packet.GetCommand())
+    , RequiresAuth(packet.CommandRequiresAuth())
 {
-    auto header = packet.Header;
-
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
+    PacketHeader header{ static_cast<uint16_t>(packet.Data.size()), packet.GetCommand() };
 
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
@@ -107,11 +109,19 @@ bool NetworkConnection::SendPacket(NetworkPacket& packet)
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
+    auto buffer = std::make_shared<std::vector<uint8_t>>();
+    buffer->reserve(sizeof(header) + packet.Data.size());
+    buffer->insert(buffer->end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    buffer->insert(buffer->end(), packet.Data.begin(), packet.Data.end());
+    Buffer = std::move(buffer);
+}
 
+bool NetworkConnection::SendPacket(NetworkOutboundPacket& packet)
+{
+    const auto& buffer = *packet.Buffer;
     size_t bufferSize = buffer.size() - packet.BytesTransferred;
     size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
+    Stats.sendCalls++;
     if (sent > 0)
     {
         packet.BytesTransferred += sent;
@@ -120,16 +130,25 @@ bool NetworkConnection::SendPacket(NetworkPacket& packet)
     bool sendComplete = packet.BytesTransferred == buffer.size();
     if (sendComplete)
     {
-        RecordPacketStats(packet, true);
+        RecordPacketStats(packet.Id, packet.BytesTransferred, true);
     }
     return sendComplete;
 }
 
-void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
+void NetworkConnection::QueuePacket(const NetworkPacket& packet, bool front)
 {
     if (AuthStatus == NetworkAuth::Ok || !packet.CommandRequiresAuth())
     {
-        packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
+        QueuePacket(NetworkOutboundPacket(packet), front);
+    }
+}
+
+void NetworkConnection::QueuePacket(const NetworkOutboundPacket& packet, bool front)
+{
+    if (AuthStatus == NetworkAuth::Ok || !packet.RequiresAuth)
+    {
+        auto queued = packet;
+        queued.BytesTransferred = 0;
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
@@ -137,16 +156,16 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, std::move(queued));
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front(std::move(queued));
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back(std::move(queued));
         }
     }
 }
@@ -163,9 +182,54 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    while (!_outboundPackets.empty())
     {
-        _outboundPackets.pop_front();
+        const auto& first = _outboundPackets.front();
+        if (_outboundPackets.size() == 1 || first.Buffer->size() - first.BytesTransferred >= NetworkSendCoalesceSize)
+        {
+            // Nothing to gather, send straight from the packet buffer.
+            if (!SendPacket(_outboundPackets.front()))
+            {
+                return;
+            }
+            _outboundPackets.pop_front();
+            continue;
+        }
+
+        // Gather the small packets of a burst into a single write.
+        _sendBuffer.clear();
+        for (const auto& packet : _outboundPackets)
+        {
+            const auto& buffer = *packet.Buffer;
+            const auto remaining = buffer.size() - packet.BytesTransferred;
+            if (!_sendBuffer.empty() && _sendBuffer.size() + remaining > NetworkSendCoalesceSize)
+            {
+                break;
+            }
+            _sendBuffer.insert(_sendBuffer.end(), buffer.begin() + packet.BytesTransferred, buffer.end());
+        }
+
+        size_t sent = Socket->SendData(_sendBuffer.data(), _sendBuffer.size());
+        Stats.sendCalls++;
+
+        const bool sentAll = sent == _sendBuffer.size();
+        while (sent > 0)
+        {
+            auto& packet = _outboundPackets.front();
+            const auto taken = std::min(sent, packet.Buffer->size() - packet.BytesTransferred);
+            packet.BytesTransferred += taken;
+            sent -= taken;
+            if (packet.BytesTransferred == packet.Buffer->size())
+            {
+                RecordPacketStats(packet.Id, packet.BytesTransferred, true);
+                _outboundPackets.pop_front();
+            }
+        }
+        if (!sentAll)
+        {
+            // The socket can't take any more for now.
+            return;
+        }
     }
 }
 
@@ -202,12 +266,11 @@ void NetworkConnection::SetLastDisconnectReason(const rct_string_id string_id, v
     SetLastDisconnectReason(buffer);
 }
 
-void NetworkConnection::RecordPacketStats(const NetworkPacket& packet, bool sending)
+void NetworkConnection::RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending)
 {
-    uint32_t packetSize = static_cast<uint32_t>(packet.BytesTransferred);
     NetworkStatisticsGroup trafficGroup;
 
-    switch (packet.GetCommand())
+    switch (command)
     {
         case NetworkCommand::GameAction:
             trafficGroup = NetworkStatisticsGroup::Commands;
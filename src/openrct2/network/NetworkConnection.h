@@ -16,14 +16,51 @@
 #    include "NetworkTypes.h"
 #    include "Socket.h"
 
+#    include <atomic>
 #    include <deque>
 #    include <memory>
+#    include <string>
 #    include <string_view>
 #    include <vector>
 
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
+/**
+ * A packet in the form it is sent over the wire. The buffer is shared, so a packet queued on several connections is
+ * only serialised once.
+ */
+struct NetworkOutboundPacket
+{
+    std::shared_ptr<const std::vector<uint8_t>> Buffer;
+    NetworkCommand Id = NetworkCommand::Invalid;
+    bool RequiresAuth = true;
+    size_t BytesTransferred = 0;
+
+    NetworkOutboundPacket() = default;
+    explicit NetworkOutboundPacket(const NetworkPacket& packet);
+};
+
+/**
+ * An authentication request whose signature is verified by a worker, the server finishes it once Done is set.
+ */
+struct NetworkPendingAuth
+{
+    std::string GameVersion;
+    std::string Name;
+    std::string Password;
+    std::string PublicKey;
+    std::vector<uint8_t> Signature;
+    std::vector<uint8_t> Challenge;
+
+    // Written by the worker before Done is set.
+    NetworkKey Key;
+    std::string KeyHash;
+    bool Verified = false;
+    bool InvalidData = false;
+    std::atomic<bool> Done = false;
+};
+
 class NetworkConnection final
 {
 public:
@@ -35,18 +72,15 @@ public:
     uint32_t PingTime = 0;
     NetworkKey Key;
     std::vector<uint8_t> Challenge;
+    std::shared_ptr<NetworkPendingAuth> PendingAuth;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
     bool ShouldDisconnect = false;
 
     NetworkConnection() noexcept;
 
     NetworkReadPacket ReadPacket();
-    void QueuePacket(NetworkPacket&& packet, bool front = false);
-    void QueuePacket(const NetworkPacket& packet, bool front = false)
-    {
-        auto copy = packet;
-        return QueuePacket(std::move(copy), front);
-    }
+    void QueuePacket(const NetworkPacket& packet, bool front = false);
+    void QueuePacket(const NetworkOutboundPacket& packet, bool front = false);
 
     // This will not immediately disconnect the client. The disconnect
     // will happen post-tick.
@@ -62,12 +96,13 @@ public:
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::deque<NetworkPacket> _outboundPackets;
+    std::deque<NetworkOutboundPacket> _outboundPackets;
+    std::vector<uint8_t> _sendBuffer;
     uint32_t _lastPacketTime = 0;
     std::string _lastDisconnectReason;
 
-    void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void RecordPacketStats(NetworkCommand command, size_t packetSize, bool sending);
+    bool SendPacket(NetworkOutboundPacket& packet);
 };
 
 #endif // DISABLE_NETWORK
@@ -24,15 +24,19 @@ NetworkKey::~NetworkKey()
 {
 }
 
+NetworkKey& NetworkKey::operator=(NetworkKey&& other) noexcept = default;
+
 void NetworkKey::Unload()
 {
     _key = nullptr;
+    _publicKeyHash.clear();
 }
 
 bool NetworkKey::Generate()
 {
     try
     {
+        _publicKeyHash.clear();
         _key = Crypt::CreateRSAKey();
         _key->Generate();
         return true;
@@ -65,6 +69,7 @@ bool NetworkKey::LoadPrivate(OpenRCT2::IStream* stream)
 
     try
     {
+        _publicKeyHash.clear();
         _key = Crypt::CreateRSAKey();
         _key->SetPrivate(pem);
         return true;
@@ -97,6 +102,7 @@ bool NetworkKey::LoadPublic(OpenRCT2::IStream* stream)
 
     try
     {
+        _publicKeyHash.clear();
         _key = Crypt::CreateRSAKey();
         _key->SetPublic(pem);
         return true;
@@ -168,6 +174,11 @@ std::string NetworkKey::PublicKeyString()
  */
 std::string NetworkKey::PublicKeyHash()
 {
+    if (!_publicKeyHash.empty())
+    {
+        return _publicKeyHash;
+    }
+
     try
     {
         std::string key = PublicKeyString();
@@ -185,6 +196,7 @@ std::string NetworkKey::PublicKeyHash()
             snprintf(buf, 3, "%02x", b);
             result.append(buf);
         }
+        _publicKeyHash = result;
         return result;
     }
     catch (const std::exception& e)
@@ -32,6 +32,7 @@ class NetworkKey final
 public:
     NetworkKey();
     ~NetworkKey();
+    NetworkKey& operator=(NetworkKey&& other) noexcept;
     bool Generate();
     bool LoadPrivate(OpenRCT2::IStream* stream);
     bool LoadPublic(OpenRCT2::IStream* stream);
@@ -46,6 +47,8 @@ public:
 private:
     NetworkKey(const NetworkKey&) = delete;
     std::unique_ptr<Crypt::RsaKey> _key;
+    // Computed on first use, the hash is looked up several times while a player authenticates.
+    std::string _publicKeyHash;
 };
 
 #endif // DISABLE_NETWORK
@@ -83,6 +83,8 @@ enum class NetworkCommand : uint32_t
     GameState,
     Scripts,
     Heartbeat,
+    CatchUp,
+    PlayerListUpdate,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
@@ -144,4 +146,6 @@ struct NetworkStats_t
 {
     uint64_t bytesReceived[EnumValue(NetworkStatisticsGroup::Max)];
     uint64_t bytesSent[EnumValue(NetworkStatisticsGroup::Max)];
+    // Number of writes to the sockets, a write can carry several packets.
+    uint64_t sendCalls;
 };
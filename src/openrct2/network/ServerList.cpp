@@ -27,11 +27,15 @@
 #    include "network.h"
 
 #    include <algorithm>
+#    include <ctime>
 #    include <numeric>
 #    include <optional>
 
 using namespace OpenRCT2;
 
+// Number of seconds a master server response is reused for.
+constexpr int64_t SERVER_LIST_CACHE_LIFETIME = 60;
+
 int32_t ServerListEntry::CompareTo(const ServerListEntry& other) const
 {
     const auto& a = *this;
@@ -324,7 +328,81 @@ std::future<std::vector<ServerListEntry>> ServerList::FetchLocalServerListAsync(
     });
 }
 
-std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync() const
+static std::vector<ServerListEntry> ReadMasterServerResponse(json_t& root)
+{
+    if (!root.is_object())
+    {
+        throw MasterServerException(STR_SERVER_LIST_INVALID_RESPONSE_JSON_NUMBER);
+    }
+
+    auto jsonStatus = root["status"];
+    if (!jsonStatus.is_number_integer())
+    {
+        throw MasterServerException(STR_SERVER_LIST_INVALID_RESPONSE_JSON_NUMBER);
+    }
+
+    auto status = Json::GetNumber<int32_t>(jsonStatus);
+    if (status != 200)
+    {
+        throw MasterServerException(STR_SERVER_LIST_MASTER_SERVER_FAILED);
+    }
+
+    auto jServers = root["servers"];
+    if (!jServers.is_array())
+    {
+        throw MasterServerException(STR_SERVER_LIST_INVALID_RESPONSE_JSON_ARRAY);
+    }
+
+    std::vector<ServerListEntry> entries;
+    for (auto& jServer : jServers)
+    {
+        if (jServer.is_object())
+        {
+            auto entry = ServerListEntry::FromJson(jServer);
+            if (entry.has_value())
+            {
+                entries.push_back(std::move(*entry));
+            }
+        }
+    }
+    return entries;
+}
+
+static std::optional<std::vector<ServerListEntry>> ReadServerListCache(const std::string& path)
+{
+    try
+    {
+        if (File::Exists(path))
+        {
+            auto root = Json::ReadFromFile(path);
+            auto age = static_cast<int64_t>(std::time(nullptr)) - Json::GetNumber<int64_t>(root["fetched"]);
+            if (age >= 0 && age < SERVER_LIST_CACHE_LIFETIME)
+            {
+                return ReadMasterServerResponse(root);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to read server list cache: %s", e.what());
+    }
+    return std::nullopt;
+}
+
+static void WriteServerListCache(const std::string& path, json_t& root)
+{
+    try
+    {
+        root["fetched"] = static_cast<int64_t>(std::time(nullptr));
+        Json::WriteToFile(path, root, 0);
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to write server list cache: %s", e.what());
+    }
+}
+
+std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync(bool useCache) const
 {
 #    ifdef DISABLE_HTTP
     return {};
@@ -333,6 +411,19 @@ std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync
     auto p = std::make_shared<std::promise<std::vector<ServerListEntry>>>();
     auto f = p->get_future();
 
+    // A recent response from the master server is shown straight away instead of being requested again.
+    auto env = GetContext()->GetPlatformEnvironment();
+    auto cachePath = Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"servers_cache.json");
+    if (useCache)
+    {
+        auto cachedEntries = ReadServerListCache(cachePath);
+        if (cachedEntries.has_value())
+        {
+            p->set_value(std::move(*cachedEntries));
+            return f;
+        }
+    }
+
     std::string masterServerUrl = OPENRCT2_MASTER_SERVER_URL;
     if (!gConfigNetwork.master_server_url.empty())
     {
@@ -343,8 +434,7 @@ std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync
     request.url = masterServerUrl;
     request.method = Http::Method::GET;
     request.header["Accept"] = "application/json";
-    Http::DoAsync(request, [p](Http::Response& response) -> void {
-        json_t root;
+    Http::DoAsync(request, [p, cachePath](Http::Response& response) -> void {
         try
         {
             if (response.status != Http::Status::Ok)
@@ -352,42 +442,10 @@ std::future<std::vector<ServerListEntry>> ServerList::FetchOnlineServerListAsync
                 throw MasterServerException(STR_SERVER_LIST_NO_CONNECTION);
             }
 
-            root = Json::FromString(response.body);
-            if (root.is_object())
-            {
-                auto jsonStatus = root["status"];
-                if (!jsonStatus.is_number_integer())
-                {
-                    throw MasterServerException(STR_SERVER_LIST_INVALID_RESPONSE_JSON_NUMBER);
-                }
-
-                auto status = Json::GetNumber<int32_t>(jsonStatus);
-                if (status != 200)
-                {
-                    throw MasterServerException(STR_SERVER_LIST_MASTER_SERVER_FAILED);
-                }
-
-                auto jServers = root["servers"];
-                if (!jServers.is_array())
-                {
-                    throw MasterServerException(STR_SERVER_LIST_INVALID_RESPONSE_JSON_ARRAY);
-                }
-
-                std::vector<ServerListEntry> entries;
-                for (auto& jServer : jServers)
-                {
-                    if (jServer.is_object())
-                    {
-                        auto entry = ServerListEntry::FromJson(jServer);
-                        if (entry.has_value())
-                        {
-                            entries.push_back(std::move(*entry));
-                        }
-                    }
-                }
-
-                p->set_value(entries);
-            }
+            auto root = Json::FromString(response.body);
+            auto entries = ReadMasterServerResponse(root);
+            WriteServerListCache(cachePath, root);
+            p->set_value(std::move(entries));
         }
         catch (...)
         {
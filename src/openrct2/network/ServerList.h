@@ -66,7 +66,11 @@ public:
     void WriteFavourites() const;
 
     std::future<std::vector<ServerListEntry>> FetchLocalServerListAsync() const;
-    std::future<std::vector<ServerListEntry>> FetchOnlineServerListAsync() const;
+    /**
+     * Fetches the servers advertised by the master server. When useCache is set, a response fetched less than a
+     * minute ago is returned without contacting the master server again.
+     */
+    std::future<std::vector<ServerListEntry>> FetchOnlineServerListAsync(bool useCache) const;
     uint32_t GetTotalPlayerCount() const;
 };
 
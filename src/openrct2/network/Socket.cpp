@@ -49,6 +49,7 @@
     #include <netdb.h>
     #include <netinet/in.h>
     #include <netinet/tcp.h>
+    #include <poll.h>
     #include <sys/ioctl.h>
     #include <sys/socket.h>
     #include "../common.h"
@@ -621,6 +622,11 @@ public:
         return _ipAddress;
     }
 
+    SOCKET GetSocket() const
+    {
+        return _socket;
+    }
+
 private:
     explicit TcpSocket(SOCKET socket, std::string hostName, std::string ipAddress) noexcept
         : _status(SocketStatus::Connected)
@@ -872,6 +878,50 @@ std::unique_ptr<ITcpSocket> CreateTcpSocket()
     return std::make_unique<TcpSocket>();
 }
 
+std::vector<bool> GetReadyTcpSockets(const std::vector<const ITcpSocket*>& sockets)
+{
+    std::vector<bool> result(sockets.size(), true);
+#    if !defined(_WIN32_WINNT) || _WIN32_WINNT >= 0x0600
+    std::vector<pollfd> fds;
+    std::vector<size_t> fdIndices;
+    fds.reserve(sockets.size());
+    fdIndices.reserve(sockets.size());
+    for (size_t i = 0; i < sockets.size(); i++)
+    {
+        // All TCP sockets are created by CreateTcpSocket.
+        const auto socket = static_cast<const TcpSocket*>(sockets[i])->GetSocket();
+        if (socket != INVALID_SOCKET)
+        {
+            pollfd fd{};
+            fd.fd = socket;
+            fd.events = POLLIN;
+            fds.push_back(fd);
+            fdIndices.push_back(i);
+        }
+    }
+    if (fds.empty())
+    {
+        return result;
+    }
+
+#        ifdef _WIN32
+    const auto pollResult = WSAPoll(fds.data(), static_cast<ULONG>(fds.size()), 0);
+#        else
+    const auto pollResult = poll(fds.data(), static_cast<nfds_t>(fds.size()), 0);
+#        endif
+    if (pollResult == SOCKET_ERROR)
+    {
+        // Let the callers find out about the problem from the sockets themselves.
+        return result;
+    }
+    for (size_t i = 0; i < fds.size(); i++)
+    {
+        result[fdIndices[i]] = fds[i].revents != 0;
+    }
+#    endif
+    return result;
+}
+
 std::unique_ptr<IUdpSocket> CreateUdpSocket()
 {
     InitialiseWSA();
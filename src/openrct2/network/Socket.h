@@ -99,6 +99,11 @@ public:
 };
 
 [[nodiscard]] std::unique_ptr<ITcpSocket> CreateTcpSocket();
+/**
+ * Checks with a single system call which of the given sockets have data or a connection waiting, or an error to
+ * report. Sockets that can't be checked are reported as ready, so callers find out about their state when using them.
+ */
+[[nodiscard]] std::vector<bool> GetReadyTcpSockets(const std::vector<const ITcpSocket*>& sockets);
 [[nodiscard]] std::unique_ptr<IUdpSocket> CreateUdpSocket();
 [[nodiscard]] std::vector<std::unique_ptr<INetworkEndpoint>> GetBroadcastAddresses();
 
@@ -12,9 +12,12 @@
 #include "../Context.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
+#include "../core/Crypt.h"
 #include "../core/File.h"
 #include "../core/FileScanner.h"
+#include "../core/FileStream.h"
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/Json.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -24,12 +27,18 @@
 #include "ObjectFactory.h"
 
 #include <algorithm>
+#include <exception>
 #include <memory>
+#include <random>
 #include <stdexcept>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
+// Bump whenever ImageImporter converts the same source images differently.
+static constexpr uint16_t IMAGE_CACHE_VERSION = 1;
+static constexpr uint32_t IMAGE_CACHE_MAGIC = 0x43474D49; // IMGC
+
 struct ImageTable::RequiredImage
 {
     rct_g1_element g1{};
@@ -424,7 +433,7 @@ ImageTable::~ImageTable()
 
 void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 {
-    if (gOpenRCT2NoGraphics)
+    if (!context->ShouldLoadImages())
     {
         return;
     }
@@ -494,6 +503,8 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
 std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObjectContext* context, json_t& jsonImages)
 {
     std::vector<std::pair<std::string, Image>> result;
+    std::vector<std::vector<uint8_t>> imageData;
+    std::vector<IMAGE_FORMAT> imageFormats;
     for (auto& jsonImage : jsonImages)
     {
         if (jsonImage.is_object())
@@ -505,17 +516,242 @@ std::vector<std::pair<std::string, Image>> ImageTable::GetImageSources(IReadObje
             });
             if (itSource == result.end())
             {
-                auto imageData = context->GetData(path);
-                auto imageFormat = keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32;
-                auto image = Imaging::ReadFromBuffer(imageData, imageFormat);
-                auto pair = std::make_pair<std::string, Image>(std::move(path), std::move(image));
-                result.push_back(std::move(pair));
+                imageData.push_back(context->GetData(path));
+                imageFormats.push_back(keepPalette ? IMAGE_FORMAT::PNG : IMAGE_FORMAT::PNG_32);
+                result.emplace_back(std::move(path), Image{});
+            }
+        }
+    }
+
+    // The data is read in order as archives can not be read from several threads, only the decoding is spread out.
+    std::vector<std::exception_ptr> errors(result.size());
+    JobPool::ParallelFor(0, result.size(), 1, [&](size_t i) {
+        try
+        {
+            result[i].second = Imaging::ReadFromBuffer(imageData[i], imageFormats[i]);
+        }
+        catch (...)
+        {
+            errors[i] = std::current_exception();
+        }
+        imageData[i] = {};
+    });
+    for (auto& error : errors)
+    {
+        if (error != nullptr)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+    return result;
+}
+
+size_t ImageTable::FindImageSource(const std::vector<std::pair<std::string, Image>>& imageSources, json_t& jsonImage)
+{
+    if (jsonImage.is_object())
+    {
+        auto path = Json::GetString(jsonImage["path"]);
+        auto itSource = std::find_if(
+            imageSources.begin(), imageSources.end(),
+            [&path](const std::pair<std::string, Image>& item) { return item.first == path; });
+        return std::distance(imageSources.begin(), itSource);
+    }
+    return imageSources.size();
+}
+
+std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadJsonImages(
+    IReadObjectContext* context, json_t& jsonImages)
+{
+    std::vector<std::unique_ptr<RequiredImage>> allImages;
+    auto imageSources = GetImageSources(context, jsonImages);
+
+    // Source images are decoded to 32-bit and can be large, so each one is freed as soon as the last image that is
+    // cut from it has been imported.
+    std::vector<size_t> sourceLastUse(imageSources.size());
+    size_t jsonIndex = 0;
+    for (auto& jsonImage : jsonImages)
+    {
+        auto sourceIndex = FindImageSource(imageSources, jsonImage);
+        if (sourceIndex < imageSources.size())
+        {
+            sourceLastUse[sourceIndex] = jsonIndex;
+        }
+        jsonIndex++;
+    }
+
+    jsonIndex = 0;
+    for (auto& jsonImage : jsonImages)
+    {
+        if (jsonImage.is_string())
+        {
+            auto strImage = jsonImage.get<std::string>();
+            auto images = ParseImages(context, strImage);
+            allImages.insert(
+                allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+        }
+        else if (jsonImage.is_object())
+        {
+            auto images = ParseImages(context, imageSources, jsonImage);
+            allImages.insert(
+                allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+
+            auto sourceIndex = FindImageSource(imageSources, jsonImage);
+            if (sourceIndex < imageSources.size() && sourceLastUse[sourceIndex] == jsonIndex)
+            {
+                imageSources[sourceIndex].second = {};
+            }
+        }
+        jsonIndex++;
+    }
+    return allImages;
+}
+
+std::string ImageTable::GetImageCachePath(IReadObjectContext* context, json_t& jsonImages)
+{
+    // Only images converted from files of the object can be cached, the others depend on g1, the CSG or other objects.
+    std::vector<std::string> paths;
+    for (auto& jsonImage : jsonImages)
+    {
+        std::string path;
+        if (jsonImage.is_object())
+        {
+            path = Json::GetString(jsonImage["path"]);
+        }
+        else if (jsonImage.is_string())
+        {
+            path = jsonImage.get<std::string>();
+        }
+        if (path.empty() || path[0] == '$')
+        {
+            return {};
+        }
+        if (std::find(paths.begin(), paths.end(), path) == paths.end())
+        {
+            paths.push_back(path);
+        }
+    }
+    auto* openrct2Context = GetContext();
+    if (paths.empty() || openrct2Context == nullptr)
+    {
+        return {};
+    }
+
+    auto hash = Crypt::CreateFNV1a();
+    hash->Update(&IMAGE_CACHE_VERSION, sizeof(IMAGE_CACHE_VERSION));
+    auto settings = jsonImages.dump();
+    hash->Update(settings.data(), settings.size());
+    for (const auto& path : paths)
+    {
+        auto data = context->GetData(path);
+        if (data.empty())
+        {
+            return {};
+        }
+        auto length = static_cast<uint64_t>(data.size());
+        hash->Update(&length, sizeof(length));
+        hash->Update(data.data(), data.size());
+    }
+
+    std::string fileName;
+    for (auto b : hash->Finish())
+    {
+        fileName += String::StdFormat("%02x", b);
+    }
+    auto env = openrct2Context->GetPlatformEnvironment();
+    return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"images", fileName + u8".dat");
+}
+
+std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::ReadImageCache(const std::string& path)
+{
+    std::vector<std::unique_ptr<RequiredImage>> result;
+    if (!File::Exists(path))
+    {
+        return result;
+    }
+
+    try
+    {
+        auto fs = FileStream(path, FILE_MODE_OPEN);
+        if (fs.ReadValue<uint32_t>() != IMAGE_CACHE_MAGIC || fs.ReadValue<uint16_t>() != IMAGE_CACHE_VERSION)
+        {
+            return result;
+        }
+
+        auto numImages = fs.ReadValue<uint32_t>();
+        for (uint32_t i = 0; i < numImages; i++)
+        {
+            auto image = std::make_unique<RequiredImage>();
+            image->g1.width = fs.ReadValue<int16_t>();
+            image->g1.height = fs.ReadValue<int16_t>();
+            image->g1.x_offset = fs.ReadValue<int16_t>();
+            image->g1.y_offset = fs.ReadValue<int16_t>();
+            image->g1.flags = fs.ReadValue<uint16_t>();
+            image->g1.zoomed_offset = fs.ReadValue<int32_t>();
+            auto length = fs.ReadValue<uint32_t>();
+            if (length > fs.GetLength() - fs.GetPosition())
+            {
+                throw IOException("Image data exceeds the end of the file.");
+            }
+            if (length > 0)
+            {
+                image->g1.offset = new uint8_t[length];
+                fs.Read(image->g1.offset, length);
             }
+            result.push_back(std::move(image));
         }
     }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to read image cache '%s': %s", path.c_str(), e.what());
+        result.clear();
+    }
     return result;
 }
 
+void ImageTable::WriteImageCache(const std::string& path, const std::vector<std::unique_ptr<RequiredImage>>& images)
+{
+    // Do not cache images that failed to load, so their warnings are reported again next time.
+    if (!std::all_of(images.begin(), images.end(), [](const auto& image) { return image->HasData(); }))
+    {
+        return;
+    }
+
+    // Several objects or instances can write to the cache at once, so write to a file of our own and move it into place.
+    auto tempPath = path + "." + std::to_string(std::random_device{}()) + ".tmp";
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(path));
+        {
+            auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+            fs.WriteValue<uint32_t>(IMAGE_CACHE_MAGIC);
+            fs.WriteValue<uint16_t>(IMAGE_CACHE_VERSION);
+            fs.WriteValue<uint32_t>(static_cast<uint32_t>(images.size()));
+            for (const auto& image : images)
+            {
+                const auto& g1 = image->g1;
+                fs.WriteValue<int16_t>(g1.width);
+                fs.WriteValue<int16_t>(g1.height);
+                fs.WriteValue<int16_t>(g1.x_offset);
+                fs.WriteValue<int16_t>(g1.y_offset);
+                fs.WriteValue<uint16_t>(g1.flags);
+                fs.WriteValue<int32_t>(g1.zoomed_offset);
+                auto length = static_cast<uint32_t>(g1_calculate_data_size(&g1));
+                fs.WriteValue<uint32_t>(length);
+                fs.Write(g1.offset, length);
+            }
+        }
+        if (!File::Move(tempPath, path))
+        {
+            throw std::runtime_error("Unable to move the image cache into place.");
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to write image cache '%s': %s", path.c_str(), e.what());
+        File::Delete(tempPath);
+    }
+}
+
 bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
 {
     Guard::Assert(root.is_object(), "ImageTable::ReadJson expects parameter root to be object");
@@ -533,31 +769,28 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
             usesFallbackSprites = true;
         }
 
-        auto imageSources = GetImageSources(context, jsonImages);
-
-        for (auto& jsonImage : jsonImages)
+        // Converting images is expensive, so the converted images are cached on disk, keyed by their sources and
+        // import settings.
+        auto cachePath = GetImageCachePath(context, jsonImages);
+        if (!cachePath.empty())
         {
-            if (jsonImage.is_string())
-            {
-                auto strImage = jsonImage.get<std::string>();
-                auto images = ParseImages(context, strImage);
-                allImages.insert(
-                    allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
-            }
-            else if (jsonImage.is_object())
+            allImages = ReadImageCache(cachePath);
+        }
+        if (allImages.empty())
+        {
+            allImages = LoadJsonImages(context, jsonImages);
+            if (!cachePath.empty())
             {
-                auto images = ParseImages(context, imageSources, jsonImage);
-                allImages.insert(
-                    allImages.end(), std::make_move_iterator(images.begin()), std::make_move_iterator(images.end()));
+                WriteImageCache(cachePath, allImages);
             }
         }
 
-        // Now add all the images to the image table
+        // Now add all the images to the image table, handing over their pixel data rather than copying it
         auto imagesStartIndex = GetCount();
         for (const auto& img : allImages)
         {
-            const auto& g1 = img->g1;
-            AddImage(&g1);
+            _entries.push_back(img->g1);
+            img->g1.offset = nullptr;
         }
 
         // Add all the zoom images at the very end of the image table.
@@ -565,7 +798,7 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
         for (size_t j = 0; j < allImages.size(); j++)
         {
             const auto tableIndex = imagesStartIndex + j;
-            const auto* img = allImages[j].get();
+            auto* img = allImages[j].get();
             if (img->next_zoom != nullptr)
             {
                 img = img->next_zoom.get();
@@ -581,7 +814,8 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
                     {
                         g1b.zoomed_offset = -1;
                     }
-                    AddImage(&g1b);
+                    _entries.push_back(g1b);
+                    img->g1.offset = nullptr;
                     img = img->next_zoom.get();
                 }
             }
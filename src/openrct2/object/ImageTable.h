@@ -34,6 +34,11 @@ private:
      */
     struct RequiredImage;
     [[nodiscard]] std::vector<std::pair<std::string, Image>> GetImageSources(IReadObjectContext* context, json_t& jsonImages);
+    /**
+     * Returns the index of the source image used by jsonImage, or the size of imageSources if it does not use one.
+     */
+    [[nodiscard]] static size_t FindImageSource(
+        const std::vector<std::pair<std::string, Image>>& imageSources, json_t& jsonImage);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ParseImages(
         IReadObjectContext* context, std::string s);
     /**
@@ -43,6 +48,14 @@ private:
         IReadObjectContext* context, std::vector<std::pair<std::string, Image>>& imageSources, json_t& el);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadObjectImages(
         IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range);
+    [[nodiscard]] std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadJsonImages(
+        IReadObjectContext* context, json_t& jsonImages);
+    /**
+     * Returns the path the converted images are cached at, or an empty string if they can not be cached.
+     */
+    [[nodiscard]] static std::string GetImageCachePath(IReadObjectContext* context, json_t& jsonImages);
+    [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> ReadImageCache(const std::string& path);
+    static void WriteImageCache(const std::string& path, const std::vector<std::unique_ptr<ImageTable::RequiredImage>>& images);
     [[nodiscard]] static std::vector<int32_t> ParseRange(std::string s);
     [[nodiscard]] static std::string FindLegacyObject(const std::string& name);
     [[nodiscard]] static std::vector<std::unique_ptr<ImageTable::RequiredImage>> LoadImageArchiveImages(
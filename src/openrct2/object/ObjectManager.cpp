@@ -12,6 +12,7 @@
 #include "../Context.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/JobPool.h"
 #include "../core/Memory.hpp"
 #include "../localisation/StringIds.h"
 #include "../ride/Ride.h"
@@ -28,9 +29,10 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <memory>
 #include <mutex>
-#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 class ObjectManager final : public IObjectManager
@@ -41,6 +43,10 @@ private:
     std::vector<Object*> _loadedObjects;
     std::array<std::vector<ObjectEntryIndex>, RIDE_TYPE_COUNT> _rideTypeToObjectMap;
 
+    // Objects unloaded by the last park change. They stay read so that switching back to the previous park, as title
+    // sequences and server rotations do, only has to load them again. Keyed by repository item id.
+    std::unordered_map<size_t, std::shared_ptr<Object>> _retainedObjects;
+
     // Used to return a safe empty vector back from GetAllRideEntries, can be removed when std::span is available
     std::vector<ObjectEntryIndex> _nullRideTypeEntries;
 
@@ -214,6 +220,7 @@ public:
         {
             UnloadObject(object);
         }
+        _retainedObjects.clear();
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
     }
@@ -390,9 +397,10 @@ private:
             }
         }
 
-        // Unload objects that are not in the hash set
+        // Unload objects that are not in the hash set, keeping them around until the next park change
         size_t totalObjectsLoaded = 0;
         size_t numObjectsUnloaded = 0;
+        std::unordered_map<size_t, std::shared_ptr<Object>> retainedObjects;
         for (auto* object : _loadedObjects)
         {
             if (object == nullptr)
@@ -401,10 +409,16 @@ private:
             totalObjectsLoaded++;
             if (exceptSet.find(object) == exceptSet.end())
             {
+                const auto* ori = _objectRepository.FindObject(object->GetDescriptor());
+                if (ori != nullptr && ori->LoadedObject.get() == object)
+                {
+                    retainedObjects.emplace(ori->Id, ori->LoadedObject);
+                }
                 UnloadObject(object);
                 numObjectsUnloaded++;
             }
         }
+        _retainedObjects = std::move(retainedObjects);
 
         log_verbose("%u / %u objects unloaded", numObjectsUnloaded, totalObjectsLoaded);
     }
@@ -504,30 +518,6 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     void LoadObjects(std::vector<const ObjectRepositoryItem*>& requiredObjects)
     {
         std::vector<Object*> objects;
@@ -536,19 +526,37 @@ private:
         objects.resize(OBJECT_ENTRY_COUNT);
         newLoadedObjects.reserve(OBJECT_ENTRY_COUNT);
 
-        // Read objects
+        auto loadStartTime = std::chrono::high_resolution_clock::now();
+
+        // Read objects, objects vary a lot in size so hand them out in small chunks.
         std::mutex commonMutex;
-        ParallelFor(requiredObjects, [this, &commonMutex, requiredObjects, &objects, &badObjects, &newLoadedObjects](size_t i) {
+        JobPool::ParallelFor(0, requiredObjects.size(), 4, [&](size_t i) {
             auto* requiredObject = requiredObjects[i];
             Object* object = nullptr;
             if (requiredObject != nullptr)
             {
                 auto* loadedObject = requiredObject->LoadedObject.get();
-                if (loadedObject == nullptr)
+                // Repository ids are reassigned when the repository is scanned again, so check it is the same object.
+                auto retainedObject = _retainedObjects.find(requiredObject->Id);
+                if (loadedObject == nullptr && retainedObject != _retainedObjects.end()
+                    && retainedObject->second->GetDescriptor() == ObjectEntryDescriptor(*requiredObject))
+                {
+                    // Unloaded by the last park change, only needs to be loaded again.
+                    std::lock_guard<std::mutex> guard(commonMutex);
+                    object = retainedObject->second.get();
+                    newLoadedObjects.push_back(object);
+                    _objectRepository.RegisterLoadedObject(requiredObject, retainedObject->second);
+                }
+                else if (loadedObject == nullptr)
                 {
                     // Object requires to be loaded, if the object successfully loads it will register it
                     // as a loaded object otherwise placed into the badObjects list.
+                    auto startTime = std::chrono::high_resolution_clock::now();
                     auto newObject = _objectRepository.LoadObject(requiredObject);
+                    auto duration = std::chrono::duration<float, std::milli>(
+                        std::chrono::high_resolution_clock::now() - startTime);
+                    log_verbose("Read object [%s] in %.2f ms", requiredObject->Identifier.c_str(), duration.count());
+
                     std::lock_guard<std::mutex> guard(commonMutex);
                     if (newObject == nullptr)
                     {
@@ -574,7 +582,10 @@ private:
         // Load objects
         for (auto* obj : newLoadedObjects)
         {
+            auto startTime = std::chrono::high_resolution_clock::now();
             obj->Load();
+            auto duration = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startTime);
+            log_verbose("Loaded object [%s] in %.2f ms", std::string(obj->GetIdentifier()).c_str(), duration.count());
         }
 
         if (!badObjects.empty())
@@ -599,7 +610,9 @@ private:
 
         _loadedObjects = std::move(objects);
 
-        log_verbose("%u / %u new objects loaded", newLoadedObjects.size(), requiredObjects.size());
+        auto loadDuration = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - loadStartTime);
+        log_verbose(
+            "%u / %u new objects loaded in %.2f ms", newLoadedObjects.size(), requiredObjects.size(), loadDuration.count());
     }
 
     Object* GetOrLoadObject(const ObjectRepositoryItem* ori)
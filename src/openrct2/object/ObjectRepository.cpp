@@ -18,6 +18,7 @@
 #include "../core/DataSerialiser.h"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
 #include "../core/Memory.hpp"
@@ -25,8 +26,10 @@
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../interface/Window.h"
 #include "../localisation/Localisation.h"
 #include "../localisation/LocalisationService.h"
+#include "../network/network.h"
 #include "../object/Object.h"
 #include "../park/Legacy.h"
 #include "../platform/Platform.h"
@@ -39,6 +42,7 @@
 #include "ObjectFactory.h"
 #include "ObjectList.h"
 #include "ObjectManager.h"
+#include "ObjectSearchIndex.h"
 #include "RideObject.h"
 
 #include <algorithm>
@@ -178,6 +182,10 @@ class ObjectRepository final : public IObjectRepository
     std::vector<ObjectRepositoryItem> _items;
     ObjectIdentifierMap _newItemMap;
     ObjectEntryMap _itemMap;
+    // Built on first use after the items have changed.
+    ObjectSearchIndex _searchIndex;
+    bool _searchIndexValid{};
+    std::unique_ptr<FileChangeQueue> _userObjectChanges;
 
 public:
     explicit ObjectRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -197,6 +205,7 @@ public:
         auto items = _fileIndex.LoadOrBuild(language);
         AddItems(items);
         SortItems();
+        WatchUserObjects();
     }
 
     void Construct(int32_t language) override
@@ -204,6 +213,55 @@ public:
         auto items = _fileIndex.Rebuild(language);
         AddItems(items);
         SortItems();
+        WatchUserObjects();
+    }
+
+    void CheckForChangedFiles() override
+    {
+        if (_userObjectChanges == nullptr)
+        {
+            return;
+        }
+
+        // Object selection and clients that are downloading the map refer to the items by index and pointer, leave the
+        // changes queued until they are done.
+        if ((gScreenFlags & SCREEN_FLAGS_EDITOR) || window_find_by_class(WC_EDITOR_OBJECT_SELECTION) != nullptr
+            || network_get_mode() != NETWORK_MODE_NONE)
+        {
+            return;
+        }
+
+        auto language = LocalisationService_GetCurrentLanguage();
+        for (const auto& path : _userObjectChanges->TakeChangedFiles())
+        {
+            if (!IsObjectFile(path))
+            {
+                continue;
+            }
+
+            auto* item = FindItemByPath(path);
+            if (item == nullptr)
+            {
+                log_verbose("Adding changed object file '%s'", path.c_str());
+                ScanObject(path);
+                continue;
+            }
+
+            // Loaded objects keep the item they were loaded from, they pick up the changes on the next start.
+            if (item->LoadedObject != nullptr)
+            {
+                continue;
+            }
+
+            auto [created, newItem] = _fileIndex.Create(language, path);
+            if (created && newItem.Identifier == item->Identifier && newItem.ObjectEntry == item->ObjectEntry)
+            {
+                log_verbose("Refreshing changed object file '%s'", path.c_str());
+                newItem.Id = item->Id;
+                *item = std::move(newItem);
+                _searchIndexValid = false;
+            }
+        }
     }
 
     size_t GetNumObjects() const override
@@ -274,7 +332,7 @@ public:
         return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str(), !gOpenRCT2NoGraphics);
     }
 
-    void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::unique_ptr<Object>&& object) override
+    void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::shared_ptr<Object> object) override
     {
         ObjectRepositoryItem* item = &_items[ori->Id];
 
@@ -352,8 +410,20 @@ public:
     }
 
 private:
+    const ObjectSearchIndex& GetSearchIndex() override
+    {
+        if (!_searchIndexValid)
+        {
+            _searchIndex.Build(_items.data(), _items.size());
+            _searchIndexValid = true;
+        }
+        return _searchIndex;
+    }
+
     void ClearItems()
     {
+        _searchIndex.Clear();
+        _searchIndexValid = false;
         _items.clear();
         _newItemMap.clear();
         _itemMap.clear();
@@ -361,6 +431,7 @@ private:
 
     void SortItems()
     {
+        _searchIndexValid = false;
         std::sort(_items.begin(), _items.end(), [](const ObjectRepositoryItem& a, const ObjectRepositoryItem& b) -> bool {
             return String::Compare(a.Name, b.Name) < 0;
         });
@@ -421,6 +492,7 @@ private:
         if (conflict == nullptr)
         {
             size_t index = _items.size();
+            _searchIndexValid = false;
             auto copy = item;
             copy.Id = index;
             _items.push_back(std::move(copy));
@@ -440,6 +512,41 @@ private:
         return false;
     }
 
+    void WatchUserObjects()
+    {
+        if (_userObjectChanges != nullptr)
+        {
+            return;
+        }
+
+        try
+        {
+            auto path = _env->GetDirectoryPath(DIRBASE::USER, DIRID::OBJECT);
+            if (Path::DirectoryExists(path))
+            {
+                _userObjectChanges = std::make_unique<FileChangeQueue>(path);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to watch the user object directory: %s", e.what());
+        }
+    }
+
+    static bool IsObjectFile(const std::string& path)
+    {
+        auto extension = Path::GetExtension(path);
+        return String::Equals(extension, ".dat", true) || String::Equals(extension, ".pob", true)
+            || String::Equals(extension, ".json", true) || String::Equals(extension, ".parkobj", true);
+    }
+
+    ObjectRepositoryItem* FindItemByPath(const std::string& path)
+    {
+        auto it = std::find_if(
+            _items.begin(), _items.end(), [&path](const ObjectRepositoryItem& item) { return Path::Equals(item.Path, path); });
+        return it != _items.end() ? &*it : nullptr;
+    }
+
     void ScanObject(const std::string& path)
     {
         auto language = LocalisationService_GetCurrentLanguage();
@@ -719,6 +826,12 @@ const ObjectRepositoryItem* object_repository_get_items()
     return objectRepository.GetObjects();
 }
 
+const ObjectSearchIndex& object_repository_get_search_index()
+{
+    auto& objectRepository = GetContext()->GetObjectRepository();
+    return objectRepository.GetSearchIndex();
+}
+
 const ObjectRepositoryItem* object_repository_find_object_by_entry(const rct_object_entry* entry)
 {
     auto& objectRepository = GetContext()->GetObjectRepository();
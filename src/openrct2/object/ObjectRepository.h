@@ -33,6 +33,7 @@ namespace OpenRCT2::Localisation
 }
 
 struct rct_drawpixelinfo;
+class ObjectSearchIndex;
 
 struct ObjectRepositoryItem
 {
@@ -76,15 +77,21 @@ struct IObjectRepository
 
     virtual void LoadOrConstruct(int32_t language) abstract;
     virtual void Construct(int32_t language) abstract;
+    /**
+     * Adds the objects that have been written to the user object directory since the last call and refreshes the ones
+     * that are not loaded.
+     */
+    virtual void CheckForChangedFiles() abstract;
     [[nodiscard]] virtual size_t GetNumObjects() const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* GetObjects() const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObjectLegacy(std::string_view legacyIdentifier) const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObject(std::string_view identifier) const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObject(const rct_object_entry* objectEntry) const abstract;
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObject(const ObjectEntryDescriptor& oed) const abstract;
+    [[nodiscard]] virtual const ObjectSearchIndex& GetSearchIndex() abstract;
 
     [[nodiscard]] virtual std::unique_ptr<Object> LoadObject(const ObjectRepositoryItem* ori) abstract;
-    virtual void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::unique_ptr<Object>&& object) abstract;
+    virtual void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::shared_ptr<Object> object) abstract;
     virtual void UnregisterLoadedObject(const ObjectRepositoryItem* ori, Object* object) abstract;
 
     virtual void AddObject(const rct_object_entry* objectEntry, const void* data, size_t dataSize) abstract;
@@ -101,6 +108,7 @@ struct IObjectRepository
 
 [[nodiscard]] size_t object_repository_get_items_count();
 [[nodiscard]] const ObjectRepositoryItem* object_repository_get_items();
+[[nodiscard]] const ObjectSearchIndex& object_repository_get_search_index();
 [[nodiscard]] const ObjectRepositoryItem* object_repository_find_object_by_entry(const rct_object_entry* entry);
 [[nodiscard]] const ObjectRepositoryItem* object_repository_find_object_by_name(const char* name);
 [[nodiscard]] std::unique_ptr<Object> object_repository_load_object(const rct_object_entry* objectEntry);
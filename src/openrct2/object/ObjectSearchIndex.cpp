@@ -0,0 +1,133 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ObjectSearchIndex.h"
+
+#include "../core/String.hpp"
+#include "ObjectRepository.h"
+
+#include <algorithm>
+#include <utility>
+
+static constexpr char FieldSeparator = '\n';
+
+static bool GetTrigram(std::string_view text, size_t index, uint32_t& trigram)
+{
+    const auto a = static_cast<uint8_t>(text[index]);
+    const auto b = static_cast<uint8_t>(text[index + 1]);
+    const auto c = static_cast<uint8_t>(text[index + 2]);
+    if (a == FieldSeparator || b == FieldSeparator || c == FieldSeparator)
+    {
+        return false;
+    }
+    trigram = (a << 16) | (b << 8) | c;
+    return true;
+}
+
+void ObjectSearchIndex::Build(const ObjectRepositoryItem* items, size_t count)
+{
+    Clear();
+
+    std::vector<std::pair<uint32_t, uint32_t>> entries;
+    _texts.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        const auto& item = items[i];
+        std::string text = item.Name;
+        for (const auto& author : item.Authors)
+        {
+            text += FieldSeparator;
+            text += author;
+        }
+        text += FieldSeparator;
+        text += item.Identifier;
+        text += FieldSeparator;
+        text += item.Path;
+        auto& upper = _texts.emplace_back(String::ToUpper(text));
+
+        for (size_t j = 0; j + 3 <= upper.size(); j++)
+        {
+            uint32_t trigram;
+            if (GetTrigram(upper, j, trigram))
+            {
+                entries.emplace_back(trigram, static_cast<uint32_t>(i));
+            }
+        }
+    }
+
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    _ids.reserve(entries.size());
+    for (const auto& [trigram, id] : entries)
+    {
+        if (_trigrams.empty() || _trigrams.back() != trigram)
+        {
+            _trigrams.push_back(trigram);
+            _offsets.push_back(static_cast<uint32_t>(_ids.size()));
+        }
+        _ids.push_back(id);
+    }
+    _offsets.push_back(static_cast<uint32_t>(_ids.size()));
+}
+
+void ObjectSearchIndex::Clear()
+{
+    _texts.clear();
+    _trigrams.clear();
+    _offsets.clear();
+    _ids.clear();
+}
+
+std::vector<bool> ObjectSearchIndex::Search(std::string_view text) const
+{
+    std::vector<bool> result(_texts.size(), text.empty());
+    if (text.empty())
+    {
+        return result;
+    }
+
+    const auto upper = String::ToUpper(text);
+    if (upper.size() < 3 || upper.find(FieldSeparator) != std::string::npos)
+    {
+        // Too short for the index, the texts are already in upper case so this is still cheap.
+        for (size_t i = 0; i < _texts.size(); i++)
+        {
+            result[i] = _texts[i].find(upper) != std::string::npos;
+        }
+        return result;
+    }
+
+    // Only the items that contain the rarest trigram of the text can match.
+    size_t bestBegin = 0;
+    size_t bestEnd = _ids.size() + 1;
+    for (size_t j = 0; j + 3 <= upper.size(); j++)
+    {
+        uint32_t trigram;
+        GetTrigram(upper, j, trigram);
+        auto it = std::lower_bound(_trigrams.begin(), _trigrams.end(), trigram);
+        if (it == _trigrams.end() || *it != trigram)
+        {
+            return result;
+        }
+        const auto index = static_cast<size_t>(it - _trigrams.begin());
+        if (_offsets[index + 1] - _offsets[index] < bestEnd - bestBegin)
+        {
+            bestBegin = _offsets[index];
+            bestEnd = _offsets[index + 1];
+        }
+    }
+
+    for (size_t j = bestBegin; j < bestEnd; j++)
+    {
+        const auto id = _ids[j];
+        result[id] = _texts[id].find(upper) != std::string::npos;
+    }
+    return result;
+}
@@ -0,0 +1,48 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct ObjectRepositoryItem;
+
+/**
+ * Trigram index over the name, authors, identifier and path of the object repository items. A search finds the items
+ * that contain the text anywhere in one of those, ignoring case, by only checking the items that have the rarest
+ * trigram of the text.
+ */
+class ObjectSearchIndex
+{
+private:
+    // Upper case text of each item with the fields separated by new lines, so matches can not span fields.
+    std::vector<std::string> _texts;
+    // Sorted trigrams, _offsets[i] to _offsets[i + 1] are the ids of the items containing _trigrams[i].
+    std::vector<uint32_t> _trigrams;
+    std::vector<uint32_t> _offsets;
+    std::vector<uint32_t> _ids;
+
+public:
+    void Build(const ObjectRepositoryItem* items, size_t count);
+    void Clear();
+
+    size_t GetCount() const
+    {
+        return _texts.size();
+    }
+
+    /**
+     * Returns whether each item, by id, matches text. Every item matches an empty text.
+     */
+    std::vector<bool> Search(std::string_view text) const;
+};
@@ -29,6 +29,52 @@
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
 #include "Paint.h"
+#include "tile_element/Paint.Surface.h"
+
+/**
+ * Marks the tile with a green, yellow or red outline depending on how many guests are on it. Used in place of the guest
+ * sprites when zoomed out too far to paint them.
+ */
+static void PaintCrowdDensity(paint_session& session, const CoordsXY& pos)
+{
+    if (session.ViewFlags & VIEWPORT_FLAG_HIDE_GUESTS)
+    {
+        return;
+    }
+
+    int32_t count = 0;
+    int32_t z = 0;
+    for (auto* spr : EntityTileList(pos))
+    {
+        if (spr->Type == EntityType::Guest)
+        {
+            if (count == 0)
+            {
+                z = spr->z;
+            }
+            count++;
+        }
+    }
+    if (count == 0)
+    {
+        return;
+    }
+
+    colour_t colour = COLOUR_BRIGHT_GREEN;
+    if (count >= 12)
+    {
+        colour = COLOUR_BRIGHT_RED;
+    }
+    else if (count >= 4)
+    {
+        colour = COLOUR_YELLOW;
+    }
+
+    session.CurrentlyDrawnEntity = nullptr;
+    session.SpritePosition = pos;
+    session.InteractionType = ViewportInteractionItem::None;
+    PaintAddImageAsParent(session, ImageId(SPR_TERRAIN_SELECTION_CORNER, colour), { 0, 0, z }, { 32, 32, 1 });
+}
 
 /**
  * Paint Quadrant
@@ -50,6 +96,10 @@ void EntityPaintSetup(paint_session& session, const CoordsXY& pos)
     rct_drawpixelinfo* dpi = &session.DPI;
     if (dpi->zoom_level > ZoomLevel{ 2 })
     {
+        if (session.DetailFlags & PaintDetailFlags::CrowdDensity)
+        {
+            PaintCrowdDensity(session, pos);
+        }
         return;
     }
 
@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <array>
 #include <atomic>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -51,6 +52,7 @@ static constexpr const uint8_t BoundBoxDebugColours[] = {
 };
 
 bool gShowDirtyVisuals;
+bool gShowFrameStats;
 bool gPaintBoundingBoxes;
 bool gPaintBlockedTiles;
 
@@ -241,12 +243,48 @@ template<uint8_t direction> void PaintSessionGenerateRotate(paint_session& sessi
     }
 }
 
+struct PaintLevelOfDetail
+{
+    // Added to the session's view flags.
+    uint32_t ViewFlags;
+    uint8_t DetailFlags;
+};
+
+// Indexed by zoom level. Supports are only a few pixels wide at zoom 2 and below a pixel past it, guests are already
+// skipped past zoom 2 so only their density is shown.
+static constexpr PaintLevelOfDetail LevelOfDetailPolicies[] = {
+    { 0, 0 },
+    { 0, 0 },
+    { 0, 0 },
+    { VIEWPORT_FLAG_HIDE_SUPPORTS | VIEWPORT_FLAG_INVISIBLE_SUPPORTS, PaintDetailFlags::CrowdDensity },
+};
+
+void PaintSessionApplyLevelOfDetail(paint_session& session)
+{
+    session.DetailFlags = 0;
+    if (!gConfigGeneral.level_of_detail)
+    {
+        return;
+    }
+
+    const auto zoom = static_cast<int8_t>(session.DPI.zoom_level);
+    if (zoom < 0)
+    {
+        return;
+    }
+    const auto& policy = LevelOfDetailPolicies[std::min<size_t>(zoom, std::size(LevelOfDetailPolicies) - 1)];
+    session.ViewFlags |= policy.ViewFlags;
+    session.DetailFlags = policy.DetailFlags;
+}
+
 /**
  *
  *  rct2: 0x0068B6C2
  */
 void PaintSessionGenerate(paint_session& session)
 {
+    PROFILED_FRAME_STAGE(PaintGenerate);
+
     session.CurrentRotation = get_current_rotation();
     switch (DirectionFlipXAxis(session.CurrentRotation))
     {
@@ -320,7 +358,7 @@ namespace PaintSortFlags
 } // namespace PaintSortFlags
 
 template<uint8_t TRotation>
-static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag)
+static paint_struct* PaintArrangeStructsHelperRotationReference(paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag)
 {
     paint_struct* ps;
     paint_struct* ps_temp;
@@ -427,13 +465,169 @@ static paint_struct* PaintArrangeStructsHelperRotation(paint_struct* ps_next, ui
     }
 }
 
-template<int TRotation> static void PaintSessionArrange(PaintSessionCore& session, bool)
+/**
+ * The sort keys of the nodes being arranged, kept apart from the paint structs so the bounding box tests only touch the
+ * flags and bounds. All three arrays are indexed by the position of the node in the arranged order.
+ */
+struct PaintSortKeys
+{
+    std::vector<paint_struct_bound_box> Bounds;
+    std::vector<uint8_t> SortFlags;
+    std::vector<paint_struct*> Structs;
+
+    void Clear()
+    {
+        Bounds.clear();
+        SortFlags.clear();
+        Structs.clear();
+    }
+
+    void Push(paint_struct* ps)
+    {
+        Bounds.push_back(ps->bounds);
+        SortFlags.push_back(ps->SortFlags);
+        Structs.push_back(ps);
+    }
+
+    // Moves the node at index from to index to, shifting the nodes in between one position back.
+    void MoveBefore(size_t from, size_t to)
+    {
+        const auto bounds = Bounds[from];
+        const auto sortFlags = SortFlags[from];
+        auto* ps = Structs[from];
+        std::move_backward(Bounds.begin() + to, Bounds.begin() + from, Bounds.begin() + from + 1);
+        std::move_backward(SortFlags.begin() + to, SortFlags.begin() + from, SortFlags.begin() + from + 1);
+        std::move_backward(Structs.begin() + to, Structs.begin() + from, Structs.begin() + from + 1);
+        Bounds[to] = bounds;
+        SortFlags[to] = sortFlags;
+        Structs[to] = ps;
+    }
+};
+
+/**
+ * Produces exactly the same order as PaintArrangeStructsHelperRotationReference. The nodes from the first node of the
+ * quadrant up to the first one outside of the quadrant range are copied into contiguous arrays, so the pairwise bounding
+ * box tests run over the arrays instead of chasing next_quadrant_ps and moving a node behind another is a short move.
+ */
+template<uint8_t TRotation>
+static paint_struct* PaintArrangeStructsHelperRotation(
+    paint_struct* ps_next, uint16_t quadrantIndex, uint8_t flag, PaintSortKeys& keys)
+{
+    paint_struct* ps;
+
+    // Get the first node in the specified quadrant.
+    do
+    {
+        ps = ps_next;
+        ps_next = ps_next->next_quadrant_ps;
+        if (ps_next == nullptr)
+            return ps;
+    } while (quadrantIndex > ps_next->quadrant_index);
+
+    paint_struct* psQuadrantEntry = ps;
+
+    // Determine the sorting relevancy of the nodes, the same way the reference does.
+    do
+    {
+        ps = ps->next_quadrant_ps;
+        if (ps == nullptr)
+            break;
+
+        if (ps->quadrant_index > quadrantIndex + 1)
+        {
+            ps->SortFlags = PaintSortFlags::OutsideQuadrant;
+        }
+        else if (ps->quadrant_index == quadrantIndex + 1)
+        {
+            ps->SortFlags = PaintSortFlags::Neighbour | PaintSortFlags::PendingVisit;
+        }
+        else if (ps->quadrant_index == quadrantIndex)
+        {
+            ps->SortFlags = flag | PaintSortFlags::PendingVisit;
+        }
+    } while (ps->quadrant_index <= quadrantIndex + 1);
+
+    keys.Clear();
+    ps = psQuadrantEntry->next_quadrant_ps;
+    while (ps != nullptr && !(ps->SortFlags & PaintSortFlags::OutsideQuadrant))
+    {
+        keys.Push(ps);
+        ps = ps->next_quadrant_ps;
+    }
+    paint_struct* psTail = ps;
+
+    auto& bounds = keys.Bounds;
+    auto& sortFlags = keys.SortFlags;
+    const size_t count = sortFlags.size();
+    size_t searchIndex = 0;
+    while (true)
+    {
+        // Get the first pending node.
+        size_t current = searchIndex;
+        while (current < count && !(sortFlags[current] & PaintSortFlags::PendingVisit))
+        {
+            current++;
+        }
+        if (current == count)
+        {
+            break;
+        }
+
+        // Mark visited.
+        sortFlags[current] &= ~PaintSortFlags::PendingVisit;
+
+        // Neighbours that intersect with the current node are moved in front of it, in the order they are found.
+        const size_t insertIndex = current;
+        const auto initialBBox = bounds[current];
+        for (size_t i = current + 1; i < count; i++)
+        {
+            if (!(sortFlags[i] & PaintSortFlags::Neighbour))
+                continue;
+
+            if (CheckBoundingBox<TRotation>(initialBBox, bounds[i]))
+            {
+                keys.MoveBefore(i, insertIndex);
+            }
+        }
+
+        // Continue with the first node after the one preceding the visited node.
+        searchIndex = insertIndex;
+    }
+
+    // Write the new order and flags back to the list.
+    ps = psQuadrantEntry;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto* psEntry = keys.Structs[i];
+        psEntry->SortFlags = sortFlags[i];
+        ps->next_quadrant_ps = psEntry;
+        ps = psEntry;
+    }
+    ps->next_quadrant_ps = psTail;
+
+    return psQuadrantEntry;
+}
+
+template<int TRotation, bool TReference> static void PaintSessionArrange(PaintSessionCore& session)
 {
     paint_struct* psHead = &session.PaintHead;
 
     paint_struct* ps = psHead;
     ps->next_quadrant_ps = nullptr;
 
+    // Columns are arranged in parallel, so every thread keeps its own scratch space.
+    thread_local PaintSortKeys keys;
+    auto arrangeQuadrant = [](paint_struct* psNext, uint16_t quadrantIndex, uint8_t flag) {
+        if constexpr (TReference)
+        {
+            return PaintArrangeStructsHelperRotationReference<TRotation>(psNext, quadrantIndex, flag);
+        }
+        else
+        {
+            return PaintArrangeStructsHelperRotation<TRotation>(psNext, quadrantIndex, flag, keys);
+        }
+    };
+
     uint32_t quadrantIndex = session.QuadrantBackIndex;
     if (quadrantIndex != UINT32_MAX)
     {
@@ -452,42 +646,49 @@ template<int TRotation> static void PaintSessionArrange(PaintSessionCore& sessio
             }
         } while (++quadrantIndex <= session.QuadrantFrontIndex);
 
-        paint_struct* ps_cache = PaintArrangeStructsHelperRotation<TRotation>(
-            psHead, session.QuadrantBackIndex & 0xFFFF, PaintSortFlags::Neighbour);
+        paint_struct* ps_cache = arrangeQuadrant(psHead, session.QuadrantBackIndex & 0xFFFF, PaintSortFlags::Neighbour);
 
         quadrantIndex = session.QuadrantBackIndex;
         while (++quadrantIndex < session.QuadrantFrontIndex)
         {
-            ps_cache = PaintArrangeStructsHelperRotation<TRotation>(ps_cache, quadrantIndex & 0xFFFF, PaintSortFlags::None);
+            ps_cache = arrangeQuadrant(ps_cache, quadrantIndex & 0xFFFF, PaintSortFlags::None);
         }
     }
 }
 
-/**
- *
- *  rct2: 0x00688217
- */
-void PaintSessionArrange(PaintSessionCore& session)
+template<bool TReference> static void PaintSessionArrange(PaintSessionCore& session)
 {
-    PROFILED_FUNCTION();
     switch (session.CurrentRotation)
     {
         case 0:
-            return PaintSessionArrange<0>(session, true);
+            return PaintSessionArrange<0, TReference>(session);
         case 1:
-            return PaintSessionArrange<1>(session, true);
+            return PaintSessionArrange<1, TReference>(session);
         case 2:
-            return PaintSessionArrange<2>(session, true);
+            return PaintSessionArrange<2, TReference>(session);
         case 3:
-            return PaintSessionArrange<3>(session, true);
+            return PaintSessionArrange<3, TReference>(session);
     }
     Guard::Assert(false);
 }
 
-static void PaintDrawStruct(paint_session& session, paint_struct* ps)
+/**
+ *
+ *  rct2: 0x00688217
+ */
+void PaintSessionArrange(PaintSessionCore& session)
 {
-    rct_drawpixelinfo* dpi = &session.DPI;
+    PROFILED_FRAME_STAGE(PaintArrange);
+    PaintSessionArrange<false>(session);
+}
 
+void PaintSessionArrangeReference(PaintSessionCore& session)
+{
+    PaintSessionArrange<true>(session);
+}
+
+static void PaintDrawStruct(paint_session& session, rct_drawpixelinfo* dpi, paint_struct* ps)
+{
     auto x = ps->x;
     auto y = ps->y;
 
@@ -517,7 +718,7 @@ static void PaintDrawStruct(paint_session& session, paint_struct* ps)
 
     if (ps->children != nullptr)
     {
-        PaintDrawStruct(session, ps->children);
+        PaintDrawStruct(session, dpi, ps->children);
     }
     else
     {
@@ -531,13 +732,18 @@ static void PaintDrawStruct(paint_session& session, paint_struct* ps)
  */
 void PaintDrawStructs(paint_session& session)
 {
-    PROFILED_FUNCTION();
+    PaintDrawStructs(session, &session.DPI);
+}
+
+void PaintDrawStructs(paint_session& session, rct_drawpixelinfo* dpi)
+{
+    PROFILED_FRAME_STAGE(PaintDraw);
 
     paint_struct* ps = &session.PaintHead;
 
     for (ps = ps->next_quadrant_ps; ps != nullptr;)
     {
-        PaintDrawStruct(session, ps);
+        PaintDrawStruct(session, dpi, ps);
 
         ps = ps->next_quadrant_ps;
     }
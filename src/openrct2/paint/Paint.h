@@ -185,6 +185,12 @@ public:
     void FreeNodes(Node* head);
 };
 
+namespace PaintDetailFlags
+{
+    // Guests are not painted at this zoom, mark how crowded each tile is instead.
+    constexpr uint8_t CrowdDensity = 1 << 0;
+} // namespace PaintDetailFlags
+
 struct PaintSessionCore
 {
     paint_struct PaintHead;
@@ -215,6 +221,8 @@ struct PaintSessionCore
     uint8_t VerticalTunnelHeight;
     uint8_t CurrentRotation;
     uint8_t Flags;
+    // PaintDetailFlags, unlike Flags these stay the same for the whole session.
+    uint8_t DetailFlags;
     ViewportInteractionItem InteractionType;
 };
 
@@ -294,6 +302,7 @@ extern CoordsXY gClipSelectionB;
 /** rct2: 0x00993CC4. The white ghost that indicates not-yet-built elements. */
 #define CONSTRUCTION_MARKER (COLOUR_DARK_GREEN << 19 | COLOUR_GREY << 24 | IMAGE_TYPE_REMAP)
 extern bool gShowDirtyVisuals;
+extern bool gShowFrameStats;
 extern bool gPaintBoundingBoxes;
 extern bool gPaintBlockedTiles;
 extern bool gPaintWidePathsAsGhost;
@@ -339,9 +348,23 @@ void PaintFloatingMoneyEffect(
 
 paint_session* PaintSessionAlloc(rct_drawpixelinfo* dpi, uint32_t viewFlags);
 void PaintSessionFree(paint_session* session);
+/**
+ * Drops the detail that would end up smaller than a pixel at the session's zoom level, if level of detail is enabled.
+ */
+void PaintSessionApplyLevelOfDetail(paint_session& session);
 void PaintSessionGenerate(paint_session& session);
 void PaintSessionArrange(PaintSessionCore& session);
+/**
+ * The original linked list implementation of PaintSessionArrange. It produces the same order and is kept as the
+ * reference the array based one is tested and benchmarked against.
+ */
+void PaintSessionArrangeReference(PaintSessionCore& session);
 void PaintDrawStructs(paint_session& session);
+/**
+ * Draws the arranged paint structs of the session into dpi instead of the session's own, which must lie within the
+ * session's one. Drawing parts of a session into disjoint areas gives the same pixels as drawing it at once.
+ */
+void PaintDrawStructs(paint_session& session, rct_drawpixelinfo* dpi);
 void PaintDrawMoneyStructs(rct_drawpixelinfo* dpi, paint_string_struct* ps);
 
 // TESTING
@@ -18,6 +18,7 @@
 #include "../drawing/IDrawingEngine.h"
 #include "../interface/Chat.h"
 #include "../interface/InteractiveConsole.h"
+#include "../interface/Window_internal.h"
 #include "../localisation/FormatCodes.h"
 #include "../localisation/Formatting.h"
 #include "../localisation/Language.h"
@@ -38,7 +39,7 @@ Painter::Painter(const std::shared_ptr<IUiContext>& uiContext)
 
 void Painter::Paint(IDrawingEngine& de)
 {
-    PROFILED_FUNCTION();
+    PROFILED_FRAME_STAGE(Ui);
 
     auto dpi = de.GetDrawingPixelInfo();
     if (gIntroState != IntroState::None)
@@ -80,6 +81,14 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(dpi);
     }
+    if (gShowWindowDrawTimes)
+    {
+        PaintWindowDrawTimes(dpi);
+    }
+    if (gShowFrameStats)
+    {
+        PaintFrameStats(dpi);
+    }
     gCurrentDrawCount++;
 }
 
@@ -118,6 +127,104 @@ void Painter::PaintFPS(rct_drawpixelinfo* dpi)
     gfx_set_dirty_blocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { dpi->lastStringPos.x + 16, 16 } });
 }
 
+void Painter::PaintWindowDrawTimes(rct_drawpixelinfo* dpi)
+{
+    // Show the time spent per second rather than per frame, most frames only redraw parts of a window.
+    auto currentTime = time(nullptr);
+    bool newSecond = currentTime != _lastDrawTimesSecond;
+    _lastDrawTimesSecond = currentTime;
+
+    window_visit_each([dpi, newSecond](rct_window* w) {
+        if (newSecond)
+        {
+            w->drawTimeLastSecond = w->drawTime;
+            w->drawTime = 0;
+        }
+
+        char buffer[64]{};
+        FormatStringToBuffer(
+            buffer, sizeof(buffer), "{OUTLINE}{WHITE}{COMMA2DP32} ms/s", static_cast<int32_t>(w->drawTimeLastSecond * 100));
+
+        int32_t stringWidth = gfx_get_string_width(buffer, FontSpriteBase::MEDIUM);
+        ScreenCoordsXY screenCoords(w->windowPos.x + w->width - stringWidth - 4, w->windowPos.y + w->height - 14);
+        gfx_draw_string(dpi, screenCoords, buffer);
+
+        // Make area dirty so the text doesn't get drawn over the last
+        gfx_set_dirty_blocks({ screenCoords - ScreenCoordsXY{ 4, 4 }, { dpi->lastStringPos.x + 4, screenCoords.y + 16 } });
+    });
+}
+
+void Painter::PaintFrameStats(rct_drawpixelinfo* dpi)
+{
+    constexpr int32_t RowHeight = 12;
+    constexpr int32_t ColumnWidth = 48;
+    constexpr int32_t NameWidth = 96;
+    constexpr int32_t MaxBarWidth = 3 * ColumnWidth;
+
+    const auto stats = Profiling::GetFrameStats();
+    const ScreenCoordsXY topLeft(4, 32);
+    auto screenCoords = topLeft;
+
+    const auto drawText = [dpi](const ScreenCoordsXY& coords, const char* text) {
+        char buffer[64]{};
+        FormatStringToBuffer(buffer, sizeof(buffer), "{OUTLINE}{WHITE}{STRING}", text);
+        gfx_draw_string(dpi, coords, buffer);
+    };
+    const auto drawRow = [&](const char* name, const Profiling::FrameStats::Percentiles& percentiles) {
+        drawText(screenCoords, name);
+        const double values[] = { percentiles.P50, percentiles.P95, percentiles.P99 };
+        for (size_t i = 0; i < std::size(values); i++)
+        {
+            char buffer[64]{};
+            FormatStringToBuffer(
+                buffer, sizeof(buffer), "{OUTLINE}{WHITE}{COMMA2DP32}", static_cast<int32_t>(values[i] * 100));
+            gfx_draw_string(dpi, screenCoords + ScreenCoordsXY{ NameWidth + static_cast<int32_t>(i) * ColumnWidth, 0 }, buffer);
+        }
+        screenCoords.y += RowHeight;
+    };
+
+    drawText(screenCoords, "ms");
+    drawText(screenCoords + ScreenCoordsXY{ NameWidth, 0 }, "p50");
+    drawText(screenCoords + ScreenCoordsXY{ NameWidth + ColumnWidth, 0 }, "p95");
+    drawText(screenCoords + ScreenCoordsXY{ NameWidth + 2 * ColumnWidth, 0 }, "p99");
+    screenCoords.y += RowHeight;
+
+    drawRow("frame", stats.FrameTime);
+    for (size_t stage = 1; stage < stats.Stages.size(); stage++)
+    {
+        drawRow(Profiling::GetFrameStageName(static_cast<Profiling::FrameStage>(stage)), stats.Stages[stage]);
+    }
+    screenCoords.y += RowHeight / 2;
+
+    // Share of the recorded frames per frame time bucket.
+    for (size_t i = 0; i < stats.Histogram.size(); i++)
+    {
+        char label[32]{};
+        if (i < Profiling::FrameStats::HistogramBounds.size())
+        {
+            snprintf(label, sizeof(label), "< %.1f", Profiling::FrameStats::HistogramBounds[i]);
+        }
+        else
+        {
+            snprintf(label, sizeof(label), ">= %.1f", Profiling::FrameStats::HistogramBounds.back());
+        }
+        drawText(screenCoords, label);
+
+        if (stats.NumFrames != 0 && stats.Histogram[i] != 0)
+        {
+            auto barWidth = std::max<int32_t>(1, static_cast<int32_t>(stats.Histogram[i] * MaxBarWidth / stats.NumFrames));
+            auto barLeftTop = screenCoords + ScreenCoordsXY{ NameWidth, 2 };
+            gfx_fill_rect(
+                dpi, { barLeftTop, barLeftTop + ScreenCoordsXY{ barWidth - 1, RowHeight - 5 } },
+                ColourMapA[COLOUR_BRIGHT_GREEN].mid_light);
+        }
+        screenCoords.y += RowHeight;
+    }
+
+    // Make area dirty so the text doesn't get drawn over the last
+    gfx_set_dirty_blocks({ topLeft - ScreenCoordsXY{ 4, 4 }, { topLeft.x + NameWidth + MaxBarWidth + 16, screenCoords.y } });
+}
+
 void Painter::MeasureFPS()
 {
     _frames++;
@@ -158,6 +265,7 @@ paint_session* Painter::CreateSession(rct_drawpixelinfo* dpi, uint32_t viewFlags
     session->QuadrantFrontIndex = 0;
     session->PaintEntryChain = _paintStructPool.Create();
     session->Flags = 0;
+    PaintSessionApplyLevelOfDetail(*session);
 
     std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->LastPS = nullptr;
@@ -42,6 +42,7 @@ namespace OpenRCT2
             time_t _lastSecond = 0;
             int32_t _currentFPS = 0;
             int32_t _frames = 0;
+            time_t _lastDrawTimesSecond = 0;
 
         public:
             explicit Painter(const std::shared_ptr<Ui::IUiContext>& uiContext);
@@ -54,6 +55,8 @@ namespace OpenRCT2
         private:
             void PaintReplayNotice(rct_drawpixelinfo* dpi, const char* text);
             void PaintFPS(rct_drawpixelinfo* dpi);
+            void PaintWindowDrawTimes(rct_drawpixelinfo* dpi);
+            void PaintFrameStats(rct_drawpixelinfo* dpi);
             void MeasureFPS();
         };
     } // namespace Paint
@@ -58,9 +58,11 @@
 
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <numeric>
 #include <optional>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -93,6 +95,16 @@ namespace OpenRCT2
         // clang-format on
     }; // namespace ParkFileChunkType
 
+    struct PackedObjectData
+    {
+        uint64_t LastModified{};
+        uint64_t Size{};
+        std::vector<uint8_t> Data;
+    };
+
+    // The files of the objects packed by the last export, a server packs the same objects for every joining client.
+    static std::unordered_map<std::string, PackedObjectData> _packedObjectCache;
+
     class ParkFile
     {
     public:
@@ -121,6 +133,15 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(*_os);
         }
 
+        /**
+         * Opens the park without reading any chunks, so single chunks such as the scenario chunk can be read cheaply.
+         */
+        void LoadHeader(IStream& stream)
+        {
+            _os = std::make_unique<OrcaStream>(stream, OrcaStream::Mode::READING);
+            RequiredObjects = {};
+        }
+
         void Import()
         {
             auto& os = *_os;
@@ -150,7 +171,29 @@ namespace OpenRCT2
         void Save(IStream& stream)
         {
             OrcaStream os(stream, OrcaStream::Mode::WRITING);
+            WriteChunks(os);
+        }
+
+        /**
+         * Serialises the park into memory, so the returned data can be compressed and written later on any thread.
+         */
+        OrcaStream::PendingWrite Capture()
+        {
+            MemoryStream unused;
+            OrcaStream os(unused, OrcaStream::Mode::WRITING);
+            WriteChunks(os);
+            return os.TakePendingWrite();
+        }
 
+        void Save(const std::string_view path)
+        {
+            FileStream fs(path, FILE_MODE_WRITE);
+            Save(fs);
+        }
+
+    private:
+        void WriteChunks(OrcaStream& os)
+        {
             auto& header = os.GetHeader();
             header.Magic = PARK_FILE_MAGIC;
             header.TargetVersion = PARK_FILE_CURRENT_VERSION;
@@ -175,11 +218,7 @@ namespace OpenRCT2
             ReadWritePackedObjectsChunk(os);
         }
 
-        void Save(const std::string_view path)
-        {
-            FileStream fs(path, FILE_MODE_WRITE);
-            Save(fs);
-        }
+    public:
 
         scenario_index_entry ReadScenarioChunk()
         {
@@ -426,7 +465,8 @@ namespace OpenRCT2
 
         void ReadWriteGeneralChunk(OrcaStream& os)
         {
-            auto found = os.ReadWriteChunk(ParkFileChunkType::GENERAL, [this](OrcaStream::ChunkStream& cs) {
+            const auto version = os.GetHeader().TargetVersion;
+            auto found = os.ReadWriteChunk(ParkFileChunkType::GENERAL, [this, version](OrcaStream::ChunkStream& cs) {
                 // Only GAME_PAUSED_NORMAL from gGamePaused is relevant.
                 if (cs.GetMode() == OrcaStream::Mode::READING)
                 {
@@ -448,8 +488,7 @@ namespace OpenRCT2
                     uint32_t s0{}, s1{};
                     cs.ReadWrite(s0);
                     cs.ReadWrite(s1);
-                    Random::Rct2::Seed s{ s0, s1 };
-                    gScenarioRand.seed(s);
+                    scenario_rand_seed(s0, s1);
                 }
                 else
                 {
@@ -477,6 +516,13 @@ namespace OpenRCT2
                 cs.ReadWrite(gWidePathTileLoopPosition);
 
                 ReadWriteRideRatingCalculationData(cs, gRideRatingUpdateState);
+
+                // Older saves keep the stream seed derived from the main engine by scenario_rand_seed.
+                if (version >= 0xB)
+                {
+                    cs.ReadWrite(gScenarioRandStreamSeed.s0);
+                    cs.ReadWrite(gScenarioRandStreamSeed.s1);
+                }
             });
             if (!found)
             {
@@ -645,6 +691,7 @@ namespace OpenRCT2
                     cs.Write(count);
 
                     // Write objects
+                    std::unordered_map<std::string, PackedObjectData> packedObjects;
                     for (const auto* ori : ExportObjectsList)
                     {
                         auto extension = Path::GetExtension(ori->Path);
@@ -664,11 +711,12 @@ namespace OpenRCT2
                             continue;
                         }
 
-                        auto data = File::ReadAllBytes(ori->Path);
+                        const auto& data = GetPackedObjectData(packedObjects, ori->Path);
                         cs.Write<uint32_t>(static_cast<uint32_t>(data.size()));
                         cs.Write(data.data(), data.size());
                         count++;
                     }
+                    _packedObjectCache = std::move(packedObjects);
 
                     auto backupPosition = stream.GetPosition();
                     stream.SetPosition(countPosition);
@@ -678,6 +726,33 @@ namespace OpenRCT2
             });
         }
 
+        static const std::vector<uint8_t>& GetPackedObjectData(
+            std::unordered_map<std::string, PackedObjectData>& packedObjects, const std::string& path)
+        {
+            auto it = packedObjects.find(path);
+            if (it != packedObjects.end())
+            {
+                return it->second.Data;
+            }
+
+            PackedObjectData entry;
+            entry.LastModified = File::GetLastModified(path);
+            entry.Size = File::GetSize(path);
+
+            auto cached = _packedObjectCache.find(path);
+            if (cached != _packedObjectCache.end() && cached->second.LastModified == entry.LastModified
+                && cached->second.Size == entry.Size)
+            {
+                entry.Data = std::move(cached->second.Data);
+                _packedObjectCache.erase(cached);
+            }
+            else
+            {
+                entry.Data = File::ReadAllBytes(path);
+            }
+            return packedObjects.emplace(path, std::move(entry)).first->second.Data;
+        }
+
         void ReadWriteClimateChunk(OrcaStream& os)
         {
             os.ReadWriteChunk(ParkFileChunkType::CLIMATE, [](OrcaStream::ChunkStream& cs) {
@@ -1366,6 +1441,7 @@ namespace OpenRCT2
             cs.ReadWrite(measurement.current_item);
             cs.ReadWrite(measurement.vehicle_index);
             cs.ReadWrite(measurement.current_station);
+            measurement.EnsureItems(measurement.num_items);
             for (size_t i = 0; i < measurement.num_items; i++)
             {
                 cs.ReadWrite(measurement.vertical[i]);
@@ -2292,6 +2368,70 @@ int32_t scenario_save(u8string_view path, int32_t flags)
     return result;
 }
 
+static std::future<void> _backgroundSave;
+// Only used by the background save, consecutive autosaves reuse the compressed blocks that have not changed.
+static OrcaStream::BlockCache _backgroundSaveBlockCache;
+
+bool scenario_is_saving_in_background()
+{
+    return _backgroundSave.valid() && _backgroundSave.wait_for(std::chrono::seconds::zero()) != std::future_status::ready;
+}
+
+bool scenario_save_in_background(u8string_view path, int32_t flags)
+{
+    if (scenario_is_saving_in_background())
+    {
+        return false;
+    }
+
+    if (!(flags & S6_SAVE_FLAG_AUTOMATIC))
+    {
+        window_close_construction_windows();
+    }
+
+    PrepareMapForSave();
+
+    OrcaStream::PendingWrite pendingWrite;
+    try
+    {
+        auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
+        if (flags & S6_SAVE_FLAG_EXPORT)
+        {
+            auto& objManager = OpenRCT2::GetContext()->GetObjectManager();
+            parkFile->ExportObjectsList = objManager.GetPackableObjects();
+        }
+        parkFile->OmitTracklessRides = true;
+        pendingWrite = parkFile->Capture();
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to capture park for saving: %s", e.what());
+        return false;
+    }
+
+    gfx_invalidate_screen();
+
+    // Only the captured data is used from here on, so the park can keep running while it is compressed and written.
+    _backgroundSave = std::async(
+        std::launch::async, [path = u8string(path), pendingWrite = std::move(pendingWrite)]() mutable {
+            try
+            {
+                FileStream fs(path, FILE_MODE_WRITE);
+                pendingWrite.Write(fs, &_backgroundSaveBlockCache);
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Could not save %s: %s", path.c_str(), e.what());
+            }
+        });
+
+    if (!(flags & S6_SAVE_FLAG_AUTOMATIC))
+    {
+        gScreenAge = 0;
+    }
+    return true;
+}
+
 class ParkFileImporter final : public IParkImporter
 {
 private:
@@ -2332,6 +2472,13 @@ public:
         return ParkLoadResult(std::move(_parkFile->RequiredObjects));
     }
 
+    void LoadDetails(const utf8* path) override
+    {
+        FileStream fs(path, FILE_MODE_OPEN);
+        _parkFile = std::make_unique<OpenRCT2::ParkFile>();
+        _parkFile->LoadHeader(fs);
+    }
+
     void Import() override
     {
         _parkFile->Import();
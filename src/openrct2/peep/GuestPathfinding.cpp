@@ -9,9 +9,11 @@
 
 #include "GuestPathfinding.h"
 
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../entity/Guest.h"
 #include "../entity/Staff.h"
+#include "../network/network.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
@@ -23,6 +25,9 @@
 
 #include <bitset>
 #include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -72,6 +77,24 @@ enum
     PATH_SEARCH_FAILED
 };
 
+struct PathSegmentResult
+{
+    uint8_t SearchResult;
+    RideId RideIndex;
+};
+
+/* Results of following thin paths from a tile up to the next junction or destination, and of the thin junction
+ * checks. Both only depend on the footpath network, entrances and wide flags, so they are kept until
+ * PathfindInvalidateCaches is called. Long runs of path are then walked once instead of on every decision. */
+static constexpr size_t PathCacheLimit = 1 << 18;
+static std::unordered_map<uint64_t, PathSegmentResult> _pathSegmentCache;
+static std::unordered_map<uint64_t, bool> _thinJunctionCache;
+
+static uint32_t PathNodeKey(const TileCoordsXYZ& loc)
+{
+    return (static_cast<uint32_t>(loc.x) << 20) | (static_cast<uint32_t>(loc.y) << 8) | static_cast<uint8_t>(loc.z);
+}
+
 static TileElement* get_banner_on_path(TileElement* path_element)
 {
     // This is an improved version of original.
@@ -453,7 +476,27 @@ static uint8_t footpath_element_destination_in_direction(
         }
     }
 
-    return footpath_element_dest_in_dir(loc, chosenDirection, outRideIndex, 0);
+    // Staff ignore no entry signs, so they get separate results.
+    const auto key = (static_cast<uint64_t>(PathNodeKey(loc)) << 3) | (chosenDirection << 1) | (_peepPathFindIsStaff ? 1 : 0);
+    auto it = _pathSegmentCache.find(key);
+    if (it == _pathSegmentCache.end())
+    {
+        if (_pathSegmentCache.size() >= PathCacheLimit)
+        {
+            _pathSegmentCache.clear();
+        }
+        RideId rideIndex = RideId::GetNull();
+        auto searchResult = footpath_element_dest_in_dir(loc, chosenDirection, &rideIndex, 0);
+        it = _pathSegmentCache.emplace(key, PathSegmentResult{ searchResult, rideIndex }).first;
+    }
+
+    const auto& result = it->second;
+    if (result.SearchResult == PATH_SEARCH_RIDE_ENTRANCE || result.SearchResult == PATH_SEARCH_RIDE_EXIT
+        || result.SearchResult == PATH_SEARCH_SHOP_ENTRANCE)
+    {
+        *outRideIndex = result.RideIndex;
+    }
+    return result.SearchResult;
 }
 
 /**
@@ -532,6 +575,18 @@ static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
 
     uint8_t edges = path->GetEdges();
 
+    const uint8_t slope = path->IsSloped() ? 4 | path->GetSlopeDirection() : 0;
+    const auto key = (static_cast<uint64_t>(PathNodeKey(loc)) << 7) | (edges << 3) | slope;
+    auto it = _thinJunctionCache.find(key);
+    if (it != _thinJunctionCache.end())
+    {
+        return it->second;
+    }
+    if (_thinJunctionCache.size() >= PathCacheLimit)
+    {
+        _thinJunctionCache.clear();
+    }
+
     int32_t test_edge = bitscanforward(edges);
     if (test_edge == -1)
         return false;
@@ -557,6 +612,8 @@ static bool path_is_thin_junction(PathElement* path, const TileCoordsXYZ& loc)
         }
         edges &= ~(1 << test_edge);
     } while ((test_edge = bitscanforward(edges)) != -1);
+
+    _thinJunctionCache.emplace(key, thin_junction);
     return thin_junction;
 }
 
@@ -1254,6 +1311,273 @@ static void peep_pathfind_heuristic_search(
     }
 }
 
+/**
+ * Distances along the footpath network to a single goal, shared by every guest that heads for it. A field is built
+ * the first time a guest needs it with a breadth first search outwards from the goal and is kept until a footpath or
+ * entrance changes. Unlike the heuristic search it does not stop at wide paths and always finds the shortest route,
+ * so it changes where guests walk and is only used when enabled and not in network play.
+ */
+struct FlowField
+{
+    enum class GoalKind : uint8_t
+    {
+        None,
+        // A path element, such as the end of a queue.
+        Path,
+        // A park entrance or shop, which can be entered from any side.
+        AnySide,
+        // A ride entrance, which can only be entered in the direction it is facing.
+        Facing,
+    };
+
+    GoalKind Kind = GoalKind::None;
+    Direction FacingDirection = INVALID_DIRECTION;
+    std::unordered_map<uint32_t, uint16_t> Distances;
+};
+
+// Every goal and queue ride pair gets its own field, clear them all once there are this many.
+static constexpr size_t FlowFieldCacheLimit = 256;
+static std::unordered_map<uint64_t, FlowField> _flowFields;
+
+static int32_t PathExitHeight(const PathElement* pathElement, Direction direction)
+{
+    int32_t height = pathElement->base_height;
+    if (pathElement->IsSloped() && pathElement->GetSlopeDirection() == direction)
+    {
+        height += 2;
+    }
+    return height;
+}
+
+/**
+ * Whether a guest heading for the flow field's goal can walk through this path, as the heuristic search stops at
+ * queues of other rides.
+ */
+static bool FlowFieldIsTraversable(const PathElement* pathElement, RideId queueRideIndex)
+{
+    return !pathElement->IsQueue() || pathElement->GetRideIndex().IsNull() || pathElement->GetRideIndex() == queueRideIndex
+        || bitcount(pathElement->GetEdges()) != 2;
+}
+
+static void FlowFieldClassifyGoal(FlowField& field, const TileCoordsXYZ& goal)
+{
+    TileElement* tileElement = map_get_first_element_at(goal);
+    if (tileElement == nullptr)
+        return;
+    do
+    {
+        if (tileElement->IsGhost() || tileElement->base_height != goal.z)
+            continue;
+
+        switch (tileElement->GetType())
+        {
+            case TileElementType::Path:
+                field.Kind = FlowField::GoalKind::Path;
+                return;
+            case TileElementType::Entrance:
+                if (tileElement->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE)
+                {
+                    field.Kind = FlowField::GoalKind::AnySide;
+                    return;
+                }
+                if (tileElement->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_RIDE_ENTRANCE)
+                {
+                    field.Kind = FlowField::GoalKind::Facing;
+                    field.FacingDirection = tileElement->GetDirection();
+                    return;
+                }
+                break;
+            case TileElementType::Track:
+            {
+                auto ride = get_ride(tileElement->AsTrack()->GetRideIndex());
+                if (ride != nullptr && ride->GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_IS_SHOP))
+                {
+                    field.Kind = FlowField::GoalKind::AnySide;
+                    return;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+}
+
+/**
+ * Whether walking off a path in the given direction at the given height enters the goal of a field whose goal is not
+ * a path element.
+ */
+static bool FlowFieldEntersGoal(const FlowField& field, const TileCoordsXYZ& goal, int32_t height, Direction direction)
+{
+    if (height != goal.z)
+        return false;
+    return field.Kind == FlowField::GoalKind::AnySide
+        || (field.Kind == FlowField::GoalKind::Facing && direction == field.FacingDirection);
+}
+
+/**
+ * Returns the path element at loc that can be walked onto when arriving from the given direction and height.
+ */
+static TileElement* FlowFieldPathAt(const TileCoordsXYZ& loc, int32_t height, Direction direction)
+{
+    TileElement* tileElement = map_get_first_element_at(loc);
+    if (tileElement == nullptr)
+        return nullptr;
+    do
+    {
+        if (tileElement->IsGhost() || tileElement->GetType() != TileElementType::Path)
+            continue;
+        if (loc.z != tileElement->base_height || !IsValidPathZAndDirection(tileElement, height, direction))
+            continue;
+        return tileElement;
+    } while (!(tileElement++)->IsLastForTile());
+    return nullptr;
+}
+
+static void FlowFieldBuild(FlowField& field, const TileCoordsXYZ& goal, RideId queueRideIndex)
+{
+    PROFILED_FUNCTION();
+
+    FlowFieldClassifyGoal(field, goal);
+    if (field.Kind == FlowField::GoalKind::None)
+        return;
+
+    // Only guests use flow fields, so no entry signs always apply.
+    _peepPathFindIsStaff = false;
+
+    std::vector<TileCoordsXYZ> frontier;
+    std::vector<TileCoordsXYZ> nextFrontier;
+    field.Distances[PathNodeKey(goal)] = 0;
+    frontier.push_back(goal);
+
+    for (uint16_t distance = 1; !frontier.empty() && distance != std::numeric_limits<uint16_t>::max(); distance++)
+    {
+        for (const auto& node : frontier)
+        {
+            const bool nodeIsGoal = node == goal && field.Kind != FlowField::GoalKind::Path;
+            for (Direction direction : ALL_DIRECTIONS)
+            {
+                // Look for the paths that lead onto this node when walking in direction.
+                TileCoordsXY previousTile{ node.x, node.y };
+                previousTile -= TileDirectionDelta[direction];
+                if (!map_is_location_valid(previousTile.ToCoordsXY()))
+                    continue;
+
+                TileElement* tileElement = map_get_first_element_at(previousTile);
+                if (tileElement == nullptr)
+                    continue;
+                do
+                {
+                    if (tileElement->IsGhost() || tileElement->GetType() != TileElementType::Path)
+                        continue;
+
+                    auto* pathElement = tileElement->AsPath();
+                    if (!(path_get_permitted_edges(pathElement) & (1 << direction)))
+                        continue;
+                    if (!FlowFieldIsTraversable(pathElement, queueRideIndex))
+                        continue;
+
+                    const auto height = PathExitHeight(pathElement, direction);
+                    if (nodeIsGoal)
+                    {
+                        if (!FlowFieldEntersGoal(field, goal, height, direction))
+                            continue;
+                    }
+                    else if (!FlowFieldPathAt(node, height, direction))
+                    {
+                        continue;
+                    }
+
+                    TileCoordsXYZ previous{ previousTile, tileElement->base_height };
+                    if (field.Distances.try_emplace(PathNodeKey(previous), distance).second)
+                    {
+                        nextFrontier.push_back(previous);
+                    }
+                } while (!(tileElement++)->IsLastForTile());
+            }
+        }
+        frontier.swap(nextFrontier);
+        nextFrontier.clear();
+    }
+}
+
+static const FlowField& GetFlowField(const TileCoordsXYZ& goal, RideId queueRideIndex)
+{
+    const auto key = (static_cast<uint64_t>(PathNodeKey(goal)) << 16) | queueRideIndex.ToUnderlying();
+    auto it = _flowFields.find(key);
+    if (it != _flowFields.end())
+    {
+        return it->second;
+    }
+
+    if (_flowFields.size() >= FlowFieldCacheLimit)
+    {
+        _flowFields.clear();
+    }
+    auto& field = _flowFields[key];
+    FlowFieldBuild(field, goal, queueRideIndex);
+    return field;
+}
+
+static bool FlowFieldsEnabled(const Peep* peep)
+{
+    return gConfigGeneral.guest_flow_field_pathfinding && peep->Is<Guest>() && network_get_mode() == NETWORK_MODE_NONE;
+}
+
+/**
+ * Picks the edge that leads closest to gPeepPathFindGoalPosition according to its flow field, or INVALID_DIRECTION if
+ * none of the edges is connected to the goal.
+ */
+static Direction FlowFieldChooseDirection(const TileCoordsXYZ& loc, const PathElement* pathElement, uint8_t edges)
+{
+    const auto& goal = gPeepPathFindGoalPosition;
+    const auto& field = GetFlowField(goal, gPeepPathFindQueueRideIndex);
+    if (field.Kind == FlowField::GoalKind::None)
+        return INVALID_DIRECTION;
+
+    Direction bestDirection = INVALID_DIRECTION;
+    uint16_t bestDistance = std::numeric_limits<uint16_t>::max();
+    for (Direction direction : ALL_DIRECTIONS)
+    {
+        if (!(edges & (1 << direction)))
+            continue;
+
+        const auto height = PathExitHeight(pathElement, direction);
+        TileCoordsXYZ next{ TileCoordsXY{ loc.x, loc.y } + TileDirectionDelta[direction], 0 };
+        if (next.x == goal.x && next.y == goal.y && field.Kind != FlowField::GoalKind::Path)
+        {
+            if (FlowFieldEntersGoal(field, goal, height, direction))
+            {
+                return direction;
+            }
+            continue;
+        }
+
+        // Walking onto a path sets the height to its base height, see peep_pathfind_heuristic_search.
+        for (auto z : { height, height - 2 })
+        {
+            next.z = z;
+            if (FlowFieldPathAt(next, height, direction) == nullptr)
+                continue;
+
+            auto it = field.Distances.find(PathNodeKey(next));
+            if (it != field.Distances.end() && it->second < bestDistance)
+            {
+                bestDistance = it->second;
+                bestDirection = direction;
+            }
+        }
+    }
+    return bestDirection;
+}
+
+void PathfindInvalidateCaches()
+{
+    _pathSegmentCache.clear();
+    _thinJunctionCache.clear();
+    _flowFields.clear();
+}
+
 /**
  * Returns:
  *   -1   - no direction chosen
@@ -1429,7 +1753,15 @@ Direction peep_pathfind_choose_direction(const TileCoordsXYZ& loc, Peep* peep)
     int32_t chosen_edge = bitscanforward(edges);
 
     // Peep has multiple edges still to try.
-    if (edges & ~(1 << chosen_edge))
+    const bool hasMultipleEdges = (edges & ~(1 << chosen_edge)) != 0;
+    const Direction flowFieldDirection = hasMultipleEdges && FlowFieldsEnabled(peep)
+        ? FlowFieldChooseDirection(loc, first_tile_element->AsPath(), edges)
+        : INVALID_DIRECTION;
+    if (flowFieldDirection != INVALID_DIRECTION)
+    {
+        chosen_edge = flowFieldDirection;
+    }
+    else if (hasMultipleEdges)
     {
         uint16_t best_score = 0xFFFF;
         uint8_t best_sub = 0xFF;
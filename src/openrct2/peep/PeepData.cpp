@@ -9,7 +9,10 @@
 
 #include "../entity/Peep.h"
 
+#include <algorithm>
+#include <cassert>
 #include <iterator>
+#include <limits>
 
 // clang-format off
 static constexpr const uint8_t PeepSpriteImage_Normal_00_sequence[] = { 0, 1, 2, 3, 4, 5 };
@@ -5451,3 +5454,36 @@ constexpr rct_peep_animation_entry g_peep_animation_entries[] =
     { PeepSpriteImage_Sandwich, PeepSpriteBounds_Sandwich },
 };
 // clang-format on
+
+PeepAnimationTable PeepAnimationTable::Build()
+{
+    PeepAnimationTable table{};
+    for (size_t spriteType = 0; spriteType < std::size(g_peep_animation_entries); spriteType++)
+    {
+        const auto& entry = g_peep_animation_entries[spriteType];
+        for (size_t actionSpriteType = 0; actionSpriteType < PeepActionSpriteTypeCount; actionSpriteType++)
+        {
+            const auto& source = entry.sprite_animation[actionSpriteType];
+            const auto* sourceEnd = source.frame_offsets + source.num_frames;
+
+            // Share the frames with an earlier animation that has the same sequence.
+            auto frames = std::search(table.Frames.begin(), table.Frames.end(), source.frame_offsets, sourceEnd);
+            auto firstFrame = static_cast<size_t>(std::distance(table.Frames.begin(), frames));
+            if (frames == table.Frames.end())
+            {
+                table.Frames.insert(table.Frames.end(), source.frame_offsets, sourceEnd);
+            }
+            assert(firstFrame + source.num_frames <= std::numeric_limits<uint16_t>::max());
+
+            auto& animation = table.Animations[spriteType * PeepActionSpriteTypeCount + actionSpriteType];
+            animation.BaseImage = source.base_image;
+            animation.FirstFrame = static_cast<uint16_t>(firstFrame);
+            animation.NumFrames = static_cast<uint16_t>(source.num_frames);
+            animation.Bounds = entry.sprite_bounds[actionSpriteType];
+        }
+    }
+    table.Frames.shrink_to_fit();
+    return table;
+}
+
+const PeepAnimationTable gPeepAnimationTable = PeepAnimationTable::Build();
@@ -19,6 +19,7 @@
 
 #    include <cerrno>
 #    include <clocale>
+#    include <csignal>
 #    include <cstdlib>
 #    include <cstring>
 #    include <ctime>
@@ -29,6 +30,10 @@
 #    include <pwd.h>
 #    include <sys/stat.h>
 #    include <sys/time.h>
+#    include <unistd.h>
+#    ifdef __linux__
+#        include <sys/prctl.h>
+#    endif
 
 // The name of the mutex used to prevent multiple instances of the game from running
 static constexpr u8string_view SINGLE_INSTANCE_MUTEX_NAME = u8"openrct2.lock";
@@ -134,7 +139,7 @@ namespace Platform
             size_t readBytes;
             while ((readBytes = fread(buffer, 1, sizeof(buffer), fpipe)) > 0)
             {
-                outputBuffer.insert(outputBuffer.begin(), buffer, buffer + readBytes);
+                outputBuffer.insert(outputBuffer.end(), buffer, buffer + readBytes);
             }
 
             // Trim line breaks
@@ -307,6 +312,28 @@ namespace Platform
 #    endif // __EMSCRIPTEN__
     }
 
+    int32_t ForkProcess()
+    {
+#    ifndef __EMSCRIPTEN__
+        const auto parent = getpid();
+        const auto pid = fork();
+        if (pid == 0)
+        {
+#        ifdef __linux__
+            prctl(PR_SET_PDEATHSIG, SIGTERM);
+#        endif
+            // The parent may have exited before the death signal was set up.
+            if (getppid() != parent)
+            {
+                _exit(EXIT_FAILURE);
+            }
+        }
+        return pid;
+#    else
+        return -1;
+#    endif // __EMSCRIPTEN__
+    }
+
     // Implement our own version of getumask(), as it is documented being
     // "a vaporware GNU extension".
     static mode_t openrct2_getumask()
@@ -838,6 +838,11 @@ namespace Platform
         return isElevated;
     }
 
+    int32_t ForkProcess()
+    {
+        return -1;
+    }
+
     std::string GetSteamPath()
     {
         wchar_t* wSteamPath;
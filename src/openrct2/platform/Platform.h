@@ -85,6 +85,11 @@ namespace Platform
     bool FindApp(std::string_view app, std::string* output);
     int32_t Execute(std::string_view command, std::string* output = nullptr);
     bool ProcessIsElevated();
+    /**
+     * Forks the process, returns 0 in the child and the child's process id in the parent. Returns -1 if the process could
+     * not be forked or forking is not supported. The child only has the calling thread and exits with its parent.
+     */
+    int32_t ForkProcess();
     float GetDefaultScale();
 
     bool OriginalGameDataExists(std::string_view path);
@@ -48,6 +48,10 @@ namespace Platform
             InitTicks();
             bitcount_init();
             mask_init();
+            remap_run_init();
+            light_blend_run_init();
+            filter_run_init();
+            palette_convert_run_init();
         }
     }
 
@@ -9,11 +9,78 @@
 
 #include "Profiling.h"
 
+#include "../core/Json.hpp"
+
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <memory>
 #include <stack>
+#include <unordered_map>
+
+#ifdef ENABLE_ALLOCATION_TRACKING
+#    include <cstdlib>
+#    include <new>
+#endif
+
+namespace OpenRCT2::Profiling
+{
+    namespace Detail
+    {
+        static thread_local AllocationCounters _threadAllocations;
+    } // namespace Detail
+} // namespace OpenRCT2::Profiling
+
+#ifdef ENABLE_ALLOCATION_TRACKING
+// Replaces the global allocation functions, the remaining variants are implemented in terms of these.
+void* operator new(std::size_t size)
+{
+    auto& counters = OpenRCT2::Profiling::Detail::_threadAllocations;
+    counters.Count++;
+    counters.Bytes += size;
+
+    if (size == 0)
+        size = 1;
+    while (true)
+    {
+        auto* ptr = std::malloc(size);
+        if (ptr != nullptr)
+            return ptr;
+
+        auto handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
 
 namespace OpenRCT2::Profiling
 {
@@ -34,6 +101,20 @@ namespace OpenRCT2::Profiling
         return _enabled;
     }
 
+    bool IsAllocationTrackingEnabled()
+    {
+#ifdef ENABLE_ALLOCATION_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    AllocationCounters GetThreadAllocations()
+    {
+        return Detail::_threadAllocations;
+    }
+
     namespace Detail
     {
         using Clock = std::chrono::high_resolution_clock;
@@ -45,15 +126,130 @@ namespace OpenRCT2::Profiling
             FunctionInternal* Func;
             Tp EntryTime;
 
+            // Innermost enclosing entry of a frame stage function and the time spent in stages nested in this one.
+            FunctionEntry* ParentStage{};
+            double NestedStageTimeUs{};
+
+            AllocationCounters EntryAllocations;
+
             FunctionEntry(FunctionInternal* parent, FunctionInternal* func, const Tp& entryTime)
                 : Parent(parent)
                 , Func(func)
                 , EntryTime(entryTime)
+                , EntryAllocations(_threadAllocations)
             {
             }
         };
 
         static thread_local std::stack<FunctionEntry> _callStack;
+        // Entries of the deque backing the stack keep their address while entries above them are pushed and popped.
+        static thread_local FunctionEntry* _stageEntry;
+
+        // Time spent in each stage during the current frame, in nanoseconds.
+        static std::array<std::atomic<uint64_t>, static_cast<size_t>(FrameStage::Count)> _frameStageTimes;
+
+        struct TraceEvent
+        {
+            const FunctionInternal* Func;
+            int64_t StartNs;
+            int64_t DurationNs;
+        };
+
+        static constexpr size_t MaxTraceEvents = 1 << 16;
+
+        // Ring buffer of the most recent calls of a thread.
+        struct ThreadTrace
+        {
+            uint32_t Id{};
+            std::string Name;
+            std::array<TraceEvent, MaxTraceEvents> Events{};
+            // Only written by the owning thread, the events below it are complete.
+            std::atomic<size_t> Count{};
+        };
+
+        // Buffers are never freed so an exited thread's calls remain in the trace.
+        static std::mutex _threadTracesMutex;
+        static std::vector<std::unique_ptr<ThreadTrace>> _threadTraces;
+        static thread_local ThreadTrace* _threadTrace;
+        // Name for the buffer of this thread, which is only allocated once the thread calls a profiled function.
+        static thread_local std::string _threadName;
+        static const Tp _traceEpoch = Clock::now();
+
+        static ThreadTrace& GetThreadTrace()
+        {
+            if (_threadTrace == nullptr)
+            {
+                std::scoped_lock lock(_threadTracesMutex);
+                auto& trace = _threadTraces.emplace_back(std::make_unique<ThreadTrace>());
+                trace->Id = static_cast<uint32_t>(_threadTraces.size());
+                trace->Name = _threadName;
+                _threadTrace = trace.get();
+            }
+            return *_threadTrace;
+        }
+
+        static void RecordTraceEvent(const FunctionInternal* func, const Tp& entryTime, const Tp& exitTime)
+        {
+            auto& trace = GetThreadTrace();
+            const auto index = trace.Count.load(std::memory_order_relaxed);
+            auto& event = trace.Events[index % MaxTraceEvents];
+            event.Func = func;
+            event.StartNs = std::chrono::duration_cast<std::chrono::nanoseconds>(entryTime - _traceEpoch).count();
+            event.DurationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(exitTime - entryTime).count();
+            trace.Count.store(index + 1, std::memory_order_release);
+        }
+
+        // Call edges this thread has already added to Parents and Children, cleared once ResetData bumps the generation.
+        static std::atomic<uint32_t> _resetGeneration;
+        static thread_local uint32_t _knownCallsGeneration;
+        static thread_local std::unordered_map<const FunctionInternal*, std::unordered_set<const FunctionInternal*>>
+            _knownCalls;
+
+        static bool IsNewCall(const FunctionInternal* parent, const FunctionInternal* func)
+        {
+            const auto generation = _resetGeneration.load(std::memory_order_relaxed);
+            if (_knownCallsGeneration != generation)
+            {
+                _knownCalls.clear();
+                _knownCallsGeneration = generation;
+            }
+            return _knownCalls[func].insert(parent).second;
+        }
+
+        static void UpdateMinTime(std::atomic<double>& value, double time)
+        {
+            // Zero means that no time has been recorded yet.
+            auto current = value.load(std::memory_order_relaxed);
+            while ((current == 0.0 || time < current) && !value.compare_exchange_weak(current, time))
+            {
+            }
+        }
+
+        static void UpdateMaxTime(std::atomic<double>& value, double time)
+        {
+            auto current = value.load(std::memory_order_relaxed);
+            while (time > current && !value.compare_exchange_weak(current, time))
+            {
+            }
+        }
+
+        static void AddTime(std::atomic<double>& value, double time)
+        {
+            auto current = value.load(std::memory_order_relaxed);
+            while (!value.compare_exchange_weak(current, current + time))
+            {
+            }
+        }
+
+        static void AddFrameStageTime(FunctionEntry& entry, double elapsedTimeUs)
+        {
+            const auto exclusiveTimeUs = std::max(elapsedTimeUs - entry.NestedStageTimeUs, 0.0);
+            _frameStageTimes[static_cast<size_t>(entry.Func->Stage)] += static_cast<uint64_t>(exclusiveTimeUs * 1000.0);
+
+            _stageEntry = entry.ParentStage;
+            if (_stageEntry != nullptr)
+                _stageEntry->NestedStageTimeUs += elapsedTimeUs;
+        }
 
         void FunctionEnter(Function& func)
         {
@@ -67,7 +263,12 @@ namespace OpenRCT2::Profiling
             if (!_callStack.empty())
                 parent = _callStack.top().Func;
 
-            _callStack.emplace(parent, &funcInternal, entryTime);
+            auto& entry = _callStack.emplace(parent, &funcInternal, entryTime);
+            if (funcInternal.Stage != FrameStage::None)
+            {
+                entry.ParentStage = _stageEntry;
+                _stageEntry = &entry;
+            }
         }
 
         void FunctionExit(Function& func)
@@ -85,31 +286,33 @@ namespace OpenRCT2::Profiling
 
             auto* funcData = stackEntry.Func;
 
+            // Before the profiler's own bookkeeping below, which may allocate.
+            funcData->AllocationCount += _threadAllocations.Count - stackEntry.EntryAllocations.Count;
+            funcData->AllocatedBytes += _threadAllocations.Bytes - stackEntry.EntryAllocations.Bytes;
+
             // We don't need a lock for this, we only have a fixed window.
             const auto sampleEntryIdx = funcData->SampleIterator++ % funcData->Samples.size();
             funcData->Samples[sampleEntryIdx] = elapsedTimeUs;
 
-            if (stackEntry.Parent)
-            {
-                std::scoped_lock lock(stackEntry.Parent->Mutex);
-                stackEntry.Parent->Children.insert(funcData);
-            }
-
-            // This requires locking.
+            // Only new call edges require locking.
+            if (stackEntry.Parent && IsNewCall(stackEntry.Parent, funcData))
             {
+                {
+                    std::scoped_lock lock(stackEntry.Parent->Mutex);
+                    stackEntry.Parent->Children.insert(funcData);
+                }
                 std::scoped_lock lock(funcData->Mutex);
+                funcData->Parents.insert(stackEntry.Parent);
+            }
 
-                if (stackEntry.Parent)
-                    funcData->Parents.insert(stackEntry.Parent);
+            UpdateMinTime(funcData->MinTimeUs, elapsedTimeUs);
+            UpdateMaxTime(funcData->MaxTimeUs, elapsedTimeUs);
+            AddTime(funcData->TotalTimeUs, elapsedTimeUs);
 
-                if (funcData->MinTimeUs == 0.0)
-                    funcData->MinTimeUs = elapsedTimeUs;
-                else
-                    funcData->MinTimeUs = std::min(elapsedTimeUs, funcData->MinTimeUs);
+            RecordTraceEvent(funcData, stackEntry.EntryTime, exitTime);
 
-                funcData->MaxTimeUs = std::max(elapsedTimeUs, funcData->MaxTimeUs);
-                funcData->TotalTimeUs += elapsedTimeUs;
-            }
+            if (funcData->Stage != FrameStage::None)
+                AddFrameStageTime(stackEntry, elapsedTimeUs);
 
             _callStack.pop();
         }
@@ -127,6 +330,110 @@ namespace OpenRCT2::Profiling
         return Detail::GetRegistry();
     }
 
+    struct FrameSample
+    {
+        float FrameTimeMs;
+        std::array<float, static_cast<size_t>(FrameStage::Count)> StageTimesMs;
+    };
+
+    static constexpr size_t MaxFrameSamples = 4096;
+    static std::array<FrameSample, MaxFrameSamples> _frameSamples;
+    static size_t _frameSampleIterator;
+    static Detail::Tp _lastFrameTime;
+    static bool _lastFrameValid;
+
+    void MarkFrame()
+    {
+        if (!IsEnabled())
+        {
+            _lastFrameValid = false;
+            return;
+        }
+
+        const auto now = Detail::Clock::now();
+        FrameSample sample{};
+        for (size_t i = 0; i < sample.StageTimesMs.size(); i++)
+        {
+            sample.StageTimesMs[i] = Detail::_frameStageTimes[i].exchange(0) / 1000000.0f;
+        }
+
+        // The first frame after enabling the profiler has no start.
+        if (_lastFrameValid)
+        {
+            sample.FrameTimeMs = std::chrono::duration<float, std::milli>(now - _lastFrameTime).count();
+            _frameSamples[_frameSampleIterator++ % MaxFrameSamples] = sample;
+        }
+        _lastFrameTime = now;
+        _lastFrameValid = true;
+    }
+
+    static FrameStats::Percentiles GetPercentiles(std::vector<float>& values)
+    {
+        FrameStats::Percentiles result;
+        if (values.empty())
+            return result;
+
+        std::sort(values.begin(), values.end());
+        const auto at = [&values](double fraction) {
+            return values[std::min(static_cast<size_t>(fraction * values.size()), values.size() - 1)];
+        };
+        result.P50 = at(0.50);
+        result.P95 = at(0.95);
+        result.P99 = at(0.99);
+        return result;
+    }
+
+    FrameStats GetFrameStats()
+    {
+        FrameStats stats;
+        stats.NumFrames = std::min(_frameSampleIterator, MaxFrameSamples);
+
+        std::vector<float> values;
+        values.reserve(stats.NumFrames);
+        for (size_t i = 0; i < stats.NumFrames; i++)
+        {
+            const auto frameTime = _frameSamples[i].FrameTimeMs;
+            values.push_back(frameTime);
+
+            auto bucket = std::upper_bound(
+                FrameStats::HistogramBounds.begin(), FrameStats::HistogramBounds.end(), static_cast<double>(frameTime));
+            stats.Histogram[bucket - FrameStats::HistogramBounds.begin()]++;
+        }
+        stats.FrameTime = GetPercentiles(values);
+
+        for (size_t stage = 0; stage < stats.Stages.size(); stage++)
+        {
+            values.clear();
+            for (size_t i = 0; i < stats.NumFrames; i++)
+            {
+                values.push_back(_frameSamples[i].StageTimesMs[stage]);
+            }
+            stats.Stages[stage] = GetPercentiles(values);
+        }
+        return stats;
+    }
+
+    const char* GetFrameStageName(FrameStage stage)
+    {
+        switch (stage)
+        {
+            case FrameStage::Logic:
+                return "logic";
+            case FrameStage::PaintGenerate:
+                return "paint_generate";
+            case FrameStage::PaintArrange:
+                return "paint_arrange";
+            case FrameStage::PaintDraw:
+                return "paint_draw";
+            case FrameStage::Ui:
+                return "ui";
+            case FrameStage::Present:
+                return "present";
+            default:
+                return "other";
+        }
+    }
+
     void ResetData()
     {
         for (auto* func : Detail::GetRegistry())
@@ -137,10 +444,25 @@ namespace OpenRCT2::Profiling
             funcInternal->CallCount = 0;
             funcInternal->MinTimeUs = 0.0;
             funcInternal->MaxTimeUs = 0.0;
+            funcInternal->TotalTimeUs = 0.0;
+            funcInternal->AllocationCount = 0;
+            funcInternal->AllocatedBytes = 0;
             funcInternal->SampleIterator = 0;
             funcInternal->Children.clear();
             funcInternal->Parents.clear();
         }
+        Detail::_resetGeneration++;
+
+        {
+            std::scoped_lock lock(Detail::_threadTracesMutex);
+            for (auto& trace : Detail::_threadTraces)
+            {
+                trace->Count = 0;
+            }
+        }
+
+        _frameSampleIterator = 0;
+        _lastFrameValid = false;
     }
 
     bool ExportCSV(const std::string& filePath)
@@ -149,7 +471,7 @@ namespace OpenRCT2::Profiling
         if (!out.is_open())
             return false;
 
-        out << "function_name;calls;min_microseconds;max_microseconds;average_microseconds\n";
+        out << "function_name;calls;min_microseconds;max_microseconds;average_microseconds;allocations;allocated_bytes\n";
         out << std::setprecision(12);
 
         const auto& data = GetData();
@@ -165,7 +487,110 @@ namespace OpenRCT2::Profiling
             if (func->GetCallCount() > 0)
                 avg = func->GetTotalTime() / func->GetCallCount();
 
-            out << avg << "\n";
+            out << avg << ";";
+
+            const auto allocations = func->GetAllocations();
+            out << allocations.Count << ";";
+            out << allocations.Bytes << "\n";
+        }
+
+        return true;
+    }
+
+    void SetThreadName(const std::string& name)
+    {
+        std::scoped_lock lock(Detail::_threadTracesMutex);
+        Detail::_threadName = name;
+        if (Detail::_threadTrace != nullptr)
+            Detail::_threadTrace->Name = name;
+    }
+
+    bool ExportChromeTrace(const std::string& filePath)
+    {
+        std::ofstream out(filePath);
+        if (!out.is_open())
+            return false;
+
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+        // Names are escaped once per function rather than once per call.
+        std::unordered_map<const Detail::FunctionInternal*, std::string> names;
+        const auto getName = [&names](const Detail::FunctionInternal* func) -> const std::string& {
+            auto it = names.find(func);
+            if (it == names.end())
+                it = names.emplace(func, json_t(func->GetName()).dump()).first;
+            return it->second;
+        };
+
+        const char* separator = "\n";
+        std::scoped_lock lock(Detail::_threadTracesMutex);
+        for (const auto& trace : Detail::_threadTraces)
+        {
+            const auto threadName = trace->Name.empty() ? "Thread " + std::to_string(trace->Id) : trace->Name;
+            out << separator << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << trace->Id << R"(,"args":{"name":)"
+                << json_t(threadName).dump() << "}}";
+            separator = ",\n";
+
+            const auto count = trace->Count.load(std::memory_order_acquire);
+            const auto start = count > Detail::MaxTraceEvents ? count - Detail::MaxTraceEvents : 0;
+            for (auto i = start; i < count; i++)
+            {
+                const auto& event = trace->Events[i % Detail::MaxTraceEvents];
+                out << separator << R"({"name":)" << getName(event.Func) << R"(,"ph":"X","pid":1,"tid":)" << trace->Id
+                    << R"(,"ts":)" << event.StartNs / 1000.0 << R"(,"dur":)" << event.DurationNs / 1000.0 << "}";
+            }
+        }
+        out << "\n]}\n";
+
+        return true;
+    }
+
+    bool ExportFrameLog(const std::string& filePath)
+    {
+        std::ofstream out(filePath);
+        if (!out.is_open())
+            return false;
+
+        out << std::setprecision(6);
+
+        const auto stats = GetFrameStats();
+        out << "stage;p50_milliseconds;p95_milliseconds;p99_milliseconds\n";
+        out << "frame;" << stats.FrameTime.P50 << ";" << stats.FrameTime.P95 << ";" << stats.FrameTime.P99 << "\n";
+        for (size_t stage = 1; stage < stats.Stages.size(); stage++)
+        {
+            const auto& percentiles = stats.Stages[stage];
+            out << GetFrameStageName(static_cast<FrameStage>(stage)) << ";" << percentiles.P50 << ";" << percentiles.P95
+                << ";" << percentiles.P99 << "\n";
+        }
+
+        out << "\nframe_time_upper_bound_milliseconds;frames\n";
+        for (size_t i = 0; i < stats.Histogram.size(); i++)
+        {
+            if (i < FrameStats::HistogramBounds.size())
+                out << FrameStats::HistogramBounds[i];
+            else
+                out << "inf";
+            out << ";" << stats.Histogram[i] << "\n";
+        }
+
+        // Frames in the order they were recorded.
+        out << "\nframe_milliseconds";
+        for (size_t stage = 1; stage < stats.Stages.size(); stage++)
+        {
+            out << ";" << GetFrameStageName(static_cast<FrameStage>(stage)) << "_milliseconds";
+        }
+        out << "\n";
+        const auto start = _frameSampleIterator - stats.NumFrames;
+        for (size_t i = start; i < _frameSampleIterator; i++)
+        {
+            const auto& sample = _frameSamples[i % MaxFrameSamples];
+            out << sample.FrameTimeMs;
+            for (size_t stage = 1; stage < sample.StageTimesMs.size(); stage++)
+            {
+                out << ";" << sample.StageTimesMs[stage];
+            }
+            out << "\n";
         }
 
         return true;
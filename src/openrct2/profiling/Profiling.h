@@ -24,6 +24,31 @@ namespace OpenRCT2::Profiling
     void Disable();
     bool IsEnabled();
 
+    // Parts of a frame that are timed separately for the frame statistics, see PROFILED_FRAME_STAGE.
+    enum class FrameStage : uint8_t
+    {
+        None,
+        Logic,
+        PaintGenerate,
+        PaintArrange,
+        PaintDraw,
+        Ui,
+        Present,
+        Count,
+    };
+
+    struct AllocationCounters
+    {
+        uint64_t Count{};
+        uint64_t Bytes{};
+    };
+
+    // Returns whether heap allocations are counted, this requires a build with ENABLE_ALLOCATION_TRACKING.
+    bool IsAllocationTrackingEnabled();
+
+    // Heap allocations made by the calling thread since it started, always zero without allocation tracking.
+    AllocationCounters GetThreadAllocations();
+
     struct Function
     {
         virtual ~Function() = default;
@@ -51,6 +76,9 @@ namespace OpenRCT2::Profiling
 
         // Returns a list of function this function is calling.
         virtual std::vector<Function*> GetChildren() const = 0;
+
+        // Heap allocations made during all calls, including the functions called by it.
+        virtual AllocationCounters GetAllocations() const = 0;
     };
 
     namespace Detail
@@ -69,7 +97,7 @@ namespace OpenRCT2::Profiling
 
             virtual ~FunctionInternal() = default;
 
-            // Functions marked MT require locking, this is per function basis.
+            // Guards Parents and Children. Each thread only takes it the first time it sees a call edge, see FunctionExit.
             mutable std::mutex Mutex;
 
             std::array<char, MaxNameSize> Name{};
@@ -83,11 +111,15 @@ namespace OpenRCT2::Profiling
             // Used internally to write into Samples without a lock.
             std::atomic<size_t> SampleIterator{};
 
-            double MinTimeUs{};
+            std::atomic<double> MinTimeUs{};
 
-            double MaxTimeUs{};
+            std::atomic<double> MaxTimeUs{};
 
-            double TotalTimeUs{};
+            std::atomic<double> TotalTimeUs{};
+
+            std::atomic<uint64_t> AllocationCount{};
+
+            std::atomic<uint64_t> AllocatedBytes{};
 
             // Functions that called us.
             std::unordered_set<Function*> Parents;
@@ -95,6 +127,8 @@ namespace OpenRCT2::Profiling
             // Functions that this function called.
             std::unordered_set<Function*> Children;
 
+            FrameStage Stage = FrameStage::None;
+
             uint64_t GetCallCount() const noexcept override
             {
                 return CallCount.load();
@@ -120,25 +154,32 @@ namespace OpenRCT2::Profiling
 
             double GetTotalTime() const override
             {
-                std::scoped_lock lock(Mutex);
-                return TotalTimeUs;
+                return TotalTimeUs.load();
             }
 
             double GetMinTime() const override
             {
-                std::scoped_lock lock(Mutex);
-                return MinTimeUs;
+                return MinTimeUs.load();
             }
 
             double GetMaxTime() const override
             {
-                std::scoped_lock lock(Mutex);
-                return MaxTimeUs;
+                return MaxTimeUs.load();
+            }
+
+            AllocationCounters GetAllocations() const override
+            {
+                return { AllocationCount.load(), AllocatedBytes.load() };
             }
         };
 
-        template<typename TName> struct FunctionWrapper : FunctionInternal
+        template<typename TName, FrameStage TStage> struct FunctionWrapper : FunctionInternal
         {
+            FunctionWrapper()
+            {
+                Stage = TStage;
+            }
+
             const char* GetName() const noexcept override
             {
                 return TName::Str();
@@ -149,9 +190,9 @@ namespace OpenRCT2::Profiling
         // This avoids the compiler generating thread-safe initialization
         // by making a unique type per function which hosts a global using
         // the inline keyword for the variable (C++17).
-        template<typename TName> struct Storage
+        template<typename TName, FrameStage TStage = FrameStage::None> struct Storage
         {
-            static inline FunctionWrapper<TName> Data;
+            static inline FunctionWrapper<TName, TStage> Data;
         };
 
         void FunctionEnter(Function& func);
@@ -190,4 +231,44 @@ namespace OpenRCT2::Profiling
 
     bool ExportCSV(const std::string& filePath);
 
+    // Names the calling thread in the exported trace, threads without a name are listed by their id.
+    void SetThreadName(const std::string& name);
+
+    /**
+     * Writes the most recent calls of every thread in the Chrome trace event format, which can be opened with
+     * chrome://tracing or Perfetto. Each thread records its calls into its own buffer without locking.
+     */
+    bool ExportChromeTrace(const std::string& filePath);
+
+    /**
+     * Frame time percentiles of the most recent frames in milliseconds, in total and per stage. The stage times are
+     * the time spent in the stage's functions summed up over all threads, excluding nested stages.
+     */
+    struct FrameStats
+    {
+        struct Percentiles
+        {
+            double P50{};
+            double P95{};
+            double P99{};
+        };
+
+        // Upper bounds of the frame time histogram buckets in milliseconds, the last bucket counts everything above.
+        static constexpr std::array<double, 7> HistogramBounds = { 7.0, 8.5, 17.0, 25.0, 34.0, 50.0, 100.0 };
+
+        size_t NumFrames{};
+        Percentiles FrameTime;
+        std::array<Percentiles, static_cast<size_t>(FrameStage::Count)> Stages;
+        std::array<uint32_t, HistogramBounds.size() + 1> Histogram{};
+    };
+
+    // Ends the current frame of the frame statistics, called once per drawn frame.
+    void MarkFrame();
+
+    FrameStats GetFrameStats();
+    const char* GetFrameStageName(FrameStage stage);
+
+    // Writes the frame statistics followed by the times of each recorded frame.
+    bool ExportFrameLog(const std::string& filePath);
+
 } // namespace OpenRCT2::Profiling
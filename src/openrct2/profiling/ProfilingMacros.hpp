@@ -31,12 +31,20 @@ namespace OpenRCT2::Profiling
 #if defined(__clang_major__) && __clang_major__ <= 5
     // Clang 5 crashes using the profiler, we need to disable it.
 #    define PROFILED_FUNCTION()
+#    define PROFILED_FRAME_STAGE(stage)
 #else
 
 #    define PROFILED_FUNCTION()                                                                                                \
         PROFILED_FUNCTION_NAME(PROFILING_FUNC_NAME)                                                                            \
         static auto& _profiling_func = ::OpenRCT2::Profiling::Detail::Storage<Profiler_FunctionLiteral>::Data;                 \
         ::OpenRCT2::Profiling::ScopedProfiling<decltype(_profiling_func)> _profiling_scope(_profiling_func);
+
+// Profiles the function like PROFILED_FUNCTION and counts its time towards the given FrameStage of the frame statistics.
+#    define PROFILED_FRAME_STAGE(stage)                                                                                        \
+        PROFILED_FUNCTION_NAME(PROFILING_FUNC_NAME)                                                                            \
+        static auto& _profiling_func = ::OpenRCT2::Profiling::Detail::Storage<                                                 \
+            Profiler_FunctionLiteral, ::OpenRCT2::Profiling::FrameStage::stage>::Data;                                         \
+        ::OpenRCT2::Profiling::ScopedProfiling<decltype(_profiling_func)> _profiling_scope(_profiling_func);
 #endif
 
 } // namespace OpenRCT2::Profiling
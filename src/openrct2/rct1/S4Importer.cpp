@@ -171,6 +171,16 @@ namespace RCT1
             return ParkLoadResult(GetRequiredObjects());
         }
 
+        void LoadDetails(const utf8* path) override
+        {
+            // The details are spread across the decoded park, but the entry and object mappings are not needed.
+            auto fs = FileStream(path, FILE_MODE_OPEN);
+            _s4 = *ReadAndDecodeS4(&fs, true);
+            _s4Path = path;
+            _isScenario = true;
+            _gameVersion = sawyercoding_detect_rct1_version(_s4.game_version) & FILE_VERSION_MASK;
+        }
+
         void Import() override
         {
             Initialise();
@@ -1190,7 +1200,9 @@ namespace RCT1
             dst.current_item = src.current_item;
             dst.vehicle_index = src.vehicle_index;
             dst.current_station = StationIndex::FromUnderlying(src.current_station);
-            for (size_t i = 0; i < std::size(src.velocity); i++)
+            auto numItems = std::min<size_t>(std::max(src.num_items, src.current_item), std::size(src.velocity));
+            dst.EnsureItems(numItems);
+            for (size_t i = 0; i < numItems; i++)
             {
                 dst.velocity[i] = src.velocity[i] / 2;
                 dst.altitude[i] = src.altitude[i] / 2;
@@ -1509,45 +1521,57 @@ namespace RCT1
             auto tilePointerIndex = TilePointerIndex<RCT12TileElement>(
                 Limits::MaxMapSize, _s4.tile_elements, std::size(_s4.tile_elements));
 
-            std::vector<TileElement> tileElements;
             const auto maxSize = _s4.map_size == 0 ? Limits::MaxMapSize : _s4.map_size;
-            for (TileCoordsXY coords = { 0, 0 }; coords.y < MAXIMUM_MAP_SIZE_TECHNICAL; coords.y++)
-            {
-                for (coords.x = 0; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
+            auto tileElements = RCT12ImportTileElements([&](const TileCoordsXY& coords, std::vector<TileElement>& elements) {
+                auto tileAdded = false;
+                if (coords.x < maxSize && coords.y < maxSize)
                 {
-                    auto tileAdded = false;
-                    if (coords.x < maxSize && coords.y < maxSize)
+                    // This is the equivalent of map_get_first_element_at(x, y), but on S4 data.
+                    RCT12TileElement* srcElement = tilePointerIndex.GetFirstElementAt(coords);
+                    do
                     {
-                        // This is the equivalent of map_get_first_element_at(x, y), but on S4 data.
-                        RCT12TileElement* srcElement = tilePointerIndex.GetFirstElementAt(coords);
-                        do
-                        {
-                            if (srcElement->base_height == Limits::MaxElementHeight)
-                                continue;
+                        if (srcElement->base_height == Limits::MaxElementHeight)
+                            continue;
 
-                            // Reserve 8 elements for import
-                            auto originalSize = tileElements.size();
-                            tileElements.resize(originalSize + 16);
-                            auto dstElement = tileElements.data() + originalSize;
-                            auto numAddedElements = ImportTileElement(dstElement, srcElement);
-                            tileElements.resize(originalSize + numAddedElements);
-                            tileAdded = true;
-                        } while (!(srcElement++)->IsLastForTile());
-                    }
+                        // Reserve 8 elements for import
+                        auto originalSize = elements.size();
+                        elements.resize(originalSize + 16);
+                        auto dstElement = elements.data() + originalSize;
+                        auto numAddedElements = ImportTileElement(dstElement, srcElement);
+                        elements.resize(originalSize + numAddedElements);
+                        tileAdded = true;
+                    } while (!(srcElement++)->IsLastForTile());
+                }
 
-                    if (!tileAdded)
-                    {
-                        // Add a default surface element, we always need at least one element per tile
-                        auto& dstElement = tileElements.emplace_back();
-                        dstElement.ClearAs(TileElementType::Surface);
-                        dstElement.SetLastForTile(true);
-                    }
+                if (!tileAdded)
+                {
+                    // Add a default surface element, we always need at least one element per tile
+                    auto& dstElement = elements.emplace_back();
+                    dstElement.ClearAs(TileElementType::Surface);
+                    dstElement.SetLastForTile(true);
+                }
 
-                    // Set last element flag in case the original last element was never added
-                    if (tileElements.size() > 0)
-                    {
-                        tileElements.back().SetLastForTile(true);
-                    }
+                // Set last element flag in case the original last element was never added
+                elements.back().SetLastForTile(true);
+            });
+
+            // The tiles are converted on several threads, so the banners are only created here.
+            for (auto& element : tileElements)
+            {
+                auto* bannerElement = element.AsBanner();
+                if (bannerElement == nullptr || bannerElement->GetIndex().IsNull())
+                {
+                    continue;
+                }
+                auto index = bannerElement->GetIndex();
+                auto* dstBanner = GetOrCreateBanner(index);
+                if (dstBanner == nullptr)
+                {
+                    bannerElement->SetIndex(BannerIndex::GetNull());
+                }
+                else
+                {
+                    ImportBanner(dstBanner, &_s4.banners[index.ToUnderlying()]);
                 }
             }
 
@@ -1828,20 +1852,11 @@ namespace RCT1
                     dst2->SetPosition(src2->GetPosition());
                     dst2->SetAllowedEdges(src2->GetAllowedEdges());
 
+                    // The banner itself is imported by ImportTileElements
                     auto index = src2->GetIndex();
                     if (index < std::size(_s4.banners))
                     {
-                        auto srcBanner = &_s4.banners[index];
-                        auto dstBanner = GetOrCreateBanner(BannerIndex::FromUnderlying(index));
-                        if (dstBanner == nullptr)
-                        {
-                            dst2->SetIndex(BannerIndex::GetNull());
-                        }
-                        else
-                        {
-                            ImportBanner(dstBanner, srcBanner);
-                            dst2->SetIndex(BannerIndex::FromUnderlying(index));
-                        }
+                        dst2->SetIndex(BannerIndex::FromUnderlying(index));
                     }
                     else
                     {
@@ -9,6 +9,7 @@
 
 #include "RCT12.h"
 
+#include "../core/JobPool.h"
 #include "../core/String.hpp"
 #include "../localisation/Formatting.h"
 #include "../localisation/Localisation.h"
@@ -20,6 +21,7 @@
 #include "../world/Banner.h"
 #include "../world/Footpath.h"
 #include "../world/LargeScenery.h"
+#include "../world/Map.h"
 #include "../world/SmallScenery.h"
 #include "../world/Surface.h"
 #include "../world/TileElement.h"
@@ -824,3 +826,38 @@ ResearchItem RCT12ResearchItem::ToResearchItem() const
 
     return newResearchItem;
 }
+
+std::vector<TileElement> RCT12ImportTileElements(
+    const std::function<void(const TileCoordsXY& coords, std::vector<TileElement>& elements)>& importTile)
+{
+    constexpr int32_t RowsPerBand = 16;
+    constexpr size_t NumBands = (MAXIMUM_MAP_SIZE_TECHNICAL + RowsPerBand - 1) / RowsPerBand;
+
+    std::vector<std::vector<TileElement>> bands(NumBands);
+    JobPool::ParallelFor(0, NumBands, 1, [&bands, &importTile](size_t band) {
+        auto& elements = bands[band];
+        const auto yBegin = static_cast<int32_t>(band) * RowsPerBand;
+        const auto yEnd = std::min(yBegin + RowsPerBand, MAXIMUM_MAP_SIZE_TECHNICAL);
+        for (TileCoordsXY coords = { 0, yBegin }; coords.y < yEnd; coords.y++)
+        {
+            for (coords.x = 0; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
+            {
+                importTile(coords, elements);
+            }
+        }
+    });
+
+    size_t numElements = 0;
+    for (const auto& elements : bands)
+    {
+        numElements += elements.size();
+    }
+
+    std::vector<TileElement> tileElements;
+    tileElements.reserve(numElements);
+    for (const auto& elements : bands)
+    {
+        tileElements.insert(tileElements.end(), elements.begin(), elements.end());
+    }
+    return tileElements;
+}
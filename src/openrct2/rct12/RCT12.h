@@ -18,11 +18,14 @@
 #include "../world/tile_element/TileElementType.h"
 #include "Limits.h"
 
+#include <functional>
 #include <string>
 #include <string_view>
 #include <vector>
 
 class ObjectList;
+struct TileCoordsXY;
+struct TileElement;
 
 using track_type_t = uint16_t;
 using RCT12TrackType = uint8_t;
@@ -862,6 +865,14 @@ static constexpr money32 RCT12_COMPANY_VALUE_ON_FAILED_OBJECTIVE = 0x80000001;
 
 money64 RCT12CompletedCompanyValueToOpenRCT2(money32 origValue);
 
+/**
+ * Converts every tile of a legacy map in bands of rows on the worker threads and joins the bands in row order.
+ * importTile appends at least one element for the given tile and must not change any global state, references such
+ * as banners are to be resolved once all tiles have been converted.
+ */
+std::vector<TileElement> RCT12ImportTileElements(
+    const std::function<void(const TileCoordsXY& coords, std::vector<TileElement>& elements)>& importTile);
+
 template<typename T> std::vector<uint16_t> RCT12GetRideTypesBeenOn(T* srcPeep)
 {
     std::vector<uint16_t> ridesTypesBeenOn;
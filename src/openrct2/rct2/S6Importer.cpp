@@ -210,6 +210,17 @@ namespace RCT2
             return ParkLoadResult(GetRequiredObjects());
         }
 
+        void LoadDetails(const utf8* path) override
+        {
+            auto fs = OpenRCT2::FileStream(path, OpenRCT2::FILE_MODE_OPEN);
+            auto chunkReader = SawyerChunkReader(&fs);
+            chunkReader.ReadChunk(&_s6.header, sizeof(_s6.header));
+            if (_s6.header.type == S6_TYPE_SCENARIO)
+            {
+                chunkReader.ReadChunk(&_s6.info, sizeof(_s6.info));
+            }
+        }
+
         bool GetDetails(scenario_index_entry* dst) override
         {
             *dst = {};
@@ -985,7 +996,9 @@ namespace RCT2
             dst.current_item = src.current_item;
             dst.vehicle_index = src.vehicle_index;
             dst.current_station = StationIndex::FromUnderlying(src.current_station);
-            for (size_t i = 0; i < std::size(src.velocity); i++)
+            auto numItems = std::min<size_t>(std::max(src.num_items, src.current_item), std::size(src.velocity));
+            dst.EnsureItems(numItems);
+            for (size_t i = 0; i < numItems; i++)
             {
                 dst.velocity[i] = src.velocity[i];
                 dst.altitude[i] = src.altitude[i];
@@ -1121,68 +1134,77 @@ namespace RCT2
             auto tilePointerIndex = TilePointerIndex<RCT12TileElement>(
                 Limits::MaxMapSize, _s6.tile_elements, std::size(_s6.tile_elements));
 
-            std::vector<TileElement> tileElements;
-            bool nextElementInvisible = false;
-            bool restOfTileInvisible = false;
             const auto maxSize = std::min(Limits::MaxMapSize, _s6.map_size);
-            for (TileCoordsXY coords = { 0, 0 }; coords.y < MAXIMUM_MAP_SIZE_TECHNICAL; coords.y++)
-            {
-                for (coords.x = 0; coords.x < MAXIMUM_MAP_SIZE_TECHNICAL; coords.x++)
-                {
-                    nextElementInvisible = false;
-                    restOfTileInvisible = false;
+            auto tileElements = RCT12ImportTileElements([&](const TileCoordsXY& coords, std::vector<TileElement>& elements) {
+                bool nextElementInvisible = false;
+                bool restOfTileInvisible = false;
 
-                    auto tileAdded = false;
-                    if (coords.x < maxSize && coords.y < maxSize)
+                auto tileAdded = false;
+                if (coords.x < maxSize && coords.y < maxSize)
+                {
+                    const auto* srcElement = tilePointerIndex.GetFirstElementAt(coords);
+                    if (srcElement != nullptr)
                     {
-                        const auto* srcElement = tilePointerIndex.GetFirstElementAt(coords);
-                        if (srcElement != nullptr)
+                        do
                         {
-                            do
+                            if (srcElement->base_height == RCT12::Limits::MaxElementHeight)
                             {
-                                if (srcElement->base_height == RCT12::Limits::MaxElementHeight)
-                                {
-                                    continue;
-                                }
+                                continue;
+                            }
 
-                                auto tileElementType = srcElement->GetType();
-                                if (tileElementType == RCT12TileElementType::Corrupt)
-                                {
-                                    // One property of corrupt elements was to hide tops of tower tracks, and to avoid the next
-                                    // element from being hidden, multiple consecutive corrupt elements were sometimes used.
-                                    // This would essentially toggle the flag, so we inverse nextElementInvisible here instead
-                                    // of always setting it to true.
-                                    nextElementInvisible = !nextElementInvisible;
-                                    continue;
-                                }
-                                if (tileElementType == RCT12TileElementType::EightCarsCorrupt14
-                                    || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
-                                {
-                                    restOfTileInvisible = true;
-                                    continue;
-                                }
+                            auto tileElementType = srcElement->GetType();
+                            if (tileElementType == RCT12TileElementType::Corrupt)
+                            {
+                                // One property of corrupt elements was to hide tops of tower tracks, and to avoid the next
+                                // element from being hidden, multiple consecutive corrupt elements were sometimes used.
+                                // This would essentially toggle the flag, so we inverse nextElementInvisible here instead
+                                // of always setting it to true.
+                                nextElementInvisible = !nextElementInvisible;
+                                continue;
+                            }
+                            if (tileElementType == RCT12TileElementType::EightCarsCorrupt14
+                                || tileElementType == RCT12TileElementType::EightCarsCorrupt15)
+                            {
+                                restOfTileInvisible = true;
+                                continue;
+                            }
 
-                                auto& dstElement = tileElements.emplace_back();
-                                ImportTileElement(&dstElement, srcElement, nextElementInvisible || restOfTileInvisible);
-                                nextElementInvisible = false;
-                                tileAdded = true;
-                            } while (!(srcElement++)->IsLastForTile());
-                        }
+                            auto& dstElement = elements.emplace_back();
+                            ImportTileElement(&dstElement, srcElement, nextElementInvisible || restOfTileInvisible);
+                            nextElementInvisible = false;
+                            tileAdded = true;
+                        } while (!(srcElement++)->IsLastForTile());
                     }
+                }
 
-                    if (!tileAdded)
-                    {
-                        // Add a default surface element, we always need at least one element per tile
-                        auto& dstElement = tileElements.emplace_back();
-                        dstElement.ClearAs(TileElementType::Surface);
-                        dstElement.SetLastForTile(true);
-                    }
+                if (!tileAdded)
+                {
+                    // Add a default surface element, we always need at least one element per tile
+                    auto& dstElement = elements.emplace_back();
+                    dstElement.ClearAs(TileElementType::Surface);
+                    dstElement.SetLastForTile(true);
+                }
 
-                    // Set last element flag in case the original last element was never added
-                    if (tileElements.size() > 0)
-                    {
-                        tileElements.back().SetLastForTile(true);
-                    }
+                // Set last element flag in case the original last element was never added
+                elements.back().SetLastForTile(true);
+            });
+
+            // The tiles are converted on several threads, so the banners are only created here.
+            for (auto& element : tileElements)
+            {
+                auto bannerIndex = element.GetBannerIndex();
+                if (bannerIndex.IsNull())
+                {
+                    continue;
+                }
+                auto* dstBanner = GetOrCreateBanner(bannerIndex);
+                if (dstBanner == nullptr)
+                {
+                    element.SetBannerIndex(BannerIndex::GetNull());
+                }
+                else
+                {
+                    ImportBanner(dstBanner, &_s6.banners[bannerIndex.ToUnderlying()]);
                 }
             }
             SetTileElements(std::move(tileElements));
@@ -1368,7 +1390,7 @@ namespace RCT2
                     dst2->SetAcrossTrack(src2->IsAcrossTrack());
                     dst2->SetAnimationIsBackwards(src2->AnimationIsBackwards());
 
-                    // Import banner information
+                    // Import banner information, the banner itself is imported by ImportTileElements
                     dst2->SetBannerIndex(BannerIndex::GetNull());
                     auto entry = dst2->GetEntry();
                     if (entry != nullptr && entry->scrolling_mode != SCROLLING_MODE_NONE)
@@ -1376,17 +1398,7 @@ namespace RCT2
                         auto bannerIndex = src2->GetBannerIndex();
                         if (bannerIndex < std::size(_s6.banners))
                         {
-                            auto srcBanner = &_s6.banners[bannerIndex];
-                            auto dstBanner = GetOrCreateBanner(BannerIndex::FromUnderlying(bannerIndex));
-                            if (dstBanner == nullptr)
-                            {
-                                dst2->SetBannerIndex(BannerIndex::GetNull());
-                            }
-                            else
-                            {
-                                ImportBanner(dstBanner, srcBanner);
-                                dst2->SetBannerIndex(BannerIndex::FromUnderlying(src2->GetBannerIndex()));
-                            }
+                            dst2->SetBannerIndex(BannerIndex::FromUnderlying(bannerIndex));
                         }
                     }
                     break;
@@ -1401,7 +1413,7 @@ namespace RCT2
                     dst2->SetPrimaryColour(src2->GetPrimaryColour());
                     dst2->SetSecondaryColour(src2->GetSecondaryColour());
 
-                    // Import banner information
+                    // Import banner information, the banner itself is imported by ImportTileElements
                     dst2->SetBannerIndex(BannerIndex::GetNull());
                     auto entry = dst2->GetEntry();
                     if (entry != nullptr && entry->scrolling_mode != SCROLLING_MODE_NONE)
@@ -1409,17 +1421,7 @@ namespace RCT2
                         auto bannerIndex = src2->GetBannerIndex();
                         if (bannerIndex < std::size(_s6.banners))
                         {
-                            auto srcBanner = &_s6.banners[bannerIndex];
-                            auto dstBanner = GetOrCreateBanner(BannerIndex::FromUnderlying(bannerIndex));
-                            if (dstBanner == nullptr)
-                            {
-                                dst2->SetBannerIndex(BannerIndex::GetNull());
-                            }
-                            else
-                            {
-                                ImportBanner(dstBanner, srcBanner);
-                                dst2->SetBannerIndex(BannerIndex::FromUnderlying(src2->GetBannerIndex()));
-                            }
+                            dst2->SetBannerIndex(BannerIndex::FromUnderlying(bannerIndex));
                         }
                     }
                     break;
@@ -1432,20 +1434,11 @@ namespace RCT2
                     dst2->SetPosition(src2->GetPosition());
                     dst2->SetAllowedEdges(src2->GetAllowedEdges());
 
+                    // The banner itself is imported by ImportTileElements
                     auto bannerIndex = src2->GetIndex();
                     if (bannerIndex < std::size(_s6.banners))
                     {
-                        auto srcBanner = &_s6.banners[bannerIndex];
-                        auto dstBanner = GetOrCreateBanner(BannerIndex::FromUnderlying(bannerIndex));
-                        if (dstBanner == nullptr)
-                        {
-                            dst2->SetIndex(BannerIndex::GetNull());
-                        }
-                        else
-                        {
-                            ImportBanner(dstBanner, srcBanner);
-                            dst2->SetIndex(BannerIndex::FromUnderlying(bannerIndex));
-                        }
+                        dst2->SetIndex(BannerIndex::FromUnderlying(bannerIndex));
                     }
                     else
                     {
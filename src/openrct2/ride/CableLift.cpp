@@ -266,7 +266,7 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
 
         track_progress = trackProgress;
         const auto moveInfo = GetMoveInfo();
-        auto nextVehiclePosition = CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z } + TrackLocation;
+        auto nextVehiclePosition = CoordsXYZ{ moveInfo.x, moveInfo.y, moveInfo.z } + TrackLocation;
 
         uint8_t remainingDistanceFlags = 0;
         nextVehiclePosition.z += GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
@@ -282,9 +282,9 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
         _vehicleCurPosition.y = nextVehiclePosition.y;
         _vehicleCurPosition.z = nextVehiclePosition.z;
 
-        sprite_direction = moveInfo->direction;
-        bank_rotation = moveInfo->bank_rotation;
-        Pitch = moveInfo->Pitch;
+        sprite_direction = moveInfo.direction;
+        bank_rotation = moveInfo.bank_rotation;
+        Pitch = moveInfo.Pitch;
 
         if (remaining_distance >= 13962)
         {
@@ -332,7 +332,7 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
         }
         track_progress = trackProgress;
         const auto moveInfo = GetMoveInfo();
-        auto unk = CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z } + TrackLocation;
+        auto unk = CoordsXYZ{ moveInfo.x, moveInfo.y, moveInfo.z } + TrackLocation;
 
         uint8_t remainingDistanceFlags = 0;
         unk.z += GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
@@ -348,9 +348,9 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
         _vehicleCurPosition.y = unk.y;
         _vehicleCurPosition.z = unk.z;
 
-        sprite_direction = moveInfo->direction;
-        bank_rotation = moveInfo->bank_rotation;
-        Pitch = moveInfo->Pitch;
+        sprite_direction = moveInfo.direction;
+        bank_rotation = moveInfo.bank_rotation;
+        Pitch = moveInfo.Pitch;
 
         if (remaining_distance < 0)
         {
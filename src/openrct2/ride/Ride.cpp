@@ -78,6 +78,7 @@
 #include <cstdlib>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <optional>
 
 using namespace OpenRCT2;
@@ -94,6 +95,17 @@ static constexpr const int32_t RideInspectionInterval[] = {
 
 static std::vector<Ride> _rides;
 
+// Breakdowns and inspections are rolled for every ride on the same ticks, so Ride::UpdateAll works out once per tick
+// which of them are due rather than each ride checking the tick again.
+struct RidePeriodicUpdates
+{
+    bool Breakdown;
+    bool Inspection;
+    // Breakdown status updates take turns by the first byte of the ride id.
+    uint8_t BreakdownStatusRide;
+};
+static RidePeriodicUpdates _ridePeriodicUpdates;
+
 // Static function declarations
 Staff* find_closest_mechanic(const CoordsXY& entrancePosition, int32_t forInspection);
 static void ride_breakdown_status_update(Ride* ride);
@@ -279,29 +291,82 @@ int32_t Ride::GetMaxQueueTime() const
 
 Guest* Ride::GetQueueHeadGuest(StationIndex stationIndex) const
 {
+    return TryGetEntity<Guest>(GetStation(stationIndex).FirstPeepInQueue);
+}
+
+/**
+ * Recounts the queue of a station and restores the links that are not saved, following GuestNextInQueue from the
+ * last guest in the queue to the first.
+ */
+void Ride::RebuildQueue(StationIndex stationIndex)
+{
+    auto& station = GetStation(stationIndex);
+    uint16_t count = 0;
+    auto prevIndex = EntityId::GetNull();
+    auto spriteIndex = station.LastPeepInQueue;
     Guest* peep;
-    Guest* result = nullptr;
-    auto spriteIndex = GetStation(stationIndex).LastPeepInQueue;
-    while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr)
+    // A chain that is longer than the number of entities has a loop in it.
+    while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr && count < MAX_ENTITIES)
     {
+        peep->GuestPrevInQueue = prevIndex;
+        prevIndex = spriteIndex;
         spriteIndex = peep->GuestNextInQueue;
-        result = peep;
+        count++;
     }
-    return result;
+    station.FirstPeepInQueue = prevIndex;
+    station.QueueLength = count;
 }
 
-void Ride::UpdateQueueLength(StationIndex stationIndex)
+void Ride::CheckQueue(StationIndex stationIndex) const
 {
+    const auto& station = GetStation(stationIndex);
     uint16_t count = 0;
-    Guest* peep;
-    auto& station = GetStation(stationIndex);
+    auto prevIndex = EntityId::GetNull();
     auto spriteIndex = station.LastPeepInQueue;
-    while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr)
+    const Guest* peep;
+    while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr && count < MAX_ENTITIES)
     {
+        if (peep->GuestPrevInQueue != prevIndex)
+        {
+            log_error(
+                "Ride %u station %u: guest %u has the wrong guest behind it.", id.ToUnderlying(), stationIndex.ToUnderlying(),
+                spriteIndex.ToUnderlying());
+        }
+        prevIndex = spriteIndex;
         spriteIndex = peep->GuestNextInQueue;
         count++;
     }
-    station.QueueLength = count;
+    if (station.FirstPeepInQueue != prevIndex || station.QueueLength != count)
+    {
+        log_error(
+            "Ride %u station %u: queue of %u guests is recorded as %u guests.", id.ToUnderlying(), stationIndex.ToUnderlying(),
+            count, station.QueueLength);
+    }
+}
+
+void Ride::QueueAddGuest(StationIndex stationIndex, Guest* peep)
+{
+    assert(stationIndex.ToUnderlying() < OpenRCT2::Limits::MaxStationsPerRide);
+    assert(peep != nullptr);
+
+    auto& station = GetStation(stationIndex);
+    auto* lastGuest = TryGetEntity<Guest>(station.LastPeepInQueue);
+    peep->GuestNextInQueue = station.LastPeepInQueue;
+    peep->GuestPrevInQueue = EntityId::GetNull();
+    if (lastGuest != nullptr)
+    {
+        lastGuest->GuestPrevInQueue = peep->sprite_index;
+    }
+    else
+    {
+        station.FirstPeepInQueue = peep->sprite_index;
+    }
+    station.LastPeepInQueue = peep->sprite_index;
+    station.QueueLength++;
+
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    CheckQueue(stationIndex);
+#endif
 }
 
 void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
@@ -309,17 +374,86 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     assert(stationIndex.ToUnderlying() < OpenRCT2::Limits::MaxStationsPerRide);
     assert(peep != nullptr);
 
+    auto& station = GetStation(stationIndex);
+    auto* queueHeadGuest = GetQueueHeadGuest(stationIndex);
+    const bool isHeadValid = queueHeadGuest != nullptr ? queueHeadGuest->GuestNextInQueue.IsNull()
+                                                       : TryGetEntity<Guest>(station.LastPeepInQueue) == nullptr;
+    if (!isHeadValid)
+    {
+        // The links are out of date, so find the front the slow way.
+        RebuildQueue(stationIndex);
+        queueHeadGuest = GetQueueHeadGuest(stationIndex);
+    }
+
     peep->GuestNextInQueue = EntityId::GetNull();
-    auto* queueHeadGuest = GetQueueHeadGuest(peep->CurrentRideStation);
+    peep->GuestPrevInQueue = station.FirstPeepInQueue;
     if (queueHeadGuest == nullptr)
     {
-        GetStation(peep->CurrentRideStation).LastPeepInQueue = peep->sprite_index;
+        station.LastPeepInQueue = peep->sprite_index;
+        peep->GuestPrevInQueue = EntityId::GetNull();
     }
     else
     {
         queueHeadGuest->GuestNextInQueue = peep->sprite_index;
     }
-    UpdateQueueLength(peep->CurrentRideStation);
+    station.FirstPeepInQueue = peep->sprite_index;
+    station.QueueLength++;
+
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    CheckQueue(stationIndex);
+#endif
+}
+
+void Ride::QueueRemoveGuest(StationIndex stationIndex, Guest* peep)
+{
+    auto& station = GetStation(stationIndex);
+    // Make sure we don't underflow, building while paused might reset it to 0 where peeps have
+    // not yet left the queue.
+    if (station.QueueLength > 0)
+    {
+        station.QueueLength--;
+    }
+
+    const auto spriteIndex = peep->sprite_index;
+    auto* behind = TryGetEntity<Guest>(peep->GuestPrevInQueue);
+    auto* ahead = TryGetEntity<Guest>(peep->GuestNextInQueue);
+    const bool isLast = station.LastPeepInQueue == spriteIndex;
+    if (!isLast && (behind == nullptr || behind->GuestNextInQueue != spriteIndex))
+    {
+        // The guest is not in this queue.
+        peep->GuestPrevInQueue = EntityId::GetNull();
+        return;
+    }
+
+    if (isLast)
+    {
+        station.LastPeepInQueue = peep->GuestNextInQueue;
+    }
+    else
+    {
+        behind->GuestNextInQueue = peep->GuestNextInQueue;
+    }
+    if (ahead != nullptr && ahead->GuestPrevInQueue == spriteIndex)
+    {
+        ahead->GuestPrevInQueue = isLast ? EntityId::GetNull() : peep->GuestPrevInQueue;
+    }
+    if (station.FirstPeepInQueue == spriteIndex)
+    {
+        station.FirstPeepInQueue = isLast ? EntityId::GetNull() : peep->GuestPrevInQueue;
+    }
+    peep->GuestPrevInQueue = EntityId::GetNull();
+
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    CheckQueue(stationIndex);
+#endif
+}
+
+void Ride::QueueClear(StationIndex stationIndex)
+{
+    auto& station = GetStation(stationIndex);
+    station.QueueLength = 0;
+    station.LastPeepInQueue = EntityId::GetNull();
+    station.FirstPeepInQueue = EntityId::GetNull();
 }
 
 /**
@@ -451,6 +585,71 @@ bool ride_try_get_origin_element(const Ride* ride, CoordsXYE* output)
     return resultTileElement != nullptr;
 }
 
+/**
+ * Connections found by the track block searches, so walking a circuit again follows the cached element pointers rather
+ * than looking through the tiles. Entries are only used while the elements revision they were found in is current,
+ * which also keeps the pointers valid. Ride ratings walk circuits on the job pool, hence one cache per thread.
+ */
+namespace
+{
+    struct TrackConnectionKey
+    {
+        CoordsXYZ Pos;
+        RideId RideIndex;
+        uint8_t Direction;
+        bool IsGhost;
+
+        bool operator==(const TrackConnectionKey& other) const
+        {
+            return Pos == other.Pos && RideIndex == other.RideIndex && Direction == other.Direction
+                && IsGhost == other.IsGhost;
+        }
+    };
+
+    struct TrackNextConnection
+    {
+        uint32_t Revision;
+        TrackConnectionKey Key;
+        TileElement* Element;
+        int32_t Z;
+        int32_t Direction;
+    };
+
+    struct TrackPreviousConnection
+    {
+        uint32_t Revision;
+        TrackConnectionKey Key;
+        track_begin_end BeginEnd;
+    };
+
+    struct TrackConnectionCache
+    {
+        static constexpr size_t Size = 8192;
+
+        std::array<TrackNextConnection, Size> Next{};
+        std::array<TrackPreviousConnection, Size> Previous{};
+
+        static size_t GetIndex(const TrackConnectionKey& key)
+        {
+            auto hash = static_cast<uint32_t>(key.Pos.x / COORDS_XY_STEP) * 0x9E3779B1u;
+            hash ^= static_cast<uint32_t>(key.Pos.y / COORDS_XY_STEP) * 0x85EBCA77u;
+            hash ^= static_cast<uint32_t>(key.Pos.z) * 0xC2B2AE3Du;
+            hash ^= (static_cast<uint32_t>(key.RideIndex.ToUnderlying()) << 3) | key.Direction;
+            return (hash ^ (hash >> 16)) % Size;
+        }
+    };
+} // namespace
+
+static TrackConnectionCache& GetTrackConnectionCache()
+{
+    thread_local std::unique_ptr<TrackConnectionCache> cache;
+    if (cache == nullptr)
+    {
+        cache = std::make_unique<TrackConnectionCache>();
+    }
+    return *cache;
+}
+
 /**
  *
  * rct2: 0x006C6096
@@ -470,6 +669,19 @@ bool track_block_get_next_from_zero(
         trackPos += CoordsDirectionDelta[direction_start];
     }
 
+    const auto revision = map_get_elements_revision();
+    const TrackConnectionKey key = { trackPos, ride->id, direction_start, isGhost };
+    auto& cached = GetTrackConnectionCache().Next[TrackConnectionCache::GetIndex(key)];
+    if (cached.Revision == revision && cached.Key == key)
+    {
+        if (z != nullptr)
+            *z = cached.Z;
+        if (direction != nullptr)
+            *direction = cached.Direction;
+        *output = { trackPos, cached.Element };
+        return true;
+    }
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     if (tileElement == nullptr)
     {
@@ -509,6 +721,7 @@ bool track_block_get_next_from_zero(
         if (nextZ != trackPos.z)
             continue;
 
+        cached = { revision, key, tileElement, tileElement->GetBaseZ(), nextRotation };
         if (z != nullptr)
             *z = tileElement->GetBaseZ();
         if (direction != nullptr)
@@ -593,6 +806,18 @@ bool track_block_get_previous_from_zero(
         trackPos += CoordsDirectionDelta[direction];
     }
 
+    const auto revision = map_get_elements_revision();
+    const TrackConnectionKey key = { trackPos, ride->id, directionStart, false };
+    auto& cached = GetTrackConnectionCache().Previous[TrackConnectionCache::GetIndex(key)];
+    if (cached.Revision == revision && cached.Key == key)
+    {
+        // Only the fields a successful search sets, end_element is left alone.
+        auto* endElement = outTrackBeginEnd->end_element;
+        *outTrackBeginEnd = cached.BeginEnd;
+        outTrackBeginEnd->end_element = endElement;
+        return true;
+    }
+
     TileElement* tileElement = map_get_first_element_at(trackPos);
     if (tileElement == nullptr)
     {
@@ -656,6 +881,7 @@ bool track_block_get_previous_from_zero(
         outTrackBeginEnd->begin_z += nextTrackBlock2->z - nextTrackBlock->z;
         outTrackBeginEnd->begin_direction = nextRotation;
         outTrackBeginEnd->end_direction = direction_reverse(directionStart);
+        cached = { revision, key, *outTrackBeginEnd };
         return true;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -912,6 +1138,17 @@ void reset_all_ride_build_dates()
     }
 }
 
+void ride_rebuild_all_queues()
+{
+    for (auto& ride : GetRideManager())
+    {
+        for (auto& station : ride.GetStations())
+        {
+            ride.RebuildQueue(ride.GetStationIndex(&station));
+        }
+    }
+}
+
 #pragma endregion
 
 #pragma region Construction
@@ -952,6 +1189,14 @@ void Ride::UpdateAll()
 
     window_update_viewport_ride_music();
 
+    const bool isTrackDesigner = (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) != 0;
+    _ridePeriodicUpdates.Breakdown = !(gCurrentTicks & 255) && !isTrackDesigner;
+    _ridePeriodicUpdates.Inspection = !(gCurrentTicks & 2047) && !isTrackDesigner;
+    // Breakdown updates originally were performed when (id == (gCurrentTicks / 2) & 0xFF)
+    // with the increased MAX_RIDES the update is tied to the first byte of the id this allows
+    // for identical balance with vanilla.
+    _ridePeriodicUpdates.BreakdownStatusRide = static_cast<uint8_t>((gCurrentTicks / 2) & 0xFF);
+
     // Update rides
     for (auto& ride : GetRideManager())
         ride.Update();
@@ -1058,20 +1303,18 @@ void Ride::Update()
     else if (type == RIDE_TYPE_SPIRAL_SLIDE)
         UpdateSpiralSlide();
 
-    ride_breakdown_update(this);
+    if (_ridePeriodicUpdates.Breakdown)
+        ride_breakdown_update(this);
 
     // Various things include news messages
-    if (lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_DUE_INSPECTION))
+    if (_ridePeriodicUpdates.BreakdownStatusRide == static_cast<uint8_t>(id.ToUnderlying())
+        && (lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_DUE_INSPECTION)))
     {
-        // Breakdown updates originally were performed when (id == (gCurrentTicks / 2) & 0xFF)
-        // with the increased MAX_RIDES the update is tied to the first byte of the id this allows
-        // for identical balance with vanilla.
-        const auto updatingRideByte = static_cast<uint8_t>((gCurrentTicks / 2) & 0xFF);
-        if (updatingRideByte == static_cast<uint8_t>(id.ToUnderlying()))
-            ride_breakdown_status_update(this);
+        ride_breakdown_status_update(this);
     }
 
-    ride_inspection_update(this);
+    if (_ridePeriodicUpdates.Inspection)
+        ride_inspection_update(this);
 
     // If ride is simulating but crashed, reset the vehicles
     if (status == RideStatus::Simulating && (lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
@@ -1244,16 +1487,11 @@ static uint8_t _breakdownProblemProbabilities[] = {
 };
 
 /**
- *
+ * Called every 2048 ticks outside of the track designer, see _ridePeriodicUpdates.
  *  rct2: 0x006AC7C2
  */
 static void ride_inspection_update(Ride* ride)
 {
-    if (gCurrentTicks & 2047)
-        return;
-    if (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER)
-        return;
-
     ride->last_inspection++;
     if (ride->last_inspection == 0)
         ride->last_inspection--;
@@ -1309,17 +1547,11 @@ static int32_t get_age_penalty(Ride* ride)
 }
 
 /**
- *
+ * Called every 256 ticks outside of the track designer, see _ridePeriodicUpdates.
  *  rct2: 0x006AC622
  */
 static void ride_breakdown_update(Ride* ride)
 {
-    if (gCurrentTicks & 255)
-        return;
-
-    if (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER)
-        return;
-
     if (ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED))
         ride->downtime_history[0]++;
 
@@ -1969,6 +2201,8 @@ static void ride_measurement_update(Ride& ride, RideMeasurement& measurement)
     if (measurement.current_item >= RideMeasurement::MAX_ITEMS)
         return;
 
+    measurement.EnsureItems(measurement.current_item + 1);
+
     if (measurement.flags & RIDE_MEASUREMENT_FLAG_G_FORCES)
     {
         auto gForces = vehicle->GetGForces();
@@ -5825,21 +6059,17 @@ std::vector<RideId> GetTracklessRides()
     // Iterate map and build list of seen ride IDs
     std::vector<bool> seen;
     seen.resize(256);
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
-    {
-        auto trackEl = it.element->AsTrack();
-        if (trackEl != nullptr && !trackEl->IsGhost())
+    ForEachMapElement<TrackElement>([&seen](const TileCoordsXY&, const TrackElement& trackEl) {
+        if (!trackEl.IsGhost())
         {
-            auto rideId = trackEl->GetRideIndex().ToUnderlying();
+            auto rideId = trackEl.GetRideIndex().ToUnderlying();
             if (rideId >= seen.size())
             {
                 seen.resize(rideId + 1);
             }
             seen[rideId] = true;
         }
-    }
+    });
 
     // Get all rides that did not get seen during map iteration
     const auto& rideManager = GetRideManager();
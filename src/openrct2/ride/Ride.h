@@ -23,6 +23,7 @@
 #include <array>
 #include <limits>
 #include <string_view>
+#include <vector>
 
 struct IObjectManager;
 class Formatter;
@@ -55,6 +56,8 @@ struct RideStation
     uint8_t QueueTime;
     uint16_t QueueLength;
     EntityId LastPeepInQueue;
+    // The guest at the front of the queue. Not saved, rebuilt from the queue when a park is loaded.
+    EntityId FirstPeepInQueue;
 
     static constexpr uint8_t NO_TRAIN = std::numeric_limits<uint8_t>::max();
 
@@ -73,10 +76,25 @@ struct RideMeasurement
     uint16_t current_item{};
     uint8_t vehicle_index{};
     StationIndex current_station{};
-    int8_t vertical[MAX_ITEMS]{};
-    int8_t lateral[MAX_ITEMS]{};
-    uint8_t velocity[MAX_ITEMS]{};
-    uint8_t altitude[MAX_ITEMS]{};
+    // Only allocated as far as samples have been recorded, most circuits need far fewer than MAX_ITEMS.
+    std::vector<int8_t> vertical;
+    std::vector<int8_t> lateral;
+    std::vector<uint8_t> velocity;
+    std::vector<uint8_t> altitude;
+
+    /**
+     * Grows the sample arrays to hold at least numItems samples, new samples are zero.
+     */
+    void EnsureItems(size_t numItems)
+    {
+        if (velocity.size() < numItems)
+        {
+            vertical.resize(numItems);
+            lateral.resize(numItems);
+            velocity.resize(numItems);
+            altitude.resize(numItems);
+        }
+    }
 };
 
 enum class RideClassification
@@ -294,7 +312,7 @@ private:
     void Update();
     void UpdateChairlift();
     void UpdateSpiralSlide();
-    void UpdateQueueLength(StationIndex stationIndex);
+    void CheckQueue(StationIndex stationIndex) const;
     bool CreateVehicles(const CoordsXYE& element, bool isApplying);
     void MoveTrainsToBlockBrakes(TrackElement* firstBlock);
     money64 CalculateIncomePerHour() const;
@@ -345,7 +363,11 @@ public:
     int32_t GetTotalQueueLength() const;
     int32_t GetMaxQueueTime() const;
 
+    void QueueAddGuest(StationIndex stationIndex, Guest* peep);
     void QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep);
+    void QueueRemoveGuest(StationIndex stationIndex, Guest* peep);
+    void QueueClear(StationIndex stationIndex);
+    void RebuildQueue(StationIndex stationIndex);
     Guest* GetQueueHeadGuest(StationIndex stationIndex) const;
 
     void SetNameToDefault();
@@ -864,7 +886,7 @@ enum
     TRACK_ELEMENT_SET_SEAT_ROTATION = (1 << 5)
 };
 
-#define MAX_RIDE_MEASUREMENTS 8
+#define MAX_RIDE_MEASUREMENTS 64
 #define RIDE_VALUE_UNDEFINED 0xFFFF
 #define RIDE_INITIAL_RELIABILITY ((100 << 8) | 0xFF) // Upper byte is percentage, lower byte is "decimal".
 
@@ -979,6 +1001,7 @@ extern ObjectEntryIndex gLastEntranceStyle;
 int32_t ride_get_count();
 void ride_init_all();
 void reset_all_ride_build_dates();
+void ride_rebuild_all_queues();
 void ride_update_favourited_stat();
 void ride_check_all_reachable();
 
@@ -12,8 +12,11 @@
 #include "../Cheats.h"
 #include "../Context.h"
 #include "../OpenRCT2.h"
+#include "../config/Config.h"
+#include "../core/JobPool.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
+#include "../network/network.h"
 #include "../profiling/Profiling.h"
 #include "../scripting/ScriptEngine.h"
 #include "../world/Footpath.h"
@@ -25,7 +28,11 @@
 #include "Track.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <iterator>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -79,6 +86,37 @@ struct ShelteredEights
 
 RideRatingUpdateState gRideRatingUpdateState;
 
+enum class RideRatingsBatchState : uint8_t
+{
+    None,
+    // Rated while the ride was not tested, rate it again once it has been.
+    Untested,
+    Tested,
+};
+// How far each ride without ratings has been taken by ride_ratings_update_waiting_rides.
+static std::array<RideRatingsBatchState, OpenRCT2::Limits::MaxRidesInPark> _rideRatingsBatchStates;
+
+// Bounds the proximity loops of a ride, the track of a broken circuit might never lead back to the start.
+static constexpr uint32_t RideRatingsMaxProximitySteps = 1 << 17;
+
+/**
+ * What scoring the tiles around a track element added to the rating state, valid for as long as the element's tile
+ * and its four neighbours have not changed.
+ */
+struct ProximityCacheEntry
+{
+    // The element's own tile, followed by its neighbours in direction order.
+    std::array<uint64_t, 5> TileStamps;
+    std::array<uint16_t, PROXIMITY_COUNT> Scores;
+    uint8_t BaseHeight;
+    bool HasBaseHeight;
+};
+
+// Kept per ride, so the rides that ride_ratings_update_waiting_rides hands to the worker threads do not share one.
+static std::array<std::unordered_map<uint64_t, ProximityCacheEntry>, OpenRCT2::Limits::MaxRidesInPark> _proximityCaches;
+static std::atomic<uint64_t> _proximityCacheHits;
+static std::atomic<uint64_t> _proximityCacheMisses;
+
 static void ride_ratings_update_state(RideRatingUpdateState& state);
 static void ride_ratings_update_state_0(RideRatingUpdateState& state);
 static void ride_ratings_update_state_1(RideRatingUpdateState& state);
@@ -117,6 +155,72 @@ void ride_ratings_update_ride(const Ride& ride)
  *
  *  rct2: 0x006B5A2A
  */
+static bool ride_ratings_batch_enabled()
+{
+    // Rides get their ratings at a different time than they would otherwise, which multiplayer games can not allow.
+    return gConfigGeneral.parallel_ride_ratings && network_get_mode() == NETWORK_MODE_NONE;
+}
+
+/**
+ * Rates every ride that is waiting for ratings straight away instead of when the state machine gets to it. The
+ * proximity loops of those rides run on the worker threads while the map stays untouched, the ratings are then
+ * calculated on this thread in ride order.
+ */
+static void ride_ratings_update_waiting_rides()
+{
+    std::vector<RideRatingUpdateState> states;
+    for (auto& ride : GetRideManager())
+    {
+        auto& batchState = _rideRatingsBatchStates[ride.id.ToUnderlying()];
+        if (ride.excitement != RIDE_RATING_UNDEFINED)
+        {
+            batchState = RideRatingsBatchState::None;
+            continue;
+        }
+        if (ride.status == RideStatus::Closed || (ride.lifecycle_flags & RIDE_LIFECYCLE_FIXED_RATINGS))
+            continue;
+
+        auto wantedState = (ride.lifecycle_flags & RIDE_LIFECYCLE_TESTED) ? RideRatingsBatchState::Tested
+                                                                          : RideRatingsBatchState::Untested;
+        if (batchState >= wantedState)
+            continue;
+
+        batchState = wantedState;
+        auto& state = states.emplace_back();
+        state.CurrentRide = ride.id;
+        state.State = RIDE_RATINGS_STATE_INITIALISE;
+    }
+
+    JobPool::ParallelFor(0, states.size(), 1, [&states](size_t index) {
+        auto& state = states[index];
+        for (uint32_t step = 0; step < RideRatingsMaxProximitySteps; step++)
+        {
+            if (state.State == RIDE_RATINGS_STATE_FIND_NEXT_RIDE || state.State == RIDE_RATINGS_STATE_CALCULATE)
+                break;
+            ride_ratings_update_state(state);
+        }
+    });
+
+    for (auto& state : states)
+    {
+        if (state.State == RIDE_RATINGS_STATE_CALCULATE)
+        {
+            ride_ratings_update_state(state);
+        }
+    }
+}
+
+RideRatingsProximityCacheStats ride_ratings_get_proximity_cache_stats()
+{
+    return { _proximityCacheHits.load(), _proximityCacheMisses.load() };
+}
+
+void ride_ratings_reset_proximity_cache_stats()
+{
+    _proximityCacheHits = 0;
+    _proximityCacheMisses = 0;
+}
+
 void ride_ratings_update_all()
 {
     PROFILED_FUNCTION();
@@ -124,6 +228,11 @@ void ride_ratings_update_all()
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
+    if (ride_ratings_batch_enabled())
+    {
+        ride_ratings_update_waiting_rides();
+    }
+
     // NOTE: Until the new save format only one ride can be updated at once.
     // The SV6 format can store only a single state.
     ride_ratings_update_state(gRideRatingUpdateState);
@@ -286,6 +395,13 @@ static void ride_ratings_update_state_3(RideRatingUpdateState& state)
     ride_ratings_calculate(state, ride);
     ride_ratings_calculate_value(ride);
 
+    // Drop the entries of track that has since been removed once they clearly outnumber the scored elements.
+    auto& proximityCache = _proximityCaches[state.CurrentRide.ToUnderlying()];
+    if (proximityCache.size() > state.ProximityTotal * 2u + 64)
+    {
+        proximityCache.clear();
+    }
+
     window_invalidate_by_number(WC_RIDE, state.CurrentRide.ToUnderlying());
     state.State = RIDE_RATINGS_STATE_FIND_NEXT_RIDE;
 }
@@ -534,21 +650,10 @@ static void ride_ratings_score_close_proximity_loops(RideRatingUpdateState& stat
     }
 }
 
-/**
- *
- *  rct2: 0x006B5F9D
- */
-static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, TileElement* inputTileElement)
+static void ride_ratings_score_close_proximity_tiles(
+    RideRatingUpdateState& state, TileElement* firstTileElement, TileElement* inputTileElement)
 {
-    if (state.StationFlags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
-    {
-        return;
-    }
-
-    state.ProximityTotal++;
-    TileElement* tileElement = map_get_first_element_at(state.Proximity);
-    if (tileElement == nullptr)
-        return;
+    TileElement* tileElement = firstTileElement;
     do
     {
         if (tileElement->IsGhost())
@@ -709,6 +814,106 @@ static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, Til
     ride_ratings_score_close_proximity_in_direction(state, inputTileElement, (direction + 1) & 3);
     ride_ratings_score_close_proximity_in_direction(state, inputTileElement, (direction - 1) & 3);
     ride_ratings_score_close_proximity_loops(state, inputTileElement);
+}
+
+static bool ride_ratings_proximity_cache_enabled()
+{
+    // The tile change stamps come from tile invalidation, which is not guaranteed to cover every change to the map.
+    return gConfigGeneral.ride_ratings_proximity_cache && network_get_mode() == NETWORK_MODE_NONE;
+}
+
+static std::array<uint64_t, 5> ride_ratings_get_proximity_tile_stamps(const CoordsXY& loc)
+{
+    std::array<uint64_t, 5> stamps;
+    stamps[0] = map_get_tile_change_stamp(loc);
+    for (Direction direction = 0; direction < NumOrthogonalDirections; direction++)
+    {
+        stamps[direction + 1] = map_get_tile_change_stamp(loc + CoordsDirectionDelta[direction]);
+    }
+    return stamps;
+}
+
+/**
+ * Scores the tiles around the track element, reusing what the last rating of the ride found if none of them have
+ * changed since.
+ */
+static void ride_ratings_score_close_proximity_cached(
+    RideRatingUpdateState& state, TileElement* firstTileElement, TileElement* inputTileElement)
+{
+    auto tilePos = TileCoordsXY{ state.Proximity };
+    auto elementIndex = static_cast<uint64_t>(inputTileElement - firstTileElement);
+    auto key = (static_cast<uint64_t>(tilePos.x) << 48) | (static_cast<uint64_t>(tilePos.y) << 32)
+        | (static_cast<uint64_t>(state.Proximity.z & 0xFFFF) << 16) | (elementIndex & 0xFFFF);
+    auto stamps = ride_ratings_get_proximity_tile_stamps(state.Proximity);
+
+    auto& cache = _proximityCaches[state.CurrentRide.ToUnderlying()];
+    auto it = cache.find(key);
+    if (it != cache.end() && it->second.TileStamps == stamps)
+    {
+        const auto& entry = it->second;
+        for (size_t i = 0; i < PROXIMITY_COUNT; i++)
+        {
+            state.ProximityScores[i] += entry.Scores[i];
+        }
+        if (entry.HasBaseHeight)
+        {
+            state.ProximityBaseHeight = entry.BaseHeight;
+        }
+        _proximityCacheHits.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    uint16_t scoresBefore[PROXIMITY_COUNT];
+    std::copy(std::begin(state.ProximityScores), std::end(state.ProximityScores), scoresBefore);
+    ride_ratings_score_close_proximity_tiles(state, firstTileElement, inputTileElement);
+
+    ProximityCacheEntry entry;
+    entry.TileStamps = stamps;
+    for (size_t i = 0; i < PROXIMITY_COUNT; i++)
+    {
+        entry.Scores[i] = static_cast<uint16_t>(state.ProximityScores[i] - scoresBefore[i]);
+    }
+    // The base height is only taken from the surface, without one the state keeps what it had.
+    entry.HasBaseHeight = false;
+    entry.BaseHeight = state.ProximityBaseHeight;
+    for (auto* tileElement = firstTileElement;; tileElement++)
+    {
+        if (!tileElement->IsGhost() && tileElement->GetType() == TileElementType::Surface)
+        {
+            entry.HasBaseHeight = true;
+            break;
+        }
+        if (tileElement->IsLastForTile())
+            break;
+    }
+    cache.insert_or_assign(key, entry);
+    _proximityCacheMisses.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ *
+ *  rct2: 0x006B5F9D
+ */
+static void ride_ratings_score_close_proximity(RideRatingUpdateState& state, TileElement* inputTileElement)
+{
+    if (state.StationFlags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
+    {
+        return;
+    }
+
+    state.ProximityTotal++;
+    TileElement* tileElement = map_get_first_element_at(state.Proximity);
+    if (tileElement == nullptr)
+        return;
+
+    if (ride_ratings_proximity_cache_enabled())
+    {
+        ride_ratings_score_close_proximity_cached(state, tileElement, inputTileElement);
+    }
+    else
+    {
+        ride_ratings_score_close_proximity_tiles(state, tileElement, inputTileElement);
+    }
 
     switch (state.ProximityTrackType)
     {
@@ -59,6 +59,14 @@ extern RideRatingUpdateState gRideRatingUpdateState;
 void ride_ratings_update_ride(const Ride& ride);
 void ride_ratings_update_all();
 
+struct RideRatingsProximityCacheStats
+{
+    uint64_t Hits;
+    uint64_t Misses;
+};
+RideRatingsProximityCacheStats ride_ratings_get_proximity_cache_stats();
+void ride_ratings_reset_proximity_cache_stats();
+
 using ride_ratings_calculation = void (*)(Ride* ride, RideRatingUpdateState& state);
 ride_ratings_calculation ride_ratings_get_calculate_func(uint8_t rideType);
 
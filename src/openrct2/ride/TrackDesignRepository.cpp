@@ -17,6 +17,7 @@
 #include "../core/File.h"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../localisation/LocalisationService.h"
@@ -117,6 +118,7 @@ private:
     std::shared_ptr<IPlatformEnvironment> const _env;
     TrackDesignFileIndex const _fileIndex;
     std::vector<TrackRepositoryItem> _items;
+    std::unique_ptr<FileChangeQueue> _userTrackChanges;
 
 public:
     explicit TrackDesignRepository(const std::shared_ptr<IPlatformEnvironment>& env)
@@ -213,6 +215,48 @@ public:
         }
 
         SortItems();
+        WatchUserTracks();
+    }
+
+    void CheckForChangedFiles() override
+    {
+        if (_userTrackChanges == nullptr)
+        {
+            return;
+        }
+
+        auto language = LocalisationService_GetCurrentLanguage();
+        bool changed = false;
+        for (const auto& path : _userTrackChanges->TakeChangedFiles())
+        {
+            auto extension = Path::GetExtension(path);
+            if (!String::Equals(extension, ".td4", true) && !String::Equals(extension, ".td6", true))
+            {
+                continue;
+            }
+
+            auto td = _fileIndex.Create(language, path);
+            if (!std::get<0>(td))
+            {
+                continue;
+            }
+
+            auto* item = GetTrackItem(path);
+            if (item != nullptr)
+            {
+                *item = std::move(std::get<1>(td));
+            }
+            else
+            {
+                _items.push_back(std::move(std::get<1>(td)));
+            }
+            changed = true;
+        }
+
+        if (changed)
+        {
+            SortItems();
+        }
     }
 
     bool Delete(const std::string& path) override
@@ -278,6 +322,27 @@ public:
     }
 
 private:
+    void WatchUserTracks()
+    {
+        if (_userTrackChanges != nullptr)
+        {
+            return;
+        }
+
+        try
+        {
+            auto path = _env->GetDirectoryPath(DIRBASE::USER, DIRID::TRACK);
+            if (Path::DirectoryExists(path))
+            {
+                _userTrackChanges = std::make_unique<FileChangeQueue>(path);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log_verbose("Unable to watch the user track directory: %s", e.what());
+        }
+    }
+
     void SortItems()
     {
         std::sort(_items.begin(), _items.end(), [](const TrackRepositoryItem& a, const TrackRepositoryItem& b) -> bool {
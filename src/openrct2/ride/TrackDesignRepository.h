@@ -38,6 +38,10 @@ struct ITrackDesignRepository
         uint8_t rideType, const std::string& entry) const abstract;
 
     virtual void Scan(int32_t language) abstract;
+    /**
+     * Adds or refreshes the track designs that have been written to the user track directory since the last call.
+     */
+    virtual void CheckForChangedFiles() abstract;
     virtual bool Delete(const std::string& path) abstract;
     virtual std::string Rename(const std::string& path, const std::string& newName) abstract;
     virtual std::string Install(const std::string& path, const std::string& name) abstract;
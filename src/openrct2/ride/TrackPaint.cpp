@@ -2273,3 +2273,34 @@ void PaintTrack(paint_session& session, Direction direction, int32_t height, con
         }
     }
 }
+
+void track_paint_util_paint_piece(paint_session& session, const TrackPaintPiece& piece, Direction direction, int32_t height)
+{
+    for (const auto& sprite : piece.Sprites[direction])
+    {
+        if (sprite.ImageIndex == 0)
+        {
+            continue;
+        }
+        PaintAddImageAsParentRotated(
+            session, direction, session.TrackColours[SCHEME_TRACK] | sprite.ImageIndex,
+            { sprite.Offset.x, sprite.Offset.y, height + sprite.Offset.z }, sprite.BoundBoxSize,
+            { sprite.BoundBoxOffset.x, sprite.BoundBoxOffset.y, height + sprite.BoundBoxOffset.z });
+    }
+
+    switch (piece.SupportKind)
+    {
+        case TrackPaintSupportKind::None:
+            break;
+        case TrackPaintSupportKind::WoodenA:
+            wooden_a_supports_paint_setup(
+                session, piece.SupportType[direction], piece.SupportSpecial[direction], height,
+                session.TrackColours[SCHEME_SUPPORTS]);
+            break;
+    }
+
+    const auto& tunnel = piece.Tunnels[direction];
+    paint_util_push_tunnel_rotated(session, direction, height + tunnel.HeightOffset, tunnel.Type);
+    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
+    paint_util_set_general_support_height(session, height + piece.GeneralSupportHeight, 0x20);
+}
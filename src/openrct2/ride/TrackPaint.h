@@ -396,6 +396,48 @@ void track_paint_util_right_vertical_loop_segments(paint_session& session, Direc
 
 void track_paint_util_left_corkscrew_up_supports(paint_session& session, Direction direction, uint16_t height);
 
+/**
+ * A sprite of a table driven track piece. The z of both offsets is relative to the track height.
+ */
+struct TrackPaintSprite
+{
+    uint32_t ImageIndex;
+    CoordsXYZ Offset;
+    CoordsXYZ BoundBoxSize;
+    CoordsXYZ BoundBoxOffset;
+};
+
+struct TrackPaintTunnel
+{
+    int8_t HeightOffset;
+    uint8_t Type;
+};
+
+enum class TrackPaintSupportKind : uint8_t
+{
+    None,
+    WoodenA,
+};
+
+/**
+ * Everything a single tile track piece paints in each direction, for pieces that only differ from each other by their
+ * constants. Painted by track_paint_util_paint_piece.
+ */
+struct TrackPaintPiece
+{
+    static constexpr size_t MaxSprites = 2;
+
+    // Unused sprites have an image index of 0.
+    TrackPaintSprite Sprites[NumOrthogonalDirections][MaxSprites];
+    TrackPaintSupportKind SupportKind;
+    uint8_t SupportType[NumOrthogonalDirections];
+    uint16_t SupportSpecial[NumOrthogonalDirections];
+    TrackPaintTunnel Tunnels[NumOrthogonalDirections];
+    uint16_t GeneralSupportHeight;
+};
+
+void track_paint_util_paint_piece(paint_session& session, const TrackPaintPiece& piece, Direction direction, int32_t height);
+
 using TRACK_PAINT_FUNCTION = void (*)(
     paint_session& session, const Ride& ride, uint8_t trackSequence, Direction direction, int32_t height,
     const TrackElement& trackElement);
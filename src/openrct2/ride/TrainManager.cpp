@@ -15,6 +15,32 @@
 
 namespace TrainManager
 {
+    // The vehicles that were train heads when the vehicle list last changed. A car only becomes a head when it is
+    // created, so the set stays valid until vehicles are added or removed.
+    static EntityIdSet _trainHeads;
+    static uint32_t _trainHeadsGeneration;
+    static bool _trainHeadsValid;
+
+    static void UpdateTrainHeads()
+    {
+        const auto generation = GetEntityListGeneration(EntityType::Vehicle);
+        if (_trainHeadsValid && _trainHeadsGeneration == generation)
+        {
+            return;
+        }
+
+        _trainHeads.clear();
+        for (auto* vehicle : EntityList<Vehicle>())
+        {
+            if (vehicle->IsHead())
+            {
+                _trainHeads.insert(vehicle->sprite_index);
+            }
+        }
+        _trainHeadsGeneration = generation;
+        _trainHeadsValid = true;
+    }
+
     View::Iterator& View::Iterator::operator++()
     {
         Entity = nullptr;
@@ -32,6 +58,7 @@ namespace TrainManager
 
     View::View()
     {
-        vec = &GetEntityList(EntityType::Vehicle);
+        UpdateTrainHeads();
+        vec = &_trainHeads;
     }
 } // namespace TrainManager
@@ -18,6 +18,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Memory.hpp"
+#include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/Particle.h"
 #include "../interface/Viewport.h"
@@ -643,20 +644,19 @@ static bool vehicle_move_info_valid(
     return true;
 }
 
-static const rct_vehicle_info* vehicle_get_move_info(
+static rct_vehicle_info vehicle_get_move_info(
     VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
 {
     uint16_t typeAndDirection = (type << 2) | (direction & 3);
 
     if (!vehicle_move_info_valid(trackSubposition, type, direction, offset))
     {
-        static constexpr const rct_vehicle_info zero = {};
-        return &zero;
+        return {};
     }
-    return &gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->info[offset];
+    return gTrackVehicleInfo[static_cast<uint8_t>(trackSubposition)][typeAndDirection]->info[offset].Unpack();
 }
 
-const rct_vehicle_info* Vehicle::GetMoveInfo() const
+rct_vehicle_info Vehicle::GetMoveInfo() const
 {
     return vehicle_get_move_info(TrackSubposition, GetTrackType(), GetTrackDirection(), track_progress);
 }
@@ -778,6 +778,30 @@ template<typename T> int32_t Train<T>::Mass()
     return totalMass;
 }
 
+/**
+ * Returns the area of the listening viewport in which train sounds can play. The main window also picks up the sounds
+ * of trains that are just out of view.
+ */
+static ScreenRect vehicle_sounds_get_listening_rect()
+{
+    const auto* viewport = g_music_tracking_viewport;
+    auto left = viewport->viewPos.x;
+    auto top = viewport->viewPos.y;
+    auto right = left + viewport->view_width;
+    auto bottom = top + viewport->view_height;
+
+    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
+    {
+        const auto quarter_w = viewport->view_width / 4;
+        const auto quarter_h = viewport->view_height / 4;
+        left -= quarter_w;
+        top -= quarter_h;
+        right += quarter_w;
+        bottom += quarter_h;
+    }
+    return { left, top, right, bottom };
+}
+
 bool Vehicle::SoundCanPlay() const
 {
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
@@ -795,31 +819,11 @@ bool Vehicle::SoundCanPlay() const
     if (g_music_tracking_viewport == nullptr)
         return false;
 
-    const auto quarter_w = g_music_tracking_viewport->view_width / 4;
-    const auto quarter_h = g_music_tracking_viewport->view_height / 4;
-
-    auto left = g_music_tracking_viewport->viewPos.x;
-    auto bottom = g_music_tracking_viewport->viewPos.y;
-
-    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
-    {
-        left -= quarter_w;
-        bottom -= quarter_h;
-    }
-
-    if (left >= SpriteRect.GetRight() || bottom >= SpriteRect.GetBottom())
+    const auto listeningRect = vehicle_sounds_get_listening_rect();
+    if (listeningRect.GetLeft() >= SpriteRect.GetRight() || listeningRect.GetTop() >= SpriteRect.GetBottom())
         return false;
 
-    auto right = g_music_tracking_viewport->view_width + left;
-    auto top = g_music_tracking_viewport->view_height + bottom;
-
-    if (window_get_classification(gWindowAudioExclusive) == WC_MAIN_WINDOW)
-    {
-        right += quarter_w + quarter_w;
-        top += quarter_h + quarter_h;
-    }
-
-    if (right < SpriteRect.GetRight() || top < SpriteRect.GetTop())
+    if (listeningRect.GetRight() < SpriteRect.GetRight() || listeningRect.GetBottom() < SpriteRect.GetTop())
         return false;
 
     return true;
@@ -942,6 +946,9 @@ void Vehicle::UpdateSoundParams(std::vector<OpenRCT2::Audio::VehicleSoundParams>
     }
 }
 
+// Kept between ticks so collecting the audible trains does not allocate.
+static std::vector<Vehicle*> _audibleTrainsBuffer;
+
 static void vehicle_sounds_update_window_setup()
 {
     g_music_tracking_viewport = nullptr;
@@ -1150,9 +1157,27 @@ void vehicle_sounds_update()
 
     vehicle_sounds_update_window_setup();
 
-    for (auto vehicle : TrainManager::View())
+    if (g_music_tracking_viewport != nullptr)
     {
-        vehicle->UpdateSoundParams(vehicleSoundParamsList);
+        // Only trains around the listening viewport can play, so do not visit all the others. They are ranked in id
+        // order like the train list, for equal priorities the lowest id wins.
+        auto& trains = _audibleTrainsBuffer;
+        trains.clear();
+        const auto range = viewport_rect_to_entity_map_range(vehicle_sounds_get_listening_rect());
+        for (auto* vehicle : EntityRangeQuery<Vehicle>(range))
+        {
+            if (vehicle->IsHead())
+            {
+                trains.push_back(vehicle);
+            }
+        }
+        std::sort(trains.begin(), trains.end(), [](const Vehicle* a, const Vehicle* b) {
+            return a->sprite_index < b->sprite_index;
+        });
+        for (auto* vehicle : trains)
+        {
+            vehicle->UpdateSoundParams(vehicleSoundParamsList);
+        }
     }
 
     // Stop all playing sounds that no longer have priority to play after vehicle_update_sound_params
@@ -7529,7 +7554,7 @@ void Vehicle::UpdateHandleWaterSplash() const
 void Vehicle::UpdateReverserCarBogies()
 {
     const auto moveInfo = GetMoveInfo();
-    MoveTo({ TrackLocation.x + moveInfo->x, TrackLocation.y + moveInfo->y, z });
+    MoveTo({ TrackLocation.x + moveInfo.x, TrackLocation.y + moveInfo.y, z });
 }
 
 /**
@@ -7610,13 +7635,8 @@ bool Vehicle::UpdateMotionCollisionDetection(const CoordsXYZ& loc, EntityId* oth
             if (vehicle2->ride_subtype == OBJECT_ENTRY_INDEX_NULL)
                 continue;
 
-            auto collideVehicleEntry = vehicle2->Entry();
-            if (collideVehicleEntry == nullptr)
-                continue;
-
-            if (!(collideVehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
-                continue;
-
+            // All of the position checks only read the candidate itself, do them before looking up its entry so only
+            // vehicles that are close enough to collide pay for the lookup.
             uint32_t x_diff = abs(vehicle2->x - loc.x);
             if (x_diff > 0x7FFF)
                 continue;
@@ -7639,6 +7659,13 @@ bool Vehicle::UpdateMotionCollisionDetection(const CoordsXYZ& loc, EntityId* oth
             if (x_diff + y_diff >= ecx)
                 continue;
 
+            auto collideVehicleEntry = vehicle2->Entry();
+            if (collideVehicleEntry == nullptr)
+                continue;
+
+            if (!(collideVehicleEntry->flags & VEHICLE_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
+                continue;
+
             if (!(collideVehicleEntry->flags & VEHICLE_ENTRY_FLAG_GO_KART))
             {
                 collideVehicle = vehicle2;
@@ -8154,7 +8181,7 @@ loc_6DAEB9:
     uint8_t moveInfovehicleSpriteType;
     {
         auto nextVehiclePosition = TrackLocation
-            + CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
+            + CoordsXYZ{ moveInfo.x, moveInfo.y, moveInfo.z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
 
         uint8_t remainingDistanceFlags = 0;
         if (nextVehiclePosition.x != _vehicleCurPosition.x)
@@ -8182,21 +8209,21 @@ loc_6DAEB9:
         {
             ReverseReverserCar();
 
-            const rct_vehicle_info* moveInfo2 = GetMoveInfo();
-            nextVehiclePosition.x = x + moveInfo2->x;
-            nextVehiclePosition.y = y + moveInfo2->y;
+            const auto moveInfo2 = GetMoveInfo();
+            nextVehiclePosition.x = x + moveInfo2.x;
+            nextVehiclePosition.y = y + moveInfo2.y;
         }
 
         // loc_6DB8A5
         remaining_distance -= SubpositionTranslationDistances[remainingDistanceFlags];
         _vehicleCurPosition = nextVehiclePosition;
-        sprite_direction = moveInfo->direction;
-        bank_rotation = moveInfo->bank_rotation;
-        Pitch = moveInfo->Pitch;
+        sprite_direction = moveInfo.direction;
+        bank_rotation = moveInfo.bank_rotation;
+        Pitch = moveInfo.Pitch;
 
-        moveInfovehicleSpriteType = moveInfo->Pitch;
+        moveInfovehicleSpriteType = moveInfo.Pitch;
 
-        if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_WOODEN_WILD_MOUSE_SWING) && moveInfo->Pitch != 0)
+        if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_WOODEN_WILD_MOUSE_SWING) && moveInfo.Pitch != 0)
         {
             SwingSprite = 0;
             SwingPosition = 0;
@@ -8482,10 +8509,10 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
         track_progress = newTrackProgress;
         uint8_t moveInfoVehicleSpriteType;
         {
-            const rct_vehicle_info* moveInfo = GetMoveInfo();
+            const auto moveInfo = GetMoveInfo();
             auto nextVehiclePosition = TrackLocation
-                + CoordsXYZ{ moveInfo->x, moveInfo->y,
-                             moveInfo->z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
+                + CoordsXYZ{ moveInfo.x, moveInfo.y,
+                             moveInfo.z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
 
             uint8_t remainingDistanceFlags = 0;
             if (nextVehiclePosition.x != _vehicleCurPosition.x)
@@ -8503,10 +8530,10 @@ bool Vehicle::UpdateTrackMotionBackwards(rct_ride_entry_vehicle* vehicleEntry, R
             remaining_distance += SubpositionTranslationDistances[remainingDistanceFlags];
 
             _vehicleCurPosition = nextVehiclePosition;
-            sprite_direction = moveInfo->direction;
-            bank_rotation = moveInfo->bank_rotation;
-            Pitch = moveInfo->Pitch;
-            moveInfoVehicleSpriteType = moveInfo->Pitch;
+            sprite_direction = moveInfo.direction;
+            bank_rotation = moveInfo.bank_rotation;
+            Pitch = moveInfo.Pitch;
+            moveInfoVehicleSpriteType = moveInfo.Pitch;
 
             if ((vehicleEntry->flags & VEHICLE_ENTRY_FLAG_WOODEN_WILD_MOUSE_SWING) && Pitch != 0)
             {
@@ -8759,15 +8786,15 @@ loc_6DC743:
             animation_frame = 0;
         }
     }
-    const rct_vehicle_info* moveInfo;
+    rct_vehicle_info moveInfo;
     for (;;)
     {
         moveInfo = GetMoveInfo();
-        if (moveInfo->x != LOCATION_NULL)
+        if (moveInfo.x != LOCATION_NULL)
         {
             break;
         }
-        switch (MiniGolfState(moveInfo->y))
+        switch (MiniGolfState(moveInfo.y))
         {
             case MiniGolfState::Unk0: // loc_6DC7B4
                 if (!IsHead())
@@ -8793,7 +8820,7 @@ loc_6DC743:
             case MiniGolfState::Unk1: // loc_6DC7ED
                 log_error("Unused move info...");
                 assert(false);
-                var_D3 = static_cast<uint8_t>(moveInfo->z);
+                var_D3 = static_cast<uint8_t>(moveInfo.z);
                 track_progress++;
                 break;
             case MiniGolfState::Unk2: // loc_6DC800
@@ -8806,7 +8833,7 @@ loc_6DC743:
                 break;
             case MiniGolfState::Unk4: // loc_6DC820
             {
-                auto animation = MiniGolfAnimation(moveInfo->z);
+                auto animation = MiniGolfAnimation(moveInfo.z);
                 // When the ride is closed occasionally the peep is removed
                 // but the vehicle is still on the track. This will prevent
                 // it from crashing in that situation.
@@ -8850,8 +8877,8 @@ loc_6DC743:
     }
 
     // loc_6DC8A1
-    trackPos = { TrackLocation.x + moveInfo->x, TrackLocation.y + moveInfo->y,
-                 TrackLocation.z + moveInfo->z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
+    trackPos = { TrackLocation.x + moveInfo.x, TrackLocation.y + moveInfo.y,
+                 TrackLocation.z + moveInfo.z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
 
     remaining_distance -= 0x368A;
     if (remaining_distance < 0)
@@ -8860,9 +8887,9 @@ loc_6DC743:
     }
 
     _vehicleCurPosition = trackPos;
-    sprite_direction = moveInfo->direction;
-    bank_rotation = moveInfo->bank_rotation;
-    Pitch = moveInfo->Pitch;
+    sprite_direction = moveInfo.direction;
+    bank_rotation = moveInfo.bank_rotation;
+    Pitch = moveInfo.Pitch;
 
     if (rideEntry->vehicles[0].flags & VEHICLE_ENTRY_FLAG_WOODEN_WILD_MOUSE_SWING)
     {
@@ -8966,8 +8993,8 @@ loc_6DCA9A:
 
 loc_6DCC2C:
     moveInfo = GetMoveInfo();
-    trackPos = { TrackLocation.x + moveInfo->x, TrackLocation.y + moveInfo->y,
-                 TrackLocation.z + moveInfo->z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
+    trackPos = { TrackLocation.x + moveInfo.x, TrackLocation.y + moveInfo.y,
+                 TrackLocation.z + moveInfo.z + GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset };
 
     remaining_distance -= 0x368A;
     if (remaining_distance < 0)
@@ -8976,9 +9003,9 @@ loc_6DCC2C:
     }
 
     _vehicleCurPosition = trackPos;
-    sprite_direction = moveInfo->direction;
-    bank_rotation = moveInfo->bank_rotation;
-    Pitch = moveInfo->Pitch;
+    sprite_direction = moveInfo.direction;
+    bank_rotation = moveInfo.bank_rotation;
+    Pitch = moveInfo.Pitch;
 
     if (rideEntry->vehicles[0].flags & VEHICLE_ENTRY_FLAG_WOODEN_WILD_MOUSE_SWING)
     {
@@ -49,6 +49,43 @@ struct rct_vehicle_info
     uint8_t bank_rotation; // 0x08
 };
 
+/**
+ * A rct_vehicle_info packed into six bytes, which is how the subposition tables store them. Positions are biased to
+ * fit their 9 and 10 bit fields, x may also be LOCATION_NULL as used by the mini golf animations.
+ */
+struct VehicleInfoPacked
+{
+private:
+    static constexpr int32_t XYBias = 160;
+    static constexpr int32_t ZBias = 248;
+    static constexpr uint16_t XNullFlag = 1 << 14;
+
+    uint16_t _xDirection;
+    uint16_t _yBank;
+    uint16_t _zPitch;
+
+public:
+    constexpr VehicleInfoPacked(int32_t x, int32_t y, int32_t z, uint8_t direction, uint8_t pitch, uint8_t bankRotation)
+        : _xDirection(static_cast<uint16_t>((x == LOCATION_NULL ? XNullFlag : x + XYBias) | (direction << 9)))
+        , _yBank(static_cast<uint16_t>((y + XYBias) | (bankRotation << 9)))
+        , _zPitch(static_cast<uint16_t>((z + ZBias) | (pitch << 10)))
+    {
+    }
+
+    constexpr rct_vehicle_info Unpack() const
+    {
+        rct_vehicle_info info{};
+        info.x = (_xDirection & XNullFlag) ? LOCATION_NULL : static_cast<int16_t>((_xDirection & 0x1FF) - XYBias);
+        info.y = static_cast<int16_t>((_yBank & 0x1FF) - XYBias);
+        info.z = static_cast<int16_t>((_zPitch & 0x3FF) - ZBias);
+        info.direction = (_xDirection >> 9) & 0x1F;
+        info.Pitch = static_cast<uint8_t>(_zPitch >> 10);
+        info.bank_rotation = static_cast<uint8_t>(_yBank >> 9);
+        return info;
+    }
+};
+static_assert(sizeof(VehicleInfoPacked) == 6);
+
 struct SoundIdVolume;
 
 constexpr const uint16_t VehicleTrackDirectionMask = 0b0000000000000011;
@@ -275,7 +312,7 @@ struct Vehicle : EntityBase
 private:
     bool SoundCanPlay() const;
     uint16_t GetSoundPriority() const;
-    const rct_vehicle_info* GetMoveInfo() const;
+    rct_vehicle_info GetMoveInfo() const;
     uint16_t GetTrackProgress() const;
     OpenRCT2::Audio::VehicleSoundParams CreateSoundParam(uint16_t priority) const;
     void CableLiftUpdate();
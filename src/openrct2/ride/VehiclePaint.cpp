@@ -19,7 +19,9 @@
 #include "../ride/Vehicle.h"
 #include "Track.h"
 
+#include <array>
 #include <iterator>
+#include <utility>
 
 // 0x0098E52C:
 const vehicle_boundbox VehicleBoundboxes[16][224] = {
@@ -1051,6 +1053,25 @@ static void vehicle_sprite_paint_6D51DE(
     vehicle_sprite_paint(session, vehicle, ebx, ecx, z, vehicleEntry);
 }
 
+using vehicle_sprite_func = void (*)(
+    paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
+    const rct_ride_entry_vehicle* vehicleEntry);
+
+// Number of bank rotations the banked pitches have sprite functions for.
+static constexpr uint8_t NumVehicleBankRotations = 20;
+
+template<size_t TNumBanks>
+static void VehiclePaintByBank(
+    const vehicle_sprite_func (&functions)[TNumBanks], paint_session& session, const Vehicle* vehicle, int32_t imageDirection,
+    int32_t z, const rct_ride_entry_vehicle* vehicleEntry)
+{
+    static_assert(TNumBanks == NumVehicleBankRotations);
+    if (vehicle->bank_rotation < TNumBanks)
+    {
+        functions[vehicle->bank_rotation](session, vehicle, imageDirection, z, vehicleEntry);
+    }
+}
+
 // 6D51DE
 static void vehicle_sprite_0_0(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
@@ -1409,75 +1430,36 @@ static void vehicle_sprite_0_19(
     }
 }
 
+static constexpr const vehicle_sprite_func PaintFunctionsFlatByBank[] = {
+    vehicle_sprite_0_0,
+    vehicle_sprite_0_1,
+    vehicle_sprite_0_2,
+    vehicle_sprite_0_3,
+    vehicle_sprite_0_4,
+    vehicle_sprite_0_5,
+    vehicle_sprite_0_6,
+    vehicle_sprite_0_7,
+    vehicle_sprite_0_8,
+    vehicle_sprite_0_9,
+    vehicle_sprite_0_10,
+    vehicle_sprite_0_11,
+    vehicle_sprite_0_12,
+    vehicle_sprite_0_13,
+    vehicle_sprite_0_14,
+    vehicle_sprite_0_0,
+    vehicle_sprite_0_16,
+    vehicle_sprite_0_17,
+    vehicle_sprite_0_18,
+    vehicle_sprite_0_19,
+};
+
 // 6D51D7
 static void VehiclePitchFlat(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3DE4:
-    switch (vehicle->bank_rotation)
-    {
-        case 0:
-            vehicle_sprite_0_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_0_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_0_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_0_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_0_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_0_5(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_0_6(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_0_7(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_0_8(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_0_9(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_0_10(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_0_11(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_0_12(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_0_13(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_0_14(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_0_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_0_16(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_0_17(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_0_18(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_0_19(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-    }
+    VehiclePaintByBank(PaintFunctionsFlatByBank, session, vehicle, imageDirection, z, vehicleEntry);
 }
 
 // 6D4614
@@ -1566,75 +1548,36 @@ static void vehicle_sprite_1_4(
     }
 }
 
+static constexpr const vehicle_sprite_func PaintFunctionsUp12ByBank[] = {
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_1,
+    vehicle_sprite_1_2,
+    vehicle_sprite_1_3,
+    vehicle_sprite_1_4,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_0,
+    vehicle_sprite_1_1,
+    vehicle_sprite_1_2,
+    vehicle_sprite_1_3,
+    vehicle_sprite_1_4,
+};
+
 // 6D460D
 static void VehiclePitchUp12(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3C04:
-    switch (vehicle->bank_rotation)
-    {
-        case 0:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_1_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_1_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_1_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_1_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_1_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_1_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_1_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_1_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_1_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-    }
+    VehiclePaintByBank(PaintFunctionsUp12ByBank, session, vehicle, imageDirection, z, vehicleEntry);
 }
 
 // 6D4791
@@ -1754,75 +1697,36 @@ static void vehicle_sprite_2_4(
     }
 }
 
+static constexpr const vehicle_sprite_func PaintFunctionsUp25ByBank[] = {
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_1,
+    vehicle_sprite_2_2,
+    vehicle_sprite_2_3,
+    vehicle_sprite_2_4,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_0,
+    vehicle_sprite_2_1,
+    vehicle_sprite_2_2,
+    vehicle_sprite_2_3,
+    vehicle_sprite_2_4,
+};
+
 // 6D476C
 static void VehiclePitchUp25(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3CA4:
-    switch (vehicle->bank_rotation)
-    {
-        case 0:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_2_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_2_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_2_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_2_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_2_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_2_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_2_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_2_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_2_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-    }
+    VehiclePaintByBank(PaintFunctionsUp25ByBank, session, vehicle, imageDirection, z, vehicleEntry);
 }
 
 // 6D49DC
@@ -1946,75 +1850,36 @@ static void vehicle_sprite_5_4(
     }
 }
 
+static constexpr const vehicle_sprite_func PaintFunctionsDown12ByBank[] = {
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_1,
+    vehicle_sprite_5_2,
+    vehicle_sprite_5_3,
+    vehicle_sprite_5_4,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_0,
+    vehicle_sprite_5_1,
+    vehicle_sprite_5_2,
+    vehicle_sprite_5_3,
+    vehicle_sprite_5_4,
+};
+
 // 6D4636
 static void VehiclePitchDown12(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3C54:
-    switch (vehicle->bank_rotation)
-    {
-        case 0:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_5_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_5_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_5_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_5_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_5_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_5_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_5_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_5_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_5_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-    }
+    VehiclePaintByBank(PaintFunctionsDown12ByBank, session, vehicle, imageDirection, z, vehicleEntry);
 }
 
 // 6D47E4
@@ -2137,75 +2002,36 @@ static void vehicle_sprite_6_4(
     }
 }
 
+static constexpr const vehicle_sprite_func PaintFunctionsDown25ByBank[] = {
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_1,
+    vehicle_sprite_6_2,
+    vehicle_sprite_6_3,
+    vehicle_sprite_6_4,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_0,
+    vehicle_sprite_6_1,
+    vehicle_sprite_6_2,
+    vehicle_sprite_6_3,
+    vehicle_sprite_6_4,
+};
+
 // 6D47DD
 static void VehiclePitchDown25(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3CF4:
-    switch (vehicle->bank_rotation)
-    {
-        case 0:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_6_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_6_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_6_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_6_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_6_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_6_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_6_2(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_6_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_6_4(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-    }
+    VehiclePaintByBank(PaintFunctionsDown25ByBank, session, vehicle, imageDirection, z, vehicleEntry);
 }
 
 // 6D4A05
@@ -2608,75 +2434,36 @@ static void vehicle_sprite_50_3(
     }
 }
 
+static constexpr const vehicle_sprite_func PaintFunctionsDiagUp12ByBank[] = {
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_1,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_3,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_1,
+    vehicle_sprite_50_0,
+    vehicle_sprite_50_3,
+    vehicle_sprite_50_0,
+};
+
 // 6D4D60
 static void VehiclePitchDiagUp12(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3D44:
-    switch (vehicle->bank_rotation)
-    {
-        case 0:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_50_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_50_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_50_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_50_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_50_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-    }
+    VehiclePaintByBank(PaintFunctionsDiagUp12ByBank, session, vehicle, imageDirection, z, vehicleEntry);
 }
 
 // 6D4E3A
@@ -2766,75 +2553,36 @@ static void vehicle_sprite_53_3(
     }
 }
 
+static constexpr const vehicle_sprite_func PaintFunctionsDiagDown12ByBank[] = {
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_1,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_3,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_1,
+    vehicle_sprite_53_0,
+    vehicle_sprite_53_3,
+    vehicle_sprite_53_0,
+};
+
 // 6D4D89
 static void VehiclePitchDiagDown12(
     paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
     // 0x009A3D94:
-    switch (vehicle->bank_rotation)
-    {
-        case 0:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 1:
-            vehicle_sprite_53_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 2:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 3:
-            vehicle_sprite_53_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 4:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 5:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 6:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 7:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 8:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 9:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 10:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 11:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 12:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 13:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 14:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 15:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 16:
-            vehicle_sprite_53_1(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 17:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 18:
-            vehicle_sprite_53_3(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-        case 19:
-            vehicle_sprite_53_0(session, vehicle, imageDirection, z, vehicleEntry);
-            break;
-    }
+    VehiclePaintByBank(PaintFunctionsDiagDown12ByBank, session, vehicle, imageDirection, z, vehicleEntry);
 }
 
 // 6D4E63
@@ -2934,10 +2682,6 @@ static void VehiclePitchSpiralLift(
 }
 
 // 0x009A3B14:
-using vehicle_sprite_func = void (*)(
-    paint_session& session, const Vehicle* vehicle, int32_t imageDirection, int32_t z,
-    const rct_ride_entry_vehicle* vehicleEntry);
-
 // clang-format off
 static constexpr const vehicle_sprite_func PaintFunctionsByPitch[] = {
     VehiclePitchFlat,
@@ -3003,6 +2747,40 @@ static constexpr const vehicle_sprite_func PaintFunctionsByPitch[] = {
 };
 // clang-format on
 
+/**
+ * PaintFunctionsByPitch with the bank rotation switch of the banked pitches resolved, so that picking the sprite function
+ * of a car is a single lookup.
+ */
+static constexpr auto PaintFunctionsByPitchAndBank = []() {
+    constexpr std::pair<vehicle_sprite_func, const vehicle_sprite_func*> bankedPitches[] = {
+        { VehiclePitchFlat, PaintFunctionsFlatByBank },
+        { VehiclePitchUp12, PaintFunctionsUp12ByBank },
+        { VehiclePitchUp25, PaintFunctionsUp25ByBank },
+        { VehiclePitchDown12, PaintFunctionsDown12ByBank },
+        { VehiclePitchDown25, PaintFunctionsDown25ByBank },
+        { VehiclePitchDiagUp12, PaintFunctionsDiagUp12ByBank },
+        { VehiclePitchDiagDown12, PaintFunctionsDiagDown12ByBank },
+    };
+
+    std::array<std::array<vehicle_sprite_func, NumVehicleBankRotations>, std::size(PaintFunctionsByPitch)> table{};
+    for (size_t pitch = 0; pitch < table.size(); pitch++)
+    {
+        const vehicle_sprite_func* byBank = nullptr;
+        for (const auto& banked : bankedPitches)
+        {
+            if (banked.first == PaintFunctionsByPitch[pitch])
+            {
+                byBank = banked.second;
+            }
+        }
+        for (size_t bank = 0; bank < NumVehicleBankRotations; bank++)
+        {
+            table[pitch][bank] = byBank != nullptr ? byBank[bank] : PaintFunctionsByPitch[pitch];
+        }
+    }
+    return table;
+}();
+
 /**
  *
  *  rct2: 0x006D5600
@@ -3167,7 +2945,16 @@ void vehicle_visual_default(
     paint_session& session, int32_t imageDirection, int32_t z, const Vehicle* vehicle,
     const rct_ride_entry_vehicle* vehicleEntry)
 {
-    if (vehicle->Pitch < std::size(PaintFunctionsByPitch))
+    if (vehicle->Pitch >= std::size(PaintFunctionsByPitch))
+    {
+        return;
+    }
+    if (vehicle->bank_rotation < NumVehicleBankRotations)
+    {
+        PaintFunctionsByPitchAndBank[vehicle->Pitch][vehicle->bank_rotation](
+            session, vehicle, imageDirection, z, vehicleEntry);
+    }
+    else
     {
         PaintFunctionsByPitch[vehicle->Pitch](session, vehicle, imageDirection, z, vehicleEntry);
     }
@@ -15,7 +15,7 @@
 
 constexpr const size_t VehicleTrackSubpositionSizeDefault = TrackElemType::Count * NumOrthogonalDirections;
 
-struct rct_vehicle_info;
+struct VehicleInfoPacked;
 
 enum class VehicleTrackSubposition : uint8_t
 {
@@ -46,7 +46,7 @@ enum class VehicleTrackSubposition : uint8_t
 struct rct_vehicle_info_list
 {
     uint16_t size;
-    const rct_vehicle_info* info;
+    const VehicleInfoPacked* info;
 };
 
 extern const rct_vehicle_info_list* const* const gTrackVehicleInfo[EnumValue(VehicleTrackSubposition::Count)];
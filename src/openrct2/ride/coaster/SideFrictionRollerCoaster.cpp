@@ -65,82 +65,65 @@ constexpr int32_t SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_2_A = 21878;
 constexpr int32_t SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_2_B = 21881;
 constexpr int32_t SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_3_A = 21879; // Needs no B piece
 
+static constexpr TrackPaintPiece SideFrictionFlatChain = {
+    {
+        {
+            { 21662, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21664, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+        {
+            { 21663, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21665, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+        {
+            { 21666, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21668, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+        {
+            { 21667, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21669, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 0, 0, 0, 0 },
+    { { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_FLAT } },
+    32,
+};
+
+static constexpr TrackPaintPiece SideFrictionFlat = {
+    {
+        {
+            { 21606, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21608, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+        {
+            { 21607, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21609, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+        {
+            { 21606, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21608, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+        {
+            { 21607, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21609, { 0, 0, 0 }, { 32, 27, 0 }, { 0, 2, 27 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 0, 0, 0, 0 },
+    { { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_FLAT } },
+    32,
+};
+
 /** rct2: 0x0077839C */
 static void side_friction_rc_track_flat(
     paint_session& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    if (trackElement.HasChain())
-    {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21662, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21664, { 0, 0, height }, { 32, 27, 0 },
-                    { 0, 2, height + 27 });
-                wooden_a_supports_paint_setup(session, 0, 0, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21663, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21665, { 0, 0, height }, { 32, 27, 0 },
-                    { 0, 2, height + 27 });
-                wooden_a_supports_paint_setup(session, 1, 0, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21666, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21668, { 0, 0, height }, { 32, 27, 0 },
-                    { 0, 2, height + 27 });
-                wooden_a_supports_paint_setup(session, 0, 0, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21667, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21669, { 0, 0, height }, { 32, 27, 0 },
-                    { 0, 2, height + 27 });
-                wooden_a_supports_paint_setup(session, 1, 0, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    else
-    {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21606, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21608, { 0, 0, height }, { 32, 27, 0 },
-                    { 0, 2, height + 27 });
-                wooden_a_supports_paint_setup(session, 0, 0, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21607, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21609, { 0, 0, height }, { 32, 27, 0 },
-                    { 0, 2, height + 27 });
-                wooden_a_supports_paint_setup(session, 1, 0, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_SQUARE_FLAT);
-    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 32, 0x20);
+    track_paint_util_paint_piece(
+        session, trackElement.HasChain() ? SideFrictionFlatChain : SideFrictionFlat, direction, height);
 }
 
 /** rct2: 0x007784AC, 0x007784BC, 0x007784CC */
@@ -165,307 +148,187 @@ static void side_friction_rc_track_station(
     paint_util_set_general_support_height(session, height + 32, 0x20);
 }
 
+static constexpr TrackPaintPiece SideFrictionUp25Chain = {
+    {
+        {
+            { 21678, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21690, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21679, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21691, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21680, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21692, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21681, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21693, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 9, 10, 11, 12 },
+    { { -8, TUNNEL_SQUARE_7 }, { 8, TUNNEL_SQUARE_8 }, { 8, TUNNEL_SQUARE_8 }, { -8, TUNNEL_SQUARE_7 } },
+    56,
+};
+
+static constexpr TrackPaintPiece SideFrictionUp25 = {
+    {
+        {
+            { 21622, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21634, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21623, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21635, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21624, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21636, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21625, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21637, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 9, 10, 11, 12 },
+    { { -8, TUNNEL_SQUARE_7 }, { 8, TUNNEL_SQUARE_8 }, { 8, TUNNEL_SQUARE_8 }, { -8, TUNNEL_SQUARE_7 } },
+    56,
+};
+
 /** rct2: 0x007783AC */
 static void side_friction_rc_track_25_deg_up(
     paint_session& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    if (trackElement.HasChain())
+    track_paint_util_paint_piece(
+        session, trackElement.HasChain() ? SideFrictionUp25Chain : SideFrictionUp25, direction, height);
+}
+
+static constexpr TrackPaintPiece SideFrictionFlatToUp25Chain = {
     {
-        switch (direction)
         {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21678, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21690, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 9, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21679, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21691, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 10, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21680, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21692, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 11, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21681, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21693, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 12, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    else
-    {
-        switch (direction)
+            { 21670, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21682, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
         {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21622, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21634, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 9, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21623, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21635, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 10, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21624, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21636, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 11, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21625, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21637, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 12, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height - 8, TUNNEL_SQUARE_7);
-    }
-    else
+            { 21671, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21683, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21672, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21684, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21673, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21685, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 1, 2, 3, 4 },
+    { { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_8 }, { 0, TUNNEL_SQUARE_8 }, { 0, TUNNEL_SQUARE_FLAT } },
+    48,
+};
+
+static constexpr TrackPaintPiece SideFrictionFlatToUp25 = {
     {
-        paint_util_push_tunnel_rotated(session, direction, height + 8, TUNNEL_SQUARE_8);
-    }
-    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 56, 0x20);
-}
+        {
+            { 21614, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21626, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21615, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21627, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21616, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21628, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21617, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21629, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 1, 2, 3, 4 },
+    { { 0, TUNNEL_SQUARE_FLAT }, { 0, TUNNEL_SQUARE_8 }, { 0, TUNNEL_SQUARE_8 }, { 0, TUNNEL_SQUARE_FLAT } },
+    48,
+};
 
 /** rct2: 0x007783CC */
 static void side_friction_rc_track_flat_to_25_deg_up(
     paint_session& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    if (trackElement.HasChain())
+    track_paint_util_paint_piece(
+        session, trackElement.HasChain() ? SideFrictionFlatToUp25Chain : SideFrictionFlatToUp25, direction, height);
+}
+
+static constexpr TrackPaintPiece SideFrictionUp25ToFlatChain = {
     {
-        switch (direction)
         {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21670, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21682, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 1, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21671, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21683, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 2, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21672, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21684, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 3, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21673, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21685, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 4, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    else
-    {
-        switch (direction)
+            { 21674, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21686, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
         {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21614, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21626, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 1, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21615, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21627, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 2, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21616, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21628, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 3, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21617, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21629, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 4, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_SQUARE_FLAT);
-    }
-    else
+            { 21675, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21687, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21676, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21688, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21677, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21689, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 5, 6, 7, 8 },
+    { { -8, TUNNEL_SQUARE_FLAT }, { 8, TUNNEL_14 }, { 8, TUNNEL_14 }, { -8, TUNNEL_SQUARE_FLAT } },
+    40,
+};
+
+static constexpr TrackPaintPiece SideFrictionUp25ToFlat = {
     {
-        paint_util_push_tunnel_rotated(session, direction, height, TUNNEL_SQUARE_8);
-    }
-    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 48, 0x20);
-}
+        {
+            { 21618, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21630, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21619, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21631, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21620, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21632, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { 21621, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { 21633, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 5, 6, 7, 8 },
+    { { -8, TUNNEL_SQUARE_FLAT }, { 8, TUNNEL_14 }, { 8, TUNNEL_14 }, { -8, TUNNEL_SQUARE_FLAT } },
+    40,
+};
 
 /** rct2: 0x007783FC */
 static void side_friction_rc_track_25_deg_up_to_flat(
     paint_session& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    if (trackElement.HasChain())
-    {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21674, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21686, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 5, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21675, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21687, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 6, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21676, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21688, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 7, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21677, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21689, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 8, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    else
-    {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21618, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21630, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 5, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21619, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21631, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 6, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21620, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21632, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 0, 7, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21621, { 0, 0, height }, { 32, 27, 2 },
-                    { 0, 2, height });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours[SCHEME_TRACK] | 21633, { 0, 0, height }, { 32, 1, 9 },
-                    { 0, 26, height + 5 });
-                wooden_a_supports_paint_setup(session, 1, 8, height, session.TrackColours[SCHEME_SUPPORTS]);
-                break;
-        }
-    }
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height - 8, TUNNEL_SQUARE_FLAT);
-    }
-    else
-    {
-        paint_util_push_tunnel_rotated(session, direction, height + 8, TUNNEL_14);
-    }
-    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 40, 0x20);
+    track_paint_util_paint_piece(
+        session, trackElement.HasChain() ? SideFrictionUp25ToFlatChain : SideFrictionUp25ToFlat, direction, height);
 }
 
 /** rct2: 0x0077840C */
@@ -2919,63 +2782,37 @@ static void side_friction_rc_track_diag_25_deg_down_to_flat(
     }
 }
 
+static constexpr TrackPaintPiece SideFrictionUp60 = {
+    {
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_0_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_0_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_1_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_1_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_2_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_2_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_3_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_DIR_3_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 21, 22, 23, 24 },
+    { { -8, TUNNEL_SQUARE_7 }, { 8, TUNNEL_SQUARE_8 }, { 8, TUNNEL_SQUARE_8 }, { -8, TUNNEL_SQUARE_7 } },
+    104,
+};
+
 static void side_friction_rc_track_60_deg_up(
     paint_session& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_0_A, { 0, 0, height },
-                { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_0_B, { 0, 0, height },
-                { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 0, 21, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_1_A, { 0, 0, height },
-                { 32, 27, 2 }, { 0, 2, height });
-
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_1_B, { 0, 0, height },
-                { 32, 1, 9 }, { 0, 26, height + 5 });
-
-            wooden_a_supports_paint_setup(session, 1, 22, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_2_A, { 0, 0, height },
-                { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_2_B, { 0, 0, height },
-                { 32, 1, 9 }, { 0, 26, height + 5 });
-
-            wooden_a_supports_paint_setup(session, 0, 23, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_3_A, { 0, 0, height },
-                { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_DIR_3_B, { 0, 0, height },
-                { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 1, 24, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height - 8, TUNNEL_SQUARE_7);
-    }
-    else
-    {
-        paint_util_push_tunnel_rotated(session, direction, height + 8, TUNNEL_SQUARE_8);
-    }
-    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 104, 0x20);
+    track_paint_util_paint_piece(session, SideFrictionUp60, direction, height);
 }
 
 static void side_friction_rc_track_60_deg_down(
@@ -2985,60 +2822,37 @@ static void side_friction_rc_track_60_deg_down(
     side_friction_rc_track_60_deg_up(session, ride, trackSequence, (direction + 2) % 4, height, trackElement);
 }
 
+static constexpr TrackPaintPiece SideFrictionUp25ToUp60 = {
+    {
+        {
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_0_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_0_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_1_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_1_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_2_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_2_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_3_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_3_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 13, 14, 15, 16 },
+    { { -8, TUNNEL_SQUARE_7 }, { 8, TUNNEL_SQUARE_8 }, { 8, TUNNEL_SQUARE_8 }, { -8, TUNNEL_SQUARE_7 } },
+    32,
+};
+
 static void side_friction_rc_track_25_deg_up_to_60_deg_up(
     paint_session& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_0_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_0_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 0, 13, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_1_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_1_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 1, 14, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_2_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_2_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 0, 15, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_3_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_25_DEG_UP_TO_60_DEG_UP_DIR_3_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 1, 16, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height - 8, TUNNEL_SQUARE_7);
-    }
-    else
-    {
-        paint_util_push_tunnel_rotated(session, direction, height + 8, TUNNEL_SQUARE_8);
-    }
-    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 32, 0x20);
+    track_paint_util_paint_piece(session, SideFrictionUp25ToUp60, direction, height);
 }
 
 static void side_friction_rc_track_60_deg_down_to_25_deg_down(
@@ -3048,60 +2862,37 @@ static void side_friction_rc_track_60_deg_down_to_25_deg_down(
     side_friction_rc_track_25_deg_up_to_60_deg_up(session, ride, trackSequence, (direction + 2) % 4, height, trackElement);
 }
 
+static constexpr TrackPaintPiece SideFrictionUp60ToUp25 = {
+    {
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_0_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_0_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_1_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_1_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_2_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_2_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+        {
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_3_A, { 0, 0, 0 }, { 32, 27, 2 }, { 0, 2, 0 } },
+            { SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_3_B, { 0, 0, 0 }, { 32, 1, 9 }, { 0, 26, 5 } },
+        },
+    },
+    TrackPaintSupportKind::WoodenA,
+    { 0, 1, 0, 1 },
+    { 17, 18, 19, 20 },
+    { { -8, TUNNEL_SQUARE_7 }, { 8, TUNNEL_SQUARE_8 }, { 8, TUNNEL_SQUARE_8 }, { -8, TUNNEL_SQUARE_7 } },
+    32,
+};
+
 static void side_friction_rc_track_60_deg_up_to_25_deg_up(
     paint_session& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_0_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_0_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 0, 17, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_1_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_1_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 1, 18, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_2_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_2_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 0, 19, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_3_A,
-                { 0, 0, height }, { 32, 27, 2 }, { 0, 2, height });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours[SCHEME_TRACK] | SPR_SIDE_FRICTION_60_DEG_UP_TO_25_DEG_UP_DIR_3_B,
-                { 0, 0, height }, { 32, 1, 9 }, { 0, 26, height + 5 });
-            wooden_a_supports_paint_setup(session, 1, 20, height, session.TrackColours[SCHEME_SUPPORTS]);
-            break;
-    }
-
-    if (direction == 0 || direction == 3)
-    {
-        paint_util_push_tunnel_rotated(session, direction, height - 8, TUNNEL_SQUARE_7);
-    }
-    else
-    {
-        paint_util_push_tunnel_rotated(session, direction, height + 8, TUNNEL_SQUARE_8);
-    }
-    paint_util_set_segment_support_height(session, SEGMENTS_ALL, 0xFFFF, 0);
-    paint_util_set_general_support_height(session, height + 32, 0x20);
+    track_paint_util_paint_piece(session, SideFrictionUp60ToUp25, direction, height);
 }
 
 static void side_friction_rc_track_25_deg_down_to_60_deg_down(
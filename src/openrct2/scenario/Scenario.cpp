@@ -52,6 +52,7 @@
 #include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
+#include "../world/TileElementsView.h"
 #include "../world/Water.h"
 #include "ScenarioRepository.h"
 #include "ScenarioSources.h"
@@ -74,6 +75,7 @@ uint16_t gSavedAge;
 uint32_t gLastAutoSaveUpdate = 0;
 
 random_engine_t gScenarioRand;
+random_engine_t::state_type gScenarioRandStreamSeed;
 
 Objective gScenarioObjective;
 
@@ -85,6 +87,7 @@ money64 gScenarioCompanyValueRecord;
 std::string gScenarioFileName;
 
 static void scenario_objective_check();
+static void scenario_rand_stream_seed_from_rand();
 
 using namespace OpenRCT2;
 
@@ -95,6 +98,7 @@ void scenario_begin()
     // Set the scenario pseudo-random seeds
     Random::Rct2::Seed s{ 0x1234567F ^ Platform::GetTicks(), 0x789FABCD ^ Platform::GetTicks() };
     gScenarioRand.seed(s);
+    scenario_rand_stream_seed_from_rand();
 
     gParkFlags &= ~PARK_FLAGS_NO_MONEY;
     if (gParkFlags & PARK_FLAGS_NO_MONEY_SCENARIO)
@@ -501,6 +505,7 @@ void scenario_rand_seed(random_engine_t::result_type s0, random_engine_t::result
 {
     Random::Rct2::Seed s{ s0, s1 };
     gScenarioRand.seed(s);
+    scenario_rand_stream_seed_from_rand();
 }
 
 /**
@@ -528,6 +533,41 @@ uint32_t scenario_rand_max(uint32_t max)
     return rand % max;
 }
 
+/**
+ * Returns an engine for the given stream and key, such as an entity or ride index. Its sequence only depends on the
+ * stream seed, the current tick and the key, so each key can draw from its own engine in any order or in parallel and
+ * the results stay reproducible.
+ */
+random_engine_t scenario_rand_stream(RandomStream stream, uint32_t key)
+{
+    auto h0 = Random::HashCombine(gScenarioRandStreamSeed.s0, static_cast<uint32_t>(stream));
+    h0 = Random::HashCombine(h0, gCurrentTicks);
+    h0 = Random::HashCombine(h0, key);
+    auto h1 = Random::HashCombine(gScenarioRandStreamSeed.s1, static_cast<uint32_t>(stream));
+    h1 = Random::HashCombine(h1, gCurrentTicks);
+    h1 = Random::HashCombine(h1, key);
+
+    Random::Rct2::Seed s{ Random::HashFinalise(h0), Random::HashFinalise(h1) };
+    return random_engine_t(s);
+}
+
+void scenario_rand_stream_seed(random_engine_t::result_type s0, random_engine_t::result_type s1)
+{
+    gScenarioRandStreamSeed.s0 = s0;
+    gScenarioRandStreamSeed.s1 = s1;
+}
+
+/**
+ * Derives the stream seed from the main engine without advancing it, for new games and saves that do not store one.
+ */
+static void scenario_rand_stream_seed_from_rand()
+{
+    const auto& state = gScenarioRand.state();
+    scenario_rand_stream_seed(
+        Random::HashFinalise(Random::HashCombine(state.s0, 0x5354524D)),
+        Random::HashFinalise(Random::HashCombine(state.s1, 0x5354524D)));
+}
+
 /**
  * Prepare rides, for the finish five rollercoasters objective.
  *  rct2: 0x006788F7
@@ -561,29 +601,22 @@ static bool scenario_prepare_rides_for_save()
         return false;
     }
 
-    bool markTrackAsIndestructible;
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() == TileElementType::Track)
+    ForEachMapElement<TrackElement>([isFiveCoasterObjective](const TileCoordsXY&, TrackElement& trackElement) {
+        bool markTrackAsIndestructible = false;
+
+        if (isFiveCoasterObjective)
         {
-            markTrackAsIndestructible = false;
+            auto ride = get_ride(trackElement.GetRideIndex());
 
-            if (isFiveCoasterObjective)
+            // In the previous step, this flag was set on the first five roller coasters.
+            if (ride != nullptr && ride->lifecycle_flags & RIDE_LIFECYCLE_INDESTRUCTIBLE_TRACK)
             {
-                auto ride = get_ride(it.element->AsTrack()->GetRideIndex());
-
-                // In the previous step, this flag was set on the first five roller coasters.
-                if (ride != nullptr && ride->lifecycle_flags & RIDE_LIFECYCLE_INDESTRUCTIBLE_TRACK)
-                {
-                    markTrackAsIndestructible = true;
-                }
+                markTrackAsIndestructible = true;
             }
-
-            it.element->AsTrack()->SetIsIndestructible(markTrackAsIndestructible);
         }
-    } while (tile_element_iterator_next(&it));
+
+        trackElement.SetIsIndestructible(markTrackAsIndestructible);
+    });
 
     return true;
 }
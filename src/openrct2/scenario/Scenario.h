@@ -149,6 +149,7 @@ static constexpr money64 COMPANY_VALUE_ON_FAILED_OBJECTIVE = 0x8000000000000001;
 extern const rct_string_id ScenarioCategoryStringIds[SCENARIO_CATEGORY_COUNT];
 
 extern random_engine_t gScenarioRand;
+extern random_engine_t::state_type gScenarioRandStreamSeed;
 
 extern Objective gScenarioObjective;
 extern bool gAllowEarlyCompletionInNetworkPlay;
@@ -178,8 +179,30 @@ void scenario_rand_seed(random_engine_t::result_type s0, random_engine_t::result
 random_engine_t::result_type scenario_rand();
 uint32_t scenario_rand_max(uint32_t max);
 
+/**
+ * Independent random streams that do not advance gScenarioRand, so that work drawing from them does not depend on the
+ * order other code draws random numbers in.
+ */
+enum class RandomStream : uint8_t
+{
+    Guests,
+    Staff,
+    Vehicles,
+    Rides,
+    RideRatings,
+};
+
+random_engine_t scenario_rand_stream(RandomStream stream, uint32_t key);
+void scenario_rand_stream_seed(random_engine_t::result_type s0, random_engine_t::result_type s1);
+
 bool scenario_prepare_for_save();
 int32_t scenario_save(u8string_view path, int32_t flags);
+/**
+ * Captures the park on the calling thread and compresses and writes it on a background thread. Returns false if the
+ * park could not be captured or a previous background save is still being written.
+ */
+bool scenario_save_in_background(u8string_view path, int32_t flags);
+bool scenario_is_saving_in_background();
 void scenario_failure();
 void scenario_success();
 void scenario_success_submit_name(const char* name);
@@ -11,9 +11,12 @@
 
 #    include "HookEngine.h"
 
+#    include "../config/Config.h"
 #    include "../core/EnumMap.hpp"
 #    include "ScriptEngine.h"
 
+#    include <algorithm>
+#    include <chrono>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -34,6 +37,8 @@ static const EnumMap<HOOK_TYPE> HooksLookupTable({
     { "map.change", HOOK_TYPE::MAP_CHANGE },
     { "map.changed", HOOK_TYPE::MAP_CHANGED },
     { "map.save", HOOK_TYPE::MAP_SAVE },
+    { "action.query.batch", HOOK_TYPE::ACTION_QUERY_BATCH },
+    { "action.execute.batch", HOOK_TYPE::ACTION_EXECUTE_BATCH },
 });
 
 HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
@@ -42,6 +47,12 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    auto result = HooksLookupTable.find(type);
+    return (result != HooksLookupTable.end()) ? result->first : std::string_view();
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -113,7 +124,7 @@ void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        CallHook(type, hook, {}, isGameStateMutable);
     }
 }
 
@@ -122,7 +133,7 @@ void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutab
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        CallHook(type, hook, { arg }, isGameStateMutable);
     }
 }
 
@@ -157,7 +168,40 @@ void HookEngine::Call(
 
         std::vector<DukValue> dukArgs;
         dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        CallHook(type, hook, dukArgs, isGameStateMutable);
+    }
+}
+
+void HookEngine::CallHook(HOOK_TYPE type, const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    // Hold on to the owner, the hook may unsubscribe itself while it runs.
+    auto owner = hook.Owner;
+    auto startTime = std::chrono::steady_clock::now();
+    _scriptEngine.ExecutePluginCall(owner, hook.Function, args, isGameStateMutable);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+    RecordHookTime(type, owner, static_cast<uint64_t>(elapsed.count()));
+}
+
+void HookEngine::RecordHookTime(HOOK_TYPE type, const std::shared_ptr<Plugin>& plugin, uint64_t time)
+{
+    auto& timings = plugin->GetHookTimings(type);
+    timings.CallCount++;
+    timings.TotalTime += time;
+    timings.MaxTime = std::max(timings.MaxTime, time);
+
+    // The budget is only a soft limit, skipping hooks would let the game state diverge between players.
+    const auto budget = gConfigPlugin.hook_time_budget;
+    if (budget > 0 && time > static_cast<uint64_t>(budget * 1000.0f))
+    {
+        if (timings.OverBudgetCount == 0)
+        {
+            char buffer[128];
+            snprintf(
+                buffer, sizeof(buffer), "%s hook took %.2f ms, exceeding the budget of %.2f ms",
+                std::string(GetHookName(type)).c_str(), time / 1000.0, budget);
+            _scriptEngine.LogPluginInfo(plugin, buffer);
+        }
+        timings.OverBudgetCount++;
     }
 }
 
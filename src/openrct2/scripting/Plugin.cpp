@@ -11,18 +11,45 @@
 
 #    include "Plugin.h"
 
+#    include "../Context.h"
 #    include "../Diagnostic.h"
 #    include "../OpenRCT2.h"
+#    include "../PlatformEnvironment.h"
+#    include "../core/Crypt.h"
 #    include "../core/File.h"
+#    include "../core/FileStream.h"
+#    include "../core/Path.hpp"
+#    include "../core/String.hpp"
 #    include "Duktape.hpp"
 #    include "ScriptEngine.h"
 
 #    include <algorithm>
+#    include <cstring>
 #    include <fstream>
 #    include <memory>
+#    include <random>
 
+using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+static constexpr uint16_t BYTECODE_CACHE_VERSION = 1;
+static constexpr uint32_t BYTECODE_CACHE_MAGIC = 0x43425350; // PSBC
+
+static uint64_t GetCodeHash(const std::string& code)
+{
+    auto hash = Crypt::CreateFNV1a();
+    hash->Update(&BYTECODE_CACHE_VERSION, sizeof(BYTECODE_CACHE_VERSION));
+    // Bytecode is only valid for the Duktape build that dumped it.
+    const auto duktapeVersion = static_cast<uint32_t>(DUK_VERSION);
+    hash->Update(&duktapeVersion, sizeof(duktapeVersion));
+    hash->Update(code.data(), code.size());
+    auto result = hash->Finish();
+
+    uint64_t value;
+    std::memcpy(&value, result.data(), sizeof(value));
+    return value;
+}
+
 Plugin::Plugin(duk_context* context, std::string_view path)
     : _context(context)
     , _path(path)
@@ -51,20 +78,35 @@ void Plugin::Load()
     // so that if the script modifies them, they are not modified for other scripts.
 
     // clang-format off
-    auto code = _code;
-    code =
-        "     (function(" + projectedVariables + ") {"
+    auto code =
+        "     function(" + projectedVariables + ") {"
         "         var __metadata__ = null;"
         "         var registerPlugin = function(m) { __metadata__ = m };"
         "         (function(__metadata__) {"
-                      + code +
+                      + _code +
         "         })();"
         "         return __metadata__;"
-        "     })(" + projectedVariables + ");";
+        "     }";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
+    // Compiling big scripts takes a while, so the compiled function is cached and reused as long as the code is the same.
+    auto codeHash = GetCodeHash(code);
+    auto cachePath = GetBytecodeCachePath();
+    if (cachePath.empty() || !ReadBytecodeCache(cachePath, codeHash))
+    {
+        CompileCode(code);
+        if (!cachePath.empty())
+        {
+            WriteBytecodeCache(cachePath, codeHash);
+        }
+    }
+
+    auto variables = String::Split(projectedVariables, ",");
+    for (const auto& variable : variables)
+    {
+        duk_get_global_string(_context, variable.c_str());
+    }
+    auto result = duk_pcall(_context, static_cast<duk_idx_t>(variables.size()));
     if (result != DUK_ERR_NONE)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
@@ -76,6 +118,120 @@ void Plugin::Load()
     _hasLoaded = true;
 }
 
+void Plugin::CompileCode(const std::string& code)
+{
+    auto result = duk_pcompile_lstring(_context, DUK_COMPILE_FUNCTION, code.c_str(), code.size());
+    if (result != DUK_ERR_NONE)
+    {
+        auto val = std::string(duk_safe_to_string(_context, -1));
+        duk_pop(_context);
+        throw std::runtime_error("Failed to load plug-in script: " + val);
+    }
+}
+
+std::string Plugin::GetBytecodeCachePath() const
+{
+    auto* context = GetContext();
+    if (context == nullptr)
+    {
+        return {};
+    }
+
+    // Each plugin file has a single cache entry, so editing a plugin replaces its entry rather than adding another.
+    // Network plugins have no path and are cached by their code instead.
+    auto key = _path.empty() ? _code : _path;
+    std::string fileName;
+    for (auto b : Crypt::FNV1a(key.data(), key.size()))
+    {
+        fileName += String::StdFormat("%02x", b);
+    }
+    auto env = context->GetPlatformEnvironment();
+    return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"plugins", fileName + u8".bin");
+}
+
+bool Plugin::ReadBytecodeCache(const std::string& path, uint64_t codeHash)
+{
+    if (!File::Exists(path))
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> bytecode;
+    try
+    {
+        auto fs = FileStream(path, FILE_MODE_OPEN);
+        if (fs.ReadValue<uint32_t>() != BYTECODE_CACHE_MAGIC || fs.ReadValue<uint16_t>() != BYTECODE_CACHE_VERSION
+            || fs.ReadValue<uint64_t>() != codeHash)
+        {
+            return false;
+        }
+
+        auto length = fs.ReadValue<uint32_t>();
+        if (length == 0 || length > fs.GetLength() - fs.GetPosition())
+        {
+            throw IOException("Bytecode exceeds the end of the file.");
+        }
+        bytecode.resize(length);
+        fs.Read(bytecode.data(), length);
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to read plugin bytecode cache '%s': %s", path.c_str(), e.what());
+        return false;
+    }
+
+    auto* buffer = duk_push_fixed_buffer(_context, bytecode.size());
+    std::memcpy(buffer, bytecode.data(), bytecode.size());
+    auto result = duk_safe_call(
+        _context,
+        [](duk_context* ctx, void*) -> duk_ret_t {
+            duk_load_function(ctx);
+            return 1;
+        },
+        nullptr, 1, 1);
+    if (result != DUK_EXEC_SUCCESS)
+    {
+        log_warning("Unable to load plugin bytecode cache '%s': %s", path.c_str(), duk_safe_to_string(_context, -1));
+        duk_pop(_context);
+        return false;
+    }
+    return true;
+}
+
+void Plugin::WriteBytecodeCache(const std::string& path, uint64_t codeHash)
+{
+    // Dump a copy, the compiled function stays on the stack to be called.
+    duk_dup_top(_context);
+    duk_dump_function(_context);
+    duk_size_t length{};
+    auto* bytecode = duk_get_buffer_data(_context, -1, &length);
+
+    // Several instances can write to the cache at once, so write to a file of our own and move it into place.
+    auto tempPath = path + "." + std::to_string(std::random_device{}()) + ".tmp";
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(path));
+        {
+            auto fs = FileStream(tempPath, FILE_MODE_WRITE);
+            fs.WriteValue<uint32_t>(BYTECODE_CACHE_MAGIC);
+            fs.WriteValue<uint16_t>(BYTECODE_CACHE_VERSION);
+            fs.WriteValue<uint64_t>(codeHash);
+            fs.WriteValue<uint32_t>(static_cast<uint32_t>(length));
+            fs.Write(bytecode, length);
+        }
+        if (!File::Move(tempPath, path))
+        {
+            throw std::runtime_error("Unable to move the bytecode cache into place.");
+        }
+    }
+    catch (const std::exception& e)
+    {
+        log_warning("Unable to write plugin bytecode cache '%s': %s", path.c_str(), e.what());
+        File::Delete(tempPath);
+    }
+    duk_pop(_context);
+}
+
 void Plugin::Start()
 {
     if (!_hasLoaded)
@@ -12,7 +12,9 @@
 #ifdef ENABLE_SCRIPTING
 
 #    include "Duktape.hpp"
+#    include "HookEngine.h"
 
+#    include <array>
 #    include <memory>
 #    include <string>
 #    include <string_view>
@@ -52,6 +54,16 @@ namespace OpenRCT2::Scripting
         DukValue Main;
     };
 
+    struct HookTimings
+    {
+        uint32_t CallCount{};
+        // Number of calls that took longer than the configured hook time budget.
+        uint32_t OverBudgetCount{};
+        // In microseconds.
+        uint64_t TotalTime{};
+        uint64_t MaxTime{};
+    };
+
     class Plugin
     {
     private:
@@ -62,6 +74,7 @@ namespace OpenRCT2::Scripting
         bool _hasLoaded{};
         bool _hasStarted{};
         bool _isStopping{};
+        std::array<HookTimings, NUM_HOOK_TYPES> _hookTimings{};
 
     public:
         std::string_view GetPath() const
@@ -99,6 +112,21 @@ namespace OpenRCT2::Scripting
             return _hasLoaded;
         }
 
+        const HookTimings& GetHookTimings(HOOK_TYPE type) const
+        {
+            return _hookTimings[static_cast<size_t>(type)];
+        }
+
+        HookTimings& GetHookTimings(HOOK_TYPE type)
+        {
+            return _hookTimings[static_cast<size_t>(type)];
+        }
+
+        void ResetHookTimings()
+        {
+            _hookTimings.fill({});
+        }
+
         int32_t GetTargetAPIVersion() const;
 
         Plugin() = default;
@@ -119,6 +147,10 @@ namespace OpenRCT2::Scripting
 
     private:
         void LoadCodeFromFile();
+        void CompileCode(const std::string& code);
+        std::string GetBytecodeCachePath() const;
+        bool ReadBytecodeCache(const std::string& path, uint64_t codeHash);
+        void WriteBytecodeCache(const std::string& path, uint64_t codeHash);
 
         static PluginMetadata GetMetadata(const DukValue& dukMetadata);
         static PluginType ParsePluginType(std::string_view type);
@@ -35,6 +35,7 @@
 #    include "bindings/game/ScContext.hpp"
 #    include "bindings/game/ScDisposable.hpp"
 #    include "bindings/game/ScProfiler.hpp"
+#    include "bindings/game/ScWorker.hpp"
 #    include "bindings/network/ScNetwork.hpp"
 #    include "bindings/network/ScPlayer.hpp"
 #    include "bindings/network/ScPlayerGroup.hpp"
@@ -422,6 +423,7 @@ void ScriptEngine::Initialise()
     ScSocket::Register(ctx);
     ScListener::Register(ctx);
 #    endif
+    ScWorker::Register(ctx);
     ScScenario::Register(ctx);
     ScScenarioObjective::Register(ctx);
     ScPatrolArea::Register(ctx);
@@ -673,6 +675,7 @@ void ScriptEngine::StopPlugin(std::shared_ptr<Plugin> plugin)
         RemoveCustomGameActions(plugin);
         RemoveIntervals(plugin);
         RemoveSockets(plugin);
+        RemoveWorkers(plugin);
         _hookEngine.UnsubscribeAll(plugin);
 
         plugin->StopEnd();
@@ -772,6 +775,10 @@ void ScriptEngine::UnloadTransientPlugins()
         }
     }
 
+    // Actions of the previous park should not be reported alongside those of the next one.
+    _queriedActions.clear();
+    _executedActions.clear();
+
     _transientPluginsEnabled = false;
     _transientPluginsStarted = false;
 }
@@ -822,8 +829,10 @@ void ScriptEngine::Tick()
     PROFILED_FUNCTION();
 
     CheckAndStartPlugins();
+    RunGameActionBatchHooks();
     UpdateIntervals();
     UpdateSockets();
+    UpdateWorkers();
     ProcessREPL();
     DoAutoReloadPluginCheck();
 }
@@ -1293,7 +1302,10 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
     DukStackFrame frame(_context);
 
     auto hookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE : HOOK_TYPE::ACTION_QUERY;
-    if (_hookEngine.HasSubscriptions(hookType))
+    auto batchHookType = isExecute ? HOOK_TYPE::ACTION_EXECUTE_BATCH : HOOK_TYPE::ACTION_QUERY_BATCH;
+    auto hasHooks = _hookEngine.HasSubscriptions(hookType);
+    auto hasBatchHooks = _hookEngine.HasSubscriptions(batchHookType);
+    if (hasHooks || hasBatchHooks)
     {
         DukObject obj(_context);
 
@@ -1338,25 +1350,69 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
 
-        _hookEngine.Call(hookType, dukEventArgs, false);
-
-        if (!isExecute)
+        if (hasHooks)
         {
-            auto dukResult = dukEventArgs["result"];
-            if (dukResult.type() == DukValue::Type::OBJECT)
+            _hookEngine.Call(hookType, dukEventArgs, false);
+
+            if (!isExecute)
             {
-                auto error = AsOrDefault<int32_t>(dukResult["error"]);
-                if (error != 0)
+                auto dukResult = dukEventArgs["result"];
+                if (dukResult.type() == DukValue::Type::OBJECT)
                 {
-                    result.Error = static_cast<GameActions::Status>(error);
-                    result.ErrorTitle = AsOrDefault<std::string>(dukResult["errorTitle"]);
-                    result.ErrorMessage = AsOrDefault<std::string>(dukResult["errorMessage"]);
+                    auto error = AsOrDefault<int32_t>(dukResult["error"]);
+                    if (error != 0)
+                    {
+                        result.Error = static_cast<GameActions::Status>(error);
+                        result.ErrorTitle = AsOrDefault<std::string>(dukResult["errorTitle"]);
+                        result.ErrorMessage = AsOrDefault<std::string>(dukResult["errorMessage"]);
+                    }
                 }
             }
         }
+
+        // Batch hooks only observe, so queries the regular hooks have rejected are not passed on.
+        if (hasBatchHooks && result.Error == GameActions::Status::Ok)
+        {
+            auto& actions = isExecute ? _executedActions : _queriedActions;
+            actions.push_back(std::move(dukEventArgs));
+        }
     }
 }
 
+void ScriptEngine::RunGameActionBatchHooks()
+{
+    RunGameActionBatchHook(HOOK_TYPE::ACTION_QUERY_BATCH, _queriedActions);
+    RunGameActionBatchHook(HOOK_TYPE::ACTION_EXECUTE_BATCH, _executedActions);
+}
+
+void ScriptEngine::RunGameActionBatchHook(HOOK_TYPE type, std::vector<DukValue>& actions)
+{
+    if (actions.empty())
+    {
+        return;
+    }
+
+    // Move the actions out first, the hooks may run further actions which are then batched for the next tick.
+    auto batch = std::move(actions);
+    actions.clear();
+    if (!_hookEngine.HasSubscriptions(type))
+    {
+        return;
+    }
+
+    DukStackFrame frame(_context);
+    duk_push_array(_context);
+    duk_uarridx_t index = 0;
+    for (const auto& action : batch)
+    {
+        action.push();
+        duk_put_prop_index(_context, /* duk stack index */ -2, index);
+        index++;
+    }
+    auto dukActions = DukValue::take_from_stack(_context);
+    _hookEngine.Call(type, dukActions, false);
+}
+
 std::unique_ptr<GameAction> ScriptEngine::CreateGameAction(const std::string& actionid, const DukValue& args)
 {
     auto action = CreateGameActionFromActionId(actionid);
@@ -1439,13 +1495,53 @@ void ScriptEngine::ClearParkStorage()
 {
     duk_push_object(_context);
     _parkStorage = std::move(DukValue::take_from_stack(_context));
+    _parkStorageBlobs.clear();
 }
 
 std::string ScriptEngine::GetParkStorageAsJSON()
 {
+    // Encode the storage of each plugin separately, so that the ones which have not changed since the last save can
+    // reuse their previous encoding. The result is the same as encoding the whole storage object at once.
+    decltype(_parkStorageBlobs) blobs;
+    std::string json = "{";
     _parkStorage.push();
-    auto json = std::string(duk_json_encode(_context, -1));
-    duk_pop(_context);
+    duk_enum(_context, -1, DUK_ENUM_OWN_PROPERTIES_ONLY);
+    while (duk_next(_context, -1, true))
+    {
+        std::string pluginName = duk_safe_to_string(_context, -2);
+        ParkStorageBlob blob;
+        auto it = _parkStorageBlobs.find(pluginName);
+        if (it != _parkStorageBlobs.end() && !it->second.Dirty && !it->second.Referenced)
+        {
+            blob = std::move(it->second);
+        }
+        else
+        {
+            blob.Referenced = it != _parkStorageBlobs.end() && it->second.Referenced;
+            const auto* value = duk_json_encode(_context, -1);
+            if (value == nullptr)
+            {
+                // Not representable in JSON, e.g. undefined.
+                duk_pop_2(_context);
+                continue;
+            }
+            duk_dup(_context, -2);
+            blob.Json = std::string(duk_json_encode(_context, -1)) + ":" + value;
+            duk_pop(_context);
+        }
+        duk_pop_2(_context);
+
+        if (json.size() > 1)
+        {
+            json += ",";
+        }
+        json += blob.Json;
+        blobs.emplace(std::move(pluginName), std::move(blob));
+    }
+    duk_pop_2(_context);
+    json += "}";
+
+    _parkStorageBlobs = std::move(blobs);
     return json;
 }
 
@@ -1455,6 +1551,17 @@ void ScriptEngine::SetParkStorageFromJSON(std::string_view value)
     if (result)
     {
         _parkStorage = std::move(*result);
+        _parkStorageBlobs.clear();
+    }
+}
+
+void ScriptEngine::MarkParkStorageDirty(const std::string& pluginName, bool referenced)
+{
+    auto it = _parkStorageBlobs.find(pluginName);
+    if (it != _parkStorageBlobs.end())
+    {
+        it->second.Dirty = true;
+        it->second.Referenced |= referenced;
     }
 }
 
@@ -1595,6 +1702,47 @@ void ScriptEngine::RemoveSockets(const std::shared_ptr<Plugin>& plugin)
 #    endif
 }
 
+void ScriptEngine::AddWorker(const std::shared_ptr<ScWorker>& worker)
+{
+    _workers.push_back(worker);
+}
+
+void ScriptEngine::UpdateWorkers()
+{
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto& worker = *it;
+        worker->Update();
+        if (worker->IsDisposed())
+        {
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void ScriptEngine::RemoveWorkers(const std::shared_ptr<Plugin>& plugin)
+{
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto worker = it->get();
+        if (worker->GetPlugin() == plugin)
+        {
+            worker->Dispose();
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
 std::string OpenRCT2::Scripting::Stringify(const DukValue& val)
 {
     return ExpressionStringifier::StringifyExpression(val);
@@ -1651,9 +1799,9 @@ int32_t OpenRCT2::Scripting::GetTargetAPIVersion()
     return plugin->GetTargetAPIVersion();
 }
 
-duk_bool_t duk_exec_timeout_check(void*)
+duk_bool_t duk_exec_timeout_check(void* udata)
 {
-    return false;
+    return ScWorker::ShouldInterrupt(udata);
 }
 
 #endif
@@ -46,7 +46,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 52;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 59;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
@@ -54,6 +54,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
 #    endif
+    class ScWorker;
 
     class ScriptExecutionInfo
     {
@@ -157,6 +158,16 @@ namespace OpenRCT2::Scripting
         DukValue _sharedStorage;
         DukValue _parkStorage;
 
+        // The JSON of each plugin's park storage from the last save, reused while the storage is unchanged.
+        struct ParkStorageBlob
+        {
+            std::string Json;
+            bool Dirty{};
+            // The plugin has been handed a reference into its storage and could modify it without us noticing.
+            bool Referenced{};
+        };
+        std::unordered_map<std::string, ParkStorageBlob> _parkStorageBlobs;
+
         uint32_t _lastIntervalTimestamp{};
         std::vector<ScriptInterval> _intervals;
 
@@ -174,9 +185,14 @@ namespace OpenRCT2::Scripting
         };
 
         std::unordered_map<std::string, CustomActionInfo> _customActions;
+
+        // Event args of the actions run since the last tick, passed to the batch hooks all at once.
+        std::vector<DukValue> _queriedActions;
+        std::vector<DukValue> _executedActions;
 #    ifndef DISABLE_NETWORK
         std::list<std::shared_ptr<ScSocketBase>> _sockets;
 #    endif
+        std::list<std::shared_ptr<ScWorker>> _workers;
 
     public:
         ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& env);
@@ -210,6 +226,7 @@ namespace OpenRCT2::Scripting
         void ClearParkStorage();
         std::string GetParkStorageAsJSON();
         void SetParkStorageFromJSON(std::string_view value);
+        void MarkParkStorageDirty(const std::string& pluginName, bool referenced);
 
         void Initialise();
         void LoadTransientPlugins();
@@ -249,6 +266,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
         void AddSocket(const std::shared_ptr<ScSocketBase>& socket);
 #    endif
+        void AddWorker(const std::shared_ptr<ScWorker>& worker);
 
     private:
         void RefreshPlugins();
@@ -281,10 +299,14 @@ namespace OpenRCT2::Scripting
 
         IntervalHandle AllocateHandle();
         void UpdateIntervals();
+        void RunGameActionBatchHooks();
+        void RunGameActionBatchHook(HOOK_TYPE type, std::vector<DukValue>& actions);
         void RemoveIntervals(const std::shared_ptr<Plugin>& plugin);
 
         void UpdateSockets();
         void RemoveSockets(const std::shared_ptr<Plugin>& plugin);
+        void UpdateWorkers();
+        void RemoveWorkers(const std::shared_ptr<Plugin>& plugin);
     };
 
     bool IsGameStateMutable();
@@ -31,6 +31,8 @@ namespace OpenRCT2::Scripting
     private:
         ScConfigurationKind _kind;
         DukValue _backingObject;
+        // The plugin whose park storage this is.
+        std::string _parkStorageName;
 
     public:
         // context.configuration
@@ -40,9 +42,10 @@ namespace OpenRCT2::Scripting
         }
 
         // context.sharedStorage / context.getParkStorage
-        ScConfiguration(ScConfigurationKind kind, const DukValue& backingObject)
+        ScConfiguration(ScConfigurationKind kind, const DukValue& backingObject, std::string parkStorageName = {})
             : _kind(kind)
             , _backingObject(backingObject)
+            , _parkStorageName(std::move(parkStorageName))
         {
         }
 
@@ -151,6 +154,23 @@ namespace OpenRCT2::Scripting
             return !key.empty() && key.find('.') == std::string_view::npos;
         }
 
+        static bool IsReference(const DukValue& value)
+        {
+            return value.type() == DukValue::Type::OBJECT || value.type() == DukValue::Type::BUFFER;
+        }
+
+        /**
+         * Lets the script engine know that the park storage has to be encoded again on the next save. Once the plugin
+         * holds a reference into its storage, it always has to be.
+         */
+        void MarkParkStorageDirty(bool referenced) const
+        {
+            if (_kind == ScConfigurationKind::Park)
+            {
+                GetContext()->GetScriptEngine().MarkParkStorageDirty(_parkStorageName, referenced);
+            }
+        }
+
         DukValue getAll(const DukValue& dukNamespace) const
         {
             DukValue result;
@@ -182,6 +202,7 @@ namespace OpenRCT2::Scripting
                 {
                     auto obj = GetNamespaceObject(ns);
                     result = obj ? *obj : DukObject(ctx).Take();
+                    MarkParkStorageDirty(true);
                 }
             }
             else
@@ -233,6 +254,10 @@ namespace OpenRCT2::Scripting
                         auto val = (*obj)[n];
                         if (val.type() != DukValue::Type::UNDEFINED)
                         {
+                            if (IsReference(val))
+                            {
+                                MarkParkStorageDirty(true);
+                            }
                             return val;
                         }
                     }
@@ -288,6 +313,7 @@ namespace OpenRCT2::Scripting
                         duk_put_prop_lstring(ctx, -2, n.data(), n.size());
                     }
                     duk_pop(ctx);
+                    MarkParkStorageDirty(IsReference(value));
 
                     scriptEngine.SaveSharedStorage();
                 }
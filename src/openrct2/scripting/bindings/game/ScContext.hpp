@@ -22,6 +22,7 @@
 #    include "../../ScriptEngine.h"
 #    include "../game/ScConfiguration.hpp"
 #    include "../game/ScDisposable.hpp"
+#    include "../game/ScWorker.hpp"
 #    include "../object/ScObject.hpp"
 
 #    include <cstdio>
@@ -77,7 +78,7 @@ namespace OpenRCT2::Scripting
                 pluginStore = parkStore[pluginName];
             }
 
-            return std::make_shared<ScConfiguration>(ScConfigurationKind::Park, pluginStore);
+            return std::make_shared<ScConfiguration>(ScConfigurationKind::Park, pluginStore, std::string(pluginName));
         }
 
         std::shared_ptr<ScConfiguration> getParkStorage(const DukValue& dukPluginName)
@@ -446,6 +447,15 @@ namespace OpenRCT2::Scripting
             ClearIntervalOrTimeout(handle);
         }
 
+        std::shared_ptr<ScWorker> createWorker(const std::string& source)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+            auto worker = std::make_shared<ScWorker>(plugin, source);
+            scriptEngine.AddWorker(worker);
+            return worker;
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
@@ -467,6 +477,7 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::setTimeout, "setTimeout");
             dukglue_register_method(ctx, &ScContext::clearInterval, "clearInterval");
             dukglue_register_method(ctx, &ScContext::clearTimeout, "clearTimeout");
+            dukglue_register_method(ctx, &ScContext::createWorker, "createWorker");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -11,8 +11,12 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../Context.h"
 #    include "../../../profiling/Profiling.h"
 #    include "../../Duktape.hpp"
+#    include "../../HookEngine.h"
+#    include "../../Plugin.h"
+#    include "../../ScriptEngine.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -41,6 +45,9 @@ namespace OpenRCT2::Scripting
                 obj.Set("minTime", f->GetMinTime());
                 obj.Set("maxTime", f->GetMaxTime());
                 obj.Set("totalTime", f->GetTotalTime());
+                const auto allocations = f->GetAllocations();
+                obj.Set("allocationCount", allocations.Count);
+                obj.Set("allocatedBytes", allocations.Bytes);
                 obj.Set("parents", GetFunctionIndexArray(data, f->GetParents()));
                 obj.Set("children", GetFunctionIndexArray(data, f->GetChildren()));
                 obj.Take().push();
@@ -50,6 +57,35 @@ namespace OpenRCT2::Scripting
             return DukValue::take_from_stack(_ctx);
         }
 
+        DukValue getPluginData()
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& plugin : scriptEngine.GetPlugins())
+            {
+                for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
+                {
+                    auto type = static_cast<HOOK_TYPE>(i);
+                    const auto& timings = plugin->GetHookTimings(type);
+                    if (timings.CallCount == 0)
+                        continue;
+
+                    DukObject obj(_ctx);
+                    obj.Set("plugin", plugin->GetMetadata().Name);
+                    obj.Set("hook", GetHookName(type));
+                    obj.Set("callCount", timings.CallCount);
+                    obj.Set("maxTime", timings.MaxTime);
+                    obj.Set("totalTime", timings.TotalTime);
+                    obj.Set("overBudgetCount", timings.OverBudgetCount);
+                    obj.Take().push();
+                    duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                    index++;
+                }
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
         DukValue GetFunctionIndexArray(
             const std::vector<OpenRCT2::Profiling::Function*>& all, const std::vector<OpenRCT2::Profiling::Function*>& items)
         {
@@ -82,6 +118,10 @@ namespace OpenRCT2::Scripting
         void reset()
         {
             OpenRCT2::Profiling::ResetData();
+            for (const auto& plugin : GetContext()->GetScriptEngine().GetPlugins())
+            {
+                plugin->ResetHookTimings();
+            }
         }
 
         bool enabled_get() const
@@ -89,14 +129,21 @@ namespace OpenRCT2::Scripting
             return OpenRCT2::Profiling::IsEnabled();
         }
 
+        bool allocationTracking_get() const
+        {
+            return OpenRCT2::Profiling::IsAllocationTrackingEnabled();
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
             dukglue_register_method(ctx, &ScProfiler::getData, "getData");
+            dukglue_register_method(ctx, &ScProfiler::getPluginData, "getPluginData");
             dukglue_register_method(ctx, &ScProfiler::start, "start");
             dukglue_register_method(ctx, &ScProfiler::stop, "stop");
             dukglue_register_method(ctx, &ScProfiler::reset, "reset");
             dukglue_register_property(ctx, &ScProfiler::enabled_get, nullptr, "enabled");
+            dukglue_register_property(ctx, &ScProfiler::allocationTracking_get, nullptr, "allocationTracking");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -0,0 +1,274 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "ScWorker.hpp"
+
+#    include "../../../Context.h"
+#    include "../../../profiling/Profiling.h"
+#    include "../../ScriptEngine.h"
+
+#    include <algorithm>
+#    include <cstring>
+
+namespace OpenRCT2::Scripting
+{
+    static std::vector<uint8_t> EncodeMessage(duk_context* ctx, duk_idx_t idx)
+    {
+        duk_cbor_encode(ctx, idx, 0);
+        duk_size_t size{};
+        auto* data = static_cast<const uint8_t*>(duk_get_buffer_data(ctx, idx, &size));
+        return std::vector<uint8_t>(data, data + size);
+    }
+
+    static void PushMessage(duk_context* ctx, const std::vector<uint8_t>& message)
+    {
+        auto* buffer = duk_push_fixed_buffer(ctx, message.size());
+        if (!message.empty())
+        {
+            std::memcpy(buffer, message.data(), message.size());
+        }
+        duk_cbor_decode(ctx, -1, 0);
+    }
+
+    static void PostError(ScWorkerState& state, std::string error)
+    {
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        auto& message = state.Outbox.emplace_back();
+        message.IsError = true;
+        message.Error = std::move(error);
+    }
+
+    static ScWorkerState& GetWorkerState(duk_context* ctx)
+    {
+        duk_memory_functions funcs{};
+        duk_get_memory_functions(ctx, &funcs);
+        return *static_cast<ScWorkerState*>(funcs.udata);
+    }
+
+    // postMessage(message) as seen by the worker's script.
+    static duk_ret_t WorkerPostMessage(duk_context* ctx)
+    {
+        auto data = EncodeMessage(ctx, 0);
+
+        auto& state = GetWorkerState(ctx);
+        std::lock_guard<std::mutex> lock(state.Mutex);
+        auto& message = state.Outbox.emplace_back();
+        message.Data = std::move(data);
+        return 0;
+    }
+
+    static duk_ret_t WorkerDeliverMessage(duk_context* ctx, void* udata)
+    {
+        duk_get_global_string(ctx, "onMessage");
+        if (!duk_is_function(ctx, -1))
+        {
+            return 0;
+        }
+        PushMessage(ctx, *static_cast<const std::vector<uint8_t>*>(udata));
+        duk_call(ctx, 1);
+        return 0;
+    }
+
+    static duk_ret_t DecodeMessage(duk_context* ctx, void* udata)
+    {
+        PushMessage(ctx, *static_cast<const std::vector<uint8_t>*>(udata));
+        return 1;
+    }
+
+    ScWorker::ScWorker(const std::shared_ptr<Plugin>& plugin, std::string source)
+        : _plugin(plugin)
+        , _state(std::make_shared<ScWorkerState>())
+    {
+        _thread = std::thread(&ScWorker::RunWorker, _state, std::move(source));
+    }
+
+    ScWorker::~ScWorker()
+    {
+        Dispose();
+    }
+
+    void ScWorker::Update()
+    {
+        decltype(_state->Outbox) messages;
+        {
+            std::lock_guard<std::mutex> lock(_state->Mutex);
+            messages.swap(_state->Outbox);
+        }
+
+        auto& scriptEngine = GetContext()->GetScriptEngine();
+        auto ctx = scriptEngine.GetContext();
+        for (auto& message : messages)
+        {
+            // A listener may have terminated the worker, drop whatever it posted afterwards.
+            if (IsDisposed())
+            {
+                break;
+            }
+
+            DukValue value;
+            std::vector<DukValue> listeners;
+            if (!message.IsError && duk_safe_call(ctx, DecodeMessage, &message.Data, 0, 1) == DUK_EXEC_SUCCESS)
+            {
+                value = DukValue::take_from_stack(ctx);
+                listeners = _onMessage;
+            }
+            else
+            {
+                if (!message.IsError)
+                {
+                    message.Error = duk_safe_to_string(ctx, -1);
+                    duk_pop(ctx);
+                }
+                value = ToDuk(ctx, message.Error);
+                listeners = _onError;
+            }
+
+            for (const auto& listener : listeners)
+            {
+                scriptEngine.ExecutePluginCall(_plugin, listener, { value }, false);
+            }
+        }
+    }
+
+    void ScWorker::Dispose()
+    {
+        if (!_thread.joinable())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_state->Mutex);
+            _state->Terminated = true;
+        }
+        _state->Cond.notify_all();
+        _thread.join();
+
+        _onMessage.clear();
+        _onError.clear();
+    }
+
+    void ScWorker::Register(duk_context* ctx)
+    {
+        dukglue_register_method(ctx, &ScWorker::postMessage, "postMessage");
+        dukglue_register_method(ctx, &ScWorker::on, "on");
+        dukglue_register_method(ctx, &ScWorker::off, "off");
+        dukglue_register_method(ctx, &ScWorker::terminate, "terminate");
+    }
+
+    bool ScWorker::ShouldInterrupt(void* udata)
+    {
+        // Only worker heaps are created with user data.
+        auto* state = static_cast<ScWorkerState*>(udata);
+        return state != nullptr && state->Terminated;
+    }
+
+    void ScWorker::postMessage(const DukValue& message)
+    {
+        if (IsDisposed())
+        {
+            return;
+        }
+
+        auto ctx = message.context();
+        message.push();
+        auto data = EncodeMessage(ctx, -1);
+        duk_pop(ctx);
+
+        {
+            std::lock_guard<std::mutex> lock(_state->Mutex);
+            _state->Inbox.push_back(std::move(data));
+        }
+        _state->Cond.notify_one();
+    }
+
+    ScWorker* ScWorker::on(const std::string& eventType, const DukValue& callback)
+    {
+        auto* listeners = GetListeners(eventType);
+        if (listeners != nullptr && callback.is_function())
+        {
+            listeners->push_back(callback);
+        }
+        return this;
+    }
+
+    ScWorker* ScWorker::off(const std::string& eventType, const DukValue& callback)
+    {
+        auto* listeners = GetListeners(eventType);
+        if (listeners != nullptr)
+        {
+            listeners->erase(std::remove(listeners->begin(), listeners->end(), callback), listeners->end());
+        }
+        return this;
+    }
+
+    void ScWorker::terminate()
+    {
+        Dispose();
+    }
+
+    std::vector<DukValue>* ScWorker::GetListeners(const std::string& eventType)
+    {
+        if (eventType == "message")
+            return &_onMessage;
+        if (eventType == "error")
+            return &_onError;
+        return nullptr;
+    }
+
+    void ScWorker::RunWorker(std::shared_ptr<ScWorkerState> state, std::string source)
+    {
+        Profiling::SetThreadName("Plugin worker");
+
+        // The state is passed as heap user data so that the execution timeout check can find it.
+        auto ctx = duk_create_heap(nullptr, nullptr, nullptr, state.get(), nullptr);
+        if (ctx == nullptr)
+        {
+            PostError(*state, "Unable to create worker context.");
+            return;
+        }
+
+        duk_push_c_function(ctx, WorkerPostMessage, 1);
+        duk_put_global_string(ctx, "postMessage");
+
+        if (duk_peval_string(ctx, source.c_str()) != DUK_EXEC_SUCCESS)
+        {
+            PostError(*state, duk_safe_to_string(ctx, -1));
+        }
+        duk_pop(ctx);
+
+        while (true)
+        {
+            std::vector<uint8_t> message;
+            {
+                std::unique_lock<std::mutex> lock(state->Mutex);
+                state->Cond.wait(lock, [&state]() { return state->Terminated || !state->Inbox.empty(); });
+                if (state->Terminated)
+                {
+                    break;
+                }
+                message = std::move(state->Inbox.front());
+                state->Inbox.pop_front();
+            }
+
+            if (duk_safe_call(ctx, WorkerDeliverMessage, &message, 0, 1) != DUK_EXEC_SUCCESS)
+            {
+                PostError(*state, duk_safe_to_string(ctx, -1));
+            }
+            duk_pop(ctx);
+        }
+
+        duk_destroy_heap(ctx);
+    }
+
+} // namespace OpenRCT2::Scripting
+
+#endif
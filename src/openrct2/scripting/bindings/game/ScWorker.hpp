@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2022 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../../Duktape.hpp"
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <cstdint>
+#    include <deque>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    class Plugin;
+
+    /**
+     * Queues shared between a worker and the plugin that created it. Messages are CBOR encoded, so no value is ever
+     * shared between the two heaps.
+     */
+    struct ScWorkerState
+    {
+        struct Message
+        {
+            bool IsError{};
+            std::vector<uint8_t> Data;
+            std::string Error;
+        };
+
+        std::mutex Mutex;
+        std::condition_variable Cond;
+        std::deque<std::vector<uint8_t>> Inbox;
+        std::deque<Message> Outbox;
+        std::atomic<bool> Terminated{};
+    };
+
+    /**
+     * Runs a script in its own Duktape heap on a separate thread. The worker has no access to the game, it can only
+     * exchange messages with the plugin that created it.
+     */
+    class ScWorker
+    {
+    private:
+        std::shared_ptr<Plugin> _plugin;
+        std::shared_ptr<ScWorkerState> _state;
+        std::thread _thread;
+        std::vector<DukValue> _onMessage;
+        std::vector<DukValue> _onError;
+
+    public:
+        ScWorker(const std::shared_ptr<Plugin>& plugin, std::string source);
+        ScWorker(const ScWorker&) = delete;
+        ~ScWorker();
+
+        const std::shared_ptr<Plugin>& GetPlugin() const
+        {
+            return _plugin;
+        }
+
+        bool IsDisposed() const
+        {
+            return !_thread.joinable();
+        }
+
+        /**
+         * Raises the events for the messages and errors posted by the worker since the last update.
+         */
+        void Update();
+        void Dispose();
+
+        static void Register(duk_context* ctx);
+
+        /**
+         * Called by Duktape's execution timeout check, interrupts a worker's script once it has been terminated.
+         */
+        static bool ShouldInterrupt(void* udata);
+
+    private:
+        void postMessage(const DukValue& message);
+        ScWorker* on(const std::string& eventType, const DukValue& callback);
+        ScWorker* off(const std::string& eventType, const DukValue& callback);
+        void terminate();
+
+        std::vector<DukValue>* GetListeners(const std::string& eventType);
+
+        static void RunWorker(std::shared_ptr<ScWorkerState> state, std::string source);
+    };
+
+} // namespace OpenRCT2::Scripting
+
+#endif
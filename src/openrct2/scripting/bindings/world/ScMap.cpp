@@ -33,8 +33,249 @@
 #    include "../ride/ScRide.hpp"
 #    include "../world/ScTile.hpp"
 
+#    include <optional>
+
 namespace OpenRCT2::Scripting
 {
+    namespace
+    {
+        using TileDataFn = uint8_t (*)(const TileElement* element);
+
+        uint8_t GetSurfaceHeightData(const TileElement* element)
+        {
+            do
+            {
+                if (element->GetType() == TileElementType::Surface)
+                    return element->base_height;
+            } while (!(element++)->IsLastForTile());
+            return 0;
+        }
+
+        uint8_t GetOwnershipData(const TileElement* element)
+        {
+            do
+            {
+                auto* surfaceElement = element->AsSurface();
+                if (surfaceElement != nullptr)
+                    return surfaceElement->GetOwnership();
+            } while (!(element++)->IsLastForTile());
+            return 0;
+        }
+
+        uint8_t GetElementTypesData(const TileElement* element)
+        {
+            uint8_t types = 0;
+            do
+            {
+                types |= 1 << EnumValue(element->GetType());
+            } while (!(element++)->IsLastForTile());
+            return types;
+        }
+
+        uint8_t GetFootpathData(const TileElement* element)
+        {
+            do
+            {
+                if (element->GetType() == TileElementType::Path)
+                    return 1;
+            } while (!(element++)->IsLastForTile());
+            return 0;
+        }
+
+        constexpr std::pair<std::string_view, TileDataFn> TileDataLayers[] = {
+            { "surfaceHeight", GetSurfaceHeightData },
+            { "ownership", GetOwnershipData },
+            { "elementTypes", GetElementTypesData },
+            { "footpath", GetFootpathData },
+        };
+
+        struct StatRange
+        {
+            int32_t Min;
+            int32_t Max;
+
+            bool Contains(int32_t value) const
+            {
+                return value >= Min && value <= Max;
+            }
+        };
+
+        /**
+         * The conditions of map.queryEntities and map.countEntities, unset conditions match every entity.
+         */
+        struct EntityQuery
+        {
+            std::optional<MapRange> Range;
+            // Guests and staff
+            std::optional<RideId> Ride;
+            std::optional<StatRange> Energy;
+            // Guests only
+            std::optional<bool> IsInPark;
+            std::optional<bool> IsLost;
+            std::optional<StatRange> Happiness;
+            std::optional<StatRange> Nausea;
+            std::optional<StatRange> Hunger;
+            std::optional<StatRange> Thirst;
+            std::optional<StatRange> Toilet;
+
+            bool HasPeepConditions() const
+            {
+                return Ride.has_value() || Energy.has_value();
+            }
+
+            bool HasGuestConditions() const
+            {
+                return IsInPark.has_value() || IsLost.has_value() || Happiness.has_value() || Nausea.has_value()
+                    || Hunger.has_value() || Thirst.has_value() || Toilet.has_value();
+            }
+        };
+
+        std::optional<StatRange> ParseStatRange(const DukValue& value)
+        {
+            if (value.type() != DukValue::Type::OBJECT)
+                return std::nullopt;
+            return StatRange{ AsOrDefault(value["min"], 0), AsOrDefault(value["max"], 255) };
+        }
+
+        std::optional<bool> ParseBool(const DukValue& value)
+        {
+            if (value.type() != DukValue::Type::BOOLEAN)
+                return std::nullopt;
+            return value.as_bool();
+        }
+
+        EntityQuery ParseEntityQuery(duk_context* ctx, const std::string& type, const DukValue& filter)
+        {
+            EntityQuery query;
+            if (filter.type() != DukValue::Type::OBJECT)
+            {
+                return query;
+            }
+
+            if (filter["range"].type() == DukValue::Type::OBJECT)
+                query.Range = FromDuk<MapRange>(filter["range"]);
+            if (filter["ride"].type() == DukValue::Type::NUMBER)
+                query.Ride = RideId::FromUnderlying(filter["ride"].as_int());
+            query.Energy = ParseStatRange(filter["energy"]);
+            query.IsInPark = ParseBool(filter["isInPark"]);
+            query.IsLost = ParseBool(filter["isLost"]);
+            query.Happiness = ParseStatRange(filter["happiness"]);
+            query.Nausea = ParseStatRange(filter["nausea"]);
+            query.Hunger = ParseStatRange(filter["hunger"]);
+            query.Thirst = ParseStatRange(filter["thirst"]);
+            query.Toilet = ParseStatRange(filter["toilet"]);
+
+            if (query.HasPeepConditions() && type != "guest" && type != "staff" && type != "peep")
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "The ride and energy filters only apply to guests and staff.");
+            }
+            if (query.HasGuestConditions() && type != "guest")
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Guest filters only apply to guests.");
+            }
+            return query;
+        }
+
+        bool IsOnRide(const Peep& peep, RideId ride)
+        {
+            if (peep.CurrentRide != ride)
+                return false;
+
+            switch (peep.State)
+            {
+                case PeepState::Queuing:
+                case PeepState::QueuingFront:
+                case PeepState::EnteringRide:
+                case PeepState::OnRide:
+                case PeepState::LeavingRide:
+                case PeepState::Answering:
+                case PeepState::Fixing:
+                case PeepState::HeadingToInspection:
+                case PeepState::Inspecting:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        template<typename T> bool MatchesEntityQuery(const T& entity, const EntityQuery& query)
+        {
+            if constexpr (std::is_base_of_v<Peep, T>)
+            {
+                if (query.Ride.has_value() && !IsOnRide(entity, *query.Ride))
+                    return false;
+                if (query.Energy.has_value() && !query.Energy->Contains(entity.Energy))
+                    return false;
+            }
+            if constexpr (std::is_same_v<T, Guest>)
+            {
+                if (query.IsInPark.has_value() && *query.IsInPark == static_cast<bool>(entity.OutsideOfPark))
+                    return false;
+                if (query.IsLost.has_value() && *query.IsLost != (entity.GuestIsLostCountdown < 90))
+                    return false;
+                if (query.Happiness.has_value() && !query.Happiness->Contains(entity.Happiness))
+                    return false;
+                if (query.Nausea.has_value() && !query.Nausea->Contains(entity.Nausea))
+                    return false;
+                if (query.Hunger.has_value() && !query.Hunger->Contains(entity.Hunger))
+                    return false;
+                if (query.Thirst.has_value() && !query.Thirst->Contains(entity.Thirst))
+                    return false;
+                if (query.Toilet.has_value() && !query.Toilet->Contains(entity.Toilet))
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * Calls fn for every entity of type T that matches the query. With a range only the entity chunks that
+         * overlap it are visited, in no particular order.
+         */
+        template<typename T, typename TFn> void ForEachEntityInQuery(const EntityQuery& query, TFn&& fn)
+        {
+            if (query.Range.has_value())
+            {
+                for (auto* entity : EntityRangeQuery<T>(*query.Range))
+                {
+                    if (MatchesEntityQuery(*entity, query))
+                        fn(entity);
+                }
+            }
+            else
+            {
+                for (auto* entity : EntityList<T>())
+                {
+                    if (MatchesEntityQuery(*entity, query))
+                        fn(entity);
+                }
+            }
+        }
+
+        template<typename TFn> bool ForEachEntityInQuery(const std::string& type, const EntityQuery& query, TFn&& fn)
+        {
+            if (type == "balloon")
+                ForEachEntityInQuery<Balloon>(query, fn);
+            else if (type == "car")
+                ForEachEntityInQuery<Vehicle>(query, fn);
+            else if (type == "litter")
+                ForEachEntityInQuery<Litter>(query, fn);
+            else if (type == "duck")
+                ForEachEntityInQuery<Duck>(query, fn);
+            else if (type == "guest")
+                ForEachEntityInQuery<Guest>(query, fn);
+            else if (type == "staff")
+                ForEachEntityInQuery<Staff>(query, fn);
+            else if (type == "peep")
+            {
+                ForEachEntityInQuery<Guest>(query, fn);
+                ForEachEntityInQuery<Staff>(query, fn);
+            }
+            else
+                return false;
+            return true;
+        }
+    } // namespace
+
     ScMap::ScMap(duk_context* ctx)
         : _context(ctx)
     {
@@ -83,6 +324,39 @@ namespace OpenRCT2::Scripting
         return std::make_shared<ScTile>(coords);
     }
 
+    DukValue ScMap::getTileData(const std::string& layer, int32_t x, int32_t y, int32_t width, int32_t height) const
+    {
+        auto it = std::find_if(
+            std::begin(TileDataLayers), std::end(TileDataLayers), [&layer](const auto& entry) { return entry.first == layer; });
+        if (it == std::end(TileDataLayers))
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid tile data layer: %s", layer.c_str());
+        }
+        if (width < 0 || height < 0 || width > MAXIMUM_MAP_SIZE_TECHNICAL || height > MAXIMUM_MAP_SIZE_TECHNICAL)
+        {
+            duk_error(_context, DUK_ERR_RANGE_ERROR, "Invalid tile data size.");
+        }
+
+        // Filled in one pass without going through the tile and element wrappers, tiles off the map are left as 0.
+        const auto getData = it->second;
+        const auto dataLen = static_cast<size_t>(width) * height;
+        auto* data = static_cast<uint8_t*>(duk_push_fixed_buffer(_context, dataLen));
+        for (int32_t j = 0; j < height; j++)
+        {
+            for (int32_t i = 0; i < width; i++)
+            {
+                const auto* element = map_get_first_element_at(TileCoordsXY{ x + i, y + j });
+                if (element != nullptr)
+                {
+                    data[static_cast<size_t>(j) * width + i] = getData(element);
+                }
+            }
+        }
+        duk_push_buffer_object(_context, -1, 0, dataLen, DUK_BUFOBJ_UINT8ARRAY);
+        duk_remove(_context, -2);
+        return DukValue::take_from_stack(_context);
+    }
+
     DukValue ScMap::getEntity(int32_t id) const
     {
         if (id >= 0 && id < MAX_ENTITIES)
@@ -303,6 +577,41 @@ namespace OpenRCT2::Scripting
         return res;
     }
 
+    std::vector<DukValue> ScMap::queryEntities(const std::string& type, const DukValue& filter) const
+    {
+        const auto query = ParseEntityQuery(_context, type, filter);
+
+        // Only the matching entities get a wrapper, in the order of their ids.
+        std::vector<EntityBase*> entities;
+        if (!ForEachEntityInQuery(type, query, [&entities](EntityBase* entity) { entities.push_back(entity); }))
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+        }
+        std::sort(entities.begin(), entities.end(), [](const EntityBase* a, const EntityBase* b) {
+            return a->sprite_index < b->sprite_index;
+        });
+
+        std::vector<DukValue> result;
+        result.reserve(entities.size());
+        for (const auto* entity : entities)
+        {
+            result.push_back(GetEntityAsDukValue(entity));
+        }
+        return result;
+    }
+
+    int32_t ScMap::countEntities(const std::string& type, const DukValue& filter) const
+    {
+        const auto query = ParseEntityQuery(_context, type, filter);
+
+        int32_t count = 0;
+        if (!ForEachEntityInQuery(type, query, [&count](EntityBase*) { count++; }))
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+        }
+        return count;
+    }
+
     void ScMap::Register(duk_context* ctx)
     {
         dukglue_register_property(ctx, &ScMap::size_get, nullptr, "size");
@@ -311,10 +620,13 @@ namespace OpenRCT2::Scripting
         dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
         dukglue_register_method(ctx, &ScMap::getRide, "getRide");
         dukglue_register_method(ctx, &ScMap::getTile, "getTile");
+        dukglue_register_method(ctx, &ScMap::getTileData, "getTileData");
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
+        dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
+        dukglue_register_method(ctx, &ScMap::countEntities, "countEntities");
     }
 
     DukValue ScMap::GetEntityAsDukValue(const EntityBase* sprite) const
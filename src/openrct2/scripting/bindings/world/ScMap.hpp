@@ -38,12 +38,18 @@ namespace OpenRCT2::Scripting
 
         std::shared_ptr<ScTile> getTile(int32_t x, int32_t y) const;
 
+        DukValue getTileData(const std::string& layer, int32_t x, int32_t y, int32_t width, int32_t height) const;
+
         DukValue getEntity(int32_t id) const;
 
         std::vector<DukValue> getAllEntities(const std::string& type) const;
 
         std::vector<DukValue> getAllEntitiesOnTile(const std::string& type, const DukValue& tilePos) const;
 
+        std::vector<DukValue> queryEntities(const std::string& type, const DukValue& filter) const;
+
+        int32_t countEntities(const std::string& type, const DukValue& filter) const;
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         static void Register(duk_context* ctx);
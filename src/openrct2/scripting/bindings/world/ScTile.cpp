@@ -15,6 +15,7 @@
 #    include "../../../common.h"
 #    include "../../../core/Guard.hpp"
 #    include "../../../entity/EntityRegistry.h"
+#    include "../../../peep/GuestPathfinding.h"
 #    include "../../../ride/Track.h"
 #    include "../../../world/Footpath.h"
 #    include "../../../world/Scenery.h"
@@ -126,6 +127,8 @@ namespace OpenRCT2::Scripting
                 }
             }
             map_invalidate_tile_full(_coords);
+            map_invalidate_tile_updates(_coords);
+            PathfindInvalidateCaches();
         }
     }
 
@@ -178,6 +181,7 @@ namespace OpenRCT2::Scripting
                 }
                 first[origNumElements].SetLastForTile(true);
                 map_invalidate_tile_full(_coords);
+                PathfindInvalidateCaches();
                 result = std::make_shared<ScTileElement>(_coords, &first[index]);
             }
         }
@@ -197,6 +201,7 @@ namespace OpenRCT2::Scripting
         {
             tile_element_remove(&first[index]);
             map_invalidate_tile_full(_coords);
+            PathfindInvalidateCaches();
         }
     }
 
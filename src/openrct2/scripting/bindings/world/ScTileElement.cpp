@@ -15,6 +15,7 @@
 #    include "../../../common.h"
 #    include "../../../core/Guard.hpp"
 #    include "../../../entity/EntityRegistry.h"
+#    include "../../../peep/GuestPathfinding.h"
 #    include "../../../ride/Ride.h"
 #    include "../../../ride/Track.h"
 #    include "../../../world/Footpath.h"
@@ -301,7 +302,11 @@ namespace OpenRCT2::Scripting
         auto el = _element->AsSurface();
         if (el != nullptr)
         {
-            el->SetOwnership(value);
+            // Only the first surface of a tile counts towards the land rights for sale.
+            if (el == map_get_surface_element_at(_coords))
+                map_set_surface_ownership(el, value);
+            else
+                el->SetOwnership(value);
             Invalidate();
         }
     }
@@ -1627,6 +1632,8 @@ namespace OpenRCT2::Scripting
     void ScTileElement::Invalidate()
     {
         map_invalidate_tile_full(_coords);
+        map_invalidate_tile_updates(_coords);
+        PathfindInvalidateCaches();
     }
 
     void ScTileElement::Register(duk_context* ctx)
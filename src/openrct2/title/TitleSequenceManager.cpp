@@ -15,6 +15,7 @@
 #include "../core/Collections.hpp"
 #include "../core/File.h"
 #include "../core/FileScanner.h"
+#include "../core/FileWatcher.h"
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -24,6 +25,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <vector>
 
 namespace TitleSequenceManager
@@ -44,6 +46,7 @@ namespace TitleSequenceManager
     };
 
     static std::vector<TitleSequenceManagerItem> _items;
+    static std::unique_ptr<FileChangeQueue> _userSequenceChanges;
 
     static std::string GetNewTitleSequencePath(const std::string& name, bool isZip);
     static size_t FindItemIndexByPath(const std::string& path);
@@ -205,6 +208,53 @@ namespace TitleSequenceManager
         Scan(GetUserSequencesPath());
 
         SortSequences();
+
+        if (_userSequenceChanges == nullptr)
+        {
+            try
+            {
+                auto path = GetUserSequencesPath();
+                if (Path::DirectoryExists(path))
+                {
+                    _userSequenceChanges = std::make_unique<FileChangeQueue>(path);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                log_verbose("Unable to watch the user title sequence directory: %s", e.what());
+            }
+        }
+    }
+
+    void CheckForChangedFiles()
+    {
+        if (_userSequenceChanges == nullptr)
+        {
+            return;
+        }
+
+        bool changed = false;
+        for (const auto& path : _userSequenceChanges->TakeChangedFiles())
+        {
+            auto isScript = String::Equals(Path::GetFileName(path), u8"script.txt", true);
+            if (!isScript && !String::Equals(Path::GetExtension(path), u8".parkseq", true))
+            {
+                continue;
+            }
+
+            // Directory sequences are listed by their directory, the other files in it are read when the sequence loads.
+            auto itemPath = isScript ? Path::GetDirectory(path) : path;
+            if (FindItemIndexByPath(itemPath) == SIZE_MAX && File::Exists(path))
+            {
+                AddSequence(path);
+                changed = true;
+            }
+        }
+
+        if (changed)
+        {
+            SortSequences();
+        }
     }
 
     static void Scan(const std::string& directory)
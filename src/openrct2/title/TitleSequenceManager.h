@@ -30,6 +30,10 @@ namespace TitleSequenceManager
     size_t DuplicateItem(size_t i, const utf8* name);
     size_t CreateItem(const utf8* name);
     void Scan();
+    /**
+     * Adds the sequences that have been written to the user title sequence directory since the last call.
+     */
+    void CheckForChangedFiles();
 } // namespace TitleSequenceManager
 
 constexpr const size_t PREDEFINED_INDEX_CUSTOM = SIZE_MAX;
@@ -76,6 +76,10 @@ namespace OpenRCT2::Ui
         {
             return false;
         }
+        int32_t GetDisplayRefreshRate() override
+        {
+            return 0;
+        }
         bool IsSteamOverlayActive() override
         {
             return false;
@@ -115,6 +115,8 @@ namespace OpenRCT2
             virtual const std::vector<Resolution>& GetFullscreenResolutions() abstract;
             virtual bool HasFocus() abstract;
             virtual bool IsMinimised() abstract;
+            // Refresh rate of the display the window is on in Hz, or 0 if unknown.
+            virtual int32_t GetDisplayRefreshRate() abstract;
             virtual bool IsSteamOverlayActive() abstract;
             virtual void ProcessMessages() abstract;
             virtual void TriggerResize() abstract;
@@ -274,7 +274,18 @@ static size_t encode_chunk_rle(const uint8_t* src_buffer, uint8_t* dst_buffer, s
         }
         if (*src == src[1])
         {
-            for (; (count < 125) && ((src + count) < end_src); count++)
+            // Compare eight bytes at a time against the repeated byte, then finish the run byte by byte.
+            const size_t maxCount = std::min<size_t>(125, end_src - src);
+            const uint64_t pattern = *src * UINT64_C(0x0101010101010101);
+            while (count + sizeof(uint64_t) <= maxCount)
+            {
+                uint64_t word;
+                std::memcpy(&word, src + count, sizeof(word));
+                if (word != pattern)
+                    break;
+                count += sizeof(uint64_t);
+            }
+            for (; count < maxCount; count++)
             {
                 if (*src != src[count])
                     break;
@@ -371,9 +382,18 @@ static size_t encode_chunk_repeat(const uint8_t* src_buffer, uint8_t* dst_buffer
 
 static void encode_chunk_rotate(uint8_t* buffer, size_t length)
 {
-    size_t i;
+    // The rotation cycles through 1, 3, 5 and 7, so every group of four bytes uses the same constant shifts which
+    // lets the compiler vectorise the main loop.
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4)
+    {
+        buffer[i + 0] = Numerics::rol8(buffer[i + 0], 1);
+        buffer[i + 1] = Numerics::rol8(buffer[i + 1], 3);
+        buffer[i + 2] = Numerics::rol8(buffer[i + 2], 5);
+        buffer[i + 3] = Numerics::rol8(buffer[i + 3], 7);
+    }
     uint8_t code = 1;
-    for (i = 0; i < length; i++)
+    for (; i < length; i++)
     {
         buffer[i] = Numerics::rol8(buffer[i], code);
         code = (code + 2) % 8;
@@ -161,6 +161,16 @@ bool avx2_available()
     return false;
 }
 
+bool neon_available()
+{
+    // NEON is part of the base instruction set on AArch64.
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
+
 static bool bitcount_popcnt_available()
 {
 #ifdef OPENRCT2_X86
@@ -500,6 +510,7 @@ std::vector<uint8_t> Gzip(const void* data, const size_t dataLen)
             throw std::runtime_error("deflateInit2 failed with error " + std::to_string(ret));
         }
     }
+    output.reserve(deflateBound(&strm, static_cast<uLong>(dataLen)));
 
     int flush = 0;
     const auto* src = static_cast<const Bytef*>(data);
@@ -531,7 +542,7 @@ std::vector<uint8_t> Gzip(const void* data, const size_t dataLen)
     return output;
 }
 
-std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen)
+std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen, const size_t expectedSize)
 {
     assert(data != nullptr);
 
@@ -548,6 +559,9 @@ std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen)
             throw std::runtime_error("inflateInit2 failed with error " + std::to_string(ret));
         }
     }
+    // Inflate straight into the expected output if its size is known, only growing it if the data turns out larger.
+    output.resize(expectedSize);
+    size_t outputSize = 0;
 
     int flush = 0;
     const auto* src = static_cast<const Bytef*>(data);
@@ -562,19 +576,24 @@ std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen)
         strm.next_in = const_cast<Bytef*>(src);
         do
         {
-            output.resize(output.size() + nextBlockSize);
-            strm.avail_out = static_cast<uInt>(nextBlockSize);
-            strm.next_out = &output[output.size() - nextBlockSize];
+            if (output.size() - outputSize < nextBlockSize)
+            {
+                output.resize(outputSize + nextBlockSize);
+            }
+            const auto outBlockSize = std::min<size_t>(output.size() - outputSize, UINT32_MAX);
+            strm.avail_out = static_cast<uInt>(outBlockSize);
+            strm.next_out = &output[outputSize];
             const auto ret = inflate(&strm, flush);
             if (ret == Z_STREAM_ERROR)
             {
                 throw std::runtime_error("deflate failed with error " + std::to_string(ret));
             }
-            output.resize(output.size() - strm.avail_out);
+            outputSize += outBlockSize - strm.avail_out;
         } while (strm.avail_out == 0);
 
         src += nextBlockSize;
     } while (flush != Z_FINISH);
+    output.resize(outputSize);
     inflateEnd(&strm);
     return output;
 }
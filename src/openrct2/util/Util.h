@@ -25,6 +25,7 @@ int32_t mph_to_dmps(int32_t mph);
 
 bool sse41_available();
 bool avx2_available();
+bool neon_available();
 
 int32_t bitscanforward(int32_t source);
 int32_t bitscanforward(int64_t source);
@@ -45,7 +46,8 @@ uint32_t util_rand();
 
 bool util_gzip_compress(FILE* source, FILE* dest);
 std::vector<uint8_t> Gzip(const void* data, const size_t dataLen);
-std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen);
+// expectedSize is the size of the uncompressed data if known, so the output can be allocated up front.
+std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen, const size_t expectedSize = 0);
 
 int8_t add_clamp_int8_t(int8_t value, int8_t value_to_add);
 int16_t add_clamp_int16_t(int16_t value, int16_t value_to_add);
@@ -145,25 +145,23 @@ GameActions::Result MapCanConstructWithClearAt(
         return res;
     }
 
+    // Most elements on a tile are rejected by the quadrant test alone, so it goes before the height and ghost tests.
+    const auto baseQuarterOccupied = quarterTile.GetBaseQuarterOccupied();
     do
     {
         if (tileElement->GetType() != TileElementType::Surface)
         {
-            if (pos.baseZ < tileElement->GetClearanceZ() && pos.clearanceZ > tileElement->GetBaseZ()
-                && !(tileElement->IsGhost()))
+            if ((tileElement->GetOccupiedQuadrants() & baseQuarterOccupied) && pos.baseZ < tileElement->GetClearanceZ()
+                && pos.clearanceZ > tileElement->GetBaseZ() && !(tileElement->IsGhost()))
             {
-                if (tileElement->GetOccupiedQuadrants() & (quarterTile.GetBaseQuarterOccupied()))
+                if (MapLoc68BABCShouldContinue(&tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
                 {
-                    if (MapLoc68BABCShouldContinue(
-                            &tileElement, pos, clearFunc, flags, res.Cost, crossingMode, canBuildCrossing))
-                    {
-                        continue;
-                    }
-
-                    map_obstruction_set_error_text(tileElement, res);
-                    res.Error = GameActions::Status::NoClearance;
-                    return res;
+                    continue;
                 }
+
+                map_obstruction_set_error_text(tileElement, res);
+                res.Error = GameActions::Status::NoClearance;
+                return res;
             }
             continue;
         }
@@ -242,7 +240,7 @@ GameActions::Result MapCanConstructWithClearAt(
                         westZ += LAND_HEIGHT_STEP;
                 }
                 const auto baseHeight = pos.baseZ + (4 * COORDS_Z_STEP);
-                const auto baseQuarter = quarterTile.GetBaseQuarterOccupied();
+                const auto baseQuarter = baseQuarterOccupied;
                 const auto zQuarter = quarterTile.GetZQuarterOccupied();
                 if ((!(baseQuarter & 0b0001) || ((zQuarter & 0b0001 || pos.baseZ >= northZ) && baseHeight >= northZ))
                     && (!(baseQuarter & 0b0010) || ((zQuarter & 0b0010 || pos.baseZ >= eastZ) && baseHeight >= eastZ))
@@ -29,6 +29,7 @@
 #include "Map.h"
 #include "MapAnimation.h"
 #include "Park.h"
+#include "TileElementsView.h"
 
 #include <algorithm>
 
@@ -221,18 +222,14 @@ void fix_park_entrance_locations(void)
 void UpdateParkEntranceLocations()
 {
     gParkEntrances.clear();
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    while (tile_element_iterator_next(&it))
-    {
-        auto entranceElement = it.element->AsEntrance();
-        if (entranceElement != nullptr && entranceElement->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE
-            && entranceElement->GetSequenceIndex() == 0 && !entranceElement->IsGhost())
+    OpenRCT2::ForEachMapElement<EntranceElement>([](const TileCoordsXY& tilePos, const EntranceElement& entranceElement) {
+        if (entranceElement.GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE && entranceElement.GetSequenceIndex() == 0
+            && !entranceElement.IsGhost())
         {
-            auto entrance = TileCoordsXYZD(it.x, it.y, it.element->base_height, it.element->GetDirection()).ToCoordsXYZD();
-            gParkEntrances.push_back(entrance);
+            auto entrance = TileCoordsXYZD(tilePos, entranceElement.base_height, entranceElement.GetDirection());
+            gParkEntrances.push_back(entrance.ToCoordsXYZD());
         }
-    }
+    });
 }
 
 StationIndex EntranceElement::GetStationIndex() const
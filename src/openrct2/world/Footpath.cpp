@@ -27,6 +27,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../paint/VirtualFloor.h"
+#include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
@@ -38,9 +39,13 @@
 #include "Scenery.h"
 #include "Surface.h"
 #include "TileElement.h"
+#include "TileElementsView.h"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <iterator>
+#include <vector>
 
 using namespace OpenRCT2::TrackMetaData;
 void footpath_update_queue_entrance_banner(const CoordsXY& footpathPos, TileElement* tileElement);
@@ -55,6 +60,31 @@ uint8_t gFootpathGroundFlags;
 static RideId* _footpathQueueChainNext;
 static RideId _footpathQueueChain[64];
 
+// The provisional footpath's own tile and the four tiles it can connect to.
+static constexpr size_t ProvisionalFootpathTileCount = 5;
+using ProvisionalFootpathTiles = std::array<std::vector<TileElement>, ProvisionalFootpathTileCount>;
+
+/**
+ * The tiles around the provisional footpath before and after it was last placed or removed by its game action. The
+ * provisional footpath is taken out and put back around the peep update every tick, as long as the tiles and settings
+ * are the same as last time the recorded result is written back instead of running the action again.
+ */
+struct ProvisionalFootpathDelta
+{
+    bool Valid;
+    ProvisionalFootpath Footpath;
+    uint32_t ParkFlags;
+    uint32_t ScreenFlags;
+    bool SandboxMode;
+    bool DisableClearanceChecks;
+    uint8_t GroundFlags;
+    money32 Cost;
+    ProvisionalFootpathTiles Before;
+    ProvisionalFootpathTiles After;
+};
+static ProvisionalFootpathDelta _provisionalFootpathPlaceDelta;
+static ProvisionalFootpathDelta _provisionalFootpathRemoveDelta;
+
 // This is the coordinates that a user of the bin should move to
 // rct2: 0x00992A4C
 const CoordsXY BinUseOffsets[4] = {
@@ -117,7 +147,7 @@ static bool entrance_has_direction(const EntranceElement& entranceElement, int32
 
 TileElement* map_get_footpath_element(const CoordsXYZ& coords)
 {
-    TileElement* tileElement = map_get_first_element_at(coords);
+    TileElement* tileElement = map_get_first_element_of_type(coords, TileElementType::Path);
     do
     {
         if (tileElement == nullptr)
@@ -143,6 +173,150 @@ money32 footpath_remove(const CoordsXYZ& footpathLoc, int32_t flags)
     return res.Cost;
 }
 
+static CoordsXY footpath_provisional_delta_tile(const CoordsXY& footpathPos, size_t index)
+{
+    return index == 0 ? footpathPos : footpathPos + CoordsDirectionDelta[index - 1];
+}
+
+/**
+ * Only footpaths that do not involve queues, entrances, banners or track are recorded, those reach out to ride state
+ * and tiles further away.
+ */
+static bool footpath_provisional_delta_allowed(const CoordsXY& footpathPos, PathConstructFlags constructFlags)
+{
+    if (constructFlags & PathConstructFlag::IsQueue)
+        return false;
+
+    for (size_t i = 0; i < ProvisionalFootpathTileCount; i++)
+    {
+        auto tilePos = footpath_provisional_delta_tile(footpathPos, i);
+        if (!map_is_location_valid(tilePos))
+            return false;
+
+        for (auto* tileElement : OpenRCT2::TileElementsView(tilePos))
+        {
+            switch (tileElement->GetType())
+            {
+                case TileElementType::Path:
+                    if (tileElement->AsPath()->IsQueue())
+                        return false;
+                    break;
+                case TileElementType::Entrance:
+                case TileElementType::Banner:
+                case TileElementType::Track:
+                    return false;
+                default:
+                    break;
+            }
+        }
+    }
+    return true;
+}
+
+static void footpath_provisional_delta_capture(const CoordsXY& footpathPos, ProvisionalFootpathTiles& tiles)
+{
+    for (size_t i = 0; i < ProvisionalFootpathTileCount; i++)
+    {
+        auto& elements = tiles[i];
+        elements.clear();
+        auto* tileElement = map_get_first_element_at(footpath_provisional_delta_tile(footpathPos, i));
+        if (tileElement == nullptr)
+            continue;
+        do
+        {
+            elements.push_back(*tileElement);
+        } while (!(tileElement++)->IsLastForTile());
+    }
+}
+
+static bool footpath_provisional_delta_tiles_match(const CoordsXY& footpathPos, const ProvisionalFootpathTiles& tiles)
+{
+    for (size_t i = 0; i < ProvisionalFootpathTileCount; i++)
+    {
+        const auto& elements = tiles[i];
+        auto* tileElement = map_get_first_element_at(footpath_provisional_delta_tile(footpathPos, i));
+        if (tileElement == nullptr)
+            return false;
+        for (size_t j = 0; j < elements.size(); j++)
+        {
+            if (std::memcmp(&tileElement[j], &elements[j], sizeof(TileElement)) != 0)
+                return false;
+            if (tileElement[j].IsLastForTile())
+                break;
+        }
+    }
+    return true;
+}
+
+static void footpath_provisional_delta_write(const CoordsXY& footpathPos, const ProvisionalFootpathTiles& tiles)
+{
+    for (size_t i = 0; i < ProvisionalFootpathTileCount; i++)
+    {
+        auto tilePos = footpath_provisional_delta_tile(footpathPos, i);
+        const auto& elements = tiles[i];
+
+        size_t numElements = 0;
+        auto* tileElement = map_get_first_element_at(tilePos);
+        do
+        {
+            numElements++;
+        } while (!(tileElement++)->IsLastForTile());
+
+        // Placing or removing a footpath only ever adds or takes away the path element itself.
+        for (; numElements < elements.size(); numElements++)
+        {
+            tile_element_insert({ tilePos, 0 }, 0, TileElementType::Surface);
+        }
+        for (; numElements > elements.size(); numElements--)
+        {
+            auto* lastElement = map_get_first_element_at(tilePos) + (numElements - 1);
+            tile_element_remove(lastElement);
+        }
+
+        std::memcpy(map_get_first_element_at(tilePos), elements.data(), elements.size() * sizeof(TileElement));
+        map_invalidate_tile_full(tilePos);
+    }
+    // The elements were rewritten in place, types included.
+    map_bump_elements_revision();
+}
+
+static bool footpath_provisional_delta_matches(const ProvisionalFootpathDelta& delta, const ProvisionalFootpath& footpath)
+{
+    return delta.Valid && delta.Footpath.Position == footpath.Position && delta.Footpath.Slope == footpath.Slope
+        && delta.Footpath.SurfaceIndex == footpath.SurfaceIndex && delta.Footpath.RailingsIndex == footpath.RailingsIndex
+        && delta.Footpath.ConstructFlags == footpath.ConstructFlags && delta.ParkFlags == gParkFlags
+        && delta.ScreenFlags == gScreenFlags && delta.SandboxMode == gCheatsSandboxMode
+        && delta.DisableClearanceChecks == gCheatsDisableClearanceChecks
+        && footpath_provisional_delta_tiles_match(footpath.Position, delta.Before);
+}
+
+static void footpath_provisional_delta_begin(ProvisionalFootpathDelta& delta, const ProvisionalFootpath& footpath)
+{
+    delta.Valid = footpath_provisional_delta_allowed(footpath.Position, footpath.ConstructFlags);
+    if (delta.Valid)
+    {
+        delta.Footpath = footpath;
+        delta.ParkFlags = gParkFlags;
+        delta.ScreenFlags = gScreenFlags;
+        delta.SandboxMode = gCheatsSandboxMode;
+        delta.DisableClearanceChecks = gCheatsDisableClearanceChecks;
+        footpath_provisional_delta_capture(footpath.Position, delta.Before);
+    }
+}
+
+static void footpath_provisional_delta_end(ProvisionalFootpathDelta& delta, bool success)
+{
+    if (delta.Valid && success)
+    {
+        delta.GroundFlags = gFootpathGroundFlags;
+        footpath_provisional_delta_capture(delta.Footpath.Position, delta.After);
+    }
+    else
+    {
+        delta.Valid = false;
+    }
+}
+
 /**
  *
  *  rct2: 0x006A76FF
@@ -155,11 +329,37 @@ money32 footpath_provisional_set(
 
     footpath_provisional_remove();
 
-    auto footpathPlaceAction = FootpathPlaceAction(footpathLoc, slope, type, railingsType, INVALID_DIRECTION, constructFlags);
-    footpathPlaceAction.SetFlags(GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED);
-    auto res = GameActions::Execute(&footpathPlaceAction);
-    cost = res.Error == GameActions::Status::Ok ? res.Cost : MONEY32_UNDEFINED;
-    if (res.Error == GameActions::Status::Ok)
+    ProvisionalFootpath footpath{};
+    footpath.SurfaceIndex = type;
+    footpath.RailingsIndex = railingsType;
+    footpath.Position = footpathLoc;
+    footpath.Slope = slope;
+    footpath.ConstructFlags = constructFlags;
+
+    auto& delta = _provisionalFootpathPlaceDelta;
+    bool placed;
+    if (footpath_provisional_delta_matches(delta, footpath))
+    {
+        footpath_provisional_delta_write(footpathLoc, delta.After);
+        gFootpathGroundFlags = delta.GroundFlags;
+        _currentTrackSelectionFlags |= TRACK_SELECTION_FLAG_RECHECK;
+        cost = delta.Cost;
+        placed = true;
+    }
+    else
+    {
+        footpath_provisional_delta_begin(delta, footpath);
+        auto footpathPlaceAction = FootpathPlaceAction(
+            footpathLoc, slope, type, railingsType, INVALID_DIRECTION, constructFlags);
+        footpathPlaceAction.SetFlags(GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED);
+        auto res = GameActions::Execute(&footpathPlaceAction);
+        placed = res.Error == GameActions::Status::Ok;
+        cost = placed ? res.Cost : MONEY32_UNDEFINED;
+        delta.Cost = cost;
+        footpath_provisional_delta_end(delta, placed);
+    }
+
+    if (placed)
     {
         gProvisionalFootpath.SurfaceIndex = type;
         gProvisionalFootpath.RailingsIndex = railingsType;
@@ -183,7 +383,7 @@ money32 footpath_provisional_set(
 
     if (!scenery_tool_is_active())
     {
-        if (res.Error != GameActions::Status::Ok)
+        if (!placed)
         {
             // If we can't build this, don't show a virtual floor.
             virtual_floor_set_height(0);
@@ -215,10 +415,30 @@ void footpath_provisional_remove()
     {
         gProvisionalFootpath.Flags &= ~PROVISIONAL_PATH_FLAG_1;
 
-        footpath_remove(
-            gProvisionalFootpath.Position,
-            GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_NO_SPEND
-                | GAME_COMMAND_FLAG_GHOST);
+        auto& delta = _provisionalFootpathRemoveDelta;
+        if (footpath_provisional_delta_matches(delta, gProvisionalFootpath))
+        {
+            const auto& footpathPos = gProvisionalFootpath.Position;
+            footpath_provisional_delta_write(footpathPos, delta.After);
+            if (delta.Before[0].size() != delta.After[0].size())
+            {
+                // Like the remove action, also take away a peep spawn on the tile.
+                gPeepSpawns.erase(
+                    std::remove_if(
+                        gPeepSpawns.begin(), gPeepSpawns.end(),
+                        [&footpathPos](const CoordsXYZ& spawn) { return spawn.ToTileStart() == footpathPos.ToTileStart(); }),
+                    gPeepSpawns.end());
+            }
+        }
+        else
+        {
+            footpath_provisional_delta_begin(delta, gProvisionalFootpath);
+            footpath_remove(
+                gProvisionalFootpath.Position,
+                GAME_COMMAND_FLAG_APPLY | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_NO_SPEND
+                    | GAME_COMMAND_FLAG_GHOST);
+            footpath_provisional_delta_end(delta, true);
+        }
     }
 }
 
@@ -1216,6 +1436,13 @@ void footpath_queue_chain_push(RideId rideIndex)
 {
     if (!rideIndex.IsNull())
     {
+        // Every queue edge touched while connecting a piece pushes its ride, chaining the same ride twice in a row
+        // only repeats the walk.
+        if (_footpathQueueChainNext > _footpathQueueChain && *(_footpathQueueChainNext - 1) == rideIndex)
+        {
+            return;
+        }
+
         auto* lastSlot = _footpathQueueChain + std::size(_footpathQueueChain) - 1;
         if (_footpathQueueChainNext <= lastSlot)
         {
@@ -21,6 +21,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/Numerics.hpp"
 #include "../interface/Cursors.h"
 #include "../interface/Window.h"
 #include "../localisation/Date.h"
@@ -29,6 +30,7 @@
 #include "../network/network.h"
 #include "../object/ObjectManager.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../peep/GuestPathfinding.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
@@ -53,6 +55,9 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <iterator>
 #include <memory>
 
@@ -116,6 +121,74 @@ static size_t _tileElementsInUseStash;
 static TileCoordsXY _mapSizeStash;
 static int32_t _currentRotationStash;
 
+// Tiles that map_update_tiles can pass over because visiting them would not change anything: the surface can not grow
+// grass and there is no small scenery or footpath on the tile. A bit is set when a visit finds such a tile and cleared
+// when an element is inserted on the tile or its surface style changes. Removing elements never gives a tile anything
+// to update, so that does not need to clear it.
+static std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _tileUpdateSkip;
+// The same for map_update_path_wide_flags, which only has work on tiles with footpaths.
+static std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _widePathUpdateSkip;
+static bool _tileUpdateSkipAny;
+
+// For each element type the tiles that may have an element of the type, built on first use and updated when elements
+// arrive on a tile. Bits are never cleared when elements are removed, so a set bit only means the tile has to be looked
+// at. Tiles are ordered column by column like tile_element_iterator visits them.
+static constexpr size_t TileTypeIndexTypes = 8;
+static constexpr size_t TileTypeIndexWords = (MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL + 63) / 64;
+static std::array<std::array<uint64_t, TileTypeIndexWords>, TileTypeIndexTypes> _tilesWithType;
+static bool _tilesWithTypeValid;
+
+// Bumped for a tile whenever it is invalidated, so caches derived from the contents of a tile can tell when to
+// recompute. The epoch changes whenever the whole map is replaced.
+static std::array<uint32_t, MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _tileChangeCounters;
+static uint32_t _tileChangeEpoch;
+
+// Bumped whenever elements may have moved or changed outside of the tile invalidation, which is not called for every
+// change. Starts at one so zero initialised cache entries never match.
+static uint32_t _elementsRevision = 1;
+static uint32_t _surfaceOwnershipRevision = 1;
+
+// A summary of the elements of each tile: the elements revision it was made at in the upper half, then a bit for each
+// element type on the tile and the offsets of the first surface, path and track element. Typed lookups use it to
+// return at once when the tile has no element of the type and to skip the elements before the first one. Elements are
+// looked up from the paint workers too, hence the atomics.
+static std::array<std::atomic<uint64_t>, MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _tileSummaries;
+static constexpr uint32_t TileSummaryTypesShift = 24;
+static constexpr size_t TileSummaryOffsetTypes = 3;
+// Also used when the offset does not fit, the lookup then scans from the first element of the tile.
+static constexpr uint8_t TileSummaryNoOffset = 0xFF;
+
+// Tiles invalidated since map_take_changed_tiles was last called, each tile is listed once. Once the list grows past
+// the limit it is dropped and the next call reports the whole map as changed instead.
+static constexpr size_t ChangedTilesLimit = 65536;
+static std::bitset<MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL> _changedTilesListed;
+static std::vector<TileCoordsXY> _changedTiles;
+static bool _changedTilesAll;
+
+static void map_reset_changed_tiles()
+{
+    for (const auto& tilePos : _changedTiles)
+    {
+        _changedTilesListed.reset(tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL + tilePos.x);
+    }
+    _changedTiles.clear();
+    _changedTilesAll = true;
+}
+
+static void map_reset_tile_updates()
+{
+    _tileChangeEpoch++;
+    _elementsRevision++;
+    _surfaceOwnershipRevision++;
+    _tilesWithTypeValid = false;
+    if (_tileUpdateSkipAny)
+    {
+        _tileUpdateSkip.reset();
+        _widePathUpdateSkip.reset();
+        _tileUpdateSkipAny = false;
+    }
+}
+
 void StashMap()
 {
     _tileIndexStash = std::move(_tileIndex);
@@ -123,6 +196,8 @@ void StashMap()
     _mapSizeStash = gMapSize;
     _currentRotationStash = gCurrentRotation;
     _tileElementsInUseStash = _tileElementsInUse;
+    map_reset_tile_updates();
+    map_reset_changed_tiles();
 }
 
 void UnstashMap()
@@ -132,6 +207,8 @@ void UnstashMap()
     gMapSize = _mapSizeStash;
     gCurrentRotation = _currentRotationStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    map_reset_tile_updates();
+    map_reset_changed_tiles();
 }
 
 const std::vector<TileElement>& GetTileElements()
@@ -139,11 +216,27 @@ const std::vector<TileElement>& GetTileElements()
     return _tileElements;
 }
 
-void SetTileElements(std::vector<TileElement>&& tileElements)
+static void SetTileElements(std::vector<TileElement>&& tileElements, TileLayout layout)
 {
     _tileElements = std::move(tileElements);
-    _tileIndex = TilePointerIndex<TileElement>(MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size());
+    _tileIndex = TilePointerIndex<TileElement>(
+        MAXIMUM_MAP_SIZE_TECHNICAL, _tileElements.data(), _tileElements.size(), layout);
     _tileElementsInUse = _tileElements.size();
+    map_reset_tile_updates();
+    map_reset_changed_tiles();
+}
+
+static std::vector<TileElement> GetTileElementsInLayout(size_t capacity, TileLayout layout);
+
+void SetTileElements(std::vector<TileElement>&& tileElements)
+{
+    SetTileElements(std::move(tileElements), TileLayout::Rows);
+
+    // Tile elements are always handed over row by row, rearrange them now if blocks are wanted.
+    if (gConfigGeneral.tile_block_layout)
+    {
+        SetTileElements(GetTileElementsInLayout(_tileElements.size(), TileLayout::Blocks), TileLayout::Blocks);
+    }
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -201,32 +294,35 @@ std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts()
     return newElements;
 }
 
-static void ReorganiseTileElements(size_t capacity)
+static std::vector<TileElement> GetTileElementsInLayout(size_t capacity, TileLayout layout)
 {
-    context_setcurrentcursor(CursorID::ZZZ);
-
     std::vector<TileElement> newElements;
     newElements.reserve(std::max(MIN_TILE_ELEMENTS, capacity));
-    for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
-    {
-        for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+    TilePointerIndex<TileElement>::ForEachTile(MAXIMUM_MAP_SIZE_TECHNICAL, layout, [&newElements](TileCoordsXY coords) {
+        const auto* element = map_get_first_element_at(coords);
+        if (element == nullptr)
         {
-            const auto* element = map_get_first_element_at(TileCoordsXY{ x, y });
-            if (element == nullptr)
-            {
-                newElements.push_back(GetDefaultSurfaceElement());
-            }
-            else
+            newElements.push_back(GetDefaultSurfaceElement());
+        }
+        else
+        {
+            do
             {
-                do
-                {
-                    newElements.push_back(*element);
-                } while (!(element++)->IsLastForTile());
-            }
+                newElements.push_back(*element);
+            } while (!(element++)->IsLastForTile());
         }
-    }
+    });
+    return newElements;
+}
 
-    SetTileElements(std::move(newElements));
+static void ReorganiseTileElements(size_t capacity)
+{
+    PROFILED_FUNCTION();
+
+    context_setcurrentcursor(CursorID::ZZZ);
+
+    auto layout = _tileIndex.GetLayout();
+    SetTileElements(GetTileElementsInLayout(capacity, layout), layout);
 }
 
 void ReorganiseTileElements()
@@ -379,25 +475,99 @@ void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    _elementsRevision++;
+    _surfaceOwnershipRevision++;
 }
 
-SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
+static size_t map_get_tile_update_index(const TileCoordsXY& tilePos);
+
+static uint64_t map_get_tile_summary(const TileCoordsXY& tilePos, const TileElement* firstElement)
+{
+    auto& summary = _tileSummaries[map_get_tile_update_index(tilePos)];
+    auto entry = summary.load(std::memory_order_relaxed);
+    if (static_cast<uint32_t>(entry >> 32) == _elementsRevision)
+    {
+        return entry;
+    }
+
+    uint32_t types = 0;
+    uint8_t offsets[TileSummaryOffsetTypes] = { TileSummaryNoOffset, TileSummaryNoOffset, TileSummaryNoOffset };
+    size_t offset = 0;
+    const auto* element = firstElement;
+    do
+    {
+        const auto type = EnumValue(element->GetType());
+        types |= 1u << type;
+        if (type < TileSummaryOffsetTypes && offsets[type] == TileSummaryNoOffset && offset < TileSummaryNoOffset)
+        {
+            offsets[type] = static_cast<uint8_t>(offset);
+        }
+        offset++;
+    } while (!(element++)->IsLastForTile());
+
+    entry = (static_cast<uint64_t>(_elementsRevision) << 32) | ((types & 0xFF) << TileSummaryTypesShift)
+        | (offsets[0] << 16) | (offsets[1] << 8) | offsets[2];
+    summary.store(entry, std::memory_order_relaxed);
+    return entry;
+}
+
+TileElement* map_get_first_element_of_type(const CoordsXY& coords, TileElementType type)
 {
-    auto view = TileElementsView<SurfaceElement>(coords);
+    const auto tilePos = TileCoordsXY{ coords };
+    auto* element = map_get_first_element_at(tilePos);
+    if (element == nullptr)
+    {
+        return nullptr;
+    }
 
-    return *view.begin();
+    // Elements neither move nor change type within a revision.
+    const auto summary = map_get_tile_summary(tilePos, element);
+    const auto typeIndex = EnumValue(type);
+    if ((summary & (1ull << (TileSummaryTypesShift + typeIndex))) == 0)
+    {
+        return nullptr;
+    }
+    if (typeIndex < TileSummaryOffsetTypes)
+    {
+        const auto offset = static_cast<uint8_t>(summary >> (8 * (TileSummaryOffsetTypes - 1 - typeIndex)));
+        if (offset != TileSummaryNoOffset)
+        {
+            return element + offset;
+        }
+    }
+
+    do
+    {
+        if (element->GetType() == type)
+        {
+            return element;
+        }
+    } while (!(element++)->IsLastForTile());
+    return nullptr;
+}
+
+SurfaceElement* map_get_surface_element_at(const CoordsXY& coords)
+{
+    auto* element = map_get_first_element_of_type(coords, TileElementType::Surface);
+    return element != nullptr ? element->AsSurface() : nullptr;
 }
 
 PathElement* map_get_path_element_at(const TileCoordsXYZ& loc)
 {
-    for (auto* element : TileElementsView<PathElement>(loc.ToCoordsXY()))
+    auto* tileElement = map_get_first_element_of_type(loc.ToCoordsXY(), TileElementType::Path);
+    if (tileElement == nullptr)
+        return nullptr;
+    do
     {
+        auto* element = tileElement->AsPath();
+        if (element == nullptr)
+            continue;
         if (element->IsGhost())
             continue;
         if (element->base_height != loc.z)
             continue;
         return element;
-    }
+    } while (!(tileElement++)->IsLastForTile());
     return nullptr;
 }
 
@@ -458,6 +628,26 @@ void map_init(const TileCoordsXY& size)
  * but haven't been bought yet. It updates gLandRemainingOwnershipSales and
  * gLandRemainingConstructionSales.
  */
+static void map_count_land_rights_for_sale(uint8_t flags, int32_t delta)
+{
+    // Counts loaded from a park may be off, do not let them wrap around.
+    auto count = [delta](uint32_t& sales) { sales = (delta < 0 && sales == 0) ? 0 : sales + delta; };
+
+    // Do not combine this condition with (flags & OWNERSHIP_AVAILABLE)
+    // As some RCT1 parks have owned tiles with the 'construction rights available' flag also set
+    if (!(flags & OWNERSHIP_OWNED))
+    {
+        if (flags & OWNERSHIP_AVAILABLE)
+        {
+            count(gLandRemainingOwnershipSales);
+        }
+        else if ((flags & OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE) && (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED) == 0)
+        {
+            count(gLandRemainingConstructionSales);
+        }
+    }
+}
+
 void map_count_remaining_land_rights()
 {
     gLandRemainingOwnershipSales = 0;
@@ -473,27 +663,18 @@ void map_count_remaining_land_rights()
             {
                 continue;
             }
-
-            uint8_t flags = surfaceElement->GetOwnership();
-
-            // Do not combine this condition with (flags & OWNERSHIP_AVAILABLE)
-            // As some RCT1 parks have owned tiles with the 'construction rights available' flag also set
-            if (!(flags & OWNERSHIP_OWNED))
-            {
-                if (flags & OWNERSHIP_AVAILABLE)
-                {
-                    gLandRemainingOwnershipSales++;
-                }
-                else if (
-                    (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_AVAILABLE) && (flags & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED) == 0)
-                {
-                    gLandRemainingConstructionSales++;
-                }
-            }
+            map_count_land_rights_for_sale(surfaceElement->GetOwnership(), 1);
         }
     }
 }
 
+void map_set_surface_ownership(SurfaceElement* surfaceElement, uint8_t ownership)
+{
+    map_count_land_rights_for_sale(surfaceElement->GetOwnership(), -1);
+    surfaceElement->SetOwnership(ownership);
+    map_count_land_rights_for_sale(ownership, 1);
+}
+
 /**
  * This is meant to strip TILE_ELEMENT_FLAG_GHOST flag from all elements when
  * importing a park.
@@ -722,10 +903,207 @@ bool map_coord_is_connected(const TileCoordsXYZ& loc, uint8_t faceDirection)
     return false;
 }
 
+static size_t map_get_tile_update_index(const TileCoordsXY& tilePos)
+{
+    return tilePos.y * MAXIMUM_MAP_SIZE_TECHNICAL + tilePos.x;
+}
+
+static void map_add_changed_tile(const TileCoordsXY& tilePos, size_t index)
+{
+    if (_changedTilesAll || _changedTilesListed[index])
+    {
+        return;
+    }
+    if (_changedTiles.size() >= ChangedTilesLimit)
+    {
+        map_reset_changed_tiles();
+        return;
+    }
+    _changedTilesListed.set(index);
+    _changedTiles.push_back(tilePos);
+}
+
+bool map_take_changed_tiles(std::vector<TileCoordsXY>& tiles)
+{
+    tiles.clear();
+    if (_changedTilesAll)
+    {
+        _changedTilesAll = false;
+        return false;
+    }
+    for (const auto& tilePos : _changedTiles)
+    {
+        _changedTilesListed.reset(map_get_tile_update_index(tilePos));
+    }
+    tiles.swap(_changedTiles);
+    return true;
+}
+
+static size_t map_get_tile_type_index(const TileCoordsXY& tilePos)
+{
+    return tilePos.x * MAXIMUM_MAP_SIZE_TECHNICAL + tilePos.y;
+}
+
+static void map_index_tile_element_types(const TileCoordsXY& tilePos)
+{
+    const auto* element = map_get_first_element_at(tilePos);
+    if (element == nullptr)
+    {
+        return;
+    }
+
+    const auto index = map_get_tile_type_index(tilePos);
+    do
+    {
+        const auto type = EnumValue(element->GetType());
+        if (type < TileTypeIndexTypes)
+        {
+            _tilesWithType[type][index / 64] |= uint64_t{ 1 } << (index % 64);
+        }
+    } while (!(element++)->IsLastForTile());
+}
+
+static void map_ensure_tile_type_index()
+{
+    if (_tilesWithTypeValid)
+    {
+        return;
+    }
+
+    for (auto& tiles : _tilesWithType)
+    {
+        tiles.fill(0);
+    }
+    for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+    {
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            map_index_tile_element_types({ x, y });
+        }
+    }
+    _tilesWithTypeValid = true;
+}
+
+void map_invalidate_tile_updates(const CoordsXY& loc)
+{
+    auto tilePos = TileCoordsXY{ loc };
+    if (IsTileLocationValid(tilePos))
+    {
+        auto index = map_get_tile_update_index(tilePos);
+        _tileUpdateSkip.reset(index);
+        _widePathUpdateSkip.reset(index);
+        if (_tilesWithTypeValid)
+        {
+            map_index_tile_element_types(tilePos);
+        }
+        _tileChangeCounters[index]++;
+        map_add_changed_tile(tilePos, index);
+    }
+    _elementsRevision++;
+    _surfaceOwnershipRevision++;
+}
+
+bool map_tile_may_have_track(const CoordsXY& loc)
+{
+    auto tilePos = TileCoordsXY{ loc };
+    if (!IsTileLocationValid(tilePos))
+    {
+        return false;
+    }
+
+    map_ensure_tile_type_index();
+    const auto index = map_get_tile_type_index(tilePos);
+    return (_tilesWithType[EnumValue(TileElementType::Track)][index / 64] >> (index % 64)) & 1;
+}
+
+void map_for_each_tile_with_element_types(uint32_t typeMask, TileVisitFn fn, void* ctx)
+{
+    map_ensure_tile_type_index();
+    for (size_t word = 0; word < TileTypeIndexWords; word++)
+    {
+        uint64_t bits = 0;
+        for (size_t type = 0; type < TileTypeIndexTypes; type++)
+        {
+            if (typeMask & (1u << type))
+            {
+                bits |= _tilesWithType[type][word];
+            }
+        }
+        while (bits != 0)
+        {
+            const auto index = word * 64 + Numerics::ctz64(bits);
+            bits &= bits - 1;
+            fn(ctx,
+               TileCoordsXY{ static_cast<int32_t>(index / MAXIMUM_MAP_SIZE_TECHNICAL),
+                             static_cast<int32_t>(index % MAXIMUM_MAP_SIZE_TECHNICAL) });
+        }
+    }
+}
+
+static void map_bump_tile_change_counter(const CoordsXY& loc)
+{
+    auto tilePos = TileCoordsXY{ loc };
+    if (IsTileLocationValid(tilePos))
+    {
+        auto index = map_get_tile_update_index(tilePos);
+        _tileChangeCounters[index]++;
+        map_add_changed_tile(tilePos, index);
+    }
+}
+
+uint64_t map_get_tile_change_stamp(const CoordsXY& loc)
+{
+    uint64_t stamp = static_cast<uint64_t>(_tileChangeEpoch) << 32;
+    auto tilePos = TileCoordsXY{ loc };
+    if (IsTileLocationValid(tilePos))
+    {
+        stamp |= _tileChangeCounters[map_get_tile_update_index(tilePos)];
+    }
+    return stamp;
+}
+
+uint32_t map_get_elements_revision()
+{
+    return _elementsRevision;
+}
+
+void map_bump_elements_revision()
+{
+    _elementsRevision++;
+}
+
+uint32_t map_get_surface_ownership_revision()
+{
+    return _surfaceOwnershipRevision;
+}
+
+void map_bump_surface_ownership_revision()
+{
+    _surfaceOwnershipRevision++;
+}
+
 /**
  *
  *  rct2: 0x006A876D
  */
+/**
+ * Returns a mask with a bit set for each wide path element on the tile, by element order.
+ */
+static uint32_t map_get_path_wide_mask(const CoordsXY& loc)
+{
+    uint32_t mask = 0;
+    uint32_t bit = 1;
+    for (auto* pathElement : TileElementsView<PathElement>(loc))
+    {
+        if (pathElement->IsWide())
+        {
+            mask |= bit;
+        }
+        bit <<= 1;
+    }
+    return mask;
+}
+
 void map_update_path_wide_flags()
 {
     PROFILED_FUNCTION();
@@ -740,9 +1118,28 @@ void map_update_path_wide_flags()
     // progress. A maximum of 128 calls is done per update.
     auto x = gWidePathTileLoopPosition.x;
     auto y = gWidePathTileLoopPosition.y;
+    bool wideFlagsChanged = false;
     for (int32_t i = 0; i < 128; i++)
     {
-        footpath_update_path_wide_flags({ x, y });
+        // Tiles without footpaths are left alone by footpath_update_path_wide_flags, passing over them keeps the
+        // sweep and its results the same.
+        auto tilePos = TileCoordsXY{ CoordsXY{ x, y } };
+        auto skipIndex = map_get_tile_update_index(tilePos);
+        if (!_widePathUpdateSkip[skipIndex])
+        {
+            auto pathElements = TileElementsView<PathElement>({ x, y });
+            if (pathElements.begin() == pathElements.end())
+            {
+                _widePathUpdateSkip.set(skipIndex);
+                _tileUpdateSkipAny = true;
+            }
+            else
+            {
+                auto wideMask = map_get_path_wide_mask({ x, y });
+                footpath_update_path_wide_flags({ x, y });
+                wideFlagsChanged = wideFlagsChanged || map_get_path_wide_mask({ x, y }) != wideMask;
+            }
+        }
 
         // Next x, y tile
         x += COORDS_XY_STEP;
@@ -758,6 +1155,12 @@ void map_update_path_wide_flags()
     }
     gWidePathTileLoopPosition.x = x;
     gWidePathTileLoopPosition.y = y;
+
+    // Cached path segments and junctions depend on the wide flags.
+    if (wideFlagsChanged)
+    {
+        PathfindInvalidateCaches();
+    }
 }
 
 /**
@@ -1099,6 +1502,8 @@ void tile_element_remove(TileElement* tileElement)
     (tileElement - 1)->SetLastForTile(true);
     tileElement->base_height = MAX_ELEMENT_HEIGHT;
     _tileElementsInUse--;
+    _elementsRevision++;
+    _surfaceOwnershipRevision++;
     if (tileElement == &_tileElements.back())
     {
         _tileElements.pop_back();
@@ -1111,34 +1516,43 @@ void tile_element_remove(TileElement* tileElement)
  */
 void map_remove_all_rides()
 {
-    tile_element_iterator it;
-
-    tile_element_iterator_begin(&it);
-    do
-    {
-        switch (it.element->GetType())
+    constexpr uint32_t rideElementTypes = (1u << EnumValue(TileElementType::Path))
+        | (1u << EnumValue(TileElementType::Entrance)) | (1u << EnumValue(TileElementType::Track));
+    ForEachTileWithElementTypes(rideElementTypes, [](const TileCoordsXY& tilePos) {
+        auto* tileElement = map_get_first_element_at(tilePos);
+        while (tileElement != nullptr)
         {
-            case TileElementType::Path:
-                if (it.element->AsPath()->IsQueue())
-                {
-                    it.element->AsPath()->SetHasQueueBanner(false);
-                    it.element->AsPath()->SetRideIndex(RideId::GetNull());
-                }
-                break;
-            case TileElementType::Entrance:
-                if (it.element->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE)
+            bool removed = false;
+            switch (tileElement->GetType())
+            {
+                case TileElementType::Path:
+                    if (tileElement->AsPath()->IsQueue())
+                    {
+                        tileElement->AsPath()->SetHasQueueBanner(false);
+                        tileElement->AsPath()->SetRideIndex(RideId::GetNull());
+                    }
                     break;
-                [[fallthrough]];
-            case TileElementType::Track:
-                footpath_queue_chain_reset();
-                footpath_remove_edges_at(TileCoordsXY{ it.x, it.y }.ToCoordsXY(), it.element);
-                tile_element_remove(it.element);
-                tile_element_iterator_restart_for_tile(&it);
-                break;
-            default:
-                break;
+                case TileElementType::Entrance:
+                    if (tileElement->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE)
+                        break;
+                    [[fallthrough]];
+                case TileElementType::Track:
+                    footpath_queue_chain_reset();
+                    footpath_remove_edges_at(tilePos.ToCoordsXY(), tileElement);
+                    tile_element_remove(tileElement);
+                    removed = true;
+                    break;
+                default:
+                    break;
+            }
+
+            // Start over on the tile after a removal, like tile_element_iterator_restart_for_tile.
+            if (removed)
+                tileElement = map_get_first_element_at(tilePos);
+            else
+                tileElement = tileElement->IsLastForTile() ? nullptr : tileElement + 1;
         }
-    } while (tile_element_iterator_next(&it));
+    });
 }
 
 /**
@@ -1232,6 +1646,60 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
     return &_tileElements[oldSize];
 }
 
+static void InitialiseInsertedTileElement(
+    TileElement* tileElement, const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type, bool isLastForTile)
+{
+    tileElement->type = 0;
+    tileElement->SetType(type);
+    tileElement->SetBaseZ(loc.z);
+    tileElement->Flags = 0;
+    tileElement->SetLastForTile(isLastForTile);
+    tileElement->SetOccupiedQuadrants(occupiedQuadrants);
+    tileElement->SetClearanceZ(loc.z);
+    tileElement->owner = 0;
+    std::memset(&tileElement->pad_05, 0, sizeof(tileElement->pad_05));
+    std::memset(&tileElement->pad_08, 0, sizeof(tileElement->pad_08));
+}
+
+/**
+ * Inserts the element without moving the tile when its elements are the last ones in use, as they are right after
+ * the tile has been moved by a previous insert. Returns nullptr if the tile can not grow in place.
+ */
+static TileElement* tile_element_insert_in_place(
+    TileElement* firstElement, size_t numElementsOnTile, const CoordsXYZ& loc, int32_t occupiedQuadrants,
+    TileElementType type)
+{
+    if (firstElement == nullptr || firstElement + numElementsOnTile != _tileElements.data() + _tileElements.size())
+        return nullptr;
+
+    // Growing within the capacity keeps all element pointers valid.
+    if (_tileElements.size() >= _tileElements.capacity() || _tileElementsInUse + 1 > MAX_TILE_ELEMENTS)
+        return nullptr;
+
+    _tileElements.emplace_back();
+    _tileElementsInUse++;
+
+    size_t insertIndex = 0;
+    while (insertIndex < numElementsOnTile && loc.z >= firstElement[insertIndex].GetBaseZ())
+    {
+        insertIndex++;
+    }
+
+    bool isLastForTile = insertIndex == numElementsOnTile;
+    if (isLastForTile)
+    {
+        firstElement[insertIndex - 1].SetLastForTile(false);
+    }
+    for (size_t i = numElementsOnTile; i > insertIndex; i--)
+    {
+        firstElement[i] = firstElement[i - 1];
+    }
+
+    auto* insertedElement = &firstElement[insertIndex];
+    InitialiseInsertedTileElement(insertedElement, loc, occupiedQuadrants, type, isLastForTile);
+    return insertedElement;
+}
+
 /**
  *
  *  rct2: 0x0068B1F6
@@ -1241,6 +1709,14 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     const auto& tileLoc = TileCoordsXYZ(loc);
 
     auto numElementsOnTileOld = CountElementsOnTile(loc);
+    auto* insertedInPlace = tile_element_insert_in_place(
+        _tileIndex.GetFirstElementAt(tileLoc), numElementsOnTileOld, loc, occupiedQuadrants, type);
+    if (insertedInPlace != nullptr)
+    {
+        map_invalidate_tile_updates(loc);
+        return insertedInPlace;
+    }
+
     auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
     auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
     if (newTileElement == nullptr)
@@ -1277,18 +1753,11 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
         }
     }
 
+    map_invalidate_tile_updates(loc);
+
     // Insert new map element
     auto* insertedElement = newTileElement;
-    newTileElement->type = 0;
-    newTileElement->SetType(type);
-    newTileElement->SetBaseZ(loc.z);
-    newTileElement->Flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->SetClearanceZ(loc.z);
-    newTileElement->owner = 0;
-    std::memset(&newTileElement->pad_05, 0, sizeof(newTileElement->pad_05));
-    std::memset(&newTileElement->pad_08, 0, sizeof(newTileElement->pad_08));
+    InitialiseInsertedTileElement(newTileElement, loc, occupiedQuadrants, type, isLastForTile);
     newTileElement++;
 
     // Insert rest of map elements above insert height
@@ -1307,6 +1776,25 @@ TileElement* tile_element_insert(const CoordsXYZ& loc, int32_t occupiedQuadrants
     return insertedElement;
 }
 
+/**
+ * Whether map_update_tiles has any work on the tile. This has to stay in line with everything that
+ * SurfaceElement::UpdateGrassLength and scenery_update_tile look at, footpaths are counted regardless of their addition
+ * as additions are changed in place.
+ */
+static bool map_tile_has_updates(const SurfaceElement& surfaceElement, const CoordsXY& loc)
+{
+    if (surfaceElement.CanGrassGrow())
+        return true;
+
+    for (auto* tileElement : TileElementsView(loc))
+    {
+        auto type = tileElement->GetType();
+        if (type == TileElementType::SmallScenery || type == TileElementType::Path)
+            return true;
+    }
+    return false;
+}
+
 /**
  * Updates grass length, scenery age and jumping fountains.
  *
@@ -1318,7 +1806,11 @@ void map_update_tiles()
 
     int32_t ignoreScreenFlags = SCREEN_FLAGS_SCENARIO_EDITOR | SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER;
     if (gScreenFlags & ignoreScreenFlags)
+    {
+        // The editors change surfaces without going through the usual paths.
+        map_reset_tile_updates();
         return;
+    }
 
     // Update 43 more tiles (for each 256x256 block)
     for (int32_t j = 0; j < 43; j++)
@@ -1340,10 +1832,21 @@ void map_update_tiles()
         {
             for (int32_t blockX = 0; blockX < gMapSize.x; blockX += 256)
             {
-                auto mapPos = TileCoordsXY{ blockX + x, blockY + y }.ToCoordsXY();
+                auto tilePos = TileCoordsXY{ blockX + x, blockY + y };
+                auto skipIndex = map_get_tile_update_index(tilePos);
+                if (_tileUpdateSkip[skipIndex])
+                    continue;
+
+                auto mapPos = tilePos.ToCoordsXY();
                 auto* surfaceElement = map_get_surface_element_at(mapPos);
                 if (surfaceElement != nullptr)
                 {
+                    if (!map_tile_has_updates(*surfaceElement, mapPos))
+                    {
+                        _tileUpdateSkip.set(skipIndex);
+                        _tileUpdateSkipAny = true;
+                        continue;
+                    }
                     surfaceElement->UpdateGrassLength(mapPos);
                     scenery_update_tile(mapPos);
                 }
@@ -1492,6 +1995,7 @@ void map_extend_boundary_surface_y()
         if (existingTileElement != nullptr && newTileElement != nullptr)
         {
             map_extend_boundary_surface_extend_tile(*existingTileElement, *newTileElement);
+            map_invalidate_tile_updates(TileCoordsXY{ x, y }.ToCoordsXY());
         }
 
         update_park_fences({ x << 5, y << 5 });
@@ -1511,6 +2015,7 @@ void map_extend_boundary_surface_x()
         if (existingTileElement != nullptr && newTileElement != nullptr)
         {
             map_extend_boundary_surface_extend_tile(*existingTileElement, *newTileElement);
+            map_invalidate_tile_updates(TileCoordsXY{ x, y }.ToCoordsXY());
         }
         update_park_fences({ x << 5, y << 5 });
     }
@@ -1674,7 +2179,7 @@ LargeSceneryElement* map_get_large_scenery_segment(const CoordsXYZD& sceneryPos,
 EntranceElement* map_get_park_entrance_element_at(const CoordsXYZ& entranceCoords, bool ghost)
 {
     auto entranceTileCoords = TileCoordsXYZ(entranceCoords);
-    TileElement* tileElement = map_get_first_element_at(entranceCoords);
+    TileElement* tileElement = map_get_first_element_of_type(entranceCoords, TileElementType::Entrance);
     if (tileElement != nullptr)
     {
         do
@@ -1700,7 +2205,7 @@ EntranceElement* map_get_park_entrance_element_at(const CoordsXYZ& entranceCoord
 EntranceElement* map_get_ride_entrance_element_at(const CoordsXYZ& entranceCoords, bool ghost)
 {
     auto entranceTileCoords = TileCoordsXYZ{ entranceCoords };
-    TileElement* tileElement = map_get_first_element_at(entranceCoords);
+    TileElement* tileElement = map_get_first_element_of_type(entranceCoords, TileElementType::Entrance);
     if (tileElement != nullptr)
     {
         do
@@ -1726,7 +2231,7 @@ EntranceElement* map_get_ride_entrance_element_at(const CoordsXYZ& entranceCoord
 EntranceElement* map_get_ride_exit_element_at(const CoordsXYZ& exitCoords, bool ghost)
 {
     auto exitTileCoords = TileCoordsXYZ{ exitCoords };
-    TileElement* tileElement = map_get_first_element_at(exitCoords);
+    TileElement* tileElement = map_get_first_element_of_type(exitCoords, TileElementType::Entrance);
     if (tileElement != nullptr)
     {
         do
@@ -1846,11 +2351,51 @@ ScreenCoordsXY translate_3d_to_2d_with_z(int32_t rotation, const CoordsXYZ& pos)
     return ScreenCoordsXY{ rotated.y - rotated.x, ((rotated.x + rotated.y) >> 1) - pos.z };
 }
 
-static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
+static int32_t _invalidationScopeDepth;
+static bool _invalidationScopeAny;
+static CoordsXY _invalidationScopeMin;
+static CoordsXY _invalidationScopeMax;
+static int32_t _invalidationScopeMinZ;
+static int32_t _invalidationScopeMaxZ;
+
+static void map_invalidate_region_z(const CoordsXY& mins, const CoordsXY& maxs, int32_t z0, int32_t z1)
+{
+    int32_t left, right, top, bottom;
+    map_get_bounding_box({ mins.x + 16, mins.y + 16, maxs.x + 16, maxs.y + 16 }, &left, &top, &right, &bottom);
+
+    left -= 32;
+    right += 32;
+    bottom += 32 - z0;
+    top -= 32 + z1;
+
+    viewports_invalidate({ { left, top }, { right, bottom } });
+}
+
+static void map_invalidate_tile_screen_rect(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
 {
     if (gOpenRCT2Headless)
         return;
 
+    if (_invalidationScopeDepth > 0)
+    {
+        if (!_invalidationScopeAny)
+        {
+            _invalidationScopeAny = true;
+            _invalidationScopeMin = { x, y };
+            _invalidationScopeMax = { x, y };
+            _invalidationScopeMinZ = z0;
+            _invalidationScopeMaxZ = z1;
+        }
+        else
+        {
+            _invalidationScopeMin = { std::min(_invalidationScopeMin.x, x), std::min(_invalidationScopeMin.y, y) };
+            _invalidationScopeMax = { std::max(_invalidationScopeMax.x, x), std::max(_invalidationScopeMax.y, y) };
+            _invalidationScopeMinZ = std::min(_invalidationScopeMinZ, z0);
+            _invalidationScopeMaxZ = std::max(_invalidationScopeMaxZ, z1);
+        }
+        return;
+    }
+
     int32_t x1, y1, x2, y2;
 
     x += 16;
@@ -1865,6 +2410,12 @@ static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int
     viewports_invalidate({ { x1, y1 }, { x2, y2 } }, maxZoom);
 }
 
+static void map_invalidate_tile_under_zoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
+{
+    map_bump_tile_change_counter({ x, y });
+    map_invalidate_tile_screen_rect(x, y, z0, z1, maxZoom);
+}
+
 /**
  *
  *  rct2: 0x006EC847
@@ -1883,6 +2434,14 @@ void map_invalidate_tile_zoom1(const CoordsXYRangedZ& tilePos)
     map_invalidate_tile_under_zoom(tilePos.x, tilePos.y, tilePos.baseZ, tilePos.clearanceZ, ZoomLevel{ 1 });
 }
 
+/**
+ * Redraws the next frame of an animation like map_invalidate_tile_zoom1, without counting it as a change to the tile.
+ */
+void map_invalidate_tile_animation_zoom1(const CoordsXYRangedZ& tilePos)
+{
+    map_invalidate_tile_screen_rect(tilePos.x, tilePos.y, tilePos.baseZ, tilePos.clearanceZ, ZoomLevel{ 1 });
+}
+
 /**
  *
  *  rct2: 0x006EC9CE
@@ -1908,22 +2467,23 @@ void map_invalidate_element(const CoordsXY& elementPos, TileElement* tileElement
 
 void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs)
 {
-    int32_t x0, y0, x1, y1, left, right, top, bottom;
-
-    x0 = mins.x + 16;
-    y0 = mins.y + 16;
-
-    x1 = maxs.x + 16;
-    y1 = maxs.y + 16;
-
-    map_get_bounding_box({ x0, y0, x1, y1 }, &left, &top, &right, &bottom);
+    map_invalidate_region_z(mins, maxs, 0, 2080);
+}
 
-    left -= 32;
-    right += 32;
-    bottom += 32;
-    top -= 32 + 2080;
+MapInvalidationScope::MapInvalidationScope()
+{
+    _invalidationScopeDepth++;
+}
 
-    viewports_invalidate({ { left, top }, { right, bottom } });
+MapInvalidationScope::~MapInvalidationScope()
+{
+    _invalidationScopeDepth--;
+    if (_invalidationScopeDepth == 0 && _invalidationScopeAny)
+    {
+        _invalidationScopeAny = false;
+        map_invalidate_region_z(
+            _invalidationScopeMin, _invalidationScopeMax, _invalidationScopeMinZ, _invalidationScopeMaxZ);
+    }
 }
 
 int32_t map_get_tile_side(const CoordsXY& mapPos)
@@ -2010,7 +2570,7 @@ void map_clear_all_elements()
  */
 TrackElement* map_get_track_element_at(const CoordsXYZ& trackPos)
 {
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = map_get_first_element_of_type(trackPos, TileElementType::Track);
     if (tileElement == nullptr)
         return nullptr;
     do
@@ -2034,7 +2594,7 @@ TrackElement* map_get_track_element_at(const CoordsXYZ& trackPos)
  */
 TileElement* map_get_track_element_at_of_type(const CoordsXYZ& trackPos, track_type_t trackType)
 {
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = map_get_first_element_of_type(trackPos, TileElementType::Track);
     if (tileElement == nullptr)
         return nullptr;
     auto trackTilePos = TileCoordsXYZ{ trackPos };
@@ -2061,7 +2621,7 @@ TileElement* map_get_track_element_at_of_type(const CoordsXYZ& trackPos, track_t
  */
 TileElement* map_get_track_element_at_of_type_seq(const CoordsXYZ& trackPos, track_type_t trackType, int32_t sequence)
 {
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = map_get_first_element_of_type(trackPos, TileElementType::Track);
     auto trackTilePos = TileCoordsXYZ{ trackPos };
     do
     {
@@ -2084,7 +2644,7 @@ TileElement* map_get_track_element_at_of_type_seq(const CoordsXYZ& trackPos, tra
 
 TrackElement* map_get_track_element_at_of_type(const CoordsXYZD& location, track_type_t trackType)
 {
-    auto tileElement = map_get_first_element_at(location);
+    auto tileElement = map_get_first_element_of_type(location, TileElementType::Track);
     if (tileElement != nullptr)
     {
         do
@@ -2107,7 +2667,7 @@ TrackElement* map_get_track_element_at_of_type(const CoordsXYZD& location, track
 
 TrackElement* map_get_track_element_at_of_type_seq(const CoordsXYZD& location, track_type_t trackType, int32_t sequence)
 {
-    auto tileElement = map_get_first_element_at(location);
+    auto tileElement = map_get_first_element_of_type(location, TileElementType::Track);
     if (tileElement != nullptr)
     {
         do
@@ -2138,7 +2698,7 @@ TrackElement* map_get_track_element_at_of_type_seq(const CoordsXYZD& location, t
  */
 TileElement* map_get_track_element_at_of_type_from_ride(const CoordsXYZ& trackPos, track_type_t trackType, RideId rideIndex)
 {
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = map_get_first_element_of_type(trackPos, TileElementType::Track);
     if (tileElement == nullptr)
         return nullptr;
     auto trackTilePos = TileCoordsXYZ{ trackPos };
@@ -2167,7 +2727,7 @@ TileElement* map_get_track_element_at_of_type_from_ride(const CoordsXYZ& trackPo
  */
 TileElement* map_get_track_element_at_from_ride(const CoordsXYZ& trackPos, RideId rideIndex)
 {
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = map_get_first_element_of_type(trackPos, TileElementType::Track);
     if (tileElement == nullptr)
         return nullptr;
     auto trackTilePos = TileCoordsXYZ{ trackPos };
@@ -2195,7 +2755,7 @@ TileElement* map_get_track_element_at_from_ride(const CoordsXYZ& trackPos, RideI
  */
 TileElement* map_get_track_element_at_with_direction_from_ride(const CoordsXYZD& trackPos, RideId rideIndex)
 {
-    TileElement* tileElement = map_get_first_element_at(trackPos);
+    TileElement* tileElement = map_get_first_element_of_type(trackPos, TileElementType::Track);
     if (tileElement == nullptr)
         return nullptr;
     auto trackTilePos = TileCoordsXYZ{ trackPos };
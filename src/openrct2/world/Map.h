@@ -155,9 +155,19 @@ std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 void map_init(const TileCoordsXY& size);
 
 void map_count_remaining_land_rights();
+/**
+ * Sets the ownership of a surface found by map_get_surface_element_at and updates the remaining land rights sales to
+ * match, without counting them on the whole map again.
+ */
+void map_set_surface_ownership(SurfaceElement* surfaceElement, uint8_t ownership);
 void map_strip_ghost_flag_from_elements();
 TileElement* map_get_first_element_at(const CoordsXY& tilePos);
 TileElement* map_get_first_element_at(const TileCoordsXY& tilePos);
+/**
+ * Returns the first element of the given type on the tile or nullptr if there is none, lookups for an element of the
+ * type can scan from there.
+ */
+TileElement* map_get_first_element_of_type(const CoordsXY& coords, TileElementType type);
 TileElement* map_get_nth_element_at(const CoordsXY& coords, int32_t n);
 void map_set_tile_element(const TileCoordsXY& tilePos, TileElement* elements);
 int32_t map_height_from_slope(const CoordsXY& coords, int32_t slopeDirection, bool isSloped);
@@ -213,6 +223,32 @@ int32_t tile_element_iterator_next(tile_element_iterator* it);
 void tile_element_iterator_restart_for_tile(tile_element_iterator* it);
 
 void map_update_tiles();
+// Has the map_update_tiles and map_update_path_wide_flags sweeps look at the tile again, needed when its surface style
+// changes or elements are replaced in place.
+void map_invalidate_tile_updates(const CoordsXY& loc);
+// False only if there is no track element on the tile, true does not guarantee there is one.
+bool map_tile_may_have_track(const CoordsXY& loc);
+
+using TileVisitFn = void (*)(void* ctx, const TileCoordsXY& tilePos);
+/**
+ * Calls fn for every tile that may have an element of one of the types in typeMask, a bit for each TileElementType. The
+ * tiles come from an index instead of searching the map and are visited in the order of tile_element_iterator. Tiles
+ * may be visited that no longer have such an element, fn can remove elements but must not insert any.
+ */
+void map_for_each_tile_with_element_types(uint32_t typeMask, TileVisitFn fn, void* ctx);
+// Changes whenever the tile is invalidated or the map is replaced.
+uint64_t map_get_tile_change_stamp(const CoordsXY& loc);
+// Changes whenever elements are inserted, removed or moved, the map is replaced or a game action has been executed.
+// Caches that hold element pointers or are derived from element contents can be kept for as long as it stays the same.
+uint32_t map_get_elements_revision();
+void map_bump_elements_revision();
+// Changes whenever the ownership of a surface is set, elements are inserted or removed or the map is replaced, so the
+// owned land only has to be counted again after it has changed.
+uint32_t map_get_surface_ownership_revision();
+void map_bump_surface_ownership_revision();
+// Moves the tiles invalidated since the last call into tiles. Returns false with no tiles if the whole map has to be
+// treated as changed instead. Intended for a single consumer, the map window.
+bool map_take_changed_tiles(std::vector<TileCoordsXY>& tiles);
 int32_t map_get_highest_z(const CoordsXY& loc);
 
 bool tile_element_wants_path_connection_towards(const TileCoordsXYZD& coords, const TileElement* const elementToBeRemoved);
@@ -228,11 +264,25 @@ void wall_remove_intersecting_walls(const CoordsXYRangedZ& wallPos, Direction di
 
 void map_invalidate_tile(const CoordsXYRangedZ& tilePos);
 void map_invalidate_tile_zoom1(const CoordsXYRangedZ& tilePos);
+void map_invalidate_tile_animation_zoom1(const CoordsXYRangedZ& tilePos);
 void map_invalidate_tile_zoom0(const CoordsXYRangedZ& tilePos);
 void map_invalidate_tile_full(const CoordsXY& tilePos);
 void map_invalidate_element(const CoordsXY& elementPos, TileElement* tileElement);
 void map_invalidate_region(const CoordsXY& mins, const CoordsXY& maxs);
 
+/**
+ * While an instance is alive the tile invalidations only record the tiles as changed and grow a bounding box. The box
+ * is invalidated on screen once when the outermost instance is destroyed, rather than once for every tile.
+ */
+class MapInvalidationScope
+{
+public:
+    MapInvalidationScope();
+    ~MapInvalidationScope();
+    MapInvalidationScope(const MapInvalidationScope&) = delete;
+    MapInvalidationScope& operator=(const MapInvalidationScope&) = delete;
+};
+
 int32_t map_get_tile_side(const CoordsXY& mapPos);
 int32_t map_get_tile_quadrant(const CoordsXY& mapPos);
 int32_t map_get_corner_height(int32_t z, int32_t slope, int32_t direction);
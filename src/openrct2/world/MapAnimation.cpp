@@ -27,9 +27,36 @@
 #include "Scenery.h"
 #include "SmallScenery.h"
 
+#include <unordered_set>
+
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
+namespace
+{
+    struct MapAnimationHash
+    {
+        size_t operator()(const MapAnimation& a) const
+        {
+            auto hash = static_cast<size_t>(a.type);
+            hash = hash * 31 + static_cast<size_t>(a.location.x);
+            hash = hash * 31 + static_cast<size_t>(a.location.y);
+            hash = hash * 31 + static_cast<size_t>(a.location.z);
+            return hash;
+        }
+    };
+
+    struct MapAnimationEqual
+    {
+        bool operator()(const MapAnimation& lhs, const MapAnimation& rhs) const
+        {
+            return lhs.type == rhs.type && lhs.location == rhs.location;
+        }
+    };
+} // namespace
+
+// The vector keeps the order the animations are invalidated in, the set mirrors it for the existence checks.
 static std::vector<MapAnimation> _mapAnimations;
+static std::unordered_set<MapAnimation, MapAnimationHash, MapAnimationEqual> _mapAnimationSet;
 
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
@@ -37,15 +64,7 @@ static bool InvalidateMapAnimation(const MapAnimation& obj);
 
 static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
-    {
-        if (a.type == type && a.location == location)
-        {
-            // Animation already exists
-            return true;
-        }
-    }
-    return false;
+    return _mapAnimationSet.find({ static_cast<uint8_t>(type), location }) != _mapAnimationSet.end();
 }
 
 void map_animation_create(int32_t type, const CoordsXYZ& loc)
@@ -56,6 +75,7 @@ void map_animation_create(int32_t type, const CoordsXYZ& loc)
         {
             // Create new animation
             _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
+            _mapAnimationSet.insert(_mapAnimations.back());
         }
         else
         {
@@ -78,6 +98,7 @@ void map_animation_invalidate_all()
         if (InvalidateMapAnimation(*it))
         {
             // Map animation has finished, remove it
+            _mapAnimationSet.erase(*it);
             it = _mapAnimations.erase(it);
         }
         else
@@ -113,7 +134,7 @@ static bool map_animation_invalidate_ride_entrance(const CoordsXYZ& loc)
             if (stationObj != nullptr)
             {
                 int32_t height = loc.z + stationObj->Height + 8;
-                map_invalidate_tile_zoom1({ loc, height, height + 16 });
+                map_invalidate_tile_animation_zoom1({ loc, height, height + 16 });
             }
         }
         return false;
@@ -148,7 +169,7 @@ static bool map_animation_invalidate_queue_banner(const CoordsXYZ& loc)
         int32_t direction = (tileElement->AsPath()->GetQueueBannerDirection() + get_current_rotation()) & 3;
         if (direction == TILE_ELEMENT_DIRECTION_NORTH || direction == TILE_ELEMENT_DIRECTION_EAST)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 16, loc.z + 30 });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z + 16, loc.z + 30 });
         }
         return false;
     } while (!(tileElement++)->IsLastForTile());
@@ -184,7 +205,7 @@ static bool map_animation_invalidate_small_scenery(const CoordsXYZ& loc)
                 SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
                 | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
         {
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
             return false;
         }
 
@@ -212,7 +233,7 @@ static bool map_animation_invalidate_small_scenery(const CoordsXYZ& loc)
                     break;
                 }
             }
-            map_invalidate_tile_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z, tileElement->GetClearanceZ() });
             return false;
         }
 
@@ -243,7 +264,7 @@ static bool map_animation_invalidate_park_entrance(const CoordsXYZ& loc)
         if (tileElement->AsEntrance()->GetSequenceIndex())
             continue;
 
-        map_invalidate_tile_zoom1({ loc, loc.z + 32, loc.z + 64 });
+        map_invalidate_tile_animation_zoom1({ loc, loc.z + 32, loc.z + 64 });
         return false;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -271,7 +292,7 @@ static bool map_animation_invalidate_track_waterfall(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Waterfall)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 46 });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z + 14, loc.z + 46 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -300,7 +321,7 @@ static bool map_animation_invalidate_track_rapids(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Rapids)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z + 14, loc.z + 18 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -368,7 +389,7 @@ static bool map_animation_invalidate_track_whirlpool(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Whirlpool)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 18 });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z + 14, loc.z + 18 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -397,7 +418,7 @@ static bool map_animation_invalidate_track_spinningtunnel(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::SpinningTunnel)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z + 14, loc.z + 32 });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z + 14, loc.z + 32 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -432,7 +453,7 @@ static bool map_animation_invalidate_banner(const CoordsXYZ& loc)
             continue;
         if (tileElement->GetType() != TileElementType::Banner)
             continue;
-        map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+        map_invalidate_tile_animation_zoom1({ loc, loc.z, loc.z + 16 });
         return false;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -462,7 +483,7 @@ static bool map_animation_invalidate_large_scenery(const CoordsXYZ& loc)
         auto* sceneryEntry = tileElement->AsLargeScenery()->GetEntry();
         if (sceneryEntry != nullptr && sceneryEntry->flags & LARGE_SCENERY_FLAG_ANIMATED)
         {
-            map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+            map_invalidate_tile_animation_zoom1({ loc, loc.z, loc.z + 16 });
             wasInvalidated = true;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -560,7 +581,7 @@ static bool map_animation_invalidate_wall(const CoordsXYZ& loc)
             || (!(wallEntry->flags2 & WALL_SCENERY_2_ANIMATED) && wallEntry->scrolling_mode == SCROLLING_MODE_NONE))
             continue;
 
-        map_invalidate_tile_zoom1({ loc, loc.z, loc.z + 16 });
+        map_invalidate_tile_animation_zoom1({ loc, loc.z, loc.z + 16 });
         wasInvalidated = true;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -608,6 +629,7 @@ const std::vector<MapAnimation>& GetMapAnimations()
 static void ClearMapAnimations()
 {
     _mapAnimations.clear();
+    _mapAnimationSet.clear();
 }
 
 void AutoCreateMapAnimations()
@@ -14,6 +14,7 @@
 #include "../common.h"
 #include "../core/Guard.hpp"
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/String.hpp"
 #include "../localisation/Localisation.h"
 #include "../localisation/StringIds.h"
@@ -410,25 +411,24 @@ static void mapgen_set_water_level(int32_t waterLevel)
 }
 
 /**
- * Smooths the height map.
+ * Smooths the height map. Each iteration only reads the copy of the previous one, so rows are smoothed in parallel.
  */
 static void mapgen_smooth_height(int32_t iterations)
 {
-    int32_t i, x, y, xx, yy, avg;
     int32_t arraySize = _heightSize * _heightSize * sizeof(uint8_t);
     uint8_t* copyHeight = new uint8_t[arraySize];
 
-    for (i = 0; i < iterations; i++)
+    for (int32_t i = 0; i < iterations; i++)
     {
         std::memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize - 1; y++)
-        {
-            for (x = 1; x < _heightSize - 1; x++)
+        JobPool::ParallelFor(1, std::max(_heightSize - 1, 1), 16, [copyHeight](size_t row) {
+            const auto y = static_cast<int32_t>(row);
+            for (int32_t x = 1; x < _heightSize - 1; x++)
             {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
+                int32_t avg = 0;
+                for (int32_t yy = -1; yy <= 1; yy++)
                 {
-                    for (xx = -1; xx <= 1; xx++)
+                    for (int32_t xx = -1; xx <= 1; xx++)
                     {
                         avg += copyHeight[(y + yy) * _heightSize + (x + xx)];
                     }
@@ -436,7 +436,7 @@ static void mapgen_smooth_height(int32_t iterations)
                 avg /= 9;
                 set_height(x, y, avg);
             }
-        }
+        });
     }
 
     delete[] copyHeight;
@@ -623,31 +623,72 @@ static float grad(int32_t hash, float x, float y)
 
 static void mapgen_simplex(mapgen_settings* settings)
 {
-    int32_t x, y;
-
     float freq = settings->simplex_base_freq * (1.0f / _heightSize);
     int32_t octaves = settings->simplex_octaves;
 
     int32_t low = settings->simplex_low;
     int32_t high = settings->simplex_high;
 
+    // The noise of each point only depends on the permutation table, so rows can be filled in parallel and in any
+    // order without changing the result.
     noise_rand();
-    for (y = 0; y < _heightSize; y++)
-    {
-        for (x = 0; x < _heightSize; x++)
+    JobPool::ParallelFor(0, _heightSize, 8, [freq, octaves, low, high](size_t row) {
+        const auto y = static_cast<int32_t>(row);
+        for (int32_t x = 0; x < _heightSize; x++)
         {
             float noiseValue = std::clamp(fractal_noise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
             float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
             set_height(x, y, low + static_cast<int32_t>(normalisedNoiseValue * high));
         }
-    }
+    });
 }
 
 #pragma endregion
 
 #pragma region Heightmap
 
+/**
+ * Sizes the height map for an image, which must be square. Only the top left part of images larger than the biggest
+ * map is used.
+ */
+static bool mapgen_init_heightmap_data(uint32_t width, uint32_t height)
+{
+    if (width != height)
+    {
+        context_show_error(STR_HEIGHT_MAP_ERROR, STR_ERROR_WIDTH_AND_HEIGHT_DO_NOT_MATCH, {});
+        return false;
+    }
+
+    auto size = width;
+    if (width > MAXIMUM_MAP_SIZE_PRACTICAL)
+    {
+        context_show_error(STR_HEIGHT_MAP_ERROR, STR_ERROR_HEIHGT_MAP_TOO_BIG, {});
+        size = std::min<uint32_t>(height, MAXIMUM_MAP_SIZE_PRACTICAL);
+    }
+
+    // Allocate memory for the height map values, one byte pixel
+    _heightMapData.mono_bitmap.resize(size * size);
+    _heightMapData.width = size;
+    _heightMapData.height = size;
+    return true;
+}
+
+/**
+ * Copies the average RGB value of a row of 32bpp pixels to the mono bitmap.
+ */
+static void mapgen_copy_heightmap_row(const uint8_t* pixels, uint32_t y)
+{
+    constexpr auto numChannels = 4;
+    for (uint32_t x = 0; x < _heightMapData.width; x++)
+    {
+        const auto red = pixels[x * numChannels];
+        const auto green = pixels[x * numChannels + 1];
+        const auto blue = pixels[x * numChannels + 2];
+        _heightMapData.mono_bitmap[x + y * _heightMapData.width] = (red + green + blue) / 3;
+    }
+}
+
 bool mapgen_load_heightmap(const utf8* path)
 {
     auto format = Imaging::GetImageFormatFromPath(path);
@@ -659,38 +700,33 @@ bool mapgen_load_heightmap(const utf8* path)
 
     try
     {
-        auto image = Imaging::ReadFromFile(path, format);
-        if (image.Width != image.Height)
+        if (format == IMAGE_FORMAT::PNG_32)
         {
-            context_show_error(STR_HEIGHT_MAP_ERROR, STR_ERROR_WIDTH_AND_HEIGHT_DO_NOT_MATCH, {});
-            return false;
+            // Only the rows that end up in the height map are decoded, one at a time.
+            Imaging::PngStreamReader reader(path);
+            if (!mapgen_init_heightmap_data(reader.GetWidth(), reader.GetHeight()))
+            {
+                return false;
+            }
+
+            std::vector<uint8_t> row(reader.GetWidth() * 4);
+            for (uint32_t y = 0; y < _heightMapData.height; y++)
+            {
+                reader.ReadRow(row.data());
+                mapgen_copy_heightmap_row(row.data(), y);
+            }
+            return true;
         }
 
-        auto size = image.Width;
-        if (image.Width > MAXIMUM_MAP_SIZE_PRACTICAL)
+        auto image = Imaging::ReadFromFile(path, format);
+        if (!mapgen_init_heightmap_data(image.Width, image.Height))
         {
-            context_show_error(STR_HEIGHT_MAP_ERROR, STR_ERROR_HEIHGT_MAP_TOO_BIG, {});
-            size = std::min<uint32_t>(image.Height, MAXIMUM_MAP_SIZE_PRACTICAL);
+            return false;
         }
 
-        // Allocate memory for the height map values, one byte pixel
-        _heightMapData.mono_bitmap.resize(size * size);
-        _heightMapData.width = size;
-        _heightMapData.height = size;
-
-        // Copy average RGB value to mono bitmap
-        constexpr auto numChannels = 4;
-        const auto pitch = image.Stride;
-        const auto pixels = image.Pixels.data();
-        for (uint32_t x = 0; x < _heightMapData.width; x++)
+        for (uint32_t y = 0; y < _heightMapData.height; y++)
         {
-            for (uint32_t y = 0; y < _heightMapData.height; y++)
-            {
-                const auto red = pixels[x * numChannels + y * pitch];
-                const auto green = pixels[x * numChannels + y * pitch + 1];
-                const auto blue = pixels[x * numChannels + y * pitch + 2];
-                _heightMapData.mono_bitmap[x + y * _heightMapData.width] = (red + green + blue) / 3;
-            }
+            mapgen_copy_heightmap_row(image.Pixels.data() + y * image.Stride, y);
         }
         return true;
     }
@@ -19,6 +19,7 @@
 #include "../config/Config.h"
 #include "../core/Memory.hpp"
 #include "../core/String.hpp"
+#include "../entity/GuestHotState.h"
 #include "../entity/Litter.h"
 #include "../entity/Peep.h"
 #include "../entity/Staff.h"
@@ -40,6 +41,7 @@
 #include "Entrance.h"
 #include "Map.h"
 #include "Surface.h"
+#include "TileElementsView.h"
 
 #include <algorithm>
 #include <limits>
@@ -267,6 +269,7 @@ void Park::Initialise()
     gNumGuestsHeadingForPark = 0;
     gGuestChangeModifier = 0;
     gParkRating = 0;
+    _parkSizeRevision = 0;
     _guestGenerationProbability = 0;
     gTotalRideValueForMoney = 0;
     gResearchLastItem = std::nullopt;
@@ -320,11 +323,12 @@ void Park::Update(const Date& date)
     // Every ~13 seconds
     if (gCurrentTicks % 512 == 0)
     {
-        gParkRating = CalculateParkRating();
-        gParkValue = CalculateParkValue();
+        const auto rideTotals = CalculateRideTotals();
+        gParkRating = CalculateParkRating(rideTotals);
+        gParkValue = CalculateParkValue(rideTotals);
         gCompanyValue = CalculateCompanyValue();
-        gTotalRideValueForMoney = CalculateTotalRideValueForMoney();
-        _suggestedGuestMaximum = CalculateSuggestedMaxGuests();
+        gTotalRideValueForMoney = rideTotals.TotalValueForMoney;
+        _suggestedGuestMaximum = CalculateSuggestedMaxGuests(rideTotals);
         _guestGenerationProbability = CalculateGuestGenerationProbability();
 
         window_invalidate_by_class(WC_FINANCES);
@@ -332,10 +336,15 @@ void Park::Update(const Date& date)
         context_broadcast_intent(&intent);
     }
 
-    // Every ~102 seconds
+    // Every ~102 seconds, the owned land is only counted again when ownership may have changed.
     if (gCurrentTicks % 4096 == 0)
     {
-        gParkSize = CalculateParkSize();
+        const auto ownershipRevision = map_get_surface_ownership_revision();
+        if (ownershipRevision != _parkSizeRevision)
+        {
+            gParkSize = CalculateParkSize();
+            _parkSizeRevision = ownershipRevision;
+        }
         window_invalidate_by_class(WC_PARK_INFORMATION);
     }
 
@@ -345,18 +354,12 @@ void Park::Update(const Date& date)
 int32_t Park::CalculateParkSize() const
 {
     int32_t tiles = 0;
-    tile_element_iterator it;
-    tile_element_iterator_begin(&it);
-    do
-    {
-        if (it.element->GetType() == TileElementType::Surface)
+    ForEachMapElement<SurfaceElement>([&tiles](const TileCoordsXY&, const SurfaceElement& surfaceElement) {
+        if (surfaceElement.GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
         {
-            if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
-            {
-                tiles++;
-            }
+            tiles++;
         }
-    } while (tile_element_iterator_next(&it));
+    });
 
     if (tiles != gParkSize)
     {
@@ -367,7 +370,69 @@ int32_t Park::CalculateParkSize() const
     return tiles;
 }
 
+Park::RideTotals Park::CalculateRideTotals() const
+{
+    RideTotals totals{};
+    bool ridePricesUnlocked = park_ride_prices_unlocked() && !(gParkFlags & PARK_FLAGS_NO_MONEY);
+    for (const auto& ride : GetRideManager())
+    {
+        totals.RideCount++;
+        totals.TotalUptime += 100 - ride.downtime;
+        if (ride_has_ratings(&ride))
+        {
+            totals.TotalExcitement += ride.excitement / 8;
+            totals.TotalIntensity += ride.intensity / 8;
+            totals.RatedRideCount++;
+        }
+        totals.TotalValue += CalculateRideValue(&ride);
+
+        if (ride.lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED))
+            continue;
+
+        const auto& rtd = ride.GetRideTypeDescriptor();
+        if (ride.status == RideStatus::Open)
+        {
+            // Add ride value
+            if (ride.value != RIDE_VALUE_UNDEFINED)
+            {
+                money16 rideValue = static_cast<money16>(ride.value);
+                if (ridePricesUnlocked)
+                {
+                    rideValue -= ride.price[0];
+                }
+                if (rideValue > 0)
+                {
+                    totals.TotalValueForMoney += rideValue * 2;
+                }
+            }
+
+            // Add guest score for ride type
+            totals.OperatingRideBonus += rtd.BonusValue;
+        }
+
+        // Extra guests for good rides with difficult guest generation, these do not need to be open.
+        if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_TESTED))
+            continue;
+        if (!rtd.HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
+            continue;
+        if (!rtd.HasFlag(RIDE_TYPE_FLAG_HAS_DATA_LOGGING))
+            continue;
+        if (ride.GetStation().SegmentLength < (600 << 16))
+            continue;
+        if (ride.excitement < RIDE_RATING(6, 00))
+            continue;
+
+        totals.GoodRideBonus += rtd.BonusValue * 2;
+    }
+    return totals;
+}
+
 int32_t Park::CalculateParkRating() const
+{
+    return CalculateParkRating(CalculateRideTotals());
+}
+
+int32_t Park::CalculateParkRating(const RideTotals& rideTotals) const
 {
     if (_forcedParkRating >= 0)
     {
@@ -386,22 +451,9 @@ int32_t Park::CalculateParkRating() const
         result -= 150 - (std::min<int16_t>(2000, gNumGuestsInPark) / 13);
 
         // Find the number of happy peeps and the number of peeps who can't find the park exit
-        uint32_t happyGuestCount = 0;
-        uint32_t lostGuestCount = 0;
-        for (auto peep : EntityList<Guest>())
-        {
-            if (!peep->OutsideOfPark)
-            {
-                if (peep->Happiness > 128)
-                {
-                    happyGuestCount++;
-                }
-                if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                {
-                    lostGuestCount++;
-                }
-            }
-        }
+        auto& hotState = GuestHotState::Get();
+        hotState.EnsureSynced();
+        const auto [happyGuestCount, lostGuestCount] = hotState.CountForParkRating(128);
 
         // Peep happiness -500 to +0
         result -= 500;
@@ -419,22 +471,11 @@ int32_t Park::CalculateParkRating() const
 
     // Rides
     {
-        int32_t rideCount = 0;
-        int32_t excitingRideCount = 0;
-        int32_t totalRideUptime = 0;
-        int32_t totalRideIntensity = 0;
-        int32_t totalRideExcitement = 0;
-        for (auto& ride : GetRideManager())
-        {
-            totalRideUptime += 100 - ride.downtime;
-            if (ride_has_ratings(&ride))
-            {
-                totalRideExcitement += ride.excitement / 8;
-                totalRideIntensity += ride.intensity / 8;
-                excitingRideCount++;
-            }
-            rideCount++;
-        }
+        int32_t rideCount = rideTotals.RideCount;
+        int32_t excitingRideCount = rideTotals.RatedRideCount;
+        int32_t totalRideUptime = rideTotals.TotalUptime;
+        int32_t totalRideIntensity = rideTotals.TotalIntensity;
+        int32_t totalRideExcitement = rideTotals.TotalExcitement;
         result -= 200;
         if (rideCount > 0)
         {
@@ -484,13 +525,14 @@ int32_t Park::CalculateParkRating() const
 }
 
 money64 Park::CalculateParkValue() const
+{
+    return CalculateParkValue(CalculateRideTotals());
+}
+
+money64 Park::CalculateParkValue(const RideTotals& rideTotals) const
 {
     // Sum ride values
-    money64 result = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        result += CalculateRideValue(&ride);
-    }
+    money64 result = rideTotals.TotalValue;
 
     // +7.00 per guest
     result += static_cast<money64>(gNumGuestsInPark) * 7.00_GBP;
@@ -520,78 +562,15 @@ money64 Park::CalculateCompanyValue() const
     return result;
 }
 
-money16 Park::CalculateTotalRideValueForMoney() const
-{
-    money16 totalRideValue = 0;
-    bool ridePricesUnlocked = park_ride_prices_unlocked() && !(gParkFlags & PARK_FLAGS_NO_MONEY);
-    for (auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-            continue;
-
-        // Add ride value
-        if (ride.value != RIDE_VALUE_UNDEFINED)
-        {
-            money16 rideValue = static_cast<money16>(ride.value);
-            if (ridePricesUnlocked)
-            {
-                rideValue -= ride.price[0];
-            }
-            if (rideValue > 0)
-            {
-                totalRideValue += rideValue * 2;
-            }
-        }
-    }
-    return totalRideValue;
-}
-
-uint32_t Park::CalculateSuggestedMaxGuests() const
+uint32_t Park::CalculateSuggestedMaxGuests(const RideTotals& rideTotals) const
 {
-    uint32_t suggestedMaxGuests = 0;
-
-    // TODO combine the two ride loops
-    for (auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-            continue;
-
-        // Add guest score for ride type
-        suggestedMaxGuests += ride.GetRideTypeDescriptor().BonusValue;
-    }
+    uint32_t suggestedMaxGuests = rideTotals.OperatingRideBonus;
 
     // If difficult guest generation, extra guests are available for good rides
     if (gParkFlags & PARK_FLAGS_DIFFICULT_GUEST_GENERATION)
     {
         suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 1000);
-        for (auto& ride : GetRideManager())
-        {
-            if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-                continue;
-            if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-                continue;
-            if (!(ride.lifecycle_flags & RIDE_LIFECYCLE_TESTED))
-                continue;
-            if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
-                continue;
-            if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_DATA_LOGGING))
-                continue;
-            if (ride.GetStation().SegmentLength < (600 << 16))
-                continue;
-            if (ride.excitement < RIDE_RATING(6, 00))
-                continue;
-
-            // Bonus guests for good ride
-            suggestedMaxGuests += ride.GetRideTypeDescriptor().BonusValue * 2;
-        }
+        suggestedMaxGuests += rideTotals.GoodRideBonus;
     }
 
     suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 65535);
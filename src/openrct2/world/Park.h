@@ -77,13 +77,32 @@ namespace OpenRCT2
         void UpdateHistories();
 
     private:
+        // Everything the periodic park evaluation needs from the rides, gathered in a single pass.
+        struct RideTotals
+        {
+            int32_t RideCount;
+            int32_t RatedRideCount;
+            int32_t TotalUptime;
+            int32_t TotalExcitement;
+            int32_t TotalIntensity;
+            money64 TotalValue;
+            money16 TotalValueForMoney;
+            uint32_t OperatingRideBonus;
+            uint32_t GoodRideBonus;
+        };
+
+        RideTotals CalculateRideTotals() const;
+        int32_t CalculateParkRating(const RideTotals& rideTotals) const;
+        money64 CalculateParkValue(const RideTotals& rideTotals) const;
         money64 CalculateRideValue(const Ride* ride) const;
-        money16 CalculateTotalRideValueForMoney() const;
-        uint32_t CalculateSuggestedMaxGuests() const;
+        uint32_t CalculateSuggestedMaxGuests(const RideTotals& rideTotals) const;
         uint32_t CalculateGuestGenerationProbability() const;
 
         void GenerateGuests();
         Guest* GenerateGuestFromCampaign(int32_t campaign);
+
+        // Surface ownership revision gParkSize was last calculated at, 0 if it has to be calculated again.
+        uint32_t _parkSizeRevision{};
     };
 } // namespace OpenRCT2
 
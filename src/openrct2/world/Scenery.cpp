@@ -15,8 +15,11 @@
 #include "../OpenRCT2.h"
 #include "../actions/BannerRemoveAction.h"
 #include "../actions/FootpathAdditionRemoveAction.h"
+#include "../actions/LargeSceneryPlaceAction.h"
 #include "../actions/LargeSceneryRemoveAction.h"
+#include "../actions/SmallSceneryPlaceAction.h"
 #include "../actions/SmallSceneryRemoveAction.h"
+#include "../actions/WallPlaceAction.h"
 #include "../actions/WallRemoveAction.h"
 #include "../common.h"
 #include "../core/String.hpp"
@@ -25,6 +28,7 @@
 #include "../network/network.h"
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
+#include "../platform/Platform.h"
 #include "../scenario/Scenario.h"
 #include "Climate.h"
 #include "Footpath.h"
@@ -57,6 +61,22 @@ money64 gClearSceneryCost;
 
 static std::vector<ScenerySelection> _restrictedScenery;
 
+struct SpeculativePlacement
+{
+    uint32_t NetworkId;
+    uint32_t Time;
+    GameAction::Ptr Placement;
+    // Removes the ghost, not set while the ghost is not placed.
+    GameAction::Ptr Removal;
+};
+static std::vector<SpeculativePlacement> _speculativePlacements;
+
+// How long a ghost is shown for a placement the server does not execute, in milliseconds.
+static constexpr uint32_t SpeculativePlacementTimeout = 5000;
+
+static constexpr uint32_t GhostRemovalFlags = GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED | GAME_COMMAND_FLAG_NO_SPEND
+    | GAME_COMMAND_FLAG_GHOST;
+
 // rct2: 0x009A3E74
 const CoordsXY SceneryQuadrantOffsets[] = {
     { 7, 7 },
@@ -295,6 +315,180 @@ void scenery_remove_ghost_tool_placement()
     }
 }
 
+namespace
+{
+    // Collects the parameters of a scenery placement that are needed to remove its ghost.
+    class PlacementParameters final : public GameActionParameterVisitor
+    {
+    public:
+        CoordsXYZD Loc{};
+        int32_t Object{};
+        int32_t Edge{};
+
+        void Visit(std::string_view name, int32_t& param) override
+        {
+            if (name == "x")
+                Loc.x = param;
+            else if (name == "y")
+                Loc.y = param;
+            else if (name == "z")
+                Loc.z = param;
+            else if (name == "direction")
+                Loc.direction = static_cast<Direction>(param);
+            else if (name == "object")
+                Object = param;
+            else if (name == "edge")
+                Edge = param;
+        }
+    };
+} // namespace
+
+/**
+ * Places the ghost of a speculative placement, returns the action that removes it or nullptr if it could not be placed.
+ */
+static GameAction::Ptr scenery_place_speculative_ghost(GameAction& placement)
+{
+    auto result = GameActions::Execute(&placement);
+    if (result.Error != GameActions::Status::Ok)
+    {
+        return nullptr;
+    }
+
+    PlacementParameters params;
+    placement.AcceptParameters(params);
+    const auto objectIndex = static_cast<ObjectEntryIndex>(params.Object);
+
+    GameAction::Ptr removal;
+    switch (placement.GetType())
+    {
+        case GameCommand::PlaceScenery:
+        {
+            const auto placementData = result.GetData<SmallSceneryPlaceActionResult>();
+            removal = std::make_unique<SmallSceneryRemoveAction>(
+                CoordsXYZ{ params.Loc, placementData.BaseHeight }, placementData.SceneryQuadrant, objectIndex);
+            break;
+        }
+        case GameCommand::PlaceLargeScenery:
+        {
+            const auto placementData = result.GetData<LargeSceneryPlaceActionResult>();
+            removal = std::make_unique<LargeSceneryRemoveAction>(
+                CoordsXYZD{ params.Loc, placementData.firstTileHeight, params.Loc.direction }, 0);
+            break;
+        }
+        case GameCommand::PlaceWall:
+        {
+            const auto placementData = result.GetData<WallPlaceActionResult>();
+            removal = std::make_unique<WallRemoveAction>(
+                CoordsXYZD{ params.Loc, placementData.BaseHeight, static_cast<Direction>(params.Edge) });
+            break;
+        }
+        case GameCommand::PlaceBanner:
+            removal = std::make_unique<BannerRemoveAction>(
+                CoordsXYZD{ params.Loc, params.Loc.z + PATH_HEIGHT_STEP, params.Loc.direction });
+            break;
+        default:
+            return nullptr;
+    }
+    removal->SetFlags(GhostRemovalFlags);
+    return removal;
+}
+
+static void scenery_remove_speculative_ghosts()
+{
+    for (auto& placement : _speculativePlacements)
+    {
+        if (placement.Removal != nullptr)
+        {
+            GameActions::Execute(placement.Removal.get());
+            placement.Removal = nullptr;
+        }
+    }
+}
+
+void scenery_speculate_placement(const GameAction& action)
+{
+    switch (action.GetType())
+    {
+        case GameCommand::PlaceScenery:
+        case GameCommand::PlaceLargeScenery:
+        case GameCommand::PlaceWall:
+        case GameCommand::PlaceBanner:
+            break;
+        default:
+            return;
+    }
+
+    auto placement = GameActions::Clone(&action);
+    placement->SetCallback(nullptr);
+    placement->SetFlags(action.GetFlags() | GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED);
+    auto removal = scenery_place_speculative_ghost(*placement);
+    if (removal != nullptr)
+    {
+        _speculativePlacements.push_back(
+            { action.GetNetworkId(), Platform::GetTicks(), std::move(placement), std::move(removal) });
+    }
+}
+
+void scenery_resolve_speculative_placement(const GameAction& action)
+{
+    if (_speculativePlacements.empty())
+    {
+        return;
+    }
+
+    // All ghosts are removed so they do not interfere with the incoming action, the others are placed again afterwards.
+    scenery_remove_speculative_ghosts();
+    if (action.GetPlayer() == network_get_current_player_id())
+    {
+        auto it = std::find_if(
+            _speculativePlacements.begin(), _speculativePlacements.end(),
+            [&action](const SpeculativePlacement& p) { return p.NetworkId == action.GetNetworkId(); });
+        if (it != _speculativePlacements.end())
+        {
+            _speculativePlacements.erase(it);
+        }
+    }
+}
+
+void scenery_restore_speculative_placements()
+{
+    const auto now = Platform::GetTicks();
+    for (auto it = _speculativePlacements.begin(); it != _speculativePlacements.end();)
+    {
+        if (now - it->Time >= SpeculativePlacementTimeout)
+        {
+            if (it->Removal != nullptr)
+            {
+                GameActions::Execute(it->Removal.get());
+            }
+            it = _speculativePlacements.erase(it);
+            continue;
+        }
+        if (it->Removal == nullptr)
+        {
+            it->Removal = scenery_place_speculative_ghost(*it->Placement);
+            if (it->Removal == nullptr)
+            {
+                it = _speculativePlacements.erase(it);
+                continue;
+            }
+        }
+        it++;
+    }
+}
+
+/**
+ * Forgets all speculative placements, removeGhosts is not set when the map the ghosts are on is being replaced.
+ */
+void scenery_clear_speculative_placements(bool removeGhosts)
+{
+    if (removeGhosts)
+    {
+        scenery_remove_speculative_ghosts();
+    }
+    _speculativePlacements.clear();
+}
+
 WallSceneryEntry* get_wall_entry(ObjectEntryIndex entryIndex)
 {
     WallSceneryEntry* result = nullptr;
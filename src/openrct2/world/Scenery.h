@@ -20,6 +20,7 @@
 #define SCENERY_WITHER_AGE_THRESHOLD_1 0x28
 #define SCENERY_WITHER_AGE_THRESHOLD_2 0x37
 
+class GameAction;
 struct LargeSceneryText;
 
 #pragma pack(push, 1)
@@ -278,6 +279,15 @@ void scenery_update_tile(const CoordsXY& sceneryPos);
 void scenery_set_default_placement_configuration();
 void scenery_remove_ghost_tool_placement();
 
+/**
+ * Speculative ghosts of the scenery the player places in a network game. The ghost is shown as soon as the action is
+ * sent and removed once the server has executed it, or when the server did not within a few seconds.
+ */
+void scenery_speculate_placement(const GameAction& action);
+void scenery_resolve_speculative_placement(const GameAction& action);
+void scenery_restore_speculative_placements();
+void scenery_clear_speculative_placements(bool removeGhosts);
+
 WallSceneryEntry* get_wall_entry(ObjectEntryIndex entryIndex);
 BannerSceneryEntry* get_banner_entry(ObjectEntryIndex entryIndex);
 PathBitEntry* get_footpath_item_entry(ObjectEntryIndex entryIndex);
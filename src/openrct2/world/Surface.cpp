@@ -199,6 +199,7 @@ void SurfaceElement::SetOwnership(uint8_t newOwnership)
 {
     Ownership &= ~TILE_ELEMENT_SURFACE_OWNERSHIP_MASK;
     Ownership |= (newOwnership & TILE_ELEMENT_SURFACE_OWNERSHIP_MASK);
+    map_bump_surface_ownership_revision();
 }
 
 uint8_t SurfaceElement::GetParkFences() const
@@ -12,6 +12,7 @@
 #include "TileElement.h"
 
 #include <iterator>
+#include <type_traits>
 
 namespace OpenRCT2
 {
@@ -111,14 +112,14 @@ namespace OpenRCT2
 
         Iterator begin() noexcept
         {
-            T* element = reinterpret_cast<T*>(map_get_first_element_at(_loc));
-
-            if constexpr (!std::is_same_v<T, TileElement>)
+            if constexpr (std::is_same_v<T, TileElement>)
             {
-                element = Detail::NextMatchingTile<T>(element);
+                return Iterator{ map_get_first_element_at(_loc) };
+            }
+            else
+            {
+                return Iterator{ reinterpret_cast<T*>(map_get_first_element_of_type(_loc, T::ElementType)) };
             }
-
-            return Iterator{ element };
         }
 
         Iterator end() noexcept
@@ -127,4 +128,45 @@ namespace OpenRCT2
         }
     };
 
+    /**
+     * Calls fn(tilePos) for every tile that may have an element of one of the types in typeMask, see
+     * map_for_each_tile_with_element_types.
+     */
+    template<typename TFn> void ForEachTileWithElementTypes(uint32_t typeMask, TFn&& fn)
+    {
+        using TFunc = std::remove_reference_t<TFn>;
+        auto* ctx = const_cast<void*>(static_cast<const void*>(&fn));
+        map_for_each_tile_with_element_types(
+            typeMask, [](void* fnCtx, const TileCoordsXY& tilePos) { (*static_cast<TFunc*>(fnCtx))(tilePos); }, ctx);
+    }
+
+    /**
+     * Calls fn(tilePos, element) for every element of type T on the map, in the same order as tile_element_iterator.
+     * Only the tiles indexed for the type are visited. fn may change the elements but must not insert or remove any.
+     */
+    template<typename T, typename TFn> void ForEachMapElement(TFn&& fn)
+    {
+        auto visitTile = [&fn](const TileCoordsXY& tilePos) {
+            for (auto* element : TileElementsView<T>(tilePos.ToCoordsXY()))
+            {
+                fn(tilePos, *element);
+            }
+        };
+
+        if constexpr (std::is_same_v<T, TileElement>)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+                {
+                    visitTile({ x, y });
+                }
+            }
+        }
+        else
+        {
+            ForEachTileWithElementTypes(1u << static_cast<uint32_t>(T::ElementType), visitTile);
+        }
+    }
+
 } // namespace OpenRCT2
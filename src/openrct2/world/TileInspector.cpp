@@ -63,6 +63,7 @@ namespace OpenRCT2::TileInspector
 
         // Swap their memory
         std::swap(*firstElement, *secondElement);
+        map_bump_elements_revision();
 
         // Swap the 'last map element for tile' flag if either one of them was last
         if ((firstElement)->IsLastForTile() || (secondElement)->IsLastForTile())
@@ -358,6 +359,7 @@ namespace OpenRCT2::TileInspector
             bool lastForTile = pastedElement->IsLastForTile();
             *pastedElement = element;
             pastedElement->SetLastForTile(lastForTile);
+            map_bump_elements_revision();
 
             map_invalidate_tile_full(loc);
 
@@ -11,45 +11,114 @@
 
 #include "Location.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <vector>
 
+enum class TileLayout : uint8_t
+{
+    // Tiles are stored row by row.
+    Rows,
+    // Tiles are stored in square blocks, block by block and row by row within each block, so tiles that are close to
+    // each other are also close in memory.
+    Blocks,
+};
+
 template<typename T> class TilePointerIndex
 {
+    static constexpr int32_t BlockShift = 4;
+    static constexpr int32_t BlockSize = 1 << BlockShift;
+    static constexpr int32_t BlockMask = BlockSize - 1;
+
     std::vector<T*> TilePointers;
     uint16_t MapSize{};
+    uint16_t BlocksPerRow{};
+    TileLayout Layout{};
 
 public:
     TilePointerIndex() = default;
 
-    explicit TilePointerIndex(const uint16_t mapSize, T* tileElements, size_t count)
+    /**
+     * Builds the index for tile elements that are stored in the order given by layout, see ForEachTile.
+     */
+    explicit TilePointerIndex(const uint16_t mapSize, T* tileElements, size_t count, TileLayout layout = TileLayout::Rows)
     {
         MapSize = mapSize;
-        TilePointers.reserve(MapSize * MapSize);
+        BlocksPerRow = (mapSize + BlockMask) >> BlockShift;
+        Layout = layout;
+        auto numTiles = layout == TileLayout::Blocks ? BlocksPerRow * BlocksPerRow * BlockSize * BlockSize : MapSize * MapSize;
+        TilePointers.resize(numTiles);
 
         size_t index = 0;
-        for (size_t y = 0; y < MapSize; y++)
+        ForEachTile(mapSize, layout, [&](TileCoordsXY coords) {
+            assert(index < count);
+            TilePointers[GetIndex(coords)] = &tileElements[index];
+            do
+            {
+                index++;
+            } while (!tileElements[index - 1].IsLastForTile());
+        });
+    }
+
+    /**
+     * Calls fn for every tile of a map of the given size, in the order the layout stores them.
+     */
+    template<typename TFn> static void ForEachTile(const uint16_t mapSize, TileLayout layout, TFn&& fn)
+    {
+        if (layout == TileLayout::Blocks)
         {
-            for (size_t x = 0; x < MapSize; x++)
+            for (int32_t blockY = 0; blockY < mapSize; blockY += BlockSize)
             {
-                assert(index < count);
-                TilePointers.emplace_back(&tileElements[index]);
-                do
+                for (int32_t blockX = 0; blockX < mapSize; blockX += BlockSize)
                 {
-                    index++;
-                } while (!tileElements[index - 1].IsLastForTile());
+                    auto endY = std::min<int32_t>(blockY + BlockSize, mapSize);
+                    auto endX = std::min<int32_t>(blockX + BlockSize, mapSize);
+                    for (int32_t y = blockY; y < endY; y++)
+                    {
+                        for (int32_t x = blockX; x < endX; x++)
+                        {
+                            fn(TileCoordsXY{ x, y });
+                        }
+                    }
+                }
             }
         }
+        else
+        {
+            for (int32_t y = 0; y < mapSize; y++)
+            {
+                for (int32_t x = 0; x < mapSize; x++)
+                {
+                    fn(TileCoordsXY{ x, y });
+                }
+            }
+        }
+    }
+
+    TileLayout GetLayout() const
+    {
+        return Layout;
     }
 
     T* GetFirstElementAt(TileCoordsXY coords)
     {
-        return TilePointers[coords.x + (coords.y * MapSize)];
+        return TilePointers[GetIndex(coords)];
     }
 
     void SetTile(TileCoordsXY coords, T* tileElement)
     {
-        TilePointers[coords.x + (coords.y * MapSize)] = tileElement;
+        TilePointers[GetIndex(coords)] = tileElement;
+    }
+
+private:
+    size_t GetIndex(TileCoordsXY coords) const
+    {
+        if (Layout == TileLayout::Blocks)
+        {
+            auto block = (coords.y >> BlockShift) * BlocksPerRow + (coords.x >> BlockShift);
+            return (block << (2 * BlockShift)) | ((coords.y & BlockMask) << BlockShift) | (coords.x & BlockMask);
+        }
+        return coords.x + (coords.y * MapSize);
     }
 };
@@ -0,0 +1,75 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/entity/EntityIdSet.h>
+#include <vector>
+
+static std::vector<uint16_t> ToVector(const EntityIdSet& set)
+{
+    std::vector<uint16_t> res;
+    for (auto id : set)
+    {
+        res.push_back(id.ToUnderlying());
+    }
+    return res;
+}
+
+TEST(EntityIdSetTest, test_ordered_iteration)
+{
+    EntityIdSet set;
+    ASSERT_TRUE(set.empty());
+    for (uint16_t id : { 500, 3, 64, 63, 65534, 0, 4096 })
+    {
+        ASSERT_TRUE(set.insert(EntityId::FromUnderlying(id)));
+    }
+    ASSERT_FALSE(set.insert(EntityId::FromUnderlying(64)));
+    ASSERT_FALSE(set.insert(EntityId::GetNull()));
+    ASSERT_EQ(set.size(), 7u);
+    ASSERT_EQ(ToVector(set), (std::vector<uint16_t>{ 0, 3, 63, 64, 500, 4096, 65534 }));
+
+    ASSERT_TRUE(set.erase(EntityId::FromUnderlying(64)));
+    ASSERT_FALSE(set.erase(EntityId::FromUnderlying(64)));
+    ASSERT_FALSE(set.contains(EntityId::FromUnderlying(64)));
+    ASSERT_EQ(ToVector(set), (std::vector<uint16_t>{ 0, 3, 63, 500, 4096, 65534 }));
+
+    set.clear();
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+}
+
+TEST(EntityIdSetTest, test_modify_while_iterating)
+{
+    EntityIdSet set;
+    for (uint16_t id = 0; id < 200; id += 2)
+    {
+        set.insert(EntityId::FromUnderlying(id));
+    }
+
+    std::vector<uint16_t> visited;
+    for (auto id : set)
+    {
+        auto index = id.ToUnderlying();
+        visited.push_back(index);
+        // Remove the current and the next id, add one ahead and one behind.
+        set.erase(id);
+        set.erase(EntityId::FromUnderlying(index + 2));
+        if (index == 8)
+        {
+            set.insert(EntityId::FromUnderlying(1));
+            set.insert(EntityId::FromUnderlying(1001));
+        }
+    }
+
+    ASSERT_EQ(visited.size(), 51u);
+    ASSERT_EQ(visited.front(), 0);
+    ASSERT_EQ(visited[1], 4);
+    ASSERT_EQ(visited.back(), 1001);
+    ASSERT_EQ(ToVector(set), (std::vector<uint16_t>{ 1 }));
+}
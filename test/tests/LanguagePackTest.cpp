@@ -9,9 +9,11 @@
 
 #include "openrct2/localisation/LanguagePack.h"
 
+#include "openrct2/core/File.h"
 #include "openrct2/localisation/Language.h"
 #include "openrct2/localisation/StringIds.h"
 
+#include <cstring>
 #include <gtest/gtest.h>
 
 class LanguagePackTest : public testing::Test
@@ -55,6 +57,88 @@ TEST_F(LanguagePackTest, language_pack_simple)
     ASSERT_EQ(lang->GetObjectOverrideStringId("        ", 0), STR_NONE);
 }
 
+TEST_F(LanguagePackTest, language_pack_tokens)
+{
+    auto lang = LanguagePackFactory::FromText(0, LanguageEnGB);
+    ASSERT_EQ(lang->GetStringTokens(0), nullptr);
+    ASSERT_EQ(lang->GetStringTokens(0x6000), nullptr);
+
+    auto str = lang->GetString(1);
+    auto tokens = lang->GetStringTokens(1);
+    ASSERT_NE(tokens, nullptr);
+    ASSERT_EQ(tokens[0].kind, FormatToken::StringId);
+    ASSERT_EQ(tokens[1].kind, FormatToken::Literal);
+    ASSERT_EQ(tokens[1].text, " ");
+    ASSERT_EQ(tokens[2].kind, FormatToken::Comma16);
+
+    // Iterating the pre-parsed tokens has to give the same result as parsing the string
+    OpenRCT2::FmtString parsed(str);
+    OpenRCT2::FmtString preParsed(str, tokens);
+    auto it = preParsed.begin();
+    for (const auto& token : parsed)
+    {
+        ASSERT_FALSE(it.eol());
+        ASSERT_EQ(it->kind, token.kind);
+        ASSERT_EQ(it->text, token.text);
+        it++;
+    }
+    ASSERT_TRUE(it.eol());
+
+    lang->SetString(1, "{INT32}");
+    tokens = lang->GetStringTokens(1);
+    ASSERT_NE(tokens, nullptr);
+    ASSERT_EQ(tokens[0].kind, FormatToken::Int32);
+}
+
+TEST_F(LanguagePackTest, language_pack_cache)
+{
+    const std::string path = "languagepack_cache_test.txt";
+    const std::string cachePath = "languagepack_cache_test.bin";
+    File::WriteAllBytes(path, LanguageEnGB, std::strlen(LanguageEnGB));
+    File::Delete(cachePath);
+
+    // The first load parses the file and writes the cache, the second one is read from the cache.
+    auto parsed = LanguagePackFactory::FromFile(0, path.c_str(), cachePath);
+    ASSERT_NE(parsed, nullptr);
+    ASSERT_TRUE(File::Exists(cachePath));
+    auto cached = LanguagePackFactory::FromFile(0, path.c_str(), cachePath);
+    ASSERT_NE(cached, nullptr);
+
+    ASSERT_EQ(cached->GetCount(), parsed->GetCount());
+    for (rct_string_id id = 0; id < parsed->GetCount(); id++)
+    {
+        auto expected = parsed->GetString(id);
+        auto actual = cached->GetString(id);
+        if (expected == nullptr)
+        {
+            ASSERT_EQ(actual, nullptr);
+            ASSERT_EQ(cached->GetStringTokens(id), nullptr);
+            continue;
+        }
+        ASSERT_STREQ(actual, expected);
+
+        OpenRCT2::FmtString fromParsed(expected, parsed->GetStringTokens(id));
+        OpenRCT2::FmtString fromCache(actual, cached->GetStringTokens(id));
+        auto it = fromCache.begin();
+        for (const auto& token : fromParsed)
+        {
+            ASSERT_FALSE(it.eol());
+            ASSERT_EQ(it->kind, token.kind);
+            ASSERT_EQ(it->text, token.text);
+            ASSERT_EQ(it->parameter, token.parameter);
+            it++;
+        }
+        ASSERT_TRUE(it.eol());
+    }
+    ASSERT_EQ(cached->GetScenarioOverrideStringId("Arid Heights", 0), 0x7000);
+    ASSERT_STREQ(cached->GetString(0x7000), "Arid Heights scenario string");
+    ASSERT_EQ(cached->GetObjectOverrideStringId("CONDORRD", 0), 0x6000);
+    ASSERT_STREQ(cached->GetString(0x6000), "my test ride");
+
+    File::Delete(path);
+    File::Delete(cachePath);
+}
+
 TEST_F(LanguagePackTest, language_pack_multibyte)
 {
     auto lang = LanguagePackFactory::FromText(0, (const utf8*)LanguageZhTW);
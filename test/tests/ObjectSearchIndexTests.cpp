@@ -0,0 +1,81 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/object/ObjectRepository.h>
+#include <openrct2/object/ObjectSearchIndex.h>
+#include <string>
+#include <vector>
+
+class ObjectSearchIndexTest : public testing::Test
+{
+protected:
+    std::vector<ObjectRepositoryItem> _items;
+    ObjectSearchIndex _index;
+
+    void AddItem(const std::string& name, const std::string& author, const std::string& identifier, const std::string& path)
+    {
+        auto& item = _items.emplace_back();
+        item.Id = _items.size() - 1;
+        item.Name = name;
+        item.Authors = { author };
+        item.Identifier = identifier;
+        item.Path = path;
+    }
+
+    void SetUp() override
+    {
+        AddItem("Wooden Roller Coaster Trains", "Chris Sawyer", "rct2.ride.wooden", "objects/rct2/wooden.parkobj");
+        AddItem("Merry-Go-Round", "Chris Sawyer", "rct2.ride.mgr1", "objects/rct2/mgr1.parkobj");
+        AddItem("Wooden Fence", "Someone Else", "custom.fence.wood", "user/fence.parkobj");
+        _index.Build(_items.data(), _items.size());
+    }
+
+    std::vector<bool> Search(std::string_view text) const
+    {
+        return _index.Search(text);
+    }
+};
+
+TEST_F(ObjectSearchIndexTest, empty_text_matches_everything)
+{
+    ASSERT_EQ(_index.GetCount(), 3U);
+    EXPECT_EQ(Search(""), std::vector<bool>({ true, true, true }));
+}
+
+TEST_F(ObjectSearchIndexTest, matches_ignoring_case)
+{
+    EXPECT_EQ(Search("wooden"), std::vector<bool>({ true, false, true }));
+    EXPECT_EQ(Search("MERRY"), std::vector<bool>({ false, true, false }));
+}
+
+TEST_F(ObjectSearchIndexTest, matches_other_fields)
+{
+    EXPECT_EQ(Search("sawyer"), std::vector<bool>({ true, true, false }));
+    EXPECT_EQ(Search("custom.fence"), std::vector<bool>({ false, false, true }));
+    EXPECT_EQ(Search("mgr1.parkobj"), std::vector<bool>({ false, true, false }));
+}
+
+TEST_F(ObjectSearchIndexTest, matches_short_text)
+{
+    EXPECT_EQ(Search("go"), std::vector<bool>({ false, true, false }));
+    EXPECT_EQ(Search("mg"), std::vector<bool>({ false, true, false }));
+}
+
+TEST_F(ObjectSearchIndexTest, no_match)
+{
+    EXPECT_EQ(Search("monorail"), std::vector<bool>({ false, false, false }));
+    // All trigrams exist but not in this order.
+    EXPECT_EQ(Search("woodenround"), std::vector<bool>({ false, false, false }));
+}
+
+TEST_F(ObjectSearchIndexTest, matches_do_not_span_fields)
+{
+    EXPECT_EQ(Search("trainschris"), std::vector<bool>({ false, false, false }));
+}
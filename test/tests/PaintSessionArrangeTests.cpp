@@ -0,0 +1,83 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/paint/Paint.h>
+#include <random>
+#include <vector>
+
+class PaintSessionArrangeTest : public testing::TestWithParam<uint8_t>
+{
+protected:
+    static std::vector<paint_struct> CreatePaintStructs(std::mt19937& rng, size_t count, uint16_t numQuadrants)
+    {
+        std::vector<paint_struct> result(count);
+        for (auto& ps : result)
+        {
+            const int32_t x = rng() % 512;
+            const int32_t y = rng() % 512;
+            const int32_t z = rng() % 256;
+            ps.bounds = { x, y, z, x + static_cast<int32_t>(rng() % 64), y + static_cast<int32_t>(rng() % 64),
+                          z + static_cast<int32_t>(rng() % 64) };
+            ps.quadrant_index = static_cast<uint16_t>(10 + rng() % numQuadrants);
+        }
+        return result;
+    }
+
+    static std::unique_ptr<PaintSessionCore> CreateSession(std::vector<paint_struct>& paintStructs, uint8_t rotation)
+    {
+        auto session = std::make_unique<PaintSessionCore>();
+        session->CurrentRotation = rotation;
+        session->QuadrantBackIndex = UINT32_MAX;
+        session->QuadrantFrontIndex = 0;
+        for (auto& ps : paintStructs)
+        {
+            ps.next_quadrant_ps = session->Quadrants[ps.quadrant_index];
+            session->Quadrants[ps.quadrant_index] = &ps;
+            session->QuadrantBackIndex = std::min<uint32_t>(session->QuadrantBackIndex, ps.quadrant_index);
+            session->QuadrantFrontIndex = std::max<uint32_t>(session->QuadrantFrontIndex, ps.quadrant_index);
+        }
+        return session;
+    }
+
+    static std::vector<size_t> GetOrder(const PaintSessionCore& session, const std::vector<paint_struct>& paintStructs)
+    {
+        std::vector<size_t> result;
+        for (auto* ps = session.PaintHead.next_quadrant_ps; ps != nullptr; ps = ps->next_quadrant_ps)
+        {
+            result.push_back(ps - paintStructs.data());
+        }
+        return result;
+    }
+};
+
+TEST_P(PaintSessionArrangeTest, matches_reference_order)
+{
+    std::mt19937 rng(1234);
+    for (int32_t i = 0; i < 200; i++)
+    {
+        auto count = 1 + rng() % 400;
+        auto numQuadrants = static_cast<uint16_t>(1 + rng() % 24);
+        auto expected = CreatePaintStructs(rng, count, numQuadrants);
+        auto actual = expected;
+
+        auto expectedSession = CreateSession(expected, GetParam());
+        auto actualSession = CreateSession(actual, GetParam());
+        PaintSessionArrangeReference(*expectedSession);
+        PaintSessionArrange(*actualSession);
+
+        auto expectedOrder = GetOrder(*expectedSession, expected);
+        ASSERT_EQ(expectedOrder.size(), count);
+        ASSERT_EQ(GetOrder(*actualSession, actual), expectedOrder);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(AllRotations, PaintSessionArrangeTest, testing::Values(0, 1, 2, 3));
@@ -0,0 +1,96 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2021 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/world/TilePointerIndex.hpp>
+#include <vector>
+
+namespace
+{
+    struct TestElement
+    {
+        int32_t X;
+        int32_t Y;
+        bool Last;
+
+        bool IsLastForTile() const
+        {
+            return Last;
+        }
+    };
+} // namespace
+
+static std::vector<TestElement> CreateElements(uint16_t mapSize, TileLayout layout)
+{
+    std::vector<TestElement> elements;
+    TilePointerIndex<TestElement>::ForEachTile(mapSize, layout, [&elements](TileCoordsXY coords) {
+        auto numElements = 1 + (coords.x + coords.y) % 3;
+        for (int32_t i = 0; i < numElements; i++)
+        {
+            elements.push_back({ coords.x, coords.y, i == numElements - 1 });
+        }
+    });
+    return elements;
+}
+
+static void CheckIndex(uint16_t mapSize, TileLayout layout)
+{
+    auto elements = CreateElements(mapSize, layout);
+    auto index = TilePointerIndex<TestElement>(mapSize, elements.data(), elements.size(), layout);
+    ASSERT_EQ(index.GetLayout(), layout);
+
+    size_t numTiles = 0;
+    TilePointerIndex<TestElement>::ForEachTile(mapSize, layout, [&numTiles](TileCoordsXY) { numTiles++; });
+    ASSERT_EQ(numTiles, static_cast<size_t>(mapSize * mapSize));
+
+    for (int32_t y = 0; y < mapSize; y++)
+    {
+        for (int32_t x = 0; x < mapSize; x++)
+        {
+            const auto* element = index.GetFirstElementAt({ x, y });
+            ASSERT_NE(element, nullptr);
+            ASSERT_EQ(element->X, x);
+            ASSERT_EQ(element->Y, y);
+            if (x > 0 || y > 0)
+            {
+                // The first element of a tile must follow the last element of the tile stored before it.
+                ASSERT_TRUE((element - 1)->IsLastForTile());
+            }
+        }
+    }
+}
+
+TEST(TilePointerIndexTest, rows_layout)
+{
+    CheckIndex(37, TileLayout::Rows);
+}
+
+TEST(TilePointerIndexTest, blocks_layout)
+{
+    CheckIndex(37, TileLayout::Blocks);
+    CheckIndex(32, TileLayout::Blocks);
+}
+
+TEST(TilePointerIndexTest, blocks_layout_keeps_blocks_together)
+{
+    auto elements = CreateElements(40, TileLayout::Blocks);
+    auto index = TilePointerIndex<TestElement>(40, elements.data(), elements.size(), TileLayout::Blocks);
+
+    // All tiles of the first 16x16 block are stored before any tile outside it.
+    const auto* blockEnd = index.GetFirstElementAt({ 16, 0 });
+    for (int32_t y = 0; y < 16; y++)
+    {
+        for (int32_t x = 0; x < 16; x++)
+        {
+            ASSERT_LT(index.GetFirstElementAt({ x, y }), blockEnd);
+        }
+    }
+    ASSERT_LT(index.GetFirstElementAt({ 15, 15 }), index.GetFirstElementAt({ 0, 16 }));
+    ASSERT_GT(index.GetFirstElementAt({ 0, 1 }), index.GetFirstElementAt({ 15, 0 }));
+}
@@ -31,12 +31,12 @@ protected:
     static const uint8_t invalid7[6];
     static const uint8_t empty[1];
 
-    void test_encode_decode(uint8_t encoding_type)
+    void test_encode_decode(uint8_t encoding_type, size_t length = sizeof(randomdata))
     {
         // Encode
         sawyercoding_chunk_header chdr_in;
         chdr_in.encoding = encoding_type;
-        chdr_in.length = sizeof(randomdata);
+        chdr_in.length = static_cast<uint32_t>(length);
         uint8_t* encodedDataBuffer = new uint8_t[BUFFER_SIZE];
         size_t encodedDataSize = sawyercoding_write_chunk_buffer(encodedDataBuffer, (const uint8_t*)randomdata, chdr_in);
         ASSERT_GT(encodedDataSize, sizeof(sawyercoding_chunk_header));
@@ -47,7 +47,7 @@ protected:
         auto chunk = reader.ReadChunk();
         ASSERT_EQ(static_cast<uint8_t>(chunk->GetEncoding()), chdr_in.encoding);
         ASSERT_EQ(chunk->GetLength(), chdr_in.length);
-        auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
+        auto result = memcmp(chunk->GetData(), randomdata, length);
         ASSERT_EQ(result, 0);
 
         delete[] encodedDataBuffer;
@@ -89,6 +89,12 @@ TEST_F(SawyerCodingTest, write_read_chunk_rotate)
     test_encode_decode(CHUNK_ENCODING_ROTATE);
 }
 
+TEST_F(SawyerCodingTest, write_read_chunk_rotate_unaligned)
+{
+    // Covers the tail that does not fill a whole group of four bytes
+    test_encode_decode(CHUNK_ENCODING_ROTATE, sizeof(randomdata) - 3);
+}
+
 // Note we only check if provided data decompresses to the same data, not if it compresses the same.
 // The reason for that is we may improve encoding at some point, but the test won't be affected,
 // as we already do a decode test and roundtrip (encode + decode), which validates all uses.